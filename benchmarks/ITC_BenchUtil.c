@@ -0,0 +1,655 @@
+/**
+ * @file ITC_BenchUtil.c
+ * @brief Benchmarking utilities
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_BenchUtil.h"
+
+#include "ITC_Id_package.h"
+#include "ITC_Event_package.h"
+#include "ITC_Event_Test_package.h"
+#include "ITC_TestUtil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/******************************************************************************
+ *  Global variables
+ ******************************************************************************/
+
+/* The number of successful `ITC_Port_malloc` calls so far */
+uint32_t gu32_BenchAllocationCount = 0;
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/* The aggregated traces of each phase, indexed by `ITC_Port_TracePhase_t` */
+static ITC_BenchUtil_PhaseTrace_t
+    grt_BenchPhaseTraces[ITC_PORT_TRACE_PHASE_COUNT];
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Get the next pseudo-random event counter
+ *
+ * @param pu32_State (in) The current state of the generator. (out) The next
+ * state of the generator
+ * @return `ITC_Event_Counter_t` The event counter. Always in the range [0, 7]
+ */
+static ITC_Event_Counter_t nextEventCounter(
+    uint32_t *const pu32_State
+)
+{
+    /* Numerical Recipes LCG. Good enough for shuffling event counters */
+    *pu32_State = *pu32_State * 1664525U + 1013904223U;
+
+    return (ITC_Event_Counter_t)(*pu32_State >> 29U);
+}
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/**
+ * @brief Get the log2 histogram bucket of a value
+ *
+ * @param u64_Value The value
+ * @return `uint32_t` The bucket. See ::ITC_BENCHUTIL_TRACE_BUCKET_COUNT
+ */
+static uint32_t getTraceBucket(
+    uint64_t u64_Value
+)
+{
+    uint32_t u32_Bucket = 0;
+
+    while (u64_Value && u32_Bucket < ITC_BENCHUTIL_TRACE_BUCKET_COUNT - 1)
+    {
+        u64_Value >>= 1U;
+        u32_Bucket++;
+    }
+
+    return u32_Bucket;
+}
+
+/**
+ * @brief Get the name of a phase
+ *
+ * @param t_Phase The phase
+ * @return `const char *` The name of the phase
+ */
+static const char *getPhaseName(
+    ITC_Port_TracePhase_t t_Phase
+)
+{
+    const char *pc_Name;
+
+    switch (t_Phase)
+    {
+        case ITC_PORT_TRACE_PHASE_STAMP_VALIDATE:
+        {
+            pc_Name = "stamp validate";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_STAMP_UNSHARE:
+        {
+            pc_Name = "stamp unshare";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_EVENT_FILL:
+        {
+            pc_Name = "event fill";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_EVENT_GROW:
+        {
+            pc_Name = "event grow";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_EVENT_JOIN_CLONE:
+        {
+            pc_Name = "event join clone";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_EVENT_JOIN_MERGE:
+        {
+            pc_Name = "event join merge";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_EVENT_NORMALISE:
+        {
+            pc_Name = "event normalise";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_EVENT_COMPACT:
+        {
+            pc_Name = "event compact";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_EVENT_COMPARE:
+        {
+            pc_Name = "event compare";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_ID_SPLIT:
+        {
+            pc_Name = "id split";
+            break;
+        }
+        case ITC_PORT_TRACE_PHASE_ID_SUM:
+        {
+            pc_Name = "id sum";
+            break;
+        }
+        default:
+        {
+            pc_Name = "unknown";
+            break;
+        }
+    }
+
+    return pc_Name;
+}
+
+/**
+ * @brief Tracing begin hook. Records when the phase began
+ *
+ * @param pv_UserData Not used
+ * @param t_Phase The phase
+ */
+static void traceBegin(
+    void *pv_UserData,
+    ITC_Port_TracePhase_t t_Phase
+)
+{
+    (void)pv_UserData;
+
+    grt_BenchPhaseTraces[t_Phase].u64_BeginNs = ITC_BenchUtil_nowNs();
+}
+
+/**
+ * @brief Tracing end hook. Aggregates the time spent in the phase and the
+ * size of the resulting tree
+ *
+ * @param pv_UserData Not used
+ * @param t_Phase The phase
+ * @param u32_TreeSize The size of the resulting tree
+ */
+static void traceEnd(
+    void *pv_UserData,
+    ITC_Port_TracePhase_t t_Phase,
+    uint32_t u32_TreeSize
+)
+{
+    ITC_BenchUtil_PhaseTrace_t *pt_Trace = &grt_BenchPhaseTraces[t_Phase];
+    const uint64_t u64_ElapsedNs =
+        ITC_BenchUtil_nowNs() - pt_Trace->u64_BeginNs;
+
+    (void)pv_UserData;
+
+    pt_Trace->u64_Calls++;
+    pt_Trace->u64_TotalNs += u64_ElapsedNs;
+    pt_Trace->u64_TotalTreeSize += u32_TreeSize;
+    pt_Trace->ru64_LatencyHistogram[getTraceBucket(u64_ElapsedNs)]++;
+    pt_Trace->ru64_TreeSizeHistogram[getTraceBucket(u32_TreeSize)]++;
+}
+
+/**
+ * @brief Print a log2 histogram
+ *
+ * Only the non-empty buckets are printed.
+ *
+ * @param pc_Name The name of the histogram
+ * @param pu64_Histogram The histogram
+ */
+static void printTraceHistogram(
+    const char *pc_Name,
+    const uint64_t *pu64_Histogram
+)
+{
+    uint32_t u32_I;
+
+    printf("#   %s:\n", pc_Name);
+
+    for (u32_I = 0; u32_I < ITC_BENCHUTIL_TRACE_BUCKET_COUNT; u32_I++)
+    {
+        if (pu64_Histogram[u32_I] && u32_I == 0)
+        {
+            printf(
+                "#     %10s %12llu\n",
+                "0",
+                (unsigned long long)pu64_Histogram[u32_I]);
+        }
+        else if (pu64_Histogram[u32_I])
+        {
+            printf(
+                "#     %10llu %12llu\n",
+                1ULL << (u32_I - 1U),
+                (unsigned long long)pu64_Histogram[u32_I]);
+        }
+        else
+        {
+            /* Nothing to print */
+        }
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+/**
+ * @brief Recursively build an ID tree
+ *
+ * @param ppt_Id (out) The pointer to the ID
+ * @param pt_Parent The parent of the ID
+ * @param t_Shape The shape of the tree
+ * @param u32_Depth The remaining depth of the tree
+ * @param pu32_LeafIndex (in) The index of the next leaf. (out) The index of
+ * the leaf after the last leaf of the tree
+ * @param b_Invert Whether to invert the ownership of all leaves
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t buildId(
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t *const pt_Parent,
+    const ITC_BenchUtil_Shape_t t_Shape,
+    const uint32_t u32_Depth,
+    uint32_t *const pu32_LeafIndex,
+    const bool b_Invert
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (u32_Depth == 0)
+    {
+        /* Alternate the ownership of the leaves */
+        if ((((*pu32_LeafIndex) % 2U) == 0U) != b_Invert)
+        {
+            t_Status = ITC_TestUtil_newSeedId(ppt_Id, pt_Parent);
+        }
+        else
+        {
+            t_Status = ITC_TestUtil_newNullId(ppt_Id, pt_Parent);
+        }
+
+        (*pu32_LeafIndex)++;
+    }
+    else
+    {
+        t_Status = ITC_TestUtil_newNullId(ppt_Id, pt_Parent);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = buildId(
+                &(*ppt_Id)->pt_Left,
+                *ppt_Id,
+                t_Shape,
+                (t_Shape == ITC_BENCHUTIL_SHAPE_COMB) ? 0 : u32_Depth - 1U,
+                pu32_LeafIndex,
+                b_Invert);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = buildId(
+                &(*ppt_Id)->pt_Right,
+                *ppt_Id,
+                t_Shape,
+                u32_Depth - 1U,
+                pu32_LeafIndex,
+                b_Invert);
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Normalise an Event node with already normalised children
+ *
+ * @param pt_Event The Event node
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t normaliseEventNode(
+    ITC_Event_t *const pt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_Counter_t t_Min;
+
+    if (ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Left) &&
+        ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Right) &&
+        pt_Event->pt_Left->t_Count == pt_Event->pt_Right->t_Count)
+    {
+        /* norm((n, m, m)) = n + m */
+        pt_Event->t_Count += pt_Event->pt_Left->t_Count;
+
+        t_Status = ITC_Event_destroy(&pt_Event->pt_Left);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Event_destroy(&pt_Event->pt_Right);
+        }
+    }
+    else
+    {
+        /* The minimum of a normalised Event is its own counter */
+        t_Min = (pt_Event->pt_Left->t_Count < pt_Event->pt_Right->t_Count) ?
+            pt_Event->pt_Left->t_Count :
+            pt_Event->pt_Right->t_Count;
+
+        /* norm((n, e1, e2)) = (n + m, sink(e1, m), sink(e2, m)) */
+        pt_Event->t_Count += t_Min;
+        pt_Event->pt_Left->t_Count -= t_Min;
+        pt_Event->pt_Right->t_Count -= t_Min;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Recursively build a normalised Event tree
+ *
+ * @param ppt_Event (out) The pointer to the Event
+ * @param pt_Parent The parent of the Event
+ * @param t_Shape The shape of the tree
+ * @param u32_Depth The remaining depth of the tree
+ * @param pu32_State The state of the event counter generator
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t buildEvent(
+    ITC_Event_t **const ppt_Event,
+    ITC_Event_t *const pt_Parent,
+    const ITC_BenchUtil_Shape_t t_Shape,
+    const uint32_t u32_Depth,
+    uint32_t *const pu32_State
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = ITC_TestUtil_newEvent(
+        ppt_Event, pt_Parent, nextEventCounter(pu32_State));
+
+    if (t_Status == ITC_STATUS_SUCCESS && u32_Depth > 0)
+    {
+        t_Status = buildEvent(
+            &(*ppt_Event)->pt_Left,
+            *ppt_Event,
+            t_Shape,
+            (t_Shape == ITC_BENCHUTIL_SHAPE_COMB) ? 0 : u32_Depth - 1U,
+            pu32_State);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = buildEvent(
+                &(*ppt_Event)->pt_Right,
+                *ppt_Event,
+                t_Shape,
+                u32_Depth - 1U,
+                pu32_State);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = normaliseEventNode(*ppt_Event);
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Abort the benchmark if an operation did not succeed
+ ******************************************************************************/
+
+void ITC_BenchUtil_checkSuccess(
+    ITC_Status_t t_Status,
+    const char *pc_Expression,
+    const char *pc_File,
+    uint32_t u32_Line
+)
+{
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        fprintf(
+            stderr,
+            "%s:%u: `%s` failed with status %u\n",
+            pc_File,
+            u32_Line,
+            pc_Expression,
+            (unsigned int)t_Status);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/******************************************************************************
+ * Get the value of a monotonic clock
+ ******************************************************************************/
+
+uint64_t ITC_BenchUtil_nowNs(void)
+{
+    struct timespec t_Now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &t_Now);
+
+    return ((uint64_t)t_Now.tv_sec * 1000000000U) + (uint64_t)t_Now.tv_nsec;
+}
+
+/******************************************************************************
+ * Get the name of the shape of a tree
+ ******************************************************************************/
+
+const char *ITC_BenchUtil_shapeName(
+    ITC_BenchUtil_Shape_t t_Shape
+)
+{
+    const char *pc_Name;
+
+    switch (t_Shape)
+    {
+        case ITC_BENCHUTIL_SHAPE_BALANCED:
+        {
+            pc_Name = "balanced";
+            break;
+        }
+        case ITC_BENCHUTIL_SHAPE_COMB:
+        {
+            pc_Name = "comb";
+            break;
+        }
+        default:
+        {
+            pc_Name = "unknown";
+            break;
+        }
+    }
+
+    return pc_Name;
+}
+
+/******************************************************************************
+ * Allocate a new normalised ID tree of a given shape
+ ******************************************************************************/
+
+ITC_Status_t ITC_BenchUtil_newId(
+    ITC_Id_t **ppt_Id,
+    ITC_BenchUtil_Shape_t t_Shape,
+    uint32_t u32_Depth,
+    bool b_Invert
+)
+{
+    uint32_t u32_LeafIndex = 0;
+
+    /* Sibling leaves never share the same ownership, so the tree is always
+     * normalised */
+    return buildId(ppt_Id, NULL, t_Shape, u32_Depth, &u32_LeafIndex, b_Invert);
+}
+
+/******************************************************************************
+ * Allocate a new normalised Event tree of a given shape
+ ******************************************************************************/
+
+ITC_Status_t ITC_BenchUtil_newEvent(
+    ITC_Event_t **ppt_Event,
+    ITC_BenchUtil_Shape_t t_Shape,
+    uint32_t u32_Depth,
+    uint32_t u32_Seed
+)
+{
+    uint32_t u32_State = u32_Seed;
+
+    return buildEvent(ppt_Event, NULL, t_Shape, u32_Depth, &u32_State);
+}
+
+/******************************************************************************
+ * Allocate a new Stamp with an ID and an Event tree of a given shape
+ ******************************************************************************/
+
+ITC_Status_t ITC_BenchUtil_newStamp(
+    ITC_Stamp_t **ppt_Stamp,
+    ITC_BenchUtil_Shape_t t_Shape,
+    uint32_t u32_Depth,
+    bool b_Invert
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    /* A seed Stamp has an empty inflation cache, so swapping its components
+     * is safe */
+    t_Status = ITC_Stamp_newSeed(ppt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_destroy(&(*ppt_Stamp)->pt_Event);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_BenchUtil_newId(
+            &(*ppt_Stamp)->pt_Id, t_Shape, u32_Depth, b_Invert);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_BenchUtil_newEvent(
+            &(*ppt_Stamp)->pt_Event,
+            t_Shape,
+            u32_Depth,
+            (b_Invert) ? 0xDEADBEEFU : 0xC0FFEEU);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/******************************************************************************
+ * Clear the aggregated traces of all phases
+ ******************************************************************************/
+
+void ITC_BenchUtil_resetTraces(void)
+{
+    memset(&grt_BenchPhaseTraces[0], 0, sizeof(grt_BenchPhaseTraces));
+}
+
+/******************************************************************************
+ * Start aggregating the traces of the libitc phases
+ ******************************************************************************/
+
+void ITC_BenchUtil_startTracing(void)
+{
+    const ITC_Port_TraceHooks_t t_Hooks = {traceBegin, traceEnd, NULL};
+
+    BENCH_SUCCESS(ITC_Port_setTraceHooks(&t_Hooks));
+}
+
+/******************************************************************************
+ * Stop aggregating the traces of the libitc phases
+ ******************************************************************************/
+
+void ITC_BenchUtil_stopTracing(void)
+{
+    BENCH_SUCCESS(ITC_Port_setTraceHooks(NULL));
+}
+
+/******************************************************************************
+ * Get the aggregated traces of a phase
+ ******************************************************************************/
+
+const ITC_BenchUtil_PhaseTrace_t *ITC_BenchUtil_getPhaseTrace(
+    ITC_Port_TracePhase_t t_Phase
+)
+{
+    return &grt_BenchPhaseTraces[t_Phase];
+}
+
+/******************************************************************************
+ * Print the latency histograms and tree size distributions of all phases
+ ******************************************************************************/
+
+void ITC_BenchUtil_printTraces(void)
+{
+    const ITC_BenchUtil_PhaseTrace_t *pt_Trace;
+    uint32_t u32_I;
+
+    for (u32_I = 0; u32_I < ITC_PORT_TRACE_PHASE_COUNT; u32_I++)
+    {
+        pt_Trace = &grt_BenchPhaseTraces[u32_I];
+
+        if (pt_Trace->u64_Calls)
+        {
+            printf(
+                "# phase: %s, calls: %llu, ns/call: %.1f, nodes/call: %.2f\n",
+                getPhaseName((ITC_Port_TracePhase_t)u32_I),
+                (unsigned long long)pt_Trace->u64_Calls,
+                (double)pt_Trace->u64_TotalNs / (double)pt_Trace->u64_Calls,
+                (double)pt_Trace->u64_TotalTreeSize /
+                    (double)pt_Trace->u64_Calls);
+            printTraceHistogram(
+                "latency (>= ns, calls)", &pt_Trace->ru64_LatencyHistogram[0]);
+            printTraceHistogram(
+                "tree size (>= nodes, calls)",
+                &pt_Trace->ru64_TreeSizeHistogram[0]);
+        }
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+/******************************************************************************
+ * Wraps `ITC_Port_malloc` to count the allocations
+ ******************************************************************************/
+
+ITC_Status_t __wrap_ITC_Port_malloc(
+    void **ppv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = __real_ITC_Port_malloc(ppv_Ptr, t_AllocType);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        gu32_BenchAllocationCount++;
+    }
+
+    return t_Status;
+}
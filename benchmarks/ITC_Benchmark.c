@@ -0,0 +1,597 @@
+/**
+ * @file ITC_Benchmark.c
+ * @brief Micro-benchmarks for the public API of libitc
+ *
+ * Runs every benchmark against Stamps with ID and Event trees of various
+ * shapes and depths, and reports the average time (in nanoseconds) and the
+ * average number of node allocations per operation.
+ *
+ * Usage: `ITC_Benchmark_<allocation type> [iterations]`
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_BenchUtil.h"
+
+#include "ITC_Stamp.h"
+#include "ITC_SerDes.h"
+#include "ITC_Port.h"
+#include "ITC_TestUtil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/** The default number of times each benchmark is executed */
+#define DEFAULT_ITERATIONS                                                (1000)
+
+/** The number of events added by the `ITC_Stamp_eventN` benchmark */
+#define EVENT_N_COUNT                                                       (16)
+
+/** The number of Stamps joined by the `ITC_Stamp_joinMany` benchmark */
+#define JOIN_MANY_COUNT                                                      (4)
+
+/** The size of the serialisation buffer */
+#define SERIALISATION_BUFFER_SIZE                                         (8192)
+
+/** Get the number of elements in an array */
+#define ARRAY_COUNT(x)                                (sizeof(x) / sizeof(x[0]))
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
+#define ALLOCATION_TYPE_NAME                                            "malloc"
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#define ALLOCATION_TYPE_NAME                                            "static"
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST
+#define ALLOCATION_TYPE_NAME                                  "static free list"
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+#define ALLOCATION_TYPE_NAME                              "concurrent free list"
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+#define ALLOCATION_TYPE_NAME                                           "context"
+#else
+#define ALLOCATION_TYPE_NAME                                            "custom"
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
+
+/******************************************************************************
+ *  Types
+ ******************************************************************************/
+
+/**
+ * @brief The state shared by all benchmarks of a workload
+ */
+typedef struct
+{
+    /** The Stamp of the workload. Must not be modified by the benchmarks */
+    ITC_Stamp_t *pt_Stamp;
+    /** A Stamp concurrent to `pt_Stamp` and with the complementary ID. Must
+     * not be modified by the benchmarks */
+    ITC_Stamp_t *pt_OtherStamp;
+    /** Stamps the benchmarks are free to modify */
+    ITC_Stamp_t *rpt_Work[JOIN_MANY_COUNT];
+    /** The serialised `pt_Stamp` */
+    uint8_t ru8_Serialised[SERIALISATION_BUFFER_SIZE];
+    /** The size of the serialised `pt_Stamp` */
+    uint32_t u32_SerialisedSize;
+    /** A buffer the benchmarks are free to modify */
+    uint8_t ru8_Buffer[SERIALISATION_BUFFER_SIZE];
+} Workload_t;
+
+/**
+ * @brief A benchmark
+ *
+ * Only `pf_Run` is timed. `pf_Setup` and `pf_Teardown` are optional and are
+ * called before and after every call to `pf_Run`, respectively.
+ */
+typedef struct
+{
+    /** The name of the benchmark */
+    const char *pc_Name;
+    /** Prepare the workload for the benchmarked operation */
+    void (*pf_Setup)(Workload_t *pt_Workload);
+    /** Perform the benchmarked operation */
+    void (*pf_Run)(Workload_t *pt_Workload);
+    /** Clean up after the benchmarked operation */
+    void (*pf_Teardown)(Workload_t *pt_Workload);
+} Benchmark_t;
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Clone the Stamp of the workload into the first work Stamp
+ *
+ * @param pt_Workload The workload
+ */
+static void cloneStamp(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(
+        ITC_Stamp_clone(pt_Workload->pt_Stamp, &pt_Workload->rpt_Work[0]));
+}
+
+/**
+ * @brief Clone both Stamps of the workload into the first two work Stamps
+ *
+ * @param pt_Workload The workload
+ */
+static void cloneBothStamps(
+    Workload_t *pt_Workload
+)
+{
+    cloneStamp(pt_Workload);
+    BENCH_SUCCESS(
+        ITC_Stamp_clone(
+            pt_Workload->pt_OtherStamp, &pt_Workload->rpt_Work[1]));
+}
+
+/**
+ * @brief Fork clones of both Stamps of the workload into all work Stamps
+ *
+ * @param pt_Workload The workload
+ */
+static void forkBothStamps(
+    Workload_t *pt_Workload
+)
+{
+    cloneBothStamps(pt_Workload);
+    BENCH_SUCCESS(
+        ITC_Stamp_fork(&pt_Workload->rpt_Work[0], &pt_Workload->rpt_Work[2]));
+    BENCH_SUCCESS(
+        ITC_Stamp_fork(&pt_Workload->rpt_Work[1], &pt_Workload->rpt_Work[3]));
+}
+
+/**
+ * @brief Destroy all work Stamps
+ *
+ * @param pt_Workload The workload
+ */
+static void destroyWorkStamps(
+    Workload_t *pt_Workload
+)
+{
+    uint32_t u32_I;
+
+    for (u32_I = 0; u32_I < ARRAY_COUNT(pt_Workload->rpt_Work); u32_I++)
+    {
+        if (pt_Workload->rpt_Work[u32_I])
+        {
+            BENCH_SUCCESS(ITC_Stamp_destroy(&pt_Workload->rpt_Work[u32_I]));
+        }
+    }
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_newSeed`
+ *
+ * @param pt_Workload The workload
+ */
+static void runNewSeed(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(ITC_Stamp_newSeed(&pt_Workload->rpt_Work[0]));
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_destroy`
+ *
+ * @param pt_Workload The workload
+ */
+static void runDestroy(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(ITC_Stamp_destroy(&pt_Workload->rpt_Work[0]));
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_clone`
+ *
+ * @param pt_Workload The workload
+ */
+static void runClone(
+    Workload_t *pt_Workload
+)
+{
+    cloneStamp(pt_Workload);
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_newPeek`
+ *
+ * @param pt_Workload The workload
+ */
+static void runNewPeek(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(
+        ITC_Stamp_newPeek(pt_Workload->pt_Stamp, &pt_Workload->rpt_Work[0]));
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_validate`
+ *
+ * @param pt_Workload The workload
+ */
+static void runValidate(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(ITC_Stamp_validate(pt_Workload->pt_Stamp));
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_fork`
+ *
+ * @param pt_Workload The workload
+ */
+static void runFork(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(
+        ITC_Stamp_fork(&pt_Workload->rpt_Work[0], &pt_Workload->rpt_Work[1]));
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_event`
+ *
+ * @param pt_Workload The workload
+ */
+static void runEvent(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(ITC_Stamp_event(pt_Workload->rpt_Work[0]));
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_eventN`
+ *
+ * @param pt_Workload The workload
+ */
+static void runEventN(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(ITC_Stamp_eventN(pt_Workload->rpt_Work[0], EVENT_N_COUNT));
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_join`
+ *
+ * @param pt_Workload The workload
+ */
+static void runJoin(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(
+        ITC_Stamp_join(&pt_Workload->rpt_Work[0], &pt_Workload->rpt_Work[1]));
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_joinMany`
+ *
+ * @param pt_Workload The workload
+ */
+static void runJoinMany(
+    Workload_t *pt_Workload
+)
+{
+    ITC_Stamp_t *pt_JoinedStamp;
+
+    BENCH_SUCCESS(
+        ITC_Stamp_joinMany(
+            &pt_Workload->rpt_Work[0],
+            ARRAY_COUNT(pt_Workload->rpt_Work),
+            &pt_JoinedStamp));
+
+    pt_Workload->rpt_Work[0] = pt_JoinedStamp;
+}
+
+/**
+ * @brief Benchmark `ITC_Stamp_compare`
+ *
+ * @param pt_Workload The workload
+ */
+static void runCompare(
+    Workload_t *pt_Workload
+)
+{
+    ITC_Stamp_Comparison_t t_Result;
+
+    BENCH_SUCCESS(
+        ITC_Stamp_compare(
+            pt_Workload->pt_Stamp, pt_Workload->pt_OtherStamp, &t_Result));
+}
+
+/**
+ * @brief Benchmark `ITC_SerDes_serialiseStamp`
+ *
+ * @param pt_Workload The workload
+ */
+static void runSerialise(
+    Workload_t *pt_Workload
+)
+{
+    uint32_t u32_BufferSize = sizeof(pt_Workload->ru8_Buffer);
+
+    BENCH_SUCCESS(
+        ITC_SerDes_serialiseStamp(
+            pt_Workload->pt_Stamp,
+            &pt_Workload->ru8_Buffer[0],
+            &u32_BufferSize));
+}
+
+/**
+ * @brief Benchmark `ITC_SerDes_deserialiseStamp`
+ *
+ * @param pt_Workload The workload
+ */
+static void runDeserialise(
+    Workload_t *pt_Workload
+)
+{
+    BENCH_SUCCESS(
+        ITC_SerDes_deserialiseStamp(
+            &pt_Workload->ru8_Serialised[0],
+            pt_Workload->u32_SerialisedSize,
+            &pt_Workload->rpt_Work[0]));
+}
+
+/**
+ * @brief Create the workload for a given tree shape and depth
+ *
+ * @param pt_Workload (out) The workload
+ * @param t_Shape The shape of the trees
+ * @param u32_Depth The depth of the trees
+ */
+static void newWorkload(
+    Workload_t *pt_Workload,
+    ITC_BenchUtil_Shape_t t_Shape,
+    uint32_t u32_Depth
+)
+{
+    uint32_t u32_I;
+
+    for (u32_I = 0; u32_I < ARRAY_COUNT(pt_Workload->rpt_Work); u32_I++)
+    {
+        pt_Workload->rpt_Work[u32_I] = NULL;
+    }
+
+    BENCH_SUCCESS(
+        ITC_BenchUtil_newStamp(
+            &pt_Workload->pt_Stamp, t_Shape, u32_Depth, false));
+    BENCH_SUCCESS(
+        ITC_BenchUtil_newStamp(
+            &pt_Workload->pt_OtherStamp, t_Shape, u32_Depth, true));
+
+    pt_Workload->u32_SerialisedSize = sizeof(pt_Workload->ru8_Serialised);
+    BENCH_SUCCESS(
+        ITC_SerDes_serialiseStamp(
+            pt_Workload->pt_Stamp,
+            &pt_Workload->ru8_Serialised[0],
+            &pt_Workload->u32_SerialisedSize));
+}
+
+/**
+ * @brief Destroy a workload
+ *
+ * @param pt_Workload The workload
+ */
+static void destroyWorkload(
+    Workload_t *pt_Workload
+)
+{
+    destroyWorkStamps(pt_Workload);
+    BENCH_SUCCESS(ITC_Stamp_destroy(&pt_Workload->pt_Stamp));
+    BENCH_SUCCESS(ITC_Stamp_destroy(&pt_Workload->pt_OtherStamp));
+}
+
+/**
+ * @brief Measure the overhead of timing an operation
+ *
+ * @return `uint64_t` The average overhead in nanoseconds
+ */
+static uint64_t measureTimerOverhead(void)
+{
+    const uint32_t u32_Iterations = 10000;
+    uint64_t u64_Total = 0;
+    uint64_t u64_Start;
+    uint32_t u32_I;
+
+    for (u32_I = 0; u32_I < u32_Iterations; u32_I++)
+    {
+        u64_Start = ITC_BenchUtil_nowNs();
+        u64_Total += ITC_BenchUtil_nowNs() - u64_Start;
+    }
+
+    return u64_Total / u32_Iterations;
+}
+
+/**
+ * @brief Run a benchmark and print the results
+ *
+ * @param pt_Benchmark The benchmark
+ * @param pt_Workload The workload
+ * @param t_Shape The shape of the workload trees
+ * @param u32_Depth The depth of the workload trees
+ * @param u32_Iterations The number of times to run the benchmark
+ * @param u64_TimerOverhead The overhead of timing an operation
+ */
+static void runBenchmark(
+    const Benchmark_t *pt_Benchmark,
+    Workload_t *pt_Workload,
+    ITC_BenchUtil_Shape_t t_Shape,
+    uint32_t u32_Depth,
+    uint32_t u32_Iterations,
+    uint64_t u64_TimerOverhead
+)
+{
+    uint64_t u64_TotalNs = 0;
+    uint64_t u64_TotalAllocations = 0;
+    uint64_t u64_Start;
+    uint64_t u64_Elapsed;
+    uint32_t u32_Allocations;
+    uint32_t u32_I;
+
+    for (u32_I = 0; u32_I < u32_Iterations; u32_I++)
+    {
+        if (pt_Benchmark->pf_Setup)
+        {
+            pt_Benchmark->pf_Setup(pt_Workload);
+        }
+
+        u32_Allocations = gu32_BenchAllocationCount;
+#if ITC_CONFIG_ENABLE_TRACING
+        /* Only trace the benchmarked operation */
+        ITC_BenchUtil_startTracing();
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+        u64_Start = ITC_BenchUtil_nowNs();
+
+        pt_Benchmark->pf_Run(pt_Workload);
+
+        u64_Elapsed = ITC_BenchUtil_nowNs() - u64_Start;
+#if ITC_CONFIG_ENABLE_TRACING
+        ITC_BenchUtil_stopTracing();
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+        u64_TotalAllocations += gu32_BenchAllocationCount - u32_Allocations;
+        u64_TotalNs +=
+            (u64_Elapsed > u64_TimerOverhead) ?
+                u64_Elapsed - u64_TimerOverhead :
+                0;
+
+        if (pt_Benchmark->pf_Teardown)
+        {
+            pt_Benchmark->pf_Teardown(pt_Workload);
+        }
+    }
+
+    printf(
+        "%-28s %-9s %5u %12.1f %10.2f\n",
+        pt_Benchmark->pc_Name,
+        ITC_BenchUtil_shapeName(t_Shape),
+        u32_Depth,
+        (double)u64_TotalNs / (double)u32_Iterations,
+        (double)u64_TotalAllocations / (double)u32_Iterations);
+}
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/**
+ * @brief Benchmark entrypoint
+ *
+ * @param argc The number of arguments
+ * @param argv The arguments. `argv[1]` optionally sets the number of
+ * iterations
+ * @return `int` The exit status
+ */
+int main(int argc, char *argv[])
+{
+    const Benchmark_t rt_Benchmarks[] =
+    {
+        {"ITC_Stamp_newSeed", NULL, runNewSeed, destroyWorkStamps},
+        {"ITC_Stamp_destroy", cloneStamp, runDestroy, NULL},
+        {"ITC_Stamp_clone", NULL, runClone, destroyWorkStamps},
+        {"ITC_Stamp_newPeek", NULL, runNewPeek, destroyWorkStamps},
+        {"ITC_Stamp_validate", NULL, runValidate, NULL},
+        {"ITC_Stamp_fork", cloneStamp, runFork, destroyWorkStamps},
+        {"ITC_Stamp_event", cloneStamp, runEvent, destroyWorkStamps},
+        {"ITC_Stamp_eventN", cloneStamp, runEventN, destroyWorkStamps},
+        {"ITC_Stamp_join", cloneBothStamps, runJoin, destroyWorkStamps},
+        {"ITC_Stamp_joinMany", forkBothStamps, runJoinMany, destroyWorkStamps},
+        {"ITC_Stamp_compare", NULL, runCompare, NULL},
+        {"ITC_SerDes_serialiseStamp", NULL, runSerialise, NULL},
+        {
+            "ITC_SerDes_deserialiseStamp",
+            NULL,
+            runDeserialise,
+            destroyWorkStamps
+        },
+    };
+    const ITC_BenchUtil_Shape_t rt_Shapes[] =
+    {
+        ITC_BENCHUTIL_SHAPE_BALANCED,
+        ITC_BENCHUTIL_SHAPE_COMB,
+    };
+    const uint32_t ru32_Depths[] = {1, 4, 8};
+    static Workload_t t_Workload;
+    uint32_t u32_Iterations = DEFAULT_ITERATIONS;
+    uint64_t u64_TimerOverhead;
+    uint32_t u32_Shape;
+    uint32_t u32_Depth;
+    uint32_t u32_I;
+
+    if (argc > 1)
+    {
+        u32_Iterations = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+
+    if (u32_Iterations == 0)
+    {
+        fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    BENCH_SUCCESS(ITC_Port_init());
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* Allocate from the pools backed by the static test node arrays */
+    ITC_TestUtil_initTestContext();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+    u64_TimerOverhead = measureTimerOverhead();
+
+    printf(
+        "# allocation type: %s, iterations: %u, timer overhead: %u ns\n",
+        ALLOCATION_TYPE_NAME,
+        u32_Iterations,
+        (unsigned int)u64_TimerOverhead);
+    printf(
+        "%-28s %-9s %5s %12s %10s\n",
+        "benchmark",
+        "shape",
+        "depth",
+        "ns/op",
+        "allocs/op");
+
+    for (u32_Shape = 0; u32_Shape < ARRAY_COUNT(rt_Shapes); u32_Shape++)
+    {
+        for (u32_Depth = 0; u32_Depth < ARRAY_COUNT(ru32_Depths); u32_Depth++)
+        {
+            newWorkload(
+                &t_Workload, rt_Shapes[u32_Shape], ru32_Depths[u32_Depth]);
+
+            for (u32_I = 0; u32_I < ARRAY_COUNT(rt_Benchmarks); u32_I++)
+            {
+                runBenchmark(
+                    &rt_Benchmarks[u32_I],
+                    &t_Workload,
+                    rt_Shapes[u32_Shape],
+                    ru32_Depths[u32_Depth],
+                    u32_Iterations,
+                    u64_TimerOverhead);
+            }
+
+            destroyWorkload(&t_Workload);
+        }
+    }
+
+#if ITC_CONFIG_ENABLE_TRACING
+    /* The traces of all benchmarks, shapes and depths */
+    ITC_BenchUtil_printTraces();
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+    BENCH_SUCCESS(ITC_Port_fini());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,424 @@
+/**
+ * @file ITC_CompareManyBenchmark.c
+ * @brief Scaling benchmark for `ITC_Stamp_compareMany`
+ *
+ * Compares a Stamp against a large array of Stamps, spreading the comparisons
+ * over an increasing number of threads, and reports the average time (in
+ * nanoseconds) per batch and per comparison, as well as the speedup over a
+ * single thread.
+ *
+ * Usage: `ITC_CompareManyBenchmark [iterations]`
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_BenchUtil.h"
+
+#include "ITC_Stamp.h"
+#include "ITC_Port.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/** The default number of times each batch is compared */
+#define DEFAULT_ITERATIONS                                                 (100)
+
+/** The number of Stamps in each batch */
+#define BATCH_SIZE                                                        (1024)
+
+/** The depth of the Stamp trees */
+#define TREE_DEPTH                                                           (8)
+
+/** The maximum number of threads to benchmark with */
+#define MAX_THREADS                                                         (64)
+
+/** Get the number of elements in an array */
+#define ARRAY_COUNT(x)                                (sizeof(x) / sizeof(x[0]))
+
+/******************************************************************************
+ *  Types
+ ******************************************************************************/
+
+/**
+ * @brief A minimal thread pool. The calling thread runs jobs as well
+ */
+typedef struct
+{
+    /** Protects all other fields */
+    pthread_mutex_t t_Lock;
+    /** Signalled when new jobs are available or the pool is stopping */
+    pthread_cond_t t_JobsAvailable;
+    /** Signalled when all jobs have completed */
+    pthread_cond_t t_JobsDone;
+    /** The worker threads */
+    pthread_t rt_Threads[MAX_THREADS];
+    /** The number of worker threads */
+    uint32_t u32_ThreadCount;
+    /** Whether the worker threads must exit */
+    bool b_Stop;
+    /** The job to run */
+    ITC_Status_t (*pf_Job)(void *pv_JobContext, uint32_t u32_Job);
+    /** The context of the job */
+    void *pv_JobContext;
+    /** The next job to run */
+    uint32_t u32_NextJob;
+    /** The number of jobs */
+    uint32_t u32_JobCount;
+    /** The number of jobs that have completed */
+    uint32_t u32_JobsDone;
+    /** The status of the jobs */
+    ITC_Status_t t_Status;
+} ThreadPool_t;
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Run the available jobs of a thread pool until there are none left
+ *
+ * Must be called with the lock of the pool held
+ *
+ * @param pt_Pool The thread pool
+ */
+static void runAvailableJobs(
+    ThreadPool_t *pt_Pool
+)
+{
+    uint32_t u32_Job;
+    ITC_Status_t t_Status;
+
+    while (pt_Pool->u32_NextJob < pt_Pool->u32_JobCount)
+    {
+        u32_Job = pt_Pool->u32_NextJob++;
+
+        (void)pthread_mutex_unlock(&pt_Pool->t_Lock);
+        t_Status = pt_Pool->pf_Job(pt_Pool->pv_JobContext, u32_Job);
+        (void)pthread_mutex_lock(&pt_Pool->t_Lock);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            pt_Pool->t_Status = t_Status;
+        }
+
+        if (++pt_Pool->u32_JobsDone == pt_Pool->u32_JobCount)
+        {
+            (void)pthread_cond_signal(&pt_Pool->t_JobsDone);
+        }
+    }
+}
+
+/**
+ * @brief The entrypoint of a worker thread
+ *
+ * @param pv_Pool The thread pool. Points to `ThreadPool_t`
+ * @return `void *` Always `NULL`
+ */
+static void *runWorker(
+    void *pv_Pool
+)
+{
+    ThreadPool_t *pt_Pool = (ThreadPool_t *)pv_Pool;
+
+    (void)pthread_mutex_lock(&pt_Pool->t_Lock);
+
+    while (!pt_Pool->b_Stop)
+    {
+        runAvailableJobs(pt_Pool);
+        (void)pthread_cond_wait(&pt_Pool->t_JobsAvailable, &pt_Pool->t_Lock);
+    }
+
+    (void)pthread_mutex_unlock(&pt_Pool->t_Lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Run the jobs of a batch Stamp operation on a thread pool
+ *
+ * See `ITC_Stamp_Executor_t`
+ *
+ * @param pv_UserData The thread pool. Points to `ThreadPool_t`
+ * @param pf_Job The job to run
+ * @param pv_JobContext The context of the job
+ * @param u32_JobCount The number of jobs
+ * @return `ITC_Status_t` The status of the jobs
+ */
+static ITC_Status_t runJobs(
+    void *pv_UserData,
+    ITC_Status_t (*pf_Job)(void *pv_JobContext, uint32_t u32_Job),
+    void *pv_JobContext,
+    uint32_t u32_JobCount
+)
+{
+    ThreadPool_t *pt_Pool = (ThreadPool_t *)pv_UserData;
+    ITC_Status_t t_Status;
+
+    (void)pthread_mutex_lock(&pt_Pool->t_Lock);
+
+    pt_Pool->pf_Job = pf_Job;
+    pt_Pool->pv_JobContext = pv_JobContext;
+    pt_Pool->u32_NextJob = 0;
+    pt_Pool->u32_JobCount = u32_JobCount;
+    pt_Pool->u32_JobsDone = 0;
+    pt_Pool->t_Status = ITC_STATUS_SUCCESS;
+
+    (void)pthread_cond_broadcast(&pt_Pool->t_JobsAvailable);
+
+    runAvailableJobs(pt_Pool);
+
+    while (pt_Pool->u32_JobsDone < pt_Pool->u32_JobCount)
+    {
+        (void)pthread_cond_wait(&pt_Pool->t_JobsDone, &pt_Pool->t_Lock);
+    }
+
+    t_Status = pt_Pool->t_Status;
+
+    (void)pthread_mutex_unlock(&pt_Pool->t_Lock);
+
+    return t_Status;
+}
+
+/**
+ * @brief Start a thread pool
+ *
+ * @param pt_Pool (out) The thread pool
+ * @param u32_ThreadCount The total number of threads, including the calling
+ * thread. Must be `<= MAX_THREADS`
+ */
+static void startThreadPool(
+    ThreadPool_t *pt_Pool,
+    uint32_t u32_ThreadCount
+)
+{
+    uint32_t u32_I;
+
+    (void)pthread_mutex_init(&pt_Pool->t_Lock, NULL);
+    (void)pthread_cond_init(&pt_Pool->t_JobsAvailable, NULL);
+    (void)pthread_cond_init(&pt_Pool->t_JobsDone, NULL);
+    pt_Pool->b_Stop = false;
+    pt_Pool->u32_NextJob = 0;
+    pt_Pool->u32_JobCount = 0;
+    pt_Pool->u32_ThreadCount = u32_ThreadCount - 1;
+
+    for (u32_I = 0; u32_I < pt_Pool->u32_ThreadCount; u32_I++)
+    {
+        if (pthread_create(
+                &pt_Pool->rt_Threads[u32_I], NULL, runWorker, pt_Pool) != 0)
+        {
+            fprintf(stderr, "failed to create worker thread\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/**
+ * @brief Stop a thread pool and wait for all worker threads to exit
+ *
+ * @param pt_Pool The thread pool
+ */
+static void stopThreadPool(
+    ThreadPool_t *pt_Pool
+)
+{
+    uint32_t u32_I;
+
+    (void)pthread_mutex_lock(&pt_Pool->t_Lock);
+    pt_Pool->b_Stop = true;
+    (void)pthread_cond_broadcast(&pt_Pool->t_JobsAvailable);
+    (void)pthread_mutex_unlock(&pt_Pool->t_Lock);
+
+    for (u32_I = 0; u32_I < pt_Pool->u32_ThreadCount; u32_I++)
+    {
+        (void)pthread_join(pt_Pool->rt_Threads[u32_I], NULL);
+    }
+
+    (void)pthread_cond_destroy(&pt_Pool->t_JobsDone);
+    (void)pthread_cond_destroy(&pt_Pool->t_JobsAvailable);
+    (void)pthread_mutex_destroy(&pt_Pool->t_Lock);
+}
+
+/**
+ * @brief Compare a Stamp against a batch of Stamps with a number of threads
+ *
+ * @param pt_Stamp The Stamp to compare against
+ * @param ppt_OtherStamps The batch of Stamps
+ * @param pt_Results (out) The results of the comparisons
+ * @param u32_ThreadCount The number of threads
+ * @param u32_Iterations The number of times to compare the batch
+ * @return `uint64_t` The average time per batch in nanoseconds
+ */
+static uint64_t benchmarkCompareMany(
+    const ITC_Stamp_t *pt_Stamp,
+    const ITC_Stamp_t *const *ppt_OtherStamps,
+    ITC_Stamp_Comparison_t *pt_Results,
+    uint32_t u32_ThreadCount,
+    uint32_t u32_Iterations
+)
+{
+    static ThreadPool_t t_Pool;
+    ITC_Stamp_Executor_t t_Executor;
+    uint64_t u64_Start;
+    uint64_t u64_Elapsed;
+    uint32_t u32_I;
+
+    startThreadPool(&t_Pool, u32_ThreadCount);
+
+    t_Executor.pf_Run = runJobs;
+    t_Executor.pv_UserData = (void *)&t_Pool;
+    t_Executor.u32_MaxJobs = u32_ThreadCount;
+
+    /* Warm up the caches and the worker threads */
+    BENCH_SUCCESS(
+        ITC_Stamp_compareMany(
+            pt_Stamp, ppt_OtherStamps, BATCH_SIZE, pt_Results, &t_Executor));
+
+    u64_Start = ITC_BenchUtil_nowNs();
+
+    for (u32_I = 0; u32_I < u32_Iterations; u32_I++)
+    {
+        BENCH_SUCCESS(
+            ITC_Stamp_compareMany(
+                pt_Stamp,
+                ppt_OtherStamps,
+                BATCH_SIZE,
+                pt_Results,
+                &t_Executor));
+    }
+
+    u64_Elapsed = ITC_BenchUtil_nowNs() - u64_Start;
+
+    stopThreadPool(&t_Pool);
+
+    return u64_Elapsed / u32_Iterations;
+}
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/**
+ * @brief Benchmark entrypoint
+ *
+ * @param argc The number of arguments
+ * @param argv The arguments. `argv[1]` optionally sets the number of
+ * iterations
+ * @return `int` The exit status
+ */
+int main(int argc, char *argv[])
+{
+    const ITC_BenchUtil_Shape_t rt_Shapes[] =
+    {
+        ITC_BENCHUTIL_SHAPE_BALANCED,
+        ITC_BENCHUTIL_SHAPE_COMB,
+    };
+    static ITC_Stamp_t *rpt_OtherStamps[BATCH_SIZE];
+    static ITC_Stamp_Comparison_t rt_Results[BATCH_SIZE];
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    uint32_t u32_Iterations = DEFAULT_ITERATIONS;
+    uint32_t u32_MaxThreads;
+    uint64_t u64_SingleThreadNs;
+    uint64_t u64_BatchNs;
+    long l_Cpus;
+    uint32_t u32_Shape;
+    uint32_t u32_Threads;
+    uint32_t u32_I;
+
+    if (argc > 1)
+    {
+        u32_Iterations = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+
+    if (u32_Iterations == 0)
+    {
+        fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    l_Cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    u32_MaxThreads = (l_Cpus < 1) ? 1U
+                   : (l_Cpus > MAX_THREADS) ? MAX_THREADS
+                   : (uint32_t)l_Cpus;
+
+    BENCH_SUCCESS(ITC_Port_init());
+
+    printf(
+        "# batch size: %u, depth: %u, iterations: %u, cpus: %u\n",
+        BATCH_SIZE,
+        TREE_DEPTH,
+        u32_Iterations,
+        u32_MaxThreads);
+    printf(
+        "%-9s %7s %14s %12s %8s\n",
+        "shape",
+        "threads",
+        "ns/batch",
+        "ns/compare",
+        "speedup");
+
+    for (u32_Shape = 0; u32_Shape < ARRAY_COUNT(rt_Shapes); u32_Shape++)
+    {
+        BENCH_SUCCESS(
+            ITC_BenchUtil_newStamp(
+                &pt_Stamp, rt_Shapes[u32_Shape], TREE_DEPTH, false));
+        BENCH_SUCCESS(
+            ITC_BenchUtil_newStamp(
+                &pt_OtherStamp, rt_Shapes[u32_Shape], TREE_DEPTH, true));
+
+        /* Every Stamp is a separate copy, so the threads do not share the
+         * trees they read */
+        for (u32_I = 0; u32_I < BATCH_SIZE; u32_I++)
+        {
+            BENCH_SUCCESS(ITC_Stamp_clone(pt_OtherStamp, &rpt_OtherStamps[u32_I]));
+        }
+
+        u64_SingleThreadNs = 0;
+
+        for (u32_Threads = 1; u32_Threads <= u32_MaxThreads; u32_Threads *= 2)
+        {
+            u64_BatchNs = benchmarkCompareMany(
+                pt_Stamp,
+                (const ITC_Stamp_t *const *)&rpt_OtherStamps[0],
+                &rt_Results[0],
+                u32_Threads,
+                u32_Iterations);
+
+            if (u32_Threads == 1)
+            {
+                u64_SingleThreadNs = u64_BatchNs;
+            }
+
+            printf(
+                "%-9s %7u %14.1f %12.1f %8.2f\n",
+                ITC_BenchUtil_shapeName(rt_Shapes[u32_Shape]),
+                u32_Threads,
+                (double)u64_BatchNs,
+                (double)u64_BatchNs / BATCH_SIZE,
+                (u64_BatchNs > 0) ?
+                    (double)u64_SingleThreadNs / (double)u64_BatchNs :
+                    0.0);
+        }
+
+        for (u32_I = 0; u32_I < BATCH_SIZE; u32_I++)
+        {
+            BENCH_SUCCESS(ITC_Stamp_destroy(&rpt_OtherStamps[u32_I]));
+        }
+
+        BENCH_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+        BENCH_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    }
+
+    BENCH_SUCCESS(ITC_Port_fini());
+
+    return EXIT_SUCCESS;
+}
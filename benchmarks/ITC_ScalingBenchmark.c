@@ -0,0 +1,486 @@
+/**
+ * @file ITC_ScalingBenchmark.c
+ * @brief Scenario benchmark simulating a dynamic population of replicas
+ *
+ * Simulates populations of 10 up to `max replicas` replicas, each holding a
+ * Stamp. At every step, a random replica either adds an event, sends a
+ * message to another random replica (serialising a peek Stamp, which the
+ * receiver deserialises and joins), or churns: a new replica is forked off
+ * it, or it retires by joining its Stamp into another replica. Churn keeps
+ * the population close to its target size.
+ *
+ * The simulation of each population is split into epochs. After every epoch,
+ * the benchmark reports the throughput, the average ID and Event tree size
+ * per replica, the average number of serialised bytes per message and the
+ * peak number of live nodes of each allocation type during the epoch, which
+ * shows how the cost of the operations evolves as the trees age.
+ *
+ * Usage: `ITC_ScalingBenchmark [max replicas] [steps per replica]`
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_BenchUtil.h"
+
+#include "ITC_Stamp.h"
+#include "ITC_SerDes.h"
+#include "ITC_Port.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if !ITC_CONFIG_ENABLE_STATS
+#error "The scaling benchmark requires ITC_CONFIG_ENABLE_STATS"
+#endif /* !ITC_CONFIG_ENABLE_STATS */
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/** The default largest number of replicas to simulate */
+#define DEFAULT_MAX_REPLICAS                                            (100000)
+
+/** The default number of steps to simulate per replica */
+#define DEFAULT_STEPS_PER_REPLICA                                            (4)
+
+/** The smallest number of replicas to simulate */
+#define MIN_REPLICAS                                                        (10)
+
+/** The number of epochs the simulation of each population is split into */
+#define EPOCH_COUNT                                                          (5)
+
+/** The size of the serialisation buffer */
+#define SERIALISATION_BUFFER_SIZE                                  (1024 * 1024)
+
+/** The chance (out of 100) of a step adding an event */
+#define EVENT_CHANCE                                                        (50)
+
+/** The chance (out of 100) of a step sending a message */
+#define MESSAGE_CHANCE                                                      (35)
+
+/* The remaining steps churn the population */
+
+/******************************************************************************
+ *  Types
+ ******************************************************************************/
+
+/**
+ * @brief The state of a simulated population of replicas
+ */
+typedef struct
+{
+    /** The Stamps of the replicas. Only the first `u32_Count` are valid */
+    ITC_Stamp_t **ppt_Replicas;
+    /** The number of live replicas */
+    uint32_t u32_Count;
+    /** The number of replicas the population is kept close to */
+    uint32_t u32_Target;
+    /** The number of replicas `ppt_Replicas` has room for */
+    uint32_t u32_Capacity;
+    /** The state of the pseudo-random number generator */
+    uint64_t u64_Rng;
+} Population_t;
+
+/**
+ * @brief The counters of a single epoch
+ */
+typedef struct
+{
+    /** The number of steps simulated */
+    uint64_t u64_Steps;
+    /** The number of messages sent */
+    uint64_t u64_Messages;
+    /** The total number of serialised bytes sent */
+    uint64_t u64_MessageBytes;
+    /** The number of replicas forked */
+    uint64_t u64_Forks;
+    /** The number of replicas retired */
+    uint64_t u64_Retires;
+    /** The time spent simulating the steps, in nanoseconds */
+    uint64_t u64_ElapsedNs;
+} Epoch_t;
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Get a pseudo-random number in `[0, u32_Bound)`
+ *
+ * @param pt_Population The population holding the state of the generator
+ * @param u32_Bound The exclusive upper bound. Must be `> 0`
+ * @return `uint32_t` The number
+ */
+static uint32_t nextRandom(
+    Population_t *pt_Population,
+    uint32_t u32_Bound
+)
+{
+    /* xorshift64*. The modulo bias is negligible for the bounds used here */
+    pt_Population->u64_Rng ^= pt_Population->u64_Rng >> 12U;
+    pt_Population->u64_Rng ^= pt_Population->u64_Rng << 25U;
+    pt_Population->u64_Rng ^= pt_Population->u64_Rng >> 27U;
+
+    return (uint32_t)(
+        ((pt_Population->u64_Rng * 2685821657736338717ULL) >> 32U) %
+        u32_Bound);
+}
+
+/**
+ * @brief Pick a random replica other than the given one
+ *
+ * @param pt_Population The population. Must have at least 2 replicas
+ * @param u32_Replica The replica to exclude
+ * @return `uint32_t` The other replica
+ */
+static uint32_t pickOtherReplica(
+    Population_t *pt_Population,
+    uint32_t u32_Replica
+)
+{
+    uint32_t u32_Other =
+        nextRandom(pt_Population, pt_Population->u32_Count - 1);
+
+    return (u32_Other >= u32_Replica) ? u32_Other + 1 : u32_Other;
+}
+
+/**
+ * @brief Fork a new replica off an existing one
+ *
+ * @param pt_Population The population. Must have room for another replica
+ * @param u32_Replica The replica to fork
+ */
+static void forkReplica(
+    Population_t *pt_Population,
+    uint32_t u32_Replica
+)
+{
+    BENCH_SUCCESS(
+        ITC_Stamp_fork(
+            &pt_Population->ppt_Replicas[u32_Replica],
+            &pt_Population->ppt_Replicas[pt_Population->u32_Count]));
+
+    pt_Population->u32_Count++;
+}
+
+/**
+ * @brief Retire a replica by joining its Stamp into another replica
+ *
+ * The last replica takes the place of the retired one.
+ *
+ * @param pt_Population The population. Must have at least 2 replicas
+ * @param u32_Replica The replica to retire
+ */
+static void retireReplica(
+    Population_t *pt_Population,
+    uint32_t u32_Replica
+)
+{
+    uint32_t u32_Other = pickOtherReplica(pt_Population, u32_Replica);
+
+    BENCH_SUCCESS(
+        ITC_Stamp_join(
+            &pt_Population->ppt_Replicas[u32_Other],
+            &pt_Population->ppt_Replicas[u32_Replica]));
+
+    pt_Population->u32_Count--;
+    pt_Population->ppt_Replicas[u32_Replica] =
+        pt_Population->ppt_Replicas[pt_Population->u32_Count];
+    pt_Population->ppt_Replicas[pt_Population->u32_Count] = NULL;
+}
+
+/**
+ * @brief Send a message from a replica to another random replica
+ *
+ * The message carries a serialised peek Stamp of the sender, which the
+ * receiver deserialises and joins into its own Stamp.
+ *
+ * @param pt_Population The population. Must have at least 2 replicas
+ * @param u32_Replica The sending replica
+ * @param pu8_Buffer The serialisation buffer
+ * @return `uint32_t` The size of the serialised message
+ */
+static uint32_t sendMessage(
+    Population_t *pt_Population,
+    uint32_t u32_Replica,
+    uint8_t *pu8_Buffer
+)
+{
+    uint32_t u32_Receiver = pickOtherReplica(pt_Population, u32_Replica);
+    uint32_t u32_BufferSize = SERIALISATION_BUFFER_SIZE;
+    ITC_Stamp_t *pt_PeekStamp;
+
+    BENCH_SUCCESS(
+        ITC_Stamp_newPeek(
+            pt_Population->ppt_Replicas[u32_Replica], &pt_PeekStamp));
+    BENCH_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_PeekStamp, pu8_Buffer, &u32_BufferSize));
+    BENCH_SUCCESS(ITC_Stamp_destroy(&pt_PeekStamp));
+
+    BENCH_SUCCESS(
+        ITC_SerDes_deserialiseStamp(pu8_Buffer, u32_BufferSize, &pt_PeekStamp));
+    BENCH_SUCCESS(
+        ITC_Stamp_join(
+            &pt_Population->ppt_Replicas[u32_Receiver], &pt_PeekStamp));
+
+    return u32_BufferSize;
+}
+
+/**
+ * @brief Simulate a single step of a random replica
+ *
+ * @param pt_Population The population
+ * @param pt_Epoch The counters of the current epoch
+ * @param pu8_Buffer The serialisation buffer
+ */
+static void simulateStep(
+    Population_t *pt_Population,
+    Epoch_t *pt_Epoch,
+    uint8_t *pu8_Buffer
+)
+{
+    uint32_t u32_Replica = nextRandom(pt_Population, pt_Population->u32_Count);
+    uint32_t u32_Action = nextRandom(pt_Population, 100);
+    bool b_Fork;
+
+    if (u32_Action < EVENT_CHANCE || pt_Population->u32_Count < 2)
+    {
+        BENCH_SUCCESS(
+            ITC_Stamp_event(pt_Population->ppt_Replicas[u32_Replica]));
+    }
+    else if (u32_Action < EVENT_CHANCE + MESSAGE_CHANCE)
+    {
+        pt_Epoch->u64_MessageBytes +=
+            sendMessage(pt_Population, u32_Replica, pu8_Buffer);
+        pt_Epoch->u64_Messages++;
+    }
+    else
+    {
+        /* Drift back towards the target size, and flip a coin when on it */
+        if (pt_Population->u32_Count != pt_Population->u32_Target)
+        {
+            b_Fork = pt_Population->u32_Count < pt_Population->u32_Target;
+        }
+        else
+        {
+            b_Fork = nextRandom(pt_Population, 2) == 0;
+        }
+
+        if (b_Fork)
+        {
+            forkReplica(pt_Population, u32_Replica);
+            pt_Epoch->u64_Forks++;
+        }
+        else
+        {
+            retireReplica(pt_Population, u32_Replica);
+            pt_Epoch->u64_Retires++;
+        }
+    }
+
+    pt_Epoch->u64_Steps++;
+}
+
+/**
+ * @brief Print the results of an epoch
+ *
+ * @param pt_Population The population
+ * @param pt_Epoch The counters of the epoch
+ * @param u32_EpochNum The number of the epoch
+ */
+static void printEpoch(
+    const Population_t *pt_Population,
+    const Epoch_t *pt_Epoch,
+    uint32_t u32_EpochNum
+)
+{
+    ITC_Port_Stats_t t_Stats;
+
+    BENCH_SUCCESS(ITC_Port_getStats(&t_Stats));
+
+    /* Only the replicas are alive in between steps, so the live nodes are
+     * exactly the nodes of their trees */
+    printf(
+        "%8u %5u %8u %12.0f %9.1f %10.1f %9.1f %10u %10u %8u\n",
+        pt_Population->u32_Target,
+        u32_EpochNum,
+        pt_Population->u32_Count,
+        (pt_Epoch->u64_ElapsedNs > 0) ?
+            (double)pt_Epoch->u64_Steps * 1e9 /
+                (double)pt_Epoch->u64_ElapsedNs :
+            0.0,
+        (double)t_Stats.t_Id.u32_Live / pt_Population->u32_Count,
+        (double)t_Stats.t_Event.u32_Live / pt_Population->u32_Count,
+        (pt_Epoch->u64_Messages > 0) ?
+            (double)pt_Epoch->u64_MessageBytes /
+                (double)pt_Epoch->u64_Messages :
+            0.0,
+        t_Stats.t_Id.u32_Peak,
+        t_Stats.t_Event.u32_Peak,
+        t_Stats.t_Stamp.u32_Peak);
+}
+
+/**
+ * @brief Simulate a population of replicas
+ *
+ * @param u32_Target The number of replicas to keep the population close to
+ * @param u32_StepsPerReplica The number of steps to simulate per replica
+ * @param pu8_Buffer The serialisation buffer
+ */
+static void simulatePopulation(
+    uint32_t u32_Target,
+    uint32_t u32_StepsPerReplica,
+    uint8_t *pu8_Buffer
+)
+{
+    Population_t t_Population;
+    Epoch_t t_Epoch;
+    uint64_t u64_EpochSteps;
+    uint64_t u64_Start;
+    uint64_t u64_I;
+    uint32_t u32_EpochNum;
+    uint32_t u32_I;
+
+    /* Churn never takes the population more than one replica above its
+     * target */
+    t_Population.u32_Target = u32_Target;
+    t_Population.u32_Capacity = u32_Target + 1;
+    t_Population.u32_Count = 0;
+    t_Population.u64_Rng = 0x9E3779B97F4A7C15ULL ^ u32_Target;
+    t_Population.ppt_Replicas = (ITC_Stamp_t **)calloc(
+        t_Population.u32_Capacity, sizeof(ITC_Stamp_t *));
+
+    if (!t_Population.ppt_Replicas)
+    {
+        fprintf(stderr, "failed to allocate %u replicas\n", u32_Target);
+        exit(EXIT_FAILURE);
+    }
+
+    /* Grow the population from a single seed, forking random replicas.
+     * This is epoch 0 */
+    BENCH_SUCCESS(ITC_Stamp_newSeed(&t_Population.ppt_Replicas[0]));
+    t_Population.u32_Count = 1;
+    BENCH_SUCCESS(ITC_Port_resetStats());
+    t_Epoch = (Epoch_t){ 0 };
+
+    u64_Start = ITC_BenchUtil_nowNs();
+
+    while (t_Population.u32_Count < u32_Target)
+    {
+        forkReplica(
+            &t_Population,
+            nextRandom(&t_Population, t_Population.u32_Count));
+        t_Epoch.u64_Forks++;
+        t_Epoch.u64_Steps++;
+    }
+
+    t_Epoch.u64_ElapsedNs = ITC_BenchUtil_nowNs() - u64_Start;
+    printEpoch(&t_Population, &t_Epoch, 0);
+
+    u64_EpochSteps =
+        ((uint64_t)u32_Target * u32_StepsPerReplica + EPOCH_COUNT - 1) /
+        EPOCH_COUNT;
+
+    for (u32_EpochNum = 1; u32_EpochNum <= EPOCH_COUNT; u32_EpochNum++)
+    {
+        BENCH_SUCCESS(ITC_Port_resetStats());
+        t_Epoch = (Epoch_t){ 0 };
+
+        u64_Start = ITC_BenchUtil_nowNs();
+
+        for (u64_I = 0; u64_I < u64_EpochSteps; u64_I++)
+        {
+            simulateStep(&t_Population, &t_Epoch, pu8_Buffer);
+        }
+
+        t_Epoch.u64_ElapsedNs = ITC_BenchUtil_nowNs() - u64_Start;
+        printEpoch(&t_Population, &t_Epoch, u32_EpochNum);
+    }
+
+    for (u32_I = 0; u32_I < t_Population.u32_Count; u32_I++)
+    {
+        BENCH_SUCCESS(ITC_Stamp_destroy(&t_Population.ppt_Replicas[u32_I]));
+    }
+
+    free(t_Population.ppt_Replicas);
+}
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/**
+ * @brief Benchmark entrypoint
+ *
+ * @param argc The number of arguments
+ * @param argv The arguments. `argv[1]` optionally sets the largest number of
+ * replicas, `argv[2]` the number of steps per replica
+ * @return `int` The exit status
+ */
+int main(int argc, char *argv[])
+{
+    static uint8_t ru8_Buffer[SERIALISATION_BUFFER_SIZE];
+    uint32_t u32_MaxReplicas = DEFAULT_MAX_REPLICAS;
+    uint32_t u32_StepsPerReplica = DEFAULT_STEPS_PER_REPLICA;
+    uint32_t u32_Target;
+
+    if (argc > 1)
+    {
+        u32_MaxReplicas = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+
+    if (argc > 2)
+    {
+        u32_StepsPerReplica = (uint32_t)strtoul(argv[2], NULL, 10);
+    }
+
+    if (u32_MaxReplicas < MIN_REPLICAS || u32_StepsPerReplica == 0)
+    {
+        fprintf(
+            stderr,
+            "usage: %s [max replicas >= %u] [steps per replica]\n",
+            argv[0],
+            MIN_REPLICAS);
+        return EXIT_FAILURE;
+    }
+
+    BENCH_SUCCESS(ITC_Port_init());
+
+    printf(
+        "# max replicas: %u, steps per replica: %u, epochs: %u, "
+        "event/message/churn chance: %u/%u/%u%%\n",
+        u32_MaxReplicas,
+        u32_StepsPerReplica,
+        EPOCH_COUNT,
+        EVENT_CHANCE,
+        MESSAGE_CHANCE,
+        100 - EVENT_CHANCE - MESSAGE_CHANCE);
+    printf(
+        "%8s %5s %8s %12s %9s %10s %9s %10s %10s %8s\n",
+        "target",
+        "epoch",
+        "replicas",
+        "steps/s",
+        "id nodes",
+        "evt nodes",
+        "msg bytes",
+        "peak id",
+        "peak evt",
+        "peak stp");
+
+    /* Grow the target tenfold until the next one would exceed the limit */
+    for (u32_Target = MIN_REPLICAS;
+         u32_Target != 0;
+         u32_Target = (u32_Target <= u32_MaxReplicas / 10) ?
+             u32_Target * 10 :
+             0)
+    {
+        simulatePopulation(u32_Target, u32_StepsPerReplica, &ru8_Buffer[0]);
+    }
+
+    BENCH_SUCCESS(ITC_Port_fini());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,261 @@
+/**
+ * @file ITC_BenchUtil.h
+ * @brief Benchmarking utilities
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_BENCHUTIL_H_
+#define ITC_BENCHUTIL_H_
+
+#include "ITC_Id.h"
+#include "ITC_Event.h"
+#include "ITC_Stamp.h"
+#include "ITC_Port.h"
+#include "ITC_Status.h"
+#include "ITC_Config.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/**
+ * @brief Abort the benchmark if an operation did not succeed
+ *
+ * @param t_Status The status of the operation
+ */
+#define BENCH_SUCCESS(t_Status)                                                \
+    ITC_BenchUtil_checkSuccess((t_Status), #t_Status, __FILE__, __LINE__)
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/** The number of buckets in each trace histogram. Bucket `0` counts the
+ * values equal to `0`, and bucket `n` the values in `[2^(n - 1), 2^n)` */
+#define ITC_BENCHUTIL_TRACE_BUCKET_COUNT                                    (33)
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+/******************************************************************************
+ *  Types
+ ******************************************************************************/
+
+/**
+ * @brief The shape of the generated ID and Event trees
+ */
+typedef enum
+{
+    /** A perfectly balanced tree, where every leaf is at the same depth */
+    ITC_BENCHUTIL_SHAPE_BALANCED,
+    /** A comb, where every left child is a leaf and the tree only grows
+     * through the right children */
+    ITC_BENCHUTIL_SHAPE_COMB,
+} ITC_BenchUtil_Shape_t;
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/**
+ * @brief The aggregated traces of a single `ITC_Port_TracePhase_t`
+ */
+typedef struct
+{
+    /** The number of times the phase ended */
+    uint64_t u64_Calls;
+    /** The total time spent in the phase, in nanoseconds */
+    uint64_t u64_TotalNs;
+    /** The total size of the trees the phase resulted in */
+    uint64_t u64_TotalTreeSize;
+    /** When the current call of the phase began, in nanoseconds */
+    uint64_t u64_BeginNs;
+    /** The log2 histogram of the time spent in each call, in nanoseconds */
+    uint64_t ru64_LatencyHistogram[ITC_BENCHUTIL_TRACE_BUCKET_COUNT];
+    /** The log2 histogram of the tree sizes the calls resulted in */
+    uint64_t ru64_TreeSizeHistogram[ITC_BENCHUTIL_TRACE_BUCKET_COUNT];
+} ITC_BenchUtil_PhaseTrace_t;
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+/******************************************************************************
+ *  Global variables
+ ******************************************************************************/
+
+/**
+ * @brief The number of successful `ITC_Port_malloc` calls so far
+ */
+extern uint32_t gu32_BenchAllocationCount;
+
+/******************************************************************************
+ *  Functions
+ ******************************************************************************/
+
+/**
+ * @brief Abort the benchmark with an error message if an operation did not
+ * succeed
+ *
+ * @param t_Status The status of the operation
+ * @param pc_Expression The expression returning the status
+ * @param pc_File The file the expression is located in
+ * @param u32_Line The line the expression is located on
+ */
+void ITC_BenchUtil_checkSuccess(
+    ITC_Status_t t_Status,
+    const char *pc_Expression,
+    const char *pc_File,
+    uint32_t u32_Line
+);
+
+/**
+ * @brief Get the value of a monotonic clock
+ *
+ * @return `uint64_t` The value of the clock in nanoseconds
+ */
+uint64_t ITC_BenchUtil_nowNs(void);
+
+/**
+ * @brief Get the name of the shape of a tree
+ *
+ * @param t_Shape The shape
+ * @return `const char *` The name of the shape
+ */
+const char *ITC_BenchUtil_shapeName(
+    ITC_BenchUtil_Shape_t t_Shape
+);
+
+/**
+ * @brief Allocate a new normalised ID tree of a given shape
+ *
+ * The leaves of the tree alternate between owning and not owning their
+ * interval, which prevents the tree from collapsing. The inverted ID owns
+ * exactly the intervals the non-inverted one does not, so the two can be
+ * summed (or their Stamps joined).
+ *
+ * @param ppt_Id (out) The pointer to the ID
+ * @param t_Shape The shape of the tree
+ * @param u32_Depth The depth of the tree. `0` creates a single (seed or null)
+ * leaf
+ * @param b_Invert Whether to invert the ownership of all leaves
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_BenchUtil_newId(
+    ITC_Id_t **ppt_Id,
+    ITC_BenchUtil_Shape_t t_Shape,
+    uint32_t u32_Depth,
+    bool b_Invert
+);
+
+/**
+ * @brief Allocate a new normalised Event tree of a given shape
+ *
+ * The event counters of the tree are pseudo-random, but deterministic for a
+ * given seed. Events created with different seeds are (very likely)
+ * concurrent. Subtrees which collapse when normalised are replaced with
+ * leaves, so the tree may be shallower than `u32_Depth`.
+ *
+ * @param ppt_Event (out) The pointer to the Event
+ * @param t_Shape The shape of the tree
+ * @param u32_Depth The depth of the tree. `0` creates a single leaf
+ * @param u32_Seed The seed for the event counters
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_BenchUtil_newEvent(
+    ITC_Event_t **ppt_Event,
+    ITC_BenchUtil_Shape_t t_Shape,
+    uint32_t u32_Depth,
+    uint32_t u32_Seed
+);
+
+/**
+ * @brief Allocate a new Stamp with an ID and an Event tree of a given shape
+ *
+ * See ::ITC_BenchUtil_newId() and ::ITC_BenchUtil_newEvent()
+ *
+ * @param ppt_Stamp (out) The pointer to the Stamp
+ * @param t_Shape The shape of the trees
+ * @param u32_Depth The depth of the trees
+ * @param b_Invert Whether to invert the ownership of the ID leaves. Also used
+ * to seed the event counters
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_BenchUtil_newStamp(
+    ITC_Stamp_t **ppt_Stamp,
+    ITC_BenchUtil_Shape_t t_Shape,
+    uint32_t u32_Depth,
+    bool b_Invert
+);
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/**
+ * @brief Clear the aggregated traces of all phases
+ */
+void ITC_BenchUtil_resetTraces(void);
+
+/**
+ * @brief Start aggregating the traces of the libitc phases
+ *
+ * Registers tracing hooks which time every phase and record the size of the
+ * tree it resulted in.
+ */
+void ITC_BenchUtil_startTracing(void);
+
+/**
+ * @brief Stop aggregating the traces of the libitc phases
+ *
+ * Unregisters the tracing hooks. The aggregated traces are kept.
+ */
+void ITC_BenchUtil_stopTracing(void);
+
+/**
+ * @brief Get the aggregated traces of a phase
+ *
+ * @param t_Phase The phase
+ * @return `const ITC_BenchUtil_PhaseTrace_t *` The aggregated traces
+ */
+const ITC_BenchUtil_PhaseTrace_t *ITC_BenchUtil_getPhaseTrace(
+    ITC_Port_TracePhase_t t_Phase
+);
+
+/**
+ * @brief Print the latency histograms and tree size distributions of all
+ * traced phases to `stdout`
+ */
+void ITC_BenchUtil_printTraces(void);
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+/**
+ * @brief Wraps `ITC_Port_malloc` to count the allocations
+ *
+ * Enabled with the `-Wl,--wrap=ITC_Port_malloc` linker flag.
+ *
+ * @param ppv_Ptr (out) Pointer to the allocated memory
+ * @param t_AllocType The type of data being allocated
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t __wrap_ITC_Port_malloc(
+    void **ppv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+);
+
+/**
+ * @brief The original `ITC_Port_malloc`. Provided by the linker
+ *
+ * @param ppv_Ptr (out) Pointer to the allocated memory
+ * @param t_AllocType The type of data being allocated
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t __real_ITC_Port_malloc(
+    void **ppv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+);
+
+#endif /* ITC_BENCHUTIL_H_ */
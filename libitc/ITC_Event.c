@@ -26,10 +26,45 @@
 #include "ITC_Id_package.h"
 #include "ITC_Id_private.h"
 #include "ITC_Port.h"
+#include "ITC_Port_package.h"
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+#include "ITC_Packed.h"
+#include "ITC_Packed_package.h"
+#include "ITC_Packed_private.h"
+
+#include <string.h>
+
+#if ITC_PACKED_EVENT_USE_AVX2 || ITC_PACKED_EVENT_USE_SSE2
+#include <immintrin.h>
+#endif /* ITC_PACKED_EVENT_USE_AVX2 || ITC_PACKED_EVENT_USE_SSE2 */
+
+#if ITC_PACKED_EVENT_USE_NEON
+#include <arm_neon.h>
+#endif /* ITC_PACKED_EVENT_USE_NEON */
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
 
 #include <stdbool.h>
 #include <stddef.h>
 
+#if ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+/* The explicit stack of the Event `leq` traversals */
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+static __thread ITC_Event_TraversalFrame_t
+    gt_ItcEventTraversalStack[ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH];
+#else
+static ITC_Event_TraversalFrame_t
+    gt_ItcEventTraversalStack[ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH];
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#endif /* ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH */
+
 /******************************************************************************
  * Private functions
  ******************************************************************************/
@@ -69,13 +104,18 @@ static ITC_Status_t validateEvent(
         /* Checks:
          *  - The parent pointer must match pt_CurrentEventParent.
          *  - Must be a leaf or a valid parent node
-         *  - Must be a normalised Event node (if the check is enabled)
+         *  - Must be a normalised Event node (if the check is enabled).
+         *    Nodes marked as dirty by a lazy join are exempt, but their
+         *    parents must be marked as dirty too
          */
         if (pt_CurrentEventParent != pt_Event->pt_Parent ||
             (!ITC_EVENT_IS_LEAF_EVENT(pt_Event) &&
              !ITC_EVENT_IS_VALID_PARENT(pt_Event)) ||
             (b_CheckIsNormalised &&
-             !ITC_EVENT_IS_NORMALISED_EVENT(pt_Event)))
+             !ITC_EVENT_IS_DIRTY_EVENT(pt_Event) &&
+             (!ITC_EVENT_IS_NORMALISED_EVENT(pt_Event) ||
+              ITC_EVENT_IS_DIRTY_EVENT(pt_Event->pt_Left) ||
+              ITC_EVENT_IS_DIRTY_EVENT(pt_Event->pt_Right))))
         {
             t_Status = ITC_STATUS_CORRUPT_EVENT;
         }
@@ -132,20 +172,21 @@ static ITC_Status_t validateEvent(
  * @param ppt_Parent The pointer to the parent Event in the tree.
  * Otherwise NULL.
  * @param t_Count The number of events witnessed by the Event
+ * @param t_AllocType The type of memory to allocate the Event from
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
 static ITC_Status_t newEvent(
     ITC_Event_t **const ppt_Event,
     ITC_Event_t *const pt_Parent,
-    const ITC_Event_Counter_t t_Count
+    const ITC_Event_Counter_t t_Count,
+    const ITC_Port_AllocType_t t_AllocType
 )
 {
     ITC_Status_t t_Status; /* The current status */
     ITC_Event_t *pt_Alloc;
 
-    t_Status = ITC_Port_malloc(
-        (void **)&pt_Alloc, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+    t_Status = ITC_PORT_MALLOC((void **)&pt_Alloc, t_AllocType);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
@@ -154,6 +195,16 @@ static ITC_Status_t newEvent(
         pt_Alloc->pt_Parent = pt_Parent;
         pt_Alloc->pt_Left = NULL;
         pt_Alloc->pt_Right = NULL;
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+        pt_Alloc->u32_ShareCount = 0;
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+        pt_Alloc->b_IsDirty = false;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+        /* Children attached later must set this explicitly */
+        pt_Alloc->t_ChildrenMax = ITC_EVENT_UNKNOWN_CHILDREN_MAX;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
 
         /* Return the pointer to the allocated memory */
         *ppt_Event = pt_Alloc;
@@ -167,6 +218,138 @@ static ITC_Status_t newEvent(
     return t_Status;
 }
 
+/**
+ * @brief Deallocate an ITC Event
+ *
+ * @param ppt_Event The pointer to the Event to deallocate
+ * @param t_AllocType The type of memory the Event was allocated from
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t destroyEvent(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+    ITC_Event_t *pt_CurrentEvent = NULL; /* The current element */
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    ITC_Event_t *pt_RootEventParent = NULL;
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    else if (t_AllocType == ITC_PORT_ALLOCTYPE_SCRATCH)
+    {
+        /* Scratch nodes are released all at once by `ITC_Port_arenaReset`.
+         * There is no need to walk the tree */
+    }
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+    else if (*ppt_Event)
+    {
+        pt_CurrentEvent = *ppt_Event;
+        /* Remember the parent as this might be a subtree */
+        pt_RootEventParent = pt_CurrentEvent->pt_Parent;
+
+        /* Keep trying to free elements even if some frees fail */
+        while(pt_CurrentEvent && pt_CurrentEvent != pt_RootEventParent)
+        {
+            /* Advance into left subtree */
+            if(pt_CurrentEvent->pt_Left)
+            {
+                pt_CurrentEvent = pt_CurrentEvent->pt_Left;
+            }
+            /* Advance into right subtree */
+            else if(pt_CurrentEvent->pt_Right)
+            {
+                pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+            }
+            else
+            {
+                /* Remember the parent element */
+                pt_CurrentEventParent = pt_CurrentEvent->pt_Parent;
+
+                if(pt_CurrentEventParent)
+                {
+                    /* Remove the current element address from the parent */
+                    if(pt_CurrentEventParent->pt_Left == pt_CurrentEvent)
+                    {
+                        pt_CurrentEventParent->pt_Left = NULL;
+                    }
+                    else
+                    {
+                        pt_CurrentEventParent->pt_Right = NULL;
+                    }
+                }
+
+                /* Free the current element */
+                t_FreeStatus = ITC_PORT_FREE(pt_CurrentEvent, t_AllocType);
+
+                /* Return last error */
+                if (t_FreeStatus != ITC_STATUS_SUCCESS)
+                {
+                    t_Status = t_FreeStatus;
+                }
+
+                /* Go up the tree */
+                pt_CurrentEvent = pt_CurrentEventParent;
+            }
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Sanitize the freed pointer regardless of the exit status */
+        *ppt_Event = NULL;
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+
+/**
+ * @brief Release a shared reference to an Event tree
+ *
+ * @param pt_Event The root of the Event tree
+ * @return `bool` `true` if one of the shared references was released and the
+ * Event tree must be kept. `false` if this was the last reference and the
+ * Event tree must be deallocated
+ */
+static bool releaseSharedEvent(
+    ITC_Event_t *const pt_Event
+)
+{
+    uint32_t u32_ShareCount;
+    bool b_Released = false;
+
+    u32_ShareCount = __atomic_load_n(
+        &pt_Event->u32_ShareCount, __ATOMIC_ACQUIRE);
+
+    while (u32_ShareCount > 0 && !b_Released)
+    {
+        /* On failure `u32_ShareCount` is updated with the current value */
+        b_Released = __atomic_compare_exchange_n(
+            &pt_Event->u32_ShareCount,
+            &u32_ShareCount,
+            u32_ShareCount - 1,
+            false,
+            __ATOMIC_ACQ_REL,
+            __ATOMIC_ACQUIRE);
+    }
+
+    return b_Released;
+}
+
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+
 /**
  * @brief Clone an existing ITC Event
  *
@@ -175,13 +358,15 @@ static ITC_Status_t newEvent(
  * @param pt_Event The existing Event
  * @param ppt_ClonedEvent The pointer to the cloned Event
  * @param pt_ParentEvent The pointer to parent Event. Otherwise NULL
+ * @param t_AllocType The type of memory to allocate the cloned Event from
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
 static ITC_Status_t cloneEvent(
     const ITC_Event_t *pt_Event,
     ITC_Event_t **const ppt_ClonedEvent,
-    ITC_Event_t *const pt_ParentEvent
+    ITC_Event_t *const pt_ParentEvent,
+    const ITC_Port_AllocType_t t_AllocType
 )
 {
     ITC_Status_t t_Status; /* The current status */
@@ -195,7 +380,7 @@ static ITC_Status_t cloneEvent(
 
     /* Allocate the root */
     t_Status = newEvent(
-        ppt_ClonedEvent, pt_ParentEvent, pt_Event->t_Count);
+        ppt_ClonedEvent, pt_ParentEvent, pt_Event->t_Count, t_AllocType);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
@@ -212,7 +397,8 @@ static ITC_Status_t cloneEvent(
             t_Status = newEvent(
                 &pt_CurrentEventClone->pt_Left,
                 pt_CurrentEventClone,
-                pt_Event->pt_Left->t_Count);
+                pt_Event->pt_Left->t_Count,
+                t_AllocType);
 
             if (t_Status == ITC_STATUS_SUCCESS)
             {
@@ -228,7 +414,8 @@ static ITC_Status_t cloneEvent(
             t_Status = newEvent(
                 &pt_CurrentEventClone->pt_Right,
                 pt_CurrentEventClone,
-                pt_Event->pt_Right->t_Count);
+                pt_Event->pt_Right->t_Count,
+                t_AllocType);
 
             if (t_Status == ITC_STATUS_SUCCESS)
             {
@@ -239,6 +426,14 @@ static ITC_Status_t cloneEvent(
         }
         else
         {
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+            /* Keep the subtree marked for normalisation */
+            pt_CurrentEventClone->b_IsDirty = pt_Event->b_IsDirty;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+            pt_CurrentEventClone->t_ChildrenMax = pt_Event->t_ChildrenMax;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
             /* Go up the tree */
             pt_Event = pt_Event->pt_Parent;
             pt_CurrentEventClone = pt_CurrentEventClone->pt_Parent;
@@ -251,12 +446,61 @@ static ITC_Status_t cloneEvent(
     {
         /* There is nothing else to do if the cloning fails. Also it is more
          * important to convey the cloning failed, rather than the destroy */
-        (void)ITC_Event_destroy(ppt_ClonedEvent);
+        (void)destroyEvent(ppt_ClonedEvent, t_AllocType);
     }
 
     return t_Status;
 }
 
+/**
+ * @brief Count the nodes of an Event
+ *
+ * @param pt_Event The Event
+ * @return `uint32_t` The number of nodes in the Event tree
+ */
+static uint32_t countEventNodes(
+    const ITC_Event_t *pt_Event
+)
+{
+    /* Remember the parent as this might be a subtree */
+    const ITC_Event_t *const pt_RootEventParent = pt_Event->pt_Parent;
+    uint32_t u32_NodeCount = 0;
+
+    /* Perform a pre-order traversal */
+    while (pt_Event != pt_RootEventParent)
+    {
+        u32_NodeCount++;
+
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* Descend into left child */
+            pt_Event = pt_Event->pt_Left;
+        }
+        else
+        {
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_Event->pt_Parent != pt_RootEventParent &&
+                   pt_Event->pt_Parent->pt_Right == pt_Event)
+            {
+                pt_Event = pt_Event->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_Event->pt_Parent != pt_RootEventParent)
+            {
+                pt_Event = pt_Event->pt_Parent->pt_Right;
+            }
+            else
+            {
+                pt_Event = pt_RootEventParent;
+            }
+        }
+    }
+
+    return u32_NodeCount;
+}
+
 /**
  * @brief Increment an `ITC_EventCounter_t` and detect overflows
  *
@@ -422,29 +666,160 @@ static ITC_Status_t liftDestroyDestroyEvent(
  * children
  * @param t_LeftCount The event counter to assign to the left child node
  * @param t_RightCount The event counter to assign to the right child node
+ * @param t_AllocType The type of memory to allocate the child nodes from
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
 static ITC_Status_t createChildEventNodes(
     ITC_Event_t *const pt_Event,
     const ITC_Event_Counter_t t_LeftCount,
-    const ITC_Event_Counter_t t_RightCount
+    const ITC_Event_Counter_t t_RightCount,
+    const ITC_Port_AllocType_t t_AllocType
 )
 {
     ITC_Status_t t_Status;
 
     /* Allocate the left child */
-    t_Status = newEvent(&pt_Event->pt_Left, pt_Event, t_LeftCount);
+    t_Status = newEvent(
+        &pt_Event->pt_Left, pt_Event, t_LeftCount, t_AllocType);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
         /* Allocate the right child */
-        t_Status = newEvent(&pt_Event->pt_Right, pt_Event, t_RightCount);
+        t_Status = newEvent(
+            &pt_Event->pt_Right, pt_Event, t_RightCount, t_AllocType);
+    }
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_Event->t_ChildrenMax = MAX(t_LeftCount, t_RightCount);
     }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
 
     return t_Status;
 }
 
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+
+/**
+ * @brief Get the cached `max(e)` of an Event, relative to its parent
+ *
+ * @param pt_Event The Event
+ * @return `ITC_Event_Counter_t` The maximum event count of the Event. If it is
+ * not known, or cannot be represented, `ITC_EVENT_UNKNOWN_CHILDREN_MAX`
+ */
+static ITC_Event_Counter_t getCachedEventMax(
+    const ITC_Event_t *const pt_Event
+)
+{
+    ITC_Event_Counter_t t_Max = pt_Event->t_Count;
+
+    /* max(n, e1, e2) = n + max(max(e1), max(e2)) */
+    if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+    {
+        if (!ITC_EVENT_HAS_KNOWN_CHILDREN_MAX(pt_Event) ||
+            pt_Event->t_ChildrenMax >= ITC_EVENT_UNKNOWN_CHILDREN_MAX - t_Max)
+        {
+            t_Max = ITC_EVENT_UNKNOWN_CHILDREN_MAX;
+        }
+        else
+        {
+            t_Max += pt_Event->t_ChildrenMax;
+        }
+    }
+
+    return t_Max;
+}
+
+/**
+ * @brief Update the cached maximum of a parent Event from its children
+ *
+ * @note The cached maximums of the children must be up to date
+ * @param pt_Event The parent Event
+ */
+static void updateEventChildrenMax(
+    ITC_Event_t *const pt_Event
+)
+{
+    pt_Event->t_ChildrenMax = MAX(
+        getCachedEventMax(pt_Event->pt_Left),
+        getCachedEventMax(pt_Event->pt_Right));
+}
+
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+
+/**
+ * @brief Update the cached maximum of every ancestor of an Event, after its
+ * subtree has been modified
+ *
+ * @param pt_Event The modified Event
+ */
+static void updateEventAncestorsChildrenMax(
+    ITC_Event_t *pt_Event
+)
+{
+    while (pt_Event->pt_Parent)
+    {
+        pt_Event = pt_Event->pt_Parent;
+        updateEventChildrenMax(pt_Event);
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+
+/**
+ * @brief Recalculate the cached maximum of every parent node in an Event
+ *
+ * Used for Event trees built without going through the other Event
+ * operations, such as deserialised ones.
+ *
+ * @param pt_Event The Event
+ */
+static void refreshEventChildrenMaxE(
+    ITC_Event_t *pt_Event
+)
+{
+    /* Remember the parent as this might be a subtree */
+    const ITC_Event_t *const pt_RootEventParent = pt_Event->pt_Parent;
+
+    /* The previously visited node */
+    const ITC_Event_t *pt_PrevEvent = pt_RootEventParent;
+    ITC_Event_t *pt_NextEvent;
+
+    /* Perform a post-order traversal */
+    while (pt_Event != pt_RootEventParent)
+    {
+        /* Coming from the parent, descend into the left child */
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) &&
+            pt_PrevEvent == pt_Event->pt_Parent)
+        {
+            pt_NextEvent = pt_Event->pt_Left;
+        }
+        /* Coming from the left child, descend into the right child */
+        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) &&
+                 pt_PrevEvent == pt_Event->pt_Left)
+        {
+            pt_NextEvent = pt_Event->pt_Right;
+        }
+        /* Both children are done, climb back */
+        else
+        {
+            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+            {
+                updateEventChildrenMax(pt_Event);
+            }
+
+            pt_NextEvent = pt_Event->pt_Parent;
+        }
+
+        pt_PrevEvent = pt_Event;
+        pt_Event = pt_NextEvent;
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
 /**
  * @brief Normalise an Event fulfilling `norm(e)`
  * Rules:
@@ -456,6 +831,11 @@ static ITC_Status_t createChildEventNodes(
  *      - min(n) = n
  *      - min((n, e1, e2)) = n
  *
+ * Only descends into subtrees that are not normalised, or have been marked as
+ * dirty by a lazy join. The dirty marks are cleared along the way. If
+ * ::ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE is enabled, the cached maximum
+ * of every visited parent node is updated as well.
+ *
  * @param pt_Event The Event to normalise
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
@@ -469,21 +849,28 @@ static ITC_Status_t normEventE(
     /* Remember the parent as this might be a subtree */
     ITC_Event_t *pt_RootEventParent = pt_Event->pt_Parent;
 
+    /* The child subtree to normalise next. NULL if the current node is done */
+    ITC_Event_t *pt_NextEvent;
+
     while (t_Status == ITC_STATUS_SUCCESS &&
            pt_Event != pt_RootEventParent)
     {
+        pt_NextEvent = NULL;
+
         /* norm((n, e1, e2)) */
         if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
         {
             /* Normalise e1 */
-            if (!ITC_EVENT_IS_NORMALISED_EVENT(pt_Event->pt_Left))
+            if (!ITC_EVENT_IS_NORMALISED_EVENT(pt_Event->pt_Left) ||
+                ITC_EVENT_IS_DIRTY_EVENT(pt_Event->pt_Left))
             {
-                pt_Event = pt_Event->pt_Left;
+                pt_NextEvent = pt_Event->pt_Left;
             }
             /* Normalise e2 */
-            else if (!ITC_EVENT_IS_NORMALISED_EVENT(pt_Event->pt_Right))
+            else if (!ITC_EVENT_IS_NORMALISED_EVENT(pt_Event->pt_Right) ||
+                     ITC_EVENT_IS_DIRTY_EVENT(pt_Event->pt_Right))
             {
-                pt_Event = pt_Event->pt_Right;
+                pt_NextEvent = pt_Event->pt_Right;
             }
             /* norm((n, m, m)) = lift(n, m) */
             else if (ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Left) &&
@@ -493,11 +880,6 @@ static ITC_Status_t normEventE(
             {
                 /* Lift the root, destroy the children */
                 t_Status = liftDestroyDestroyEvent(pt_Event);
-
-                if (t_Status == ITC_STATUS_SUCCESS)
-                {
-                    pt_Event = pt_Event->pt_Parent;
-                }
             }
             /*
              * norm((n, e1, e2)) = (lift(n, m), sink(e1, m), sink(e2, m)),
@@ -511,21 +893,34 @@ static ITC_Status_t normEventE(
             {
                 /* Lift the root, sink the children */
                 t_Status = liftSinkSinkEvent(pt_Event);
-
-                if (t_Status == ITC_STATUS_SUCCESS)
-                {
-                    pt_Event = pt_Event->pt_Parent;
-                }
             }
-            /* pt_Event event is normalised. Nothing to do */
             else
             {
-                pt_Event = pt_Event->pt_Parent;
+                /* pt_Event is normalised. Nothing to do */
             }
         }
-        /* norm(n) = n */
         else
         {
+            /* norm(n) = n. Nothing to do */
+        }
+
+        if (pt_NextEvent)
+        {
+            pt_Event = pt_NextEvent;
+        }
+        /* Climb back once the current node is done */
+        else if (t_Status == ITC_STATUS_SUCCESS)
+        {
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+            pt_Event->b_IsDirty = false;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+            {
+                updateEventChildrenMax(pt_Event);
+            }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
             pt_Event = pt_Event->pt_Parent;
         }
     }
@@ -534,31 +929,94 @@ static ITC_Status_t normEventE(
 }
 
 /**
- * @brief Join two Events into a new Event fulfilling `join(e1, e2)`
- * Rules:
- *  - join(n1, n2) = max(n1, n2)
- *  - join(n1, (n2, l2, r2)) = join((n1, 0, 0), (n2, l2, r2))
- *  - join((n1, l1, r1), n2) = join((n1, l1, r1), (n2, 0, 0))
- *  - join((n1, l1, r1), (n2, l2, r2)):
- *    - If n1 > n2:
- *         join((n2, l2, r2), (n1, l1, r1))
- *    - If n1 <= n2:
- *         norm((n1, join(l1, lift(l2, n2 - n1)), join(r1, lift(r2, n2 - n1))))
+ * @brief Release the normalised copy of an Event
  *
- * @param pt_Event1 The first Event
- * @param pt_Event2 The second Event
- * @param ppt_Event The new Event
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
+ * @param ppt_EventCopy The copy allocated by ::getNormalisedEvent(), or NULL
  */
-static ITC_Status_t joinEventE(
-    const ITC_Event_t *const pt_Event1,
-    const ITC_Event_t *const pt_Event2,
-    ITC_Event_t **const ppt_Event
+static void releaseNormalisedEvent(
+    ITC_Event_t **const ppt_EventCopy
 )
 {
-    ITC_Status_t t_Status; /* The current status */
-
+    if (*ppt_EventCopy)
+    {
+        (void)ITC_Event_destroy(ppt_EventCopy);
+    }
+}
+
+/**
+ * @brief Get a normalised version of an Event
+ *
+ * An Event joined without normalisation (see
+ * ::ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION) is copied and the copy is
+ * normalised. The Event itself is never modified.
+ *
+ * @param pt_Event The Event. Must be valid
+ * @param ppt_EventCopy (out) The allocated copy of the Event, or NULL. Must be
+ * released with ::releaseNormalisedEvent()
+ * @param ppt_NormalisedEvent (out) Either `pt_Event` or `*ppt_EventCopy`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getNormalisedEvent(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t **const ppt_EventCopy,
+    const ITC_Event_t **const ppt_NormalisedEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    *ppt_EventCopy = NULL;
+    *ppt_NormalisedEvent = pt_Event;
+
+    if (ITC_EVENT_IS_DIRTY_EVENT(pt_Event))
+    {
+        t_Status = cloneEvent(
+            pt_Event, ppt_EventCopy, NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = normEventE(*ppt_EventCopy);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            *ppt_NormalisedEvent = *ppt_EventCopy;
+        }
+        else
+        {
+            releaseNormalisedEvent(ppt_EventCopy);
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Join two Events into a new Event fulfilling `join(e1, e2)`
+ * Rules:
+ *  - join(n1, n2) = max(n1, n2)
+ *  - join(n1, (n2, l2, r2)) = join((n1, 0, 0), (n2, l2, r2))
+ *  - join((n1, l1, r1), n2) = join((n1, l1, r1), (n2, 0, 0))
+ *  - join((n1, l1, r1), (n2, l2, r2)):
+ *    - If n1 > n2:
+ *         join((n2, l2, r2), (n1, l1, r1))
+ *    - If n1 <= n2:
+ *         norm((n1, join(l1, lift(l2, n2 - n1)), join(r1, lift(r2, n2 - n1))))
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param ppt_Event The new Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t joinEventE(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
     ITC_Event_t *pt_CurrentEvent1 = NULL;
     ITC_Event_t *pt_RootEvent1 = NULL;
     ITC_Event_t *pt_CurrentEvent2 = NULL;
@@ -572,16 +1030,20 @@ static ITC_Status_t joinEventE(
     /* Init Event */
     *ppt_CurrentEvent = NULL;
 
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_JOIN_CLONE);
+
     /* Clone the input events, as they will get modified during the
      * joining process */
-    t_Status = cloneEvent(pt_Event1, &pt_CurrentEvent1, NULL);
+    t_Status = cloneEvent(
+        pt_Event1, &pt_CurrentEvent1, NULL, ITC_EVENT_TEMP_ALLOCTYPE);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
         /* Save the root so it can be easily deallocated */
         pt_RootEvent1 = pt_CurrentEvent1;
 
-        t_Status = cloneEvent(pt_Event2, &pt_CurrentEvent2, NULL);
+        t_Status = cloneEvent(
+            pt_Event2, &pt_CurrentEvent2, NULL, ITC_EVENT_TEMP_ALLOCTYPE);
 
         if (t_Status == ITC_STATUS_SUCCESS)
         {
@@ -589,6 +1051,14 @@ static ITC_Status_t joinEventE(
         }
     }
 
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_EVENT_JOIN_CLONE,
+        (t_Status == ITC_STATUS_SUCCESS) ?
+            countEventNodes(pt_RootEvent1) + countEventNodes(pt_RootEvent2) :
+            0);
+
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_JOIN_MERGE);
+
     while (t_Status == ITC_STATUS_SUCCESS &&
            pt_CurrentEvent1 != pt_RootEvent1->pt_Parent &&
            pt_CurrentEvent2 != pt_RootEvent2->pt_Parent)
@@ -600,7 +1070,8 @@ static ITC_Status_t joinEventE(
             t_Status = newEvent(
                 ppt_CurrentEvent,
                 pt_CurrentEventParent,
-                MAX(pt_CurrentEvent1->t_Count, pt_CurrentEvent2->t_Count));
+                MAX(pt_CurrentEvent1->t_Count, pt_CurrentEvent2->t_Count),
+                ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
 
             if (t_Status == ITC_STATUS_SUCCESS)
             {
@@ -628,7 +1099,11 @@ static ITC_Status_t joinEventE(
              * This might exist from a previous iteration. This is fine. */
             if (!*ppt_CurrentEvent)
             {
-                t_Status = newEvent(ppt_CurrentEvent, pt_CurrentEventParent, 0);
+                t_Status = newEvent(
+                    ppt_CurrentEvent,
+                    pt_CurrentEventParent,
+                    0,
+                    ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
             }
 
             if (t_Status == ITC_STATUS_SUCCESS)
@@ -711,26 +1186,32 @@ static ITC_Status_t joinEventE(
         /* join(n1, (n2, l2, r2)) = join((n1, 0, 0), (n2, l2, r2)) */
         else if (ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent1))
         {
-            t_Status = createChildEventNodes(pt_CurrentEvent1, 0, 0);
+            t_Status = createChildEventNodes(
+                pt_CurrentEvent1, 0, 0, ITC_EVENT_TEMP_ALLOCTYPE);
         }
         /* join((n1, l1, r1), n2) = join((n1, l1, r1), (n2, 0, 0)) */
         else
         {
-            t_Status = createChildEventNodes(pt_CurrentEvent2, 0, 0);
+            t_Status = createChildEventNodes(
+                pt_CurrentEvent2, 0, 0, ITC_EVENT_TEMP_ALLOCTYPE);
         }
     }
 
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_EVENT_JOIN_MERGE,
+        (t_Status == ITC_STATUS_SUCCESS) ? countEventNodes(*ppt_Event) : 0);
+
     /* Destroy the copied input events */
     if (pt_RootEvent1)
     {
         /* There is nothing else to do if the destroy fails. */
-        (void)ITC_Event_destroy(&pt_RootEvent1);
+        (void)destroyEvent(&pt_RootEvent1, ITC_EVENT_TEMP_ALLOCTYPE);
     }
 
     if (pt_RootEvent2)
     {
         /* There is nothing else to do if the destroy fails. */
-        (void)ITC_Event_destroy(&pt_RootEvent2);
+        (void)destroyEvent(&pt_RootEvent2, ITC_EVENT_TEMP_ALLOCTYPE);
     }
 
     /* If something goes wrong during the joining process - the Event is invalid
@@ -746,180 +1227,137 @@ static ITC_Status_t joinEventE(
 }
 
 /**
- * @brief Check if one Event is `<=` to another, fulfilling `leq(e1, e2)`
- * Rules:
- *  - leq(n1, n2) = n1 <= n2
- *  - leq(n1, (n2, l2, r2)) = n1 <= n2
- *  - leq((n1, l1, r1), n2):
- *       n1 <= n2 && leq(lift(l1, n1), n2) && leq(lift(r1, n1), n2)
- *  - leq((n1, l1, r1), (n2, l2, r2)):
- *       n1 <= n2 && leq(lift(l1, n1), lift(l2, n2)) && leq(lift(r1, n1), lift(r2, n2))
+ * @brief Swap the event counters and subtrees of two Event nodes
  *
- * @param pt_Event1 The first Event
- * @param pt_Event2 The second Event
- * @param pb_IsLeq (out) `true` if `*pt_Event1 <= *pt_Event2`. Otherwise `false`
+ * The nodes themselves stay where they are in their respective trees. Only
+ * their contents are exchanged.
+ *
+ * @param pt_Event1 The first Event node
+ * @param pt_Event2 The second Event node
+ */
+static void swapEventNodes(
+    ITC_Event_t *const pt_Event1,
+    ITC_Event_t *const pt_Event2
+)
+{
+    ITC_Event_Counter_t t_SwapCount;
+    ITC_Event_t *pt_SwapEvent;
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    bool b_SwapIsDirty;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+    t_SwapCount = pt_Event1->t_Count;
+    pt_Event1->t_Count = pt_Event2->t_Count;
+    pt_Event2->t_Count = t_SwapCount;
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+    /* The cached maximums belong to the subtrees */
+    t_SwapCount = pt_Event1->t_ChildrenMax;
+    pt_Event1->t_ChildrenMax = pt_Event2->t_ChildrenMax;
+    pt_Event2->t_ChildrenMax = t_SwapCount;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+    pt_SwapEvent = pt_Event1->pt_Left;
+    pt_Event1->pt_Left = pt_Event2->pt_Left;
+    pt_Event2->pt_Left = pt_SwapEvent;
+
+    pt_SwapEvent = pt_Event1->pt_Right;
+    pt_Event1->pt_Right = pt_Event2->pt_Right;
+    pt_Event2->pt_Right = pt_SwapEvent;
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    b_SwapIsDirty = pt_Event1->b_IsDirty;
+    pt_Event1->b_IsDirty = pt_Event2->b_IsDirty;
+    pt_Event2->b_IsDirty = b_SwapIsDirty;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+    /* Fix the parent pointers of the swapped subtrees */
+    if (ITC_EVENT_IS_PARENT_EVENT(pt_Event1))
+    {
+        pt_Event1->pt_Left->pt_Parent = pt_Event1;
+        pt_Event1->pt_Right->pt_Parent = pt_Event1;
+    }
+
+    if (ITC_EVENT_IS_PARENT_EVENT(pt_Event2))
+    {
+        pt_Event2->pt_Left->pt_Parent = pt_Event2;
+        pt_Event2->pt_Right->pt_Parent = pt_Event2;
+    }
+}
+
+/**
+ * @brief Check the absolute event count of every node in an Event, increased
+ * by `t_Headroom`, can be represented by an `ITC_Event_Counter_t`
+ *
+ * The in-place join operation only ever produces counters that are less than
+ * or equal to the absolute counts of its inputs. Similarly, adding `k` events
+ * with fill and grow only ever produces counters that are less than or equal
+ * to `max(e) + k`. Checking this beforehand guarantees these operations
+ * cannot fail halfway through due to a counter overflow.
+ *
+ * @param pt_Event The Event to check
+ * @param t_Headroom The amount each absolute event count must be able to grow
+ * by without overflowing
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count
+ * cannot be represented
  */
-static ITC_Status_t leqEventE(
-    const ITC_Event_t *pt_Event1,
-    const ITC_Event_t *pt_Event2,
-    bool *const pb_IsLeq
+static ITC_Status_t checkEventCountersE(
+    const ITC_Event_t *pt_Event,
+    const ITC_Event_Counter_t t_Headroom
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    const ITC_Event_t *pt_CurrentEvent1Parent;
-    const ITC_Event_t *pt_RootEvent1Parent;
+    /* Remember the parent as this might be a subtree */
+    const ITC_Event_t *const pt_RootEventParent = pt_Event->pt_Parent;
 
     /* Holds the event count from the root to the current parent node */
-    ITC_Event_Counter_t t_ParentsCountEvent1 = 0;
-    ITC_Event_Counter_t t_ParentsCountEvent2 = 0;
-
-    /* Holds the total current event count
-     * (pt_EventX->t_Count + t_ParentsCountEventX) */
-    ITC_Event_Counter_t t_CurrentCountEvent1 = 0;
-    ITC_Event_Counter_t t_CurrentCountEvent2 = 0;
-
-    /* Keeps track of how many descends have been skipped by pt_Event2 due
-     * to its tree branch being shallower than the one in pt_Event1 */
-    uint32_t u32_CurrentEvent2DescendSkips = 0;
-
-    /* Init flag */
-    *pb_IsLeq = true;
-
-    /* Remember the root parent Event as this might be a subtree */
-    pt_RootEvent1Parent = pt_Event1->pt_Parent;
-
-    pt_CurrentEvent1Parent = pt_RootEvent1Parent;
+    ITC_Event_Counter_t t_ParentsCount = 0;
+    /* Holds the absolute event count of the current node */
+    ITC_Event_Counter_t t_CurrentCount;
 
-    /* Perform a pre-order traversal.
-     *
-     * For `pt_Event1 <= pt_Event2` all `<=` checks must pass.
-     * If a check fails - exit early */
-    while (t_Status == ITC_STATUS_SUCCESS && *pb_IsLeq && pt_Event1)
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event != pt_RootEventParent)
     {
-        /* Calculate the total current event count for both Event trees
-         *
-         * Essentially this is a `lift([lr]X, nX)` operation but
-         * doesn't modify the original Event trees */
-        t_CurrentCountEvent1 = pt_Event1->t_Count;
-        t_Status = incEventCounter(&t_CurrentCountEvent1, t_ParentsCountEvent1);
+        t_CurrentCount = t_ParentsCount;
+        t_Status = incEventCounter(&t_CurrentCount, pt_Event->t_Count);
 
         if (t_Status == ITC_STATUS_SUCCESS)
         {
-            t_CurrentCountEvent2 = pt_Event2->t_Count;
-            t_Status = incEventCounter(
-                &t_CurrentCountEvent2, t_ParentsCountEvent2);
-        }
-
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* n1 <= n2 */
-            *pb_IsLeq = t_CurrentCountEvent1 <= t_CurrentCountEvent2;
-
-            if (*pb_IsLeq)
+            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
             {
-                /* Descend into left tree */
-                if (pt_Event1->pt_Left)
+                /* Descend into left child */
+                t_ParentsCount = t_CurrentCount;
+                pt_Event = pt_Event->pt_Left;
+            }
+            /* The absolute count of a leaf is always the biggest one on its
+             * path, so only check the headroom here */
+            else if (t_Headroom >
+                     (((ITC_Event_Counter_t)~0) - t_CurrentCount))
+            {
+                t_Status = ITC_STATUS_EVENT_COUNTER_OVERFLOW;
+            }
+            else
+            {
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (pt_Event->pt_Parent != pt_RootEventParent &&
+                       pt_Event->pt_Parent->pt_Right == pt_Event)
                 {
-                    /* Increment the parent height */
-                    t_Status = incEventCounter(
-                        &t_ParentsCountEvent1, pt_Event1->t_Count);
-
-                    if (t_Status == ITC_STATUS_SUCCESS)
-                    {
-                        pt_Event1 = pt_Event1->pt_Left;
-
-                        /* If pt_Event2 has a left node - descend down */
-                        if (pt_Event2->pt_Left)
-                        {
-                            /* Increment the parent height */
-                            t_Status = incEventCounter(
-                                &t_ParentsCountEvent2,
-                                pt_Event2->t_Count);
+                    pt_Event = pt_Event->pt_Parent;
+                    t_ParentsCount -= pt_Event->t_Count;
+                }
 
-                            if (t_Status == ITC_STATUS_SUCCESS)
-                            {
-                                pt_Event2 = pt_Event2->pt_Left;
-                            }
-                        }
-                        /* Otherwise, keep track of how many times the descend
-                        * was skipped due to a shallow tree */
-                        else
-                        {
-                            u32_CurrentEvent2DescendSkips++;
-                        }
-                    }
+                /* There is a right subtree that has not been explored yet */
+                if (pt_Event->pt_Parent != pt_RootEventParent)
+                {
+                    pt_Event = pt_Event->pt_Parent->pt_Right;
                 }
-                /* Valid parent ITC Event trees always have both left and right
-                * nodes. Thus, there is no need to check if the current node
-                * doesn't have a left child but has a right one.
-                *
-                * Instead directly start backtracking up the tree */
                 else
                 {
-                    /* Get the current parent node */
-                    pt_CurrentEvent1Parent = pt_Event1->pt_Parent;
-
-                    /* Loop until the current node is no longer its
-                     * parent's right child node */
-                    while (t_Status == ITC_STATUS_SUCCESS &&
-                           pt_CurrentEvent1Parent != pt_RootEvent1Parent &&
-                           pt_CurrentEvent1Parent->pt_Right == pt_Event1)
-                    {
-                        pt_Event1 = pt_Event1->pt_Parent;
-                        pt_CurrentEvent1Parent =
-                            pt_CurrentEvent1Parent->pt_Parent;
-
-                        /* Decrement the parent height */
-                        t_Status = decEventCounter(
-                            &t_ParentsCountEvent1, pt_Event1->t_Count);
-
-                        if (t_Status == ITC_STATUS_SUCCESS)
-                        {
-                            /* Decrement the amount of skipped descends */
-                            if (u32_CurrentEvent2DescendSkips)
-                            {
-                                u32_CurrentEvent2DescendSkips--;
-                            }
-                            /* If no descends were skipped - start backtracking
-                            * up the pt_Event2 tree.
-                            * There is no need to check if the current pt_Event2
-                            * is it's parent's right child, because its descend
-                            * is tied to the descends of pt_Event1 */
-                            else
-                            {
-                                pt_Event2 = pt_Event2->pt_Parent;
-
-                                /* Decrement the parent height */
-                                t_Status = decEventCounter(
-                                    &t_ParentsCountEvent2,
-                                    pt_Event2->t_Count);
-                            }
-                        }
-                    }
-
-                    /* There is a right subtree that has not been explored
-                    * yet */
-                    if (pt_CurrentEvent1Parent != pt_RootEvent1Parent)
-                    {
-                        /* Jump from the left node of the current parent to
-                         * right one */
-                        pt_Event1 = pt_CurrentEvent1Parent->pt_Right;
-
-                        /* Do the same for pt_Event2 if it hasn't skipped
-                         * any descends due to its tree being shallow */
-                        if(!u32_CurrentEvent2DescendSkips)
-                        {
-                            pt_Event2 = pt_Event2->pt_Parent->pt_Right;
-                        }
-                    }
-                    /* The tree has been fully explored. Exit loop */
-                    else
-                    {
-                        pt_Event1 = NULL;
-                    }
+                    pt_Event = pt_RootEventParent;
                 }
             }
         }
@@ -929,49 +1367,86 @@ static ITC_Status_t leqEventE(
 }
 
 /**
- * @brief Maximise an Event fulfilling `max(e)`
+ * @brief Join an Event with a leaf Event in place, fulfilling `join(e, n)`
  * Rules:
- *  - max(n) = n
- *  - max(n, e1, e2) = n + max(max(e1), max(e2))
+ *  - join(m, n) = max(m, n)
+ *  - join((m, l, r), n):
+ *    - If n <= m:
+ *         (m, l, r)
+ *    - If n > m:
+ *         norm((m, join(l, n - m), join(r, n - m)))
  *
- * The resulting Event is always a leaf Event
+ * Unlike `joinEventE` the leaf Event is never expanded into a `(n, 0, 0)`
+ * tree, so no memory is allocated.
  *
- * @param pt_Event The Event to maximise
+ * If ::ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION is enabled, the parent nodes
+ * are marked as dirty instead of being normalised.
+ *
+ * @param pt_Event The Event to join into
+ * @param t_Count The event counter of the leaf Event
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
-static ITC_Status_t maxEventE(
-    ITC_Event_t *pt_Event
+static ITC_Status_t joinLeafEventE(
+    ITC_Event_t *pt_Event,
+    ITC_Event_Counter_t t_Count
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
-    ITC_Event_t *pt_RootEventParent;
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    /* Remember the parent as this might be a subtree */
-    pt_RootEventParent = pt_Event->pt_Parent;
+    /* Remember the root and its parent as this might be a subtree */
+    const ITC_Event_t *const pt_RootEvent = pt_Event;
+    const ITC_Event_t *const pt_RootEventParent = pt_Event->pt_Parent;
+
+    /* Whether the current node still needs to be joined */
+    bool b_Descend = true;
 
     while (t_Status == ITC_STATUS_SUCCESS && pt_Event != pt_RootEventParent)
     {
-        if (ITC_EVENT_IS_LEAF_EVENT(pt_Event))
+        if (b_Descend)
         {
-            /* The Event is maximised. Nothing to do. */
-            pt_Event = pt_Event->pt_Parent;
+            /* n <= m. The subtree is normalised, so min((m, l, r)) == m and
+             * nothing in it can be smaller than n */
+            if (t_Count <= pt_Event->t_Count)
+            {
+                b_Descend = false;
+            }
+            /* join(m, n) = max(m, n) = n */
+            else if (ITC_EVENT_IS_LEAF_EVENT(pt_Event))
+            {
+                pt_Event->t_Count = t_Count;
+                b_Descend = false;
+            }
+            /* Descend into left child */
+            else
+            {
+                t_Count -= pt_Event->t_Count;
+                pt_Event = pt_Event->pt_Left;
+            }
         }
-        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event->pt_Left))
+        else if (pt_Event == pt_RootEvent)
         {
-            /* Explore left subtree */
-            pt_Event = pt_Event->pt_Left;
+            /* Done */
+            pt_Event = pt_Event->pt_Parent;
         }
-        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event->pt_Right))
+        /* Left child is done, descend into right child */
+        else if (pt_Event->pt_Parent->pt_Left == pt_Event)
         {
-            /* Explore right subtree */
-            pt_Event = pt_Event->pt_Right;
+            pt_Event = pt_Event->pt_Parent->pt_Right;
+            b_Descend = true;
         }
-        /* Both Event subtrees are leafs */
+        /* Both children are done, climb back and normalise the parent */
         else
         {
-            /* Maximise the Event count */
-            t_Status = liftDestroyDestroyEvent(pt_Event);
+            pt_Event = pt_Event->pt_Parent;
+            t_Count += pt_Event->t_Count;
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+            /* Leave the normalisation to `normEventE` */
+            pt_Event->b_IsDirty = true;
+#else
+            t_Status = normEventE(pt_Event);
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
         }
     }
 
@@ -979,252 +1454,121 @@ static ITC_Status_t maxEventE(
 }
 
 /**
- * @brief Fill an Event, fulfilling `fill(i, e)`
+ * @brief Join two Events in place, fulfilling `join(e1, e2)`
  * Rules:
- *  - fill(0, e) = e
- *  - fill(1, e) = max(e)
- *  - fill(i, n) = n
- *  - fill((1, ir), (n, el, er)):
- *        norm((n, max(max(el), min(er')), er')), where er' = fill(ir, er)
- *  - fill((il, 1), (n, el, er)):
- *        norm((n, el', max(max(er), min(el')))), where el' = fill(il, el)
- *  - fill((il, ir), (n, el, er)):
- *        norm((n, fill(il, el), fill(ir, er)))
+ *  - join(n1, n2) = max(n1, n2)
+ *  - join(n1, (n2, l2, r2)) = join((n2, l2, r2), n1)
+ *  - join((n1, l1, r1), n2) - See `joinLeafEventE`
+ *  - join((n1, l1, r1), (n2, l2, r2)):
+ *    - If n1 > n2:
+ *         join((n2, l2, r2), (n1, l1, r1))
+ *    - If n1 <= n2:
+ *         norm((n1, join(l1, lift(l2, n2 - n1)), join(r1, lift(r2, n2 - n1))))
  *
- * @param ppt_Event The Event to fill
- * @param pt_Id The ID showing the ownership information for the interval
- * @param pb_WasFilled (out) Whether the event was filled or not. In some cases
- * filling an Event (simplifying + inflating) is not possible
+ * The joined Event is built from the nodes of both Events. Subtrees are moved
+ * from `pt_Event2` into `pt_Event1` when needed, while the nodes that are no
+ * longer needed are left behind in `pt_Event2`. No memory is allocated.
+ *
+ * If ::ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION is enabled, the parent nodes
+ * are marked as dirty instead of being normalised.
+ *
+ * @note Both Events must be valid, normalised and pass `checkEventCountersE`.
+ * @param pt_Event1 (in) The first Event. (out) The joined Event
+ * @param pt_Event2 (in) The second Event. (out) The leftover nodes, which
+ * must be destroyed by the caller
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
-static ITC_Status_t fillEventE(
-    ITC_Event_t **const ppt_Event,
-    const ITC_Id_t *pt_Id,
-    bool *const pb_WasFilled
+static ITC_Status_t joinEventInPlaceE(
+    ITC_Event_t *pt_Event1,
+    ITC_Event_t *pt_Event2
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    /* Clone of `*ppt_Event` - modifications will be done on the cloned event */
-    ITC_Event_t *pt_ClonedEvent = NULL;
-    ITC_Event_t *pt_CurrentEvent = *ppt_Event;
-    /* Remember the root parents as these might be Event or ID subtrees */
-    ITC_Event_t *pt_RootEventParent = (*ppt_Event)->pt_Parent;
-    ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent;
-
-    /* The previously iterated ID subtree.
-     * Used to keep track of which nodes have been explored */
-    const ITC_Id_t *pt_PrevId = NULL;
 
-    /* Init the flag */
-    *pb_WasFilled = false;
+    /* Remember the root and its parent as this might be a subtree */
+    const ITC_Event_t *const pt_RootEvent1 = pt_Event1;
+    const ITC_Event_t *const pt_RootEvent1Parent = pt_Event1->pt_Parent;
 
-    /* Clone the event */
-    t_Status = cloneEvent(*ppt_Event, &pt_ClonedEvent, pt_RootEventParent);
+    /* Whether the current nodes still need to be joined */
+    bool b_Descend = true;
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event1 != pt_RootEvent1Parent)
     {
-        while (t_Status == ITC_STATUS_SUCCESS &&
-               pt_CurrentEvent != pt_RootEventParent &&
-               pt_Id != pt_RootIdParent)
+        if (b_Descend)
         {
-            /* fill(0, e) = e or fill(i, n) = n */
-            if(ITC_ID_IS_NULL_ID(pt_Id) ||
-               ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent))
+            /* join(n1, n2) = max(n1, n2) */
+            if (ITC_EVENT_IS_LEAF_EVENT(pt_Event1) &&
+                ITC_EVENT_IS_LEAF_EVENT(pt_Event2))
             {
-                pt_PrevId = pt_Id;
-
-                /* Nothing to inflate. Go up the tree */
-                pt_Id = pt_Id->pt_Parent;
-                pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                pt_Event1->t_Count =
+                    MAX(pt_Event1->t_Count, pt_Event2->t_Count);
+                b_Descend = false;
             }
-            /* fill(1, e) = max(e) */
-            else if (ITC_ID_IS_SEED_ID(pt_Id))
+            /* join(n1, (n2, l2, r2)) = join((n2, l2, r2), n1) */
+            else if (ITC_EVENT_IS_LEAF_EVENT(pt_Event1))
             {
-                pt_PrevId = pt_Id;
-
-                /* Maximise Event (turn it into a leaf) */
-                t_Status = maxEventE(pt_CurrentEvent);
-
-                if (t_Status == ITC_STATUS_SUCCESS)
-                {
-                    *pb_WasFilled = true;
-
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
-                }
+                swapEventNodes(pt_Event1, pt_Event2);
             }
-            /* fill((1, ir), (n, el, er)):
-             *     norm((n, max(max(el), min(er')), er')), where:
-             *         er' = fill(ir, er)
-             */
-            else if (ITC_ID_IS_SEED_ID(pt_Id->pt_Left))
+            /* join((n1, l1, r1), n2) */
+            else if (ITC_EVENT_IS_LEAF_EVENT(pt_Event2))
             {
-                /* er' = fill(ir, er) */
-                if (pt_PrevId != pt_Id->pt_Right)
-                {
-                    pt_PrevId = pt_Id;
-
-                    pt_Id = pt_Id->pt_Right;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Right;
-                }
-                /* norm((n, max(max(el), min(er')), er')) */
-                else
-                {
-                    /* el = max(el) */
-                    if (ITC_EVENT_IS_PARENT_EVENT(pt_CurrentEvent->pt_Left))
-                    {
-                        /* Turn el into a leaf Event */
-                        t_Status = maxEventE(pt_CurrentEvent->pt_Left);
-
-                        if (t_Status == ITC_STATUS_SUCCESS)
-                        {
-                            *pb_WasFilled = true;
-                        }
-                    }
-
-                    /* el = max(el, min(er')) */
-                    if (t_Status == ITC_STATUS_SUCCESS &&
-                        (pt_CurrentEvent->pt_Left->t_Count <
-                            pt_CurrentEvent->pt_Right->t_Count))
-                    {
-                        /* For a normalised Event: min((n, el, er)) = n */
-                        pt_CurrentEvent->pt_Left->t_Count =
-                            pt_CurrentEvent->pt_Right->t_Count;
-
-                        *pb_WasFilled = true;
-                    }
-
-                    /* norm((n, el, er')) */
-                    if (t_Status == ITC_STATUS_SUCCESS)
-                    {
-                        t_Status = normEventE(pt_CurrentEvent);
-
-                        if (t_Status == ITC_STATUS_SUCCESS)
-                        {
-                            pt_PrevId = pt_Id;
-
-                            pt_Id = pt_Id->pt_Parent;
-                            pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
-                        }
-                    }
-                }
+                t_Status = joinLeafEventE(pt_Event1, pt_Event2->t_Count);
+                b_Descend = false;
             }
-            /* fill((il, 1), (n, el, er)):
-            *     norm((n, el', max(max(er), min(el')))), where:
-            *         el' = fill(il, el)
-            */
-            else if (ITC_ID_IS_SEED_ID(pt_Id->pt_Right))
+            else
             {
-                /* el' = fill(il, el) */
-                if (pt_PrevId != pt_Id->pt_Left)
+                /* If n1 > n2: flip them around */
+                if (pt_Event1->t_Count > pt_Event2->t_Count)
                 {
-                    pt_PrevId = pt_Id;
-
-                    pt_Id = pt_Id->pt_Left;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Left;
+                    swapEventNodes(pt_Event1, pt_Event2);
                 }
-                /* norm((n, el', max(max(er), min(el')))) */
-                else
-                {
-                    /* er = max(er) */
-                    if (ITC_EVENT_IS_PARENT_EVENT(pt_CurrentEvent->pt_Right))
-                    {
-                        /* Turn er into a leaf Event */
-                        t_Status = maxEventE(pt_CurrentEvent->pt_Right);
-
-                        if (t_Status == ITC_STATUS_SUCCESS)
-                        {
-                            *pb_WasFilled = true;
-                        }
-                    }
-
-                    /* er = max(er, min(el')) */
-                    if (t_Status == ITC_STATUS_SUCCESS &&
-                        (pt_CurrentEvent->pt_Right->t_Count <
-                            pt_CurrentEvent->pt_Left->t_Count))
-                    {
-                        /* For a normalised Event: min((n, el, er)) = n */
-                        pt_CurrentEvent->pt_Right->t_Count =
-                            pt_CurrentEvent->pt_Left->t_Count;
-
-                        *pb_WasFilled = true;
-                    }
 
-                    /* norm((n, el', er)) */
-                    if (t_Status == ITC_STATUS_SUCCESS)
-                    {
-                        t_Status = normEventE(pt_CurrentEvent);
-
-                        if (t_Status == ITC_STATUS_SUCCESS)
-                        {
-                            pt_PrevId = pt_Id;
+                /* lift(l2, n2 - n1) */
+                t_Status = incEventCounter(
+                    &pt_Event2->pt_Left->t_Count,
+                    pt_Event2->t_Count - pt_Event1->t_Count);
 
-                            pt_Id = pt_Id->pt_Parent;
-                            pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
-                        }
-                    }
-                }
-            }
-            /* fill((il, ir), (n, el, er)):
-            *     norm((n, fill(il, el), fill(ir, er)))
-            */
-            else
-            {
-                /* fill(il, el) */
-                if (pt_PrevId != pt_Id->pt_Left && pt_PrevId != pt_Id->pt_Right)
+                if (t_Status == ITC_STATUS_SUCCESS)
                 {
-                    pt_PrevId = pt_Id;
-
-                    pt_Id = pt_Id->pt_Left;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Left;
+                    /* lift(r2, n2 - n1) */
+                    t_Status = incEventCounter(
+                        &pt_Event2->pt_Right->t_Count,
+                        pt_Event2->t_Count - pt_Event1->t_Count);
                 }
-                /* fill(ir, er) */
-                else if (pt_PrevId != pt_Id->pt_Right)
-                {
-                    pt_PrevId = pt_Id;
 
-                    pt_Id = pt_Id->pt_Right;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Right;
-                }
-                /* norm((n, el, er) */
-                else
+                if (t_Status == ITC_STATUS_SUCCESS)
                 {
-                    t_Status = normEventE(pt_CurrentEvent);
-
-                    if (t_Status == ITC_STATUS_SUCCESS)
-                    {
-                        pt_PrevId = pt_Id;
-
-                        pt_Id = pt_Id->pt_Parent;
-                        pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
-                    }
+                    /* Descend into left children */
+                    pt_Event1 = pt_Event1->pt_Left;
+                    pt_Event2 = pt_Event2->pt_Left;
                 }
             }
         }
-
-        if (t_Status == ITC_STATUS_SUCCESS)
+        else if (pt_Event1 == pt_RootEvent1)
         {
-            /* Destroy the cloned Event
-             * Ignore return statuses. There is nothing else to do if the
-             * destroy fails. Also it is more important to convey that the
-             * overall fill operation succeeded */
-            (void)ITC_Event_destroy(&pt_ClonedEvent);
+            /* Done */
+            pt_Event1 = pt_Event1->pt_Parent;
+        }
+        /* Left children are done, descend into right children */
+        else if (pt_Event1->pt_Parent->pt_Left == pt_Event1)
+        {
+            pt_Event1 = pt_Event1->pt_Parent->pt_Right;
+            pt_Event2 = pt_Event2->pt_Parent->pt_Right;
+            b_Descend = true;
         }
+        /* Both children are done, climb back and normalise the parent */
         else
         {
-            /* Destroy the original Event
-            * Ignore return statuses. There is nothing else to do if the destroy
-            * fails. Also it is more important to convey why the fill operation
-            * failed */
-            (void)ITC_Event_destroy(ppt_Event);
-
-            /* Replace the original event with the clone */
-            *ppt_Event = pt_ClonedEvent;
-
-            /* Even though this value is not supposed to be used (since the
-             * status indicates a failure), ensure it is false */
-            *pb_WasFilled = false;
+            pt_Event1 = pt_Event1->pt_Parent;
+            pt_Event2 = pt_Event2->pt_Parent;
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+            /* Leave the normalisation to `normEventE` */
+            pt_Event1->b_IsDirty = true;
+#else
+            t_Status = normEventE(pt_Event1);
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
         }
     }
 
@@ -1232,480 +1576,7371 @@ static ITC_Status_t fillEventE(
 }
 
 /**
- * @brief Grow an Event, fulfilling `grow(i, e)`
+ * @brief Join two validated Events in place and destroy the leftover nodes
  *
- * Grow performs a dynamic programming based optimization to choose the
- * inflation that can be performed, given the available ID tree, so as to
- * minimize the cost (`c`) of the event tree growth. The cost of an Event tree
- * growth is defined so that:
- *  - incrementing an event counter is preferable over adding a node
- *  - an operation near the root is preferable to one further away
- *
- * Rules:
- *  - grow(1, n) = (n + 1, 0)
- *  - grow(i, n) = (e', c + N), where:
- *    - (e', c) = grow(i, (n, 0, 0))
- *    - N is a constant, greater than the maximum tree depth that arises
- *      Alternatively it could be implemented as a pair under
- *      lexicographic order
- *  - grow((0, ir), (n, el, er)):
- *        ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er)
- *  - grow((il, 0), (n, el, er)):
- *        ((n, el', er), cl + 1), where (el', cl) = grow(il, el)
- *  - grow((il, ir), (n, el, er)):
- *    - If cl < cr:
- *          ((n, el', er), cl + 1), where (el', cl) = grow(il, el)
- *    - If cl >= cr:
- *          ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er)
+ * If ::ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION is enabled, the joined
+ * Event is not normalised. The nodes touched by the join are only marked as
+ * dirty instead.
  *
- * @param ppt_Event The Event to grow
- * @param pt_Id The ID showing the ownership information for the interval
+ * @param ppt_Event (in) The first existing Event. (out) The joined Event
+ * @param ppt_OtherEvent (in) The second existing Event. (out) NULL
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
-static ITC_Status_t growEventE(
+static ITC_Status_t joinValidatedEvents(
     ITC_Event_t **const ppt_Event,
-    const ITC_Id_t *pt_Id
+    ITC_Event_t **const ppt_OtherEvent
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    /* Clone of `*ppt_Event` - modifications will be done on the cloned event */
-    ITC_Event_t *pt_ClonedEvent = NULL;
-    ITC_Event_t *pt_CurrentEvent = *ppt_Event;
-    /* Remember the root parents as these might be Event or ID subtrees */
-    ITC_Event_t *pt_RootEventParent = (*ppt_Event)->pt_Parent;
-    ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent;
 
-    /* The previously iterated ID subtree.
-     * Used to keep track of which nodes have been explored */
-    const ITC_Id_t *pt_PrevId = NULL;
+    if (!ppt_Event || !ppt_OtherEvent || !*ppt_Event || !*ppt_OtherEvent)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
-    /* Use 64-bit counters to avoid having to use lexicographic order, which
-     * would require dynamically allocating a list of integers.
-     *
-     * Instead the node expansion cost (when performing `grow(i, n)`) is set to
-     * be `UINT32_MAX`. This is effectively the same as having a list of 32-bit
-     * integers in lexicographic order as long as the Event tree height is less
-     * than `UINT32_MAX`.
-     *
-     * For all practical purposes this should be orders of magnitde bigger than
-     * any encountered Event tree height. */
-    uint64_t u64_CostLeft = 0;
-    uint64_t u64_CostRight = 0;
+    /* The nodes of both Events get reused, so they must not be shared */
+    if (t_Status == ITC_STATUS_SUCCESS && *ppt_Event == *ppt_OtherEvent)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
-    /* Init the cost pointer with the `&u64_CostLeft`. This is because if
-     * `cl >= cr`, the right subtree must be expanded. Two cases exist:
-     *
-     * - If the initial `*ppt_Event` is *not* a leaf:
-     *   `u64_CostLeft == u64_CostRight == 0`, thus the right subtree will be
-     *   expanded on the first iteration of the loop.
-     *
-     *  - If the initial `*ppt_Event` is a leaf:
-     *    On the first iteration, `pt_CurrentEvent` will expanded into a parent
-     *    node(`grow(i, n) = (e', c + N), where (e', c) = grow(i, (n, 0, 0)))`).
-     *    Thus, on the second iteration `u64_CostLeft > u64_CostRight` will be
-     *    be true, which would again expand the right subtree. */
-    uint64_t *pu64_CostPtr = &u64_CostLeft;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_JOIN_MERGE);
 
-    /* Clone the event */
-    t_Status = cloneEvent(*ppt_Event, &pt_ClonedEvent, pt_RootEventParent);
+        t_Status = joinEventInPlaceE(*ppt_Event, *ppt_OtherEvent);
+
+        ITC_PORT_TRACE_END(
+            ITC_PORT_TRACE_PHASE_EVENT_JOIN_MERGE,
+            (t_Status == ITC_STATUS_SUCCESS) ? countEventNodes(*ppt_Event) : 0);
+    }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        while (t_Status == ITC_STATUS_SUCCESS &&
-               pt_CurrentEvent != pt_RootEventParent &&
-               pt_Id != pt_RootIdParent)
+        /* Destroy the nodes left behind in the other Event.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall join
+         * operation was successful */
+        (void)ITC_Event_destroy(ppt_OtherEvent);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+
+/**
+ * @brief Check whether a parent node of the first Event in `leq(e1, e2)` is
+ * fully covered by a leaf of the second Event, i.e. `max(e1) <= n2`
+ *
+ * If so, none of the nodes in the subtree can fail the `<=` checks, and the
+ * subtree does not need to be walked.
+ *
+ * @param pt_Event1 The parent node of the first Event
+ * @param t_Count1 The absolute event count of `pt_Event1`
+ * @param pt_Event2 The current node of the second Event
+ * @param t_Count2 The absolute event count of `pt_Event2`
+ * @return `true` if the subtree is covered. Otherwise `false`
+ */
+static bool isEventSubtreeCovered(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_Counter_t t_Count1,
+    const ITC_Event_t *const pt_Event2,
+    const ITC_Event_Counter_t t_Count2
+)
+{
+    return ITC_EVENT_IS_LEAF_EVENT(pt_Event2) &&
+           ITC_EVENT_HAS_KNOWN_CHILDREN_MAX(pt_Event1) &&
+           t_Count1 <= t_Count2 &&
+           pt_Event1->t_ChildrenMax <= (t_Count2 - t_Count1);
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+#if ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH
+
+/**
+ * @brief Check if one Event is `<=` to another, fulfilling `leq(e1, e2)`,
+ * using the explicit traversal stack
+ *
+ * For the rules see ::leqEventE(). The right subtrees are pushed to the
+ * explicit stack with their lifted event counts when descending, so the Event
+ * trees are not climbed back up through their `pt_Parent` back-links. If the
+ * trees are deeper than the stack, the traversal is abandoned and
+ * `*pb_IsDone` is set to `false`.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pb_IsLeq (out) `true` if `*pt_Event1 <= *pt_Event2`. Otherwise `false`
+ * @param pb_IsDone (out) `true` if the traversal was completed. Otherwise
+ * `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t leqEventWithStackE(
+    const ITC_Event_t *pt_Event1,
+    const ITC_Event_t *pt_Event2,
+    bool *const pb_IsLeq,
+    bool *const pb_IsDone
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_TraversalFrame_t *pt_Frame;
+    uint32_t u32_StackLength = 0;
+
+    /* Holds the event count from the root to the current parent node */
+    ITC_Event_Counter_t t_ParentsCountEvent1 = 0;
+    ITC_Event_Counter_t t_ParentsCountEvent2 = 0;
+
+    /* Holds the total current event count
+     * (pt_EventX->t_Count + t_ParentsCountEventX) */
+    ITC_Event_Counter_t t_CurrentCountEvent1 = 0;
+    ITC_Event_Counter_t t_CurrentCountEvent2 = 0;
+
+    /* Init flags */
+    *pb_IsLeq = true;
+    *pb_IsDone = true;
+
+    /* Perform a pre-order traversal.
+     *
+     * For `pt_Event1 <= pt_Event2` all `<=` checks must pass.
+     * If a check fails - exit early */
+    while (t_Status == ITC_STATUS_SUCCESS && *pb_IsLeq && *pb_IsDone &&
+           pt_Event1)
+    {
+        /* Calculate the total current event count for both Event trees */
+        t_CurrentCountEvent1 = pt_Event1->t_Count;
+        t_Status = incEventCounter(&t_CurrentCountEvent1, t_ParentsCountEvent1);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
         {
-            /* This is a special case to protect against an infinite loop if a
-             * NULL ID is encountered. */
-            if (ITC_ID_IS_NULL_ID(pt_Id))
-            {
-                pt_PrevId = pt_Id;
+            t_CurrentCountEvent2 = pt_Event2->t_Count;
+            t_Status = incEventCounter(
+                &t_CurrentCountEvent2, t_ParentsCountEvent2);
+        }
 
-                pt_Id = pt_Id->pt_Parent;
-                pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        /* n1 <= n2 */
+        else if (!(t_CurrentCountEvent1 <= t_CurrentCountEvent2))
+        {
+            *pb_IsLeq = false;
+        }
+        /* Descend into left tree */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+        /* Unless the whole subtree is covered by a leaf of pt_Event2,
+         * in which case it is treated just like a leaf */
+        else if (pt_Event1->pt_Left &&
+                 !isEventSubtreeCovered(
+                     pt_Event1,
+                     t_CurrentCountEvent1,
+                     pt_Event2,
+                     t_CurrentCountEvent2))
+#else
+        else if (pt_Event1->pt_Left)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+        {
+            /* The stack is full. Let the caller fall back to climbing the
+             * trees */
+            if (u32_StackLength == ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH)
+            {
+                *pb_IsDone = false;
             }
-            /* grow(1, n) or grow(i, n) */
-            else if (ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent))
+            else
             {
-                /* grow(1, n) = (n + 1, 0) */
-                if (ITC_ID_IS_SEED_ID(pt_Id))
-                {
-                    t_Status = incEventCounter(&pt_CurrentEvent->t_Count, 1);
-
-                    if (t_Status == ITC_STATUS_SUCCESS)
-                    {
-                        pt_PrevId = pt_Id;
-
-                        /* This case has no cost */
+                /* Increment the parent heights */
+                t_Status = incEventCounter(
+                    &t_ParentsCountEvent1, pt_Event1->t_Count);
 
-                        pt_Id = pt_Id->pt_Parent;
-                        pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
-                    }
+                if (t_Status == ITC_STATUS_SUCCESS && pt_Event2->pt_Left)
+                {
+                    t_Status = incEventCounter(
+                        &t_ParentsCountEvent2, pt_Event2->t_Count);
                 }
-                /* grow(i, n) = (e', c + N) */
-                else
+
+                if (t_Status == ITC_STATUS_SUCCESS)
                 {
-                    /* Expand the event tree by adding 2 child nodes */
-                    t_Status = createChildEventNodes(pt_CurrentEvent, 0, 0);
+                    /* Remember the right subtrees */
+                    pt_Frame = &gt_ItcEventTraversalStack[u32_StackLength];
+                    u32_StackLength++;
 
-                    if (t_Status == ITC_STATUS_SUCCESS)
-                    {
-                        pt_PrevId = pt_Id;
+                    pt_Frame->pt_Event1 = pt_Event1->pt_Right;
+                    pt_Frame->t_ParentsCountEvent1 = t_ParentsCountEvent1;
+                    pt_Frame->t_ParentsCountEvent2 = t_ParentsCountEvent2;
 
-                        /* This cost is equvalent to a `shift` operation on a
-                         * list of 32-bit integers in lexicographic order, as
-                         * long as the tree height is less than UINT32_MAX */
-                        *pu64_CostPtr += UINT32_MAX;
+                    pt_Event1 = pt_Event1->pt_Left;
 
-                        /* Don't go up back the tree. Instead run through the
-                         * cases again with e' (a parent node) */
+                    /* If pt_Event2 has a left node - descend down.
+                     * Otherwise, its leaf is held for both subtrees of
+                     * pt_Event1 */
+                    if (pt_Event2->pt_Left)
+                    {
+                        pt_Frame->pt_Event2 = pt_Event2->pt_Right;
+                        pt_Event2 = pt_Event2->pt_Left;
+                    }
+                    else
+                    {
+                        pt_Frame->pt_Event2 = pt_Event2;
                     }
                 }
             }
-            /* grow((0, ir), (n, el, er)):
-             * ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er) */
-            else if (ITC_ID_IS_NULL_ID(pt_Id->pt_Left))
-            {
-                /* (er', cr) = grow(ir, er) */
-                if (pt_PrevId != pt_Id->pt_Right)
-                {
-                    pt_PrevId = pt_Id;
+        }
+        /* Jump straight to the last right subtree that has not been explored
+         * yet */
+        else if (u32_StackLength)
+        {
+            u32_StackLength--;
+            pt_Frame = &gt_ItcEventTraversalStack[u32_StackLength];
 
-                    pt_Id = pt_Id->pt_Right;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Right;
-                    pu64_CostPtr = &u64_CostRight;
-                }
-                /* ((n, el, er'), cr + 1) */
-                else
-                {
-                    pt_PrevId = pt_Id;
+            pt_Event1 = pt_Frame->pt_Event1;
+            pt_Event2 = pt_Frame->pt_Event2;
+            t_ParentsCountEvent1 = pt_Frame->t_ParentsCountEvent1;
+            t_ParentsCountEvent2 = pt_Frame->t_ParentsCountEvent2;
+        }
+        /* The tree has been fully explored. Exit loop */
+        else
+        {
+            pt_Event1 = NULL;
+        }
+    }
 
-                    u64_CostRight++;
+    return t_Status;
+}
 
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
-                }
+/**
+ * @brief Check if two Events are `<=` to each other in both directions,
+ * fulfilling `leq(e1, e2)` and `leq(e2, e1)` in a single traversal, using the
+ * explicit traversal stack
+ *
+ * For the rules see ::leqBidirectionalEventE(). The right subtrees are pushed
+ * to the explicit stack with their lifted event counts when descending, so the
+ * Event trees are not climbed back up through their `pt_Parent` back-links. If
+ * the trees are deeper than the stack, the traversal is abandoned and
+ * `*pb_IsDone` is set to `false`.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pb_IsLeq12 (out) `true` if `*pt_Event1 <= *pt_Event2`. Otherwise
+ * `false`
+ * @param pb_IsLeq21 (out) `true` if `*pt_Event2 <= *pt_Event1`. Otherwise
+ * `false`
+ * @param pb_IsDone (out) `true` if the traversal was completed. Otherwise
+ * `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t leqBidirectionalEventWithStackE(
+    const ITC_Event_t *pt_Event1,
+    const ITC_Event_t *pt_Event2,
+    bool *const pb_IsLeq12,
+    bool *const pb_IsLeq21,
+    bool *const pb_IsDone
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_TraversalFrame_t *pt_Frame;
+    uint32_t u32_StackLength = 0;
+
+    /* Holds the event count from the root to the current parent node */
+    ITC_Event_Counter_t t_ParentsCountEvent1 = 0;
+    ITC_Event_Counter_t t_ParentsCountEvent2 = 0;
+
+    /* Holds the total current event count
+     * (pt_EventX->t_Count + t_ParentsCountEventX) */
+    ITC_Event_Counter_t t_CurrentCountEvent1 = 0;
+    ITC_Event_Counter_t t_CurrentCountEvent2 = 0;
+
+    /* Whether the current nodes are held, due to the tree branch of the other
+     * Event being deeper. At most one of these can be `true` at any time */
+    bool b_IsHeldEvent1 = false;
+    bool b_IsHeldEvent2 = false;
+
+    /* Whether the current nodes must be descended into */
+    bool b_DescendEvent1;
+    bool b_DescendEvent2;
+
+    /* Init flags */
+    *pb_IsLeq12 = true;
+    *pb_IsLeq21 = true;
+    *pb_IsDone = true;
+
+    /* Perform a pre-order traversal of the union of both Event trees.
+     *
+     * Exit early if both checks have failed */
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           (*pb_IsLeq12 || *pb_IsLeq21) &&
+           *pb_IsDone &&
+           pt_Event1)
+    {
+        /* Calculate the total current event count for both Event trees */
+        t_CurrentCountEvent1 = pt_Event1->t_Count;
+        t_Status = incEventCounter(&t_CurrentCountEvent1, t_ParentsCountEvent1);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_CurrentCountEvent2 = pt_Event2->t_Count;
+            t_Status = incEventCounter(
+                &t_CurrentCountEvent2, t_ParentsCountEvent2);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* n1 <= n2, unless pt_Event1 is held */
+            if (!b_IsHeldEvent1)
+            {
+                *pb_IsLeq12 =
+                    *pb_IsLeq12 && t_CurrentCountEvent1 <= t_CurrentCountEvent2;
             }
-            /* grow((il, 0), (n, el, er)):
-             * ((n, el', er), cl + 1), where (el', cl) = grow(il, el) */
-            else if (ITC_ID_IS_NULL_ID(pt_Id->pt_Right))
+
+            /* n2 <= n1, unless pt_Event2 is held */
+            if (!b_IsHeldEvent2)
             {
-                /* (el', cl) = grow(il, el) */
-                if (pt_PrevId != pt_Id->pt_Left)
-                {
-                    pt_PrevId = pt_Id;
+                *pb_IsLeq21 =
+                    *pb_IsLeq21 && t_CurrentCountEvent2 <= t_CurrentCountEvent1;
+            }
+        }
 
-                    pt_Id = pt_Id->pt_Left;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Left;
-                    pu64_CostPtr = &u64_CostLeft;
+        /* Only descend into the subtrees that are not held */
+        b_DescendEvent1 = !b_IsHeldEvent1 && pt_Event1->pt_Left;
+        b_DescendEvent2 = !b_IsHeldEvent2 && pt_Event2->pt_Left;
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+        if (b_DescendEvent1 &&
+            isEventSubtreeCovered(
+                pt_Event1,
+                t_CurrentCountEvent1,
+                pt_Event2,
+                t_CurrentCountEvent2))
+        {
+            b_DescendEvent1 = false;
+        }
+        else if (b_DescendEvent2 &&
+                 isEventSubtreeCovered(
+                     pt_Event2,
+                     t_CurrentCountEvent2,
+                     pt_Event1,
+                     t_CurrentCountEvent1))
+        {
+            b_DescendEvent2 = false;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+        if (t_Status != ITC_STATUS_SUCCESS || !(*pb_IsLeq12 || *pb_IsLeq21))
+        {
+            /* Nothing to do */
+        }
+        /* Descend into the left trees */
+        else if (b_DescendEvent1 || b_DescendEvent2)
+        {
+            /* The stack is full. Let the caller fall back to climbing the
+             * trees */
+            if (u32_StackLength == ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH)
+            {
+                *pb_IsDone = false;
+            }
+            else
+            {
+                /* Increment the parent heights */
+                if (b_DescendEvent1)
+                {
+                    t_Status = incEventCounter(
+                        &t_ParentsCountEvent1, pt_Event1->t_Count);
                 }
-                /* ((n, el', er), cl + 1) */
+
+                if (t_Status == ITC_STATUS_SUCCESS && b_DescendEvent2)
+                {
+                    t_Status = incEventCounter(
+                        &t_ParentsCountEvent2, pt_Event2->t_Count);
+                }
+
+                if (t_Status == ITC_STATUS_SUCCESS)
+                {
+                    /* Remember the right subtrees. Nodes that are not
+                     * descended into are held for both subtrees of the other
+                     * Event */
+                    pt_Frame = &gt_ItcEventTraversalStack[u32_StackLength];
+                    u32_StackLength++;
+
+                    if (b_DescendEvent1)
+                    {
+                        pt_Frame->pt_Event1 = pt_Event1->pt_Right;
+                        pt_Event1 = pt_Event1->pt_Left;
+                    }
+                    else
+                    {
+                        pt_Frame->pt_Event1 = pt_Event1;
+                        b_IsHeldEvent1 = true;
+                    }
+
+                    if (b_DescendEvent2)
+                    {
+                        pt_Frame->pt_Event2 = pt_Event2->pt_Right;
+                        pt_Event2 = pt_Event2->pt_Left;
+                    }
+                    else
+                    {
+                        pt_Frame->pt_Event2 = pt_Event2;
+                        b_IsHeldEvent2 = true;
+                    }
+
+                    pt_Frame->t_ParentsCountEvent1 = t_ParentsCountEvent1;
+                    pt_Frame->t_ParentsCountEvent2 = t_ParentsCountEvent2;
+                    pt_Frame->b_IsHeldEvent1 = b_IsHeldEvent1;
+                    pt_Frame->b_IsHeldEvent2 = b_IsHeldEvent2;
+                }
+            }
+        }
+        /* Both Events are leafs (or held nodes). Jump straight to the last
+         * right subtrees that have not been explored yet */
+        else if (u32_StackLength)
+        {
+            u32_StackLength--;
+            pt_Frame = &gt_ItcEventTraversalStack[u32_StackLength];
+
+            pt_Event1 = pt_Frame->pt_Event1;
+            pt_Event2 = pt_Frame->pt_Event2;
+            t_ParentsCountEvent1 = pt_Frame->t_ParentsCountEvent1;
+            t_ParentsCountEvent2 = pt_Frame->t_ParentsCountEvent2;
+            b_IsHeldEvent1 = pt_Frame->b_IsHeldEvent1;
+            b_IsHeldEvent2 = pt_Frame->b_IsHeldEvent2;
+        }
+        /* The trees have been fully explored. Exit loop */
+        else
+        {
+            pt_Event1 = NULL;
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH */
+
+/**
+ * @brief Check if one Event is `<=` to another, fulfilling `leq(e1, e2)`
+ * Rules:
+ *  - leq(n1, n2) = n1 <= n2
+ *  - leq(n1, (n2, l2, r2)) = n1 <= n2
+ *  - leq((n1, l1, r1), n2):
+ *       n1 <= n2 && leq(lift(l1, n1), n2) && leq(lift(r1, n1), n2)
+ *  - leq((n1, l1, r1), (n2, l2, r2)):
+ *       n1 <= n2 && leq(lift(l1, n1), lift(l2, n2)) && leq(lift(r1, n1), lift(r2, n2))
+ *
+ * If ::ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE is enabled, subtrees of
+ * `pt_Event1` covered by a leaf of `pt_Event2` are not walked.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pb_IsLeq (out) `true` if `*pt_Event1 <= *pt_Event2`. Otherwise `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t leqEventE(
+    const ITC_Event_t *pt_Event1,
+    const ITC_Event_t *pt_Event2,
+    bool *const pb_IsLeq
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    const ITC_Event_t *pt_CurrentEvent1Parent;
+    const ITC_Event_t *pt_RootEvent1Parent;
+
+    /* Holds the event count from the root to the current parent node */
+    ITC_Event_Counter_t t_ParentsCountEvent1 = 0;
+    ITC_Event_Counter_t t_ParentsCountEvent2 = 0;
+
+    /* Holds the total current event count
+     * (pt_EventX->t_Count + t_ParentsCountEventX) */
+    ITC_Event_Counter_t t_CurrentCountEvent1 = 0;
+    ITC_Event_Counter_t t_CurrentCountEvent2 = 0;
+
+    /* Keeps track of how many descends have been skipped by pt_Event2 due
+     * to its tree branch being shallower than the one in pt_Event1 */
+    uint32_t u32_CurrentEvent2DescendSkips = 0;
+
+#if ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH
+    bool b_IsDone; /* Whether the explicit stack was deep enough */
+#endif /* ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH */
+
+    /* Init flag */
+    *pb_IsLeq = true;
+
+    /* Remember the root parent Event as this might be a subtree */
+    pt_RootEvent1Parent = pt_Event1->pt_Parent;
+
+    pt_CurrentEvent1Parent = pt_RootEvent1Parent;
+
+#if ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH
+    t_Status = leqEventWithStackE(pt_Event1, pt_Event2, pb_IsLeq, &b_IsDone);
+
+    /* Only climb the trees if they are too deep for the explicit stack */
+    if (b_IsDone)
+    {
+        pt_Event1 = NULL;
+    }
+#endif /* ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH */
+
+    /* Perform a pre-order traversal.
+     *
+     * For `pt_Event1 <= pt_Event2` all `<=` checks must pass.
+     * If a check fails - exit early */
+    while (t_Status == ITC_STATUS_SUCCESS && *pb_IsLeq && pt_Event1)
+    {
+        /* Calculate the total current event count for both Event trees
+         *
+         * Essentially this is a `lift([lr]X, nX)` operation but
+         * doesn't modify the original Event trees */
+        t_CurrentCountEvent1 = pt_Event1->t_Count;
+        t_Status = incEventCounter(&t_CurrentCountEvent1, t_ParentsCountEvent1);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_CurrentCountEvent2 = pt_Event2->t_Count;
+            t_Status = incEventCounter(
+                &t_CurrentCountEvent2, t_ParentsCountEvent2);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* n1 <= n2 */
+            *pb_IsLeq = t_CurrentCountEvent1 <= t_CurrentCountEvent2;
+
+            if (*pb_IsLeq)
+            {
+                /* Descend into left tree */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+                /* Unless the whole subtree is covered by a leaf of pt_Event2,
+                 * in which case it is treated just like a leaf */
+                if (pt_Event1->pt_Left &&
+                    !isEventSubtreeCovered(
+                        pt_Event1,
+                        t_CurrentCountEvent1,
+                        pt_Event2,
+                        t_CurrentCountEvent2))
+#else
+                if (pt_Event1->pt_Left)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+                {
+                    /* Increment the parent height */
+                    t_Status = incEventCounter(
+                        &t_ParentsCountEvent1, pt_Event1->t_Count);
+
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        pt_Event1 = pt_Event1->pt_Left;
+
+                        /* If pt_Event2 has a left node - descend down */
+                        if (pt_Event2->pt_Left)
+                        {
+                            /* Increment the parent height */
+                            t_Status = incEventCounter(
+                                &t_ParentsCountEvent2,
+                                pt_Event2->t_Count);
+
+                            if (t_Status == ITC_STATUS_SUCCESS)
+                            {
+                                pt_Event2 = pt_Event2->pt_Left;
+                            }
+                        }
+                        /* Otherwise, keep track of how many times the descend
+                        * was skipped due to a shallow tree */
+                        else
+                        {
+                            u32_CurrentEvent2DescendSkips++;
+                        }
+                    }
+                }
+                /* Valid parent ITC Event trees always have both left and right
+                * nodes. Thus, there is no need to check if the current node
+                * doesn't have a left child but has a right one.
+                *
+                * Instead directly start backtracking up the tree */
                 else
                 {
-                    pt_PrevId = pt_Id;
+                    /* Get the current parent node */
+                    pt_CurrentEvent1Parent = pt_Event1->pt_Parent;
+
+                    /* Loop until the current node is no longer its
+                     * parent's right child node */
+                    while (t_Status == ITC_STATUS_SUCCESS &&
+                           pt_CurrentEvent1Parent != pt_RootEvent1Parent &&
+                           pt_CurrentEvent1Parent->pt_Right == pt_Event1)
+                    {
+                        pt_Event1 = pt_Event1->pt_Parent;
+                        pt_CurrentEvent1Parent =
+                            pt_CurrentEvent1Parent->pt_Parent;
+
+                        /* Decrement the parent height */
+                        t_Status = decEventCounter(
+                            &t_ParentsCountEvent1, pt_Event1->t_Count);
+
+                        if (t_Status == ITC_STATUS_SUCCESS)
+                        {
+                            /* Decrement the amount of skipped descends */
+                            if (u32_CurrentEvent2DescendSkips)
+                            {
+                                u32_CurrentEvent2DescendSkips--;
+                            }
+                            /* If no descends were skipped - start backtracking
+                            * up the pt_Event2 tree.
+                            * There is no need to check if the current pt_Event2
+                            * is it's parent's right child, because its descend
+                            * is tied to the descends of pt_Event1 */
+                            else
+                            {
+                                pt_Event2 = pt_Event2->pt_Parent;
+
+                                /* Decrement the parent height */
+                                t_Status = decEventCounter(
+                                    &t_ParentsCountEvent2,
+                                    pt_Event2->t_Count);
+                            }
+                        }
+                    }
+
+                    /* There is a right subtree that has not been explored
+                    * yet */
+                    if (pt_CurrentEvent1Parent != pt_RootEvent1Parent)
+                    {
+                        /* Jump from the left node of the current parent to
+                         * right one */
+                        pt_Event1 = pt_CurrentEvent1Parent->pt_Right;
+
+                        /* Do the same for pt_Event2 if it hasn't skipped
+                         * any descends due to its tree being shallow */
+                        if(!u32_CurrentEvent2DescendSkips)
+                        {
+                            pt_Event2 = pt_Event2->pt_Parent->pt_Right;
+                        }
+                    }
+                    /* The tree has been fully explored. Exit loop */
+                    else
+                    {
+                        pt_Event1 = NULL;
+                    }
+                }
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Check if two Events are `<=` to each other in both directions,
+ * fulfilling `leq(e1, e2)` and `leq(e2, e1)` in a single traversal
+ *
+ * For the rules see ::leqEventE(). Both Event trees are walked together in
+ * pre-order. When one tree branch is shallower than the other, its leaf is
+ * held until the deeper branch has been fully explored. Each leaf only takes
+ * part in the checks in which it is on the left-hand side, i.e.
+ * `leq(n1, (n2, l2, r2))` only checks `n1 <= n2`.
+ *
+ * The traversal stops as soon as both checks have failed. If
+ * ::ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE is enabled, subtrees covered by a
+ * leaf of the other Event are not walked.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pb_IsLeq12 (out) `true` if `*pt_Event1 <= *pt_Event2`. Otherwise
+ * `false`
+ * @param pb_IsLeq21 (out) `true` if `*pt_Event2 <= *pt_Event1`. Otherwise
+ * `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t leqBidirectionalEventE(
+    const ITC_Event_t *pt_Event1,
+    const ITC_Event_t *pt_Event2,
+    bool *const pb_IsLeq12,
+    bool *const pb_IsLeq21
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    /* Remember the root parent Events as these might be subtrees */
+    const ITC_Event_t *const pt_RootEvent1Parent = pt_Event1->pt_Parent;
+    const ITC_Event_t *const pt_RootEvent2Parent = pt_Event2->pt_Parent;
+
+    /* The Event that is currently driving the traversal. This is always the
+     * one that has not skipped any descends */
+    const ITC_Event_t *pt_CurrentEvent;
+
+    /* Holds the event count from the root to the current parent node */
+    ITC_Event_Counter_t t_ParentsCountEvent1 = 0;
+    ITC_Event_Counter_t t_ParentsCountEvent2 = 0;
+
+    /* Holds the total current event count
+     * (pt_EventX->t_Count + t_ParentsCountEventX) */
+    ITC_Event_Counter_t t_CurrentCountEvent1 = 0;
+    ITC_Event_Counter_t t_CurrentCountEvent2 = 0;
+
+    /* Keeps track of how many descends have been skipped by each Event due
+     * to its tree branch being shallower than the one in the other Event.
+     * At most one of these can be non-zero at any time */
+    uint32_t u32_CurrentEvent1DescendSkips = 0;
+    uint32_t u32_CurrentEvent2DescendSkips = 0;
+
+    /* Whether the current nodes must be descended into */
+    bool b_DescendEvent1;
+    bool b_DescendEvent2;
+
+#if ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH
+    bool b_IsDone; /* Whether the explicit stack was deep enough */
+#endif /* ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH */
+
+    /* Init flags */
+    *pb_IsLeq12 = true;
+    *pb_IsLeq21 = true;
+
+#if ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH
+    t_Status = leqBidirectionalEventWithStackE(
+        pt_Event1, pt_Event2, pb_IsLeq12, pb_IsLeq21, &b_IsDone);
+
+    /* Only climb the trees if they are too deep for the explicit stack.
+     * A check that has already failed stays failed */
+    if (b_IsDone)
+    {
+        pt_Event1 = NULL;
+    }
+#endif /* ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH */
+
+    /* Perform a pre-order traversal of the union of both Event trees.
+     *
+     * Exit early if both checks have failed */
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           (*pb_IsLeq12 || *pb_IsLeq21) &&
+           pt_Event1)
+    {
+        /* Calculate the total current event count for both Event trees
+         *
+         * Essentially this is a `lift([lr]X, nX)` operation but
+         * doesn't modify the original Event trees */
+        t_CurrentCountEvent1 = pt_Event1->t_Count;
+        t_Status = incEventCounter(&t_CurrentCountEvent1, t_ParentsCountEvent1);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_CurrentCountEvent2 = pt_Event2->t_Count;
+            t_Status = incEventCounter(
+                &t_CurrentCountEvent2, t_ParentsCountEvent2);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* n1 <= n2, unless pt_Event1 is a held leaf */
+            if (!u32_CurrentEvent1DescendSkips)
+            {
+                *pb_IsLeq12 =
+                    *pb_IsLeq12 && t_CurrentCountEvent1 <= t_CurrentCountEvent2;
+            }
+
+            /* n2 <= n1, unless pt_Event2 is a held leaf */
+            if (!u32_CurrentEvent2DescendSkips)
+            {
+                *pb_IsLeq21 =
+                    *pb_IsLeq21 && t_CurrentCountEvent2 <= t_CurrentCountEvent1;
+            }
+        }
+
+        /* Only descend into the subtrees that have not been skipped.
+         *
+         * A normalised subtree is never smaller than its root, so a subtree
+         * held against a leaf of the other Event only matters for one of the
+         * directions. If the cached maximum shows it passes as well, the
+         * subtree is treated just like a leaf */
+        b_DescendEvent1 = !u32_CurrentEvent1DescendSkips && pt_Event1->pt_Left;
+        b_DescendEvent2 = !u32_CurrentEvent2DescendSkips && pt_Event2->pt_Left;
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+        if (b_DescendEvent1 &&
+            isEventSubtreeCovered(
+                pt_Event1,
+                t_CurrentCountEvent1,
+                pt_Event2,
+                t_CurrentCountEvent2))
+        {
+            b_DescendEvent1 = false;
+        }
+        else if (b_DescendEvent2 &&
+                 isEventSubtreeCovered(
+                     pt_Event2,
+                     t_CurrentCountEvent2,
+                     pt_Event1,
+                     t_CurrentCountEvent1))
+        {
+            b_DescendEvent2 = false;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+        if (t_Status != ITC_STATUS_SUCCESS || !(*pb_IsLeq12 || *pb_IsLeq21))
+        {
+            /* Nothing to do */
+        }
+        /* Descend into the left trees */
+        else if (b_DescendEvent1 || b_DescendEvent2)
+        {
+            /* If pt_Event1 has a left node - descend down */
+            if (b_DescendEvent1)
+            {
+                /* Increment the parent height */
+                t_Status = incEventCounter(
+                    &t_ParentsCountEvent1, pt_Event1->t_Count);
+
+                if (t_Status == ITC_STATUS_SUCCESS)
+                {
+                    pt_Event1 = pt_Event1->pt_Left;
+                }
+            }
+            /* Otherwise, keep track of how many times the descend was
+             * skipped due to a shallow tree */
+            else
+            {
+                u32_CurrentEvent1DescendSkips++;
+            }
+
+            if (t_Status != ITC_STATUS_SUCCESS)
+            {
+                /* Nothing to do */
+            }
+            /* Do the same for pt_Event2 */
+            else if (b_DescendEvent2)
+            {
+                /* Increment the parent height */
+                t_Status = incEventCounter(
+                    &t_ParentsCountEvent2, pt_Event2->t_Count);
+
+                if (t_Status == ITC_STATUS_SUCCESS)
+                {
+                    pt_Event2 = pt_Event2->pt_Left;
+                }
+            }
+            else
+            {
+                u32_CurrentEvent2DescendSkips++;
+            }
+        }
+        /* Both Events are leafs (or held leafs). Start backtracking up the
+         * trees */
+        else
+        {
+            pt_CurrentEvent =
+                (u32_CurrentEvent1DescendSkips) ? pt_Event2 : pt_Event1;
+
+            /* Loop until the current node is no longer its parent's right
+             * child node */
+            while (t_Status == ITC_STATUS_SUCCESS &&
+                   pt_CurrentEvent->pt_Parent != pt_RootEvent1Parent &&
+                   pt_CurrentEvent->pt_Parent != pt_RootEvent2Parent &&
+                   pt_CurrentEvent->pt_Parent->pt_Right == pt_CurrentEvent)
+            {
+                /* A held leaf only needs to undo a skipped descend */
+                if (u32_CurrentEvent1DescendSkips)
+                {
+                    u32_CurrentEvent1DescendSkips--;
+                }
+                else
+                {
+                    pt_Event1 = pt_Event1->pt_Parent;
+
+                    /* Decrement the parent height */
+                    t_Status = decEventCounter(
+                        &t_ParentsCountEvent1, pt_Event1->t_Count);
+                }
+
+                if (t_Status != ITC_STATUS_SUCCESS)
+                {
+                    /* Nothing to do */
+                }
+                else if (u32_CurrentEvent2DescendSkips)
+                {
+                    u32_CurrentEvent2DescendSkips--;
+                }
+                else
+                {
+                    pt_Event2 = pt_Event2->pt_Parent;
+
+                    /* Decrement the parent height */
+                    t_Status = decEventCounter(
+                        &t_ParentsCountEvent2, pt_Event2->t_Count);
+                }
+
+                pt_CurrentEvent =
+                    (u32_CurrentEvent1DescendSkips) ? pt_Event2 : pt_Event1;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentEvent->pt_Parent != pt_RootEvent1Parent &&
+                pt_CurrentEvent->pt_Parent != pt_RootEvent2Parent)
+            {
+                /* Jump from the left node of the current parent to the right
+                 * one. Held leafs stay where they are */
+                if (!u32_CurrentEvent1DescendSkips)
+                {
+                    pt_Event1 = pt_Event1->pt_Parent->pt_Right;
+                }
+
+                if (!u32_CurrentEvent2DescendSkips)
+                {
+                    pt_Event2 = pt_Event2->pt_Parent->pt_Right;
+                }
+            }
+            /* The trees have been fully explored. Exit loop */
+            else
+            {
+                pt_Event1 = NULL;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Maximise an Event fulfilling `max(e)`
+ * Rules:
+ *  - max(n) = n
+ *  - max(n, e1, e2) = n + max(max(e1), max(e2))
+ *
+ * The resulting Event is always a leaf Event. If
+ * ::ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE is enabled, subtrees with a known
+ * maximum are not walked.
+ *
+ * @param pt_Event The Event to maximise
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t maxEventE(
+    ITC_Event_t *pt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    ITC_Event_t *pt_RootEventParent;
+
+    /* Remember the parent as this might be a subtree */
+    pt_RootEventParent = pt_Event->pt_Parent;
+
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event != pt_RootEventParent)
+    {
+        if (ITC_EVENT_IS_LEAF_EVENT(pt_Event))
+        {
+            /* The Event is maximised. Nothing to do. */
+            pt_Event = pt_Event->pt_Parent;
+        }
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+        /* The maximum is already known. Lift the root, destroy the
+         * subtrees */
+        else if (ITC_EVENT_HAS_KNOWN_CHILDREN_MAX(pt_Event))
+        {
+            t_Status = incEventCounter(
+                &pt_Event->t_Count, pt_Event->t_ChildrenMax);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = ITC_Event_destroy(&pt_Event->pt_Left);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = ITC_Event_destroy(&pt_Event->pt_Right);
+            }
+        }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event->pt_Left))
+        {
+            /* Explore left subtree */
+            pt_Event = pt_Event->pt_Left;
+        }
+        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event->pt_Right))
+        {
+            /* Explore right subtree */
+            pt_Event = pt_Event->pt_Right;
+        }
+        /* Both Event subtrees are leafs */
+        else
+        {
+            /* Maximise the Event count */
+            t_Status = liftDestroyDestroyEvent(pt_Event);
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Fill an Event, fulfilling `fill(i, e)`
+ * Rules:
+ *  - fill(0, e) = e
+ *  - fill(1, e) = max(e)
+ *  - fill(i, n) = n
+ *  - fill((1, ir), (n, el, er)):
+ *        norm((n, max(max(el), min(er')), er')), where er' = fill(ir, er)
+ *  - fill((il, 1), (n, el, er)):
+ *        norm((n, el', max(max(er), min(el')))), where el' = fill(il, el)
+ *  - fill((il, ir), (n, el, er)):
+ *        norm((n, fill(il, el), fill(ir, er)))
+ *
+ * @param ppt_Event The Event to fill
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param pb_WasFilled (out) Whether the event was filled or not. In some cases
+ * filling an Event (simplifying + inflating) is not possible
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t fillEventE(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *pt_Id,
+    bool *const pb_WasFilled
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* Clone of `*ppt_Event` - modifications will be done on the cloned event */
+    ITC_Event_t *pt_ClonedEvent = NULL;
+    ITC_Event_t *pt_CurrentEvent = *ppt_Event;
+    /* Remember the root parents as these might be Event or ID subtrees */
+    ITC_Event_t *pt_RootEventParent = (*ppt_Event)->pt_Parent;
+    ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent;
+
+    /* The previously iterated ID subtree.
+     * Used to keep track of which nodes have been explored */
+    const ITC_Id_t *pt_PrevId = NULL;
+
+    /* Init the flag */
+    *pb_WasFilled = false;
+
+    /* Clone the event */
+    t_Status = cloneEvent(
+        *ppt_Event,
+        &pt_ClonedEvent,
+        pt_RootEventParent,
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        while (t_Status == ITC_STATUS_SUCCESS &&
+               pt_CurrentEvent != pt_RootEventParent &&
+               pt_Id != pt_RootIdParent)
+        {
+            /* fill(0, e) = e or fill(i, n) = n */
+            if(ITC_ID_IS_NULL_ID(pt_Id) ||
+               ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent))
+            {
+                pt_PrevId = pt_Id;
+
+                /* Nothing to inflate. Go up the tree */
+                pt_Id = pt_Id->pt_Parent;
+                pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+            }
+            /* fill(1, e) = max(e) */
+            else if (ITC_ID_IS_SEED_ID(pt_Id))
+            {
+                pt_PrevId = pt_Id;
+
+                /* Maximise Event (turn it into a leaf) */
+                t_Status = maxEventE(pt_CurrentEvent);
+
+                if (t_Status == ITC_STATUS_SUCCESS)
+                {
+                    *pb_WasFilled = true;
+
+                    pt_Id = pt_Id->pt_Parent;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                }
+            }
+            /* fill((1, ir), (n, el, er)):
+             *     norm((n, max(max(el), min(er')), er')), where:
+             *         er' = fill(ir, er)
+             */
+            else if (ITC_ID_IS_SEED_ID(pt_Id->pt_Left))
+            {
+                /* er' = fill(ir, er) */
+                if (pt_PrevId != pt_Id->pt_Right)
+                {
+                    pt_PrevId = pt_Id;
+
+                    pt_Id = pt_Id->pt_Right;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+                }
+                /* norm((n, max(max(el), min(er')), er')) */
+                else
+                {
+                    /* el = max(el) */
+                    if (ITC_EVENT_IS_PARENT_EVENT(pt_CurrentEvent->pt_Left))
+                    {
+                        /* Turn el into a leaf Event */
+                        t_Status = maxEventE(pt_CurrentEvent->pt_Left);
+
+                        if (t_Status == ITC_STATUS_SUCCESS)
+                        {
+                            *pb_WasFilled = true;
+                        }
+                    }
+
+                    /* el = max(el, min(er')) */
+                    if (t_Status == ITC_STATUS_SUCCESS &&
+                        (pt_CurrentEvent->pt_Left->t_Count <
+                            pt_CurrentEvent->pt_Right->t_Count))
+                    {
+                        /* For a normalised Event: min((n, el, er)) = n */
+                        pt_CurrentEvent->pt_Left->t_Count =
+                            pt_CurrentEvent->pt_Right->t_Count;
+
+                        *pb_WasFilled = true;
+                    }
+
+                    /* norm((n, el, er')) */
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        t_Status = normEventE(pt_CurrentEvent);
+
+                        if (t_Status == ITC_STATUS_SUCCESS)
+                        {
+                            pt_PrevId = pt_Id;
+
+                            pt_Id = pt_Id->pt_Parent;
+                            pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                        }
+                    }
+                }
+            }
+            /* fill((il, 1), (n, el, er)):
+            *     norm((n, el', max(max(er), min(el')))), where:
+            *         el' = fill(il, el)
+            */
+            else if (ITC_ID_IS_SEED_ID(pt_Id->pt_Right))
+            {
+                /* el' = fill(il, el) */
+                if (pt_PrevId != pt_Id->pt_Left)
+                {
+                    pt_PrevId = pt_Id;
+
+                    pt_Id = pt_Id->pt_Left;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Left;
+                }
+                /* norm((n, el', max(max(er), min(el')))) */
+                else
+                {
+                    /* er = max(er) */
+                    if (ITC_EVENT_IS_PARENT_EVENT(pt_CurrentEvent->pt_Right))
+                    {
+                        /* Turn er into a leaf Event */
+                        t_Status = maxEventE(pt_CurrentEvent->pt_Right);
+
+                        if (t_Status == ITC_STATUS_SUCCESS)
+                        {
+                            *pb_WasFilled = true;
+                        }
+                    }
+
+                    /* er = max(er, min(el')) */
+                    if (t_Status == ITC_STATUS_SUCCESS &&
+                        (pt_CurrentEvent->pt_Right->t_Count <
+                            pt_CurrentEvent->pt_Left->t_Count))
+                    {
+                        /* For a normalised Event: min((n, el, er)) = n */
+                        pt_CurrentEvent->pt_Right->t_Count =
+                            pt_CurrentEvent->pt_Left->t_Count;
+
+                        *pb_WasFilled = true;
+                    }
+
+                    /* norm((n, el', er)) */
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        t_Status = normEventE(pt_CurrentEvent);
+
+                        if (t_Status == ITC_STATUS_SUCCESS)
+                        {
+                            pt_PrevId = pt_Id;
+
+                            pt_Id = pt_Id->pt_Parent;
+                            pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                        }
+                    }
+                }
+            }
+            /* fill((il, ir), (n, el, er)):
+            *     norm((n, fill(il, el), fill(ir, er)))
+            */
+            else
+            {
+                /* fill(il, el) */
+                if (pt_PrevId != pt_Id->pt_Left && pt_PrevId != pt_Id->pt_Right)
+                {
+                    pt_PrevId = pt_Id;
+
+                    pt_Id = pt_Id->pt_Left;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Left;
+                }
+                /* fill(ir, er) */
+                else if (pt_PrevId != pt_Id->pt_Right)
+                {
+                    pt_PrevId = pt_Id;
+
+                    pt_Id = pt_Id->pt_Right;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+                }
+                /* norm((n, el, er) */
+                else
+                {
+                    t_Status = normEventE(pt_CurrentEvent);
+
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        pt_PrevId = pt_Id;
+
+                        pt_Id = pt_Id->pt_Parent;
+                        pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                    }
+                }
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Destroy the cloned Event
+             * Ignore return statuses. There is nothing else to do if the
+             * destroy fails. Also it is more important to convey that the
+             * overall fill operation succeeded */
+            (void)ITC_Event_destroy(&pt_ClonedEvent);
+        }
+        else
+        {
+            /* Destroy the original Event
+            * Ignore return statuses. There is nothing else to do if the destroy
+            * fails. Also it is more important to convey why the fill operation
+            * failed */
+            (void)ITC_Event_destroy(ppt_Event);
+
+            /* Replace the original event with the clone */
+            *ppt_Event = pt_ClonedEvent;
+
+            /* Even though this value is not supposed to be used (since the
+             * status indicates a failure), ensure it is false */
+            *pb_WasFilled = false;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Grow an Event, fulfilling `grow(i, e)`
+ *
+ * Grow performs a dynamic programming based optimization to choose the
+ * inflation that can be performed, given the available ID tree, so as to
+ * minimize the cost (`c`) of the event tree growth. The cost of an Event tree
+ * growth is defined so that:
+ *  - incrementing an event counter is preferable over adding a node
+ *  - an operation near the root is preferable to one further away
+ *
+ * Rules (where `k` is the number of events to add, normally 1):
+ *  - grow(1, n) = (n + k, 0)
+ *  - grow(i, n) = (e', c + N), where:
+ *    - (e', c) = grow(i, (n, 0, 0))
+ *    - N is a constant, greater than the maximum tree depth that arises
+ *      Alternatively it could be implemented as a pair under
+ *      lexicographic order
+ *  - grow((0, ir), (n, el, er)):
+ *        ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er)
+ *  - grow((il, 0), (n, el, er)):
+ *        ((n, el', er), cl + 1), where (el', cl) = grow(il, el)
+ *  - grow((il, ir), (n, el, er)):
+ *    - If cl < cr:
+ *          ((n, el', er), cl + 1), where (el', cl) = grow(il, el)
+ *    - If cl >= cr:
+ *          ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er)
+ *
+ * @param ppt_Event The Event to grow
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param t_EventCount The number of events to add (`k`)
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t growEventE(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *pt_Id,
+    const ITC_Event_Counter_t t_EventCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* Clone of `*ppt_Event` - modifications will be done on the cloned event */
+    ITC_Event_t *pt_ClonedEvent = NULL;
+    ITC_Event_t *pt_CurrentEvent = *ppt_Event;
+    /* Remember the root parents as these might be Event or ID subtrees */
+    ITC_Event_t *pt_RootEventParent = (*ppt_Event)->pt_Parent;
+    ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent;
+
+    /* The previously iterated ID subtree.
+     * Used to keep track of which nodes have been explored */
+    const ITC_Id_t *pt_PrevId = NULL;
+
+    /* Use 64-bit counters to avoid having to use lexicographic order, which
+     * would require dynamically allocating a list of integers.
+     *
+     * Instead the node expansion cost (when performing `grow(i, n)`) is set to
+     * be `UINT32_MAX`. This is effectively the same as having a list of 32-bit
+     * integers in lexicographic order as long as the Event tree height is less
+     * than `UINT32_MAX`.
+     *
+     * For all practical purposes this should be orders of magnitde bigger than
+     * any encountered Event tree height. */
+    uint64_t u64_CostLeft = 0;
+    uint64_t u64_CostRight = 0;
+
+    /* Init the cost pointer with the `&u64_CostLeft`. This is because if
+     * `cl >= cr`, the right subtree must be expanded. Two cases exist:
+     *
+     * - If the initial `*ppt_Event` is *not* a leaf:
+     *   `u64_CostLeft == u64_CostRight == 0`, thus the right subtree will be
+     *   expanded on the first iteration of the loop.
+     *
+     *  - If the initial `*ppt_Event` is a leaf:
+     *    On the first iteration, `pt_CurrentEvent` will expanded into a parent
+     *    node(`grow(i, n) = (e', c + N), where (e', c) = grow(i, (n, 0, 0)))`).
+     *    Thus, on the second iteration `u64_CostLeft > u64_CostRight` will be
+     *    be true, which would again expand the right subtree. */
+    uint64_t *pu64_CostPtr = &u64_CostLeft;
+
+    /* Clone the event */
+    t_Status = cloneEvent(
+        *ppt_Event,
+        &pt_ClonedEvent,
+        pt_RootEventParent,
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        while (t_Status == ITC_STATUS_SUCCESS &&
+               pt_CurrentEvent != pt_RootEventParent &&
+               pt_Id != pt_RootIdParent)
+        {
+            /* This is a special case to protect against an infinite loop if a
+             * NULL ID is encountered. */
+            if (ITC_ID_IS_NULL_ID(pt_Id))
+            {
+                pt_PrevId = pt_Id;
+
+                pt_Id = pt_Id->pt_Parent;
+                pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+            }
+            /* grow(1, n) or grow(i, n) */
+            else if (ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent))
+            {
+                /* grow(1, n) = (n + k, 0) */
+                if (ITC_ID_IS_SEED_ID(pt_Id))
+                {
+                    t_Status = incEventCounter(
+                        &pt_CurrentEvent->t_Count, t_EventCount);
+
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        pt_PrevId = pt_Id;
+
+                        /* This case has no cost */
+
+                        pt_Id = pt_Id->pt_Parent;
+                        pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                    }
+                }
+                /* grow(i, n) = (e', c + N) */
+                else
+                {
+                    /* Expand the event tree by adding 2 child nodes */
+                    t_Status = createChildEventNodes(
+                        pt_CurrentEvent, 0, 0, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        pt_PrevId = pt_Id;
+
+                        /* This cost is equvalent to a `shift` operation on a
+                         * list of 32-bit integers in lexicographic order, as
+                         * long as the tree height is less than UINT32_MAX */
+                        *pu64_CostPtr += UINT32_MAX;
+
+                        /* Don't go up back the tree. Instead run through the
+                         * cases again with e' (a parent node) */
+                    }
+                }
+            }
+            /* grow((0, ir), (n, el, er)):
+             * ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er) */
+            else if (ITC_ID_IS_NULL_ID(pt_Id->pt_Left))
+            {
+                /* (er', cr) = grow(ir, er) */
+                if (pt_PrevId != pt_Id->pt_Right)
+                {
+                    pt_PrevId = pt_Id;
+
+                    pt_Id = pt_Id->pt_Right;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+                    pu64_CostPtr = &u64_CostRight;
+                }
+                /* ((n, el, er'), cr + 1) */
+                else
+                {
+                    pt_PrevId = pt_Id;
+
+                    u64_CostRight++;
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+                    updateEventChildrenMax(pt_CurrentEvent);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+                    pt_Id = pt_Id->pt_Parent;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                }
+            }
+            /* grow((il, 0), (n, el, er)):
+             * ((n, el', er), cl + 1), where (el', cl) = grow(il, el) */
+            else if (ITC_ID_IS_NULL_ID(pt_Id->pt_Right))
+            {
+                /* (el', cl) = grow(il, el) */
+                if (pt_PrevId != pt_Id->pt_Left)
+                {
+                    pt_PrevId = pt_Id;
+
+                    pt_Id = pt_Id->pt_Left;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Left;
+                    pu64_CostPtr = &u64_CostLeft;
+                }
+                /* ((n, el', er), cl + 1) */
+                else
+                {
+                    pt_PrevId = pt_Id;
+
+                    u64_CostLeft++;
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+                    updateEventChildrenMax(pt_CurrentEvent);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+                    pt_Id = pt_Id->pt_Parent;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                }
+            }
+            /* grow((il, ir), (n, el, er)):
+             *  - If cl < cr:
+             *    ((n, el', er), cl + 1), where (el', cl) = grow(il, el)
+             *  - If cl >= cr:
+             *    ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er) */
+            else
+            {
+                if (pt_PrevId != pt_Id->pt_Left && pt_PrevId != pt_Id->pt_Right)
+                {
+                    pt_PrevId = pt_Id;
+
+                    /* cl < cr; (el', cl) = grow(il, el) */
+                    if (u64_CostLeft < u64_CostRight)
+                    {
+                        pt_Id = pt_Id->pt_Left;
+                        pt_CurrentEvent = pt_CurrentEvent->pt_Left;
+                        pu64_CostPtr = &u64_CostLeft;
+                    }
+                    /* cl >= cr; (er', cr) = grow(ir, er) */
+                    else
+                    {
+                        pt_Id = pt_Id->pt_Right;
+                        pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+                        pu64_CostPtr = &u64_CostRight;
+                    }
+                }
+                else
+                {
+                    /* cl < cr; ((n, el', er), cl + 1) */
+                    if (pt_PrevId == pt_Id->pt_Left)
+                    {
+                        u64_CostLeft++;
+                    }
+                    /* cl >= cr; ((n, el, er'), cr + 1) */
+                    else
+                    {
+                        u64_CostRight++;
+                    }
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+                    updateEventChildrenMax(pt_CurrentEvent);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+                    pt_PrevId = pt_Id;
+
+                    pt_Id = pt_Id->pt_Parent;
+                    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+                }
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Destroy the cloned Event
+             * Ignore return statuses. There is nothing else to do if the
+             * destroy fails. Also it is more important to convey that the
+             * overall fill operation succeeded */
+            (void)ITC_Event_destroy(&pt_ClonedEvent);
+        }
+        else
+        {
+            /* Destroy the original Event
+            * Ignore return statuses. There is nothing else to do if the destroy
+            * fails. Also it is more important to convey why the grow operation
+            * failed */
+            (void)ITC_Event_destroy(ppt_Event);
+
+            /* Replace the original event with the clone */
+            *ppt_Event = pt_ClonedEvent;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Add a number of events to an Event by filling it once and then
+ * growing it, if necessary
+ *
+ * The fill accounts for a single event. The remaining events (or all of them,
+ * if filling was not possible) are added with a single grow, which bumps the
+ * inflated leaf by the number of remaining events.
+ *
+ * @param ppt_Event The Event to add the events to
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param t_EventCount The number of events to add. Must be `> 0`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t fillAndGrowEventE(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    const ITC_Event_Counter_t t_EventCount
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    bool b_WasFilled = false;
+
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_FILL);
+
+    t_Status = fillEventE(ppt_Event, pt_Id, &b_WasFilled);
+
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_EVENT_FILL,
+        (t_Status == ITC_STATUS_SUCCESS) ? countEventNodes(*ppt_Event) : 0);
+
+    /* The fill accounts for a single event */
+    if (t_Status == ITC_STATUS_SUCCESS && (!b_WasFilled || t_EventCount > 1))
+    {
+        ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_GROW);
+
+        t_Status = growEventE(
+            ppt_Event,
+            pt_Id,
+            (b_WasFilled) ? t_EventCount - 1 : t_EventCount);
+
+        ITC_PORT_TRACE_END(
+            ITC_PORT_TRACE_PHASE_EVENT_GROW,
+            (t_Status == ITC_STATUS_SUCCESS) ? countEventNodes(*ppt_Event) : 0);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Compact an Event by collapsing the subtrees fully owned by an ID,
+ * starting at a given depth
+ * Rules (where `d` is the depth of the Event node):
+ *  - compact(0, e) = e
+ *  - compact(i, n) = n
+ *  - compact(1, e) = max(e), if `d >= u32_MaxDepth`
+ *  - compact(1, (n, el, er)) = norm((n, compact(1, el), compact(1, er))),
+ *    if `d < u32_MaxDepth`
+ *  - compact((il, ir), (n, el, er)) =
+ *        norm((n, compact(il, el), compact(ir, er)))
+ *
+ * Collapsing a subtree owned by the ID into its maximum is the same inflation
+ * `fill(1, e) = max(e)` performs while adding an event. The compacted Event
+ * is therefore always `>=` the original one, and is only modified where the
+ * ID owns the interval. The Event is normalised on the way back up.
+ *
+ * @note The absolute event counts of the Event must be representable. See
+ * ::checkEventCountersE()
+ * @param pt_Event The Event to compact. Must be normalised
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param u32_MaxDepth The depth from which the owned subtrees are collapsed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t compactEventE(
+    ITC_Event_t *pt_Event,
+    const ITC_Id_t *pt_Id,
+    const uint32_t u32_MaxDepth
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    /* Remember the parent as this might be a subtree */
+    const ITC_Event_t *const pt_RootEventParent = pt_Event->pt_Parent;
+
+    /* The previously visited node */
+    const ITC_Event_t *pt_PrevEvent = pt_RootEventParent;
+    ITC_Event_t *pt_NextEvent;
+
+    /* The depth of the current Event node */
+    uint32_t u32_Depth = 0;
+    /* The depth of the current ID node. The ID stops following the Event once
+     * it reaches a leaf, which then covers the rest of the Event subtree */
+    uint32_t u32_IdDepth = 0;
+
+    /* Perform a post-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event != pt_RootEventParent)
+    {
+        pt_NextEvent = NULL;
+
+        /* compact(1, e) = max(e). Turn the owned subtree into a leaf */
+        if (pt_PrevEvent == pt_Event->pt_Parent &&
+            u32_Depth >= u32_MaxDepth &&
+            ITC_ID_IS_SEED_ID(pt_Id) &&
+            ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            t_Status = maxEventE(pt_Event);
+        }
+        /* compact(0, e) = e or compact(i, n) = n */
+        else if (ITC_ID_IS_NULL_ID(pt_Id) || ITC_EVENT_IS_LEAF_EVENT(pt_Event))
+        {
+            /* Nothing to compact */
+        }
+        /* Coming from the parent, descend into the left child */
+        else if (pt_PrevEvent == pt_Event->pt_Parent)
+        {
+            pt_NextEvent = pt_Event->pt_Left;
+        }
+        /* Coming from the left child, descend into the right child */
+        else if (pt_PrevEvent == pt_Event->pt_Left)
+        {
+            pt_NextEvent = pt_Event->pt_Right;
+        }
+        /* Both children are done. Normalise the node before climbing back */
+        else
+        {
+            t_Status = normEventE(pt_Event);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            if (pt_NextEvent)
+            {
+                /* Descend the ID along with the Event */
+                if (u32_IdDepth == u32_Depth && ITC_ID_IS_PARENT_ID(pt_Id))
+                {
+                    pt_Id = (pt_NextEvent == pt_Event->pt_Left)
+                        ? pt_Id->pt_Left
+                        : pt_Id->pt_Right;
+                    u32_IdDepth++;
+                }
+
+                u32_Depth++;
+            }
+            else
+            {
+                /* Climb the ID back along with the Event */
+                if (u32_IdDepth == u32_Depth)
+                {
+                    pt_Id = pt_Id->pt_Parent;
+                    u32_IdDepth--;
+                }
+
+                u32_Depth--;
+                pt_NextEvent = pt_Event->pt_Parent;
+            }
+
+            pt_PrevEvent = pt_Event;
+            pt_Event = pt_NextEvent;
+        }
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+
+/**
+ * @brief Get the lowest and highest absolute event count of an Event within
+ * each of the `2^u32_Depth` equally sized cells its interval is split into
+ *
+ * Leafs shallower than `u32_Depth` span several adjacent cells, while the
+ * subtrees deeper than `u32_Depth` fall within a single cell.
+ *
+ * @note The absolute event counts of the Event must have been checked with
+ * ::checkEventCountersE() beforehand
+ * @param pt_Event The Event
+ * @param u32_Depth The depth of the cells. Must be `< 32`
+ * @param pt_Min (out) The lowest absolute event count of each cell
+ * @param pt_Max (out) The highest absolute event count of each cell
+ */
+static void getEventCellBoundsE(
+    const ITC_Event_t *pt_Event,
+    const uint32_t u32_Depth,
+    ITC_Event_Counter_t *const pt_Min,
+    ITC_Event_Counter_t *const pt_Max
+)
+{
+    /* Remember the parent as this might be a subtree */
+    const ITC_Event_t *const pt_RootEventParent = pt_Event->pt_Parent;
+    /* The sum of the event counts of the ancestors of the current node */
+    ITC_Event_Counter_t t_Base = 0;
+    ITC_Event_Counter_t t_Value;
+    /* The path to the current node, truncated to `u32_Depth` steps */
+    uint32_t u32_Cell = 0;
+    uint32_t u32_NodeDepth = 0;
+    uint32_t u32_I;
+    uint32_t u32_End;
+
+    for (u32_I = 0; u32_I < (1U << u32_Depth); u32_I++)
+    {
+        pt_Min[u32_I] = (ITC_Event_Counter_t)~(ITC_Event_Counter_t)0;
+        pt_Max[u32_I] = 0;
+    }
+
+    /* Perform a pre-order traversal */
+    while (pt_Event != pt_RootEventParent)
+    {
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* Descend into left child */
+            t_Base += pt_Event->t_Count;
+
+            if (u32_NodeDepth < u32_Depth)
+            {
+                u32_Cell <<= 1U;
+            }
+
+            u32_NodeDepth++;
+            pt_Event = pt_Event->pt_Left;
+        }
+        else
+        {
+            t_Value = t_Base + pt_Event->t_Count;
+
+            /* A shallow leaf spans all the cells below it */
+            if (u32_NodeDepth < u32_Depth)
+            {
+                u32_I = u32_Cell << (u32_Depth - u32_NodeDepth);
+                u32_End = (u32_Cell + 1U) << (u32_Depth - u32_NodeDepth);
+            }
+            else
+            {
+                u32_I = u32_Cell;
+                u32_End = u32_Cell + 1U;
+            }
+
+            for (; u32_I < u32_End; u32_I++)
+            {
+                if (t_Value < pt_Min[u32_I])
+                {
+                    pt_Min[u32_I] = t_Value;
+                }
+
+                if (t_Value > pt_Max[u32_I])
+                {
+                    pt_Max[u32_I] = t_Value;
+                }
+            }
+
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_Event->pt_Parent != pt_RootEventParent &&
+                   pt_Event->pt_Parent->pt_Right == pt_Event)
+            {
+                pt_Event = pt_Event->pt_Parent;
+                t_Base -= pt_Event->t_Count;
+                u32_NodeDepth--;
+
+                if (u32_NodeDepth < u32_Depth)
+                {
+                    u32_Cell >>= 1U;
+                }
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_Event->pt_Parent != pt_RootEventParent)
+            {
+                pt_Event = pt_Event->pt_Parent->pt_Right;
+
+                if (u32_NodeDepth <= u32_Depth)
+                {
+                    u32_Cell |= 1U;
+                }
+            }
+            else
+            {
+                pt_Event = pt_RootEventParent;
+            }
+        }
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+
+/**
+ * @brief Calculate the number of bytes needed to serialise an Event counter
+ * in network-endian
+ *
+ * @param t_Counter The counter
+ * @param pu32_Size (out) The number of bytes needed. Always at least 1
+ */
+static void getEventCounterNetworkSize(
+    ITC_Event_Counter_t t_Counter,
+    uint32_t *const pu32_Size
+)
+{
+    uint32_t u32_BytesNeeded = 0;
+
+    /* Determine the bytes needed to serialise the counter */
+    do
+    {
+        t_Counter >>= 8U;
+        u32_BytesNeeded++;
+    } while (t_Counter != 0);
+
+    *pu32_Size = u32_BytesNeeded;
+}
+
+/**
+ * @brief Serialise an Event counter in network-endian
+ *
+ * @param t_Counter The counter to serialise
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t eventCounterToNetwork(
+    ITC_Event_Counter_t t_Counter,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The number of bytes needed to serialise the counter */
+    uint32_t u32_BytesNeeded;
+
+    getEventCounterNetworkSize(t_Counter, &u32_BytesNeeded);
+
+    if (u32_BytesNeeded > *pu32_BufferSize)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        /* Serialise in network-endian */
+        for (uint32_t u32_I = u32_BytesNeeded; u32_I > 0; u32_I--)
+        {
+            pu8_Buffer[u32_I - 1] = (uint8_t)(t_Counter & 0xFFU);
+            t_Counter >>= 8U;
+        }
+
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_BytesNeeded;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an Event counter from network-endian
+ *
+ * @param pu8_Buffer The buffer holding the serialised data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pt_Counter The pointer to the counter
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if
+ * `u32_BufferSize > sizeof(ITC_Event_Counter_t)`
+ */
+static ITC_Status_t eventCounterFromNetwork(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Event_Counter_t *const pt_Counter
+)
+{
+    if (u32_BufferSize > sizeof(ITC_Event_Counter_t))
+    {
+        /* The counter size is not supported on this platform */
+        return ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE;
+    }
+
+    /* Init the counter */
+    *pt_Counter = 0;
+
+    /* Deserialise from network-endian */
+    for (uint32_t u32_I = 0; u32_I < u32_BufferSize; u32_I++)
+    {
+        *pt_Counter <<= 8U;
+        *pt_Counter |= pu8_Buffer[u32_I];
+    }
+
+    return ITC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Serialise an existing ITC Event
+ *
+ * Data format:
+ *  - Byte 0: The major component of the version of the `libitc` library used to
+ *      serialise the data. Optional, can be ommitted.
+ *  - Bytes (0 - 1) - N (see above): The Event tree.
+ *    Each node of the Event tree is serialised in pre-order. I.e the root is
+ *    serialised first, followed by the left child, then the right child. Each
+ *    serialised node consists of:
+ *    - Byte 0: The Event node header.
+ *      Contains an `IS_PARENT` flag (bit 0), and the length of the encoded
+ *      event counter (bits 1 - 4). See define ITC_SERDES_CREATE_EVENT_HEADER.
+ *      If the node event counter is `0`, this length is also set to 0 and the
+ *      next field (shown below) is ommitted. Bits 5 - 7 are reserved and always
+ *      0.
+ *    - Bytes 1 - 4: The node event count.
+ *      Can be 0 - 4 bytes long. The length of this field is encoded in the
+ *      Event header (see above). Serialised in network-endian. Optional,
+ *      ommitted if the node event counter is 0.
+ *
+ * @param ppt_Event The pointer to the Event
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
+ * the output.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseEvent(
+    const ITC_Event_t *pt_Event,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize,
+    const bool b_AddVersion
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The parent of the current Event */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The parent of the root node */
+    const ITC_Event_t *pt_RootEventParent = NULL;
+    uint32_t u32_Offset = 0; /* The current offset */
+    uint32_t u32_CurrentEventCounterSize;
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootEventParent = pt_Event->pt_Parent;
+
+    if (b_AddVersion)
+    {
+        /* Prepend the lib version (provided by build system c args) */
+        pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+
+        /* Increment offset */
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    /* Perform a pre-order traversal */
+    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    {
+        if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        /* Serialise the Event counter */
+        else if (pt_Event->t_Count > 0)
+        {
+            /* Calculate the remaining space in the buffer, while leaving space
+             * for the header */
+            u32_CurrentEventCounterSize =
+                *pu32_BufferSize -
+                (u32_Offset + (uint32_t)sizeof(ITC_SerDes_Header_t));
+
+            /* Serialise the event counter */
+            t_Status = eventCounterToNetwork(
+                pt_Event->t_Count,
+                &pu8_Buffer[u32_Offset + sizeof(ITC_SerDes_Header_t)],
+                &u32_CurrentEventCounterSize);
+        }
+        /* Special case - the Event counter is 0, nothing to serialise */
+        else
+        {
+            u32_CurrentEventCounterSize = 0;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Create the header */
+            pu8_Buffer[u32_Offset] = ITC_SERDES_CREATE_EVENT_HEADER(
+                ITC_EVENT_IS_PARENT_EVENT(pt_Event),
+                u32_CurrentEventCounterSize);
+
+            /* Increment the offset */
+            u32_Offset += (uint32_t)sizeof(ITC_SerDes_Header_t) +
+                          u32_CurrentEventCounterSize;
+
+            /* Descend into left tree */
+            if (pt_Event->pt_Left)
+            {
+                pt_Event = pt_Event->pt_Left;
+            }
+            /* Valid parent ITC Event trees always have both left and right
+            * nodes. Thus, there is no need to check if the current node
+            * doesn't have a left child but has a right one.
+            *
+            * Instead directly start backtracking up the tree */
+            else
+            {
+                /* Remember the parent */
+                pt_CurrentEventParent = pt_Event->pt_Parent;
+
+                /* Loop until the current element is no longer reachable
+                * through the parent's right child */
+                while (pt_CurrentEventParent != pt_RootEventParent &&
+                    pt_CurrentEventParent->pt_Right == pt_Event)
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    pt_CurrentEventParent =
+                        pt_CurrentEventParent->pt_Parent;
+                }
+
+                /* There is a right subtree that has not been explored yet*/
+                if (pt_CurrentEventParent != pt_RootEventParent)
+                {
+                    pt_Event = pt_CurrentEventParent->pt_Right;
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Calculate the size of an existing ITC Event once serialised
+ *
+ * See ::serialiseEvent() for the data format.
+ *
+ * @param pt_Event The Event
+ * @param b_AddVersion Whether to account for the `ITC_VERSION_MAJOR` field
+ * @param pu32_Size (out) The size of the serialised Event in bytes
+ */
+static void getSerialisedEventSize(
+    const ITC_Event_t *pt_Event,
+    const bool b_AddVersion,
+    uint32_t *const pu32_Size
+)
+{
+    /* The parent of the current Event */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The parent of the root node */
+    const ITC_Event_t *pt_RootEventParent = NULL;
+    uint32_t u32_Size = (b_AddVersion) ? (uint32_t)ITC_VERSION_MAJOR_LEN : 0;
+    uint32_t u32_CurrentEventCounterSize;
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootEventParent = pt_Event->pt_Parent;
+
+    /* Perform a pre-order traversal */
+    while (pt_Event)
+    {
+        /* A 0 event counter is omitted */
+        if (pt_Event->t_Count > 0)
+        {
+            getEventCounterNetworkSize(
+                pt_Event->t_Count, &u32_CurrentEventCounterSize);
+        }
+        else
+        {
+            u32_CurrentEventCounterSize = 0;
+        }
+
+        u32_Size +=
+            (uint32_t)sizeof(ITC_SerDes_Header_t) + u32_CurrentEventCounterSize;
+
+        /* Descend into left tree */
+        if (pt_Event->pt_Left)
+        {
+            pt_Event = pt_Event->pt_Left;
+        }
+        /* Valid parent ITC Event trees always have both left and right
+         * nodes. Instead directly start backtracking up the tree */
+        else
+        {
+            /* Remember the parent */
+            pt_CurrentEventParent = pt_Event->pt_Parent;
+
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_CurrentEventParent != pt_RootEventParent &&
+                   pt_CurrentEventParent->pt_Right == pt_Event)
+            {
+                pt_Event = pt_Event->pt_Parent;
+                pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentEventParent != pt_RootEventParent)
+            {
+                pt_Event = pt_CurrentEventParent->pt_Right;
+            }
+            else
+            {
+                pt_Event = NULL;
+            }
+        }
+    }
+
+    *pu32_Size = u32_Size;
+}
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/**
+ * @brief Serialise an Event counter as an unsigned LEB128 number
+ *
+ * @param t_Counter The counter to serialise
+ * @param pt_Writer The bit stream to write the serialised counter to. If
+ * `NULL`, only the size is calculated
+ * @param pu32_BitCount (in) The current size of the bit stream in bits. (out)
+ * The size of the bit stream in bits, including the serialised counter
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t eventCounterToLeb128(
+    ITC_Event_Counter_t t_Counter,
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer,
+    uint32_t *const pu32_BitCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Group;
+
+    do
+    {
+        /* Take the next 7 least significant bits */
+        u32_Group = (uint32_t)(t_Counter & ITC_SERDES_LEB128_GROUP_VALUE_MASK);
+        t_Counter >>= ITC_SERDES_LEB128_GROUP_VALUE_LEN;
+
+        /* Flag that more groups follow */
+        if (t_Counter != 0)
+        {
+            u32_Group |= ITC_SERDES_LEB128_CONTINUATION_FLAG;
+        }
+
+        *pu32_BitCount += ITC_SERDES_LEB128_GROUP_LEN;
+
+        if (pt_Writer)
+        {
+            t_Status = ITC_SerDes_Util_writeBits(
+                pt_Writer, u32_Group, ITC_SERDES_LEB128_GROUP_LEN);
+        }
+    } while (t_Status == ITC_STATUS_SUCCESS && t_Counter != 0);
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an Event counter from an unsigned LEB128 number
+ *
+ * @param pt_Reader The bit stream holding the serialised counter
+ * @param pt_Counter (out) The counter
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the number is truncated or not
+ * minimally encoded
+ * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if the number does not
+ * fit into an `ITC_Event_Counter_t`
+ */
+static ITC_Status_t eventCounterFromLeb128(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    ITC_Event_Counter_t *const pt_Counter
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_Counter_t t_Counter = 0;
+    ITC_Event_Counter_t t_Value;
+    uint32_t u32_Shift = 0;
+    uint32_t u32_Group = ITC_SERDES_LEB128_CONTINUATION_FLAG;
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           (u32_Group & ITC_SERDES_LEB128_CONTINUATION_FLAG))
+    {
+        t_Status = ITC_SerDes_Util_readBits(
+            pt_Reader, &u32_Group, ITC_SERDES_LEB128_GROUP_LEN);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Value = u32_Group & ITC_SERDES_LEB128_GROUP_VALUE_MASK;
+
+            /* The group does not fit into the counter */
+            if (u32_Shift >= (sizeof(ITC_Event_Counter_t) * 8U) ||
+                ((t_Value << u32_Shift) >> u32_Shift) != t_Value)
+            {
+                t_Status = ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE;
+            }
+            /* A trailing empty group is never produced by the serialiser */
+            else if (u32_Group == 0 && u32_Shift > 0)
+            {
+                t_Status = ITC_STATUS_CORRUPT_EVENT;
+            }
+            else
+            {
+                t_Counter |= t_Value << u32_Shift;
+                u32_Shift += ITC_SERDES_LEB128_GROUP_VALUE_LEN;
+            }
+        }
+        /* The bit stream ended in the middle of the number */
+        else if (t_Status == ITC_STATUS_INSUFFICIENT_RESOURCES)
+        {
+            t_Status = ITC_STATUS_CORRUPT_EVENT;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pt_Counter = t_Counter;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Serialise an existing ITC Event in the compact format
+ *
+ * See ::ITC_SerDes_Util_serialiseEventCompact() for the data format.
+ *
+ * @param pt_Event The Event
+ * @param pt_Writer The bit stream to write the serialised Event to
+ * @param pu32_BitCount (out) The size of the serialised Event in bits. If
+ * `pt_Writer` is `NULL`, only the size is calculated
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseEventCompact(
+    const ITC_Event_t *pt_Event,
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer,
+    uint32_t *const pu32_BitCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The parent of the current Event */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The parent of the root node */
+    const ITC_Event_t *pt_RootEventParent = NULL;
+    uint32_t u32_BitCount = 0;
+    uint32_t u32_Flags;
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootEventParent = pt_Event->pt_Parent;
+
+    /* Perform a pre-order traversal */
+    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    {
+        u32_Flags =
+            ((ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+                ? ITC_SERDES_COMPACT_EVENT_IS_PARENT_FLAG : 0U) |
+            ((pt_Event->t_Count > 0)
+                ? ITC_SERDES_COMPACT_EVENT_HAS_COUNTER_FLAG : 0U);
+
+        u32_BitCount += ITC_SERDES_COMPACT_EVENT_FLAGS_LEN;
+
+        if (pt_Writer)
+        {
+            t_Status = ITC_SerDes_Util_writeBits(
+                pt_Writer, u32_Flags, ITC_SERDES_COMPACT_EVENT_FLAGS_LEN);
+        }
+
+        /* The counter is never 0, so encode `counter - 1` to make the most
+         * of each LEB128 group */
+        if (t_Status == ITC_STATUS_SUCCESS && pt_Event->t_Count > 0)
+        {
+            t_Status = eventCounterToLeb128(
+                pt_Event->t_Count - 1, pt_Writer, &u32_BitCount);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Descend into left tree */
+            if (pt_Event->pt_Left)
+            {
+                pt_Event = pt_Event->pt_Left;
+            }
+            /* Valid parent ITC Event trees always have both left and right
+             * nodes. Instead directly start backtracking up the tree */
+            else
+            {
+                /* Remember the parent */
+                pt_CurrentEventParent = pt_Event->pt_Parent;
+
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (pt_CurrentEventParent != pt_RootEventParent &&
+                       pt_CurrentEventParent->pt_Right == pt_Event)
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (pt_CurrentEventParent != pt_RootEventParent)
+                {
+                    pt_Event = pt_CurrentEventParent->pt_Right;
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && pu32_BitCount)
+    {
+        *pu32_BitCount = u32_BitCount;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an ITC Event in the compact format
+ *
+ * See ::ITC_SerDes_Util_serialiseEventCompact() for the data format.
+ *
+ * @param pt_Reader The bit stream holding the serialised Event
+ * @param ppt_Event The pointer to the deserialised Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the serialised Event is invalid
+ * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if an event counter does
+ * not fit into an `ITC_Event_Counter_t`
+ */
+static ITC_Status_t deserialiseEventCompact(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t **ppt_CurrentEvent = NULL; /* The current Event */
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    ITC_Event_Counter_t t_Count = 0;
+    uint32_t u32_Flags = 0;
+
+    *ppt_Event = NULL;
+    ppt_CurrentEvent = ppt_Event;
+
+    /* The tree is complete once the last leaf has been deserialised */
+    while (ppt_CurrentEvent && t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_readBits(
+            pt_Reader, &u32_Flags, ITC_SERDES_COMPACT_EVENT_FLAGS_LEN);
+
+        /* The bit stream ended before the tree was complete */
+        if (t_Status == ITC_STATUS_INSUFFICIENT_RESOURCES)
+        {
+            t_Status = ITC_STATUS_CORRUPT_EVENT;
+        }
+
+        t_Count = 0;
+
+        if (t_Status == ITC_STATUS_SUCCESS &&
+            (u32_Flags & ITC_SERDES_COMPACT_EVENT_HAS_COUNTER_FLAG))
+        {
+            t_Status = eventCounterFromLeb128(pt_Reader, &t_Count);
+
+            /* `counter - 1` is serialised */
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = incEventCounter(&t_Count, 1);
+
+                if (t_Status == ITC_STATUS_EVENT_COUNTER_OVERFLOW)
+                {
+                    t_Status = ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE;
+                }
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Create a new node */
+            t_Status = newEvent(
+                ppt_CurrentEvent,
+                pt_CurrentEventParent,
+                t_Count,
+                ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* If the current node is a parent - descend into left child */
+            if (u32_Flags & ITC_SERDES_COMPACT_EVENT_IS_PARENT_FLAG)
+            {
+                pt_CurrentEventParent = *ppt_CurrentEvent;
+                ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
+            }
+            else
+            {
+                /* Backtrack the tree until an unallocated right child is found
+                 * or there are no more parent nodes */
+                while (pt_CurrentEventParent && pt_CurrentEventParent->pt_Right)
+                {
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+                }
+
+                /* Descend into the unallocated right child of the parent.
+                 * If there isn't one, the tree is complete */
+                ppt_CurrentEvent = (pt_CurrentEventParent)
+                    ? &pt_CurrentEventParent->pt_Right
+                    : NULL;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check the deserialised Event is valid */
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an ITC Event in the compact format, prefixed with a
+ * version field
+ *
+ * @param pu8_Buffer The buffer holding the serialised Event data
+ * @param u32_BufferSize The size of the buffer in bytes. Must be `> 0`
+ * @param ppt_Event The pointer to the deserialised Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the serialised Event is invalid
+ */
+static ITC_Status_t deserialiseVersionedEventCompact(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_SerDes_Util_BitReader_t t_Reader = {
+        .pu8_Buffer = &pu8_Buffer[ITC_VERSION_MAJOR_LEN],
+        .u32_BufferSize = u32_BufferSize - (uint32_t)ITC_VERSION_MAJOR_LEN,
+        .u32_BitOffset = 0,
+    };
+
+    *ppt_Event = NULL;
+
+    t_Status = ITC_SerDes_Util_validateDesLibVersion(
+        pu8_Buffer[0] & (uint8_t)~ITC_SERDES_COMPACT_FORMAT_FLAG);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseEventCompact(&t_Reader, ppt_Event);
+    }
+
+    /* Check nothing but padding follows the Event */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        !ITC_SerDes_Util_isBitReaderAtEnd(&t_Reader))
+    {
+        t_Status = ITC_STATUS_CORRUPT_EVENT;
+
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/**
+ * @brief Calculate the length of an Event counter once serialised to ASCII
+ * string
+ *
+ * @param t_Count The event counter
+ * @param pu32_Length (out) The number of decimal digits of the counter
+ */
+static void getEventCounterStringLength(
+    ITC_Event_Counter_t t_Count,
+    uint32_t *const pu32_Length
+)
+{
+    uint32_t u32_Length = 1;
+
+    /* Strip two digits per division to halve the number of divisions */
+    while (t_Count >= 100)
+    {
+        t_Count /= 100;
+        u32_Length += 2;
+    }
+
+    if (t_Count >= 10)
+    {
+        u32_Length++;
+    }
+
+    *pu32_Length = u32_Length;
+}
+
+/**
+ * @brief Serialise an Event counter to ASCII string
+ *
+ * This function intentionally avoids using `sprintf` to improve portability
+ * and efficiency. The length of the output is calculated up front, which allows
+ * writing the digits right to left, two at a time, from a lookup table.
+ *
+ * @warning The resulting string is NOT NULL terminated.
+ * @param t_Count The event counter
+ * @param pc_Buffer The buffer where to write the data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t eventCounterToString(
+    ITC_Event_Counter_t t_Count,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    /* The ASCII digits of all numbers in the [0, 99] range */
+    static const char rc_DigitPairs[] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    uint32_t u32_Length;
+    uint32_t u32_Offset;
+    /* The offset of the current digit pair in the lookup table */
+    uint32_t u32_Pair;
+
+    getEventCounterStringLength(t_Count, &u32_Length);
+
+    /* Check there is space left in the buffer */
+    if (u32_Length > *pu32_BufferSize)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        u32_Offset = u32_Length;
+
+        /* Serialise the two least significant digits at a time */
+        while (t_Count >= 100)
+        {
+            u32_Pair = (uint32_t)(t_Count % 100) * 2;
+            t_Count /= 100;
+
+            u32_Offset -= 2;
+            pc_Buffer[u32_Offset] = rc_DigitPairs[u32_Pair];
+            pc_Buffer[u32_Offset + 1] = rc_DigitPairs[u32_Pair + 1];
+        }
+
+        /* Serialise the remaining 1 or 2 most significant digits */
+        if (t_Count >= 10)
+        {
+            u32_Pair = (uint32_t)t_Count * 2;
+
+            pc_Buffer[0] = rc_DigitPairs[u32_Pair];
+            pc_Buffer[1] = rc_DigitPairs[u32_Pair + 1];
+        }
+        else
+        {
+            pc_Buffer[0] = (char)('0' + (char)t_Count);
+        }
+
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Length;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Serialise an existing ITC Event to ASCII string
+ *
+ * @note The output buffer is always NULL-terminated
+ * @param ppt_Event The pointer to the Event
+ * @param pc_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes (including the NULL termination byte).
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseEventToString(
+    const ITC_Event_t *pt_Event,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The current Event node */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The root parent */
+    const ITC_Event_t *pt_RootEventParent = pt_Event->pt_Parent;
+    uint32_t u32_Offset = 0;
+    /* The size of the stringified current node event counter */
+    uint32_t u32_EventCounterSize = 0;
+
+    /* Ensure there is at least space for the NULL termination */
+    if (*pu32_BufferSize < 1)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event)
+    {
+        /* Check there is space left in the buffer, taking into account the
+         * NULL termination byte and bracket */
+        if (u32_Offset >= (*pu32_BufferSize - 1))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS && ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* Open a bracket to signify a parent node */
+            pc_Buffer[u32_Offset] = '(';
+            /* Increment the offset */
+            u32_Offset++;
+
+            /* Check there is space left in the buffer, taking into account the
+             * NULL termination byte and at least 1 digit event counter */
+             if (u32_Offset >= (*pu32_BufferSize - 1))
+             {
+                 t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+             }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Calculate the space left in the buffer, taking into account the
+             * NULL termination byte */
+            u32_EventCounterSize = *pu32_BufferSize - u32_Offset - 1;
+
+            /* Serialise the current node event counter */
+            t_Status = eventCounterToString(
+                pt_Event->t_Count,
+                &pc_Buffer[u32_Offset],
+                &u32_EventCounterSize);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += u32_EventCounterSize;
+
+            /* If this is a parent, check there is space left in the buffer,
+             * taking into account the NULL termination byte, and the space for
+             * the extra comma and space */
+            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) &&
+                u32_Offset >= (*pu32_BufferSize - 2))
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+            {
+                /* Add a comma to separete the current node counter from
+                 * its children */
+                pc_Buffer[u32_Offset] = ',';
+                /* Increment the offset */
+                u32_Offset++;
+
+                /* Add space between the current node counter and child nodes */
+                pc_Buffer[u32_Offset] = ' ';
+                /* Increment the offset */
+                u32_Offset++;
+            }
+
+            /* Descend into left tree */
+            if (pt_Event->pt_Left)
+            {
+                /* Remember the parent address */
+                pt_CurrentEventParent = pt_Event;
+
+                pt_Event = pt_Event->pt_Left;
+            }
+            /* Valid parent ITC Event trees always have both left and right
+             * nodes. Thus, there is no need to check if the current node
+             * doesn't have a left child but has a right one.
+             *
+             * Instead directly start backtracking up the tree */
+            else
+            {
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (t_Status == ITC_STATUS_SUCCESS &&
+                       pt_CurrentEventParent != pt_RootEventParent &&
+                       pt_CurrentEventParent->pt_Right == pt_Event)
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte and bracket */
+                    if (u32_Offset >= (*pu32_BufferSize - 1))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Close the current parent node bracket */
+                        pc_Buffer[u32_Offset] = ')';
+                        /* Increment the offset */
+                        u32_Offset++;
+                    }
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    pt_CurrentEventParent != pt_RootEventParent)
+                {
+                    pt_Event = pt_CurrentEventParent->pt_Right;
+
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte, comma and space */
+                    if (u32_Offset >= (*pu32_BufferSize - 2))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Add a comma to signify the start of a new node */
+                        pc_Buffer[u32_Offset] = ',';
+                        /* Increment the offset */
+                        u32_Offset++;
+
+                        /* Add space between nodes */
+                        pc_Buffer[u32_Offset] = ' ';
+                        /* Increment the offset */
+                        u32_Offset++;
+                    }
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Ensure the string is always NULL-termiated */
+        pc_Buffer[u32_Offset] = '\0';
+        u32_Offset++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Calculate the length of an existing ITC Event once serialised to
+ * ASCII string
+ *
+ * See ::serialiseEventToString() for the data format.
+ *
+ * @param pt_Event The Event
+ * @param pu32_Length (out) The length of the string in bytes (including the
+ * NULL termination byte)
+ */
+static void getEventStringLength(
+    const ITC_Event_t *pt_Event,
+    uint32_t *const pu32_Length
+)
+{
+    /* The parent of the current Event */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The parent of the root node */
+    const ITC_Event_t *pt_RootEventParent = NULL;
+    /* Account for the NULL termination byte */
+    uint32_t u32_Length = 1;
+    uint32_t u32_CurrentEventCounterLength;
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootEventParent = pt_Event->pt_Parent;
+
+    /* Perform a pre-order traversal */
+    while (pt_Event)
+    {
+        getEventCounterStringLength(
+            pt_Event->t_Count, &u32_CurrentEventCounterLength);
+
+        u32_Length += u32_CurrentEventCounterLength;
+
+        /* Descend into left tree */
+        if (pt_Event->pt_Left)
+        {
+            u32_Length += ITC_SER_TO_STR_EVENT_PARENT_DELIMITERS_LEN;
+
+            pt_Event = pt_Event->pt_Left;
+        }
+        /* Valid parent ITC Event trees always have both left and right
+         * nodes. Instead directly start backtracking up the tree */
+        else
+        {
+            /* Remember the parent */
+            pt_CurrentEventParent = pt_Event->pt_Parent;
+
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_CurrentEventParent != pt_RootEventParent &&
+                   pt_CurrentEventParent->pt_Right == pt_Event)
+            {
+                pt_Event = pt_Event->pt_Parent;
+                pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentEventParent != pt_RootEventParent)
+            {
+                pt_Event = pt_CurrentEventParent->pt_Right;
+            }
+            else
+            {
+                pt_Event = NULL;
+            }
+        }
+    }
+
+    *pu32_Length = u32_Length;
+}
+
+/**
+ * @brief Serialise an existing ITC Event to ASCII string through a string sink
+ *
+ * Produces the same output as ::serialiseEventToString(), without the NULL
+ * termination byte.
+ *
+ * @param pt_Event The Event
+ * @param pt_Sink The sink. Not flushed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+static ITC_Status_t writeEventString(
+    const ITC_Event_t *pt_Event,
+    ITC_SerDes_Util_StringSink_t *const pt_Sink
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The current Event node */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The root parent */
+    const ITC_Event_t *pt_RootEventParent = pt_Event->pt_Parent;
+    /* The stringified current node event counter */
+    char rc_EventCounter[ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN];
+    /* The size of the stringified current node event counter */
+    uint32_t u32_EventCounterSize = 0;
+
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event)
+    {
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* Open a bracket to signify a parent node */
+            t_Status = ITC_SerDes_Util_appendToStringSink(pt_Sink, "(", 1);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            u32_EventCounterSize = ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN;
+
+            /* Serialise the current node event counter. Always fits */
+            t_Status = eventCounterToString(
+                pt_Event->t_Count,
+                &rc_EventCounter[0],
+                &u32_EventCounterSize);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_SerDes_Util_appendToStringSink(
+                pt_Sink, &rc_EventCounter[0], u32_EventCounterSize);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS &&
+            ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* Separate the current node counter from its children */
+            t_Status = ITC_SerDes_Util_appendToStringSink(pt_Sink, ", ", 2);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Descend into left tree */
+            if (pt_Event->pt_Left)
+            {
+                /* Remember the parent address */
+                pt_CurrentEventParent = pt_Event;
+
+                pt_Event = pt_Event->pt_Left;
+            }
+            /* Valid parent ITC Event trees always have both left and right
+             * nodes. Instead directly start backtracking up the tree */
+            else
+            {
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (t_Status == ITC_STATUS_SUCCESS &&
+                       pt_CurrentEventParent != pt_RootEventParent &&
+                       pt_CurrentEventParent->pt_Right == pt_Event)
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+
+                    /* Close the current parent node bracket */
+                    t_Status =
+                        ITC_SerDes_Util_appendToStringSink(pt_Sink, ")", 1);
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    pt_CurrentEventParent != pt_RootEventParent)
+                {
+                    pt_Event = pt_CurrentEventParent->pt_Right;
+
+                    /* Signify the start of a new node */
+                    t_Status =
+                        ITC_SerDes_Util_appendToStringSink(pt_Sink, ", ", 2);
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+
+/**
+ * @brief Deserialise an ITC Event
+ *
+ * For the expected data format see ::serialiseEvent()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Event data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @param ppt_Event The pointer to the deserialised Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t deserialiseEvent(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion,
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t **ppt_CurrentEvent = NULL; /* The current Event */
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    uint32_t u32_Offset = 0; /* The current offset */
+    uint32_t u32_CounterLen; /* The serialised Event counter length */
+    uint32_t u32_NextHeaderOffset; /* Used for serialisation data validation */
+    bool b_IsParent;
+
+    *ppt_Event = NULL;
+    ppt_CurrentEvent = ppt_Event;
+
+    /* If input contains a version check it matches the current lib version
+     * (provided by build system c args) */
+    if (b_HasVersion)
+    {
+        t_Status = ITC_SerDes_Util_validateDesLibVersion(
+            pu8_Buffer[u32_Offset]);
+
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Unknown node header value */
+        if (pu8_Buffer[u32_Offset] & ~ITC_SERDES_EVENT_HEADER_MASK)
+        {
+            t_Status = ITC_STATUS_CORRUPT_EVENT;
+        }
+        else
+        {
+            /* Get the node type */
+            b_IsParent = ITC_SERDES_EVENT_GET_IS_PARENT(pu8_Buffer[u32_Offset]);
+
+            /* Get the serialised Event counter length */
+            u32_CounterLen =
+                ITC_SERDES_EVENT_GET_COUNTER_LEN(pu8_Buffer[u32_Offset]);
+
+            /* Calculate the offset of the next node header */
+            u32_NextHeaderOffset =
+                u32_Offset + u32_CounterLen + sizeof(ITC_SerDes_Header_t);
+
+            /* Check for serialisation data validity:
+             * - Check there is enough data left in the buffer to deserialise
+             *   the current node
+             * - Check the last serialised node is not a parent
+             */
+            if ((u32_NextHeaderOffset > u32_BufferSize) ||
+                (b_IsParent && u32_NextHeaderOffset == u32_BufferSize))
+            {
+                t_Status = ITC_STATUS_CORRUPT_EVENT;
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Create a new node */
+            t_Status = newEvent(
+                ppt_CurrentEvent,
+                pt_CurrentEventParent,
+                0,
+                ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+            /* Special case - if the counter length is 0, then the
+             * serialised Event had an Event counter == 0 */
+            if (u32_CounterLen > 0)
+            {
+                /* Deserialise the event counter */
+                t_Status = eventCounterFromNetwork(
+                    &pu8_Buffer[u32_Offset],
+                    u32_CounterLen,
+                    &(*ppt_CurrentEvent)->t_Count);
+
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += u32_CounterLen;
+
+            /* If the current header was a parent - descend into left child */
+            if (b_IsParent)
+            {
+                pt_CurrentEventParent = *ppt_CurrentEvent;
+                ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
+            }
+            /* If the current header was a leaf - find the first unallocated
+             * right child node or error out if there isn't one */
+            else
+            {
+                /* Backtrack the tree until an unallocated right child is found
+                 * or there are no more parent nodes */
+                while (pt_CurrentEventParent && pt_CurrentEventParent->pt_Right)
+                {
+                    ppt_CurrentEvent = &pt_CurrentEventParent;
+                    pt_CurrentEventParent = (*ppt_CurrentEvent)->pt_Parent;
+                }
+
+                /* Descend into the unallocated right child of the parent */
+                if (pt_CurrentEventParent)
+                {
+                    ppt_CurrentEvent = &pt_CurrentEventParent->pt_Right;
+                }
+                /* There aren't any unallocated right child nodes in the tree.
+                 *
+                 * Usually this would signal the end of the loop as the only
+                 * time this should happen is when the full input buffer has
+                 * been deserialised (i.e.`u32_Offset == u32_BufferSize`),
+                 * since the tree is serialised in a pre-order traversal fasion.
+                 *
+                 * However, if the input buffer is malformed in some way it is
+                 * possible that there are elements in it that havent't been
+                 * deserialised yet (i.e. `u32_Offset < u32_BufferSize`).
+                 *
+                 * This should be treated as error as otherwise the user might
+                 * not get the expected (or full) Event tree. */
+                else if (u32_Offset < u32_BufferSize)
+                {
+                    t_Status = ITC_STATUS_CORRUPT_EVENT;
+                }
+                else
+                {
+                    /* Nothing to do */
+                }
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check the deserialised Event is valid */
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API || ITC_CONFIG_ENABLE_EVENT_REBASING
+
+/**
+ * @brief Move the tracked base node to the left or right child of the
+ * current base node
+ *
+ * If the current base node is a leaf, the walk continues below it and the
+ * depth below the leaf is tracked instead.
+ *
+ * @param pt_Base The tracked base node
+ * @param b_Left Whether to move to the left child. Otherwise moves to the right
+ * child
+ */
+static void descendEventDeltaBase(
+    ITC_Event_DeltaBase_t *const pt_Base,
+    const bool b_Left
+)
+{
+    if (ITC_EVENT_IS_PARENT_EVENT(pt_Base->pt_Node))
+    {
+        pt_Base->pt_Node =
+            (b_Left) ? pt_Base->pt_Node->pt_Left : pt_Base->pt_Node->pt_Right;
+    }
+    else
+    {
+        /* Remember the leaf the walk continues below */
+        if (pt_Base->pt_Node)
+        {
+            pt_Base->pt_Leaf = pt_Base->pt_Node;
+            pt_Base->pt_Node = NULL;
+        }
+
+        pt_Base->u32_Depth++;
+    }
+}
+
+/**
+ * @brief Move the tracked base node to its parent
+ *
+ * @param pt_Base The tracked base node
+ */
+static void ascendEventDeltaBase(
+    ITC_Event_DeltaBase_t *const pt_Base
+)
+{
+    if (pt_Base->u32_Depth > 0)
+    {
+        pt_Base->u32_Depth--;
+
+        /* Back at the base leaf */
+        if (pt_Base->u32_Depth == 0)
+        {
+            pt_Base->pt_Node = pt_Base->pt_Leaf;
+        }
+    }
+    else
+    {
+        pt_Base->pt_Node = pt_Base->pt_Node->pt_Parent;
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API || ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+
+/**
+ * @brief Subtract a base Event from an Event, or add it back, fulfilling
+ * `norm(e - b)` or `norm(e + b)`
+ *
+ * The Events are walked in lockstep, splitting the leafs of the Event
+ * wherever the base Event has a parent node, so that the base is constant
+ * within the interval of every leaf. Each leaf is then set to its absolute
+ * event count minus (or plus) the base count over its interval, and the
+ * parent nodes are normalised bottom-up once both of their children are done:
+ *  - If both children are leafs with the same count: `(0, m, m) = m`
+ *  - Otherwise: `(0, e1, e2) = (lift(0, m), sink(e1, m), sink(e2, m))`,
+ *    where `m = min(e1, e2)`
+ *
+ * @note The absolute event counts of both Events must have been checked with
+ * ::checkEventCountersE() beforehand. On failure, the Event is left partially
+ * rebased
+ * @param pt_Event The Event to rebase. Must not be shared
+ * @param pt_Base The base Event
+ * @param b_Restore Whether to add the base back. Otherwise it is subtracted
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_UNDERFLOW` if the base is not `<=` the
+ * Event
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of the
+ * restored Event cannot be represented
+ */
+static ITC_Status_t rebaseEventE(
+    ITC_Event_t *pt_Event,
+    const ITC_Event_t *const pt_Base,
+    const bool b_Restore
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* Remember the parent as this might be a subtree */
+    ITC_Event_t *const pt_RootEventParent = pt_Event->pt_Parent;
+    /* The previously visited node */
+    ITC_Event_t *pt_PrevEvent = pt_RootEventParent;
+    ITC_Event_t *pt_NextEvent;
+    /* The base node matching the current Event */
+    ITC_Event_DeltaBase_t t_Base = { pt_Base, NULL, 0 };
+    /* The sums of the event counts of the ancestors of the current node */
+    ITC_Event_Counter_t t_EventSum = 0;
+    ITC_Event_Counter_t t_BaseSum = 0;
+
+    /* Perform a post-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event != pt_RootEventParent)
+    {
+        pt_NextEvent = pt_Event->pt_Parent;
+
+        /* Coming from the parent */
+        if (pt_PrevEvent == pt_Event->pt_Parent)
+        {
+            /* Follow the shape of the base. Splitting a leaf into
+             * `(n, 0, 0)` does not change the Event */
+            if (ITC_EVENT_IS_LEAF_EVENT(pt_Event) &&
+                ITC_EVENT_IS_PARENT_EVENT(t_Base.pt_Node))
+            {
+                t_Status = createChildEventNodes(
+                    pt_Event, 0, 0, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+            }
+
+            if (t_Status != ITC_STATUS_SUCCESS)
+            {
+                /* Stop the walk */
+            }
+            /* Descend into the left child */
+            else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+            {
+                t_EventSum += pt_Event->t_Count;
+                t_BaseSum += (t_Base.pt_Node) ? t_Base.pt_Node->t_Count : 0;
+                descendEventDeltaBase(&t_Base, true);
+                pt_NextEvent = pt_Event->pt_Left;
+            }
+            /* The base is constant within the interval of the leaf. Replace
+             * the leaf with its absolute (rebased) event count */
+            else
+            {
+                pt_Event->t_Count += t_EventSum;
+
+                t_Status = (b_Restore)
+                    ? incEventCounter(
+                          &pt_Event->t_Count,
+                          t_BaseSum + ((t_Base.pt_Node)
+                                           ? t_Base.pt_Node->t_Count
+                                           : 0))
+                    : decEventCounter(
+                          &pt_Event->t_Count,
+                          t_BaseSum + ((t_Base.pt_Node)
+                                           ? t_Base.pt_Node->t_Count
+                                           : 0));
+            }
+        }
+        /* Coming from the left child, descend into the right child */
+        else if (pt_PrevEvent == pt_Event->pt_Left)
+        {
+            ascendEventDeltaBase(&t_Base);
+            descendEventDeltaBase(&t_Base, false);
+            pt_NextEvent = pt_Event->pt_Right;
+        }
+        /* Both children hold their absolute (rebased) event counts.
+         * Normalise the node and climb back */
+        else
+        {
+            ascendEventDeltaBase(&t_Base);
+            t_EventSum -= pt_Event->t_Count;
+            t_BaseSum -= (t_Base.pt_Node) ? t_Base.pt_Node->t_Count : 0;
+            pt_Event->t_Count = 0;
+
+            t_Status = (ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Left) &&
+                        ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Right) &&
+                        (pt_Event->pt_Left->t_Count ==
+                         pt_Event->pt_Right->t_Count))
+                           ? liftDestroyDestroyEvent(pt_Event)
+                           : liftSinkSinkEvent(pt_Event);
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+            pt_Event->b_IsDirty = false;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+            if (t_Status == ITC_STATUS_SUCCESS &&
+                ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+            {
+                updateEventChildrenMax(pt_Event);
+            }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+        }
+
+        pt_PrevEvent = pt_Event;
+        pt_Event = pt_NextEvent;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
+/**
+ * @brief Check whether two Event (sub)trees are identical
+ *
+ * Both trees must have the same shape and the same (relative) event counters
+ * in every node.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @return `true` if the Events are identical. Otherwise `false`
+ */
+static bool isEventSubtreeEqual(
+    const ITC_Event_t *pt_Event1,
+    const ITC_Event_t *pt_Event2
+)
+{
+    /* The parent of the current Event */
+    const ITC_Event_t *pt_CurrentEvent1Parent = NULL;
+    /* The parent of the root node */
+    const ITC_Event_t *pt_RootEvent1Parent = pt_Event1->pt_Parent;
+    bool b_IsEqual = true;
+
+    /* Perform a pre-order traversal of both trees. The trees have the same
+     * shape up to the current node, so they can be walked in lockstep */
+    while (pt_Event1 && b_IsEqual)
+    {
+        if (pt_Event1->t_Count != pt_Event2->t_Count ||
+            ITC_EVENT_IS_PARENT_EVENT(pt_Event1) !=
+                ITC_EVENT_IS_PARENT_EVENT(pt_Event2))
+        {
+            b_IsEqual = false;
+        }
+        /* Descend into left tree */
+        else if (pt_Event1->pt_Left)
+        {
+            pt_Event1 = pt_Event1->pt_Left;
+            pt_Event2 = pt_Event2->pt_Left;
+        }
+        else
+        {
+            /* Remember the parent */
+            pt_CurrentEvent1Parent = pt_Event1->pt_Parent;
+
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_CurrentEvent1Parent != pt_RootEvent1Parent &&
+                   pt_CurrentEvent1Parent->pt_Right == pt_Event1)
+            {
+                pt_Event1 = pt_Event1->pt_Parent;
+                pt_Event2 = pt_Event2->pt_Parent;
+                pt_CurrentEvent1Parent = pt_CurrentEvent1Parent->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentEvent1Parent != pt_RootEvent1Parent)
+            {
+                pt_Event1 = pt_CurrentEvent1Parent->pt_Right;
+                pt_Event2 = pt_Event2->pt_Parent->pt_Right;
+            }
+            else
+            {
+                pt_Event1 = NULL;
+            }
+        }
+    }
+
+    return b_IsEqual;
+}
+
+/**
+ * @brief Serialise the difference of an existing ITC Event to a base Event
+ *
+ * Data format:
+ *  - Byte 0: The major component of the version of the `libitc` library used to
+ *      serialise the data.
+ *  - Bytes 1 - N: The Event tree, serialised in pre-order in the same format as
+ *    ::serialiseEvent(). However, a node whose whole subtree is identical to the
+ *    subtree at the same position in the base Event is replaced with a single
+ *    ::ITC_SERDES_EVENT_DELTA_COPY_HEADER and its children are omitted.
+ *
+ * @note Comparing the subtrees costs `O(n * depth)` time in the worst case
+ *
+ * @param pt_Base The base Event
+ * @param pt_Event The Event
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseEventDelta(
+    const ITC_Event_t *const pt_Base,
+    const ITC_Event_t *pt_Event,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The parent of the current Event */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The base node matching the current Event */
+    ITC_Event_DeltaBase_t t_Base = { pt_Base, NULL, 0 };
+    uint32_t u32_Offset = 0; /* The current offset */
+    uint32_t u32_CurrentEventCounterSize = 0;
+    bool b_IsCopy = false;
+
+    /* Prepend the lib version (provided by build system c args) */
+    pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+
+    /* Increment offset */
+    u32_Offset += ITC_VERSION_MAJOR_LEN;
+
+    /* Perform a pre-order traversal */
+    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Unchanged subtrees are taken from the base */
+        b_IsCopy = t_Base.pt_Node &&
+                   isEventSubtreeEqual(pt_Event, t_Base.pt_Node);
+
+        if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        /* Serialise the Event counter */
+        else if (!b_IsCopy && pt_Event->t_Count > 0)
+        {
+            /* Calculate the remaining space in the buffer, while leaving space
+             * for the header */
+            u32_CurrentEventCounterSize =
+                *pu32_BufferSize -
+                (u32_Offset + (uint32_t)sizeof(ITC_SerDes_Header_t));
+
+            /* Serialise the event counter */
+            t_Status = eventCounterToNetwork(
+                pt_Event->t_Count,
+                &pu8_Buffer[u32_Offset + sizeof(ITC_SerDes_Header_t)],
+                &u32_CurrentEventCounterSize);
+        }
+        /* The Event counter is 0 or the node is copied, nothing to
+         * serialise */
+        else
+        {
+            u32_CurrentEventCounterSize = 0;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Create the header */
+            pu8_Buffer[u32_Offset] = (ITC_SerDes_Header_t)(
+                (b_IsCopy)
+                    ? ITC_SERDES_EVENT_DELTA_COPY_HEADER
+                    : ITC_SERDES_CREATE_EVENT_HEADER(
+                          ITC_EVENT_IS_PARENT_EVENT(pt_Event),
+                          u32_CurrentEventCounterSize));
+
+            /* Increment the offset */
+            u32_Offset += (uint32_t)sizeof(ITC_SerDes_Header_t) +
+                          u32_CurrentEventCounterSize;
+
+            /* Descend into left tree, unless the subtree has been copied */
+            if (!b_IsCopy && pt_Event->pt_Left)
+            {
+                pt_Event = pt_Event->pt_Left;
+                descendEventDeltaBase(&t_Base, true);
+            }
+            else
+            {
+                /* Remember the parent */
+                pt_CurrentEventParent = pt_Event->pt_Parent;
+
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (pt_CurrentEventParent &&
+                       pt_CurrentEventParent->pt_Right == pt_Event)
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+                    ascendEventDeltaBase(&t_Base);
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (pt_CurrentEventParent)
+                {
+                    pt_Event = pt_CurrentEventParent->pt_Right;
+                    ascendEventDeltaBase(&t_Base);
+                    descendEventDeltaBase(&t_Base, false);
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Rebuild an ITC Event from a base Event and a serialised delta
+ *
+ * For the expected data format see ::serialiseEventDelta()
+ *
+ * @param pt_Base The base Event the delta was serialised against
+ * @param pu8_Buffer The buffer holding the serialised delta
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param ppt_Event The pointer to the rebuilt Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the delta is invalid or does not match
+ * the shape of the base Event
+ */
+static ITC_Status_t applyEventDelta(
+    const ITC_Event_t *const pt_Base,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t **ppt_CurrentEvent = NULL; /* The current Event */
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The base node matching the current Event */
+    ITC_Event_DeltaBase_t t_Base = { pt_Base, NULL, 0 };
+    uint32_t u32_Offset = 0; /* The current offset */
+    uint32_t u32_CounterLen = 0; /* The serialised Event counter length */
+    bool b_IsParent = false;
+    bool b_IsCopy = false;
+
+    *ppt_Event = NULL;
+    ppt_CurrentEvent = ppt_Event;
+
+    /* Check the input matches the current lib version (provided by build
+     * system c args) */
+    t_Status = ITC_SerDes_Util_validateDesLibVersion(pu8_Buffer[u32_Offset]);
+
+    u32_Offset += ITC_VERSION_MAJOR_LEN;
+
+    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    {
+        b_IsCopy = pu8_Buffer[u32_Offset] == ITC_SERDES_EVENT_DELTA_COPY_HEADER;
+
+        if (b_IsCopy)
+        {
+            b_IsParent = false;
+            u32_CounterLen = 0;
+
+            /* There is nothing to copy below a base leaf */
+            if (!t_Base.pt_Node)
+            {
+                t_Status = ITC_STATUS_CORRUPT_EVENT;
+            }
+        }
+        /* Unknown node header value */
+        else if (pu8_Buffer[u32_Offset] & ~ITC_SERDES_EVENT_HEADER_MASK)
+        {
+            t_Status = ITC_STATUS_CORRUPT_EVENT;
+        }
+        else
+        {
+            b_IsParent = ITC_SERDES_EVENT_GET_IS_PARENT(pu8_Buffer[u32_Offset]);
+            u32_CounterLen =
+                ITC_SERDES_EVENT_GET_COUNTER_LEN(pu8_Buffer[u32_Offset]);
+        }
+
+        /* Check for serialisation data validity:
+         * - Check there is enough data left in the buffer to deserialise
+         *   the current node
+         * - Check the last serialised node is not a parent
+         */
+        if (t_Status == ITC_STATUS_SUCCESS &&
+            ((u32_Offset + u32_CounterLen + sizeof(ITC_SerDes_Header_t) >
+              u32_BufferSize) ||
+             (b_IsParent &&
+              (u32_Offset + u32_CounterLen + sizeof(ITC_SerDes_Header_t) ==
+               u32_BufferSize))))
+        {
+            t_Status = ITC_STATUS_CORRUPT_EVENT;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Copy the whole subtree from the base or create a new node */
+            t_Status = (b_IsCopy)
+                ? cloneEvent(
+                      t_Base.pt_Node,
+                      ppt_CurrentEvent,
+                      pt_CurrentEventParent,
+                      ITC_PORT_ALLOCTYPE_ITC_EVENT_T)
+                : newEvent(
+                      ppt_CurrentEvent,
+                      pt_CurrentEventParent,
+                      0,
+                      ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+            /* Special case - if the counter length is 0, then the
+             * serialised Event had an Event counter == 0 */
+            if (u32_CounterLen > 0)
+            {
+                /* Deserialise the event counter */
+                t_Status = eventCounterFromNetwork(
+                    &pu8_Buffer[u32_Offset],
+                    u32_CounterLen,
+                    &(*ppt_CurrentEvent)->t_Count);
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += u32_CounterLen;
+
+            /* If the current header was a parent - descend into left child */
+            if (b_IsParent)
+            {
+                pt_CurrentEventParent = *ppt_CurrentEvent;
+                ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
+                descendEventDeltaBase(&t_Base, true);
+            }
+            /* If the current header was a leaf or a copied subtree - find the
+             * first unallocated right child node */
+            else
+            {
+                /* Backtrack the tree until an unallocated right child is found
+                 * or there are no more parent nodes */
+                while (pt_CurrentEventParent && pt_CurrentEventParent->pt_Right)
+                {
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+                    ascendEventDeltaBase(&t_Base);
+                }
+
+                /* Descend into the unallocated right child of the parent */
+                if (pt_CurrentEventParent)
+                {
+                    ppt_CurrentEvent = &pt_CurrentEventParent->pt_Right;
+                    ascendEventDeltaBase(&t_Base);
+                    descendEventDeltaBase(&t_Base, false);
+                }
+                /* The tree is complete, but there is still data left in the
+                 * buffer */
+                else if (u32_Offset < u32_BufferSize)
+                {
+                    t_Status = ITC_STATUS_CORRUPT_EVENT;
+                }
+                else
+                {
+                    /* Nothing to do */
+                }
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check the rebuilt Event is valid */
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+/**
+ * @brief Read a single node of a serialised Event
+ *
+ * For the expected data format see ::serialiseEvent()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Event data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param u32_Offset The offset of the node header inside the buffer
+ * @param pb_IsParent (out) Whether the node is a parent node
+ * @param pt_Count (out) The (relative) event count of the node
+ * @param pu32_NodeLen (out) The size of the serialised node in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the node header is invalid or the node
+ * does not fit in the buffer
+ * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if the node counter
+ * does not fit in an `ITC_Event_Counter_t`
+ */
+static ITC_Status_t readSerialisedEventNode(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const uint32_t u32_Offset,
+    bool *const pb_IsParent,
+    ITC_Event_Counter_t *const pt_Count,
+    uint32_t *const pu32_NodeLen
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_CounterLen; /* The serialised Event counter length */
+
+    /* Unknown node header value */
+    if (pu8_Buffer[u32_Offset] & ~ITC_SERDES_EVENT_HEADER_MASK)
+    {
+        t_Status = ITC_STATUS_CORRUPT_EVENT;
+    }
+    else
+    {
+        *pb_IsParent = ITC_SERDES_EVENT_GET_IS_PARENT(pu8_Buffer[u32_Offset]);
+        u32_CounterLen =
+            ITC_SERDES_EVENT_GET_COUNTER_LEN(pu8_Buffer[u32_Offset]);
+        *pu32_NodeLen = u32_CounterLen + sizeof(ITC_SerDes_Header_t);
+
+        /* Check there is enough data left in the buffer for the node */
+        if (*pu32_NodeLen > (u32_BufferSize - u32_Offset))
+        {
+            t_Status = ITC_STATUS_CORRUPT_EVENT;
+        }
+        else
+        {
+            /* A counter length of 0 means an event counter of 0 */
+            t_Status = eventCounterFromNetwork(
+                &pu8_Buffer[u32_Offset + sizeof(ITC_SerDes_Header_t)],
+                u32_CounterLen,
+                pt_Count);
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Find the end of a serialised Event subtree
+ *
+ * @note The serialised Event must be valid. See ::validateSerialisedEvent()
+ * @param pu8_Buffer The buffer holding the serialised Event data
+ * @param pu32_Offset (in) The offset of the root node of the subtree. (out)
+ * The offset of the first node after the subtree
+ */
+static void skipSerialisedEventSubtree(
+    const uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_Offset
+)
+{
+    /* The number of subtrees that still need to be skipped */
+    uint32_t u32_Pending = 1;
+
+    while (u32_Pending)
+    {
+        if (ITC_SERDES_EVENT_GET_IS_PARENT(pu8_Buffer[*pu32_Offset]))
+        {
+            u32_Pending++;
+        }
+        else
+        {
+            u32_Pending--;
+        }
+
+        *pu32_Offset +=
+            (uint32_t)sizeof(ITC_SerDes_Header_t) +
+            ITC_SERDES_EVENT_GET_COUNTER_LEN(pu8_Buffer[*pu32_Offset]);
+    }
+}
+
+/**
+ * @brief Locate a node inside a serialised Event
+ *
+ * Serialised Event counts are relative to their parent, and the encoding holds
+ * no back-references. Thus, instead of keeping a stack of ancestors, the path
+ * to the node is rediscovered by descending from the root, skipping over any
+ * left subtrees that come before it. This needs no additional memory, at the
+ * cost of `O(n * depth)` time in the worst case.
+ *
+ * @note The serialised Event must be valid. See ::validateSerialisedEvent()
+ * @param pu8_Buffer The buffer holding the serialised Event data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param u32_Offset The offset of the node to locate
+ * @param pt_ParentsCount (out) The sum of the event counts of all ancestors of
+ * the node
+ * @param pu32_Depth (out) The depth of the node. The root has a depth of 0
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the ancestors event count
+ * cannot be represented
+ */
+static ITC_Status_t locateSerialisedEventNode(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const uint32_t u32_Offset,
+    ITC_Event_Counter_t *const pt_ParentsCount,
+    uint32_t *const pu32_Depth
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_CurrentOffset = 0; /* Start from the root */
+    uint32_t u32_RightOffset; /* The offset of the current right child */
+    uint32_t u32_NodeLen;
+    ITC_Event_Counter_t t_Count;
+    bool b_IsParent;
+
+    *pt_ParentsCount = 0;
+    *pu32_Depth = 0;
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_CurrentOffset != u32_Offset)
+    {
+        /* Every node on the path to the located node is a parent */
+        t_Status = readSerialisedEventNode(
+            pu8_Buffer,
+            u32_BufferSize,
+            u32_CurrentOffset,
+            &b_IsParent,
+            &t_Count,
+            &u32_NodeLen);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = incEventCounter(pt_ParentsCount, t_Count);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Descend into the left child and find its right sibling */
+            u32_CurrentOffset += u32_NodeLen;
+            u32_RightOffset = u32_CurrentOffset;
+            skipSerialisedEventSubtree(pu8_Buffer, &u32_RightOffset);
+
+            /* Continue into the right subtree if the node is in it */
+            if (u32_Offset >= u32_RightOffset)
+            {
+                u32_CurrentOffset = u32_RightOffset;
+            }
+
+            (*pu32_Depth)++;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Validate a serialised ITC Event without deserialising it
+ *
+ * Performs the same checks as ::deserialiseEvent(), including checking the
+ * Event is normalised.
+ *
+ * @param pu8_Buffer The buffer holding the serialised Event data (without the
+ * `ITC_VERSION_MAJOR` field)
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the serialised Event is invalid
+ * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if an event counter
+ * does not fit in an `ITC_Event_Counter_t`
+ */
+static ITC_Status_t validateSerialisedEvent(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Offset = 0; /* The current offset */
+    /* The number of subtrees that still need to be walked */
+    uint32_t u32_Pending = 1;
+    uint32_t u32_ChildOffset; /* The offset of the currently checked child */
+    uint32_t u32_NodeLen;
+    ITC_Event_Counter_t t_Count;
+    bool b_IsParent;
+
+    /* Check the tree structure is complete and has no trailing data */
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_Pending &&
+           u32_Offset < u32_BufferSize)
+    {
+        t_Status = readSerialisedEventNode(
+            pu8_Buffer,
+            u32_BufferSize,
+            u32_Offset,
+            &b_IsParent,
+            &t_Count,
+            &u32_NodeLen);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            u32_Pending = (b_IsParent) ? u32_Pending + 1 : u32_Pending - 1;
+            u32_Offset += u32_NodeLen;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        (u32_Pending || u32_Offset != u32_BufferSize))
+    {
+        t_Status = ITC_STATUS_CORRUPT_EVENT;
+    }
+
+    u32_Offset = 0;
+
+    /* Check every parent has at least one child with an event count of 0.
+     * The structure is now known to be valid, so subtrees can be skipped */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Offset < u32_BufferSize)
+    {
+        b_IsParent = ITC_SERDES_EVENT_GET_IS_PARENT(pu8_Buffer[u32_Offset]);
+        u32_Offset += (uint32_t)sizeof(ITC_SerDes_Header_t) +
+                      ITC_SERDES_EVENT_GET_COUNTER_LEN(pu8_Buffer[u32_Offset]);
+
+        /* Check the left child, and only if needed, the right one */
+        if (b_IsParent)
+        {
+            u32_ChildOffset = u32_Offset;
+
+            t_Status = readSerialisedEventNode(
+                pu8_Buffer,
+                u32_BufferSize,
+                u32_ChildOffset,
+                &b_IsParent,
+                &t_Count,
+                &u32_NodeLen);
+
+            if (t_Status == ITC_STATUS_SUCCESS && t_Count)
+            {
+                skipSerialisedEventSubtree(pu8_Buffer, &u32_ChildOffset);
+
+                t_Status = readSerialisedEventNode(
+                    pu8_Buffer,
+                    u32_BufferSize,
+                    u32_ChildOffset,
+                    &b_IsParent,
+                    &t_Count,
+                    &u32_NodeLen);
+
+                if (t_Status == ITC_STATUS_SUCCESS && t_Count)
+                {
+                    t_Status = ITC_STATUS_CORRUPT_EVENT;
+                }
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Check if one serialised Event is `<=` to another, fulfilling
+ * `leq(e1, e2)`, without deserialising either of them
+ *
+ * Mirrors ::leqEventE(). Both Events are walked in pre-order, with the second
+ * one holding its current node whenever its tree branch is shallower than the
+ * one of the first Event. When backtracking, the absolute parent event counts
+ * are recovered via ::locateSerialisedEventNode().
+ *
+ * @note Both serialised Events must be valid. See ::validateSerialisedEvent()
+ * @param pu8_Buffer1 The buffer holding the first serialised Event data
+ * @param u32_BufferSize1 The size of the first buffer in bytes
+ * @param pu8_Buffer2 The buffer holding the second serialised Event data
+ * @param u32_BufferSize2 The size of the second buffer in bytes
+ * @param pb_IsLeq (out) `true` if `Event1 <= Event2`. Otherwise `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count
+ * cannot be represented
+ */
+static ITC_Status_t leqSerialisedEventE(
+    const uint8_t *const pu8_Buffer1,
+    const uint32_t u32_BufferSize1,
+    const uint8_t *const pu8_Buffer2,
+    const uint32_t u32_BufferSize2,
+    bool *const pb_IsLeq
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Offset1 = 0;
+    uint32_t u32_Offset2 = 0;
+    /* The depth of the current nodes. `u32_Depth2 <= u32_Depth1` */
+    uint32_t u32_Depth1 = 0;
+    uint32_t u32_Depth2 = 0;
+    uint32_t u32_NodeLen1;
+    uint32_t u32_NodeLen2;
+    /* Holds the event count from the root to the current parent node */
+    ITC_Event_Counter_t t_ParentsCount1 = 0;
+    ITC_Event_Counter_t t_ParentsCount2 = 0;
+    /* Holds the total current event count */
+    ITC_Event_Counter_t t_CurrentCount1;
+    ITC_Event_Counter_t t_CurrentCount2;
+    bool b_IsParent1;
+    bool b_IsParent2;
+
+    *pb_IsLeq = true;
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           *pb_IsLeq &&
+           u32_Offset1 < u32_BufferSize1)
+    {
+        t_Status = readSerialisedEventNode(
+            pu8_Buffer1,
+            u32_BufferSize1,
+            u32_Offset1,
+            &b_IsParent1,
+            &t_CurrentCount1,
+            &u32_NodeLen1);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = readSerialisedEventNode(
+                pu8_Buffer2,
+                u32_BufferSize2,
+                u32_Offset2,
+                &b_IsParent2,
+                &t_CurrentCount2,
+                &u32_NodeLen2);
+        }
+
+        /* Essentially this is a `lift([lr]X, nX)` operation */
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = incEventCounter(&t_CurrentCount1, t_ParentsCount1);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = incEventCounter(&t_CurrentCount2, t_ParentsCount2);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* n1 <= n2 */
+            *pb_IsLeq = t_CurrentCount1 <= t_CurrentCount2;
+        }
+
+        if (t_Status != ITC_STATUS_SUCCESS || !*pb_IsLeq)
+        {
+            /* Nothing to do */
+        }
+        /* Descend into the left tree */
+        else if (b_IsParent1)
+        {
+            /* Only descend in Event2 if it is not already holding a node
+             * from higher up the tree */
+            if (b_IsParent2 && u32_Depth2 == u32_Depth1)
+            {
+                t_ParentsCount2 = t_CurrentCount2;
+                u32_Offset2 += u32_NodeLen2;
+                u32_Depth2++;
+            }
+
+            t_ParentsCount1 = t_CurrentCount1;
+            u32_Offset1 += u32_NodeLen1;
+            u32_Depth1++;
+        }
+        /* The next node in pre-order is the right child of the closest
+         * ancestor whose right subtree has not been explored yet */
+        else
+        {
+            u32_Offset1 += u32_NodeLen1;
+
+            if (u32_Offset1 < u32_BufferSize1)
+            {
+                t_Status = locateSerialisedEventNode(
+                    pu8_Buffer1,
+                    u32_BufferSize1,
+                    u32_Offset1,
+                    &t_ParentsCount1,
+                    &u32_Depth1);
+            }
+
+            /* If Event2 did not skip the descend into the ancestor's left
+             * subtree, its current node lies on the right-most branch of that
+             * subtree. Thus, skipping over it lands on the ancestor's right
+             * child */
+            if (t_Status == ITC_STATUS_SUCCESS &&
+                u32_Offset1 < u32_BufferSize1 &&
+                u32_Depth2 >= u32_Depth1)
+            {
+                skipSerialisedEventSubtree(pu8_Buffer2, &u32_Offset2);
+
+                t_Status = locateSerialisedEventNode(
+                    pu8_Buffer2,
+                    u32_BufferSize2,
+                    u32_Offset2,
+                    &t_ParentsCount2,
+                    &u32_Depth2);
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/**
+ * @brief Serialise a serialised ITC Event to ASCII string, without
+ * deserialising it
+ *
+ * Produces the same output as ::serialiseEventToString(). Serialised event
+ * counts are relative to their parent, just like in the string format, so
+ * they are copied as they are. The number of brackets to close after each
+ * leaf is the difference between its depth and the depth of the next node,
+ * which is recovered via ::locateSerialisedEventNode().
+ *
+ * @note The serialised Event must be valid. See ::validateSerialisedEvent()
+ * @param pu8_Buffer The buffer holding the serialised Event data (without the
+ * `ITC_VERSION_MAJOR` field)
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pc_Buffer The buffer to hold the string
+ * @param pu32_StringSize (in) The size of the string buffer in bytes. (out)
+ * The size of the data inside the string buffer in bytes (including the NULL
+ * termination byte).
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialisedEventToString(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    char *const pc_Buffer,
+    uint32_t *const pu32_StringSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Offset = 0; /* The offset into the serialised Event */
+    uint32_t u32_StringOffset = 0; /* The offset into the string */
+    uint32_t u32_Depth = 0; /* The depth of the current node */
+    uint32_t u32_NextDepth = 0; /* The depth of the next node */
+    uint32_t u32_NodeLen;
+    /* The size of the stringified current node event counter */
+    uint32_t u32_EventCounterSize;
+    ITC_Event_Counter_t t_Count;
+    bool b_IsParent = false;
+
+    /* Ensure there is at least space for the NULL termination */
+    if (*pu32_StringSize < 1)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* The nodes are already in pre-order */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Offset < u32_BufferSize)
+    {
+        t_Status = readSerialisedEventNode(
+            pu8_Buffer,
+            u32_BufferSize,
+            u32_Offset,
+            &b_IsParent,
+            &t_Count,
+            &u32_NodeLen);
+
+        /* Check there is space left in the buffer, taking into account the
+         * NULL termination byte and bracket */
+        if (t_Status == ITC_STATUS_SUCCESS &&
+            u32_StringOffset >= (*pu32_StringSize - 1))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS && b_IsParent)
+        {
+            /* Open a bracket to signify a parent node */
+            pc_Buffer[u32_StringOffset] = '(';
+            u32_StringOffset++;
+
+            /* Check there is space left in the buffer, taking into account the
+             * NULL termination byte and at least 1 digit event counter */
+            if (u32_StringOffset >= (*pu32_StringSize - 1))
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Calculate the space left in the buffer, taking into account the
+             * NULL termination byte */
+            u32_EventCounterSize = *pu32_StringSize - u32_StringOffset - 1;
+
+            /* Serialise the current node event counter */
+            t_Status = eventCounterToString(
+                t_Count, &pc_Buffer[u32_StringOffset], &u32_EventCounterSize);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment offsets */
+            u32_StringOffset += u32_EventCounterSize;
+            u32_Offset += u32_NodeLen;
+
+            if (b_IsParent)
+            {
+                u32_Depth++;
+
+                /* Check there is space left in the buffer, taking into
+                 * account the NULL termination byte, comma and space */
+                if (u32_StringOffset >= (*pu32_StringSize - 2))
+                {
+                    t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                }
+                else
+                {
+                    /* Add a comma and space to separate the current node
+                     * counter from its children */
+                    pc_Buffer[u32_StringOffset] = ',';
+                    u32_StringOffset++;
+                    pc_Buffer[u32_StringOffset] = ' ';
+                    u32_StringOffset++;
+                }
+            }
+            /* All brackets are closed after the last leaf */
+            else if (u32_Offset < u32_BufferSize)
+            {
+                t_Status = locateSerialisedEventNode(
+                    pu8_Buffer,
+                    u32_BufferSize,
+                    u32_Offset,
+                    &t_Count,
+                    &u32_NextDepth);
+            }
+            else
+            {
+                u32_NextDepth = 0;
+            }
+        }
+
+        /* Close the brackets of all subtrees the leaf ends */
+        while (t_Status == ITC_STATUS_SUCCESS &&
+               !b_IsParent &&
+               u32_Depth > u32_NextDepth)
+        {
+            /* Check there is space left in the buffer, taking into account
+             * the NULL termination byte and bracket */
+            if (u32_StringOffset >= (*pu32_StringSize - 1))
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            else
+            {
+                /* Close the current parent node bracket */
+                pc_Buffer[u32_StringOffset] = ')';
+                u32_StringOffset++;
+                u32_Depth--;
+            }
+        }
+
+        /* There is a right subtree that has not been explored yet */
+        if (t_Status == ITC_STATUS_SUCCESS &&
+            !b_IsParent &&
+            u32_Offset < u32_BufferSize)
+        {
+            /* Check there is space left in the buffer, taking into account
+             * the NULL termination byte, comma and space */
+            if (u32_StringOffset >= (*pu32_StringSize - 2))
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            else
+            {
+                /* Add a comma to signify the start of a new node */
+                pc_Buffer[u32_StringOffset] = ',';
+                u32_StringOffset++;
+
+                /* Add space between nodes */
+                pc_Buffer[u32_StringOffset] = ' ';
+                u32_StringOffset++;
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Ensure the string is always NULL-termiated */
+        pc_Buffer[u32_StringOffset] = '\0';
+        u32_StringOffset++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_StringSize = u32_StringOffset;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+
+/**
+ * @brief Validate a packed Event
+ *
+ * Checks:
+ *  - The pre-order node sequence describes exactly one full binary tree
+ *  - The Event is normalised. I.e. there are no parent nodes with 2 leaf
+ *    nodes holding the same absolute event count
+ *
+ * @param pt_PackedEvent The packed Event to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validatePackedEvent(
+    const ITC_PackedEvent_t *const pt_PackedEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Event_Counter_t *pt_Nodes = NULL;
+    uint32_t u32_Index = 0;
+    /* The number of subtrees that still need to be visited */
+    uint32_t u32_Pending = 1;
+
+    if (!pt_PackedEvent || !pt_PackedEvent->pt_Nodes)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (pt_PackedEvent->u32_Length == 0 ||
+             pt_PackedEvent->u32_Length > pt_PackedEvent->u32_Capacity)
+    {
+        t_Status = ITC_STATUS_CORRUPT_EVENT;
+    }
+    else
+    {
+        pt_Nodes = pt_PackedEvent->pt_Nodes;
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_Pending &&
+           u32_Index < pt_PackedEvent->u32_Length)
+    {
+        if (ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[u32_Index]))
+        {
+            /* The parent node is replaced by its 2 subtrees */
+            u32_Pending++;
+
+            /* (n, m, m) is not normalised */
+            if ((pt_PackedEvent->u32_Length - u32_Index) > 2U &&
+                !ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[u32_Index + 1]) &&
+                pt_Nodes[u32_Index + 1] == pt_Nodes[u32_Index + 2])
+            {
+                t_Status = ITC_STATUS_CORRUPT_EVENT;
+            }
+        }
+        else
+        {
+            u32_Pending--;
+        }
+
+        u32_Index++;
+    }
+
+    /* All subtrees must be complete and there must be no trailing nodes */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        (u32_Pending || u32_Index != pt_PackedEvent->u32_Length))
+    {
+        t_Status = ITC_STATUS_CORRUPT_EVENT;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Append a node to a packed Event
+ *
+ * Any `(n, m, m)` subtree completed by the new node is normalised on the spot.
+ *
+ * @param pt_PackedEvent The packed Event
+ * @param t_Node The node to append
+ * @param pb_IsChanged (out) Set to `true` if the node differs from the one
+ * previously stored at the same position. Ignored if NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is full
+ */
+static ITC_Status_t appendPackedEventNode(
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    const ITC_Event_Counter_t t_Node,
+    bool *const pb_IsChanged
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_Counter_t *pt_Nodes = pt_PackedEvent->pt_Nodes;
+    uint32_t u32_Length = pt_PackedEvent->u32_Length;
+
+    if (u32_Length >= pt_PackedEvent->u32_Capacity)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        if (pb_IsChanged && pt_Nodes[u32_Length] != t_Node)
+        {
+            *pb_IsChanged = true;
+        }
+
+        pt_Nodes[u32_Length] = t_Node;
+        u32_Length++;
+
+        /* norm((n, m, m)) = n + m
+         * In pre-order such a subtree is always a parent node immediately
+         * followed by its 2 leaves. The leaves already hold the absolute
+         * event count, so the parent simply takes over their value */
+        while (!ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node) &&
+               u32_Length >= 3U &&
+               ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[u32_Length - 3U]) &&
+               pt_Nodes[u32_Length - 2U] == t_Node)
+        {
+            pt_Nodes[u32_Length - 3U] = t_Node;
+            u32_Length -= 2U;
+        }
+
+        pt_PackedEvent->u32_Length = u32_Length;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Get the min and max absolute event counts of a packed Event subtree
+ *
+ * @param pt_Nodes The packed Event nodes
+ * @param pu32_Index (in) The index of the root node of the subtree. (out) The
+ * index of the first node after the subtree
+ * @param pt_Min (out) The smallest event count in the subtree
+ * @param pt_Max (out) The biggest event count in the subtree
+ */
+static void getPackedEventSubtreeMinMax(
+    const ITC_Event_Counter_t *const pt_Nodes,
+    uint32_t *const pu32_Index,
+    ITC_Event_Counter_t *const pt_Min,
+    ITC_Event_Counter_t *const pt_Max
+)
+{
+    /* The number of subtrees that still need to be visited */
+    uint32_t u32_Pending = 1;
+    ITC_Event_Counter_t t_Node;
+
+    *pt_Min = ITC_PACKED_EVENT_PARENT_NODE;
+    *pt_Max = 0;
+
+    while (u32_Pending)
+    {
+        t_Node = pt_Nodes[*pu32_Index];
+
+        if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node))
+        {
+            u32_Pending++;
+        }
+        else
+        {
+            *pt_Min = MIN(*pt_Min, t_Node);
+            *pt_Max = MAX(*pt_Max, t_Node);
+            u32_Pending--;
+        }
+
+        (*pu32_Index)++;
+    }
+}
+
+/**
+ * @brief Find the end of a packed Event subtree
+ *
+ * @param pt_Nodes The packed Event nodes
+ * @param pu32_Index (in) The index of the root node of the subtree. (out) The
+ * index of the first node after the subtree
+ */
+static void skipPackedEventSubtree(
+    const ITC_Event_Counter_t *const pt_Nodes,
+    uint32_t *const pu32_Index
+)
+{
+    /* The number of subtrees that still need to be skipped */
+    uint32_t u32_Pending = 1;
+
+    while (u32_Pending)
+    {
+        if (ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[*pu32_Index]))
+        {
+            u32_Pending++;
+        }
+        else
+        {
+            u32_Pending--;
+        }
+
+        (*pu32_Index)++;
+    }
+}
+
+/**
+ * @brief Find the parent of a packed Event node
+ *
+ * If the node is a left child, its parent immediately precedes it. Otherwise,
+ * it is preceded by the complete subtree of its left sibling, which is
+ * skipped by walking backwards until all of its nodes are accounted for.
+ *
+ * @note The node must not be the root node
+ * @param pt_Nodes The packed Event nodes
+ * @param u32_Index The index of the node
+ * @param pu32_ParentIndex (out) The index of the parent node
+ */
+static void findPackedEventParent(
+    const ITC_Event_Counter_t *const pt_Nodes,
+    const uint32_t u32_Index,
+    uint32_t *const pu32_ParentIndex
+)
+{
+    /* The number of complete subtrees walked over so far */
+    uint32_t u32_Subtrees = 0;
+
+    *pu32_ParentIndex = u32_Index - 1;
+
+    /* Walking backwards, a leaf adds a new complete subtree, while a parent
+     * node merges 2 complete subtrees into 1. The parent is the first node
+     * that has less than 2 complete subtrees in front of it */
+    while (!ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[*pu32_ParentIndex]) ||
+           u32_Subtrees > 1)
+    {
+        if (ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[*pu32_ParentIndex]))
+        {
+            u32_Subtrees--;
+        }
+        else
+        {
+            u32_Subtrees++;
+        }
+
+        (*pu32_ParentIndex)--;
+    }
+}
+
+/**
+ * @brief Append a copy of a packed Event subtree to another packed Event
+ *
+ * @param pt_Nodes The source packed Event nodes
+ * @param pu32_Index (in) The index of the root node of the subtree. (out) The
+ * index of the first node after the subtree
+ * @param t_Floor The minimum absolute event count of the copied leaves. Used
+ * to join the subtree with a leaf
+ * @param pt_CopyPackedEvent The packed Event to append the copy to. Might
+ * share its buffer with the source as long as it is never ahead of it
+ * @param pb_IsChanged (out) Set to `true` if any appended node differs from
+ * the one previously stored at the same position. Ignored if NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is full
+ */
+static ITC_Status_t copyPackedEventSubtree(
+    const ITC_Event_Counter_t *const pt_Nodes,
+    uint32_t *const pu32_Index,
+    const ITC_Event_Counter_t t_Floor,
+    ITC_PackedEvent_t *const pt_CopyPackedEvent,
+    bool *const pb_IsChanged
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The number of subtrees that still need to be copied */
+    uint32_t u32_Pending = 1;
+    ITC_Event_Counter_t t_Node;
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Pending)
+    {
+        t_Node = pt_Nodes[*pu32_Index];
+
+        if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node))
+        {
+            u32_Pending++;
+        }
+        else
+        {
+            t_Node = MAX(t_Node, t_Floor);
+            u32_Pending--;
+        }
+
+        t_Status = appendPackedEventNode(
+            pt_CopyPackedEvent, t_Node, pb_IsChanged);
+
+        (*pu32_Index)++;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Join two packed Events into a new packed Event
+ *
+ * Rules (with absolute event counts):
+ *  - join(n1, n2) = max(n1, n2)
+ *  - join(n1, (l2, r2)) = norm((join(n1, l2), join(n1, r2)))
+ *  - join((l1, r1), n2) = norm((join(l1, n2), join(r1, n2)))
+ *  - join((l1, r1), (l2, r2)) = norm((join(l1, l2), join(r1, r2)))
+ *
+ * Both packed Events are traversed in pre-order in lockstep, which visits the
+ * subtree pairs in the same order the joined Event is stored in.
+ *
+ * @param pt_PackedEvent1 The first packed Event
+ * @param pt_PackedEvent2 The second packed Event
+ * @param pt_PackedEvent The joined Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t joinPackedEventE(
+    const ITC_PackedEvent_t *const pt_PackedEvent1,
+    const ITC_PackedEvent_t *const pt_PackedEvent2,
+    ITC_PackedEvent_t *const pt_PackedEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Index1 = 0;
+    uint32_t u32_Index2 = 0;
+    /* The number of subtree pairs that still need to be joined */
+    uint32_t u32_Pending = 1;
+    ITC_Event_Counter_t t_Node1;
+    ITC_Event_Counter_t t_Node2;
+
+    pt_PackedEvent->u32_Length = 0;
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Pending)
+    {
+        t_Node1 = pt_PackedEvent1->pt_Nodes[u32_Index1];
+        t_Node2 = pt_PackedEvent2->pt_Nodes[u32_Index2];
+
+        /* join((l1, r1), (l2, r2)) = norm((join(l1, l2), join(r1, r2))) */
+        if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node1) &&
+            ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node2))
+        {
+            t_Status = appendPackedEventNode(
+                pt_PackedEvent, ITC_PACKED_EVENT_PARENT_NODE, NULL);
+
+            u32_Index1++;
+            u32_Index2++;
+            u32_Pending++;
+        }
+        /* join((l1, r1), n2) = norm((join(l1, n2), join(r1, n2))) */
+        else if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node1))
+        {
+            t_Status = copyPackedEventSubtree(
+                pt_PackedEvent1->pt_Nodes,
+                &u32_Index1,
+                t_Node2,
+                pt_PackedEvent,
+                NULL);
+
+            u32_Index2++;
+            u32_Pending--;
+        }
+        /* join(n1, (l2, r2)) = norm((join(n1, l2), join(n1, r2))) */
+        else if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node2))
+        {
+            t_Status = copyPackedEventSubtree(
+                pt_PackedEvent2->pt_Nodes,
+                &u32_Index2,
+                t_Node1,
+                pt_PackedEvent,
+                NULL);
+
+            u32_Index1++;
+            u32_Pending--;
+        }
+        /* join(n1, n2) = max(n1, n2) */
+        else
+        {
+            t_Status = appendPackedEventNode(
+                pt_PackedEvent, MAX(t_Node1, t_Node2), NULL);
+
+            u32_Index1++;
+            u32_Index2++;
+            u32_Pending--;
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        pt_PackedEvent->u32_Length = 0;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Check if a packed Event is `less than or equal` (`<=`) to another
+ * packed Event
+ *
+ * Rules (with absolute event counts):
+ *  - leq(n1, n2) = n1 <= n2
+ *  - leq(n1, (l2, r2)) = n1 <= min((l2, r2))
+ *  - leq((l1, r1), n2) = max((l1, r1)) <= n2
+ *  - leq((l1, r1), (l2, r2)) = leq(l1, l2) && leq(r1, r2)
+ *
+ * @param pt_PackedEvent1 The first packed Event
+ * @param pt_PackedEvent2 The second packed Event
+ * @param pb_IsLeq (out) `true` if `*pt_PackedEvent1 <= *pt_PackedEvent2`.
+ * Otherwise `false`
+ */
+static void leqPackedEventE(
+    const ITC_PackedEvent_t *const pt_PackedEvent1,
+    const ITC_PackedEvent_t *const pt_PackedEvent2,
+    bool *const pb_IsLeq
+)
+{
+    uint32_t u32_Index1 = 0;
+    uint32_t u32_Index2 = 0;
+    /* The number of subtree pairs that still need to be compared */
+    uint32_t u32_Pending = 1;
+    ITC_Event_Counter_t t_Node1;
+    ITC_Event_Counter_t t_Node2;
+    ITC_Event_Counter_t t_Min;
+    ITC_Event_Counter_t t_Max;
+
+    *pb_IsLeq = true;
+
+    while (*pb_IsLeq && u32_Pending)
+    {
+        t_Node1 = pt_PackedEvent1->pt_Nodes[u32_Index1];
+        t_Node2 = pt_PackedEvent2->pt_Nodes[u32_Index2];
+
+        /* leq((l1, r1), (l2, r2)) = leq(l1, l2) && leq(r1, r2) */
+        if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node1) &&
+            ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node2))
+        {
+            u32_Index1++;
+            u32_Index2++;
+            u32_Pending++;
+        }
+        /* leq((l1, r1), n2) = max((l1, r1)) <= n2 */
+        else if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node1))
+        {
+            getPackedEventSubtreeMinMax(
+                pt_PackedEvent1->pt_Nodes, &u32_Index1, &t_Min, &t_Max);
+
+            *pb_IsLeq = t_Max <= t_Node2;
+
+            u32_Index2++;
+            u32_Pending--;
+        }
+        /* leq(n1, (l2, r2)) = n1 <= min((l2, r2)) */
+        else if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node2))
+        {
+            getPackedEventSubtreeMinMax(
+                pt_PackedEvent2->pt_Nodes, &u32_Index2, &t_Min, &t_Max);
+
+            *pb_IsLeq = t_Node1 <= t_Min;
+
+            u32_Index1++;
+            u32_Pending--;
+        }
+        /* leq(n1, n2) = n1 <= n2 */
+        else
+        {
+            *pb_IsLeq = t_Node1 <= t_Node2;
+
+            u32_Index1++;
+            u32_Index2++;
+            u32_Pending--;
+        }
+    }
+}
+
+/**
+ * @brief Compare the nodes of two packed Events element-wise
+ *
+ * @param pt_Nodes1 The nodes of the first packed Event
+ * @param pt_Nodes2 The nodes of the second packed Event
+ * @param u32_Index The index of the first node to compare
+ * @param u32_Length The number of nodes in each packed Event
+ * @param pb_IsShapeMismatch (out) Set to `true` if a parent node is paired
+ * with a leaf node. Left untouched otherwise
+ * @param pb_IsGreater (out) Set to `true` if a node of the first packed Event
+ * is bigger than the paired node of the second one. Left untouched otherwise
+ */
+static void leqPackedEventNodesScalar(
+    const ITC_Event_Counter_t *const pt_Nodes1,
+    const ITC_Event_Counter_t *const pt_Nodes2,
+    uint32_t u32_Index,
+    const uint32_t u32_Length,
+    bool *const pb_IsShapeMismatch,
+    bool *const pb_IsGreater
+)
+{
+    uint32_t u32_IsShapeMismatch = 0;
+    uint32_t u32_IsGreater = 0;
+
+    /* Accumulate without branching, so the loop can be auto-vectorised */
+    for (; u32_Index < u32_Length; u32_Index++)
+    {
+        u32_IsShapeMismatch |= (uint32_t)(
+            ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes1[u32_Index]) !=
+            ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes2[u32_Index]));
+        u32_IsGreater |=
+            (uint32_t)(pt_Nodes1[u32_Index] > pt_Nodes2[u32_Index]);
+    }
+
+    if (u32_IsShapeMismatch)
+    {
+        *pb_IsShapeMismatch = true;
+    }
+
+    if (u32_IsGreater)
+    {
+        *pb_IsGreater = true;
+    }
+}
+
+/**
+ * @brief Join the nodes of two packed Events element-wise
+ *
+ * @param pt_Nodes1 The nodes of the first packed Event
+ * @param pt_Nodes2 The nodes of the second packed Event
+ * @param pt_Nodes The joined nodes
+ * @param u32_Index The index of the first node to join
+ * @param u32_Length The number of nodes in each packed Event
+ * @param pb_IsShapeMismatch (out) Set to `true` if a parent node is paired
+ * with a leaf node. Left untouched otherwise
+ */
+static void joinPackedEventNodesScalar(
+    const ITC_Event_Counter_t *const pt_Nodes1,
+    const ITC_Event_Counter_t *const pt_Nodes2,
+    ITC_Event_Counter_t *const pt_Nodes,
+    uint32_t u32_Index,
+    const uint32_t u32_Length,
+    bool *const pb_IsShapeMismatch
+)
+{
+    uint32_t u32_IsShapeMismatch = 0;
+
+    for (; u32_Index < u32_Length; u32_Index++)
+    {
+        u32_IsShapeMismatch |= (uint32_t)(
+            ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes1[u32_Index]) !=
+            ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes2[u32_Index]));
+        /* max(parent, parent) = parent */
+        pt_Nodes[u32_Index] = MAX(pt_Nodes1[u32_Index], pt_Nodes2[u32_Index]);
+    }
+
+    if (u32_IsShapeMismatch)
+    {
+        *pb_IsShapeMismatch = true;
+    }
+}
+
+#if ITC_PACKED_EVENT_USE_AVX2
+
+/**
+ * @brief Get the lanes of an AVX2 vector holding packed Event parent nodes
+ *
+ * @param t_Nodes The packed Event nodes
+ * @return `__m256i` All ones in the parent node lanes, zeros otherwise
+ */
+ITC_PACKED_EVENT_AVX2_TARGET
+static inline __m256i isParentPackedEventNodeAvx2(const __m256i t_Nodes)
+{
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    return _mm256_cmpeq_epi64(t_Nodes, _mm256_set1_epi64x(-1));
+#else
+    return _mm256_cmpeq_epi32(t_Nodes, _mm256_set1_epi32(-1));
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+}
+
+/**
+ * @brief Get the lanes of an AVX2 vector where `t_Nodes1 > t_Nodes2`
+ *
+ * @param t_Nodes1 The first packed Event nodes
+ * @param t_Nodes2 The second packed Event nodes
+ * @return `__m256i` Non-zero in the lanes where `t_Nodes1 > t_Nodes2`, zeros
+ * otherwise
+ */
+ITC_PACKED_EVENT_AVX2_TARGET
+static inline __m256i isGreaterPackedEventNodeAvx2(
+    const __m256i t_Nodes1,
+    const __m256i t_Nodes2
+)
+{
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    /* There is no unsigned compare, so flip the sign bits beforehand */
+    const __m256i t_SignBit = _mm256_set1_epi64x(INT64_MIN);
+
+    return _mm256_cmpgt_epi64(
+        _mm256_xor_si256(t_Nodes1, t_SignBit),
+        _mm256_xor_si256(t_Nodes2, t_SignBit));
+#else
+    /* max(n1, n2) == n2 unless n1 > n2 */
+    return _mm256_xor_si256(_mm256_max_epu32(t_Nodes1, t_Nodes2), t_Nodes2);
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+}
+
+/**
+ * @brief Get the element-wise max of two AVX2 vectors
+ *
+ * @param t_Nodes1 The first packed Event nodes
+ * @param t_Nodes2 The second packed Event nodes
+ * @return `__m256i` The max of each lane
+ */
+ITC_PACKED_EVENT_AVX2_TARGET
+static inline __m256i maxPackedEventNodeAvx2(
+    const __m256i t_Nodes1,
+    const __m256i t_Nodes2
+)
+{
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    return _mm256_blendv_epi8(
+        t_Nodes2, t_Nodes1, isGreaterPackedEventNodeAvx2(t_Nodes1, t_Nodes2));
+#else
+    return _mm256_max_epu32(t_Nodes1, t_Nodes2);
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+}
+
+/**
+ * @brief Compare the nodes of two packed Events element-wise using AVX2
+ *
+ * Only whole vectors are compared. The remaining nodes are left for the next
+ * kernel.
+ *
+ * @param pt_Nodes1 The nodes of the first packed Event
+ * @param pt_Nodes2 The nodes of the second packed Event
+ * @param u32_Index The index of the first node to compare
+ * @param u32_Length The number of nodes in each packed Event
+ * @param pb_IsShapeMismatch (out) Set to `true` if a parent node is paired
+ * with a leaf node. Left untouched otherwise
+ * @param pb_IsGreater (out) Set to `true` if a node of the first packed Event
+ * is bigger than the paired node of the second one. Left untouched otherwise
+ * @return `uint32_t` The index of the first node that was not compared
+ */
+ITC_PACKED_EVENT_AVX2_TARGET
+static uint32_t leqPackedEventNodesAvx2(
+    const ITC_Event_Counter_t *const pt_Nodes1,
+    const ITC_Event_Counter_t *const pt_Nodes2,
+    uint32_t u32_Index,
+    const uint32_t u32_Length,
+    bool *const pb_IsShapeMismatch,
+    bool *const pb_IsGreater
+)
+{
+    __m256i t_IsShapeMismatch = _mm256_setzero_si256();
+    __m256i t_IsGreater = _mm256_setzero_si256();
+    __m256i t_Nodes1;
+    __m256i t_Nodes2;
+
+    for (;
+         (u32_Length - u32_Index) >= ITC_PACKED_EVENT_AVX2_LANES;
+         u32_Index += ITC_PACKED_EVENT_AVX2_LANES)
+    {
+        t_Nodes1 = _mm256_loadu_si256((const __m256i *)&pt_Nodes1[u32_Index]);
+        t_Nodes2 = _mm256_loadu_si256((const __m256i *)&pt_Nodes2[u32_Index]);
+
+        t_IsShapeMismatch = _mm256_or_si256(
+            t_IsShapeMismatch,
+            _mm256_xor_si256(
+                isParentPackedEventNodeAvx2(t_Nodes1),
+                isParentPackedEventNodeAvx2(t_Nodes2)));
+        t_IsGreater = _mm256_or_si256(
+            t_IsGreater, isGreaterPackedEventNodeAvx2(t_Nodes1, t_Nodes2));
+    }
+
+    if (!_mm256_testz_si256(t_IsShapeMismatch, t_IsShapeMismatch))
+    {
+        *pb_IsShapeMismatch = true;
+    }
+
+    if (!_mm256_testz_si256(t_IsGreater, t_IsGreater))
+    {
+        *pb_IsGreater = true;
+    }
+
+    return u32_Index;
+}
+
+/**
+ * @brief Join the nodes of two packed Events element-wise using AVX2
+ *
+ * Only whole vectors are joined. The remaining nodes are left for the next
+ * kernel.
+ *
+ * @param pt_Nodes1 The nodes of the first packed Event
+ * @param pt_Nodes2 The nodes of the second packed Event
+ * @param pt_Nodes The joined nodes
+ * @param u32_Index The index of the first node to join
+ * @param u32_Length The number of nodes in each packed Event
+ * @param pb_IsShapeMismatch (out) Set to `true` if a parent node is paired
+ * with a leaf node. Left untouched otherwise
+ * @return `uint32_t` The index of the first node that was not joined
+ */
+ITC_PACKED_EVENT_AVX2_TARGET
+static uint32_t joinPackedEventNodesAvx2(
+    const ITC_Event_Counter_t *const pt_Nodes1,
+    const ITC_Event_Counter_t *const pt_Nodes2,
+    ITC_Event_Counter_t *const pt_Nodes,
+    uint32_t u32_Index,
+    const uint32_t u32_Length,
+    bool *const pb_IsShapeMismatch
+)
+{
+    __m256i t_IsShapeMismatch = _mm256_setzero_si256();
+    __m256i t_Nodes1;
+    __m256i t_Nodes2;
+
+    for (;
+         (u32_Length - u32_Index) >= ITC_PACKED_EVENT_AVX2_LANES;
+         u32_Index += ITC_PACKED_EVENT_AVX2_LANES)
+    {
+        t_Nodes1 = _mm256_loadu_si256((const __m256i *)&pt_Nodes1[u32_Index]);
+        t_Nodes2 = _mm256_loadu_si256((const __m256i *)&pt_Nodes2[u32_Index]);
+
+        t_IsShapeMismatch = _mm256_or_si256(
+            t_IsShapeMismatch,
+            _mm256_xor_si256(
+                isParentPackedEventNodeAvx2(t_Nodes1),
+                isParentPackedEventNodeAvx2(t_Nodes2)));
+        _mm256_storeu_si256(
+            (__m256i *)&pt_Nodes[u32_Index],
+            maxPackedEventNodeAvx2(t_Nodes1, t_Nodes2));
+    }
+
+    if (!_mm256_testz_si256(t_IsShapeMismatch, t_IsShapeMismatch))
+    {
+        *pb_IsShapeMismatch = true;
+    }
+
+    return u32_Index;
+}
+
+#endif /* ITC_PACKED_EVENT_USE_AVX2 */
+
+#if ITC_PACKED_EVENT_USE_SSE2
+
+/**
+ * @brief Get the lanes of an SSE2 vector where `t_Nodes1 > t_Nodes2`
+ *
+ * @param t_Nodes1 The first packed Event nodes
+ * @param t_Nodes2 The second packed Event nodes
+ * @return `__m128i` All ones in the lanes where `t_Nodes1 > t_Nodes2`, zeros
+ * otherwise
+ */
+static inline __m128i isGreaterPackedEventNodeSse2(
+    const __m128i t_Nodes1,
+    const __m128i t_Nodes2
+)
+{
+    /* There is no unsigned compare, so flip the sign bits beforehand */
+    const __m128i t_SignBit = _mm_set1_epi32(INT32_MIN);
+
+    return _mm_cmpgt_epi32(
+        _mm_xor_si128(t_Nodes1, t_SignBit),
+        _mm_xor_si128(t_Nodes2, t_SignBit));
+}
+
+/**
+ * @brief Compare the nodes of two packed Events element-wise using SSE2
+ *
+ * Only whole vectors are compared. The remaining nodes are left for the next
+ * kernel.
+ *
+ * @param pt_Nodes1 The nodes of the first packed Event
+ * @param pt_Nodes2 The nodes of the second packed Event
+ * @param u32_Index The index of the first node to compare
+ * @param u32_Length The number of nodes in each packed Event
+ * @param pb_IsShapeMismatch (out) Set to `true` if a parent node is paired
+ * with a leaf node. Left untouched otherwise
+ * @param pb_IsGreater (out) Set to `true` if a node of the first packed Event
+ * is bigger than the paired node of the second one. Left untouched otherwise
+ * @return `uint32_t` The index of the first node that was not compared
+ */
+static uint32_t leqPackedEventNodesSse2(
+    const ITC_Event_Counter_t *const pt_Nodes1,
+    const ITC_Event_Counter_t *const pt_Nodes2,
+    uint32_t u32_Index,
+    const uint32_t u32_Length,
+    bool *const pb_IsShapeMismatch,
+    bool *const pb_IsGreater
+)
+{
+    const __m128i t_ParentNode = _mm_set1_epi32(-1);
+    __m128i t_IsShapeMismatch = _mm_setzero_si128();
+    __m128i t_IsGreater = _mm_setzero_si128();
+    __m128i t_Nodes1;
+    __m128i t_Nodes2;
+
+    for (;
+         (u32_Length - u32_Index) >= ITC_PACKED_EVENT_SSE2_NEON_LANES;
+         u32_Index += ITC_PACKED_EVENT_SSE2_NEON_LANES)
+    {
+        t_Nodes1 = _mm_loadu_si128((const __m128i *)&pt_Nodes1[u32_Index]);
+        t_Nodes2 = _mm_loadu_si128((const __m128i *)&pt_Nodes2[u32_Index]);
+
+        t_IsShapeMismatch = _mm_or_si128(
+            t_IsShapeMismatch,
+            _mm_xor_si128(
+                _mm_cmpeq_epi32(t_Nodes1, t_ParentNode),
+                _mm_cmpeq_epi32(t_Nodes2, t_ParentNode)));
+        t_IsGreater = _mm_or_si128(
+            t_IsGreater, isGreaterPackedEventNodeSse2(t_Nodes1, t_Nodes2));
+    }
+
+    if (_mm_movemask_epi8(t_IsShapeMismatch))
+    {
+        *pb_IsShapeMismatch = true;
+    }
+
+    if (_mm_movemask_epi8(t_IsGreater))
+    {
+        *pb_IsGreater = true;
+    }
+
+    return u32_Index;
+}
+
+/**
+ * @brief Join the nodes of two packed Events element-wise using SSE2
+ *
+ * Only whole vectors are joined. The remaining nodes are left for the next
+ * kernel.
+ *
+ * @param pt_Nodes1 The nodes of the first packed Event
+ * @param pt_Nodes2 The nodes of the second packed Event
+ * @param pt_Nodes The joined nodes
+ * @param u32_Index The index of the first node to join
+ * @param u32_Length The number of nodes in each packed Event
+ * @param pb_IsShapeMismatch (out) Set to `true` if a parent node is paired
+ * with a leaf node. Left untouched otherwise
+ * @return `uint32_t` The index of the first node that was not joined
+ */
+static uint32_t joinPackedEventNodesSse2(
+    const ITC_Event_Counter_t *const pt_Nodes1,
+    const ITC_Event_Counter_t *const pt_Nodes2,
+    ITC_Event_Counter_t *const pt_Nodes,
+    uint32_t u32_Index,
+    const uint32_t u32_Length,
+    bool *const pb_IsShapeMismatch
+)
+{
+    const __m128i t_ParentNode = _mm_set1_epi32(-1);
+    __m128i t_IsShapeMismatch = _mm_setzero_si128();
+    __m128i t_Nodes1;
+    __m128i t_Nodes2;
+    __m128i t_IsGreater;
+
+    for (;
+         (u32_Length - u32_Index) >= ITC_PACKED_EVENT_SSE2_NEON_LANES;
+         u32_Index += ITC_PACKED_EVENT_SSE2_NEON_LANES)
+    {
+        t_Nodes1 = _mm_loadu_si128((const __m128i *)&pt_Nodes1[u32_Index]);
+        t_Nodes2 = _mm_loadu_si128((const __m128i *)&pt_Nodes2[u32_Index]);
+
+        t_IsShapeMismatch = _mm_or_si128(
+            t_IsShapeMismatch,
+            _mm_xor_si128(
+                _mm_cmpeq_epi32(t_Nodes1, t_ParentNode),
+                _mm_cmpeq_epi32(t_Nodes2, t_ParentNode)));
+
+        /* There is no unsigned max either, so select the bigger nodes */
+        t_IsGreater = isGreaterPackedEventNodeSse2(t_Nodes1, t_Nodes2);
+        _mm_storeu_si128(
+            (__m128i *)&pt_Nodes[u32_Index],
+            _mm_or_si128(
+                _mm_and_si128(t_IsGreater, t_Nodes1),
+                _mm_andnot_si128(t_IsGreater, t_Nodes2)));
+    }
+
+    if (_mm_movemask_epi8(t_IsShapeMismatch))
+    {
+        *pb_IsShapeMismatch = true;
+    }
+
+    return u32_Index;
+}
+
+#endif /* ITC_PACKED_EVENT_USE_SSE2 */
+
+#if ITC_PACKED_EVENT_USE_NEON
+
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+/** A NEON vector of packed Event nodes */
+typedef uint64x2_t ITC_PackedEvent_NeonNodes_t;
+
+/** Load a NEON vector of packed Event nodes */
+#define ITC_PACKED_EVENT_NEON_LOAD(pt_Nodes)              (vld1q_u64(pt_Nodes))
+/** Store a NEON vector of packed Event nodes */
+#define ITC_PACKED_EVENT_NEON_STORE(pt_Nodes, t_Nodes)                         \
+    (vst1q_u64((pt_Nodes), (t_Nodes)))
+/** Get the lanes of a NEON vector holding packed Event parent nodes */
+#define ITC_PACKED_EVENT_NEON_IS_PARENT(t_Nodes)                               \
+    (vceqq_u64((t_Nodes), vdupq_n_u64(UINT64_MAX)))
+/** Get the lanes of a NEON vector where `t_Nodes1 > t_Nodes2` */
+#define ITC_PACKED_EVENT_NEON_IS_GREATER(t_Nodes1, t_Nodes2)                   \
+    (vcgtq_u64((t_Nodes1), (t_Nodes2)))
+/** Get the element-wise max of two NEON vectors */
+#define ITC_PACKED_EVENT_NEON_MAX(t_Nodes1, t_Nodes2)                          \
+    (vbslq_u64(vcgtq_u64((t_Nodes1), (t_Nodes2)), (t_Nodes1), (t_Nodes2)))
+/** Check whether any bit is set in a NEON vector */
+#define ITC_PACKED_EVENT_NEON_ANY(t_Nodes)                                     \
+    (vmaxvq_u32(vreinterpretq_u32_u64(t_Nodes)) != 0)
+#else
+/** A NEON vector of packed Event nodes */
+typedef uint32x4_t ITC_PackedEvent_NeonNodes_t;
+
+/** Load a NEON vector of packed Event nodes */
+#define ITC_PACKED_EVENT_NEON_LOAD(pt_Nodes)              (vld1q_u32(pt_Nodes))
+/** Store a NEON vector of packed Event nodes */
+#define ITC_PACKED_EVENT_NEON_STORE(pt_Nodes, t_Nodes)                         \
+    (vst1q_u32((pt_Nodes), (t_Nodes)))
+/** Get the lanes of a NEON vector holding packed Event parent nodes */
+#define ITC_PACKED_EVENT_NEON_IS_PARENT(t_Nodes)                               \
+    (vceqq_u32((t_Nodes), vdupq_n_u32(UINT32_MAX)))
+/** Get the lanes of a NEON vector where `t_Nodes1 > t_Nodes2` */
+#define ITC_PACKED_EVENT_NEON_IS_GREATER(t_Nodes1, t_Nodes2)                   \
+    (vcgtq_u32((t_Nodes1), (t_Nodes2)))
+/** Get the element-wise max of two NEON vectors */
+#define ITC_PACKED_EVENT_NEON_MAX(t_Nodes1, t_Nodes2)                          \
+    (vmaxq_u32((t_Nodes1), (t_Nodes2)))
+/** Check whether any bit is set in a NEON vector */
+#define ITC_PACKED_EVENT_NEON_ANY(t_Nodes)           (vmaxvq_u32(t_Nodes) != 0)
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+
+/**
+ * @brief Compare the nodes of two packed Events element-wise using NEON
+ *
+ * Only whole vectors are compared. The remaining nodes are left for the next
+ * kernel.
+ *
+ * @param pt_Nodes1 The nodes of the first packed Event
+ * @param pt_Nodes2 The nodes of the second packed Event
+ * @param u32_Index The index of the first node to compare
+ * @param u32_Length The number of nodes in each packed Event
+ * @param pb_IsShapeMismatch (out) Set to `true` if a parent node is paired
+ * with a leaf node. Left untouched otherwise
+ * @param pb_IsGreater (out) Set to `true` if a node of the first packed Event
+ * is bigger than the paired node of the second one. Left untouched otherwise
+ * @return `uint32_t` The index of the first node that was not compared
+ */
+static uint32_t leqPackedEventNodesNeon(
+    const ITC_Event_Counter_t *const pt_Nodes1,
+    const ITC_Event_Counter_t *const pt_Nodes2,
+    uint32_t u32_Index,
+    const uint32_t u32_Length,
+    bool *const pb_IsShapeMismatch,
+    bool *const pb_IsGreater
+)
+{
+    ITC_PackedEvent_NeonNodes_t t_IsShapeMismatch = { 0 };
+    ITC_PackedEvent_NeonNodes_t t_IsGreater = { 0 };
+    ITC_PackedEvent_NeonNodes_t t_Nodes1;
+    ITC_PackedEvent_NeonNodes_t t_Nodes2;
+
+    for (;
+         (u32_Length - u32_Index) >= ITC_PACKED_EVENT_SSE2_NEON_LANES;
+         u32_Index += ITC_PACKED_EVENT_SSE2_NEON_LANES)
+    {
+        t_Nodes1 = ITC_PACKED_EVENT_NEON_LOAD(&pt_Nodes1[u32_Index]);
+        t_Nodes2 = ITC_PACKED_EVENT_NEON_LOAD(&pt_Nodes2[u32_Index]);
+
+        t_IsShapeMismatch |= ITC_PACKED_EVENT_NEON_IS_PARENT(t_Nodes1) ^
+                             ITC_PACKED_EVENT_NEON_IS_PARENT(t_Nodes2);
+        t_IsGreater |= ITC_PACKED_EVENT_NEON_IS_GREATER(t_Nodes1, t_Nodes2);
+    }
+
+    if (ITC_PACKED_EVENT_NEON_ANY(t_IsShapeMismatch))
+    {
+        *pb_IsShapeMismatch = true;
+    }
+
+    if (ITC_PACKED_EVENT_NEON_ANY(t_IsGreater))
+    {
+        *pb_IsGreater = true;
+    }
+
+    return u32_Index;
+}
+
+/**
+ * @brief Join the nodes of two packed Events element-wise using NEON
+ *
+ * Only whole vectors are joined. The remaining nodes are left for the next
+ * kernel.
+ *
+ * @param pt_Nodes1 The nodes of the first packed Event
+ * @param pt_Nodes2 The nodes of the second packed Event
+ * @param pt_Nodes The joined nodes
+ * @param u32_Index The index of the first node to join
+ * @param u32_Length The number of nodes in each packed Event
+ * @param pb_IsShapeMismatch (out) Set to `true` if a parent node is paired
+ * with a leaf node. Left untouched otherwise
+ * @return `uint32_t` The index of the first node that was not joined
+ */
+static uint32_t joinPackedEventNodesNeon(
+    const ITC_Event_Counter_t *const pt_Nodes1,
+    const ITC_Event_Counter_t *const pt_Nodes2,
+    ITC_Event_Counter_t *const pt_Nodes,
+    uint32_t u32_Index,
+    const uint32_t u32_Length,
+    bool *const pb_IsShapeMismatch
+)
+{
+    ITC_PackedEvent_NeonNodes_t t_IsShapeMismatch = { 0 };
+    ITC_PackedEvent_NeonNodes_t t_Nodes1;
+    ITC_PackedEvent_NeonNodes_t t_Nodes2;
+
+    for (;
+         (u32_Length - u32_Index) >= ITC_PACKED_EVENT_SSE2_NEON_LANES;
+         u32_Index += ITC_PACKED_EVENT_SSE2_NEON_LANES)
+    {
+        t_Nodes1 = ITC_PACKED_EVENT_NEON_LOAD(&pt_Nodes1[u32_Index]);
+        t_Nodes2 = ITC_PACKED_EVENT_NEON_LOAD(&pt_Nodes2[u32_Index]);
+
+        t_IsShapeMismatch |= ITC_PACKED_EVENT_NEON_IS_PARENT(t_Nodes1) ^
+                             ITC_PACKED_EVENT_NEON_IS_PARENT(t_Nodes2);
+        ITC_PACKED_EVENT_NEON_STORE(
+            &pt_Nodes[u32_Index],
+            ITC_PACKED_EVENT_NEON_MAX(t_Nodes1, t_Nodes2));
+    }
+
+    if (ITC_PACKED_EVENT_NEON_ANY(t_IsShapeMismatch))
+    {
+        *pb_IsShapeMismatch = true;
+    }
+
+    return u32_Index;
+}
+
+#endif /* ITC_PACKED_EVENT_USE_NEON */
+
+/**
+ * @brief Check if a packed Event is `less than or equal` (`<=`) to another
+ * packed Event with the same shape
+ *
+ * When both packed Events store their parent nodes at the same positions, they
+ * describe the same tree, and each leaf of the first Event is paired with the
+ * leaf covering the same interval in the second Event. Thus:
+ *  - leq(e1, e2) = e1[i] <= e2[i] for all `i`
+ *
+ * The nodes are compared using the fastest kernels available (see
+ * `ITC_CONFIG_PACKED_EVENT_SIMD`).
+ *
+ * @param pt_PackedEvent1 The first packed Event
+ * @param pt_PackedEvent2 The second packed Event
+ * @param pb_IsSameShape (out) `true` if both packed Events have the same
+ * shape. Otherwise `false` and `*pb_IsLeq` must be ignored
+ * @param pb_IsLeq (out) `true` if `*pt_PackedEvent1 <= *pt_PackedEvent2`.
+ * Otherwise `false`
+ */
+static void leqSameShapePackedEventE(
+    const ITC_PackedEvent_t *const pt_PackedEvent1,
+    const ITC_PackedEvent_t *const pt_PackedEvent2,
+    bool *const pb_IsSameShape,
+    bool *const pb_IsLeq
+)
+{
+    const ITC_Event_Counter_t *pt_Nodes1 = pt_PackedEvent1->pt_Nodes;
+    const ITC_Event_Counter_t *pt_Nodes2 = pt_PackedEvent2->pt_Nodes;
+    uint32_t u32_Length = pt_PackedEvent1->u32_Length;
+    uint32_t u32_Index = 0;
+    bool b_IsShapeMismatch = false;
+    bool b_IsGreater = false;
+
+    if (u32_Length != pt_PackedEvent2->u32_Length)
+    {
+        b_IsShapeMismatch = true;
+    }
+    else
+    {
+#if ITC_PACKED_EVENT_USE_AVX2
+        if (ITC_PACKED_EVENT_IS_AVX2_SUPPORTED())
+        {
+            u32_Index = leqPackedEventNodesAvx2(
+                pt_Nodes1,
+                pt_Nodes2,
+                u32_Index,
+                u32_Length,
+                &b_IsShapeMismatch,
+                &b_IsGreater);
+        }
+#endif /* ITC_PACKED_EVENT_USE_AVX2 */
+
+#if ITC_PACKED_EVENT_USE_SSE2
+        u32_Index = leqPackedEventNodesSse2(
+            pt_Nodes1,
+            pt_Nodes2,
+            u32_Index,
+            u32_Length,
+            &b_IsShapeMismatch,
+            &b_IsGreater);
+#endif /* ITC_PACKED_EVENT_USE_SSE2 */
+
+#if ITC_PACKED_EVENT_USE_NEON
+        u32_Index = leqPackedEventNodesNeon(
+            pt_Nodes1,
+            pt_Nodes2,
+            u32_Index,
+            u32_Length,
+            &b_IsShapeMismatch,
+            &b_IsGreater);
+#endif /* ITC_PACKED_EVENT_USE_NEON */
+
+        /* Compare the remaining nodes */
+        leqPackedEventNodesScalar(
+            pt_Nodes1,
+            pt_Nodes2,
+            u32_Index,
+            u32_Length,
+            &b_IsShapeMismatch,
+            &b_IsGreater);
+    }
+
+    *pb_IsSameShape = !b_IsShapeMismatch;
+    *pb_IsLeq = !b_IsGreater;
+}
+
+/**
+ * @brief Join two packed Events with the same shape into a new packed Event
+ *
+ * When both packed Events store their parent nodes at the same positions:
+ *  - join(e1, e2) = norm(max(e1[i], e2[i]) for all `i`)
+ *
+ * The nodes are joined using the fastest kernels available (see
+ * `ITC_CONFIG_PACKED_EVENT_SIMD`). The joined Event is only normalised if
+ * any of its `(n, m, m)` subtrees ended up with equal leaves.
+ *
+ * @param pt_PackedEvent1 The first packed Event
+ * @param pt_PackedEvent2 The second packed Event
+ * @param pt_PackedEvent The joined Event. Must be able to hold as many nodes as
+ * the source Events, otherwise the join is not attempted
+ * @param pb_IsSameShape (out) `true` if both packed Events have the same
+ * shape. Otherwise `false` and the joined Event must be ignored
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t joinSameShapePackedEventE(
+    const ITC_PackedEvent_t *const pt_PackedEvent1,
+    const ITC_PackedEvent_t *const pt_PackedEvent2,
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    bool *const pb_IsSameShape
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Event_Counter_t *pt_Nodes1 = pt_PackedEvent1->pt_Nodes;
+    const ITC_Event_Counter_t *pt_Nodes2 = pt_PackedEvent2->pt_Nodes;
+    ITC_Event_Counter_t *pt_Nodes = pt_PackedEvent->pt_Nodes;
+    uint32_t u32_Length = pt_PackedEvent1->u32_Length;
+    uint32_t u32_Index = 0;
+    bool b_IsShapeMismatch = false;
+    bool b_IsNormalised = true;
+
+    if (u32_Length != pt_PackedEvent2->u32_Length ||
+        u32_Length > pt_PackedEvent->u32_Capacity)
+    {
+        b_IsShapeMismatch = true;
+    }
+    else
+    {
+#if ITC_PACKED_EVENT_USE_AVX2
+        if (ITC_PACKED_EVENT_IS_AVX2_SUPPORTED())
+        {
+            u32_Index = joinPackedEventNodesAvx2(
+                pt_Nodes1,
+                pt_Nodes2,
+                pt_Nodes,
+                u32_Index,
+                u32_Length,
+                &b_IsShapeMismatch);
+        }
+#endif /* ITC_PACKED_EVENT_USE_AVX2 */
+
+#if ITC_PACKED_EVENT_USE_SSE2
+        u32_Index = joinPackedEventNodesSse2(
+            pt_Nodes1,
+            pt_Nodes2,
+            pt_Nodes,
+            u32_Index,
+            u32_Length,
+            &b_IsShapeMismatch);
+#endif /* ITC_PACKED_EVENT_USE_SSE2 */
+
+#if ITC_PACKED_EVENT_USE_NEON
+        u32_Index = joinPackedEventNodesNeon(
+            pt_Nodes1,
+            pt_Nodes2,
+            pt_Nodes,
+            u32_Index,
+            u32_Length,
+            &b_IsShapeMismatch);
+#endif /* ITC_PACKED_EVENT_USE_NEON */
+
+        /* Join the remaining nodes */
+        joinPackedEventNodesScalar(
+            pt_Nodes1,
+            pt_Nodes2,
+            pt_Nodes,
+            u32_Index,
+            u32_Length,
+            &b_IsShapeMismatch);
+    }
+
+    if (!b_IsShapeMismatch)
+    {
+        /* Look for `(n, m, m)` subtrees, the same way the validation does */
+        for (u32_Index = 0;
+             b_IsNormalised && (u32_Index + 2U) < u32_Length;
+             u32_Index++)
+        {
+            b_IsNormalised =
+                !ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[u32_Index]) ||
+                ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[u32_Index + 1U]) ||
+                pt_Nodes[u32_Index + 1U] != pt_Nodes[u32_Index + 2U];
+        }
+
+        pt_PackedEvent->u32_Length = u32_Length;
+
+        if (!b_IsNormalised)
+        {
+            /* Append the nodes again to normalise them on the spot. The
+             * nodes are never written past the one being read */
+            pt_PackedEvent->u32_Length = 0;
+
+            for (u32_Index = 0;
+                 t_Status == ITC_STATUS_SUCCESS && u32_Index < u32_Length;
+                 u32_Index++)
+            {
+                t_Status = appendPackedEventNode(
+                    pt_PackedEvent, pt_Nodes[u32_Index], NULL);
+            }
+        }
+    }
+
+    *pb_IsSameShape = !b_IsShapeMismatch;
+
+    return t_Status;
+}
+
+/**
+ * @brief Get the min absolute event count of a filled packed Event subtree
+ * without filling it
+ *
+ * The min of a parent is the min of its subtrees. The only exception are
+ * seed ID subtrees - when filled, their counts are never smaller than the min
+ * of their filled sibling, so they can be ignored.
+ *
+ * @note The ID subtree must not be a seed ID
+ * @param pt_Nodes The packed Event nodes
+ * @param pt_PackedId The packed ID
+ * @param u32_IdIndex The index of the root node of the ID subtree
+ * @param u32_EventIndex The index of the root node of the Event subtree
+ * @param pt_Min (out) The min event count of `fill(i, e)`
+ */
+static void getFilledPackedEventMin(
+    const ITC_Event_Counter_t *const pt_Nodes,
+    const ITC_PackedId_t *const pt_PackedId,
+    uint32_t u32_IdIndex,
+    uint32_t u32_EventIndex,
+    ITC_Event_Counter_t *const pt_Min
+)
+{
+    /* The number of subtree pairs that still need to be visited */
+    uint32_t u32_Pending = 1;
+    ITC_Event_Counter_t t_SubtreeMin;
+    ITC_Event_Counter_t t_SubtreeMax;
+    uint8_t u8_IdNode;
+
+    *pt_Min = ITC_PACKED_EVENT_PARENT_NODE;
+
+    while (u32_Pending)
+    {
+        u8_IdNode = ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_IdIndex);
+
+        /* min(fill(0, e)) = min(e)
+         * Seed ID subtrees are skipped */
+        if (u8_IdNode != ITC_PACKED_ID_PARENT_NODE)
+        {
+            getPackedEventSubtreeMinMax(
+                pt_Nodes, &u32_EventIndex, &t_SubtreeMin, &t_SubtreeMax);
+
+            if (u8_IdNode == ITC_PACKED_ID_NULL_NODE)
+            {
+                *pt_Min = MIN(*pt_Min, t_SubtreeMin);
+            }
+
+            u32_IdIndex++;
+            u32_Pending--;
+        }
+        /* min(fill(i, n)) = n */
+        else if (!ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[u32_EventIndex]))
+        {
+            *pt_Min = MIN(*pt_Min, pt_Nodes[u32_EventIndex]);
+
+            ITC_PackedId_skipSubtree(pt_PackedId, &u32_IdIndex);
+            u32_EventIndex++;
+            u32_Pending--;
+        }
+        else
+        {
+            u32_IdIndex++;
+            u32_EventIndex++;
+            u32_Pending++;
+        }
+    }
+}
+
+/**
+ * @brief Fill a packed Event in place
+ *
+ * Rules (with absolute event counts):
+ *  - fill(0, e) = e
+ *  - fill(1, e) = max(e)
+ *  - fill(i, n) = n
+ *  - fill((1, ir), (el, er)) = norm((max(max(el), min(er')), er')),
+ *        where er' = fill(ir, er)
+ *  - fill((il, 1), (el, er)) = norm((el', max(max(er), min(el')))),
+ *        where el' = fill(il, el)
+ *  - fill((il, ir), (el, er)) = norm((fill(il, el), fill(ir, er)))
+ *
+ * The ID and Event are traversed in pre-order in lockstep. A filled subtree
+ * never has more nodes than the original one, so the filled Event is written
+ * over the original Event without ever overwriting a node that has not been
+ * read yet. The output also doubles as the record of the already filled left
+ * siblings, which is what `fill((il, 1), (el, er))` needs.
+ *
+ * @param pt_PackedEvent The packed Event to fill
+ * @param pt_PackedId The packed ID
+ * @param pb_WasFilled (out) Whether the Event was filled or not
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t fillPackedEventE(
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    const ITC_PackedId_t *const pt_PackedId,
+    bool *const pb_WasFilled
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_Counter_t *pt_Nodes = pt_PackedEvent->pt_Nodes;
+    uint32_t u32_OriginalLength = pt_PackedEvent->u32_Length;
+    uint32_t u32_IdIndex = 0;
+    uint32_t u32_EventIndex = 0;
+    uint32_t u32_SiblingIndex;
+    /* The number of subtree pairs that still need to be filled */
+    uint32_t u32_Pending = 1;
+    ITC_Event_Counter_t t_Node;
+    ITC_Event_Counter_t t_Min;
+    ITC_Event_Counter_t t_Max;
+    uint8_t u8_IdNode;
+
+    *pb_WasFilled = false;
+
+    /* Start writing the filled Event from the beginning of the buffer */
+    pt_PackedEvent->u32_Length = 0;
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Pending)
+    {
+        u8_IdNode = ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_IdIndex);
+        t_Node = pt_Nodes[u32_EventIndex];
+
+        /* fill(0, e) = e */
+        if (u8_IdNode == ITC_PACKED_ID_NULL_NODE)
+        {
+            t_Status = copyPackedEventSubtree(
+                pt_Nodes, &u32_EventIndex, 0, pt_PackedEvent, pb_WasFilled);
+
+            u32_IdIndex++;
+            u32_Pending--;
+        }
+        else if (u8_IdNode == ITC_PACKED_ID_SEED_NODE)
+        {
+            getPackedEventSubtreeMinMax(
+                pt_Nodes, &u32_EventIndex, &t_Min, &t_Max);
+
+            /* fill(1, e) = max(e) */
+            t_Node = t_Max;
+
+            if (pt_PackedEvent->u32_Length == 0)
+            {
+                /* The root node. Nothing else to do */
+            }
+            /* Left child - fill((1, ir), (el, er)):
+             * max(max(el), min(er')) */
+            else if (ITC_PACKED_EVENT_IS_PARENT_NODE(
+                         pt_Nodes[pt_PackedEvent->u32_Length - 1]))
+            {
+                getFilledPackedEventMin(
+                    pt_Nodes,
+                    pt_PackedId,
+                    u32_IdIndex + 1,
+                    u32_EventIndex,
+                    &t_Min);
+
+                t_Node = MAX(t_Node, t_Min);
+            }
+            /* Right child - fill((il, 1), (el, er)):
+             * max(max(er), min(el')) */
+            else
+            {
+                /* el' has already been written */
+                findPackedEventParent(
+                    pt_Nodes, pt_PackedEvent->u32_Length, &u32_SiblingIndex);
+                u32_SiblingIndex++;
+
+                getPackedEventSubtreeMinMax(
+                    pt_Nodes, &u32_SiblingIndex, &t_Min, &t_Max);
+
+                t_Node = MAX(t_Node, t_Min);
+            }
+
+            t_Status = appendPackedEventNode(
+                pt_PackedEvent, t_Node, pb_WasFilled);
+
+            u32_IdIndex++;
+            u32_Pending--;
+        }
+        /* fill(i, n) = n */
+        else if (!ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node))
+        {
+            t_Status = appendPackedEventNode(
+                pt_PackedEvent, t_Node, pb_WasFilled);
+
+            ITC_PackedId_skipSubtree(pt_PackedId, &u32_IdIndex);
+            u32_EventIndex++;
+            u32_Pending--;
+        }
+        /* fill((il, ir), (el, er)) = norm((fill(il, el), fill(ir, er))) */
+        else
+        {
+            t_Status = appendPackedEventNode(
+                pt_PackedEvent, ITC_PACKED_EVENT_PARENT_NODE, pb_WasFilled);
+
+            u32_IdIndex++;
+            u32_EventIndex++;
+            u32_Pending++;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        pt_PackedEvent->u32_Length != u32_OriginalLength)
+    {
+        *pb_WasFilled = true;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Normalise the parents of a packed Event leaf after its event count
+ * has been increased
+ *
+ * @param pt_PackedEvent The packed Event
+ * @param u32_Index The index of the leaf
+ */
+static void normPackedEventLeaf(
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    uint32_t u32_Index
+)
+{
+    ITC_Event_Counter_t *pt_Nodes = pt_PackedEvent->pt_Nodes;
+    uint32_t u32_ParentIndex;
+    uint32_t u32_SiblingIndex;
+    bool b_IsDone = false;
+
+    while (!b_IsDone && u32_Index)
+    {
+        findPackedEventParent(pt_Nodes, u32_Index, &u32_ParentIndex);
+
+        /* The sibling is either the right or the left child */
+        if (u32_ParentIndex == u32_Index - 1)
+        {
+            u32_SiblingIndex = u32_Index + 1;
+        }
+        else
+        {
+            u32_SiblingIndex = u32_ParentIndex + 1;
+        }
+
+        /* norm((n, m, m)) = n + m.
+         * The left sibling is a leaf only if it is a single node */
+        if ((u32_SiblingIndex > u32_Index ||
+             u32_SiblingIndex == u32_Index - 1) &&
+            pt_Nodes[u32_SiblingIndex] == pt_Nodes[u32_Index])
+        {
+            pt_Nodes[u32_ParentIndex] = pt_Nodes[u32_Index];
+
+            /* Remove the 2 leaves */
+            memmove(
+                &pt_Nodes[u32_ParentIndex + 1],
+                &pt_Nodes[u32_ParentIndex + 3],
+                (pt_PackedEvent->u32_Length - u32_ParentIndex - 3) *
+                    sizeof(ITC_Event_Counter_t));
+            pt_PackedEvent->u32_Length -= 2;
+
+            u32_Index = u32_ParentIndex;
+        }
+        else
+        {
+            b_IsDone = true;
+        }
+    }
+}
+
+/**
+ * @brief Grow a packed Event in place
+ *
+ * Follows the same rules (and makes the same choices) as `growEventE`. Only a
+ * single path of the Event tree is ever modified, so the path is found
+ * first, expanding any leaves along it, and the leaf at its end is
+ * incremented.
+ *
+ * @param pt_PackedEvent The packed Event to grow
+ * @param pt_PackedId The packed ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t growPackedEventE(
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    const ITC_PackedId_t *const pt_PackedId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_Counter_t *pt_Nodes = pt_PackedEvent->pt_Nodes;
+    uint32_t u32_IdIndex = 0;
+    uint32_t u32_EventIndex = 0;
+    uint32_t u32_RightIdIndex;
+    bool b_IsDone = false;
+    uint8_t u8_IdNode;
+
+    /* See `growEventE` for details */
+    uint64_t u64_CostLeft = 0;
+    uint64_t u64_CostRight = 0;
+    uint64_t *pu64_CostPtr = &u64_CostLeft;
+
+    while (t_Status == ITC_STATUS_SUCCESS && !b_IsDone)
+    {
+        u8_IdNode = ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_IdIndex);
+
+        /* There is nothing to grow with a NULL ID */
+        if (u8_IdNode == ITC_PACKED_ID_NULL_NODE)
+        {
+            b_IsDone = true;
+        }
+        else if (!ITC_PACKED_EVENT_IS_PARENT_NODE(pt_Nodes[u32_EventIndex]))
+        {
+            /* grow(1, n) = (n + 1, 0) */
+            if (u8_IdNode == ITC_PACKED_ID_SEED_NODE)
+            {
+                if (pt_Nodes[u32_EventIndex] >=
+                    ITC_PACKED_EVENT_PARENT_NODE - 1)
+                {
+                    t_Status = ITC_STATUS_EVENT_COUNTER_OVERFLOW;
+                }
+                else
+                {
+                    pt_Nodes[u32_EventIndex]++;
+
+                    normPackedEventLeaf(pt_PackedEvent, u32_EventIndex);
+
+                    b_IsDone = true;
+                }
+            }
+            /* grow(i, n) = (e', c + N), where (e', c) = grow(i, (n, 0, 0)) */
+            else if (pt_PackedEvent->u32_Capacity -
+                         pt_PackedEvent->u32_Length < 2U)
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            else
+            {
+                /* Make room for the 2 new leaves */
+                memmove(
+                    &pt_Nodes[u32_EventIndex + 3],
+                    &pt_Nodes[u32_EventIndex + 1],
+                    (pt_PackedEvent->u32_Length - u32_EventIndex - 1) *
+                        sizeof(ITC_Event_Counter_t));
+                pt_PackedEvent->u32_Length += 2;
+
+                pt_Nodes[u32_EventIndex + 1] = pt_Nodes[u32_EventIndex];
+                pt_Nodes[u32_EventIndex + 2] = pt_Nodes[u32_EventIndex];
+                pt_Nodes[u32_EventIndex] = ITC_PACKED_EVENT_PARENT_NODE;
+
+                *pu64_CostPtr += UINT32_MAX;
+
+                /* Run through the cases again with e' (a parent node) */
+            }
+        }
+        else
+        {
+            u32_RightIdIndex = u32_IdIndex + 1;
+            ITC_PackedId_skipSubtree(pt_PackedId, &u32_RightIdIndex);
+
+            /* The left Event subtree follows the parent node */
+            u32_EventIndex++;
+
+            /* grow((0, ir), (n, el, er)) or
+             * grow((il, ir), (n, el, er)) with cl >= cr:
+             * ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er) */
+            if (ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_IdIndex + 1) ==
+                    ITC_PACKED_ID_NULL_NODE ||
+                (ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_RightIdIndex) !=
+                    ITC_PACKED_ID_NULL_NODE &&
+                 u64_CostLeft >= u64_CostRight))
+            {
+                u32_IdIndex = u32_RightIdIndex;
+                skipPackedEventSubtree(pt_Nodes, &u32_EventIndex);
+                pu64_CostPtr = &u64_CostRight;
+            }
+            /* grow((il, 0), (n, el, er)) or
+             * grow((il, ir), (n, el, er)) with cl < cr:
+             * ((n, el', er), cl + 1), where (el', cl) = grow(il, el) */
+            else
+            {
+                u32_IdIndex++;
+                pu64_CostPtr = &u64_CostLeft;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Pack an existing ITC Event
+ *
+ * @param pt_Event The Event to pack
+ * @param pt_PackedEvent The packed Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the absolute event count of a
+ * leaf cannot be represented
+ */
+static ITC_Status_t packEventI(
+    const ITC_Event_t *pt_Event,
+    ITC_PackedEvent_t *const pt_PackedEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Event_Counter_t t_Limit = ITC_PACKED_EVENT_PARENT_NODE;
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The absolute event count of the current node */
+    ITC_Event_Counter_t t_Count = 0;
+
+    pt_PackedEvent->u32_Length = 0;
+
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event)
+    {
+        /* Leaf counts must stay below `ITC_PACKED_EVENT_PARENT_NODE`. The
+         * count of a normalised parent is the min count of its leaves, so
+         * the same limit applies */
+        if (pt_Event->t_Count >= t_Limit - t_Count)
+        {
+            t_Status = ITC_STATUS_EVENT_COUNTER_OVERFLOW;
+        }
+        else
+        {
+            t_Count += pt_Event->t_Count;
+
+            t_Status = appendPackedEventNode(
+                pt_PackedEvent,
+                (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+                    ? ITC_PACKED_EVENT_PARENT_NODE
+                    : t_Count,
+                NULL);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Descend into left tree */
+            if (pt_Event->pt_Left)
+            {
+                /* Remember the parent address */
+                pt_CurrentEventParent = pt_Event;
+
+                pt_Event = pt_Event->pt_Left;
+            }
+            else
+            {
+                t_Count -= pt_Event->t_Count;
+
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (pt_CurrentEventParent &&
+                       pt_CurrentEventParent->pt_Right == pt_Event)
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+
+                    t_Count -= pt_Event->t_Count;
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (pt_CurrentEventParent)
+                {
+                    pt_Event = pt_CurrentEventParent->pt_Right;
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        pt_PackedEvent->u32_Length = 0;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Unpack a packed Event into a newly allocated ITC Event
+ *
+ * The leaves are first allocated with their absolute event counts. Once
+ * both subtrees of a parent are complete, `liftSinkSinkEvent` turns them
+ * into counts relative to the parent.
+ *
+ * @param pt_PackedEvent The packed Event
+ * @param ppt_Event (out) The pointer to the unpacked Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t unpackEventI(
+    const ITC_PackedEvent_t *const pt_PackedEvent,
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t **ppt_CurrentEvent = ppt_Event;
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    ITC_Event_t *pt_CurrentEvent;
+    ITC_Event_Counter_t t_Node;
+    uint32_t u32_Index = 0;
+
+    *ppt_Event = NULL;
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_Index < pt_PackedEvent->u32_Length)
+    {
+        t_Node = pt_PackedEvent->pt_Nodes[u32_Index];
+
+        t_Status = newEvent(
+            ppt_CurrentEvent,
+            pt_CurrentEventParent,
+            (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node)) ? 0 : t_Node,
+            ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* The left subtree follows the parent node */
+            if (ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node))
+            {
+                pt_CurrentEventParent = *ppt_CurrentEvent;
+                ppt_CurrentEvent = &pt_CurrentEventParent->pt_Left;
+            }
+            else
+            {
+                pt_CurrentEvent = *ppt_CurrentEvent;
+
+                /* Climb back up while the node is a right child. Right child
+                 * nodes are only allocated after their left siblings are
+                 * complete */
+                while (t_Status == ITC_STATUS_SUCCESS &&
+                       pt_CurrentEventParent &&
+                       pt_CurrentEventParent->pt_Right == pt_CurrentEvent)
+                {
+                    pt_CurrentEvent = pt_CurrentEventParent;
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+
+                    /* Both subtrees are complete */
+                    t_Status = liftSinkSinkEvent(pt_CurrentEvent);
+                }
+
+                /* The right subtree follows the complete left subtree */
+                if (pt_CurrentEventParent)
+                {
+                    ppt_CurrentEvent = &pt_CurrentEventParent->pt_Right;
+                }
+            }
+        }
+
+        u32_Index++;
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the unpacking failed, rather than the destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Allocate a new ITC Event and initialise it
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_new(
+    ITC_Event_t **const ppt_Event
+)
+{
+    if (!ppt_Event)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return newEvent(ppt_Event, NULL, 0, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+}
+
+/******************************************************************************
+ * Free an allocated ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_destroy(
+    ITC_Event_t **const ppt_Event
+)
+{
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    /* Only deallocate the Event tree once the last reference is released */
+    if (ppt_Event && *ppt_Event && releaseSharedEvent(*ppt_Event))
+    {
+        *ppt_Event = NULL;
+        return ITC_STATUS_SUCCESS;
+    }
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+
+    return destroyEvent(ppt_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+}
+
+/******************************************************************************
+ * Clone an existing ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_clone(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t **const ppt_ClonedEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_ClonedEvent)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_cloneValidated(pt_Event, ppt_ClonedEvent);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Clone an Event that has already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_cloneValidated(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t **const ppt_ClonedEvent
+)
+{
+    if (!pt_Event || !ppt_ClonedEvent)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return cloneEvent(
+        pt_Event, ppt_ClonedEvent, NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+}
+
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+
+/******************************************************************************
+ * Share an Event tree instead of cloning it
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_share(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t **const ppt_SharedEvent
+)
+{
+    /* The share count is the only member modified through a shared
+     * reference. Everything else is treated as immutable */
+    ITC_Event_t *pt_MutableEvent = (ITC_Event_t *)(uintptr_t)pt_Event;
+    uint32_t u32_ShareCount;
+    bool b_Shared = false;
+
+    if (!pt_Event || !ppt_SharedEvent)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    u32_ShareCount = __atomic_load_n(
+        &pt_MutableEvent->u32_ShareCount, __ATOMIC_RELAXED);
+
+    while (u32_ShareCount < UINT32_MAX && !b_Shared)
+    {
+        /* On failure `u32_ShareCount` is updated with the current value */
+        b_Shared = __atomic_compare_exchange_n(
+            &pt_MutableEvent->u32_ShareCount,
+            &u32_ShareCount,
+            u32_ShareCount + 1,
+            false,
+            __ATOMIC_RELAXED,
+            __ATOMIC_RELAXED);
+    }
+
+    if (!b_Shared)
+    {
+        /* The share count is saturated. Fall back to a deep copy */
+        return cloneEvent(
+            pt_Event, ppt_SharedEvent, NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+    }
+
+    *ppt_SharedEvent = pt_MutableEvent;
+
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Make sure an Event tree is not shared, so it can be modified in place
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_unshare(
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_PrivateEvent = NULL;
+
+    if (!ppt_Event || !*ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (ITC_Event_isShared(*ppt_Event))
+    {
+        t_Status = cloneEvent(
+            *ppt_Event,
+            &pt_PrivateEvent,
+            NULL,
+            ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Release the shared reference. If the other references were
+             * released in the meantime, this deallocates the original */
+            (void)ITC_Event_destroy(ppt_Event);
+            *ppt_Event = pt_PrivateEvent;
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check if an Event tree is shared
+ ******************************************************************************/
+
+bool ITC_Event_isShared(
+    const ITC_Event_t *const pt_Event
+)
+{
+    return pt_Event &&
+           __atomic_load_n(&pt_Event->u32_ShareCount, __ATOMIC_ACQUIRE) > 0;
+}
+
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+
+/******************************************************************************
+ * Validate an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_validate(
+    const ITC_Event_t *const pt_Event
+)
+{
+    return validateEvent(pt_Event, true);
+}
+
+/******************************************************************************
+ * Join two existing Events into a single Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_join(
+    ITC_Event_t **const ppt_Event,
+    ITC_Event_t **const ppt_OtherEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Event || !ppt_OtherEvent)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Make sure the join cannot fail halfway through */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_validateForJoin(*ppt_Event);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_validateForJoin(*ppt_OtherEvent);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_joinValidated(ppt_Event, ppt_OtherEvent);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Validate an Event and check it can be joined in place
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_validateForJoin(
+    const ITC_Event_t *const pt_Event
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateEvent(pt_Event, true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = checkEventCountersE(pt_Event, 0);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Join two Events that have already been validated in place
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_joinValidated(
+    ITC_Event_t **const ppt_Event,
+    ITC_Event_t **const ppt_OtherEvent
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = joinValidatedEvents(ppt_Event, ppt_OtherEvent);
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_NORMALISE);
+
+        /* The join only marked the nodes it touched as dirty */
+        t_Status = normEventE(*ppt_Event);
+
+        ITC_PORT_TRACE_END(
+            ITC_PORT_TRACE_PHASE_EVENT_NORMALISE,
+            (t_Status == ITC_STATUS_SUCCESS) ? countEventNodes(*ppt_Event) : 0);
+    }
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+
+/******************************************************************************
+ * Join two Events that have already been validated in place, but do not
+ * normalise the joined Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_joinValidatedLazy(
+    ITC_Event_t **const ppt_Event,
+    ITC_Event_t **const ppt_OtherEvent
+)
+{
+    return joinValidatedEvents(ppt_Event, ppt_OtherEvent);
+}
+
+/******************************************************************************
+ * Normalise the dirty nodes of an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_normaliseDirty(
+    ITC_Event_t *const pt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    /* The dirty nodes always extend up to the root */
+    else if (pt_Event->b_IsDirty)
+    {
+        ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_NORMALISE);
+
+        t_Status = normEventE(pt_Event);
+
+        ITC_PORT_TRACE_END(
+            ITC_PORT_TRACE_PHASE_EVENT_NORMALISE,
+            (t_Status == ITC_STATUS_SUCCESS) ? countEventNodes(pt_Event) : 0);
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+/******************************************************************************
+ * Join two Events similar to ::ITC_Event_join() but do not modify the source Events
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_joinConst(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    uint32_t u32_ScratchMarker; /* The scratch arena position to reset to */
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+        t_Status = ITC_Port_arenaBegin(&u32_ScratchMarker);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = joinEventE(pt_Event1, pt_Event2, ppt_Event);
+
+            /* Release the temporary copies made during the join operation.
+             * There is nothing else to do if the reset fails */
+            (void)ITC_Port_arenaReset(u32_ScratchMarker);
+        }
+#else
+        t_Status = joinEventE(pt_Event1, pt_Event2, ppt_Event);
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check if an Event is `less than or equal` (`<=`) to another Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_leq(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    bool *const pb_IsLeq
+
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pb_IsLeq)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check if `pt_Event1 <= pt_Event2` */
+        t_Status = leqEventE(pt_Event1, pt_Event2, pb_IsLeq);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check if two Events are `<=` to each other in both directions
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_leqBidirectional(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    bool *const pb_IsLeq12,
+    bool *const pb_IsLeq21
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pb_IsLeq12 || !pb_IsLeq21)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_leqBidirectionalValidated(
+            pt_Event1, pt_Event2, pb_IsLeq12, pb_IsLeq21);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check if two already validated Events are `<=` to each other in both
+ * directions
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_leqBidirectionalValidated(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    bool *const pb_IsLeq12,
+    bool *const pb_IsLeq21
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pt_Event1 || !pt_Event2 || !pb_IsLeq12 || !pb_IsLeq21)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_COMPARE);
+
+    t_Status = leqBidirectionalEventE(
+        pt_Event1, pt_Event2, pb_IsLeq12, pb_IsLeq21);
+
+    /* The Events are never modified, so they can always be counted */
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_EVENT_COMPARE,
+        countEventNodes(pt_Event1) + countEventNodes(pt_Event2));
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Fill an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_fill(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    bool *const pb_WasFilled
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pb_WasFilled || !ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Validate the ID */
+        t_Status = ITC_Id_validate(pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = fillEventE(ppt_Event, pt_Id, pb_WasFilled);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Grow an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_grow(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *const pt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Validate the ID */
+        t_Status = ITC_Id_validate(pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = growEventE(ppt_Event, pt_Id, 1);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Add a number of events to an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_fillAndGrow(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    const ITC_Event_Counter_t t_EventCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Validate the ID */
+        t_Status = ITC_Id_validate(pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_fillAndGrowValidated(
+            ppt_Event, pt_Id, t_EventCount);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Add a number of events to an Event that has already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_fillAndGrowValidated(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    const ITC_Event_Counter_t t_EventCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Event || !*ppt_Event || !pt_Id)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Adding `k` events never raises any absolute event count above
+     * `max(e) + k`. Checking every leaf has room for all the events guarantees
+     * growing a filled Event cannot overflow halfway through the operation.
+     * A single event is left to the overflow checks of fill and grow */
+    if (t_Status == ITC_STATUS_SUCCESS && t_EventCount > 1)
+    {
+        t_Status = checkEventCountersE(*ppt_Event, t_EventCount);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && t_EventCount > 0)
+    {
+        t_Status = fillAndGrowEventE(ppt_Event, pt_Id, t_EventCount);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Compact an Event that has already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_compactValidated(
+    ITC_Event_t *const pt_Event,
+    const ITC_Id_t *const pt_Id,
+    const uint32_t u32_MaxDepth,
+    uint32_t *const pu32_ReclaimedNodes
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_NodeCount = 0;
+
+    if (!pt_Event || !pt_Id || !pu32_ReclaimedNodes)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Collapsing a subtree never raises an absolute event count above
+     * `max(e)`. Checking the counters beforehand guarantees the Event cannot be
+     * left half compacted */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_ReclaimedNodes = 0;
+
+        t_Status = checkEventCountersE(pt_Event, 0);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        u32_NodeCount = countEventNodes(pt_Event);
+
+        ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_EVENT_COMPACT);
+
+        t_Status = compactEventE(pt_Event, pt_Id, u32_MaxDepth);
+
+        ITC_PORT_TRACE_END(
+            ITC_PORT_TRACE_PHASE_EVENT_COMPACT,
+            (t_Status == ITC_STATUS_SUCCESS) ? countEventNodes(pt_Event) : 0);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_ReclaimedNodes = u32_NodeCount - countEventNodes(pt_Event);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+
+/******************************************************************************
+ * Get the bounds of the absolute event counts of an Event in equally sized
+ * cells
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_getCellBounds(
+    const ITC_Event_t *const pt_Event,
+    const uint32_t u32_Depth,
+    ITC_Event_Counter_t *const pt_Min,
+    ITC_Event_Counter_t *const pt_Max
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Event || u32_Depth >= 32U || !pt_Min || !pt_Max)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Checking the counters beforehand guarantees the bounds are either fully
+     * written or not at all */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = checkEventCountersE(pt_Event, 0);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        getEventCellBoundsE(pt_Event, u32_Depth, pt_Min, pt_Max);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+
+/******************************************************************************
+ * Rebase an Event that has already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_rebaseValidated(
+    const ITC_Event_t *const pt_Event,
+    const ITC_Event_t *const pt_Base,
+    const bool b_Restore,
+    ITC_Event_t **const ppt_RebasedEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Event || !pt_Base || !ppt_RebasedEvent)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* The walk relies on the absolute event counts of both Events being
+     * representable */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = checkEventCountersE(pt_Event, 0);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = checkEventCountersE(pt_Base, 0);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Rebase a copy, so the Event is left unmodified on failure */
+        t_Status = cloneEvent(
+            pt_Event, ppt_RebasedEvent, NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = rebaseEventE(*ppt_RebasedEvent, pt_Base, b_Restore);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* There is nothing else to do if the destroy fails. Also it is
+             * more important to convey the rebase failed, rather than the
+             * destroy */
+            (void)ITC_Event_destroy(ppt_RebasedEvent);
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+#if ITC_CONFIG_ENABLE_TRACING || ITC_CONFIG_ENABLE_NODE_RESERVATION || \
+    ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+
+/******************************************************************************
+ * Count the nodes of an Event
+ ******************************************************************************/
+
+uint32_t ITC_Event_countNodes(
+    const ITC_Event_t *const pt_Event
+)
+{
+    return (pt_Event) ? countEventNodes(pt_Event) : 0;
+}
 
-                    u64_CostLeft++;
+#endif /* ITC_CONFIG_ENABLE_TRACING || ITC_CONFIG_ENABLE_NODE_RESERVATION || ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
 
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
-                }
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+
+/******************************************************************************
+ * Find the Event leaf inflated by adding a new event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_findInflationLeaf(
+    ITC_Event_t *const pt_Event,
+    const ITC_Id_t *const pt_Id,
+    ITC_Event_t **const ppt_InflationLeaf
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_CurrentEvent = pt_Event;
+    const ITC_Event_t *pt_SiblingEvent = NULL;
+    const ITC_Id_t *pt_CurrentId = pt_Id;
+
+    /* Both the Event and ID have already been validated by the caller */
+    if (!pt_Event || !pt_Id || !ppt_InflationLeaf)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *ppt_InflationLeaf = NULL;
+
+        /* Follow the path to the only seed leaf of the ID. Both fill and grow
+         * only descend into the non-null subtree of `(0, i)` and `(i, 0)` IDs,
+         * so nothing outside of this path is ever modified */
+        while (pt_CurrentId &&
+               ITC_ID_IS_PARENT_ID(pt_CurrentId) &&
+               ITC_EVENT_IS_PARENT_EVENT(pt_CurrentEvent))
+        {
+            if (ITC_ID_IS_NULL_ID(pt_CurrentId->pt_Left))
+            {
+                pt_CurrentId = pt_CurrentId->pt_Right;
+                pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+            }
+            else if (ITC_ID_IS_NULL_ID(pt_CurrentId->pt_Right))
+            {
+                pt_CurrentId = pt_CurrentId->pt_Left;
+                pt_CurrentEvent = pt_CurrentEvent->pt_Left;
             }
-            /* grow((il, ir), (n, el, er)):
-             *  - If cl < cr:
-             *    ((n, el', er), cl + 1), where (el', cl) = grow(il, el)
-             *  - If cl >= cr:
-             *    ((n, el, er'), cr + 1), where (er', cr) = grow(ir, er) */
             else
             {
-                if (pt_PrevId != pt_Id->pt_Left && pt_PrevId != pt_Id->pt_Right)
-                {
-                    pt_PrevId = pt_Id;
-
-                    /* cl < cr; (el', cl) = grow(il, el) */
-                    if (u64_CostLeft < u64_CostRight)
-                    {
-                        pt_Id = pt_Id->pt_Left;
-                        pt_CurrentEvent = pt_CurrentEvent->pt_Left;
-                        pu64_CostPtr = &u64_CostLeft;
-                    }
-                    /* cl >= cr; (er', cr) = grow(ir, er) */
-                    else
-                    {
-                        pt_Id = pt_Id->pt_Right;
-                        pt_CurrentEvent = pt_CurrentEvent->pt_Right;
-                        pu64_CostPtr = &u64_CostRight;
-                    }
-                }
-                else
-                {
-                    /* cl < cr; ((n, el', er), cl + 1) */
-                    if (pt_PrevId == pt_Id->pt_Left)
-                    {
-                        u64_CostLeft++;
-                    }
-                    /* cl >= cr; ((n, el, er'), cr + 1) */
-                    else
-                    {
-                        u64_CostRight++;
-                    }
+                /* The ID owns more than one interval */
+                pt_CurrentId = NULL;
+            }
+        }
 
-                    pt_PrevId = pt_Id;
+        /* The Event leaf must line up with the seed leaf of the ID:
+         * - If it is higher up the tree, grow(i, n) expands the Event
+         * - If it is further down the tree, fill(1, e) maximises the Event
+         *
+         * Additionally, the sibling leaf (which is not owned by the ID) must
+         * have a relative event count of 0, i.e. `min(sibling) <= leaf`.
+         * Otherwise fill((1, 0), (n, el, er)) lifts the leaf instead.
+         *
+         * When all of these hold, fill is a no-op and grow(1, n) increments the
+         * leaf. Neither condition changes after the increment, so this keeps
+         * applying to all subsequent events */
+        if (pt_CurrentId &&
+            ITC_ID_IS_SEED_ID(pt_CurrentId) &&
+            ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent))
+        {
+            if (pt_CurrentEvent != pt_Event)
+            {
+                pt_SiblingEvent =
+                    (pt_CurrentEvent->pt_Parent->pt_Left == pt_CurrentEvent)
+                        ? pt_CurrentEvent->pt_Parent->pt_Right
+                        : pt_CurrentEvent->pt_Parent->pt_Left;
+            }
 
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
-                }
+            if (!pt_SiblingEvent || pt_SiblingEvent->t_Count == 0)
+            {
+                *ppt_InflationLeaf = pt_CurrentEvent;
             }
         }
+    }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
+    return t_Status;
+}
+
+/******************************************************************************
+ * Add new events by incrementing a previously found inflation leaf
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_inflateLeaf(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t *const pt_InflationLeaf,
+    const ITC_Event_Counter_t t_EventCount,
+    bool *const pb_WasInflated
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Event_t *pt_CurrentEvent = pt_InflationLeaf;
+
+    if (!pt_Event || !pt_InflationLeaf || !pb_WasInflated)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pb_WasInflated = false;
+
+        /* Make sure the leaf is still part of the Event tree */
+        while (pt_CurrentEvent->pt_Parent)
         {
-            /* Destroy the cloned Event
-             * Ignore return statuses. There is nothing else to do if the
-             * destroy fails. Also it is more important to convey that the
-             * overall fill operation succeeded */
-            (void)ITC_Event_destroy(&pt_ClonedEvent);
+            pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
         }
-        else
+
+        if (pt_CurrentEvent == pt_Event &&
+            ITC_EVENT_IS_LEAF_EVENT(pt_InflationLeaf))
         {
-            /* Destroy the original Event
-            * Ignore return statuses. There is nothing else to do if the destroy
-            * fails. Also it is more important to convey why the grow operation
-            * failed */
-            (void)ITC_Event_destroy(ppt_Event);
+            /* Refuse adding multiple events under the same conditions as
+             * `ITC_Event_fillAndGrow` */
+            if (t_EventCount > 1)
+            {
+                t_Status = checkEventCountersE(pt_Event, t_EventCount);
+            }
 
-            /* Replace the original event with the clone */
-            *ppt_Event = pt_ClonedEvent;
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* grow(1, n) = (n + k, 0) */
+                t_Status = incEventCounter(
+                    &pt_InflationLeaf->t_Count, t_EventCount);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+                updateEventAncestorsChildrenMax(pt_InflationLeaf);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+                *pb_WasInflated = true;
+            }
         }
     }
 
     return t_Status;
 }
 
-/**
- * @brief Serialise an Event counter in network-endian
- *
- * @param t_Counter The counter to serialise
- * @param pu8_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
- */
-static ITC_Status_t eventCounterToNetwork(
-    ITC_Event_Counter_t t_Counter,
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+
+/******************************************************************************
+ * Serialise an existing ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_serialiseEvent(
+    const ITC_Event_t *const pt_Event,
     uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize
+    uint32_t *const pu32_BufferSize,
+    const bool b_AddVersion
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Event_t *pt_EventCopy = NULL;
+    const ITC_Event_t *pt_NormalisedEvent = NULL;
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        pu8_Buffer,
+        pu32_BufferSize,
+        (b_AddVersion) ? ITC_SERDES_EVENT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
+                       : ITC_SERDES_EVENT_MIN_BUFFER_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedEvent(
+            pt_Event, &pt_EventCopy, &pt_NormalisedEvent);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseEvent(
+            pt_NormalisedEvent, pu8_Buffer, pu32_BufferSize, b_AddVersion);
+    }
+
+    releaseNormalisedEvent(&pt_EventCopy);
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the size of an existing ITC Event once serialised
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_getSerialisedEventSize(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_Size,
+    const bool b_AddVersion
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Event_Counter_t t_CounterCopy = t_Counter;
-    /* The number of bytes needed to serialise the counter */
-    uint32_t u32_BytesNeeded = 0;
+    ITC_Event_t *pt_EventCopy = NULL;
+    const ITC_Event_t *pt_NormalisedEvent = NULL;
 
-    /* Determine the bytes needed to serialise the counter */
-    do
+    if (!pu32_Size)
     {
-        t_CounterCopy >>= 8U;
-        u32_BytesNeeded++;
-    } while (t_CounterCopy != 0);
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
-    if (u32_BytesNeeded > *pu32_BufferSize)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        t_Status = validateEvent(pt_Event, true);
     }
-    else
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Serialise in network-endian */
-        for (uint32_t u32_I = u32_BytesNeeded; u32_I > 0; u32_I--)
-        {
-            pu8_Buffer[u32_I - 1] = (uint8_t)(t_Counter & 0xFFU);
-            t_Counter >>= 8U;
-        }
+        t_Status = getNormalisedEvent(
+            pt_Event, &pt_EventCopy, &pt_NormalisedEvent);
+    }
 
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_BytesNeeded;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        getSerialisedEventSize(pt_NormalisedEvent, b_AddVersion, pu32_Size);
     }
 
+    releaseNormalisedEvent(&pt_EventCopy);
+
     return t_Status;
 }
 
-/**
- * @brief Deserialise an Event counter from network-endian
- *
- * @param pu8_Buffer The buffer holding the serialised data
- * @param u32_BufferSize The size of the buffer in bytes
- * @param pt_Counter The pointer to the counter
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if
- * `u32_BufferSize > sizeof(ITC_Event_Counter_t)`
- */
-static ITC_Status_t eventCounterFromNetwork(
+/******************************************************************************
+ * Deserialise an ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_deserialiseEvent(
     const uint8_t *const pu8_Buffer,
     const uint32_t u32_BufferSize,
-    ITC_Event_Counter_t *const pt_Counter
+    const bool b_HasVersion,
+    ITC_Event_t **const ppt_Event
 )
 {
-    if (u32_BufferSize > sizeof(ITC_Event_Counter_t))
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+
+    if (!ppt_Event)
     {
-        /* The counter size is not supported on this platform */
-        return ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE;
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    /* Init the counter */
-    *pt_Counter = 0;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer,
+            &u32_BufferSize,
+            (b_HasVersion) ? ITC_SERDES_EVENT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
+                           : ITC_SERDES_EVENT_MIN_BUFFER_LEN,
+            false);
+    }
 
-    /* Deserialise from network-endian */
-    for (uint32_t u32_I = 0; u32_I < u32_BufferSize; u32_I++)
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    /* The version field selects the format */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        b_HasVersion &&
+        (pu8_Buffer[0] & ITC_SERDES_COMPACT_FORMAT_FLAG))
     {
-        *pt_Counter <<= 8U;
-        *pt_Counter |= pu8_Buffer[u32_I];
+        t_Status = deserialiseVersionedEventCompact(
+            &pu8_Buffer[0], u32_BufferSize, ppt_Event);
+    }
+    else
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseEvent(
+            pu8_Buffer, u32_BufferSize, b_HasVersion, ppt_Event);
     }
 
-    return ITC_STATUS_SUCCESS;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        refreshEventChildrenMaxE(*ppt_Event);
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+    return t_Status;
 }
 
-/**
- * @brief Serialise an existing ITC Event
- *
- * Data format:
- *  - Byte 0: The major component of the version of the `libitc` library used to
- *      serialise the data. Optional, can be ommitted.
- *  - Bytes (0 - 1) - N (see above): The Event tree.
- *    Each node of the Event tree is serialised in pre-order. I.e the root is
- *    serialised first, followed by the left child, then the right child. Each
- *    serialised node consists of:
- *    - Byte 0: The Event node header.
- *      Contains an `IS_PARENT` flag (bit 0), and the length of the encoded
- *      event counter (bits 1 - 4). See define ITC_SERDES_CREATE_EVENT_HEADER.
- *      If the node event counter is `0`, this length is also set to 0 and the
- *      next field (shown below) is ommitted. Bits 5 - 7 are reserved and always
- *      0.
- *    - Bytes 1 - 4: The node event count.
- *      Can be 0 - 4 bytes long. The length of this field is encoded in the
- *      Event header (see above). Serialised in network-endian. Optional,
- *      ommitted if the node event counter is 0.
- *
- * @param ppt_Event The pointer to the Event
- * @param pu8_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
- * the output.
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
- */
-static ITC_Status_t serialiseEvent(
-    const ITC_Event_t *pt_Event,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize,
-    const bool b_AddVersion
+/******************************************************************************
+ * Check if a serialised Event is `<=` to another serialised Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_leqSerialisedEvents(
+    const uint8_t *const pu8_Buffer1,
+    const uint32_t u32_BufferSize1,
+    const uint8_t *const pu8_Buffer2,
+    const uint32_t u32_BufferSize2,
+    const bool b_HasVersion,
+    bool *const pb_IsLeq12,
+    bool *const pb_IsLeq21
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    /* The parent of the current Event */
-    const ITC_Event_t *pt_CurrentEventParent = NULL;
-    /* The parent of the root node */
-    const ITC_Event_t *pt_RootEventParent = NULL;
-    uint32_t u32_Offset = 0; /* The current offset */
-    uint32_t u32_CurrentEventCounterSize;
+    /* The offset of the Event tree inside the buffers */
+    uint32_t u32_Offset = (b_HasVersion) ? ITC_VERSION_MAJOR_LEN : 0;
 
-    /* Remember the root parent as this might be a subtree */
-    pt_RootEventParent = pt_Event->pt_Parent;
+    if (!pb_IsLeq12)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
-    if (b_AddVersion)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Prepend the lib version (provided by build system c args) */
-        pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer1,
+            &u32_BufferSize1,
+            ITC_SERDES_EVENT_MIN_BUFFER_LEN + u32_Offset,
+            false);
+    }
 
-        /* Increment offset */
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer2,
+            &u32_BufferSize2,
+            ITC_SERDES_EVENT_MIN_BUFFER_LEN + u32_Offset,
+            false);
     }
 
-    /* Perform a pre-order traversal */
-    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    /* If input contains a version check it matches the current lib version
+     * (provided by build system c args) */
+    if (t_Status == ITC_STATUS_SUCCESS && b_HasVersion)
     {
-        if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
-        {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-        }
-        /* Serialise the Event counter */
-        else if (pt_Event->t_Count > 0)
-        {
-            /* Calculate the remaining space in the buffer, while leaving space
-             * for the header */
-            u32_CurrentEventCounterSize =
-                *pu32_BufferSize -
-                (u32_Offset + (uint32_t)sizeof(ITC_SerDes_Header_t));
+        t_Status = ITC_SerDes_Util_validateDesLibVersion(pu8_Buffer1[0]);
 
-            /* Serialise the event counter */
-            t_Status = eventCounterToNetwork(
-                pt_Event->t_Count,
-                &pu8_Buffer[u32_Offset + sizeof(ITC_SerDes_Header_t)],
-                &u32_CurrentEventCounterSize);
-        }
-        /* Special case - the Event counter is 0, nothing to serialise */
-        else
+        if (t_Status == ITC_STATUS_SUCCESS)
         {
-            u32_CurrentEventCounterSize = 0;
+            t_Status = ITC_SerDes_Util_validateDesLibVersion(pu8_Buffer2[0]);
         }
+    }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Create the header */
-            pu8_Buffer[u32_Offset] = ITC_SERDES_CREATE_EVENT_HEADER(
-                ITC_EVENT_IS_PARENT_EVENT(pt_Event),
-                u32_CurrentEventCounterSize);
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateSerialisedEvent(
+            &pu8_Buffer1[u32_Offset], u32_BufferSize1 - u32_Offset);
+    }
 
-            /* Increment the offset */
-            u32_Offset += (uint32_t)sizeof(ITC_SerDes_Header_t) +
-                          u32_CurrentEventCounterSize;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateSerialisedEvent(
+            &pu8_Buffer2[u32_Offset], u32_BufferSize2 - u32_Offset);
+    }
 
-            /* Descend into left tree */
-            if (pt_Event->pt_Left)
-            {
-                pt_Event = pt_Event->pt_Left;
-            }
-            /* Valid parent ITC Event trees always have both left and right
-            * nodes. Thus, there is no need to check if the current node
-            * doesn't have a left child but has a right one.
-            *
-            * Instead directly start backtracking up the tree */
-            else
-            {
-                /* Remember the parent */
-                pt_CurrentEventParent = pt_Event->pt_Parent;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = leqSerialisedEventE(
+            &pu8_Buffer1[u32_Offset],
+            u32_BufferSize1 - u32_Offset,
+            &pu8_Buffer2[u32_Offset],
+            u32_BufferSize2 - u32_Offset,
+            pb_IsLeq12);
+    }
 
-                /* Loop until the current element is no longer reachable
-                * through the parent's right child */
-                while (pt_CurrentEventParent != pt_RootEventParent &&
-                    pt_CurrentEventParent->pt_Right == pt_Event)
-                {
-                    pt_Event = pt_Event->pt_Parent;
-                    pt_CurrentEventParent =
-                        pt_CurrentEventParent->pt_Parent;
-                }
+    if (t_Status == ITC_STATUS_SUCCESS && pb_IsLeq21)
+    {
+        t_Status = leqSerialisedEventE(
+            &pu8_Buffer2[u32_Offset],
+            u32_BufferSize2 - u32_Offset,
+            &pu8_Buffer1[u32_Offset],
+            u32_BufferSize1 - u32_Offset,
+            pb_IsLeq21);
+    }
 
-                /* There is a right subtree that has not been explored yet*/
-                if (pt_CurrentEventParent != pt_RootEventParent)
-                {
-                    pt_Event = pt_CurrentEventParent->pt_Right;
-                }
-                else
-                {
-                    pt_Event = NULL;
-                }
-            }
-        }
+    return t_Status;
+}
+
+/******************************************************************************
+ * Validate a serialised ITC Event without deserialising it
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_validateSerialisedEvent(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    /* The offset of the Event tree inside the buffer */
+    uint32_t u32_Offset = (b_HasVersion) ? ITC_VERSION_MAJOR_LEN : 0;
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        &pu8_Buffer[0],
+        &u32_BufferSize,
+        ITC_SERDES_EVENT_MIN_BUFFER_LEN + u32_Offset,
+        false);
+
+    /* If input contains a version check it matches the current lib version
+     * (provided by build system c args) */
+    if (t_Status == ITC_STATUS_SUCCESS && b_HasVersion)
+    {
+        t_Status = ITC_SerDes_Util_validateDesLibVersion(pu8_Buffer[0]);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        t_Status = validateSerialisedEvent(
+            &pu8_Buffer[u32_Offset], u32_BufferSize - u32_Offset);
     }
 
     return t_Status;
@@ -1713,632 +8948,665 @@ static ITC_Status_t serialiseEvent(
 
 #if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
 
-/**
- * @brief Serialise an Event counter to ASCII string
- *
- * This function intentionally avoids using `sprintf` to improve portability
- * and efficiency.
- *
- * @warning The resulting string is NOT NULL terminated.
- * @param t_Count The event counter
- * @param pc_Buffer The buffer where to write the data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
- */
-static ITC_Status_t eventCounterToString(
-    ITC_Event_Counter_t t_Count,
+/******************************************************************************
+ * Serialise a serialised ITC Event to string
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_serialisedEventToString(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
     char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+    uint32_t *const pu32_StringSize
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
-    uint32_t u32_Offset = 0;
-    char c_Tmp = 0;
+    ITC_Status_t t_Status; /* The current status */
 
-    do
-    {
-        /* Check there is space left in the buffer */
-        if (u32_Offset >= *pu32_BufferSize)
-        {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-        }
-        else
-        {
-            /* Serialise the next digit */
-            pc_Buffer[u32_Offset] = '0' + (char)(t_Count % 10);
-            t_Count /= 10;
-            u32_Offset++;
-        }
-    } while (t_Status == ITC_STATUS_SUCCESS && t_Count);
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        (uint8_t *)&pc_Buffer[0],
+        pu32_StringSize,
+        ITC_SER_TO_STR_EVENT_MIN_BUFFER_LEN,
+        true);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Reverse the string to get the final output */
-        for (uint32_t u32_I = u32_Offset - 1;
-             u32_I > (u32_Offset - 1) / 2;
-             u32_I--)
-        {
-            c_Tmp = pc_Buffer[u32_I];
-            pc_Buffer[u32_I] = pc_Buffer[u32_Offset - 1 - u32_I];
-            pc_Buffer[u32_Offset - 1 - u32_I] = c_Tmp;
-        }
-
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        t_Status = serialisedEventToString(
+            pu8_Buffer, u32_BufferSize, &pc_Buffer[0], pu32_StringSize);
     }
 
     return t_Status;
 }
 
+/******************************************************************************
+ * Serialise an existing ITC Event to string through a string sink
+ ******************************************************************************/
 
-/**
- * @brief Serialise an existing ITC Event to ASCII string
- *
- * @note The output buffer is always NULL-terminated
- * @param ppt_Event The pointer to the Event
- * @param pc_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes (including the NULL termination byte).
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
- */
-static ITC_Status_t serialiseEventToString(
-    const ITC_Event_t *pt_Event,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+ITC_Status_t ITC_SerDes_Util_writeEventString(
+    const ITC_Event_t *const pt_Event,
+    ITC_SerDes_Util_StringSink_t *const pt_Sink
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    /* The current Event node */
-    const ITC_Event_t *pt_CurrentEventParent = NULL;
-    /* The root parent */
-    const ITC_Event_t *pt_RootEventParent = pt_Event->pt_Parent;
-    uint32_t u32_Offset = 0;
-    /* The size of the stringified current node event counter */
-    uint32_t u32_EventCounterSize = 0;
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Event_t *pt_EventCopy = NULL;
+    const ITC_Event_t *pt_NormalisedEvent = NULL;
+
+    t_Status = validateEvent(pt_Event, true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedEvent(
+            pt_Event, &pt_EventCopy, &pt_NormalisedEvent);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = writeEventString(pt_NormalisedEvent, pt_Sink);
+    }
+
+    releaseNormalisedEvent(&pt_EventCopy);
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/******************************************************************************
+ * Serialise an existing ITC Event in the compact format
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_serialiseEventCompact(
+    const ITC_Event_t *const pt_Event,
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_EventCopy = NULL;
+    const ITC_Event_t *pt_NormalisedEvent = NULL;
 
-    /* Ensure there is at least space for the NULL termination */
-    if (*pu32_BufferSize < 1)
+    if (!pt_Writer)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    /* Perform a pre-order traversal */
-    while (t_Status == ITC_STATUS_SUCCESS && pt_Event)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Check there is space left in the buffer, taking into account the
-         * NULL termination byte and bracket */
-        if (u32_Offset >= (*pu32_BufferSize - 1))
-        {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-        }
-
-        if (t_Status == ITC_STATUS_SUCCESS && ITC_EVENT_IS_PARENT_EVENT(pt_Event))
-        {
-            /* Open a bracket to signify a parent node */
-            pc_Buffer[u32_Offset] = '(';
-            /* Increment the offset */
-            u32_Offset++;
+        t_Status = validateEvent(pt_Event, true);
+    }
 
-            /* Check there is space left in the buffer, taking into account the
-             * NULL termination byte and at least 1 digit event counter */
-             if (u32_Offset >= (*pu32_BufferSize - 1))
-             {
-                 t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-             }
-        }
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedEvent(
+            pt_Event, &pt_EventCopy, &pt_NormalisedEvent);
+    }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Calculate the space left in the buffer, taking into account the
-             * NULL termination byte */
-            u32_EventCounterSize = *pu32_BufferSize - u32_Offset - 1;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseEventCompact(pt_NormalisedEvent, pt_Writer, NULL);
+    }
 
-            /* Serialise the current node event counter */
-            t_Status = eventCounterToString(
-                pt_Event->t_Count,
-                &pc_Buffer[u32_Offset],
-                &u32_EventCounterSize);
-        }
+    releaseNormalisedEvent(&pt_EventCopy);
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Increment the offset */
-            u32_Offset += u32_EventCounterSize;
+    return t_Status;
+}
 
-            /* If this is a parent, check there is space left in the buffer,
-             * taking into account the NULL termination byte, and the space for
-             * the extra comma and space */
-            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) &&
-                u32_Offset >= (*pu32_BufferSize - 2))
-            {
-                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-            }
-        }
+/******************************************************************************
+ * Deserialise an ITC Event in the compact format
+ ******************************************************************************/
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
-            {
-                /* Add a comma to separete the current node counter from
-                 * its children */
-                pc_Buffer[u32_Offset] = ',';
-                /* Increment the offset */
-                u32_Offset++;
+ITC_Status_t ITC_SerDes_Util_deserialiseEventCompact(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    ITC_Event_t **const ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-                /* Add space between the current node counter and child nodes */
-                pc_Buffer[u32_Offset] = ' ';
-                /* Increment the offset */
-                u32_Offset++;
-            }
+    if (!pt_Reader || !pt_Reader->pu8_Buffer || !ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
-            /* Descend into left tree */
-            if (pt_Event->pt_Left)
-            {
-                /* Remember the parent address */
-                pt_CurrentEventParent = pt_Event;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseEventCompact(pt_Reader, ppt_Event);
+    }
 
-                pt_Event = pt_Event->pt_Left;
-            }
-            /* Valid parent ITC Event trees always have both left and right
-             * nodes. Thus, there is no need to check if the current node
-             * doesn't have a left child but has a right one.
-             *
-             * Instead directly start backtracking up the tree */
-            else
-            {
-                /* Loop until the current element is no longer reachable
-                 * through the parent's right child */
-                while (t_Status == ITC_STATUS_SUCCESS &&
-                       pt_CurrentEventParent != pt_RootEventParent &&
-                       pt_CurrentEventParent->pt_Right == pt_Event)
-                {
-                    pt_Event = pt_Event->pt_Parent;
-                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        refreshEventChildrenMaxE(*ppt_Event);
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
 
-                    /* Check there is space left in the buffer, taking into
-                     * account the NULL termination byte and bracket */
-                    if (u32_Offset >= (*pu32_BufferSize - 1))
-                    {
-                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-                    }
-                    else
-                    {
-                        /* Close the current parent node bracket */
-                        pc_Buffer[u32_Offset] = ')';
-                        /* Increment the offset */
-                        u32_Offset++;
-                    }
-                }
+    return t_Status;
+}
 
-                /* There is a right subtree that has not been explored yet */
-                if (t_Status == ITC_STATUS_SUCCESS &&
-                    pt_CurrentEventParent != pt_RootEventParent)
-                {
-                    pt_Event = pt_CurrentEventParent->pt_Right;
+/******************************************************************************
+ * Get the size of an existing ITC Event once serialised in the compact format
+ ******************************************************************************/
 
-                    /* Check there is space left in the buffer, taking into
-                     * account the NULL termination byte, comma and space */
-                    if (u32_Offset >= (*pu32_BufferSize - 2))
-                    {
-                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-                    }
-                    else
-                    {
-                        /* Add a comma to signify the start of a new node */
-                        pc_Buffer[u32_Offset] = ',';
-                        /* Increment the offset */
-                        u32_Offset++;
+ITC_Status_t ITC_SerDes_Util_getSerialisedEventCompactBitCount(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_BitCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-                        /* Add space between nodes */
-                        pc_Buffer[u32_Offset] = ' ';
-                        /* Increment the offset */
-                        u32_Offset++;
-                    }
-                }
-                else
-                {
-                    pt_Event = NULL;
-                }
-            }
-        }
+    if (!pu32_BitCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Ensure the string is always NULL-termiated */
-        pc_Buffer[u32_Offset] = '\0';
-        u32_Offset++;
+        t_Status = validateEvent(pt_Event, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        t_Status = serialiseEventCompact(pt_Event, NULL, pu32_BitCount);
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
 
-/**
- * @brief Deserialise an ITC Event
- *
- * For the expected data format see ::serialiseEvent()
- *
- * @param pu8_Buffer The buffer holding the serialised Event data
- * @param u32_BufferSize The size of the buffer in bytes
- * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
- * serialised input
- * @param ppt_Event The pointer to the deserialised Event
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- */
-static ITC_Status_t deserialiseEvent(
+/******************************************************************************
+ * Feed the next part of a serialised ITC Event to an Event decoder
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_feedEventDecoder(
+    ITC_SerDes_EventDecoder_t *const pt_Decoder,
     const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    const bool b_HasVersion,
-    ITC_Event_t **const ppt_Event
+    const uint32_t u32_BufferSize
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Event_t **ppt_CurrentEvent = NULL; /* The current Event */
-    ITC_Event_t *pt_CurrentEventParent = NULL;
-    uint32_t u32_Offset = 0; /* The current offset */
+    ITC_Event_t **ppt_CurrentEvent; /* The next unallocated node */
     uint32_t u32_CounterLen; /* The serialised Event counter length */
-    uint32_t u32_NextHeaderOffset; /* Used for serialisation data validation */
-    bool b_IsParent;
-
-    *ppt_Event = NULL;
-    ppt_CurrentEvent = ppt_Event;
+    uint32_t u32_Offset = 0; /* The current offset */
 
-    /* If input contains a version check it matches the current lib version
-     * (provided by build system c args) */
-    if (b_HasVersion)
+    if (!pt_Decoder || !pu8_Buffer)
     {
-        t_Status = ITC_SerDes_Util_validateDesLibVersion(
-            pu8_Buffer[u32_Offset]);
-
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Offset < u32_BufferSize)
     {
-        /* Unknown node header value */
-        if (pu8_Buffer[u32_Offset] & ~ITC_SERDES_EVENT_HEADER_MASK)
+        /* Read a node header */
+        if (pt_Decoder->u8_CounterBytesLeft == 0)
         {
-            t_Status = ITC_STATUS_CORRUPT_EVENT;
-        }
-        else
-        {
-            /* Get the node type */
-            b_IsParent = ITC_SERDES_EVENT_GET_IS_PARENT(pu8_Buffer[u32_Offset]);
-
-            /* Get the serialised Event counter length */
             u32_CounterLen =
                 ITC_SERDES_EVENT_GET_COUNTER_LEN(pu8_Buffer[u32_Offset]);
 
-            /* Calculate the offset of the next node header */
-            u32_NextHeaderOffset =
-                u32_Offset + u32_CounterLen + sizeof(ITC_SerDes_Header_t);
-
-            /* Check for serialisation data validity:
-             * - Check there is enough data left in the buffer to deserialise
-             *   the current node
-             * - Check the last serialised node is not a parent
-             */
-            if ((u32_NextHeaderOffset > u32_BufferSize) ||
-                (b_IsParent && u32_NextHeaderOffset == u32_BufferSize))
+            /* The tree is already complete */
+            if (pt_Decoder->pt_Root && !pt_Decoder->pt_Parent)
             {
                 t_Status = ITC_STATUS_CORRUPT_EVENT;
             }
-        }
-
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Create a new node */
-            t_Status = newEvent(ppt_CurrentEvent, pt_CurrentEventParent, 0);
-        }
-
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Increment the offset */
-            u32_Offset += sizeof(ITC_SerDes_Header_t);
-
-            /* Special case - if the counter length is 0, then the
-             * serialised Event had an Event counter == 0 */
-            if (u32_CounterLen > 0)
+            /* Unknown node header value */
+            else if (pu8_Buffer[u32_Offset] & ~ITC_SERDES_EVENT_HEADER_MASK)
+            {
+                t_Status = ITC_STATUS_CORRUPT_EVENT;
+            }
+            /* The counter size is not supported on this platform */
+            else if (u32_CounterLen > sizeof(ITC_Event_Counter_t))
+            {
+                t_Status = ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE;
+            }
+            else
             {
-                /* Deserialise the event counter */
-                t_Status = eventCounterFromNetwork(
-                    &pu8_Buffer[u32_Offset],
-                    u32_CounterLen,
-                    &(*ppt_CurrentEvent)->t_Count);
-
+                pt_Decoder->u8_Header = pu8_Buffer[u32_Offset];
+                pt_Decoder->u8_CounterBytesLeft = (uint8_t)u32_CounterLen;
+                pt_Decoder->t_Counter = 0;
             }
         }
-
-        if (t_Status == ITC_STATUS_SUCCESS)
+        /* Read the next byte of the event counter (network-endian) */
+        else
         {
-            /* Increment the offset */
-            u32_Offset += u32_CounterLen;
+            pt_Decoder->t_Counter <<= 8U;
+            pt_Decoder->t_Counter |= pu8_Buffer[u32_Offset];
+            pt_Decoder->u8_CounterBytesLeft--;
+        }
 
-            /* If the current header was a parent - descend into left child */
-            if (b_IsParent)
+        /* The whole node has been read */
+        if (t_Status == ITC_STATUS_SUCCESS &&
+            pt_Decoder->u8_CounterBytesLeft == 0)
+        {
+            /* Find the next unallocated node. The data is serialised in
+             * pre-order, so it is the left child of the parent if it hasn't
+             * been allocated yet, otherwise the right child */
+            if (!pt_Decoder->pt_Parent)
             {
-                pt_CurrentEventParent = *ppt_CurrentEvent;
-                ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
+                ppt_CurrentEvent = &pt_Decoder->pt_Root;
+            }
+            else if (!pt_Decoder->pt_Parent->pt_Left)
+            {
+                ppt_CurrentEvent = &pt_Decoder->pt_Parent->pt_Left;
             }
-            /* If the current header was a leaf - find the first unallocated
-             * right child node or error out if there isn't one */
             else
             {
-                /* Backtrack the tree until an unallocated right child is found
-                 * or there are no more parent nodes */
-                while (pt_CurrentEventParent && pt_CurrentEventParent->pt_Right)
-                {
-                    ppt_CurrentEvent = &pt_CurrentEventParent;
-                    pt_CurrentEventParent = (*ppt_CurrentEvent)->pt_Parent;
-                }
+                ppt_CurrentEvent = &pt_Decoder->pt_Parent->pt_Right;
+            }
 
-                /* Descend into the unallocated right child of the parent */
-                if (pt_CurrentEventParent)
-                {
-                    ppt_CurrentEvent = &pt_CurrentEventParent->pt_Right;
-                }
-                /* There aren't any unallocated right child nodes in the tree.
-                 *
-                 * Usually this would signal the end of the loop as the only
-                 * time this should happen is when the full input buffer has
-                 * been deserialised (i.e.`u32_Offset == u32_BufferSize`),
-                 * since the tree is serialised in a pre-order traversal fasion.
-                 *
-                 * However, if the input buffer is malformed in some way it is
-                 * possible that there are elements in it that havent't been
-                 * deserialised yet (i.e. `u32_Offset < u32_BufferSize`).
-                 *
-                 * This should be treated as error as otherwise the user might
-                 * not get the expected (or full) Event tree. */
-                else if (u32_Offset < u32_BufferSize)
+            t_Status = newEvent(
+                ppt_CurrentEvent,
+                pt_Decoder->pt_Parent,
+                pt_Decoder->t_Counter,
+                ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* If the current node is a parent - descend into left child */
+                if (ITC_SERDES_EVENT_GET_IS_PARENT(pt_Decoder->u8_Header))
                 {
-                    t_Status = ITC_STATUS_CORRUPT_EVENT;
+                    pt_Decoder->pt_Parent = *ppt_CurrentEvent;
                 }
                 else
                 {
-                    /* Nothing to do */
+                    /* Backtrack the tree until an unallocated right child is
+                     * found or there are no more parent nodes */
+                    while (pt_Decoder->pt_Parent &&
+                           pt_Decoder->pt_Parent->pt_Right)
+                    {
+                        pt_Decoder->pt_Parent =
+                            pt_Decoder->pt_Parent->pt_Parent;
+                    }
+
+                    /* The tree is complete. Check the deserialised Event is
+                     * valid */
+                    if (!pt_Decoder->pt_Parent)
+                    {
+                        t_Status = validateEvent(pt_Decoder->pt_Root, true);
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+                        if (t_Status == ITC_STATUS_SUCCESS)
+                        {
+                            refreshEventChildrenMaxE(pt_Decoder->pt_Root);
+                        }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+                    }
                 }
             }
         }
+
+        u32_Offset++;
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check an Event decoder has deserialised a whole ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_finishEventDecoder(
+    const ITC_SerDes_EventDecoder_t *const pt_Decoder
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Decoder)
     {
-        /* Check the deserialised Event is valid */
-        t_Status = validateEvent(*ppt_Event, true);
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
-
-    if (t_Status != ITC_STATUS_SUCCESS)
+    /* Nodes (or the rest of an event counter) are still missing */
+    else if (!pt_Decoder->pt_Root ||
+             pt_Decoder->pt_Parent ||
+             pt_Decoder->u8_CounterBytesLeft)
     {
-        /* There is nothing else to do if the destroy fails. Also it is more
-         * important to convey the deserialisation failed, rather than the
-         * destroy */
-        (void)ITC_Event_destroy(ppt_Event);
+        t_Status = ITC_STATUS_CORRUPT_EVENT;
+    }
+    else
+    {
+        /* Nothing to do */
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Public functions
+ * Reset an Event decoder
  ******************************************************************************/
 
+void ITC_SerDes_Util_resetEventDecoder(
+    ITC_SerDes_EventDecoder_t *const pt_Decoder
+)
+{
+    if (pt_Decoder)
+    {
+        if (pt_Decoder->pt_Root)
+        {
+            /* There is nothing else to do if the destroy fails */
+            (void)ITC_Event_destroy(&pt_Decoder->pt_Root);
+        }
+
+        pt_Decoder->pt_Root = NULL;
+        pt_Decoder->pt_Parent = NULL;
+        pt_Decoder->t_Counter = 0;
+        pt_Decoder->u8_Header = 0;
+        pt_Decoder->u8_CounterBytesLeft = 0;
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
 /******************************************************************************
- * Allocate a new ITC Event and initialise it
+ * Serialise an existing ITC Event to string
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_new(
-    ITC_Event_t **const ppt_Event
+ITC_Status_t ITC_SerDes_serialiseEventToString(
+    const ITC_Event_t *const pt_Event,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
 )
 {
-    if (!ppt_Event)
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Event_t *pt_EventCopy = NULL;
+    const ITC_Event_t *pt_NormalisedEvent = NULL;
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        (uint8_t *)&pc_Buffer[0],
+        pu32_BufferSize,
+        ITC_SER_TO_STR_EVENT_MIN_BUFFER_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        return ITC_STATUS_INVALID_PARAM;
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedEvent(
+            pt_Event, &pt_EventCopy, &pt_NormalisedEvent);
     }
 
-    return newEvent(ppt_Event, NULL, 0);
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseEventToString(
+            pt_NormalisedEvent, &pc_Buffer[0], pu32_BufferSize);
+    }
+
+    releaseNormalisedEvent(&pt_EventCopy);
+
+    return t_Status;
 }
 
 /******************************************************************************
- * Free an allocated ITC Event
+ * Get the length of an existing ITC Event once serialised to string
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_destroy(
-    ITC_Event_t **const ppt_Event
+ITC_Status_t ITC_SerDes_getEventStringLength(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_Length
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
-    ITC_Event_t *pt_CurrentEvent = NULL; /* The current element */
-    ITC_Event_t *pt_CurrentEventParent = NULL;
-    ITC_Event_t *pt_RootEventParent = NULL;
+    ITC_Event_t *pt_EventCopy = NULL;
+    const ITC_Event_t *pt_NormalisedEvent = NULL;
 
-    if (!ppt_Event)
+    if (!pu32_Length)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
-    else if (*ppt_Event)
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        pt_CurrentEvent = *ppt_Event;
-        /* Remember the parent as this might be a subtree */
-        pt_RootEventParent = pt_CurrentEvent->pt_Parent;
+        t_Status = validateEvent(pt_Event, true);
+    }
 
-        /* Keep trying to free elements even if some frees fail */
-        while(pt_CurrentEvent && pt_CurrentEvent != pt_RootEventParent)
-        {
-            /* Advance into left subtree */
-            if(pt_CurrentEvent->pt_Left)
-            {
-                pt_CurrentEvent = pt_CurrentEvent->pt_Left;
-            }
-            /* Advance into right subtree */
-            else if(pt_CurrentEvent->pt_Right)
-            {
-                pt_CurrentEvent = pt_CurrentEvent->pt_Right;
-            }
-            else
-            {
-                /* Remember the parent element */
-                pt_CurrentEventParent = pt_CurrentEvent->pt_Parent;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedEvent(
+            pt_Event, &pt_EventCopy, &pt_NormalisedEvent);
+    }
 
-                if(pt_CurrentEventParent)
-                {
-                    /* Remove the current element address from the parent */
-                    if(pt_CurrentEventParent->pt_Left == pt_CurrentEvent)
-                    {
-                        pt_CurrentEventParent->pt_Left = NULL;
-                    }
-                    else
-                    {
-                        pt_CurrentEventParent->pt_Right = NULL;
-                    }
-                }
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        getEventStringLength(pt_NormalisedEvent, pu32_Length);
+    }
 
-                /* Free the current element */
-                t_FreeStatus = ITC_Port_free(
-                    pt_CurrentEvent, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+    releaseNormalisedEvent(&pt_EventCopy);
 
-                /* Return last error */
-                if (t_FreeStatus != ITC_STATUS_SUCCESS)
-                {
-                    t_Status = t_FreeStatus;
-                }
+    return t_Status;
+}
 
-                /* Go up the tree */
-                pt_CurrentEvent = pt_CurrentEventParent;
-            }
-        }
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
+/******************************************************************************
+ * Serialise an existing ITC Event to string through a writer
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_writeEventString(
+    const ITC_Event_t *const pt_Event,
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_SerDes_Util_StringSink_t t_Sink;
+
+    if (!pfn_Writer)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
-    else
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Nothing to do */
+        ITC_SerDes_Util_initStringSink(&t_Sink, pfn_Writer, pv_Context);
+
+        t_Status = ITC_SerDes_Util_writeEventString(pt_Event, &t_Sink);
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Sanitize the freed pointer regardless of the exit status */
-        *ppt_Event = NULL;
+        t_Status = ITC_SerDes_Util_flushStringSink(&t_Sink);
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
+/******************************************************************************
+ * Serialise an existing ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_serialiseEvent(
+    const ITC_Event_t *const pt_Event,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    return ITC_SerDes_Util_serialiseEvent(
+        pt_Event,
+        pu8_Buffer,
+        pu32_BufferSize,
+        true);
+}
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
 /******************************************************************************
- * Clone an existing ITC Event
+ * Serialise an existing ITC Event in the compact format
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_clone(
+ITC_Status_t ITC_SerDes_serialiseEventCompact(
     const ITC_Event_t *const pt_Event,
-    ITC_Event_t **const ppt_ClonedEvent
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_Status; /* The current status */
+    ITC_SerDes_Util_BitWriter_t t_Writer = { 0 };
 
-    if (!ppt_ClonedEvent)
-    {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        pu8_Buffer,
+        pu32_BufferSize,
+        ITC_SERDES_COMPACT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+        true);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event, true);
+        t_Writer.pu8_Buffer = &pu8_Buffer[ITC_VERSION_MAJOR_LEN];
+        t_Writer.u32_BufferSize =
+            *pu32_BufferSize - (uint32_t)ITC_VERSION_MAJOR_LEN;
+
+        t_Status = ITC_SerDes_Util_serialiseEventCompact(pt_Event, &t_Writer);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = cloneEvent(pt_Event, ppt_ClonedEvent, NULL);
+        /* Prepend the lib version (provided by build system c args) and mark
+         * the data as compact */
+        pu8_Buffer[0] = ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG;
+
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = (uint32_t)ITC_VERSION_MAJOR_LEN +
+                           ((t_Writer.u32_BitOffset + 7U) / 8U);
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
 /******************************************************************************
- * Validate an Event
+ * Get the size of an existing ITC Event once serialised
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_validate(
-    const ITC_Event_t *const pt_Event
+ITC_Status_t ITC_SerDes_getSerialisedEventSize(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_Size
 )
 {
-    return validateEvent(pt_Event, true);
+    return ITC_SerDes_Util_getSerialisedEventSize(pt_Event, pu32_Size, true);
 }
 
-#if ITC_CONFIG_ENABLE_EXTENDED_API
+/******************************************************************************
+ * Deserialise an ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_deserialiseEvent(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Event_t **const ppt_Event
+)
+{
+    return ITC_SerDes_Util_deserialiseEvent(
+        pu8_Buffer,
+        u32_BufferSize,
+        true,
+        ppt_Event);
+}
 
 /******************************************************************************
- * Join two existing Events into a single Event
+ * Check if a serialised Event is `<=` to another serialised Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_join(
-    ITC_Event_t **const ppt_Event,
-    ITC_Event_t **const ppt_OtherEvent
+ITC_Status_t ITC_SerDes_leqSerialisedEvents(
+    const uint8_t *const pu8_Buffer1,
+    const uint32_t u32_BufferSize1,
+    const uint8_t *const pu8_Buffer2,
+    const uint32_t u32_BufferSize2,
+    bool *const pb_IsLeq
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Event_t *pt_JoinedEvent;
+    return ITC_SerDes_Util_leqSerialisedEvents(
+        pu8_Buffer1,
+        u32_BufferSize1,
+        pu8_Buffer2,
+        u32_BufferSize2,
+        true,
+        pb_IsLeq,
+        NULL);
+}
 
-    if (!ppt_Event || !ppt_OtherEvent)
+/******************************************************************************
+ * Serialise the difference of an existing ITC Event to a base Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_serialiseEventDelta(
+    const ITC_Event_t *const pt_Base,
+    const ITC_Event_t *const pt_Event,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Event_t *pt_BaseCopy = NULL;
+    ITC_Event_t *pt_EventCopy = NULL;
+    const ITC_Event_t *pt_NormalisedBase = NULL;
+    const ITC_Event_t *pt_NormalisedEvent = NULL;
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        pu8_Buffer,
+        pu32_BufferSize,
+        ITC_SERDES_EVENT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_STATUS_INVALID_PARAM;
+        t_Status = validateEvent(pt_Base, true);
     }
-    else
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_Event_joinConst(
-            *ppt_Event, *ppt_OtherEvent, &pt_JoinedEvent);
+        t_Status = validateEvent(pt_Event, true);
     }
 
+    /* Lazily joined Events must be normalised before they are compared */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* XXX: Save the parent pointer in case the original Event was a subtree.
-         * This makes no sense from a functional point of view, especially
-         * since `validateEvent` should fail if a subtree is passed in.
-         * However, if that somehow fails and a subtree is joined, the new Event
-         * will lose the reference to the original Event subtree's parent nodes,
-         * which would lead to a memory leak. */
-        pt_JoinedEvent->pt_Parent = (*ppt_Event)->pt_Parent;
+        t_Status = getNormalisedEvent(
+            pt_Base, &pt_BaseCopy, &pt_NormalisedBase);
+    }
 
-        /* Destroy the old Events
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall join
-         * operation was successful */
-        (void)ITC_Event_destroy(ppt_Event);
-        (void)ITC_Event_destroy(ppt_OtherEvent);
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedEvent(
+            pt_Event, &pt_EventCopy, &pt_NormalisedEvent);
+    }
 
-        /* Return the joined Event */
-        *ppt_Event = pt_JoinedEvent;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseEventDelta(
+            pt_NormalisedBase,
+            pt_NormalisedEvent,
+            pu8_Buffer,
+            pu32_BufferSize);
     }
 
+    releaseNormalisedEvent(&pt_BaseCopy);
+    releaseNormalisedEvent(&pt_EventCopy);
+
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
-
 /******************************************************************************
- * Join two Events similar to ::ITC_Event_join() but do not modify the source Events
+ * Rebuild an ITC Event from a base Event and a serialised delta
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_joinConst(
-    const ITC_Event_t *const pt_Event1,
-    const ITC_Event_t *const pt_Event2,
+ITC_Status_t ITC_SerDes_applyEventDelta(
+    const ITC_Event_t *const pt_Base,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
     ITC_Event_t **const ppt_Event
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_BaseCopy = NULL;
+    const ITC_Event_t *pt_NormalisedBase = NULL;
 
     if (!ppt_Event)
     {
@@ -2347,274 +9615,285 @@ ITC_Status_t ITC_Event_joinConst(
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event1, true);
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer,
+            &u32_BufferSize,
+            ITC_SERDES_EVENT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+            false);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event2, true);
+        t_Status = validateEvent(pt_Base, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = joinEventE(pt_Event1, pt_Event2, ppt_Event);
+        /* The delta was made against the normalised base */
+        t_Status = getNormalisedEvent(
+            pt_Base, &pt_BaseCopy, &pt_NormalisedBase);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = applyEventDelta(
+            pt_NormalisedBase, pu8_Buffer, u32_BufferSize, ppt_Event);
+    }
+
+    releaseNormalisedEvent(&pt_BaseCopy);
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        refreshEventChildrenMaxE(*ppt_Event);
     }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+
 /******************************************************************************
- * Check if an Event is `less than or equal` (`<=`) to another Event
+ * Pack an existing ITC Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_leq(
-    const ITC_Event_t *const pt_Event1,
-    const ITC_Event_t *const pt_Event2,
-    bool *const pb_IsLeq
-
+ITC_Status_t ITC_PackedEvent_fromEvent(
+    const ITC_Event_t *const pt_Event,
+    ITC_PackedEvent_t *const pt_PackedEvent
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!pb_IsLeq)
+    if (!pt_PackedEvent || !pt_PackedEvent->pt_Nodes)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event1, true);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateEvent(pt_Event2, true);
+        t_Status = validateEvent(pt_Event, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Check if `pt_Event1 <= pt_Event2` */
-        t_Status = leqEventE(pt_Event1, pt_Event2, pb_IsLeq);
+        t_Status = packEventI(pt_Event, pt_PackedEvent);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Fill an Event
+ * Unpack a packed Event into a newly allocated ITC Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_fill(
-    ITC_Event_t **const ppt_Event,
-    const ITC_Id_t *const pt_Id,
-    bool *const pb_WasFilled
+ITC_Status_t ITC_PackedEvent_toEvent(
+    const ITC_PackedEvent_t *const pt_PackedEvent,
+    ITC_Event_t **const ppt_Event
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!pb_WasFilled || !ppt_Event)
+    if (!ppt_Event)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(*ppt_Event, true);
+        t_Status = validatePackedEvent(pt_PackedEvent);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Validate the ID */
-        t_Status = ITC_Id_validate(pt_Id);
+        t_Status = unpackEventI(pt_PackedEvent, ppt_Event);
     }
 
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = fillEventE(ppt_Event, pt_Id, pb_WasFilled);
+        refreshEventChildrenMaxE(*ppt_Event);
     }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
 
     return t_Status;
 }
 
 /******************************************************************************
- * Grow an Event
+ * Validate a packed Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_grow(
-    ITC_Event_t **const ppt_Event,
-    const ITC_Id_t *const pt_Id
+ITC_Status_t ITC_PackedEvent_validate(
+    const ITC_PackedEvent_t *const pt_PackedEvent
+)
+{
+    return validatePackedEvent(pt_PackedEvent);
+}
+
+/******************************************************************************
+ * Check if a packed Event is `less than or equal` (`<=`) to another packed
+ * Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_PackedEvent_leq(
+    const ITC_PackedEvent_t *const pt_PackedEvent1,
+    const ITC_PackedEvent_t *const pt_PackedEvent2,
+    bool *const pb_IsLeq
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    bool b_IsSameShape = false;
 
-    if (!ppt_Event)
+    if (!pb_IsLeq)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(*ppt_Event, true);
+        t_Status = validatePackedEvent(pt_PackedEvent1);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Validate the ID */
-        t_Status = ITC_Id_validate(pt_Id);
+        t_Status = validatePackedEvent(pt_PackedEvent2);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = growEventE(ppt_Event, pt_Id);
+        /* Compare the nodes element-wise if the shapes match */
+        leqSameShapePackedEventE(
+            pt_PackedEvent1, pt_PackedEvent2, &b_IsSameShape, pb_IsLeq);
+
+        if (!b_IsSameShape)
+        {
+            /* Check if `pt_PackedEvent1 <= pt_PackedEvent2` */
+            leqPackedEventE(pt_PackedEvent1, pt_PackedEvent2, pb_IsLeq);
+        }
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Serialise an existing ITC Event
+ * Join two packed Events into a new packed Event
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_Util_serialiseEvent(
-    const ITC_Event_t *const pt_Event,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize,
-    const bool b_AddVersion
+ITC_Status_t ITC_PackedEvent_join(
+    const ITC_PackedEvent_t *const pt_PackedEvent1,
+    const ITC_PackedEvent_t *const pt_PackedEvent2,
+    ITC_PackedEvent_t *const pt_PackedEvent
 )
 {
-    ITC_Status_t t_Status; /* The current status */
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    bool b_IsSameShape = false;
 
-    t_Status = ITC_SerDes_Util_validateBuffer(
-        pu8_Buffer,
-        pu32_BufferSize,
-        (b_AddVersion) ? ITC_SERDES_EVENT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
-                       : ITC_SERDES_EVENT_MIN_BUFFER_LEN,
-        true);
+    if (!pt_PackedEvent || !pt_PackedEvent->pt_Nodes)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event, true);
+        t_Status = validatePackedEvent(pt_PackedEvent1);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = serialiseEvent(
-            pt_Event, pu8_Buffer, pu32_BufferSize, b_AddVersion);
+        t_Status = validatePackedEvent(pt_PackedEvent2);
+    }
+
+    /* The joined Event is written while the source Events are still being
+     * read */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        (pt_PackedEvent->pt_Nodes == pt_PackedEvent1->pt_Nodes ||
+         pt_PackedEvent->pt_Nodes == pt_PackedEvent2->pt_Nodes))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Join the nodes element-wise if the shapes match */
+        t_Status = joinSameShapePackedEventE(
+            pt_PackedEvent1, pt_PackedEvent2, pt_PackedEvent, &b_IsSameShape);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsSameShape)
+    {
+        t_Status = joinPackedEventE(
+            pt_PackedEvent1, pt_PackedEvent2, pt_PackedEvent);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Deserialise an ITC Event
+ * Fill a packed Event in place
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_Util_deserialiseEvent(
-    const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    const bool b_HasVersion,
-    ITC_Event_t **const ppt_Event
+ITC_Status_t ITC_PackedEvent_fill(
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    const ITC_PackedId_t *const pt_PackedId,
+    bool *const pb_WasFilled
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_Event)
+    if (!pb_WasFilled)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_SerDes_Util_validateBuffer(
-            pu8_Buffer,
-            &u32_BufferSize,
-            (b_HasVersion) ? ITC_SERDES_EVENT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
-                           : ITC_SERDES_EVENT_MIN_BUFFER_LEN,
-            false);
+        t_Status = validatePackedEvent(pt_PackedEvent);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = deserialiseEvent(
-            pu8_Buffer, u32_BufferSize, b_HasVersion, ppt_Event);
+        /* Validate the ID */
+        t_Status = ITC_PackedId_validate(pt_PackedId);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = fillPackedEventE(pt_PackedEvent, pt_PackedId, pb_WasFilled);
     }
 
     return t_Status;
 }
 
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-
 /******************************************************************************
- * Serialise an existing ITC Event to string
+ * Grow a packed Event in place
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_serialiseEventToString(
-    const ITC_Event_t *const pt_Event,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+ITC_Status_t ITC_PackedEvent_grow(
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    const ITC_PackedId_t *const pt_PackedId
 )
 {
     ITC_Status_t t_Status; /* The current status */
 
-    t_Status = ITC_SerDes_Util_validateBuffer(
-        (uint8_t *)&pc_Buffer[0],
-        pu32_BufferSize,
-        ITC_SER_TO_STR_EVENT_MIN_BUFFER_LEN,
-        true);
+    t_Status = validatePackedEvent(pt_PackedEvent);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event, true);
+        /* Validate the ID */
+        t_Status = ITC_PackedId_validate(pt_PackedId);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = serialiseEventToString(
-            pt_Event, &pc_Buffer[0], pu32_BufferSize);
+        t_Status = growPackedEventE(pt_PackedEvent, pt_PackedId);
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
-
-#if ITC_CONFIG_ENABLE_EXTENDED_API
-
-/******************************************************************************
- * Serialise an existing ITC Event
- ******************************************************************************/
-
-ITC_Status_t ITC_SerDes_serialiseEvent(
-    const ITC_Event_t *const pt_Event,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize
-)
-{
-    return ITC_SerDes_Util_serialiseEvent(
-        pt_Event,
-        pu8_Buffer,
-        pu32_BufferSize,
-        true);
-}
-
-/******************************************************************************
- * Deserialise an ITC Event
- ******************************************************************************/
-
-ITC_Status_t ITC_SerDes_deserialiseEvent(
-    const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    ITC_Event_t **const ppt_Event
-)
-{
-    return ITC_SerDes_Util_deserialiseEvent(
-        pu8_Buffer,
-        u32_BufferSize,
-        true,
-        ppt_Event);
-}
-
-#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
 
 #if IS_UNIT_TEST_BUILD
 
@@ -12,7 +12,10 @@
 
 #include "ITC_Event.h"
 #include "ITC_Status.h"
+#include "ITC_Config.h"
+#include "ITC_Port.h"
 
+#include <stdint.h>
 
 /******************************************************************************
  * Defines
@@ -30,6 +33,14 @@
 */
 #define MAX(a, b)                                      (((a) > (b)) ? (a) : (b))
 
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+/** The allocation type used for temporary Event copies */
+#define ITC_EVENT_TEMP_ALLOCTYPE                    (ITC_PORT_ALLOCTYPE_SCRATCH)
+#else
+/** The allocation type used for temporary Event copies */
+#define ITC_EVENT_TEMP_ALLOCTYPE                (ITC_PORT_ALLOCTYPE_ITC_EVENT_T)
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
 /** Checks whether the given `ITC_Event_t` is a leaf node */
 #define ITC_EVENT_IS_LEAF_EVENT(pt_Event)                                      \
     ((pt_Event) && !(pt_Event)->pt_Left && !(pt_Event)->pt_Right)
@@ -59,4 +70,68 @@
     (((pt_Event)->pt_Left->t_Count == 0) ||                                    \
     ((pt_Event)->pt_Right->t_Count == 0))))
 
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+/** Checks whether the given `ITC_Event_t` subtree has been marked as possibly
+ * not normalised by a lazy join */
+#define ITC_EVENT_IS_DIRTY_EVENT(pt_Event)                                     \
+    ((pt_Event) && (pt_Event)->b_IsDirty)
+#else
+/** Checks whether the given `ITC_Event_t` subtree has been marked as possibly
+ * not normalised by a lazy join */
+#define ITC_EVENT_IS_DIRTY_EVENT(pt_Event)                                (false)
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+/** The cached maximum of an `ITC_Event_t` subtree whose maximum is not known.
+ * Also used if the maximum cannot be represented */
+#define ITC_EVENT_UNKNOWN_CHILDREN_MAX                                         \
+    ((ITC_Event_Counter_t)~(ITC_Event_Counter_t)0)
+
+/** Checks whether the cached maximum of the given parent `ITC_Event_t` can be
+ * used */
+#define ITC_EVENT_HAS_KNOWN_CHILDREN_MAX(pt_Event)                             \
+    (!ITC_EVENT_IS_DIRTY_EVENT(pt_Event) &&                                    \
+     ((pt_Event)->t_ChildrenMax != ITC_EVENT_UNKNOWN_CHILDREN_MAX))
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/** Tracks the node of a base Event matching the current node of a walk over
+ * another Event tree */
+typedef struct
+{
+    /** The matching base node. `NULL` if the current node lies below a leaf of
+     * the base Event */
+    const ITC_Event_t *pt_Node;
+    /** The base leaf the current node lies below. Only valid if `u32_Depth > 0`
+     */
+    const ITC_Event_t *pt_Leaf;
+    /** How many levels the current node lies below `pt_Leaf` */
+    uint32_t u32_Depth;
+} ITC_Event_DeltaBase_t;
+
+#if ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH
+/** A pending pair of subtrees in an explicit-stack walk over two Event trees
+ */
+typedef struct
+{
+    /** The next node of the first Event to visit */
+    const ITC_Event_t *pt_Event1;
+    /** The next node of the second Event to visit */
+    const ITC_Event_t *pt_Event2;
+    /** The event count from the root to the parent of `pt_Event1` */
+    ITC_Event_Counter_t t_ParentsCountEvent1;
+    /** The event count from the root to the parent of `pt_Event2` */
+    ITC_Event_Counter_t t_ParentsCountEvent2;
+    /** Whether `pt_Event1` is a held node, which is not descended into, as the
+     * branch of the second Event is deeper */
+    bool b_IsHeldEvent1;
+    /** Whether `pt_Event2` is a held node, which is not descended into, as the
+     * branch of the first Event is deeper */
+    bool b_IsHeldEvent2;
+} ITC_Event_TraversalFrame_t;
+#endif /* ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH */
+
 #endif /* ITC_EVENT_PRIVATE_H_ */
@@ -24,10 +24,37 @@
 #endif /* !(ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API && ITC_CONFIG_ENABLE_EXTENDED_API) */
 
 #include "ITC_Port.h"
+#include "ITC_Port_package.h"
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+#include "ITC_Packed.h"
+#include "ITC_Packed_package.h"
+#include "ITC_Packed_private.h"
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
 
 #include <stdbool.h>
 #include <stddef.h>
 
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+#include <string.h>
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+/* The ID intern table. An open addressing hash table with linear probing */
+static ITC_Id_InternTableEntry_t
+    gt_ItcIdInternTable[ITC_CONFIG_ID_INTERN_TABLE_LENGTH];
+
+/* The number of IDs in the intern table */
+static uint32_t gu32_ItcInternedIdCount = 0;
+
+/* The spinlock serialising access to the intern table and the share counts
+ * of the interned IDs */
+static bool gb_ItcIdInternTableLock = false;
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+
 /******************************************************************************
  * Private functions
  ******************************************************************************/
@@ -139,7 +166,7 @@ static ITC_Status_t newId(
     ITC_Status_t t_Status; /* The current status */
     ITC_Id_t *pt_Alloc;
 
-    t_Status = ITC_Port_malloc((void **)&pt_Alloc, ITC_PORT_ALLOCTYPE_ITC_ID_T);
+    t_Status = ITC_PORT_MALLOC((void **)&pt_Alloc, ITC_PORT_ALLOCTYPE_ITC_ID_T);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
@@ -148,6 +175,10 @@ static ITC_Status_t newId(
         pt_Alloc->pt_Parent = pt_Parent;
         pt_Alloc->pt_Left = NULL;
         pt_Alloc->pt_Right = NULL;
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+        pt_Alloc->b_IsInterned = false;
+        pt_Alloc->u32_ShareCount = 0;
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
 
         /* Return the pointer to the allocated memory */
         *ppt_Id = pt_Alloc;
@@ -250,6 +281,274 @@ static ITC_Status_t cloneId(
     return t_Status;
 }
 
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+
+/**
+ * @brief Acquire the intern table lock
+ */
+static void lockInternTable(void)
+{
+    while (__atomic_test_and_set(&gb_ItcIdInternTableLock, __ATOMIC_ACQUIRE))
+    {
+        /* Spin */
+    }
+}
+
+/**
+ * @brief Release the intern table lock
+ */
+static void unlockInternTable(void)
+{
+    __atomic_clear(&gb_ItcIdInternTableLock, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Hash the structure of an ID tree
+ *
+ * Uses FNV-1a over the pre-order sequence of the nodes, where each node is
+ * encoded as parent, null leaf or seed leaf.
+ *
+ * @param pt_Id The ID. Must be a valid root of an ID tree
+ * @return `uint32_t` The hash of the ID
+ */
+static uint32_t hashId(
+    const ITC_Id_t *pt_Id
+)
+{
+    const ITC_Id_t *pt_PreviousId = NULL;
+    uint32_t u32_Hash = 2166136261U;
+
+    while (pt_Id)
+    {
+        if (pt_PreviousId == pt_Id->pt_Parent)
+        {
+            /* First visit of the node */
+            u32_Hash ^= (ITC_ID_IS_LEAF_ID(pt_Id))
+                            ? ((pt_Id->b_IsOwner) ? 2U : 1U)
+                            : 0U;
+            u32_Hash *= 16777619U;
+
+            pt_PreviousId = pt_Id;
+            /* Descend into the left subtree or go up the tree */
+            pt_Id = (ITC_ID_IS_LEAF_ID(pt_Id)) ? pt_Id->pt_Parent
+                                               : pt_Id->pt_Left;
+        }
+        else if (pt_PreviousId == pt_Id->pt_Left)
+        {
+            /* Back from the left subtree. Descend into the right one */
+            pt_PreviousId = pt_Id;
+            pt_Id = pt_Id->pt_Right;
+        }
+        else
+        {
+            /* Back from the right subtree. Go up the tree */
+            pt_PreviousId = pt_Id;
+            pt_Id = pt_Id->pt_Parent;
+        }
+    }
+
+    return u32_Hash;
+}
+
+/**
+ * @brief Check if two ID trees are structurally equal
+ *
+ * @param pt_Id1 The first ID. Must be a valid root of an ID tree
+ * @param pt_Id2 The second ID. Must be a valid root of an ID tree
+ * @return `bool` `true` if the IDs are equal. Otherwise `false`
+ */
+static bool isIdEqual(
+    const ITC_Id_t *pt_Id1,
+    const ITC_Id_t *pt_Id2
+)
+{
+    const ITC_Id_t *pt_PreviousId1 = NULL;
+    bool b_IsEqual = true;
+
+    /* Walk both trees in lockstep, following the first one */
+    while (pt_Id1 && b_IsEqual)
+    {
+        if (pt_PreviousId1 == pt_Id1->pt_Parent)
+        {
+            /* First visit of the node */
+            b_IsEqual = pt_Id1->b_IsOwner == pt_Id2->b_IsOwner &&
+                        ITC_ID_IS_LEAF_ID(pt_Id1) == ITC_ID_IS_LEAF_ID(pt_Id2);
+
+            pt_PreviousId1 = pt_Id1;
+
+            if (ITC_ID_IS_LEAF_ID(pt_Id1))
+            {
+                /* Go up the tree */
+                pt_Id1 = pt_Id1->pt_Parent;
+                pt_Id2 = pt_Id2->pt_Parent;
+            }
+            else
+            {
+                /* Descend into the left subtree */
+                pt_Id1 = pt_Id1->pt_Left;
+                pt_Id2 = pt_Id2->pt_Left;
+            }
+        }
+        else if (pt_PreviousId1 == pt_Id1->pt_Left)
+        {
+            /* Back from the left subtree. Descend into the right one */
+            pt_PreviousId1 = pt_Id1;
+            pt_Id1 = pt_Id1->pt_Right;
+            pt_Id2 = pt_Id2->pt_Right;
+        }
+        else
+        {
+            /* Back from the right subtree. Go up the tree */
+            pt_PreviousId1 = pt_Id1;
+            pt_Id1 = pt_Id1->pt_Parent;
+            pt_Id2 = pt_Id2->pt_Parent;
+        }
+    }
+
+    return b_IsEqual;
+}
+
+/**
+ * @brief Remove an ID from the intern table
+ *
+ * Uses backward shift deletion, so lookups never need tombstones.
+ *
+ * @note Must be called with the intern table lock held
+ * @param pt_Id The interned ID
+ */
+static void removeInternedId(
+    ITC_Id_t *const pt_Id
+)
+{
+    const uint32_t u32_Mask = ITC_CONFIG_ID_INTERN_TABLE_LENGTH - 1;
+    uint32_t u32_Slot = hashId(pt_Id) & u32_Mask;
+    uint32_t u32_Probes = 0;
+    uint32_t u32_Next;
+    uint32_t u32_Home;
+
+    /* Find the entry of the ID */
+    while (u32_Probes < ITC_CONFIG_ID_INTERN_TABLE_LENGTH &&
+           gt_ItcIdInternTable[u32_Slot].pt_Id != pt_Id)
+    {
+        u32_Slot = (u32_Slot + 1) & u32_Mask;
+        u32_Probes++;
+    }
+
+    if (u32_Probes < ITC_CONFIG_ID_INTERN_TABLE_LENGTH)
+    {
+        /* Move back any entries that would become unreachable. If the table
+         * is full, stop once all other entries have been checked */
+        for (u32_Next = (u32_Slot + 1) & u32_Mask, u32_Probes = 1;
+             gt_ItcIdInternTable[u32_Next].pt_Id &&
+             u32_Probes < ITC_CONFIG_ID_INTERN_TABLE_LENGTH;
+             u32_Next = (u32_Next + 1) & u32_Mask, u32_Probes++)
+        {
+            u32_Home = gt_ItcIdInternTable[u32_Next].u32_Hash & u32_Mask;
+
+            /* Only move the entry if its home slot is not in
+             * `(u32_Slot, u32_Next]` (cyclically) */
+            if (((u32_Next - u32_Home) & u32_Mask) >=
+                ((u32_Next - u32_Slot) & u32_Mask))
+            {
+                gt_ItcIdInternTable[u32_Slot] = gt_ItcIdInternTable[u32_Next];
+                u32_Slot = u32_Next;
+            }
+        }
+
+        gt_ItcIdInternTable[u32_Slot].pt_Id = NULL;
+        gt_ItcIdInternTable[u32_Slot].u32_Hash = 0;
+        gu32_ItcInternedIdCount--;
+    }
+
+    pt_Id->b_IsInterned = false;
+}
+
+/**
+ * @brief Release a reference to an interned ID
+ *
+ * @param pt_Id The interned ID
+ * @return `bool` `true` if one of the shared references was released and the
+ * ID must be kept. `false` if this was the last reference. The ID has been
+ * removed from the intern table and must be deallocated
+ */
+static bool releaseInternedId(
+    ITC_Id_t *const pt_Id
+)
+{
+    bool b_Released = false;
+
+    lockInternTable();
+
+    if (pt_Id->u32_ShareCount > 0)
+    {
+        pt_Id->u32_ShareCount--;
+        b_Released = true;
+    }
+    else
+    {
+        removeInternedId(pt_Id);
+    }
+
+    unlockInternTable();
+
+    return b_Released;
+}
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+
+#if ITC_CONFIG_ENABLE_TRACING || ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/**
+ * @brief Count the nodes of an ID
+ *
+ * @param pt_Id The ID
+ * @return `uint32_t` The number of nodes in the ID tree
+ */
+static uint32_t countIdNodes(
+    const ITC_Id_t *pt_Id
+)
+{
+    /* Remember the parent as this might be a subtree */
+    const ITC_Id_t *const pt_RootIdParent = pt_Id->pt_Parent;
+    uint32_t u32_NodeCount = 0;
+
+    /* Perform a pre-order traversal */
+    while (pt_Id != pt_RootIdParent)
+    {
+        u32_NodeCount++;
+
+        if (ITC_ID_IS_PARENT_ID(pt_Id))
+        {
+            /* Descend into left child */
+            pt_Id = pt_Id->pt_Left;
+        }
+        else
+        {
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_Id->pt_Parent != pt_RootIdParent &&
+                   pt_Id->pt_Parent->pt_Right == pt_Id)
+            {
+                pt_Id = pt_Id->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_Id->pt_Parent != pt_RootIdParent)
+            {
+                pt_Id = pt_Id->pt_Parent->pt_Right;
+            }
+            else
+            {
+                pt_Id = pt_RootIdParent;
+            }
+        }
+    }
+
+    return u32_NodeCount;
+}
+
+#endif /* ITC_CONFIG_ENABLE_TRACING || ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
 /**
  * @brief Splits a NULL ID into 2 new IDs fulfilling `split(0)`
  * Rules:
@@ -823,673 +1122,3567 @@ static ITC_Status_t sumIdI(
 }
 
 /**
- * @brief Serialise an existing ITC Id
+ * @brief Allocate a pool of ID nodes
  *
- * Data format:
- *  - Byte 0: The major component of the version of the `libitc` library used to
- *      serialise the data. Optional, can be ommitted.
- *  - Bytes (0 - 1) - N (see above): The ID tree.
- *    Each node of the ID tree is serialised in pre-order. I.e the root is
- *    serialised first, followed by the left child, then the right child. Each
- *    node consists of a 1-byte header.
- *    See:
- *    - define ITC_SERDES_PARENT_ID_HEADER
- *    - define ITC_SERDES_SEED_ID_HEADER
- *    - define ITC_SERDES_NULL_ID_HEADER
- *    Any other header value is invalid.
+ * The nodes are chained through their `pt_Parent` pointers. On failure, the
+ * nodes allocated so far are deallocated.
  *
- * @param ppt_Id The pointer to the Id
- * @param pu8_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
- * the output.
- * of the data inside the buffer in bytes.
+ * @param ppt_Pool (out) The pool of nodes
+ * @param u32_NodeCount The number of nodes to allocate
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
-static ITC_Status_t serialiseId(
-    const ITC_Id_t *pt_Id,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize,
-    const bool b_AddVersion
+static ITC_Status_t newIdPool(
+    ITC_Id_t **const ppt_Pool,
+    uint32_t u32_NodeCount
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The parent of the current ID*/
-    const ITC_Id_t *pt_RootIdParent = NULL; /* The parent of the root node */
-    uint32_t u32_Offset = 0; /* The current offset */
+    ITC_Id_t *pt_Node;
 
-    /* Remember the root parent as this might be a subtree */
-    pt_RootIdParent = pt_Id->pt_Parent;
+    *ppt_Pool = NULL;
 
-    if (b_AddVersion)
+    while (t_Status == ITC_STATUS_SUCCESS && u32_NodeCount)
     {
-        /* Prepend the lib version (provided by build system c args) */
-        pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
-
-        /* Increment offset */
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
-    }
+        t_Status = newId(&pt_Node, *ppt_Pool, false);
 
-    /* Perform a pre-order traversal */
-    while (pt_Id && t_Status == ITC_STATUS_SUCCESS)
-    {
-        if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
-        {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-        }
-        else
+        if (t_Status == ITC_STATUS_SUCCESS)
         {
-            /* Create the header */
-            pu8_Buffer[u32_Offset] =
-                (ITC_ID_IS_LEAF_ID(pt_Id))
-                    ? ((pt_Id->b_IsOwner) ? ITC_SERDES_SEED_ID_HEADER
-                                          : ITC_SERDES_NULL_ID_HEADER)
-                    : ITC_SERDES_PARENT_ID_HEADER;
-
-            /* Increment the offset */
-            u32_Offset += sizeof(ITC_SerDes_Header_t);
-
-            /* Descend into left tree */
-            if (pt_Id->pt_Left)
-            {
-                pt_Id = pt_Id->pt_Left;
-            }
-            /* Valid parent ITC ID trees always have both left and right
-            * nodes. Thus, there is no need to check if the current node
-            * doesn't have a left child but has a right one.
-            *
-            * Instead directly start backtracking up the tree */
-            else
-            {
-                /* Remember the parent */
-                pt_CurrentIdParent = pt_Id->pt_Parent;
-
-                /* Loop until the current element is no longer reachable
-                * through the parent's right child */
-                while (pt_CurrentIdParent != pt_RootIdParent &&
-                    pt_CurrentIdParent->pt_Right == pt_Id)
-                {
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
-                }
-
-                /* There is a right subtree that has not been explored yet */
-                if (pt_CurrentIdParent != pt_RootIdParent)
-                {
-                    pt_Id = pt_CurrentIdParent->pt_Right;
-                }
-                else
-                {
-                    pt_Id = NULL;
-                }
-            }
+            *ppt_Pool = pt_Node;
+            u32_NodeCount--;
         }
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    /* Deallocate the partial pool.
+     * Ignore return statuses. There is nothing else to do if the free
+     * fails. Also it is more important to convey the allocation failure */
+    while (t_Status != ITC_STATUS_SUCCESS && *ppt_Pool)
     {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        pt_Node = *ppt_Pool;
+        *ppt_Pool = pt_Node->pt_Parent;
+
+        (void)ITC_PORT_FREE(pt_Node, ITC_PORT_ALLOCTYPE_ITC_ID_T);
     }
 
     return t_Status;
 }
 
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-
 /**
- * @brief Serialise an existing ITC Id to ASCII string
+ * @brief Take a node from a pool allocated with ::newIdPool()
  *
- * @param ppt_Id The pointer to the Id
- * @param pc_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ * @note The pool must not be empty
+ * @param ppt_Pool (in) The pool of nodes. (out) The remaining pool
+ * @param ppt_Id (out) The pointer to the taken node
+ * @param pt_Parent The pointer to the parent ID in the tree. Otherwise NULL
+ * @param b_IsOwner Whether the ID owns its interval or not
  */
-static ITC_Status_t serialiseIdToString(
-    const ITC_Id_t *pt_Id,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+static void takePooledId(
+    ITC_Id_t **const ppt_Pool,
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t *const pt_Parent,
+    const bool b_IsOwner
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The current ID node */
-    const ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent; /* The root parent */
-    uint32_t u32_Offset = 0;
+    *ppt_Id = *ppt_Pool;
+    *ppt_Pool = (*ppt_Pool)->pt_Parent;
 
-    /* Ensure there is at least space for the NULL termination */
-    if (*pu32_BufferSize < 1)
+    (*ppt_Id)->b_IsOwner = b_IsOwner;
+    (*ppt_Id)->pt_Parent = pt_Parent;
+}
+
+/**
+ * @brief Split an ID in place fulfilling `split(i)`
+ *
+ * For the rules see ::splitIdI(). Only a single path of the ID tree is walked.
+ * The nodes of the ID are reused by the first half, and its subtrees that end
+ * up in the second half are moved over, instead of being cloned. Only the
+ * nodes that do not exist in the original ID are allocated, and all of them
+ * are allocated before the ID is modified.
+ *
+ * @note On failure, the ID is left unmodified
+ * @param pt_Id (in) The existing ID. (out) The first half of the split ID
+ * @param ppt_OtherId (out) The second half of the split ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t splitIdInPlaceI(
+    ITC_Id_t *pt_Id,
+    ITC_Id_t **const ppt_OtherId
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    const ITC_Id_t *pt_CurrentId = pt_Id;
+    ITC_Id_t *pt_Pool = NULL;
+    uint32_t u32_NodeCount = 0;
+    bool b_IsDone = false;
+
+    ITC_Id_t **ppt_CurrentOtherId = ppt_OtherId;
+    ITC_Id_t *pt_ParentCurrentOtherId = NULL;
+
+    /* Init the new ID */
+    *ppt_OtherId = NULL;
+
+    /* Count the nodes that need to be allocated */
+    while (!b_IsDone)
     {
-        t_Status = ITC_STATUS_INVALID_PARAM;
+        /* split(0) = (0, 0) */
+        if (ITC_ID_IS_NULL_ID(pt_CurrentId))
+        {
+            u32_NodeCount += 1;
+            b_IsDone = true;
+        }
+        /* split(1) = ((1, 0), (0, 1)) */
+        else if (ITC_ID_IS_SEED_ID(pt_CurrentId))
+        {
+            u32_NodeCount += 5;
+            b_IsDone = true;
+        }
+        /* split((0, i)) = ((0, i1), (0, i2)), where (i1, i2) = split(i) */
+        else if (ITC_ID_IS_NULL_ID(pt_CurrentId->pt_Left))
+        {
+            u32_NodeCount += 2;
+            pt_CurrentId = pt_CurrentId->pt_Right;
+        }
+        /* split((i, 0)) = ((i1, 0), (i2, 0)), where (i1, i2) = split(i) */
+        else if (ITC_ID_IS_NULL_ID(pt_CurrentId->pt_Right))
+        {
+            u32_NodeCount += 2;
+            pt_CurrentId = pt_CurrentId->pt_Left;
+        }
+        /* split((i1, i2)) = ((i1, 0), (0, i2)) */
+        else
+        {
+            u32_NodeCount += 3;
+            b_IsDone = true;
+        }
     }
 
-    /* Perform a pre-order traversal */
-    while (t_Status == ITC_STATUS_SUCCESS && pt_Id)
+    t_Status = newIdPool(&pt_Pool, u32_NodeCount);
+
+    /* Nothing can fail from here on */
+    b_IsDone = (t_Status != ITC_STATUS_SUCCESS);
+
+    while (!b_IsDone)
     {
-        /* Check there is space left in the buffer, taking into account the
-         * NULL termination byte and opening bracket/ownership indicator */
-        if (u32_Offset >= (*pu32_BufferSize - 1))
+        /* split(0) = (0, 0) */
+        if (ITC_ID_IS_NULL_ID(pt_Id))
         {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            takePooledId(
+                &pt_Pool, ppt_CurrentOtherId, pt_ParentCurrentOtherId, false);
+
+            b_IsDone = true;
+        }
+        /* split(1) = ((1, 0), (0, 1)) */
+        else if (ITC_ID_IS_SEED_ID(pt_Id))
+        {
+            pt_Id->b_IsOwner = false;
+            takePooledId(&pt_Pool, &pt_Id->pt_Left, pt_Id, true);
+            takePooledId(&pt_Pool, &pt_Id->pt_Right, pt_Id, false);
+
+            takePooledId(
+                &pt_Pool, ppt_CurrentOtherId, pt_ParentCurrentOtherId, false);
+            takePooledId(
+                &pt_Pool,
+                &(*ppt_CurrentOtherId)->pt_Left,
+                *ppt_CurrentOtherId,
+                false);
+            takePooledId(
+                &pt_Pool,
+                &(*ppt_CurrentOtherId)->pt_Right,
+                *ppt_CurrentOtherId,
+                true);
+
+            b_IsDone = true;
+        }
+        /* split((0, i)) = ((0, i1), (0, i2)), where (i1, i2) = split(i) */
+        else if (ITC_ID_IS_NULL_ID(pt_Id->pt_Left))
+        {
+            takePooledId(
+                &pt_Pool, ppt_CurrentOtherId, pt_ParentCurrentOtherId, false);
+            takePooledId(
+                &pt_Pool,
+                &(*ppt_CurrentOtherId)->pt_Left,
+                *ppt_CurrentOtherId,
+                false);
+
+            /* Descend into the right subtrees */
+            pt_Id = pt_Id->pt_Right;
+            pt_ParentCurrentOtherId = *ppt_CurrentOtherId;
+            ppt_CurrentOtherId = &(*ppt_CurrentOtherId)->pt_Right;
+        }
+        /* split((i, 0)) = ((i1, 0), (i2, 0)), where (i1, i2) = split(i) */
+        else if (ITC_ID_IS_NULL_ID(pt_Id->pt_Right))
+        {
+            takePooledId(
+                &pt_Pool, ppt_CurrentOtherId, pt_ParentCurrentOtherId, false);
+            takePooledId(
+                &pt_Pool,
+                &(*ppt_CurrentOtherId)->pt_Right,
+                *ppt_CurrentOtherId,
+                false);
+
+            /* Descend into the left subtrees */
+            pt_Id = pt_Id->pt_Left;
+            pt_ParentCurrentOtherId = *ppt_CurrentOtherId;
+            ppt_CurrentOtherId = &(*ppt_CurrentOtherId)->pt_Left;
         }
+        /* split((i1, i2)) = ((i1, 0), (0, i2)) */
         else
         {
-            if (ITC_ID_IS_PARENT_ID(pt_Id))
+            takePooledId(
+                &pt_Pool, ppt_CurrentOtherId, pt_ParentCurrentOtherId, false);
+            takePooledId(
+                &pt_Pool,
+                &(*ppt_CurrentOtherId)->pt_Left,
+                *ppt_CurrentOtherId,
+                false);
+
+            /* Move `i2` over to the second half */
+            (*ppt_CurrentOtherId)->pt_Right = pt_Id->pt_Right;
+            pt_Id->pt_Right->pt_Parent = *ppt_CurrentOtherId;
+
+            takePooledId(&pt_Pool, &pt_Id->pt_Right, pt_Id, false);
+
+            b_IsDone = true;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Check whether two IDs can be summed, i.e. their intervals do not
+ * overlap
+ *
+ * For the rules see ::sumIdI().
+ *
+ * @param pt_Id1 The first ID
+ * @param pt_Id2 The second ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the intervals overlap
+ */
+static ITC_Status_t validateIdSumI(
+    const ITC_Id_t *pt_Id1,
+    const ITC_Id_t *pt_Id2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    /* Remember the root parent as this might be a subtree */
+    const ITC_Id_t *const pt_RootId1Parent = pt_Id1->pt_Parent;
+
+    /* Perform a pre-order traversal of the nodes both IDs have in common */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Id1)
+    {
+        /* sum((l1, r1), (l2, r2)) = norm(sum(l1, l2), sum(r1, r2)) */
+        if (ITC_ID_IS_PARENT_ID(pt_Id1) && ITC_ID_IS_PARENT_ID(pt_Id2))
+        {
+            pt_Id1 = pt_Id1->pt_Left;
+            pt_Id2 = pt_Id2->pt_Left;
+        }
+        /* Anything but sum(0, i) or sum(i, 0) */
+        else if (!ITC_ID_IS_NULL_ID(pt_Id1) && !ITC_ID_IS_NULL_ID(pt_Id2))
+        {
+            t_Status = ITC_STATUS_OVERLAPPING_ID_INTERVAL;
+        }
+        else
+        {
+            /* Loop until the current node is no longer its parent's right
+             * child node. The nodes of both IDs are always at the same
+             * position in their trees */
+            while (pt_Id1->pt_Parent != pt_RootId1Parent &&
+                   pt_Id1->pt_Parent->pt_Right == pt_Id1)
             {
-                /* Open a bracket to signify a parent node */
-                pc_Buffer[u32_Offset] = '(';
+                pt_Id1 = pt_Id1->pt_Parent;
+                pt_Id2 = pt_Id2->pt_Parent;
             }
-            else if (pt_Id->b_IsOwner)
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_Id1->pt_Parent != pt_RootId1Parent)
             {
-                pc_Buffer[u32_Offset] = '1';
+                pt_Id1 = pt_Id1->pt_Parent->pt_Right;
+                pt_Id2 = pt_Id2->pt_Parent->pt_Right;
             }
+            /* The trees have been fully explored. Exit loop */
             else
             {
-                pc_Buffer[u32_Offset] = '0';
+                pt_Id1 = NULL;
             }
+        }
+    }
 
-            /* Increment offset */
-            u32_Offset++;
+    return t_Status;
+}
 
-            /* Descend into left tree */
-            if (pt_Id->pt_Left)
+/**
+ * @brief Sum two IDs in place fulfilling `sum(i1, i2)`
+ *
+ * For the rules see ::sumIdI(). The nodes of the first ID are reused by the
+ * summed ID, and the subtrees of the second ID are moved over, instead of
+ * being cloned. The remaining nodes of the second ID are deallocated. No nodes
+ * are allocated.
+ *
+ * @note The IDs must have passed ::validateIdSumI(). The second ID is always
+ * consumed, even if deallocating any of its nodes fails
+ * @param ppt_Id (in) The first ID. (out) The summed ID
+ * @param pt_OtherId The second ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t sumIdInPlaceI(
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t *pt_OtherId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus; /* The last free status */
+
+    /* The pointer to the link holding the current node of the first ID */
+    ITC_Id_t **ppt_CurrentId = ppt_Id;
+    ITC_Id_t *pt_CurrentId = *ppt_Id;
+    ITC_Id_t *pt_CurrentIdParent;
+    ITC_Id_t *pt_OtherIdParent = pt_OtherId->pt_Parent;
+    ITC_Id_t *pt_NextOtherIdParent;
+
+    /* Remember the root parent as this might be a subtree */
+    const ITC_Id_t *const pt_RootIdParent = pt_CurrentId->pt_Parent;
+
+    while (pt_CurrentId)
+    {
+        /* sum((l1, r1), (l2, r2)) = norm(sum(l1, l2), sum(r1, r2)) */
+        if (ITC_ID_IS_PARENT_ID(pt_CurrentId) &&
+            ITC_ID_IS_PARENT_ID(pt_OtherId))
+        {
+            ppt_CurrentId = &pt_CurrentId->pt_Left;
+            pt_CurrentId = pt_CurrentId->pt_Left;
+            pt_OtherIdParent = pt_OtherId;
+            pt_OtherId = pt_OtherId->pt_Left;
+        }
+        else
+        {
+            /* sum(0, i) = i */
+            if (ITC_ID_IS_NULL_ID(pt_CurrentId))
             {
-                /* Remember the parent address */
-                pt_CurrentIdParent = pt_Id;
+                /* Move `i` over to the summed ID */
+                *ppt_CurrentId = pt_OtherId;
+                pt_OtherId->pt_Parent = pt_CurrentId->pt_Parent;
 
-                pt_Id = pt_Id->pt_Left;
+                t_FreeStatus = ITC_PORT_FREE(
+                    pt_CurrentId, ITC_PORT_ALLOCTYPE_ITC_ID_T);
+
+                pt_CurrentId = pt_OtherId;
             }
-            /* Valid parent ITC Id trees always have both left and right
-             * nodes. Thus, there is no need to check if the current node
-             * doesn't have a left child but has a right one.
-             *
-             * Instead directly start backtracking up the tree */
+            /* sum(i, 0) = i */
             else
             {
-                /* Loop until the current element is no longer reachable
-                 * through the parent's right child */
-                while (t_Status == ITC_STATUS_SUCCESS &&
-                       pt_CurrentIdParent != pt_RootIdParent &&
-                       pt_CurrentIdParent->pt_Right == pt_Id)
+                t_FreeStatus = ITC_PORT_FREE(
+                    pt_OtherId, ITC_PORT_ALLOCTYPE_ITC_ID_T);
+            }
+
+            /* Return last error */
+            if (t_FreeStatus != ITC_STATUS_SUCCESS)
+            {
+                t_Status = t_FreeStatus;
+            }
+
+            pt_CurrentIdParent = pt_CurrentId->pt_Parent;
+
+            /* Loop until the current node is no longer its parent's right
+             * child node. Both subtrees of the parent node have been summed by
+             * then, so it can be normalised, and the matching parent node of
+             * the second ID is no longer needed */
+            while (pt_CurrentIdParent != pt_RootIdParent &&
+                   pt_CurrentIdParent->pt_Right == pt_CurrentId)
+            {
+                /* norm(1, 1) = 1 or norm(0, 0) = 0 */
+                if (ITC_ID_IS_SEED_SEED_ID(pt_CurrentIdParent) ||
+                    ITC_ID_IS_NULL_NULL_ID(pt_CurrentIdParent))
                 {
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+                    t_FreeStatus = normId11Or00(pt_CurrentIdParent);
 
-                    /* Check there is space left in the buffer, taking into
-                     * account the NULL termination byte and bracket */
-                    if (u32_Offset >= (*pu32_BufferSize - 1))
-                    {
-                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-                    }
-                    else
+                    if (t_FreeStatus != ITC_STATUS_SUCCESS)
                     {
-                        /* Close the current parent node bracket */
-                        pc_Buffer[u32_Offset] = ')';
-                        u32_Offset++;
+                        t_Status = t_FreeStatus;
                     }
                 }
 
-                /* There is a right subtree that has not been explored yet */
-                if (t_Status == ITC_STATUS_SUCCESS &&
-                    pt_CurrentIdParent != pt_RootIdParent)
-                {
-                    pt_Id = pt_CurrentIdParent->pt_Right;
+                pt_NextOtherIdParent = pt_OtherIdParent->pt_Parent;
 
-                    /* Check there is space left in the buffer, taking into
-                     * account the NULL termination byte, comma and space */
-                    if (u32_Offset >= (*pu32_BufferSize - 2))
-                    {
-                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-                    }
-                    else
-                    {
-                        /* Add a comma to signify the start of a new node */
-                        pc_Buffer[u32_Offset] = ',';
-                        u32_Offset++;
+                t_FreeStatus = ITC_PORT_FREE(
+                    pt_OtherIdParent, ITC_PORT_ALLOCTYPE_ITC_ID_T);
 
-                        /* Add a space between nodes */
-                        pc_Buffer[u32_Offset] = ' ';
-                        u32_Offset++;
-                    }
-                }
-                else
+                if (t_FreeStatus != ITC_STATUS_SUCCESS)
                 {
-                    pt_Id = NULL;
+                    t_Status = t_FreeStatus;
                 }
+
+                pt_OtherIdParent = pt_NextOtherIdParent;
+                pt_CurrentId = pt_CurrentIdParent;
+                pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentIdParent != pt_RootIdParent)
+            {
+                ppt_CurrentId = &pt_CurrentIdParent->pt_Right;
+                pt_CurrentId = pt_CurrentIdParent->pt_Right;
+                pt_OtherId = pt_OtherIdParent->pt_Right;
             }
+            /* The trees have been fully explored. Exit loop */
+            else
+            {
+                pt_CurrentId = NULL;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Serialise an existing ITC Id
+ *
+ * Data format:
+ *  - Byte 0: The major component of the version of the `libitc` library used to
+ *      serialise the data. Optional, can be ommitted.
+ *  - Bytes (0 - 1) - N (see above): The ID tree.
+ *    Each node of the ID tree is serialised in pre-order. I.e the root is
+ *    serialised first, followed by the left child, then the right child. Each
+ *    node consists of a 1-byte header.
+ *    See:
+ *    - define ITC_SERDES_PARENT_ID_HEADER
+ *    - define ITC_SERDES_SEED_ID_HEADER
+ *    - define ITC_SERDES_NULL_ID_HEADER
+ *    Any other header value is invalid.
+ *
+ * @param ppt_Id The pointer to the Id
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
+ * the output.
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t serialiseId(
+    const ITC_Id_t *pt_Id,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize,
+    const bool b_AddVersion
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The parent of the current ID*/
+    const ITC_Id_t *pt_RootIdParent = NULL; /* The parent of the root node */
+    uint32_t u32_Offset = 0; /* The current offset */
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootIdParent = pt_Id->pt_Parent;
+
+    if (b_AddVersion)
+    {
+        /* Prepend the lib version (provided by build system c args) */
+        pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+
+        /* Increment offset */
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    /* Perform a pre-order traversal */
+    while (pt_Id && t_Status == ITC_STATUS_SUCCESS)
+    {
+        if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
         }
+        else
+        {
+            /* Create the header */
+            pu8_Buffer[u32_Offset] =
+                (ITC_ID_IS_LEAF_ID(pt_Id))
+                    ? ((pt_Id->b_IsOwner) ? ITC_SERDES_SEED_ID_HEADER
+                                          : ITC_SERDES_NULL_ID_HEADER)
+                    : ITC_SERDES_PARENT_ID_HEADER;
+
+            /* Increment the offset */
+            u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+            /* Descend into left tree */
+            if (pt_Id->pt_Left)
+            {
+                pt_Id = pt_Id->pt_Left;
+            }
+            /* Valid parent ITC ID trees always have both left and right
+            * nodes. Thus, there is no need to check if the current node
+            * doesn't have a left child but has a right one.
+            *
+            * Instead directly start backtracking up the tree */
+            else
+            {
+                /* Remember the parent */
+                pt_CurrentIdParent = pt_Id->pt_Parent;
+
+                /* Loop until the current element is no longer reachable
+                * through the parent's right child */
+                while (pt_CurrentIdParent != pt_RootIdParent &&
+                    pt_CurrentIdParent->pt_Right == pt_Id)
+                {
+                    pt_Id = pt_Id->pt_Parent;
+                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (pt_CurrentIdParent != pt_RootIdParent)
+                {
+                    pt_Id = pt_CurrentIdParent->pt_Right;
+                }
+                else
+                {
+                    pt_Id = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Calculate the size of an existing ITC Id once serialised
+ *
+ * See ::serialiseId() for the data format.
+ *
+ * @param pt_Id The Id
+ * @param b_AddVersion Whether to account for the `ITC_VERSION_MAJOR` field
+ * @param pu32_Size (out) The size of the serialised Id in bytes
+ */
+static void getSerialisedIdSize(
+    const ITC_Id_t *pt_Id,
+    const bool b_AddVersion,
+    uint32_t *const pu32_Size
+)
+{
+    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The parent of the current ID*/
+    const ITC_Id_t *pt_RootIdParent = NULL; /* The parent of the root node */
+    uint32_t u32_Size = (b_AddVersion) ? (uint32_t)ITC_VERSION_MAJOR_LEN : 0;
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootIdParent = pt_Id->pt_Parent;
+
+    /* Perform a pre-order traversal. Each node is serialised as a header */
+    while (pt_Id)
+    {
+        u32_Size += sizeof(ITC_SerDes_Header_t);
+
+        /* Descend into left tree */
+        if (pt_Id->pt_Left)
+        {
+            pt_Id = pt_Id->pt_Left;
+        }
+        /* Valid parent ITC ID trees always have both left and right
+         * nodes. Instead directly start backtracking up the tree */
+        else
+        {
+            /* Remember the parent */
+            pt_CurrentIdParent = pt_Id->pt_Parent;
+
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_CurrentIdParent != pt_RootIdParent &&
+                   pt_CurrentIdParent->pt_Right == pt_Id)
+            {
+                pt_Id = pt_Id->pt_Parent;
+                pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentIdParent != pt_RootIdParent)
+            {
+                pt_Id = pt_CurrentIdParent->pt_Right;
+            }
+            else
+            {
+                pt_Id = NULL;
+            }
+        }
+    }
+
+    *pu32_Size = u32_Size;
+}
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/**
+ * @brief Serialise an existing ITC Id in the compact format
+ *
+ * See ::ITC_SerDes_Util_serialiseIdCompact() for the data format.
+ *
+ * @param pt_Id The Id
+ * @param pt_Writer The bit stream to write the serialised Id to
+ * @param pu32_BitCount (out) The size of the serialised Id in bits. If
+ * `pt_Writer` is `NULL`, only the size is calculated
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseIdCompact(
+    const ITC_Id_t *pt_Id,
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer,
+    uint32_t *const pu32_BitCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The parent of the current ID*/
+    const ITC_Id_t *pt_RootIdParent = NULL; /* The parent of the root node */
+    uint32_t u32_BitCount = 0;
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootIdParent = pt_Id->pt_Parent;
+
+    /* Perform a pre-order traversal */
+    while (pt_Id && t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (ITC_ID_IS_LEAF_ID(pt_Id))
+        {
+            u32_BitCount += ITC_SERDES_COMPACT_LEAF_ID_CODE_LEN;
+
+            if (pt_Writer)
+            {
+                t_Status = ITC_SerDes_Util_writeBits(
+                    pt_Writer,
+                    (pt_Id->b_IsOwner) ? ITC_SERDES_COMPACT_SEED_ID_CODE
+                                       : ITC_SERDES_COMPACT_NULL_ID_CODE,
+                    ITC_SERDES_COMPACT_LEAF_ID_CODE_LEN);
+            }
+        }
+        else
+        {
+            u32_BitCount += ITC_SERDES_COMPACT_PARENT_ID_CODE_LEN;
+
+            if (pt_Writer)
+            {
+                t_Status = ITC_SerDes_Util_writeBits(
+                    pt_Writer,
+                    ITC_SERDES_COMPACT_PARENT_ID_CODE,
+                    ITC_SERDES_COMPACT_PARENT_ID_CODE_LEN);
+            }
+        }
+
+        /* Descend into left tree */
+        if (pt_Id->pt_Left)
+        {
+            pt_Id = pt_Id->pt_Left;
+        }
+        /* Valid parent ITC ID trees always have both left and right
+         * nodes. Instead directly start backtracking up the tree */
+        else
+        {
+            /* Remember the parent */
+            pt_CurrentIdParent = pt_Id->pt_Parent;
+
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_CurrentIdParent != pt_RootIdParent &&
+                   pt_CurrentIdParent->pt_Right == pt_Id)
+            {
+                pt_Id = pt_Id->pt_Parent;
+                pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentIdParent != pt_RootIdParent)
+            {
+                pt_Id = pt_CurrentIdParent->pt_Right;
+            }
+            else
+            {
+                pt_Id = NULL;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && pu32_BitCount)
+    {
+        *pu32_BitCount = u32_BitCount;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an ITC Id in the compact format
+ *
+ * See ::ITC_SerDes_Util_serialiseIdCompact() for the data format.
+ *
+ * @param pt_Reader The bit stream holding the serialised Id
+ * @param ppt_Id The pointer to the deserialised Id
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if the serialised Id is invalid
+ */
+static ITC_Status_t deserialiseIdCompact(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t **ppt_CurrentId = NULL; /* The current ID */
+    ITC_Id_t *pt_CurrentIdParent = NULL;
+    uint32_t u32_Code = 0;
+    bool b_IsParent;
+
+    *ppt_Id = NULL;
+    ppt_CurrentId = ppt_Id;
+
+    /* The tree is complete once the last leaf has been deserialised */
+    while (ppt_CurrentId && t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_readBits(
+            pt_Reader, &u32_Code, ITC_SERDES_COMPACT_PARENT_ID_CODE_LEN);
+
+        b_IsParent = u32_Code == ITC_SERDES_COMPACT_PARENT_ID_CODE;
+
+        /* Read the ownership bit of a leaf node */
+        if (t_Status == ITC_STATUS_SUCCESS && !b_IsParent)
+        {
+            t_Status = ITC_SerDes_Util_readBits(
+                pt_Reader,
+                &u32_Code,
+                ITC_SERDES_COMPACT_LEAF_ID_CODE_LEN -
+                    ITC_SERDES_COMPACT_PARENT_ID_CODE_LEN);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = newId(
+                ppt_CurrentId,
+                pt_CurrentIdParent,
+                !b_IsParent && u32_Code == ITC_SERDES_COMPACT_SEED_ID_CODE);
+        }
+        /* The bit stream ended before the tree was complete */
+        else if (t_Status == ITC_STATUS_INSUFFICIENT_RESOURCES)
+        {
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* If the current node is a parent - descend into left child */
+            if (b_IsParent)
+            {
+                pt_CurrentIdParent = *ppt_CurrentId;
+                ppt_CurrentId = &(*ppt_CurrentId)->pt_Left;
+            }
+            else
+            {
+                /* Backtrack the tree until an unallocated right child is found
+                 * or there are no more parent nodes */
+                while (pt_CurrentIdParent && pt_CurrentIdParent->pt_Right)
+                {
+                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+                }
+
+                /* Descend into the unallocated right child of the parent.
+                 * If there isn't one, the tree is complete */
+                ppt_CurrentId = (pt_CurrentIdParent)
+                    ? &pt_CurrentIdParent->pt_Right
+                    : NULL;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check the deserialised ID is valid */
+        t_Status = validateId(*ppt_Id, true);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy */
+        (void)ITC_Id_destroy(ppt_Id);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an ITC Id in the compact format, prefixed with a version
+ * field
+ *
+ * @param pu8_Buffer The buffer holding the serialised Id data
+ * @param u32_BufferSize The size of the buffer in bytes. Must be `> 0`
+ * @param ppt_Id The pointer to the deserialised Id
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if the serialised Id is invalid
+ */
+static ITC_Status_t deserialiseVersionedIdCompact(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_SerDes_Util_BitReader_t t_Reader = {
+        .pu8_Buffer = &pu8_Buffer[ITC_VERSION_MAJOR_LEN],
+        .u32_BufferSize = u32_BufferSize - (uint32_t)ITC_VERSION_MAJOR_LEN,
+        .u32_BitOffset = 0,
+    };
+
+    *ppt_Id = NULL;
+
+    t_Status = ITC_SerDes_Util_validateDesLibVersion(
+        pu8_Buffer[0] & (uint8_t)~ITC_SERDES_COMPACT_FORMAT_FLAG);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseIdCompact(&t_Reader, ppt_Id);
+    }
+
+    /* Check nothing but padding follows the ID */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        !ITC_SerDes_Util_isBitReaderAtEnd(&t_Reader))
+    {
+        t_Status = ITC_STATUS_CORRUPT_ID;
+
+        (void)ITC_Id_destroy(ppt_Id);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/**
+ * @brief Serialise an existing ITC Id to ASCII string
+ *
+ * @param ppt_Id The pointer to the Id
+ * @param pc_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseIdToString(
+    const ITC_Id_t *pt_Id,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The current ID node */
+    const ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent; /* The root parent */
+    uint32_t u32_Offset = 0;
+
+    /* Ensure there is at least space for the NULL termination */
+    if (*pu32_BufferSize < 1)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Id)
+    {
+        /* Check there is space left in the buffer, taking into account the
+         * NULL termination byte and opening bracket/ownership indicator */
+        if (u32_Offset >= (*pu32_BufferSize - 1))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        else
+        {
+            if (ITC_ID_IS_PARENT_ID(pt_Id))
+            {
+                /* Open a bracket to signify a parent node */
+                pc_Buffer[u32_Offset] = '(';
+            }
+            else if (pt_Id->b_IsOwner)
+            {
+                pc_Buffer[u32_Offset] = '1';
+            }
+            else
+            {
+                pc_Buffer[u32_Offset] = '0';
+            }
+
+            /* Increment offset */
+            u32_Offset++;
+
+            /* Descend into left tree */
+            if (pt_Id->pt_Left)
+            {
+                /* Remember the parent address */
+                pt_CurrentIdParent = pt_Id;
+
+                pt_Id = pt_Id->pt_Left;
+            }
+            /* Valid parent ITC Id trees always have both left and right
+             * nodes. Thus, there is no need to check if the current node
+             * doesn't have a left child but has a right one.
+             *
+             * Instead directly start backtracking up the tree */
+            else
+            {
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (t_Status == ITC_STATUS_SUCCESS &&
+                       pt_CurrentIdParent != pt_RootIdParent &&
+                       pt_CurrentIdParent->pt_Right == pt_Id)
+                {
+                    pt_Id = pt_Id->pt_Parent;
+                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte and bracket */
+                    if (u32_Offset >= (*pu32_BufferSize - 1))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Close the current parent node bracket */
+                        pc_Buffer[u32_Offset] = ')';
+                        u32_Offset++;
+                    }
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    pt_CurrentIdParent != pt_RootIdParent)
+                {
+                    pt_Id = pt_CurrentIdParent->pt_Right;
+
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte, comma and space */
+                    if (u32_Offset >= (*pu32_BufferSize - 2))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Add a comma to signify the start of a new node */
+                        pc_Buffer[u32_Offset] = ',';
+                        u32_Offset++;
+
+                        /* Add a space between nodes */
+                        pc_Buffer[u32_Offset] = ' ';
+                        u32_Offset++;
+                    }
+                }
+                else
+                {
+                    pt_Id = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Ensure the string is always NULL-termiated */
+        pc_Buffer[u32_Offset] = '\0';
+        u32_Offset++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Calculate the length of an existing ITC Id once serialised to ASCII
+ * string
+ *
+ * See ::serialiseIdToString() for the data format.
+ *
+ * @param pt_Id The Id
+ * @param pu32_Length (out) The length of the string in bytes (including the
+ * NULL termination byte)
+ */
+static void getIdStringLength(
+    const ITC_Id_t *pt_Id,
+    uint32_t *const pu32_Length
+)
+{
+    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The parent of the current ID*/
+    const ITC_Id_t *pt_RootIdParent = NULL; /* The parent of the root node */
+    /* Account for the NULL termination byte */
+    uint32_t u32_Length = 1;
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootIdParent = pt_Id->pt_Parent;
+
+    /* Perform a pre-order traversal */
+    while (pt_Id)
+    {
+        /* Descend into left tree */
+        if (pt_Id->pt_Left)
+        {
+            u32_Length += ITC_SER_TO_STR_ID_PARENT_DELIMITERS_LEN;
+
+            pt_Id = pt_Id->pt_Left;
+        }
+        /* Valid parent ITC ID trees always have both left and right
+         * nodes. Instead directly start backtracking up the tree */
+        else
+        {
+            /* Each leaf is serialised as its ownership indicator */
+            u32_Length++;
+
+            /* Remember the parent */
+            pt_CurrentIdParent = pt_Id->pt_Parent;
+
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_CurrentIdParent != pt_RootIdParent &&
+                   pt_CurrentIdParent->pt_Right == pt_Id)
+            {
+                pt_Id = pt_Id->pt_Parent;
+                pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentIdParent != pt_RootIdParent)
+            {
+                pt_Id = pt_CurrentIdParent->pt_Right;
+            }
+            else
+            {
+                pt_Id = NULL;
+            }
+        }
+    }
+
+    *pu32_Length = u32_Length;
+}
+
+/**
+ * @brief Serialise an existing ITC Id to ASCII string through a string sink
+ *
+ * Produces the same output as ::serialiseIdToString(), without the NULL
+ * termination byte.
+ *
+ * @param pt_Id The Id
+ * @param pt_Sink The sink. Not flushed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+static ITC_Status_t writeIdString(
+    const ITC_Id_t *pt_Id,
+    ITC_SerDes_Util_StringSink_t *const pt_Sink
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The current ID node */
+    const ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent; /* The root parent */
+
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Id)
+    {
+        if (ITC_ID_IS_PARENT_ID(pt_Id))
+        {
+            /* Open a bracket to signify a parent node */
+            t_Status = ITC_SerDes_Util_appendToStringSink(pt_Sink, "(", 1);
+        }
+        else
+        {
+            t_Status = ITC_SerDes_Util_appendToStringSink(
+                pt_Sink, (pt_Id->b_IsOwner) ? "1" : "0", 1);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Descend into left tree */
+            if (pt_Id->pt_Left)
+            {
+                /* Remember the parent address */
+                pt_CurrentIdParent = pt_Id;
+
+                pt_Id = pt_Id->pt_Left;
+            }
+            /* Valid parent ITC Id trees always have both left and right
+             * nodes. Instead directly start backtracking up the tree */
+            else
+            {
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (t_Status == ITC_STATUS_SUCCESS &&
+                       pt_CurrentIdParent != pt_RootIdParent &&
+                       pt_CurrentIdParent->pt_Right == pt_Id)
+                {
+                    pt_Id = pt_Id->pt_Parent;
+                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+
+                    /* Close the current parent node bracket */
+                    t_Status =
+                        ITC_SerDes_Util_appendToStringSink(pt_Sink, ")", 1);
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    pt_CurrentIdParent != pt_RootIdParent)
+                {
+                    pt_Id = pt_CurrentIdParent->pt_Right;
+
+                    /* Signify the start of a new node */
+                    t_Status =
+                        ITC_SerDes_Util_appendToStringSink(pt_Sink, ", ", 2);
+                }
+                else
+                {
+                    pt_Id = NULL;
+                }
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Find the end of a serialised ID subtree
+ *
+ * @note The serialised ID must be valid. See ::validateSerialisedId()
+ * @param pu8_Buffer The buffer holding the serialised ID data
+ * @param pu32_Offset (in) The offset of the root node of the subtree. (out)
+ * The offset of the first node after the subtree
+ */
+static void skipSerialisedIdSubtree(
+    const uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_Offset
+)
+{
+    /* The number of subtrees that still need to be skipped */
+    uint32_t u32_Pending = 1;
+
+    while (u32_Pending)
+    {
+        if (pu8_Buffer[*pu32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+        {
+            u32_Pending++;
+        }
+        else
+        {
+            u32_Pending--;
+        }
+
+        *pu32_Offset += (uint32_t)sizeof(ITC_SerDes_Header_t);
+    }
+}
+
+/**
+ * @brief Get the depth of a node inside a serialised ID
+ *
+ * The serialised ID holds no back-references. Thus, the path to the node is
+ * rediscovered by descending from the root, skipping over any left subtrees
+ * that come before it.
+ *
+ * @note The serialised ID must be valid. See ::validateSerialisedId()
+ * @param pu8_Buffer The buffer holding the serialised ID data
+ * @param u32_Offset The offset of the node
+ * @param pu32_Depth (out) The depth of the node. The root has a depth of 0
+ */
+static void getSerialisedIdNodeDepth(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_Offset,
+    uint32_t *const pu32_Depth
+)
+{
+    uint32_t u32_CurrentOffset = 0; /* Start from the root */
+    uint32_t u32_RightOffset; /* The offset of the current right child */
+
+    *pu32_Depth = 0;
+
+    while (u32_CurrentOffset != u32_Offset)
+    {
+        /* Descend into the left child and find its right sibling */
+        u32_CurrentOffset += (uint32_t)sizeof(ITC_SerDes_Header_t);
+        u32_RightOffset = u32_CurrentOffset;
+        skipSerialisedIdSubtree(pu8_Buffer, &u32_RightOffset);
+
+        /* Continue into the right subtree if the node is in it */
+        if (u32_Offset >= u32_RightOffset)
+        {
+            u32_CurrentOffset = u32_RightOffset;
+        }
+
+        (*pu32_Depth)++;
+    }
+}
+
+/**
+ * @brief Serialise a serialised ITC Id to ASCII string, without deserialising
+ * it
+ *
+ * Produces the same output as ::serialiseIdToString(). The number of brackets
+ * to close after each leaf is the difference between its depth and the depth
+ * of the next node, which is recovered via ::getSerialisedIdNodeDepth().
+ *
+ * @note The serialised ID must be valid. See ::validateSerialisedId()
+ * @param pu8_Buffer The buffer holding the serialised Id data (without the
+ * `ITC_VERSION_MAJOR` field)
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pc_Buffer The buffer to hold the string
+ * @param pu32_StringSize (in) The size of the string buffer in bytes. (out)
+ * The size of the data inside the string buffer in bytes (including the NULL
+ * termination byte).
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialisedIdToString(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    char *const pc_Buffer,
+    uint32_t *const pu32_StringSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Offset = 0; /* The offset into the serialised ID */
+    uint32_t u32_StringOffset = 0; /* The offset into the string */
+    uint32_t u32_Depth = 0; /* The depth of the current node */
+    uint32_t u32_NextDepth = 0; /* The depth of the next node */
+    bool b_IsLeaf;
+
+    /* Ensure there is at least space for the NULL termination */
+    if (*pu32_StringSize < 1)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* The nodes are already in pre-order */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Offset < u32_BufferSize)
+    {
+        /* Check there is space left in the buffer, taking into account the
+         * NULL termination byte and opening bracket/ownership indicator */
+        if (u32_StringOffset >= (*pu32_StringSize - 1))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        else
+        {
+            b_IsLeaf = pu8_Buffer[u32_Offset] != ITC_SERDES_PARENT_ID_HEADER;
+
+            if (!b_IsLeaf)
+            {
+                /* Open a bracket to signify a parent node */
+                pc_Buffer[u32_StringOffset] = '(';
+                u32_Depth++;
+            }
+            else if (pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER)
+            {
+                pc_Buffer[u32_StringOffset] = '1';
+            }
+            else
+            {
+                pc_Buffer[u32_StringOffset] = '0';
+            }
+
+            /* Increment offsets */
+            u32_StringOffset++;
+            u32_Offset += (uint32_t)sizeof(ITC_SerDes_Header_t);
+
+            if (b_IsLeaf)
+            {
+                /* All brackets are closed after the last leaf */
+                u32_NextDepth = 0;
+
+                if (u32_Offset < u32_BufferSize)
+                {
+                    getSerialisedIdNodeDepth(
+                        pu8_Buffer, u32_Offset, &u32_NextDepth);
+                }
+
+                /* Close the brackets of all subtrees the leaf ends */
+                while (t_Status == ITC_STATUS_SUCCESS &&
+                       u32_Depth > u32_NextDepth)
+                {
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte and bracket */
+                    if (u32_StringOffset >= (*pu32_StringSize - 1))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Close the current parent node bracket */
+                        pc_Buffer[u32_StringOffset] = ')';
+                        u32_StringOffset++;
+                        u32_Depth--;
+                    }
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    u32_Offset < u32_BufferSize)
+                {
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte, comma and space */
+                    if (u32_StringOffset >= (*pu32_StringSize - 2))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Add a comma to signify the start of a new node */
+                        pc_Buffer[u32_StringOffset] = ',';
+                        u32_StringOffset++;
+
+                        /* Add a space between nodes */
+                        pc_Buffer[u32_StringOffset] = ' ';
+                        u32_StringOffset++;
+                    }
+                }
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Ensure the string is always NULL-termiated */
+        pc_Buffer[u32_StringOffset] = '\0';
+        u32_StringOffset++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_StringSize = u32_StringOffset;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+/**
+ * @brief Deserialise an ITC Id
+ *
+ * For the expected data format see ::serialiseId()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Id data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @param ppt_Id The pointer to the deserialised Id
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t deserialiseId(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t **ppt_CurrentId = NULL; /* The current ID */
+    ITC_Id_t *pt_CurrentIdParent = NULL;
+    uint32_t u32_Offset = 0; /* The current offset */
+
+    *ppt_Id = NULL;
+    ppt_CurrentId = ppt_Id;
+
+    /* If input contains a version check it matches the current lib version
+     * (provided by build system c args) */
+    if (b_HasVersion)
+    {
+        t_Status = ITC_SerDes_Util_validateDesLibVersion(
+            pu8_Buffer[u32_Offset]);
+
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    /* The last serialised node cannot be a parent */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        pu8_Buffer[u32_BufferSize - 1] == ITC_SERDES_PARENT_ID_HEADER)
+    {
+        t_Status = ITC_STATUS_CORRUPT_ID;
+    }
+
+    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise a parent ID node */
+        if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+        {
+            t_Status = newId(ppt_CurrentId, pt_CurrentIdParent, false);
+        }
+        /* Deserialise a leaf ID node */
+        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER ||
+                 pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER)
+        {
+            t_Status = newId(
+                ppt_CurrentId,
+                pt_CurrentIdParent,
+                (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER) ? false
+                                                                      : true);
+        }
+        /* Unknown node header value */
+        else
+        {
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Get ready for the next header:
+             *
+             * - If the current header was a parent - descend into left child
+             * - If the current header was a leaf - find the first unallocated
+             *   right child node
+             */
+            if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+            {
+                pt_CurrentIdParent = *ppt_CurrentId;
+                ppt_CurrentId = &(*ppt_CurrentId)->pt_Left;
+            }
+            else
+            {
+                /* Backtrack the tree until an unallocated right child is found
+                 * or there are no more parent nodes */
+                while (pt_CurrentIdParent && pt_CurrentIdParent->pt_Right)
+                {
+                    ppt_CurrentId = &pt_CurrentIdParent;
+                    pt_CurrentIdParent = (*ppt_CurrentId)->pt_Parent;
+                }
+
+                /* Descend into the unallocated right child of the parent */
+                if (pt_CurrentIdParent)
+                {
+                    ppt_CurrentId = &pt_CurrentIdParent->pt_Right;
+                }
+                /* There aren't any unallocated right child nodes in the tree.
+                 *
+                 * Usually this would signal the end of the loop as the only
+                 * time this should happen is when the full input buffer has
+                 * been deserialised (i.e.`u32_NextOffset == u32_BufferSize`),
+                 * since the tree is serialised in a pre-order traversal fasion.
+                 *
+                 * However, if the input buffer is malformed in some way it is
+                 * possible that there are elements in it that havent't been
+                 * deserialised yet (i.e. `u32_NextOffset < u32_BufferSize`).
+                 *
+                 * This should be treated as error as otherwise the user might
+                 * not get the expected (or full) ID tree. */
+                else if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) <
+                         u32_BufferSize)
+                {
+                    t_Status = ITC_STATUS_CORRUPT_ID;
+                }
+                else
+                {
+                    /* Nothing to do */
+                }
+            }
+
+            /* Get the next header */
+            u32_Offset += sizeof(ITC_SerDes_Header_t);
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check the deserialised ID is valid */
+        t_Status = validateId(*ppt_Id, true);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy */
+        (void)ITC_Id_destroy(ppt_Id);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Validate a serialised ITC Id without deserialising it
+ *
+ * Performs the same checks as ::deserialiseId(), including checking the ID is
+ * normalised.
+ *
+ * @param pu8_Buffer The buffer holding the serialised Id data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if the serialised ID is invalid
+ */
+static ITC_Status_t validateSerialisedId(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Offset = 0; /* The current offset */
+    /* The number of subtrees that still need to be walked */
+    uint32_t u32_Pending = 1;
+
+    /* If input contains a version check it matches the current lib version
+     * (provided by build system c args) */
+    if (b_HasVersion)
+    {
+        t_Status = ITC_SerDes_Util_validateDesLibVersion(
+            pu8_Buffer[u32_Offset]);
+
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_Pending &&
+           u32_Offset < u32_BufferSize)
+    {
+        if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+        {
+            /* A normalised parent cannot have 2 identical leaf children.
+             * If the left child is a leaf, the right child follows it */
+            if ((u32_Offset + 2 * sizeof(ITC_SerDes_Header_t)) <
+                    u32_BufferSize &&
+                pu8_Buffer[u32_Offset + 1] != ITC_SERDES_PARENT_ID_HEADER &&
+                pu8_Buffer[u32_Offset + 1] == pu8_Buffer[u32_Offset + 2])
+            {
+                t_Status = ITC_STATUS_CORRUPT_ID;
+            }
+
+            u32_Pending++;
+        }
+        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER ||
+                 pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER)
+        {
+            u32_Pending--;
+        }
+        /* Unknown node header value */
+        else
+        {
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
+
+        u32_Offset += sizeof(ITC_SerDes_Header_t);
+    }
+
+    /* The tree must be complete and have no trailing data */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        (u32_Pending || u32_Offset != u32_BufferSize))
+    {
+        t_Status = ITC_STATUS_CORRUPT_ID;
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+
+/**
+ * @brief Set the value of a packed ID node
+ *
+ * @param pt_PackedId The packed ID
+ * @param u32_Index The index of the node
+ * @param u8_Node The new value of the node
+ */
+static void setPackedIdNode(
+    ITC_PackedId_t *const pt_PackedId,
+    const uint32_t u32_Index,
+    const uint8_t u8_Node
+)
+{
+    uint8_t *pu8_Byte =
+        &pt_PackedId->pu8_Nodes[u32_Index / ITC_PACKED_ID_NODES_PER_BYTE];
+    uint32_t u32_Shift = ITC_PACKED_ID_NODE_SHIFT(u32_Index);
+
+    *pu8_Byte = (uint8_t)(
+        ((uint32_t)*pu8_Byte & ~(ITC_PACKED_ID_NODE_MASK << u32_Shift)) |
+        ((uint32_t)u8_Node << u32_Shift));
+}
+
+/**
+ * @brief Validate a packed ID
+ *
+ * Checks:
+ *  - Each node is either a leaf or a parent node
+ *  - The pre-order node sequence describes exactly one full binary tree
+ *  - The ID is normalised. I.e. there are no (0, 0) or (1, 1) subtrees
+ *
+ * @param pt_PackedId The packed ID to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validatePackedId(
+    const ITC_PackedId_t *const pt_PackedId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Index = 0;
+    /* The number of subtrees that still need to be visited */
+    uint32_t u32_Pending = 1;
+    uint8_t u8_Node;
+
+    if (!pt_PackedId || !pt_PackedId->pu8_Nodes)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (pt_PackedId->u32_Length == 0 ||
+             pt_PackedId->u32_Length > pt_PackedId->u32_Capacity)
+    {
+        t_Status = ITC_STATUS_CORRUPT_ID;
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_Pending &&
+           u32_Index < pt_PackedId->u32_Length)
+    {
+        u8_Node = ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Index);
+
+        if (u8_Node == ITC_PACKED_ID_PARENT_NODE)
+        {
+            /* The parent node is replaced by its 2 subtrees */
+            u32_Pending++;
+
+            /* (0, 0) and (1, 1) are not normalised */
+            if ((pt_PackedId->u32_Length - u32_Index) > 2U &&
+                ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Index + 1) !=
+                    ITC_PACKED_ID_PARENT_NODE &&
+                ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Index + 1) ==
+                    ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Index + 2))
+            {
+                t_Status = ITC_STATUS_CORRUPT_ID;
+            }
+        }
+        else if (u8_Node == ITC_PACKED_ID_NULL_NODE ||
+                 u8_Node == ITC_PACKED_ID_SEED_NODE)
+        {
+            u32_Pending--;
+        }
+        else
+        {
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
+
+        u32_Index++;
+    }
+
+    /* All subtrees must be complete and there must be no trailing nodes */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        (u32_Pending || u32_Index != pt_PackedId->u32_Length))
+    {
+        t_Status = ITC_STATUS_CORRUPT_ID;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Append a node to a packed ID
+ *
+ * Any (0, 0) or (1, 1) subtree completed by the new node is normalised on the
+ * spot.
+ *
+ * @param pt_PackedId The packed ID
+ * @param u8_Node The node to append
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is full
+ */
+static ITC_Status_t appendPackedIdNode(
+    ITC_PackedId_t *const pt_PackedId,
+    const uint8_t u8_Node
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Length = pt_PackedId->u32_Length;
+
+    if (u32_Length >= pt_PackedId->u32_Capacity)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        setPackedIdNode(pt_PackedId, u32_Length, u8_Node);
+        u32_Length++;
+
+        /* norm((0, 0)) = 0 and norm((1, 1)) = 1
+         * In pre-order such a subtree is always a parent node immediately
+         * followed by its 2 leaves */
+        while (u8_Node != ITC_PACKED_ID_PARENT_NODE &&
+               u32_Length >= 3U &&
+               ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Length - 3U) ==
+                   ITC_PACKED_ID_PARENT_NODE &&
+               ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Length - 2U) ==
+                   u8_Node &&
+               ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Length - 1U) ==
+                   u8_Node)
+        {
+            setPackedIdNode(pt_PackedId, u32_Length - 3U, u8_Node);
+            u32_Length -= 2U;
+        }
+
+        pt_PackedId->u32_Length = u32_Length;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Append a node to each of the two halves of a split packed ID
+ *
+ * @param pt_PackedId1 The first packed ID
+ * @param u8_Node1 The node to append to the first packed ID
+ * @param pt_PackedId2 The second packed ID
+ * @param u8_Node2 The node to append to the second packed ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if a buffer is full
+ */
+static ITC_Status_t appendSplitPackedIdNodes(
+    ITC_PackedId_t *const pt_PackedId1,
+    const uint8_t u8_Node1,
+    ITC_PackedId_t *const pt_PackedId2,
+    const uint8_t u8_Node2
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = appendPackedIdNode(pt_PackedId1, u8_Node1);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = appendPackedIdNode(pt_PackedId2, u8_Node2);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Append a copy of a packed ID subtree to another packed ID
+ *
+ * @param pt_PackedId The source packed ID
+ * @param pu32_Index (in) The index of the root node of the subtree. (out) The
+ * index of the first node after the subtree
+ * @param pt_CopyPackedId The packed ID to append the copy to
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is full
+ */
+static ITC_Status_t copyPackedIdSubtree(
+    const ITC_PackedId_t *const pt_PackedId,
+    uint32_t *const pu32_Index,
+    ITC_PackedId_t *const pt_CopyPackedId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The number of subtrees that still need to be copied */
+    uint32_t u32_Pending = 1;
+    uint8_t u8_Node;
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Pending)
+    {
+        u8_Node = ITC_PACKED_ID_GET_NODE(pt_PackedId, *pu32_Index);
+
+        t_Status = appendPackedIdNode(pt_CopyPackedId, u8_Node);
+
+        if (u8_Node == ITC_PACKED_ID_PARENT_NODE)
+        {
+            u32_Pending++;
+        }
+        else
+        {
+            u32_Pending--;
+        }
+
+        (*pu32_Index)++;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Split a packed ID into two distinct (non-overlaping) packed IDs
+ *
+ * Rules:
+ *  - split(0) = (0, 0)
+ *  - split(1) = ((1, 0), (0, 1))
+ *  - split((0, i)) = ((0, i1), (0, i2)), where (i1, i2) = split(i)
+ *  - split((i, 0)) = ((i1, 0), (i2, 0)), where (i1, i2) = split(i)
+ *  - split((i1, i2)) = ((i1, 0), (0, i2))
+ *
+ * Only a single path of the ID tree is ever split, so the packed ID can be
+ * processed in a single pass. The null right subtrees of the split path are
+ * all the same, so only their number needs to be remembered.
+ *
+ * @param pt_PackedId The packed ID to split
+ * @param pt_PackedId1 The first half of the split ID
+ * @param pt_PackedId2 The second half of the split ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t splitPackedIdI(
+    const ITC_PackedId_t *const pt_PackedId,
+    ITC_PackedId_t *const pt_PackedId1,
+    ITC_PackedId_t *const pt_PackedId2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Index = 0;
+    uint32_t u32_RightIndex;
+    /* The number of null right subtrees to append once the split is done */
+    uint32_t u32_TrailingNullIds = 0;
+    bool b_IsDone = false;
+    uint8_t u8_Node;
+
+    pt_PackedId1->u32_Length = 0;
+    pt_PackedId2->u32_Length = 0;
+
+    while (t_Status == ITC_STATUS_SUCCESS && !b_IsDone)
+    {
+        u8_Node = ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Index);
+
+        /* split(0) = (0, 0) */
+        if (u8_Node == ITC_PACKED_ID_NULL_NODE)
+        {
+            t_Status = appendSplitPackedIdNodes(
+                pt_PackedId1,
+                ITC_PACKED_ID_NULL_NODE,
+                pt_PackedId2,
+                ITC_PACKED_ID_NULL_NODE);
+
+            b_IsDone = true;
+        }
+        /* split(1) = ((1, 0), (0, 1)) */
+        else if (u8_Node == ITC_PACKED_ID_SEED_NODE)
+        {
+            t_Status = appendSplitPackedIdNodes(
+                pt_PackedId1,
+                ITC_PACKED_ID_PARENT_NODE,
+                pt_PackedId2,
+                ITC_PACKED_ID_PARENT_NODE);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = appendSplitPackedIdNodes(
+                    pt_PackedId1,
+                    ITC_PACKED_ID_SEED_NODE,
+                    pt_PackedId2,
+                    ITC_PACKED_ID_NULL_NODE);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = appendSplitPackedIdNodes(
+                    pt_PackedId1,
+                    ITC_PACKED_ID_NULL_NODE,
+                    pt_PackedId2,
+                    ITC_PACKED_ID_SEED_NODE);
+            }
+
+            b_IsDone = true;
+        }
+        else
+        {
+            /* Both halves keep the parent node */
+            t_Status = appendSplitPackedIdNodes(
+                pt_PackedId1,
+                ITC_PACKED_ID_PARENT_NODE,
+                pt_PackedId2,
+                ITC_PACKED_ID_PARENT_NODE);
+
+            u32_RightIndex = u32_Index + 1;
+            ITC_PackedId_skipSubtree(pt_PackedId, &u32_RightIndex);
+
+            if (t_Status != ITC_STATUS_SUCCESS)
+            {
+                /* Nothing else to do */
+            }
+            /* split((0, i)) = ((0, i1), (0, i2)), where (i1, i2) = split(i) */
+            else if (ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Index + 1) ==
+                     ITC_PACKED_ID_NULL_NODE)
+            {
+                t_Status = appendSplitPackedIdNodes(
+                    pt_PackedId1,
+                    ITC_PACKED_ID_NULL_NODE,
+                    pt_PackedId2,
+                    ITC_PACKED_ID_NULL_NODE);
+
+                /* Descend into the right subtree */
+                u32_Index = u32_RightIndex;
+            }
+            /* split((i, 0)) = ((i1, 0), (i2, 0)), where (i1, i2) = split(i) */
+            else if (ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_RightIndex) ==
+                     ITC_PACKED_ID_NULL_NODE)
+            {
+                u32_TrailingNullIds++;
+
+                /* Descend into the left subtree */
+                u32_Index++;
+            }
+            /* split((i1, i2)) = ((i1, 0), (0, i2)) */
+            else
+            {
+                u32_Index++;
+
+                t_Status = copyPackedIdSubtree(
+                    pt_PackedId, &u32_Index, pt_PackedId1);
+
+                if (t_Status == ITC_STATUS_SUCCESS)
+                {
+                    t_Status = appendSplitPackedIdNodes(
+                        pt_PackedId1,
+                        ITC_PACKED_ID_NULL_NODE,
+                        pt_PackedId2,
+                        ITC_PACKED_ID_NULL_NODE);
+                }
+
+                if (t_Status == ITC_STATUS_SUCCESS)
+                {
+                    t_Status = copyPackedIdSubtree(
+                        pt_PackedId, &u32_RightIndex, pt_PackedId2);
+                }
+
+                b_IsDone = true;
+            }
+        }
+    }
+
+    /* Close the (i1, 0) and (i2, 0) subtrees of the split path */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_TrailingNullIds)
+    {
+        t_Status = appendSplitPackedIdNodes(
+            pt_PackedId1,
+            ITC_PACKED_ID_NULL_NODE,
+            pt_PackedId2,
+            ITC_PACKED_ID_NULL_NODE);
+
+        u32_TrailingNullIds--;
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        pt_PackedId1->u32_Length = 0;
+        pt_PackedId2->u32_Length = 0;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Sum two packed IDs into a single packed ID
+ *
+ * Rules:
+ *  - sum(0, i) = i
+ *  - sum(i, 0) = i
+ *  - sum((l1, r1), (l2, r2)) = norm((sum(l1, l2), sum(r1, r2)))
+ *
+ * Both packed IDs are traversed in pre-order in lockstep, which visits the
+ * subtree pairs in the same order the summed ID is stored in.
+ *
+ * @param pt_PackedId1 The first packed ID
+ * @param pt_PackedId2 The second packed ID
+ * @param pt_PackedId The summed ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the IDs overlap
+ */
+static ITC_Status_t sumPackedIdI(
+    const ITC_PackedId_t *const pt_PackedId1,
+    const ITC_PackedId_t *const pt_PackedId2,
+    ITC_PackedId_t *const pt_PackedId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Index1 = 0;
+    uint32_t u32_Index2 = 0;
+    /* The number of subtree pairs that still need to be summed */
+    uint32_t u32_Pending = 1;
+    uint8_t u8_Node1;
+    uint8_t u8_Node2;
+
+    pt_PackedId->u32_Length = 0;
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Pending)
+    {
+        u8_Node1 = ITC_PACKED_ID_GET_NODE(pt_PackedId1, u32_Index1);
+        u8_Node2 = ITC_PACKED_ID_GET_NODE(pt_PackedId2, u32_Index2);
+
+        /* sum((l1, r1), (l2, r2)) = norm((sum(l1, l2), sum(r1, r2))) */
+        if (u8_Node1 == ITC_PACKED_ID_PARENT_NODE &&
+            u8_Node2 == ITC_PACKED_ID_PARENT_NODE)
+        {
+            t_Status = appendPackedIdNode(
+                pt_PackedId, ITC_PACKED_ID_PARENT_NODE);
+
+            u32_Index1++;
+            u32_Index2++;
+            u32_Pending++;
+        }
+        /* sum(0, i) = i */
+        else if (u8_Node1 == ITC_PACKED_ID_NULL_NODE)
+        {
+            t_Status = copyPackedIdSubtree(
+                pt_PackedId2, &u32_Index2, pt_PackedId);
+
+            u32_Index1++;
+            u32_Pending--;
+        }
+        /* sum(i, 0) = i */
+        else if (u8_Node2 == ITC_PACKED_ID_NULL_NODE)
+        {
+            t_Status = copyPackedIdSubtree(
+                pt_PackedId1, &u32_Index1, pt_PackedId);
+
+            u32_Index2++;
+            u32_Pending--;
+        }
+        else
+        {
+            t_Status = ITC_STATUS_OVERLAPPING_ID_INTERVAL;
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        pt_PackedId->u32_Length = 0;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Pack an existing ITC ID
+ *
+ * @param pt_Id The ID to pack
+ * @param pt_PackedId The packed ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t packIdI(
+    const ITC_Id_t *pt_Id,
+    ITC_PackedId_t *const pt_PackedId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_t *pt_CurrentIdParent = NULL;
+    uint8_t u8_Node;
+
+    pt_PackedId->u32_Length = 0;
+
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Id)
+    {
+        if (ITC_ID_IS_PARENT_ID(pt_Id))
+        {
+            u8_Node = ITC_PACKED_ID_PARENT_NODE;
+        }
+        else if (ITC_ID_IS_SEED_ID(pt_Id))
+        {
+            u8_Node = ITC_PACKED_ID_SEED_NODE;
+        }
+        else
+        {
+            u8_Node = ITC_PACKED_ID_NULL_NODE;
+        }
+
+        t_Status = appendPackedIdNode(pt_PackedId, u8_Node);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Descend into left tree */
+            if (pt_Id->pt_Left)
+            {
+                /* Remember the parent address */
+                pt_CurrentIdParent = pt_Id;
+
+                pt_Id = pt_Id->pt_Left;
+            }
+            else
+            {
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (pt_CurrentIdParent &&
+                       pt_CurrentIdParent->pt_Right == pt_Id)
+                {
+                    pt_Id = pt_Id->pt_Parent;
+                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (pt_CurrentIdParent)
+                {
+                    pt_Id = pt_CurrentIdParent->pt_Right;
+                }
+                else
+                {
+                    pt_Id = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        pt_PackedId->u32_Length = 0;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Unpack a packed ID into a newly allocated ITC ID
+ *
+ * @param pt_PackedId The packed ID
+ * @param ppt_Id (out) The pointer to the unpacked ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t unpackIdI(
+    const ITC_PackedId_t *const pt_PackedId,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t **ppt_CurrentId = ppt_Id;
+    ITC_Id_t *pt_CurrentIdParent = NULL;
+    ITC_Id_t *pt_CurrentId;
+    uint32_t u32_Index = 0;
+    uint8_t u8_Node;
+
+    *ppt_Id = NULL;
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_Index < pt_PackedId->u32_Length)
+    {
+        u8_Node = ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Index);
+
+        t_Status = newId(
+            ppt_CurrentId,
+            pt_CurrentIdParent,
+            u8_Node == ITC_PACKED_ID_SEED_NODE);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* The left subtree follows the parent node */
+            if (u8_Node == ITC_PACKED_ID_PARENT_NODE)
+            {
+                pt_CurrentIdParent = *ppt_CurrentId;
+                ppt_CurrentId = &pt_CurrentIdParent->pt_Left;
+            }
+            else
+            {
+                pt_CurrentId = *ppt_CurrentId;
+
+                /* Climb back up while the node is a right child. Right child
+                 * nodes are only allocated after their left siblings are
+                 * complete */
+                while (pt_CurrentIdParent &&
+                       pt_CurrentIdParent->pt_Right == pt_CurrentId)
+                {
+                    pt_CurrentId = pt_CurrentIdParent;
+                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+                }
+
+                /* The right subtree follows the complete left subtree */
+                if (pt_CurrentIdParent)
+                {
+                    ppt_CurrentId = &pt_CurrentIdParent->pt_Right;
+                }
+            }
+        }
+
+        u32_Index++;
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the unpacking failed, rather than the destroy */
+        (void)ITC_Id_destroy(ppt_Id);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Allocate a new ITC ID and initialise it as a seed ID (1)
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_newSeed(
+    ITC_Id_t **const ppt_Id
+)
+{
+    if (!ppt_Id)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return newId(ppt_Id, NULL, true);
+}
+
+/******************************************************************************
+ * Allocate a new ITC ID and initialise it as a null ID (0)
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_newNull(
+    ITC_Id_t **const ppt_Id
+)
+{
+    if (!ppt_Id)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return newId(ppt_Id, NULL, false);
+}
+
+/******************************************************************************
+ * Free an allocated ITC ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_destroy(
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+    ITC_Id_t *pt_CurrentId = NULL; /* The current element */
+    ITC_Id_t *pt_CurrentIdParent = NULL;
+    ITC_Id_t *pt_RootIdParent = NULL;
+
+    if (!ppt_Id)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    else if (*ppt_Id &&
+             (*ppt_Id)->b_IsInterned &&
+             releaseInternedId(*ppt_Id))
+    {
+        /* Only deallocate the ID once the last reference is released */
+    }
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+    else if (*ppt_Id)
+    {
+        pt_CurrentId = *ppt_Id;
+        /* Remember the parent as this might be a subtree */
+        pt_RootIdParent = pt_CurrentId->pt_Parent;
+
+        /* Keep trying to free elements even if some frees fail */
+        while(pt_CurrentId && pt_CurrentId != pt_RootIdParent)
+        {
+            /* Advance into left subtree */
+            if(pt_CurrentId->pt_Left)
+            {
+                pt_CurrentId = pt_CurrentId->pt_Left;
+            }
+            /* Advance into right subtree */
+            else if(pt_CurrentId->pt_Right)
+            {
+                pt_CurrentId = pt_CurrentId->pt_Right;
+            }
+            else
+            {
+                /* Remember the parent element */
+                pt_CurrentIdParent = pt_CurrentId->pt_Parent;
+
+                if(pt_CurrentIdParent)
+                {
+                    /* Remove the current element address from the parent */
+                    if(pt_CurrentIdParent->pt_Left == pt_CurrentId)
+                    {
+                        pt_CurrentIdParent->pt_Left = NULL;
+                    }
+                    else
+                    {
+                        pt_CurrentIdParent->pt_Right = NULL;
+                    }
+                }
+
+                /* Free the current element */
+                t_FreeStatus = ITC_PORT_FREE(
+                    pt_CurrentId, ITC_PORT_ALLOCTYPE_ITC_ID_T);
+
+                /* Return last error */
+                if (t_FreeStatus != ITC_STATUS_SUCCESS)
+                {
+                    t_Status = t_FreeStatus;
+                }
+
+                /* Go up the tree */
+                pt_CurrentId = pt_CurrentIdParent;
+            }
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Sanitize the freed pointer regardless of the exit status */
+        *ppt_Id = NULL;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Clone an existing ITC ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_clone(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_ClonedId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_ClonedId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_cloneValidated(pt_Id, ppt_ClonedId);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Clone an ID that has already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_cloneValidated(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_ClonedId
+)
+{
+    if (!pt_Id || !ppt_ClonedId)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return cloneId(pt_Id, ppt_ClonedId, NULL);
+}
+
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+
+/******************************************************************************
+ * Intern an ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_intern(
+    ITC_Id_t **const ppt_Id
+)
+{
+    const uint32_t u32_Mask = ITC_CONFIG_ID_INTERN_TABLE_LENGTH - 1;
+    ITC_Id_InternTableEntry_t *pt_Entry = NULL;
+    ITC_Id_t *pt_InternedId = NULL;
+    uint32_t u32_Hash;
+
+    if (!ppt_Id || !*ppt_Id)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    if ((*ppt_Id)->b_IsInterned)
+    {
+        /* Nothing to do */
+        return ITC_STATUS_SUCCESS;
+    }
+
+    u32_Hash = hashId(*ppt_Id);
+
+    lockInternTable();
+
+    for (uint32_t u32_Probes = 0;
+         !pt_Entry && u32_Probes < ITC_CONFIG_ID_INTERN_TABLE_LENGTH;
+         u32_Probes++)
+    {
+        pt_Entry = &gt_ItcIdInternTable[(u32_Hash + u32_Probes) & u32_Mask];
+
+        if (pt_Entry->pt_Id &&
+            (pt_Entry->u32_Hash != u32_Hash ||
+             !isIdEqual(pt_Entry->pt_Id, *ppt_Id)))
+        {
+            /* Keep probing */
+            pt_Entry = NULL;
+        }
+    }
+
+    if (!pt_Entry)
+    {
+        /* The table is full. Leave the ID as is */
+    }
+    else if (!pt_Entry->pt_Id)
+    {
+        /* Add the ID to the table */
+        pt_Entry->pt_Id = *ppt_Id;
+        pt_Entry->u32_Hash = u32_Hash;
+        (*ppt_Id)->b_IsInterned = true;
+        gu32_ItcInternedIdCount++;
+    }
+    else if (pt_Entry->pt_Id->u32_ShareCount < UINT32_MAX)
+    {
+        /* Take another reference to the interned ID */
+        pt_Entry->pt_Id->u32_ShareCount++;
+        pt_InternedId = pt_Entry->pt_Id;
+    }
+    else
+    {
+        /* The share count is saturated. Leave the ID as is */
+    }
+
+    unlockInternTable();
+
+    if (pt_InternedId)
+    {
+        /* Replace the ID with the interned one.
+         * Ignore return status. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the ID was
+         * interned */
+        (void)ITC_Id_destroy(ppt_Id);
+        *ppt_Id = pt_InternedId;
+    }
+
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Share an ID instead of cloning it
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_share(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_SharedId
+)
+{
+    /* The share count is the only member modified through a shared
+     * reference. Everything else is treated as immutable */
+    ITC_Id_t *pt_MutableId = (ITC_Id_t *)(uintptr_t)pt_Id;
+    bool b_Shared = false;
+
+    if (!pt_Id || !ppt_SharedId)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (pt_Id->b_IsInterned)
+    {
+        lockInternTable();
+
+        if (pt_MutableId->u32_ShareCount < UINT32_MAX)
+        {
+            pt_MutableId->u32_ShareCount++;
+            b_Shared = true;
+        }
+
+        unlockInternTable();
+    }
+
+    if (!b_Shared)
+    {
+        return cloneId(pt_Id, ppt_SharedId, NULL);
+    }
+
+    *ppt_SharedId = pt_MutableId;
+
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Get the number of distinct IDs in the intern table
+ ******************************************************************************/
+
+uint32_t ITC_Id_getInternedIdCount(void)
+{
+    uint32_t u32_Count;
+
+    lockInternTable();
+    u32_Count = gu32_ItcInternedIdCount;
+    unlockInternTable();
+
+    return u32_Count;
+}
+
+/******************************************************************************
+ * Forget all IDs in the intern table
+ ******************************************************************************/
+
+void ITC_Id_forgetInternedIds(void)
+{
+    lockInternTable();
+    /* The share counts are kept in the IDs themselves, so IDs that are still
+     * alive can still be released normally. They are just no longer found by
+     * ::ITC_Id_intern() */
+    memset(&gt_ItcIdInternTable[0], 0, sizeof(gt_ItcIdInternTable));
+    gu32_ItcInternedIdCount = 0;
+    unlockInternTable();
+}
+
+/******************************************************************************
+ * Update the intern table after an interned ID root has been moved
+ ******************************************************************************/
+
+void ITC_Id_relocateInternedId(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t *const pt_NewId
+)
+{
+    const uint32_t u32_Mask = ITC_CONFIG_ID_INTERN_TABLE_LENGTH - 1;
+    uint32_t u32_Slot;
+    uint32_t u32_Probes = 0;
+
+    lockInternTable();
+
+    /* The moved ID has the same structure, so its entry is found by probing
+     * from the same home slot */
+    u32_Slot = hashId(pt_NewId) & u32_Mask;
+
+    while (u32_Probes < ITC_CONFIG_ID_INTERN_TABLE_LENGTH &&
+           gt_ItcIdInternTable[u32_Slot].pt_Id != pt_Id)
+    {
+        u32_Slot = (u32_Slot + 1) & u32_Mask;
+        u32_Probes++;
+    }
+
+    if (u32_Probes < ITC_CONFIG_ID_INTERN_TABLE_LENGTH)
+    {
+        gt_ItcIdInternTable[u32_Slot].pt_Id = pt_NewId;
+    }
+
+    unlockInternTable();
+}
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+
+/******************************************************************************
+ * Validate an ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_validate(
+    const ITC_Id_t *const pt_Id
+)
+{
+    return validateId(pt_Id, true);
+}
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
+/******************************************************************************
+ * Split an existing ITC ID into two distinct (non-overlaping) ITC IDs
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_split(
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t **const ppt_OtherId
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!ppt_Id || !ppt_OtherId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = validateId(*ppt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_splitValidated(ppt_Id, ppt_OtherId);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Sum two existing IDs into a single ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_sum(
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t **const ppt_OtherId
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!ppt_Id || !ppt_OtherId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = validateId(*ppt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(*ppt_OtherId, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_validateSum(*ppt_Id, *ppt_OtherId);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_sumValidated(ppt_Id, ppt_OtherId);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+/******************************************************************************
+ * Split an ID similar to ::ITC_Id_split() but do not modify the source ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_splitConst(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_Id1,
+    ITC_Id_t **const ppt_Id2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Id1 || !ppt_Id2)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_splitConstValidated(pt_Id, ppt_Id1, ppt_Id2);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Split an ID that has already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_splitConstValidated(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_Id1,
+    ITC_Id_t **const ppt_Id2
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pt_Id || !ppt_Id1 || !ppt_Id2)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_ID_SPLIT);
+
+    t_Status = splitIdI(pt_Id, ppt_Id1, ppt_Id2);
+
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_ID_SPLIT,
+        (t_Status == ITC_STATUS_SUCCESS) ?
+            countIdNodes(*ppt_Id1) + countIdNodes(*ppt_Id2) :
+            0);
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Sum two IDs similar to ::ITC_Id_sum() but do not modify the source IDs
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_sumConst(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Id)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_sumConstValidated(pt_Id1, pt_Id2, ppt_Id);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Sum two IDs that have already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_sumConstValidated(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pt_Id1 || !pt_Id2 || !ppt_Id)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_ID_SUM);
+
+    t_Status = sumIdI(pt_Id1, pt_Id2, ppt_Id);
+
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_ID_SUM,
+        (t_Status == ITC_STATUS_SUCCESS) ? countIdNodes(*ppt_Id) : 0);
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Split an ID in place that has already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_splitValidated(
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t **const ppt_OtherId
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    ITC_Id_t *pt_NewId = NULL;
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_ID_SPLIT);
+
+    if (!ppt_Id || !*ppt_Id || !ppt_OtherId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    /* Interned IDs might be shared. Split a copy instead */
+    else if ((*ppt_Id)->b_IsInterned)
+    {
+        t_Status = splitIdI(*ppt_Id, &pt_NewId, ppt_OtherId);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Release the old ID.
+             * Ignore return statuses. There is nothing else to do if the
+             * destroy fails. Also it is more important to convey that the
+             * overall split operation was successful */
+            (void)ITC_Id_destroy(ppt_Id);
+
+            /* Return the first half of the split ID */
+            *ppt_Id = pt_NewId;
+        }
+    }
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+    else
+    {
+        t_Status = splitIdInPlaceI(*ppt_Id, ppt_OtherId);
+    }
+
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_ID_SPLIT,
+        (t_Status == ITC_STATUS_SUCCESS) ?
+            countIdNodes(*ppt_Id) + countIdNodes(*ppt_OtherId) :
+            0);
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check whether two validated IDs can be summed
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_validateSum(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2
+)
+{
+    if (!pt_Id1 || !pt_Id2)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return validateIdSumI(pt_Id1, pt_Id2);
+}
+
+/******************************************************************************
+ * Sum two IDs in place that have already been validated
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_sumValidated(
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t **const ppt_OtherId
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Id_t *pt_SummedId = NULL;
+
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_ID_SUM);
+
+    if (!ppt_Id || !*ppt_Id || !ppt_OtherId || !*ppt_OtherId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    /* Interned IDs might be shared, and the nodes of an ID cannot be moved
+     * into itself. Sum a copy instead */
+    else if (
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+        (*ppt_Id)->b_IsInterned ||
+        (*ppt_OtherId)->b_IsInterned ||
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+        *ppt_Id == *ppt_OtherId)
+    {
+        t_Status = sumIdI(*ppt_Id, *ppt_OtherId, &pt_SummedId);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Release the old IDs.
+             * Ignore return statuses. There is nothing else to do if the
+             * destroy fails. Also it is more important to convey that the
+             * overall sum operation was successful */
+            (void)ITC_Id_destroy(ppt_Id);
+            (void)ITC_Id_destroy(ppt_OtherId);
+
+            /* Return the summed ID */
+            *ppt_Id = pt_SummedId;
+        }
+    }
+    else
+    {
+        t_Status = sumIdInPlaceI(ppt_Id, *ppt_OtherId);
+
+        /* The other ID is always consumed */
+        *ppt_OtherId = NULL;
+    }
+
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_ID_SUM,
+        (t_Status == ITC_STATUS_SUCCESS) ? countIdNodes(*ppt_Id) : 0);
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Serialise an existing ITC Id
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_serialiseId(
+    const ITC_Id_t *const pt_Id,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize,
+    const bool b_AddVersion
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        &pu8_Buffer[0],
+        pu32_BufferSize,
+        (b_AddVersion) ? ITC_SERDES_ID_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
+                       : ITC_SERDES_ID_MIN_BUFFER_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseId(
+            pt_Id, &pu8_Buffer[0], pu32_BufferSize, b_AddVersion);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the size of an existing ITC Id once serialised
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_getSerialisedIdSize(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_Size,
+    const bool b_AddVersion
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pu32_Size)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        getSerialisedIdSize(pt_Id, b_AddVersion, pu32_Size);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Deserialise an ITC Id
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_deserialiseId(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+
+    if (!ppt_Id)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            &pu8_Buffer[0],
+            &u32_BufferSize,
+            (b_HasVersion) ? ITC_SERDES_ID_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
+                           : ITC_SERDES_ID_MIN_BUFFER_LEN,
+            false);
+    }
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    /* The version field selects the format */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        b_HasVersion &&
+        (pu8_Buffer[0] & ITC_SERDES_COMPACT_FORMAT_FLAG))
+    {
+        t_Status = deserialiseVersionedIdCompact(
+            &pu8_Buffer[0], u32_BufferSize, ppt_Id);
+    }
+    else
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseId(
+            &pu8_Buffer[0], u32_BufferSize, b_HasVersion, ppt_Id);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Validate a serialised ITC Id
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_validateSerialisedId(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        &pu8_Buffer[0],
+        &u32_BufferSize,
+        (b_HasVersion) ? ITC_SERDES_ID_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
+                       : ITC_SERDES_ID_MIN_BUFFER_LEN,
+        false);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateSerialisedId(
+            &pu8_Buffer[0], u32_BufferSize, b_HasVersion);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/******************************************************************************
+ * Serialise a serialised ITC Id to string
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_serialisedIdToString(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    char *const pc_Buffer,
+    uint32_t *const pu32_StringSize
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        (uint8_t *)&pc_Buffer[0],
+        pu32_StringSize,
+        ITC_SER_TO_STR_ID_MIN_BUFFER_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialisedIdToString(
+            pu8_Buffer, u32_BufferSize, &pc_Buffer[0], pu32_StringSize);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Serialise an existing ITC Id to string through a string sink
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_writeIdString(
+    const ITC_Id_t *const pt_Id,
+    ITC_SerDes_Util_StringSink_t *const pt_Sink
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateId(pt_Id, true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = writeIdString(pt_Id, pt_Sink);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/******************************************************************************
+ * Serialise an existing ITC Id in the compact format
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_serialiseIdCompact(
+    const ITC_Id_t *const pt_Id,
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Writer)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseIdCompact(pt_Id, pt_Writer, NULL);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Deserialise an ITC Id in the compact format
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_deserialiseIdCompact(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Reader || !pt_Reader->pu8_Buffer || !ppt_Id)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseIdCompact(pt_Reader, ppt_Id);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the size of an existing ITC Id once serialised in the compact format
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_getSerialisedIdCompactBitCount(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_BitCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pu32_BitCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Ensure the string is always NULL-termiated */
-        pc_Buffer[u32_Offset] = '\0';
-        u32_Offset++;
+        t_Status = validateId(pt_Id, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        t_Status = serialiseIdCompact(pt_Id, NULL, pu32_BitCount);
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 
-/**
- * @brief Deserialise an ITC Id
- *
- * For the expected data format see ::serialiseId()
- *
- * @param pu8_Buffer The buffer holding the serialised Id data
- * @param u32_BufferSize The size of the buffer in bytes
- * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
- * serialised input
- * @param ppt_Id The pointer to the deserialised Id
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- */
-static ITC_Status_t deserialiseId(
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+
+/******************************************************************************
+ * Feed the next part of a serialised ITC Id to an ID decoder
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_feedIdDecoder(
+    ITC_SerDes_IdDecoder_t *const pt_Decoder,
     const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    const bool b_HasVersion,
-    ITC_Id_t **const ppt_Id
+    const uint32_t u32_BufferSize
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t **ppt_CurrentId = NULL; /* The current ID */
-    ITC_Id_t *pt_CurrentIdParent = NULL;
+    ITC_Id_t **ppt_CurrentId; /* The next unallocated node */
     uint32_t u32_Offset = 0; /* The current offset */
 
-    *ppt_Id = NULL;
-    ppt_CurrentId = ppt_Id;
-
-    /* If input contains a version check it matches the current lib version
-     * (provided by build system c args) */
-    if (b_HasVersion)
-    {
-        t_Status = ITC_SerDes_Util_validateDesLibVersion(
-            pu8_Buffer[u32_Offset]);
-
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
-    }
-
-    /* The last serialised node cannot be a parent */
-    if (t_Status == ITC_STATUS_SUCCESS &&
-        pu8_Buffer[u32_BufferSize - 1] == ITC_SERDES_PARENT_ID_HEADER)
+    if (!pt_Decoder || !pu8_Buffer)
     {
-        t_Status = ITC_STATUS_CORRUPT_ID;
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Offset < u32_BufferSize)
     {
-        /* Deserialise a parent ID node */
-        if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+        /* Find the next unallocated node. The data is serialised in
+         * pre-order, so it is the left child of the parent if it hasn't been
+         * allocated yet, otherwise the right child */
+        if (!pt_Decoder->pt_Parent)
         {
-            t_Status = newId(ppt_CurrentId, pt_CurrentIdParent, false);
+            ppt_CurrentId = &pt_Decoder->pt_Root;
         }
-        /* Deserialise a leaf ID node */
-        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER ||
-                 pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER)
+        else if (!pt_Decoder->pt_Parent->pt_Left)
         {
-            t_Status = newId(
-                ppt_CurrentId,
-                pt_CurrentIdParent,
-                (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER) ? false
-                                                                      : true);
+            ppt_CurrentId = &pt_Decoder->pt_Parent->pt_Left;
         }
-        /* Unknown node header value */
         else
         {
-            t_Status = ITC_STATUS_CORRUPT_ID;
+            ppt_CurrentId = &pt_Decoder->pt_Parent->pt_Right;
         }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
+        /* The tree is already complete */
+        if (*ppt_CurrentId)
         {
-            /* Get ready for the next header:
-             *
-             * - If the current header was a parent - descend into left child
-             * - If the current header was a leaf - find the first unallocated
-             *   right child node
-             */
-            if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
+        /* Deserialise a parent ID node */
+        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+        {
+            t_Status = newId(ppt_CurrentId, pt_Decoder->pt_Parent, false);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
             {
-                pt_CurrentIdParent = *ppt_CurrentId;
-                ppt_CurrentId = &(*ppt_CurrentId)->pt_Left;
+                /* Descend into the left child */
+                pt_Decoder->pt_Parent = *ppt_CurrentId;
             }
-            else
+        }
+        /* Deserialise a leaf ID node */
+        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER ||
+                 pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER)
+        {
+            t_Status = newId(
+                ppt_CurrentId,
+                pt_Decoder->pt_Parent,
+                (pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER));
+
+            if (t_Status == ITC_STATUS_SUCCESS)
             {
                 /* Backtrack the tree until an unallocated right child is found
                  * or there are no more parent nodes */
-                while (pt_CurrentIdParent && pt_CurrentIdParent->pt_Right)
+                while (pt_Decoder->pt_Parent &&
+                       pt_Decoder->pt_Parent->pt_Right)
                 {
-                    ppt_CurrentId = &pt_CurrentIdParent;
-                    pt_CurrentIdParent = (*ppt_CurrentId)->pt_Parent;
+                    pt_Decoder->pt_Parent = pt_Decoder->pt_Parent->pt_Parent;
                 }
 
-                /* Descend into the unallocated right child of the parent */
-                if (pt_CurrentIdParent)
-                {
-                    ppt_CurrentId = &pt_CurrentIdParent->pt_Right;
-                }
-                /* There aren't any unallocated right child nodes in the tree.
-                 *
-                 * Usually this would signal the end of the loop as the only
-                 * time this should happen is when the full input buffer has
-                 * been deserialised (i.e.`u32_NextOffset == u32_BufferSize`),
-                 * since the tree is serialised in a pre-order traversal fasion.
-                 *
-                 * However, if the input buffer is malformed in some way it is
-                 * possible that there are elements in it that havent't been
-                 * deserialised yet (i.e. `u32_NextOffset < u32_BufferSize`).
-                 *
-                 * This should be treated as error as otherwise the user might
-                 * not get the expected (or full) ID tree. */
-                else if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) <
-                         u32_BufferSize)
+                /* The tree is complete. Check the deserialised ID is valid */
+                if (!pt_Decoder->pt_Parent)
                 {
-                    t_Status = ITC_STATUS_CORRUPT_ID;
-                }
-                else
-                {
-                    /* Nothing to do */
+                    t_Status = validateId(pt_Decoder->pt_Root, true);
                 }
             }
-
-            /* Get the next header */
-            u32_Offset += sizeof(ITC_SerDes_Header_t);
         }
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        /* Check the deserialised ID is valid */
-        t_Status = validateId(*ppt_Id, true);
-    }
+        /* Unknown node header value */
+        else
+        {
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
 
-    if (t_Status != ITC_STATUS_SUCCESS)
-    {
-        /* There is nothing else to do if the destroy fails. Also it is more
-         * important to convey the deserialisation failed, rather than the
-         * destroy */
-        (void)ITC_Id_destroy(ppt_Id);
+        /* Get the next header */
+        u32_Offset += sizeof(ITC_SerDes_Header_t);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Public functions
- ******************************************************************************/
-
-/******************************************************************************
- * Allocate a new ITC ID and initialise it as a seed ID (1)
+ * Check an ID decoder has deserialised a whole ITC Id
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_newSeed(
-    ITC_Id_t **const ppt_Id
+ITC_Status_t ITC_SerDes_Util_finishIdDecoder(
+    const ITC_SerDes_IdDecoder_t *const pt_Decoder
 )
 {
-    if (!ppt_Id)
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Decoder)
     {
-        return ITC_STATUS_INVALID_PARAM;
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    /* Nodes are still missing */
+    else if (!pt_Decoder->pt_Root || pt_Decoder->pt_Parent)
+    {
+        t_Status = ITC_STATUS_CORRUPT_ID;
+    }
+    else
+    {
+        /* Nothing to do */
     }
 
-    return newId(ppt_Id, NULL, true);
+    return t_Status;
 }
 
 /******************************************************************************
- * Allocate a new ITC ID and initialise it as a null ID (0)
+ * Reset an ID decoder
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_newNull(
-    ITC_Id_t **const ppt_Id
+void ITC_SerDes_Util_resetIdDecoder(
+    ITC_SerDes_IdDecoder_t *const pt_Decoder
 )
 {
-    if (!ppt_Id)
+    if (pt_Decoder)
     {
-        return ITC_STATUS_INVALID_PARAM;
-    }
+        if (pt_Decoder->pt_Root)
+        {
+            /* There is nothing else to do if the destroy fails */
+            (void)ITC_Id_destroy(&pt_Decoder->pt_Root);
+        }
 
-    return newId(ppt_Id, NULL, false);
+        pt_Decoder->pt_Root = NULL;
+        pt_Decoder->pt_Parent = NULL;
+    }
 }
 
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
 /******************************************************************************
- * Free an allocated ITC ID
+ * Serialise an existing ITC Id to string
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_destroy(
-    ITC_Id_t **const ppt_Id
+ITC_Status_t ITC_SerDes_serialiseIdToString(
+    const ITC_Id_t *const pt_Id,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
-    ITC_Id_t *pt_CurrentId = NULL; /* The current element */
-    ITC_Id_t *pt_CurrentIdParent = NULL;
-    ITC_Id_t *pt_RootIdParent = NULL;
+    ITC_Status_t t_Status; /* The current status */
 
-    if (!ppt_Id)
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        (uint8_t *)&pc_Buffer[0],
+        pu32_BufferSize,
+        ITC_SER_TO_STR_ID_MIN_BUFFER_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_STATUS_INVALID_PARAM;
+        t_Status = validateId(pt_Id, true);
     }
-    else if (*ppt_Id)
-    {
-        pt_CurrentId = *ppt_Id;
-        /* Remember the parent as this might be a subtree */
-        pt_RootIdParent = pt_CurrentId->pt_Parent;
 
-        /* Keep trying to free elements even if some frees fail */
-        while(pt_CurrentId && pt_CurrentId != pt_RootIdParent)
-        {
-            /* Advance into left subtree */
-            if(pt_CurrentId->pt_Left)
-            {
-                pt_CurrentId = pt_CurrentId->pt_Left;
-            }
-            /* Advance into right subtree */
-            else if(pt_CurrentId->pt_Right)
-            {
-                pt_CurrentId = pt_CurrentId->pt_Right;
-            }
-            else
-            {
-                /* Remember the parent element */
-                pt_CurrentIdParent = pt_CurrentId->pt_Parent;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseIdToString(pt_Id, &pc_Buffer[0], pu32_BufferSize);
+    }
 
-                if(pt_CurrentIdParent)
-                {
-                    /* Remove the current element address from the parent */
-                    if(pt_CurrentIdParent->pt_Left == pt_CurrentId)
-                    {
-                        pt_CurrentIdParent->pt_Left = NULL;
-                    }
-                    else
-                    {
-                        pt_CurrentIdParent->pt_Right = NULL;
-                    }
-                }
+    return t_Status;
+}
 
-                /* Free the current element */
-                t_FreeStatus = ITC_Port_free(
-                    pt_CurrentId, ITC_PORT_ALLOCTYPE_ITC_ID_T);
+/******************************************************************************
+ * Get the length of an existing ITC Id once serialised to string
+ ******************************************************************************/
 
-                /* Return last error */
-                if (t_FreeStatus != ITC_STATUS_SUCCESS)
-                {
-                    t_Status = t_FreeStatus;
-                }
+ITC_Status_t ITC_SerDes_getIdStringLength(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_Length
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-                /* Go up the tree */
-                pt_CurrentId = pt_CurrentIdParent;
-            }
-        }
+    if (!pu32_Length)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
-    else
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Nothing to do */
+        t_Status = validateId(pt_Id, true);
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Sanitize the freed pointer regardless of the exit status */
-        *ppt_Id = NULL;
+        getIdStringLength(pt_Id, pu32_Length);
     }
 
     return t_Status;
 }
 
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
 /******************************************************************************
- * Clone an existing ITC ID
+ * Serialise an existing ITC Id to string through a writer
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_clone(
+ITC_Status_t ITC_SerDes_writeIdString(
     const ITC_Id_t *const pt_Id,
-    ITC_Id_t **const ppt_ClonedId
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_SerDes_Util_StringSink_t t_Sink;
 
-    if (!ppt_ClonedId)
+    if (!pfn_Writer)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(pt_Id, true);
+        ITC_SerDes_Util_initStringSink(&t_Sink, pfn_Writer, pv_Context);
+
+        t_Status = ITC_SerDes_Util_writeIdString(pt_Id, &t_Sink);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = cloneId(pt_Id, ppt_ClonedId, NULL);
+        t_Status = ITC_SerDes_Util_flushStringSink(&t_Sink);
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
 /******************************************************************************
- * Validate an ID
+ * Serialise an existing ITC Id
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_validate(
-    const ITC_Id_t *const pt_Id
+ITC_Status_t ITC_SerDes_serialiseId(
+    const ITC_Id_t *const pt_Id,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
 )
 {
-    return validateId(pt_Id, true);
+    return ITC_SerDes_Util_serialiseId(
+        pt_Id,
+        pu8_Buffer,
+        pu32_BufferSize,
+        true);
 }
 
-#if ITC_CONFIG_ENABLE_EXTENDED_API
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
 
 /******************************************************************************
- * Split an existing ITC ID into two distinct (non-overlaping) ITC IDs
+ * Serialise an existing ITC Id in the compact format
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_split(
-    ITC_Id_t **const ppt_Id,
-    ITC_Id_t **const ppt_OtherId
+ITC_Status_t ITC_SerDes_serialiseIdCompact(
+    const ITC_Id_t *const pt_Id,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
 )
 {
     ITC_Status_t t_Status; /* The current status */
-    ITC_Id_t *pt_NewId = NULL;
+    ITC_SerDes_Util_BitWriter_t t_Writer = { 0 };
 
-    if (!ppt_Id || !ppt_OtherId)
-    {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
-    else
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        pu8_Buffer,
+        pu32_BufferSize,
+        ITC_SERDES_COMPACT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_Id_splitConst(*ppt_Id, &pt_NewId, ppt_OtherId);
+        t_Writer.pu8_Buffer = &pu8_Buffer[ITC_VERSION_MAJOR_LEN];
+        t_Writer.u32_BufferSize =
+            *pu32_BufferSize - (uint32_t)ITC_VERSION_MAJOR_LEN;
+
+        t_Status = ITC_SerDes_Util_serialiseIdCompact(pt_Id, &t_Writer);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* XXX: Save the parent pointer in case the original ID was a subtree.
-         * This makes no sense from a functional point of view, especially
-         * since `validateId` should fail if a subtree is passed in. However,
-         * if that somehow fails and a subtree is split, the new Id will lose
-         * the reference to the original Id subtree's parent nodes, which
-         * would lead to a memory leak. */
-        pt_NewId->pt_Parent = (*ppt_Id)->pt_Parent;
-
-        /* Destroy the old ID.
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall sum
-         * operation was successful */
-        (void)ITC_Id_destroy(ppt_Id);
+        /* Prepend the lib version (provided by build system c args) and mark
+         * the data as compact */
+        pu8_Buffer[0] = ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG;
 
-        /* Return the first half of the split ID */
-        *ppt_Id = pt_NewId;
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = (uint32_t)ITC_VERSION_MAJOR_LEN +
+                           ((t_Writer.u32_BitOffset + 7U) / 8U);
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
 /******************************************************************************
- * Sum two existing IDs into a single ID
+ * Get the size of an existing ITC Id once serialised
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_sum(
-    ITC_Id_t **const ppt_Id,
-    ITC_Id_t **const ppt_OtherId
+ITC_Status_t ITC_SerDes_getSerialisedIdSize(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_Size
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t *pt_SummedId = NULL;
+    return ITC_SerDes_Util_getSerialisedIdSize(pt_Id, pu32_Size, true);
+}
 
-    if (!ppt_Id || !ppt_OtherId)
-    {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
-    else
-    {
-        t_Status = ITC_Id_sumConst(*ppt_Id, *ppt_OtherId, &pt_SummedId);
-    }
+/******************************************************************************
+ * Deserialise an ITC Id
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_deserialiseId(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Id_t **const ppt_Id
+)
+{
+    return ITC_SerDes_Util_deserialiseId(
+        pu8_Buffer,
+        u32_BufferSize,
+        true,
+        ppt_Id);
+}
+
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+#if IS_UNIT_TEST_BUILD
+
+/******************************************************************************
+ * Normalise an ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_normalise(
+    ITC_Id_t *const pt_Id
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateId(pt_Id, false);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* XXX: Save the parent pointer in case the original ID was a subtree.
-         * This makes no sense from a functional point of view, especially
-         * since `validateId` should fail if a subtree is passed in. However,
-         * if that somehow fails and a subtree is summed, the new Id will lose
-         * the reference to the original Id subtree's parent nodes, which
-         * would lead to a memory leak. */
-        pt_SummedId->pt_Parent = (*ppt_Id)->pt_Parent;
-
-        /* Destroy the old IDs.
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall sum
-         * operation was successful */
-        (void)ITC_Id_destroy(ppt_Id);
-        (void)ITC_Id_destroy(ppt_OtherId);
-
-        /* Return the summed ID */
-        *ppt_Id = pt_SummedId;
+        t_Status = normIdI(pt_Id);
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+#endif /* IS_UNIT_TEST_BUILD */
+
+#if ITC_CONFIG_ENABLE_PACKED_API
 
 /******************************************************************************
- * Split an ID similar to ::ITC_Id_split() but do not modify the source ID
+ * Pack an existing ITC ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_splitConst(
+ITC_Status_t ITC_PackedId_fromId(
     const ITC_Id_t *const pt_Id,
-    ITC_Id_t **const ppt_Id1,
-    ITC_Id_t **const ppt_Id2
+    ITC_PackedId_t *const pt_PackedId
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_Id1 || !ppt_Id2)
+    if (!pt_PackedId || !pt_PackedId->pu8_Nodes)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
@@ -1501,19 +4694,18 @@ ITC_Status_t ITC_Id_splitConst(
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = splitIdI(pt_Id, ppt_Id1, ppt_Id2);
+        t_Status = packIdI(pt_Id, pt_PackedId);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Sum two IDs similar to ::ITC_Id_sum() but do not modify the source IDs
+ * Unpack a packed ID into a newly allocated ITC ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_sumConst(
-    const ITC_Id_t *const pt_Id1,
-    const ITC_Id_t *const pt_Id2,
+ITC_Status_t ITC_PackedId_toId(
+    const ITC_PackedId_t *const pt_PackedId,
     ITC_Id_t **const ppt_Id
 )
 {
@@ -1526,186 +4718,135 @@ ITC_Status_t ITC_Id_sumConst(
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(pt_Id1, true);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateId(pt_Id2, true);
+        t_Status = validatePackedId(pt_PackedId);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = sumIdI(pt_Id1, pt_Id2, ppt_Id);
+        t_Status = unpackIdI(pt_PackedId, ppt_Id);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Serialise an existing ITC Id
+ * Validate a packed ID
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_Util_serialiseId(
-    const ITC_Id_t *const pt_Id,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize,
-    const bool b_AddVersion
+ITC_Status_t ITC_PackedId_validate(
+    const ITC_PackedId_t *const pt_PackedId
 )
 {
-    ITC_Status_t t_Status; /* The current status */
-
-    t_Status = ITC_SerDes_Util_validateBuffer(
-        &pu8_Buffer[0],
-        pu32_BufferSize,
-        (b_AddVersion) ? ITC_SERDES_ID_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
-                       : ITC_SERDES_ID_MIN_BUFFER_LEN,
-        true);
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateId(pt_Id, true);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = serialiseId(
-            pt_Id, &pu8_Buffer[0], pu32_BufferSize, b_AddVersion);
-    }
-
-    return t_Status;
+    return validatePackedId(pt_PackedId);
 }
 
 /******************************************************************************
- * Deserialise an ITC Id
+ * Split a packed ID into two distinct (non-overlaping) packed IDs
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_Util_deserialiseId(
-    const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    const bool b_HasVersion,
-    ITC_Id_t **const ppt_Id
+ITC_Status_t ITC_PackedId_split(
+    const ITC_PackedId_t *const pt_PackedId,
+    ITC_PackedId_t *const pt_PackedId1,
+    ITC_PackedId_t *const pt_PackedId2
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_Id)
+    if (!pt_PackedId1 || !pt_PackedId1->pu8_Nodes ||
+        !pt_PackedId2 || !pt_PackedId2->pu8_Nodes)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_SerDes_Util_validateBuffer(
-            &pu8_Buffer[0],
-            &u32_BufferSize,
-            (b_HasVersion) ? ITC_SERDES_ID_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN
-                           : ITC_SERDES_ID_MIN_BUFFER_LEN,
-            false);
+        t_Status = validatePackedId(pt_PackedId);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = deserialiseId(
-            &pu8_Buffer[0], u32_BufferSize, b_HasVersion, ppt_Id);
+        t_Status = splitPackedIdI(pt_PackedId, pt_PackedId1, pt_PackedId2);
     }
 
     return t_Status;
 }
 
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-
 /******************************************************************************
- * Serialise an existing ITC Id to string
+ * Sum two packed IDs into a single packed ID
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_serialiseIdToString(
-    const ITC_Id_t *const pt_Id,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+ITC_Status_t ITC_PackedId_sum(
+    const ITC_PackedId_t *const pt_PackedId1,
+    const ITC_PackedId_t *const pt_PackedId2,
+    ITC_PackedId_t *const pt_PackedId
 )
 {
-    ITC_Status_t t_Status; /* The current status */
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    t_Status = ITC_SerDes_Util_validateBuffer(
-        (uint8_t *)&pc_Buffer[0],
-        pu32_BufferSize,
-        ITC_SER_TO_STR_ID_MIN_BUFFER_LEN,
-        true);
+    if (!pt_PackedId || !pt_PackedId->pu8_Nodes)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(pt_Id, true);
+        t_Status = validatePackedId(pt_PackedId1);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = serialiseIdToString(pt_Id, &pc_Buffer[0], pu32_BufferSize);
+        t_Status = validatePackedId(pt_PackedId2);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = sumPackedIdI(pt_PackedId1, pt_PackedId2, pt_PackedId);
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
-
-#if ITC_CONFIG_ENABLE_EXTENDED_API
-
 /******************************************************************************
- * Serialise an existing ITC Id
+ * Find the end of a packed ID subtree
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_serialiseId(
-    const ITC_Id_t *const pt_Id,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize
+void ITC_PackedId_skipSubtree(
+    const ITC_PackedId_t *const pt_PackedId,
+    uint32_t *const pu32_Index
 )
 {
-    return ITC_SerDes_Util_serialiseId(
-        pt_Id,
-        pu8_Buffer,
-        pu32_BufferSize,
-        true);
-}
+    /* The number of subtrees that still need to be skipped */
+    uint32_t u32_Pending = 1;
 
-/******************************************************************************
- * Deserialise an ITC Id
- ******************************************************************************/
+    while (u32_Pending)
+    {
+        if (ITC_PACKED_ID_GET_NODE(pt_PackedId, *pu32_Index) ==
+            ITC_PACKED_ID_PARENT_NODE)
+        {
+            u32_Pending++;
+        }
+        else
+        {
+            u32_Pending--;
+        }
 
-ITC_Status_t ITC_SerDes_deserialiseId(
-    const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    ITC_Id_t **const ppt_Id
-)
-{
-    return ITC_SerDes_Util_deserialiseId(
-        pu8_Buffer,
-        u32_BufferSize,
-        true,
-        ppt_Id);
+        (*pu32_Index)++;
+    }
 }
 
-#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
 
-#if IS_UNIT_TEST_BUILD
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
 
 /******************************************************************************
- * Normalise an ID
+ * Count the nodes of an ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_normalise(
-    ITC_Id_t *const pt_Id
+uint32_t ITC_Id_countNodes(
+    const ITC_Id_t *const pt_Id
 )
 {
-    ITC_Status_t t_Status; /* The current status */
-
-    t_Status = validateId(pt_Id, false);
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = normIdI(pt_Id);
-    }
-
-    return t_Status;
+    return (pt_Id) ? countIdNodes(pt_Id) : 0;
 }
 
-#endif /* IS_UNIT_TEST_BUILD */
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
@@ -12,6 +12,9 @@
 
 #include "ITC_Id.h"
 #include "ITC_Status.h"
+#include "ITC_Config.h"
+
+#include <stdint.h>
 
 
 /******************************************************************************
@@ -80,4 +83,23 @@
       ITC_ID_IS_LEAF_ID((pt_Id)->pt_Right) &&                                  \
       (pt_Id)->pt_Left->b_IsOwner == (pt_Id)->pt_Right->b_IsOwner))))
 
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/**
+ * An entry of the ID intern table
+ */
+typedef struct
+{
+    /** The interned ID. `NULL` if the entry is empty */
+    ITC_Id_t *pt_Id;
+    /** The hash of the interned ID */
+    uint32_t u32_Hash;
+} ITC_Id_InternTableEntry_t;
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+
 #endif /* ITC_ID_PRIVATE_H_ */
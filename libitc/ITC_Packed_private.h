@@ -0,0 +1,113 @@
+/**
+ * @file ITC_Packed_private.h
+ * @brief Private definitions for the Interval Tree Clock's packed ID, Event
+ * and Stamp representations
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_PACKED_PRIVATE_H_
+#define ITC_PACKED_PRIVATE_H_
+
+#include "ITC_Packed.h"
+#include "ITC_Config.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/** The value of a packed null ID (0) leaf node */
+#define ITC_PACKED_ID_NULL_NODE                                          (0x00U)
+/** The value of a packed seed ID (1) leaf node */
+#define ITC_PACKED_ID_SEED_NODE                                          (0x01U)
+/** The value of a packed parent ID node */
+#define ITC_PACKED_ID_PARENT_NODE                                        (0x02U)
+
+/** The number of bits in each packed ID node */
+#define ITC_PACKED_ID_NODE_BITS                                             (2U)
+/** The mask of a single packed ID node */
+#define ITC_PACKED_ID_NODE_MASK                                          (0x03U)
+
+/** Get the bit offset of a packed ID node inside its byte */
+#define ITC_PACKED_ID_NODE_SHIFT(u32_Index)                                    \
+    (((u32_Index) % ITC_PACKED_ID_NODES_PER_BYTE) * ITC_PACKED_ID_NODE_BITS)
+
+/** Get the value of the packed ID node at the given index */
+#define ITC_PACKED_ID_GET_NODE(pt_PackedId, u32_Index)                         \
+    ((uint8_t)(((uint32_t)(pt_PackedId)->pu8_Nodes[                            \
+        (u32_Index) / ITC_PACKED_ID_NODES_PER_BYTE] >>                         \
+            ITC_PACKED_ID_NODE_SHIFT(u32_Index)) & ITC_PACKED_ID_NODE_MASK))
+
+/* Select the same shape packed Event kernels */
+#if (ITC_CONFIG_PACKED_EVENT_SIMD == ITC_PACKED_EVENT_SIMD_RUNTIME_DISPATCH) && \
+    (defined(__x86_64__) || defined(__i386__)) && !defined(__AVX2__) && \
+    ((defined(__GNUC__) && __GNUC__ >= 5) || defined(__clang__))
+/** Whether the AVX2 kernels are selected at runtime */
+#define ITC_PACKED_EVENT_USE_RUNTIME_DISPATCH                                (1)
+#else
+/** Whether the AVX2 kernels are selected at runtime */
+#define ITC_PACKED_EVENT_USE_RUNTIME_DISPATCH                                (0)
+#endif /* (ITC_CONFIG_PACKED_EVENT_SIMD == ITC_PACKED_EVENT_SIMD_RUNTIME_DISPATCH) && (defined(__x86_64__) || defined(__i386__)) && !defined(__AVX2__) && ((defined(__GNUC__) && __GNUC__ >= 5) || defined(__clang__)) */
+
+#if (ITC_CONFIG_PACKED_EVENT_SIMD != ITC_PACKED_EVENT_SIMD_NONE) && \
+    (defined(__AVX2__) || ITC_PACKED_EVENT_USE_RUNTIME_DISPATCH)
+/** Whether the AVX2 kernels are available */
+#define ITC_PACKED_EVENT_USE_AVX2                                            (1)
+#else
+/** Whether the AVX2 kernels are available */
+#define ITC_PACKED_EVENT_USE_AVX2                                            (0)
+#endif /* (ITC_CONFIG_PACKED_EVENT_SIMD != ITC_PACKED_EVENT_SIMD_NONE) && (defined(__AVX2__) || ITC_PACKED_EVENT_USE_RUNTIME_DISPATCH) */
+
+/* SSE2 has no unsigned or 64 bit compare, so it is only used for 32 bit
+ * counters. It is the baseline of the runtime dispatch, unless the library is
+ * built with AVX2 enabled anyway */
+#if (ITC_CONFIG_PACKED_EVENT_SIMD != ITC_PACKED_EVENT_SIMD_NONE) && \
+    defined(__SSE2__) && !defined(__AVX2__) && \
+    !ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+/** Whether the SSE2 kernels are available */
+#define ITC_PACKED_EVENT_USE_SSE2                                            (1)
+#else
+/** Whether the SSE2 kernels are available */
+#define ITC_PACKED_EVENT_USE_SSE2                                            (0)
+#endif /* (ITC_CONFIG_PACKED_EVENT_SIMD != ITC_PACKED_EVENT_SIMD_NONE) && defined(__SSE2__) && !defined(__AVX2__) && !ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+
+#if (ITC_CONFIG_PACKED_EVENT_SIMD != ITC_PACKED_EVENT_SIMD_NONE) && \
+    defined(__ARM_NEON) && defined(__aarch64__)
+/** Whether the NEON kernels are available */
+#define ITC_PACKED_EVENT_USE_NEON                                            (1)
+#else
+/** Whether the NEON kernels are available */
+#define ITC_PACKED_EVENT_USE_NEON                                            (0)
+#endif /* (ITC_CONFIG_PACKED_EVENT_SIMD != ITC_PACKED_EVENT_SIMD_NONE) && defined(__ARM_NEON) && defined(__aarch64__) */
+
+#if ITC_PACKED_EVENT_USE_RUNTIME_DISPATCH
+/** Builds the AVX2 kernels for the AVX2 target, independently of the
+ * compiler flags */
+#define ITC_PACKED_EVENT_AVX2_TARGET             __attribute__((target("avx2")))
+/** Checks whether the CPU supports the AVX2 kernels */
+#define ITC_PACKED_EVENT_IS_AVX2_SUPPORTED()                                   \
+    (__builtin_cpu_init(), __builtin_cpu_supports("avx2"))
+#else
+/** Builds the AVX2 kernels for the AVX2 target, independently of the
+ * compiler flags */
+#define ITC_PACKED_EVENT_AVX2_TARGET
+/** Checks whether the CPU supports the AVX2 kernels */
+#define ITC_PACKED_EVENT_IS_AVX2_SUPPORTED()                               (1)
+#endif /* ITC_PACKED_EVENT_USE_RUNTIME_DISPATCH */
+
+/** The number of packed Event nodes held by an AVX2 vector */
+#define ITC_PACKED_EVENT_AVX2_LANES                                            \
+    ((uint32_t)(32U / sizeof(ITC_Event_Counter_t)))
+/** The number of packed Event nodes held by an SSE2 or NEON vector */
+#define ITC_PACKED_EVENT_SSE2_NEON_LANES                                       \
+    ((uint32_t)(16U / sizeof(ITC_Event_Counter_t)))
+
+/** Checks whether the given packed Event node is a parent node */
+#define ITC_PACKED_EVENT_IS_PARENT_NODE(t_Node)                                \
+    ((t_Node) == ITC_PACKED_EVENT_PARENT_NODE)
+
+#endif /* ITC_PACKED_PRIVATE_H_ */
@@ -9,17 +9,190 @@
  */
 #include "ITC_Config.h"
 
+#if ITC_CONFIG_ENABLE_STATS
+#include "ITC_Port.h"
+#include "ITC_Port_package.h"
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+/* The statistics kept by libitc */
+static ITC_Port_Stats_t gt_ItcStats;
+
+/* The total number of nodes (of any type) allocated so far. Used to find the
+ * number of nodes allocated by each operation */
+static uint32_t gu32_ItcStatsAllocationCount = 0;
+
+/******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Reset the allocation statistics for an allocation type
+ *
+ * @param pt_AllocStats The allocation statistics
+ */
+static void resetAllocStats(
+    ITC_Port_AllocStats_t *const pt_AllocStats
+)
+{
+    pt_AllocStats->u32_Peak = pt_AllocStats->u32_Live;
+    pt_AllocStats->u32_Allocations = 0;
+    pt_AllocStats->u32_Frees = 0;
+    pt_AllocStats->u32_FailedAllocations = 0;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
 #if ITC_CONFIG_MEMORY_ALLOCATION_TYPE != ITC_MEMORY_ALLOCATION_TYPE_CUSTOM
 #include "ITC_Port.h"
+#include "ITC_Port_private.h"
 
 #if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
 #include <stdlib.h>
 #endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
 
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+#include <string.h>
+
 #if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
-#include "ITC_Port_private.h"
+#include <stddef.h>
 
-#include <string.h>
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+#include "ITC_Id_package.h"
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+
+/* The index of the first slot of the ID node allocation array that might be
+ * free. All slots before it are in use */
+static uint32_t gu32_ItcIdNodeFreeSlotHint = 0;
+
+/* The index of the first slot of the Event node allocation array that might
+ * be free. All slots before it are in use */
+static uint32_t gu32_ItcEventNodeFreeSlotHint = 0;
+
+/* The index of the first slot of the Stamp node allocation array that might
+ * be free. All slots before it are in use */
+static uint32_t gu32_ItcStampNodeFreeSlotHint = 0;
+
+/* The pointer fields of the ID, Event and Stamp nodes */
+static const ITC_Port_NodePointer_t grt_ItcNodePointers[] =
+{
+    {
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+        (uint32_t)offsetof(ITC_Id_t, pt_Left),
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+    },
+    {
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+        (uint32_t)offsetof(ITC_Id_t, pt_Right),
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+    },
+    {
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+        (uint32_t)offsetof(ITC_Id_t, pt_Parent),
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+    },
+    {
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+        (uint32_t)offsetof(ITC_Event_t, pt_Left),
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+    },
+    {
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+        (uint32_t)offsetof(ITC_Event_t, pt_Right),
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+    },
+    {
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+        (uint32_t)offsetof(ITC_Event_t, pt_Parent),
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+    },
+    {
+        ITC_PORT_ALLOCTYPE_ITC_STAMP_T,
+        (uint32_t)offsetof(ITC_Stamp_t, pt_Id),
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+    },
+    {
+        ITC_PORT_ALLOCTYPE_ITC_STAMP_T,
+        (uint32_t)offsetof(ITC_Stamp_t, pt_Event),
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+    },
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+    {
+        ITC_PORT_ALLOCTYPE_ITC_STAMP_T,
+        (uint32_t)offsetof(ITC_Stamp_t, pt_InflationLeaf),
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+    },
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+};
+
+/* The header of the snapshot being taken or restored. Too large to keep on
+ * the stack */
+static ITC_Port_SnapshotHeader_t gt_ItcSnapshotHeader;
+
+/* The node allocation arrays included in a snapshot, in order. The index of
+ * each array matches its `ITC_Port_AllocType_t` */
+static const ITC_Port_AllocType_t grt_ItcSnapshotAllocTypes[ITC_PORT_SNAPSHOT_ARRAY_COUNT] =
+{
+    ITC_PORT_ALLOCTYPE_ITC_ID_T,
+    ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+    ITC_PORT_ALLOCTYPE_ITC_STAMP_T,
+};
+
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST
+
+/* The head of the free slot list of the ID node allocation array */
+static void *gpv_ItcIdNodeFreeListHead = NULL;
+
+/* The head of the free slot list of the Event node allocation array */
+static void *gpv_ItcEventNodeFreeListHead = NULL;
+
+/* The head of the free slot list of the Stamp node allocation array */
+static void *gpv_ItcStampNodeFreeListHead = NULL;
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+
+/* The heads of the global free slot lists. The low 32 bits hold the index of
+ * the first free slot and the high 32 bits hold a tag, which changes on every
+ * update of the head, so that a stale head is never mistaken for the current
+ * one (i.e. the ABA problem) */
+
+/* The head of the free slot list of the ID node allocation array */
+static uint64_t gu64_ItcIdNodeConcurrentFreeListHead = 0;
+
+/* The head of the free slot list of the Event node allocation array */
+static uint64_t gu64_ItcEventNodeConcurrentFreeListHead = 0;
+
+/* The head of the free slot list of the Stamp node allocation array */
+static uint64_t gu64_ItcStampNodeConcurrentFreeListHead = 0;
+
+/* The generation of the global free slot lists. Changes every time the lists
+ * are rebuilt by `ITC_Port_init`, which invalidates the slots cached in the
+ * magazines of all threads */
+static uint32_t gu32_ItcConcurrentFreeListGeneration = 0;
+
+/* The calling thread's magazine of free ID node slots */
+static __thread ITC_Port_Magazine_t gt_ItcIdNodeThreadMagazine;
+
+/* The calling thread's magazine of free Event node slots */
+static __thread ITC_Port_Magazine_t gt_ItcEventNodeThreadMagazine;
+
+/* The calling thread's magazine of free Stamp node slots */
+static __thread ITC_Port_Magazine_t gt_ItcStampNodeThreadMagazine;
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
 
 /******************************************************************************
  * Private functions
@@ -83,6 +256,93 @@ static ITC_Status_t getStaticMemory(
     return t_Status;
 }
 
+/**
+ * @brief Check whether a pointer points to a slot in a static array
+ *
+ * Makes sure the pointer is:
+ * - located inside the corresponding array
+ * - is a multiple of the allocation size (i.e. not between elements)
+ *
+ * @param pv_Ptr The pointer to check
+ * @param pu8_Array The static array
+ * @param u32_ArrayLength The length of the array in elements
+ * @param u32_AllocSize The size of one element
+ * @return `true` if the pointer points to a slot, `false` otherwise
+ */
+static bool isStaticMemorySlot(
+    const void *const pv_Ptr,
+    const uint8_t *const pu8_Array,
+    const uint32_t u32_ArrayLength,
+    const uint32_t u32_AllocSize
+)
+{
+    /* clang-format off */
+    return (((uintptr_t)pv_Ptr >= (uintptr_t)&pu8_Array[0]) &&
+            ((uintptr_t)pv_Ptr <= (uintptr_t)&pu8_Array[(u32_ArrayLength - 1) * u32_AllocSize]) &&
+            (((uintptr_t)pv_Ptr - (uintptr_t)&pu8_Array[0]) % u32_AllocSize == 0));
+    /* clang-format on */
+}
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+
+/**
+ * @brief Get the free slot hint of a static array
+ *
+ * @param t_AllocType The type of the allocation
+ * @return `uint32_t *` Pointer to the hint or `NULL` if the allocation type is
+ * not supported
+ */
+static uint32_t *getFreeSlotHint(
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    uint32_t *pu32_Hint;
+
+    switch (t_AllocType)
+    {
+        case ITC_PORT_ALLOCTYPE_ITC_ID_T:
+        {
+            pu32_Hint = &gu32_ItcIdNodeFreeSlotHint;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
+        {
+            pu32_Hint = &gu32_ItcEventNodeFreeSlotHint;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+        {
+            pu32_Hint = &gu32_ItcStampNodeFreeSlotHint;
+            break;
+        }
+        default:
+        {
+            pu32_Hint = NULL;
+            break;
+        }
+    }
+
+    return pu32_Hint;
+}
+
+/**
+ * @brief Check whether a slot of a static array is free
+ *
+ * @param pu8_Slot The slot to check
+ * @param u32_AllocSize The size of the slot
+ * @return `true` if the slot is free, `false` otherwise
+ */
+static bool isStaticMemorySlotFree(
+    const uint8_t *const pu8_Slot,
+    const uint32_t u32_AllocSize
+)
+{
+    return pu8_Slot[0] == ITC_PORT_FREE_SLOT_PATTERN &&
+           memcmp((const void *)&pu8_Slot[0],
+                  (const void *)&pu8_Slot[1],
+                  u32_AllocSize - 1) == 0;
+}
+
 static void *staticMalloc(
     const ITC_Port_AllocType_t t_AllocType
 )
@@ -92,27 +352,32 @@ static void *staticMalloc(
     uint8_t *pu8_Array = NULL;
     uint32_t u32_ArrayLength;
     uint32_t u32_AllocSize;
+    uint32_t *pu32_Hint = getFreeSlotHint(t_AllocType);
+    uint32_t u32_I;
 
     t_Status = getStaticMemory(
         t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS && pu32_Hint)
     {
-        /* Find an empty spot and return it */
-        for (uint32_t u32_I = 0;
-             u32_I < u32_ArrayLength * u32_AllocSize;
-             u32_I += u32_AllocSize)
+        /* Find an empty spot and return it. All slots before the hint are in
+         * use, so there is no need to check them */
+        for (u32_I = *pu32_Hint; u32_I < u32_ArrayLength; u32_I++)
         {
-            /* Check if the element in the array is free */
-            if (pu8_Array[u32_I] == ITC_PORT_FREE_SLOT_PATTERN &&
-                memcmp((const void *)&pu8_Array[u32_I],
-                       (const void *)&pu8_Array[u32_I + 1],
-                       u32_AllocSize - 1) == 0)
+            if (isStaticMemorySlotFree(
+                    &pu8_Array[u32_I * u32_AllocSize], u32_AllocSize))
             {
-                pv_Ptr = (void *)&pu8_Array[u32_I];
+                pv_Ptr = (void *)&pu8_Array[u32_I * u32_AllocSize];
+
+                /* Mark the slot as used. Reserved nodes, for example, are
+                 * not initialised until much later. A zeroed ID or Event
+                 * has no parent, so it is not moved by the compaction */
+                memset(pv_Ptr, 0, u32_AllocSize);
                 break;
             }
         }
+
+        *pu32_Hint = (pv_Ptr) ? u32_I + 1 : u32_I;
     }
 
     return pv_Ptr;
@@ -127,6 +392,8 @@ static ITC_Status_t staticFree(
     uint8_t *pu8_Array = NULL;
     uint32_t u32_ArrayLength;
     uint32_t u32_AllocSize;
+    uint32_t *pu32_Hint = getFreeSlotHint(t_AllocType);
+    uint32_t u32_Slot;
 
     if (pv_Ptr)
     {
@@ -138,156 +405,3169 @@ static ITC_Status_t staticFree(
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        isStaticMemorySlot(pv_Ptr, pu8_Array, u32_ArrayLength, u32_AllocSize))
     {
-        /* clang-format off */
-        /* Make sure the pointer to be deallocated is:
-         * - located inside the corresponding array
-         * - is a multiple of the allocation size (i.e. not between elements) */
-        if (((uintptr_t)pv_Ptr >= (uintptr_t)&pu8_Array[0]) &&
-            ((uintptr_t)pv_Ptr <= (uintptr_t)&pu8_Array[(u32_ArrayLength - 1) * u32_AllocSize]) &&
-            (((uintptr_t)pv_Ptr - (uintptr_t)&pu8_Array[0]) % u32_AllocSize == 0))
+        /* Free the memory */
+        memset(pv_Ptr, ITC_PORT_FREE_SLOT_PATTERN, u32_AllocSize);
+
+        /* The freed slot might be before the first free slot */
+        u32_Slot = (uint32_t)(
+            ((uintptr_t)pv_Ptr - (uintptr_t)&pu8_Array[0]) / u32_AllocSize);
+
+        if (pu32_Hint && u32_Slot < *pu32_Hint)
         {
-            /* Free the memory */
-            memset(pv_Ptr, ITC_PORT_FREE_SLOT_PATTERN, u32_AllocSize);
+            *pu32_Hint = u32_Slot;
         }
-        /* clang-format on */
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
-
-/******************************************************************************
- * Public functions
- ******************************************************************************/
-
-/******************************************************************************
- * Init port
- ******************************************************************************/
-
-ITC_Status_t ITC_Port_init(void)
+/**
+ * @brief Get the parent of an ID or Event node
+ *
+ * @param pv_Node The node
+ * @param t_AllocType The type of the node
+ * @return `void *` The parent of the node
+ */
+static void *getStaticNodeParent(
+    const void *const pv_Node,
+    const ITC_Port_AllocType_t t_AllocType
+)
 {
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    return (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_ID_T)
+               ? (void *)((const ITC_Id_t *)pv_Node)->pt_Parent
+               : (void *)((const ITC_Event_t *)pv_Node)->pt_Parent;
+}
 
-    if (!gpt_ItcIdNodeAllocationArray ||
-        !gpt_ItcEventNodeAllocationArray ||
-        !gpt_ItcStampNodeAllocationArray)
+/**
+ * @brief Set the parent of an ID or Event node
+ *
+ * @param pv_Node The node
+ * @param pv_Parent The new parent of the node
+ * @param t_AllocType The type of the node
+ */
+static void setStaticNodeParent(
+    void *const pv_Node,
+    void *const pv_Parent,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    if (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_ID_T)
     {
-        t_Status = ITC_STATUS_INVALID_PARAM;
+        ((ITC_Id_t *)pv_Node)->pt_Parent = (ITC_Id_t *)pv_Parent;
     }
-    else if (
-        gu32_ItcIdNodeAllocationArrayLength < 1 ||
-        gu32_ItcEventNodeAllocationArrayLength < 1 ||
-        gu32_ItcStampNodeAllocationArrayLength < 1)
+    else
     {
-        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        ((ITC_Event_t *)pv_Node)->pt_Parent = (ITC_Event_t *)pv_Parent;
     }
-    else
+}
+
+/**
+ * @brief Get the ID or Event root of a live Stamp
+ *
+ * @param u32_Slot The slot of the Stamp
+ * @param t_AllocType The type of the root
+ * @return `void *` The root, or `NULL` if the slot is free or the Stamp has
+ * no such root (i.e. it is a reserved Stamp)
+ */
+static void *getStampRoot(
+    const uint32_t u32_Slot,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    const ITC_Stamp_t *pt_Stamp = &gpt_ItcStampNodeAllocationArray[u32_Slot];
+    void *pv_Root = NULL;
+
+    if (!isStaticMemorySlotFree(
+            (const uint8_t *)pt_Stamp, sizeof(ITC_Stamp_t)))
     {
-        memset(
-            (void *)&gpt_ItcIdNodeAllocationArray[0],
-            ITC_PORT_FREE_SLOT_PATTERN,
-            gu32_ItcIdNodeAllocationArrayLength * sizeof(ITC_Id_t));
-        memset(
-            (void *)&gpt_ItcEventNodeAllocationArray[0],
-            ITC_PORT_FREE_SLOT_PATTERN,
-            gu32_ItcEventNodeAllocationArrayLength * sizeof(ITC_Event_t));
-        memset(
-            (void *)&gpt_ItcStampNodeAllocationArray[0],
-            ITC_PORT_FREE_SLOT_PATTERN,
-            gu32_ItcStampNodeAllocationArrayLength * sizeof(ITC_Stamp_t));
+        pv_Root = (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_ID_T)
+                      ? (void *)pt_Stamp->pt_Id
+                      : (void *)pt_Stamp->pt_Event;
     }
 
-    return t_Status;
-#else
-    /* Always succeeds */
-    return ITC_STATUS_SUCCESS;
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+    return pv_Root;
 }
 
-/******************************************************************************
- * Fini port
- ******************************************************************************/
-
-ITC_Status_t ITC_Port_fini(void)
+/**
+ * @brief Mark the ID or Event roots of all live Stamps
+ *
+ * A root has no parent, so a marked root is made its own parent. This lets the
+ * compaction tell Stamp roots apart without scanning the Stamps for every node
+ *
+ * @param t_AllocType The type of the roots
+ */
+static void markStampRoots(
+    const ITC_Port_AllocType_t t_AllocType
+)
 {
-    /* Always succeeds */
-    return ITC_STATUS_SUCCESS;
-}
+    void *pv_Root;
 
-/******************************************************************************
- * Allocate memory
- ******************************************************************************/
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_ItcStampNodeAllocationArrayLength;
+         u32_I++)
+    {
+        pv_Root = getStampRoot(u32_I, t_AllocType);
 
-ITC_Status_t ITC_Port_malloc(
-    void **ppv_Ptr,
-    ITC_Port_AllocType_t t_AllocType
+        if (pv_Root)
+        {
+            setStaticNodeParent(pv_Root, pv_Root, t_AllocType);
+        }
+    }
+}
+
+/**
+ * @brief Point all live Stamps to the new location of their moved ID or Event
+ * roots and unmark the roots
+ *
+ * The old slot of a moved root holds its new location in place of its parent
+ * (see `relocateStaticNode`). The old slots are freed by the caller once all
+ * Stamps have been updated.
+ *
+ * @param t_AllocType The type of the roots
+ */
+static void updateStampRoots(
+    const ITC_Port_AllocType_t t_AllocType
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    ITC_Stamp_t *pt_Stamp;
+    void *pv_Root;
+    void *pv_Parent;
 
-    if (ppv_Ptr)
+    /* Shared (i.e. copy-on-write) roots are used by more than one Stamp, so
+     * all Stamps must be updated before any root is unmarked */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_ItcStampNodeAllocationArrayLength;
+         u32_I++)
     {
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
-        *ppv_Ptr = staticMalloc(t_AllocType);
-#else
-        switch (t_AllocType)
+        pv_Root = getStampRoot(u32_I, t_AllocType);
+
+        if (pv_Root)
         {
-            case ITC_PORT_ALLOCTYPE_ITC_ID_T:
-                {
-                    *ppv_Ptr = malloc(sizeof(ITC_Id_t));
-                    break;
-                }
-            case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
-                {
-                    *ppv_Ptr = malloc(sizeof(ITC_Event_t));
-                    break;
-                }
-            case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+            pv_Parent = getStaticNodeParent(pv_Root, t_AllocType);
+
+            if (pv_Parent != pv_Root)
+            {
+                pt_Stamp = &gpt_ItcStampNodeAllocationArray[u32_I];
+
+                if (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_ID_T)
                 {
-                    *ppv_Ptr = malloc(sizeof(ITC_Stamp_t));
-                    break;
+                    pt_Stamp->pt_Id = (ITC_Id_t *)pv_Parent;
                 }
-            default:
+                else
                 {
-                    *ppv_Ptr = NULL;
-                    t_Status = ITC_STATUS_INVALID_PARAM;
-                    break;
+                    pt_Stamp->pt_Event = (ITC_Event_t *)pv_Parent;
                 }
+            }
         }
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+    }
 
-        if (!(*ppv_Ptr) && t_Status == ITC_STATUS_SUCCESS)
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_ItcStampNodeAllocationArrayLength;
+         u32_I++)
+    {
+        pv_Root = getStampRoot(u32_I, t_AllocType);
+
+        if (pv_Root)
         {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            setStaticNodeParent(pv_Root, NULL, t_AllocType);
         }
     }
-    else
-    {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
-
-    return t_Status;
 }
 
-/******************************************************************************
- * Deallocate memory
- ******************************************************************************/
-
-ITC_Status_t ITC_Port_free(
+/**
+ * @brief Check whether a node must stay where it is during compaction
+ *
+ * The roots of IDs and Events not owned by a Stamp are referenced directly by
+ * the application, so they are never moved. Their subtrees can still be moved.
+ * The roots owned by a Stamp are marked beforehand (see `markStampRoots`).
+ *
+ * @param pv_Node The node to check
+ * @param t_AllocType The type of the node
+ * @return `true` if the node cannot be moved, `false` otherwise
+ */
+static bool isStaticNodePinned(
+    const void *const pv_Node,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    return !getStaticNodeParent(pv_Node, t_AllocType);
+}
+
+/**
+ * @brief Move an ID or Event node into a free slot
+ *
+ * Updates the parent and the children of the node to point to its new
+ * location, and frees the old slot. If the node is a (marked) Stamp root, its
+ * new location is left in the old slot in place of its parent instead, so
+ * the Stamps using it can be updated later (see `updateStampRoots`).
+ *
+ * @param pv_Node The node to move
+ * @param pv_Slot The free slot to move the node into
+ * @param t_AllocType The type of the node
+ * @param u32_AllocSize The size of the node
+ */
+static void relocateStaticNode(
+    void *const pv_Node,
+    void *const pv_Slot,
+    const ITC_Port_AllocType_t t_AllocType,
+    const uint32_t u32_AllocSize
+)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Event_t *pt_Event;
+
+    memcpy(pv_Slot, (const void *)pv_Node, u32_AllocSize);
+    memset(pv_Node, ITC_PORT_FREE_SLOT_PATTERN, u32_AllocSize);
+
+    if (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_ID_T)
+    {
+        pt_Id = (ITC_Id_t *)pv_Slot;
+
+        if (pt_Id->pt_Left)
+        {
+            pt_Id->pt_Left->pt_Parent = pt_Id;
+            pt_Id->pt_Right->pt_Parent = pt_Id;
+        }
+
+        if (pt_Id->pt_Parent == (ITC_Id_t *)pv_Node)
+        {
+            pt_Id->pt_Parent = pt_Id;
+            ((ITC_Id_t *)pv_Node)->pt_Parent = pt_Id;
+
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+            if (pt_Id->b_IsInterned)
+            {
+                ITC_Id_relocateInternedId((const ITC_Id_t *)pv_Node, pt_Id);
+            }
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+        }
+        else if (pt_Id->pt_Parent->pt_Left == (ITC_Id_t *)pv_Node)
+        {
+            pt_Id->pt_Parent->pt_Left = pt_Id;
+        }
+        else
+        {
+            pt_Id->pt_Parent->pt_Right = pt_Id;
+        }
+    }
+    else
+    {
+        pt_Event = (ITC_Event_t *)pv_Slot;
+
+        if (pt_Event->pt_Left)
+        {
+            pt_Event->pt_Left->pt_Parent = pt_Event;
+            pt_Event->pt_Right->pt_Parent = pt_Event;
+        }
+
+        if (pt_Event->pt_Parent == (ITC_Event_t *)pv_Node)
+        {
+            pt_Event->pt_Parent = pt_Event;
+            ((ITC_Event_t *)pv_Node)->pt_Parent = pt_Event;
+        }
+        else if (pt_Event->pt_Parent->pt_Left == (ITC_Event_t *)pv_Node)
+        {
+            pt_Event->pt_Parent->pt_Left = pt_Event;
+        }
+        else
+        {
+            pt_Event->pt_Parent->pt_Right = pt_Event;
+        }
+    }
+}
+
+/**
+ * @brief Move the ID or Event nodes at the end of a static array into the
+ * free slots at its beginning
+ *
+ * @param t_AllocType The type of the array
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t compactStaticArray(
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status;
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    uint32_t *pu32_Hint = getFreeSlotHint(t_AllocType);
+    uint32_t u32_Free = 0;
+    uint32_t u32_Last;
+
+    t_Status = getStaticMemory(
+        t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
+
+    if (t_Status == ITC_STATUS_SUCCESS && pu32_Hint)
+    {
+        u32_Last = u32_ArrayLength;
+
+        markStampRoots(t_AllocType);
+
+        /* Walk from both ends of the array until they meet. `u32_Free`
+         * looks for free slots, `u32_Last` for nodes that can be moved */
+        while (u32_Free < u32_Last)
+        {
+            if (!isStaticMemorySlotFree(
+                    &pu8_Array[u32_Free * u32_AllocSize], u32_AllocSize))
+            {
+                u32_Free++;
+            }
+            else if (isStaticMemorySlotFree(
+                         &pu8_Array[(u32_Last - 1) * u32_AllocSize],
+                         u32_AllocSize) ||
+                     isStaticNodePinned(
+                         (const void *)&pu8_Array[(u32_Last - 1) * u32_AllocSize],
+                         t_AllocType))
+            {
+                u32_Last--;
+            }
+            else
+            {
+                relocateStaticNode(
+                    (void *)&pu8_Array[(u32_Last - 1) * u32_AllocSize],
+                    (void *)&pu8_Array[u32_Free * u32_AllocSize],
+                    t_AllocType,
+                    u32_AllocSize);
+                u32_Free++;
+                u32_Last--;
+            }
+        }
+
+        updateStampRoots(t_AllocType);
+
+        /* Free the old slots of the moved Stamp roots. Every other slot past
+         * the meeting point is either free or holds a pinned node, which has
+         * no parent */
+        for (; u32_Last < u32_ArrayLength; u32_Last++)
+        {
+            if (!isStaticMemorySlotFree(
+                    &pu8_Array[u32_Last * u32_AllocSize], u32_AllocSize) &&
+                getStaticNodeParent(
+                    (const void *)&pu8_Array[u32_Last * u32_AllocSize],
+                    t_AllocType))
+            {
+                memset(&pu8_Array[u32_Last * u32_AllocSize],
+                       ITC_PORT_FREE_SLOT_PATTERN,
+                       u32_AllocSize);
+            }
+        }
+
+        /* All slots before `u32_Free` are now in use */
+        *pu32_Hint = u32_Free;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Get the node allocation array of an ID, Event or Stamp node
+ *
+ * @param t_AllocType The type of the node
+ * @return `uint8_t *` The node allocation array
+ */
+static uint8_t *getStaticArray(
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    return (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_ID_T)
+               ? (uint8_t *)gpt_ItcIdNodeAllocationArray
+           : (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_EVENT_T)
+               ? (uint8_t *)gpt_ItcEventNodeAllocationArray
+               : (uint8_t *)gpt_ItcStampNodeAllocationArray;
+}
+
+/**
+ * @brief Get the offset of a node allocation array inside a snapshot,
+ * relative to the end of the snapshot header
+ *
+ * @param pt_Header The snapshot header
+ * @param u32_Array The index of the array in `grt_ItcSnapshotAllocTypes`
+ * @return `uint32_t` The offset of the array
+ */
+static uint32_t getSnapshotArrayOffset(
+    const ITC_Port_SnapshotHeader_t *const pt_Header,
+    const uint32_t u32_Array
+)
+{
+    uint32_t u32_Offset = 0;
+
+    for (uint32_t u32_I = 0; u32_I < u32_Array; u32_I++)
+    {
+        u32_Offset +=
+            pt_Header->ru32_ArrayLengths[u32_I] * pt_Header->ru32_NodeSizes[u32_I];
+    }
+
+    return u32_Offset;
+}
+
+/**
+ * @brief Describe the current node allocation arrays in a snapshot header
+ *
+ * @param pt_Header (out) The snapshot header
+ * @param pu32_SnapshotSize (out) The size of the snapshot, including the
+ * header
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getSnapshotHeader(
+    ITC_Port_SnapshotHeader_t *const pt_Header,
+    uint32_t *const pu32_SnapshotSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint8_t *pu8_Array = NULL;
+
+    /* Keep the padding bytes deterministic */
+    memset((void *)pt_Header, 0, sizeof(*pt_Header));
+
+    pt_Header->u32_Magic = ITC_PORT_SNAPSHOT_MAGIC;
+    pt_Header->u32_Version = ITC_PORT_SNAPSHOT_VERSION;
+    pt_Header->u32_Features = ITC_PORT_SNAPSHOT_FEATURES;
+    *pu32_SnapshotSize = sizeof(*pt_Header);
+
+    for (uint32_t u32_I = 0;
+         u32_I < ITC_PORT_SNAPSHOT_ARRAY_COUNT && t_Status == ITC_STATUS_SUCCESS;
+         u32_I++)
+    {
+        t_Status = getStaticMemory(
+            grt_ItcSnapshotAllocTypes[u32_I],
+            &pu8_Array,
+            &pt_Header->ru32_ArrayLengths[u32_I],
+            &pt_Header->ru32_NodeSizes[u32_I]);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            pt_Header->ru64_ArrayAddresses[u32_I] =
+                (uint64_t)(uintptr_t)pu8_Array;
+            *pu32_SnapshotSize += pt_Header->ru32_ArrayLengths[u32_I] *
+                                  pt_Header->ru32_NodeSizes[u32_I];
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Check whether a snapshot can be restored into the current node
+ * allocation arrays
+ *
+ * @param pt_Header The snapshot header
+ * @param u32_BufferSize The size of the buffer holding the snapshot
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION` if the snapshot was
+ * taken by an incompatible build
+ */
+static ITC_Status_t validateSnapshotHeader(
+    const ITC_Port_SnapshotHeader_t *const pt_Header,
+    const uint32_t u32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    uint32_t u32_SnapshotSize = sizeof(*pt_Header);
+
+    if (pt_Header->u32_Magic != ITC_PORT_SNAPSHOT_MAGIC)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (pt_Header->u32_Version != ITC_PORT_SNAPSHOT_VERSION ||
+             pt_Header->u32_Features != ITC_PORT_SNAPSHOT_FEATURES)
+    {
+        t_Status = ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION;
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    for (uint32_t u32_I = 0;
+         u32_I < ITC_PORT_SNAPSHOT_ARRAY_COUNT && t_Status == ITC_STATUS_SUCCESS;
+         u32_I++)
+    {
+        t_Status = getStaticMemory(
+            grt_ItcSnapshotAllocTypes[u32_I],
+            &pu8_Array,
+            &u32_ArrayLength,
+            &u32_AllocSize);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        else if (pt_Header->ru32_NodeSizes[u32_I] != u32_AllocSize)
+        {
+            t_Status = ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION;
+        }
+        else if (pt_Header->ru32_ArrayLengths[u32_I] != u32_ArrayLength)
+        {
+            t_Status = ITC_STATUS_INVALID_PARAM;
+        }
+        else
+        {
+            u32_SnapshotSize += u32_ArrayLength * u32_AllocSize;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && u32_BufferSize < u32_SnapshotSize)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Check whether a pointer stored in a snapshot points to a live node
+ * of the snapshot
+ *
+ * @param pt_Header The snapshot header
+ * @param pu8_Arrays The node allocation arrays of the snapshot
+ * @param pu8_Field The pointer field
+ * @param t_AllocType The type of the node the field points to
+ * @return `true` if the pointer is `NULL` or points to a live node, `false`
+ * otherwise
+ */
+static bool isSnapshotPointerValid(
+    const ITC_Port_SnapshotHeader_t *const pt_Header,
+    const uint8_t *const pu8_Arrays,
+    const uint8_t *const pu8_Field,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    const uint32_t u32_Array = (uint32_t)t_AllocType;
+    const uint32_t u32_AllocSize = pt_Header->ru32_NodeSizes[u32_Array];
+    const void *pv_Ptr;
+    uint64_t u64_Offset;
+    bool b_IsValid = true;
+
+    /* The fields might not be suitably aligned for reading them directly */
+    memcpy((void *)&pv_Ptr, (const void *)pu8_Field, sizeof(pv_Ptr));
+
+    if (pv_Ptr)
+    {
+        /* Wraps around if the pointer is before the array */
+        u64_Offset = (uint64_t)(uintptr_t)pv_Ptr -
+                     pt_Header->ru64_ArrayAddresses[u32_Array];
+
+        b_IsValid =
+            u64_Offset < (uint64_t)pt_Header->ru32_ArrayLengths[u32_Array] *
+                             u32_AllocSize &&
+            u64_Offset % u32_AllocSize == 0 &&
+            !isStaticMemorySlotFree(
+                &pu8_Arrays[getSnapshotArrayOffset(pt_Header, u32_Array) +
+                            (uint32_t)u64_Offset],
+                u32_AllocSize);
+    }
+
+    return b_IsValid;
+}
+
+/**
+ * @brief Validate the pointers of the live nodes of a snapshot array
+ *
+ * @param pt_Header The snapshot header
+ * @param pu8_Arrays The node allocation arrays of the snapshot
+ * @param u32_Array The index of the array in `grt_ItcSnapshotAllocTypes`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if an ID node points outside the snapshot
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if an Event node points outside the
+ * snapshot
+ * @retval `ITC_STATUS_CORRUPT_STAMP` if a Stamp node points outside the
+ * snapshot
+ */
+static ITC_Status_t validateSnapshotArray(
+    const ITC_Port_SnapshotHeader_t *const pt_Header,
+    const uint8_t *const pu8_Arrays,
+    const uint32_t u32_Array
+)
+{
+    const ITC_Port_AllocType_t t_AllocType =
+        grt_ItcSnapshotAllocTypes[u32_Array];
+    const uint32_t u32_AllocSize = pt_Header->ru32_NodeSizes[u32_Array];
+    const uint8_t *pu8_Node =
+        &pu8_Arrays[getSnapshotArrayOffset(pt_Header, u32_Array)];
+    const ITC_Port_NodePointer_t *pt_Pointer;
+    bool b_IsValid = true;
+
+    for (uint32_t u32_I = 0;
+         u32_I < pt_Header->ru32_ArrayLengths[u32_Array] && b_IsValid;
+         u32_I++, pu8_Node = &pu8_Node[u32_AllocSize])
+    {
+        if (!isStaticMemorySlotFree(pu8_Node, u32_AllocSize))
+        {
+            for (uint32_t u32_J = 0;
+                 u32_J < sizeof(grt_ItcNodePointers) /
+                              sizeof(grt_ItcNodePointers[0]) &&
+                 b_IsValid;
+                 u32_J++)
+            {
+                pt_Pointer = &grt_ItcNodePointers[u32_J];
+
+                if (pt_Pointer->t_NodeType == t_AllocType)
+                {
+                    b_IsValid = isSnapshotPointerValid(
+                        pt_Header,
+                        pu8_Arrays,
+                        &pu8_Node[pt_Pointer->u32_Offset],
+                        pt_Pointer->t_TargetType);
+                }
+            }
+        }
+    }
+
+    return (b_IsValid) ? ITC_STATUS_SUCCESS
+         : (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_ID_T) ? ITC_STATUS_CORRUPT_ID
+         : (t_AllocType == ITC_PORT_ALLOCTYPE_ITC_EVENT_T)
+             ? ITC_STATUS_CORRUPT_EVENT
+             : ITC_STATUS_CORRUPT_STAMP;
+}
+
+/**
+ * @brief Restore a static array from a snapshot and rebase the pointers of
+ * its live nodes onto the current node allocation arrays
+ *
+ * @note The snapshot must have passed ::validateSnapshotArray()
+ * @param pt_Header The snapshot header
+ * @param pu8_Arrays The node allocation arrays of the snapshot
+ * @param u32_Array The index of the array in `grt_ItcSnapshotAllocTypes`
+ * @return `uint32_t` The number of live nodes in the array
+ */
+static uint32_t restoreStaticArray(
+    const ITC_Port_SnapshotHeader_t *const pt_Header,
+    const uint8_t *const pu8_Arrays,
+    const uint32_t u32_Array
+)
+{
+    const ITC_Port_AllocType_t t_AllocType =
+        grt_ItcSnapshotAllocTypes[u32_Array];
+    const uint32_t u32_AllocSize = pt_Header->ru32_NodeSizes[u32_Array];
+    uint8_t *pu8_Node = getStaticArray(t_AllocType);
+    const ITC_Port_NodePointer_t *pt_Pointer;
+    uint32_t u32_LiveNodes = 0;
+    void *pv_Ptr;
+
+    memcpy(
+        (void *)pu8_Node,
+        (const void *)&pu8_Arrays[getSnapshotArrayOffset(pt_Header, u32_Array)],
+        pt_Header->ru32_ArrayLengths[u32_Array] * u32_AllocSize);
+
+    for (uint32_t u32_I = 0;
+         u32_I < pt_Header->ru32_ArrayLengths[u32_Array];
+         u32_I++, pu8_Node = &pu8_Node[u32_AllocSize])
+    {
+        if (!isStaticMemorySlotFree(pu8_Node, u32_AllocSize))
+        {
+            for (uint32_t u32_J = 0;
+                 u32_J < sizeof(grt_ItcNodePointers) /
+                              sizeof(grt_ItcNodePointers[0]);
+                 u32_J++)
+            {
+                pt_Pointer = &grt_ItcNodePointers[u32_J];
+                pv_Ptr = NULL;
+
+                if (pt_Pointer->t_NodeType == t_AllocType)
+                {
+                    memcpy(
+                        (void *)&pv_Ptr,
+                        (const void *)&pu8_Node[pt_Pointer->u32_Offset],
+                        sizeof(pv_Ptr));
+                }
+
+                if (pv_Ptr)
+                {
+                    /* Keep the offset of the target node inside its array */
+                    pv_Ptr = (void *)&getStaticArray(
+                        pt_Pointer->t_TargetType)[(uint32_t)(
+                        (uint64_t)(uintptr_t)pv_Ptr -
+                        pt_Header->ru64_ArrayAddresses[
+                            pt_Pointer->t_TargetType])];
+
+                    memcpy(
+                        (void *)&pu8_Node[pt_Pointer->u32_Offset],
+                        (const void *)&pv_Ptr,
+                        sizeof(pv_Ptr));
+                }
+            }
+
+            u32_LiveNodes++;
+        }
+    }
+
+    return u32_LiveNodes;
+}
+
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST
+
+/**
+ * @brief Get the head of the free slot list for an allocation type
+ *
+ * @param t_AllocType The type of the allocation
+ * @return `void **` Pointer to the head of the list or `NULL` if the
+ * allocation type is not supported
+ */
+static void **getFreeListHead(
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    void **ppv_Head;
+
+    switch (t_AllocType)
+    {
+        case ITC_PORT_ALLOCTYPE_ITC_ID_T:
+        {
+            ppv_Head = &gpv_ItcIdNodeFreeListHead;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
+        {
+            ppv_Head = &gpv_ItcEventNodeFreeListHead;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+        {
+            ppv_Head = &gpv_ItcStampNodeFreeListHead;
+            break;
+        }
+        default:
+        {
+            ppv_Head = NULL;
+            break;
+        }
+    }
+
+    return ppv_Head;
+}
+
+/**
+ * @brief Push a slot at the front of a free slot list
+ *
+ * The link to the next free slot is stored in the first bytes of the slot
+ * itself. If `ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS` is enabled, the
+ * rest of the slot is filled with `ITC_PORT_FREE_SLOT_PATTERN`.
+ *
+ * @param ppv_Head The head of the free slot list
+ * @param pv_Slot The slot to push
+ * @param u32_AllocSize The size of the slot
+ */
+static void pushFreeSlot(
+    void **const ppv_Head,
+    void *const pv_Slot,
+    const uint32_t u32_AllocSize
+)
+{
+#if ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS
+    memset(
+        (void *)&((uint8_t *)pv_Slot)[sizeof(void *)],
+        ITC_PORT_FREE_SLOT_PATTERN,
+        u32_AllocSize - sizeof(void *));
+#else
+    (void)u32_AllocSize;
+#endif /* ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS */
+
+    /* The slots might not be suitably aligned for storing a pointer directly */
+    memcpy(pv_Slot, (const void *)ppv_Head, sizeof(void *));
+    *ppv_Head = pv_Slot;
+}
+
+/**
+ * @brief Init the free slot list of a static array
+ *
+ * Pushes the slots in reverse order, so that allocations start from the
+ * beginning of the array
+ *
+ * @param t_AllocType The type of the allocation
+ */
+static void initFreeList(
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status;
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    void **ppv_Head = getFreeListHead(t_AllocType);
+
+    t_Status = getStaticMemory(
+        t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
+
+    if (t_Status == ITC_STATUS_SUCCESS && ppv_Head)
+    {
+        *ppv_Head = NULL;
+
+        for (uint32_t u32_I = u32_ArrayLength; u32_I > 0; u32_I--)
+        {
+            pushFreeSlot(
+                ppv_Head,
+                (void *)&pu8_Array[(u32_I - 1) * u32_AllocSize],
+                u32_AllocSize);
+        }
+    }
+}
+
+static ITC_Status_t freeListMalloc(
+    void **const ppv_Ptr,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status;
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    void **ppv_Head = getFreeListHead(t_AllocType);
+
+    *ppv_Ptr = NULL;
+
+    t_Status = getStaticMemory(
+        t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
+
+    if (t_Status == ITC_STATUS_SUCCESS && ppv_Head && *ppv_Head)
+    {
+#if ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS
+        /* Make sure the slot is inside the array and has not been modified
+         * since it was freed */
+        if (!isStaticMemorySlot(
+                *ppv_Head, pu8_Array, u32_ArrayLength, u32_AllocSize) ||
+            ((uint8_t *)*ppv_Head)[sizeof(void *)] !=
+                ITC_PORT_FREE_SLOT_PATTERN ||
+            memcmp((const void *)&((uint8_t *)*ppv_Head)[sizeof(void *)],
+                   (const void *)&((uint8_t *)*ppv_Head)[sizeof(void *) + 1],
+                   u32_AllocSize - sizeof(void *) - 1) != 0)
+        {
+            t_Status = ITC_STATUS_FAILURE;
+        }
+        else
+#endif /* ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS */
+        {
+            /* Pop the first free slot */
+            *ppv_Ptr = *ppv_Head;
+            memcpy((void *)ppv_Head, (const void *)*ppv_Ptr, sizeof(void *));
+
+#if ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS
+            /* Clear the pattern, so that freeing the slot straight away is
+             * not mistaken for a double free */
+            memset(*ppv_Ptr, 0, u32_AllocSize);
+#endif /* ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS */
+        }
+    }
+
+    return t_Status;
+}
+
+static ITC_Status_t freeListFree(
+    void *pv_Ptr,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status;
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    void **ppv_Head = getFreeListHead(t_AllocType);
+
+    if (pv_Ptr && ppv_Head)
+    {
+        t_Status = getStaticMemory(
+            t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Pushing a foreign pointer would corrupt the list */
+        if (!isStaticMemorySlot(
+                pv_Ptr, pu8_Array, u32_ArrayLength, u32_AllocSize))
+        {
+            t_Status = ITC_STATUS_INVALID_PARAM;
+        }
+#if ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS
+        /* Catch double frees */
+        else if (((uint8_t *)pv_Ptr)[sizeof(void *)] ==
+                     ITC_PORT_FREE_SLOT_PATTERN &&
+                 memcmp((const void *)&((uint8_t *)pv_Ptr)[sizeof(void *)],
+                        (const void *)&((uint8_t *)pv_Ptr)[sizeof(void *) + 1],
+                        u32_AllocSize - sizeof(void *) - 1) == 0)
+        {
+            t_Status = ITC_STATUS_INVALID_PARAM;
+        }
+#endif /* ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS */
+        else
+        {
+            /* Free the memory */
+            pushFreeSlot(ppv_Head, pv_Ptr, u32_AllocSize);
+        }
+    }
+
+    return t_Status;
+}
+
+#else /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+
+/**
+ * @brief Get the global free slot list and the calling thread's magazine for
+ * an allocation type
+ *
+ * If the global free slot lists have been rebuilt since the magazine was last
+ * used, the slots cached in it are dropped, as they are already part of the
+ * rebuilt global free slot list.
+ *
+ * @param t_AllocType The type of the allocation
+ * @param ppu64_Head (out) The head of the global free slot list
+ * @param ppt_Magazine (out) The magazine of the calling thread
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getConcurrentFreeList(
+    const ITC_Port_AllocType_t t_AllocType,
+    uint64_t **const ppu64_Head,
+    ITC_Port_Magazine_t **const ppt_Magazine
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Generation;
+
+    switch (t_AllocType)
+    {
+        case ITC_PORT_ALLOCTYPE_ITC_ID_T:
+        {
+            *ppu64_Head = &gu64_ItcIdNodeConcurrentFreeListHead;
+            *ppt_Magazine = &gt_ItcIdNodeThreadMagazine;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
+        {
+            *ppu64_Head = &gu64_ItcEventNodeConcurrentFreeListHead;
+            *ppt_Magazine = &gt_ItcEventNodeThreadMagazine;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+        {
+            *ppu64_Head = &gu64_ItcStampNodeConcurrentFreeListHead;
+            *ppt_Magazine = &gt_ItcStampNodeThreadMagazine;
+            break;
+        }
+        default:
+        {
+            t_Status = ITC_STATUS_INVALID_PARAM;
+            break;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        u32_Generation = __atomic_load_n(
+            &gu32_ItcConcurrentFreeListGeneration, __ATOMIC_ACQUIRE);
+
+        if ((*ppt_Magazine)->u32_Generation != u32_Generation)
+        {
+            (*ppt_Magazine)->u32_Count = 0;
+            (*ppt_Magazine)->u32_Generation = u32_Generation;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Pop a slot from the front of a global free slot list
+ *
+ * The index of the next free slot is stored in the first bytes of the slot
+ * itself. The slot might get popped (and written to) by another thread while
+ * its link is being read, in which case the tag of the head will have changed
+ * and the pop is retried.
+ *
+ * @param pu64_Head The head of the global free slot list
+ * @param pu8_Array The static array
+ * @param u32_AllocSize The size of one element
+ * @return `void *` The slot or `NULL` if the list is empty
+ */
+static void *popConcurrentFreeSlot(
+    uint64_t *const pu64_Head,
+    uint8_t *const pu8_Array,
+    const uint32_t u32_AllocSize
+)
+{
+    void *pv_Slot = NULL;
+    uint64_t u64_Head;
+    uint64_t u64_NewHead;
+    uint32_t u32_Next;
+    bool b_Done = false;
+
+    u64_Head = __atomic_load_n(pu64_Head, __ATOMIC_ACQUIRE);
+
+    while (!b_Done)
+    {
+        if ((uint32_t)u64_Head == ITC_PORT_CONCURRENT_FREE_LIST_END)
+        {
+            pv_Slot = NULL;
+            b_Done = true;
+        }
+        else
+        {
+            pv_Slot = (void *)&pu8_Array[
+                ((uint32_t)u64_Head - 1U) * u32_AllocSize];
+            u32_Next = __atomic_load_n((uint32_t *)pv_Slot, __ATOMIC_RELAXED);
+
+            /* Bump the tag and point the head to the next free slot */
+            u64_NewHead =
+                (((u64_Head >> ITC_PORT_CONCURRENT_FREE_LIST_TAG_SHIFT) + 1U)
+                 << ITC_PORT_CONCURRENT_FREE_LIST_TAG_SHIFT) |
+                (uint64_t)u32_Next;
+
+            /* Reloads `u64_Head` on failure */
+            b_Done = __atomic_compare_exchange_n(
+                pu64_Head,
+                &u64_Head,
+                u64_NewHead,
+                true,
+                __ATOMIC_ACQUIRE,
+                __ATOMIC_ACQUIRE);
+        }
+    }
+
+    return pv_Slot;
+}
+
+/**
+ * @brief Push a chain of slots at the front of a global free slot list
+ *
+ * The slots are linked to each other before the chain is published with a
+ * single atomic operation.
+ *
+ * @param pu64_Head The head of the global free slot list
+ * @param ppv_Slots The slots to push
+ * @param u32_SlotCount The number of slots to push. Must be at least `1`
+ * @param pu8_Array The static array
+ * @param u32_AllocSize The size of one element
+ */
+static void pushConcurrentFreeSlots(
+    uint64_t *const pu64_Head,
+    void *const *const ppv_Slots,
+    const uint32_t u32_SlotCount,
+    const uint8_t *const pu8_Array,
+    const uint32_t u32_AllocSize
+)
+{
+    uint64_t u64_Head;
+    uint64_t u64_NewHead;
+    uint32_t u32_Index;
+    bool b_Done = false;
+
+    /* Link each slot to the one after it */
+    for (uint32_t u32_I = 0; u32_I < u32_SlotCount - 1U; u32_I++)
+    {
+        u32_Index = (uint32_t)(((uintptr_t)ppv_Slots[u32_I + 1U] -
+                                (uintptr_t)pu8_Array) / u32_AllocSize) + 1U;
+        __atomic_store_n(
+            (uint32_t *)ppv_Slots[u32_I], u32_Index, __ATOMIC_RELAXED);
+    }
+
+    u32_Index = (uint32_t)(((uintptr_t)ppv_Slots[0] - (uintptr_t)pu8_Array) /
+                           u32_AllocSize) + 1U;
+    u64_Head = __atomic_load_n(pu64_Head, __ATOMIC_RELAXED);
+
+    while (!b_Done)
+    {
+        /* Link the last slot to the current first free slot */
+        __atomic_store_n(
+            (uint32_t *)ppv_Slots[u32_SlotCount - 1U],
+            (uint32_t)u64_Head,
+            __ATOMIC_RELAXED);
+
+        /* Bump the tag and point the head to the first slot of the chain */
+        u64_NewHead =
+            (((u64_Head >> ITC_PORT_CONCURRENT_FREE_LIST_TAG_SHIFT) + 1U)
+             << ITC_PORT_CONCURRENT_FREE_LIST_TAG_SHIFT) |
+            (uint64_t)u32_Index;
+
+        /* Reloads `u64_Head` on failure */
+        b_Done = __atomic_compare_exchange_n(
+            pu64_Head,
+            &u64_Head,
+            u64_NewHead,
+            true,
+            __ATOMIC_RELEASE,
+            __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * @brief Init the global free slot list of a static array
+ *
+ * Links the slots in order, so that allocations start from the beginning of
+ * the array
+ *
+ * @param t_AllocType The type of the allocation
+ */
+static void initConcurrentFreeList(
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status;
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    uint64_t *pu64_Head;
+    ITC_Port_Magazine_t *pt_Magazine;
+    uint64_t u64_Head;
+
+    t_Status = getStaticMemory(
+        t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getConcurrentFreeList(t_AllocType, &pu64_Head, &pt_Magazine);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        for (uint32_t u32_I = 0; u32_I < u32_ArrayLength; u32_I++)
+        {
+            __atomic_store_n(
+                (uint32_t *)(void *)&pu8_Array[u32_I * u32_AllocSize],
+                (u32_I + 1U < u32_ArrayLength) ?
+                    u32_I + 2U :
+                    ITC_PORT_CONCURRENT_FREE_LIST_END,
+                __ATOMIC_RELAXED);
+        }
+
+        /* Keep bumping the tag, in case a stale head is still around */
+        u64_Head = __atomic_load_n(pu64_Head, __ATOMIC_RELAXED);
+        __atomic_store_n(
+            pu64_Head,
+            (((u64_Head >> ITC_PORT_CONCURRENT_FREE_LIST_TAG_SHIFT) + 1U)
+             << ITC_PORT_CONCURRENT_FREE_LIST_TAG_SHIFT) | 1U,
+            __ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * @brief Return the free slots cached in the calling thread's magazine for an
+ * allocation type to the global free slot list
+ *
+ * @param t_AllocType The type of the allocation
+ * @param u32_SlotCount The number of slots to return. Must not be bigger than
+ * the number of slots in the magazine. The least recently freed slots are
+ * returned first
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t flushThreadMagazine(
+    const ITC_Port_AllocType_t t_AllocType,
+    const uint32_t u32_SlotCount
+)
+{
+    ITC_Status_t t_Status;
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    uint64_t *pu64_Head;
+    ITC_Port_Magazine_t *pt_Magazine;
+
+    t_Status = getStaticMemory(
+        t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getConcurrentFreeList(t_AllocType, &pu64_Head, &pt_Magazine);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && u32_SlotCount > 0)
+    {
+        /* Return the least recently freed slots and keep the rest, which are
+         * more likely to still be in the cache */
+        pushConcurrentFreeSlots(
+            pu64_Head,
+            &pt_Magazine->rpv_Slots[0],
+            u32_SlotCount,
+            pu8_Array,
+            u32_AllocSize);
+
+        pt_Magazine->u32_Count -= u32_SlotCount;
+        memmove(
+            (void *)&pt_Magazine->rpv_Slots[0],
+            (const void *)&pt_Magazine->rpv_Slots[u32_SlotCount],
+            pt_Magazine->u32_Count * sizeof(void *));
+    }
+
+    return t_Status;
+}
+
+static ITC_Status_t concurrentFreeListMalloc(
+    void **const ppv_Ptr,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status;
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    uint64_t *pu64_Head;
+    ITC_Port_Magazine_t *pt_Magazine;
+    void *pv_Slot;
+
+    *ppv_Ptr = NULL;
+
+    t_Status = getStaticMemory(
+        t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getConcurrentFreeList(t_AllocType, &pu64_Head, &pt_Magazine);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Refill an empty magazine with up to half its capacity, which leaves
+         * room for the slots freed afterwards */
+        pv_Slot = (pt_Magazine->u32_Count == 0) ?
+            popConcurrentFreeSlot(pu64_Head, pu8_Array, u32_AllocSize) :
+            NULL;
+
+        while (pv_Slot)
+        {
+            pt_Magazine->rpv_Slots[pt_Magazine->u32_Count++] = pv_Slot;
+
+            pv_Slot = (pt_Magazine->u32_Count <
+                       (ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH / 2U)) ?
+                popConcurrentFreeSlot(pu64_Head, pu8_Array, u32_AllocSize) :
+                NULL;
+        }
+
+        if (pt_Magazine->u32_Count > 0)
+        {
+            *ppv_Ptr = pt_Magazine->rpv_Slots[--pt_Magazine->u32_Count];
+        }
+    }
+
+    return t_Status;
+}
+
+static ITC_Status_t concurrentFreeListFree(
+    void *pv_Ptr,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status;
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+    uint64_t *pu64_Head;
+    ITC_Port_Magazine_t *pt_Magazine;
+
+    if (pv_Ptr)
+    {
+        t_Status = getStaticMemory(
+            t_AllocType, &pu8_Array, &u32_ArrayLength, &u32_AllocSize);
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getConcurrentFreeList(t_AllocType, &pu64_Head, &pt_Magazine);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Pushing a foreign pointer would corrupt the list */
+        if (!isStaticMemorySlot(
+                pv_Ptr, pu8_Array, u32_ArrayLength, u32_AllocSize))
+        {
+            t_Status = ITC_STATUS_INVALID_PARAM;
+        }
+        else
+        {
+            /* Make room in a full magazine by returning half of it */
+            if (pt_Magazine->u32_Count ==
+                ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH)
+            {
+                t_Status = flushThreadMagazine(
+                    t_AllocType,
+                    ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH / 2U);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* Free the memory */
+                pt_Magazine->rpv_Slots[pt_Magazine->u32_Count++] = pv_Ptr;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+#include <string.h>
+
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+#include "ITC_Id_package.h"
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+/* The port context bound to the calling thread */
+static __thread ITC_Port_Context_t *gpt_ItcThreadContext = NULL;
+
+/******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Get the pool of a port context for an allocation type
+ *
+ * @param pt_Context The context
+ * @param t_AllocType The type of the allocation
+ * @param ppt_Pool (out) The pool
+ * @param pu32_AllocSize (out) The size of one node in the pool
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getContextPool(
+    ITC_Port_Context_t *const pt_Context,
+    const ITC_Port_AllocType_t t_AllocType,
+    ITC_Port_ContextPool_t **const ppt_Pool,
+    uint32_t *const pu32_AllocSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    switch (t_AllocType)
+    {
+        case ITC_PORT_ALLOCTYPE_ITC_ID_T:
+        {
+            *ppt_Pool = &pt_Context->t_IdPool;
+            *pu32_AllocSize = sizeof(ITC_Id_t);
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
+        {
+            *ppt_Pool = &pt_Context->t_EventPool;
+            *pu32_AllocSize = sizeof(ITC_Event_t);
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+        {
+            *ppt_Pool = &pt_Context->t_StampPool;
+            *pu32_AllocSize = sizeof(ITC_Stamp_t);
+            break;
+        }
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+        case ITC_PORT_ALLOCTYPE_SCRATCH:
+        {
+            *ppt_Pool = &pt_Context->t_ScratchPool;
+            *pu32_AllocSize = sizeof(ITC_Event_t);
+            break;
+        }
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+        default:
+        {
+            t_Status = ITC_STATUS_INVALID_PARAM;
+            break;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Release all nodes of a port context pool
+ *
+ * @param pt_Pool The pool
+ */
+static void resetContextPool(
+    ITC_Port_ContextPool_t *const pt_Pool
+)
+{
+    pt_Pool->u32_Top = 0;
+    pt_Pool->pv_FreeListHead = NULL;
+}
+
+/**
+ * @brief Validate a port context pool and release all of its nodes
+ *
+ * @param pt_Pool The pool
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t initContextPool(
+    ITC_Port_ContextPool_t *const pt_Pool
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (pt_Pool->u32_Length < 1)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else if (!pt_Pool->pv_Nodes)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        resetContextPool(pt_Pool);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Allocate a node from the pool of the bound port context
+ *
+ * Reuses the most recently freed node if there is one. Otherwise,
+ * bump-allocates a node that has never been used before.
+ *
+ * @param ppv_Ptr (out) Pointer to the allocated memory
+ * @param t_AllocType The type of the allocation
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if no context is bound
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the pool is exhausted
+ */
+static ITC_Status_t contextMalloc(
+    void **const ppv_Ptr,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Port_Context_t *pt_Context = gpt_ItcThreadContext;
+    ITC_Port_ContextPool_t *pt_Pool = NULL;
+    uint32_t u32_AllocSize = 0;
+
+    *ppv_Ptr = NULL;
+
+    if (!pt_Context)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (pt_Context->pf_Malloc)
+    {
+        t_Status = pt_Context->pf_Malloc(pt_Context, ppv_Ptr, t_AllocType);
+    }
+    else
+    {
+        t_Status = getContextPool(
+            pt_Context, t_AllocType, &pt_Pool, &u32_AllocSize);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        else if (pt_Pool->pv_FreeListHead)
+        {
+            /* Pop the first free node */
+            *ppv_Ptr = pt_Pool->pv_FreeListHead;
+            /* The nodes might not be suitably aligned for storing a pointer
+             * directly */
+            memcpy(
+                (void *)&pt_Pool->pv_FreeListHead,
+                (const void *)*ppv_Ptr,
+                sizeof(void *));
+        }
+        else if (pt_Pool->u32_Top < pt_Pool->u32_Length)
+        {
+            *ppv_Ptr = (void *)&((uint8_t *)pt_Pool->pv_Nodes)[
+                pt_Pool->u32_Top * u32_AllocSize];
+            pt_Pool->u32_Top++;
+        }
+        else
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deallocate a node into the pool of the bound port context
+ *
+ * @param pv_Ptr The node to deallocate
+ * @param t_AllocType The type of the allocation
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if no context is bound or the node was
+ * not allocated from the pool
+ */
+static ITC_Status_t contextFree(
+    void *pv_Ptr,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Port_Context_t *pt_Context = gpt_ItcThreadContext;
+    ITC_Port_ContextPool_t *pt_Pool = NULL;
+    uint32_t u32_AllocSize = 0;
+
+    if (!pt_Context)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (pt_Context->pf_Free)
+    {
+        t_Status = pt_Context->pf_Free(pt_Context, pv_Ptr, t_AllocType);
+    }
+    else if (!pv_Ptr)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = getContextPool(
+            pt_Context, t_AllocType, &pt_Pool, &u32_AllocSize);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Pushing a foreign pointer would corrupt the free list. Only
+             * nodes below the top of the pool can have been allocated */
+            /* clang-format off */
+            if (pt_Pool->u32_Top < 1 ||
+                (uintptr_t)pv_Ptr < (uintptr_t)pt_Pool->pv_Nodes ||
+                (uintptr_t)pv_Ptr > (uintptr_t)&((uint8_t *)pt_Pool->pv_Nodes)[(pt_Pool->u32_Top - 1) * u32_AllocSize] ||
+                ((uintptr_t)pv_Ptr - (uintptr_t)pt_Pool->pv_Nodes) % u32_AllocSize != 0)
+            /* clang-format on */
+            {
+                t_Status = ITC_STATUS_INVALID_PARAM;
+            }
+            else
+            {
+                memcpy(
+                    pv_Ptr,
+                    (const void *)&pt_Pool->pv_FreeListHead,
+                    sizeof(void *));
+                pt_Pool->pv_FreeListHead = pv_Ptr;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE != ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/* The number of nodes currently allocated from the scratch arena */
+static uint32_t gu32_ItcScratchArenaTop = 0;
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE != ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
+
+/* The first chunk of the scratch arena */
+static ITC_Port_ScratchChunk_t *gpt_ItcScratchArenaHead = NULL;
+
+/* The chunk from which the next scratch node will be allocated */
+static ITC_Port_ScratchChunk_t *gpt_ItcScratchArenaCurrentChunk = NULL;
+
+/* The position in the arena of the first node of
+ * `gpt_ItcScratchArenaCurrentChunk` */
+static uint32_t gu32_ItcScratchArenaCurrentChunkBase = 0;
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
+
+/******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
+
+/**
+ * @brief Get the next chunk of the scratch arena, allocating it if needed
+ *
+ * @param ppt_Chunk (in) The pointer to the link to the next chunk.
+ * (out) The next chunk
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getNextScratchChunk(
+    ITC_Port_ScratchChunk_t **const ppt_Chunk
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!(*ppt_Chunk))
+    {
+        *ppt_Chunk = malloc(sizeof(ITC_Port_ScratchChunk_t));
+
+        if (*ppt_Chunk)
+        {
+            (*ppt_Chunk)->pt_Next = NULL;
+        }
+        else
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Find the chunk containing a position in the scratch arena
+ *
+ * Rewinds `gpt_ItcScratchArenaCurrentChunk` to the chunk, from which the node
+ * at position `u32_Marker` will be allocated. All chunks up to the current
+ * top of the arena are guaranteed to exist.
+ *
+ * @param u32_Marker The position in the arena
+ */
+static void seekScratchChunk(
+    const uint32_t u32_Marker
+)
+{
+    if (gpt_ItcScratchArenaCurrentChunk &&
+        u32_Marker < gu32_ItcScratchArenaCurrentChunkBase)
+    {
+        gpt_ItcScratchArenaCurrentChunk = gpt_ItcScratchArenaHead;
+        gu32_ItcScratchArenaCurrentChunkBase = 0;
+
+        while (u32_Marker > gu32_ItcScratchArenaCurrentChunkBase +
+                                ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH)
+        {
+            gpt_ItcScratchArenaCurrentChunk =
+                gpt_ItcScratchArenaCurrentChunk->pt_Next;
+            gu32_ItcScratchArenaCurrentChunkBase +=
+                ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH;
+        }
+    }
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
+
+/**
+ * @brief Get the number of nodes currently allocated from the scratch arena
+ *
+ * @return `uint32_t *` Pointer to the top of the scratch arena or `NULL` if
+ * there is no scratch arena (i.e. no port context is bound)
+ */
+static uint32_t *getScratchArenaTop(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    return (gpt_ItcThreadContext)
+        ? &gpt_ItcThreadContext->t_ScratchPool.u32_Top
+        : NULL;
+#else
+    return &gu32_ItcScratchArenaTop;
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/**
+ * @brief Bump-allocate a node from the scratch arena
+ *
+ * @param ppv_Ptr (out) Pointer to the allocated memory
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the arena is exhausted
+ */
+static ITC_Status_t scratchMalloc(
+    void **const ppv_Ptr
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    *ppv_Ptr = NULL;
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
+    if (!gpt_ItcScratchArenaCurrentChunk)
+    {
+        /* Start from the first chunk */
+        t_Status = getNextScratchChunk(&gpt_ItcScratchArenaHead);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            gpt_ItcScratchArenaCurrentChunk = gpt_ItcScratchArenaHead;
+            gu32_ItcScratchArenaCurrentChunkBase = 0;
+        }
+    }
+    else if (gu32_ItcScratchArenaTop - gu32_ItcScratchArenaCurrentChunkBase ==
+             ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH)
+    {
+        /* The current chunk is full, move to the next one */
+        t_Status = getNextScratchChunk(
+            &gpt_ItcScratchArenaCurrentChunk->pt_Next);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            gpt_ItcScratchArenaCurrentChunk =
+                gpt_ItcScratchArenaCurrentChunk->pt_Next;
+            gu32_ItcScratchArenaCurrentChunkBase +=
+                ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH;
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *ppv_Ptr = (void *)&gpt_ItcScratchArenaCurrentChunk->rt_Nodes[
+            gu32_ItcScratchArenaTop - gu32_ItcScratchArenaCurrentChunkBase];
+        gu32_ItcScratchArenaTop++;
+    }
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE != ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    if (gu32_ItcScratchArenaTop < gu32_ItcScratchNodeAllocationArrayLength)
+    {
+        *ppv_Ptr =
+            (void *)&gpt_ItcScratchNodeAllocationArray[gu32_ItcScratchArenaTop];
+        gu32_ItcScratchArenaTop++;
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* The scratch pool is always bump-allocated, even if the context has
+     * custom allocation callbacks */
+    if (!gpt_ItcThreadContext)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (gpt_ItcThreadContext->t_ScratchPool.u32_Top <
+             gpt_ItcThreadContext->t_ScratchPool.u32_Length)
+    {
+        *ppv_Ptr = (void *)&((ITC_Event_t *)gpt_ItcThreadContext
+                                 ->t_ScratchPool.pv_Nodes)[
+            gpt_ItcThreadContext->t_ScratchPool.u32_Top];
+        gpt_ItcThreadContext->t_ScratchPool.u32_Top++;
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#if ITC_CONFIG_ENABLE_STATS
+
+/******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Get the allocation statistics for an allocation type
+ *
+ * @param t_AllocType The type of the allocation
+ * @return `ITC_Port_AllocStats_t *` The allocation statistics or `NULL` if
+ * the allocation type is not supported
+ */
+static ITC_Port_AllocStats_t *getAllocStats(
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Port_AllocStats_t *pt_AllocStats;
+
+    switch (t_AllocType)
+    {
+        case ITC_PORT_ALLOCTYPE_ITC_ID_T:
+        {
+            pt_AllocStats = &gt_ItcStats.t_Id;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
+        {
+            pt_AllocStats = &gt_ItcStats.t_Event;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+        {
+            pt_AllocStats = &gt_ItcStats.t_Stamp;
+            break;
+        }
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+        case ITC_PORT_ALLOCTYPE_SCRATCH:
+        {
+            pt_AllocStats = &gt_ItcStats.t_Scratch;
+            break;
+        }
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+        default:
+        {
+            pt_AllocStats = NULL;
+            break;
+        }
+    }
+
+    return pt_AllocStats;
+}
+
+/**
+ * @brief Update the allocation statistics after an allocation
+ *
+ * @param t_AllocType The type of the allocation
+ * @param t_Status The status of the allocation
+ */
+static void statsRecordAllocation(
+    const ITC_Port_AllocType_t t_AllocType,
+    const ITC_Status_t t_Status
+)
+{
+    ITC_Port_AllocStats_t *pt_AllocStats = getAllocStats(t_AllocType);
+
+    if (pt_AllocStats && t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_AllocStats->u32_Allocations++;
+        pt_AllocStats->u32_Live++;
+
+        if (pt_AllocStats->u32_Live > pt_AllocStats->u32_Peak)
+        {
+            pt_AllocStats->u32_Peak = pt_AllocStats->u32_Live;
+        }
+
+        gu32_ItcStatsAllocationCount++;
+    }
+    else if (pt_AllocStats)
+    {
+        pt_AllocStats->u32_FailedAllocations++;
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+}
+
+/**
+ * @brief Update the allocation statistics after a number of nodes have been
+ * freed
+ *
+ * @param t_AllocType The type of the allocation
+ * @param u32_NodeCount The number of freed nodes
+ */
+static void statsRecordFree(
+    const ITC_Port_AllocType_t t_AllocType,
+    const uint32_t u32_NodeCount
+)
+{
+    ITC_Port_AllocStats_t *pt_AllocStats = getAllocStats(t_AllocType);
+
+    if (pt_AllocStats)
+    {
+        pt_AllocStats->u32_Frees += u32_NodeCount;
+        pt_AllocStats->u32_Live -= u32_NodeCount;
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Init port
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_init(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+
+    if (!gpt_ItcIdNodeAllocationArray ||
+        !gpt_ItcEventNodeAllocationArray ||
+        !gpt_ItcStampNodeAllocationArray)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (
+        gu32_ItcIdNodeAllocationArrayLength < 1 ||
+        gu32_ItcEventNodeAllocationArrayLength < 1 ||
+        gu32_ItcStampNodeAllocationArrayLength < 1)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    else if (!gpt_ItcScratchNodeAllocationArray)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (gu32_ItcScratchNodeAllocationArrayLength < 1)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+    else
+    {
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+        /* Release any leftover scratch nodes */
+        gu32_ItcScratchArenaTop = 0;
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+        memset(
+            (void *)&gpt_ItcIdNodeAllocationArray[0],
+            ITC_PORT_FREE_SLOT_PATTERN,
+            gu32_ItcIdNodeAllocationArrayLength * sizeof(ITC_Id_t));
+        memset(
+            (void *)&gpt_ItcEventNodeAllocationArray[0],
+            ITC_PORT_FREE_SLOT_PATTERN,
+            gu32_ItcEventNodeAllocationArrayLength * sizeof(ITC_Event_t));
+        memset(
+            (void *)&gpt_ItcStampNodeAllocationArray[0],
+            ITC_PORT_FREE_SLOT_PATTERN,
+            gu32_ItcStampNodeAllocationArrayLength * sizeof(ITC_Stamp_t));
+        gu32_ItcIdNodeFreeSlotHint = 0;
+        gu32_ItcEventNodeFreeSlotHint = 0;
+        gu32_ItcStampNodeFreeSlotHint = 0;
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST
+        initFreeList(ITC_PORT_ALLOCTYPE_ITC_ID_T);
+        initFreeList(ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+        initFreeList(ITC_PORT_ALLOCTYPE_ITC_STAMP_T);
+#else
+        initConcurrentFreeList(ITC_PORT_ALLOCTYPE_ITC_ID_T);
+        initConcurrentFreeList(ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+        initConcurrentFreeList(ITC_PORT_ALLOCTYPE_ITC_STAMP_T);
+
+        /* Drop the slots cached by all threads */
+        (void)__atomic_add_fetch(
+            &gu32_ItcConcurrentFreeListGeneration, 1U, __ATOMIC_RELEASE);
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_STATS
+        /* All nodes have been released. Start over */
+        memset((void *)&gt_ItcStats, 0, sizeof(gt_ItcStats));
+#endif /* ITC_CONFIG_ENABLE_STATS */
+    }
+
+    return t_Status;
+#else
+    /* Always succeeds */
+    return ITC_STATUS_SUCCESS;
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+}
+
+/******************************************************************************
+ * Fini port
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_fini(void)
+{
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA && \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
+    ITC_Port_ScratchChunk_t *pt_Chunk;
+
+    /* Free all scratch arena chunks */
+    while (gpt_ItcScratchArenaHead)
+    {
+        pt_Chunk = gpt_ItcScratchArenaHead;
+        gpt_ItcScratchArenaHead = pt_Chunk->pt_Next;
+        free(pt_Chunk);
+    }
+
+#if ITC_CONFIG_ENABLE_STATS
+    statsRecordFree(ITC_PORT_ALLOCTYPE_SCRATCH, gu32_ItcScratchArenaTop);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    gpt_ItcScratchArenaCurrentChunk = NULL;
+    gu32_ItcScratchArenaCurrentChunkBase = 0;
+    gu32_ItcScratchArenaTop = 0;
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA && ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
+
+    /* Always succeeds */
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Allocate memory
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_malloc(
+    void **ppv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    if (ppv_Ptr && t_AllocType == ITC_PORT_ALLOCTYPE_SCRATCH)
+    {
+        t_Status = scratchMalloc(ppv_Ptr);
+    }
+    else
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+    if (ppv_Ptr)
+    {
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+        *ppv_Ptr = staticMalloc(t_AllocType);
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST
+        t_Status = freeListMalloc(ppv_Ptr, t_AllocType);
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+        t_Status = concurrentFreeListMalloc(ppv_Ptr, t_AllocType);
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        t_Status = contextMalloc(ppv_Ptr, t_AllocType);
+#else
+        switch (t_AllocType)
+        {
+            case ITC_PORT_ALLOCTYPE_ITC_ID_T:
+                {
+                    *ppv_Ptr = malloc(sizeof(ITC_Id_t));
+                    break;
+                }
+            case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
+                {
+                    *ppv_Ptr = malloc(sizeof(ITC_Event_t));
+                    break;
+                }
+            case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+                {
+                    *ppv_Ptr = malloc(sizeof(ITC_Stamp_t));
+                    break;
+                }
+            default:
+                {
+                    *ppv_Ptr = NULL;
+                    t_Status = ITC_STATUS_INVALID_PARAM;
+                    break;
+                }
+        }
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+        if (!(*ppv_Ptr) && t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+#if ITC_CONFIG_ENABLE_STATS
+    if (ppv_Ptr)
+    {
+        statsRecordAllocation(t_AllocType, t_Status);
+    }
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Deallocate memory
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_free(
     void *pv_Ptr,
     ITC_Port_AllocType_t t_AllocType
 )
 {
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
-    return staticFree(pv_Ptr, t_AllocType);
-#else
-    free(pv_Ptr);
-    /* Always suceeds */
-    return ITC_STATUS_SUCCESS;
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+    ITC_Status_t t_Status;
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    if (t_AllocType == ITC_PORT_ALLOCTYPE_SCRATCH)
+    {
+        /* Scratch nodes are only released by `ITC_Port_arenaReset` */
+        t_Status = (pv_Ptr) ? ITC_STATUS_SUCCESS : ITC_STATUS_INVALID_PARAM;
+    }
+    else
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+    {
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+        t_Status = staticFree(pv_Ptr, t_AllocType);
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST
+        t_Status = freeListFree(pv_Ptr, t_AllocType);
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+        t_Status = concurrentFreeListFree(pv_Ptr, t_AllocType);
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        t_Status = contextFree(pv_Ptr, t_AllocType);
+#else
+        free(pv_Ptr);
+        /* Always suceeds */
+        t_Status = ITC_STATUS_SUCCESS;
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_STATS
+        if (pv_Ptr && t_Status == ITC_STATUS_SUCCESS)
+        {
+            statsRecordFree(t_AllocType, 1);
+        }
+#endif /* ITC_CONFIG_ENABLE_STATS */
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+
+/******************************************************************************
+ * Compact the static node allocation arrays
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_compact(void)
+{
+    ITC_Status_t t_Status; /* The current status */
+    uint8_t *pu8_Array = NULL;
+    uint32_t u32_ArrayLength;
+    uint32_t u32_AllocSize;
+
+    /* The Stamps must be scanned to find the roots that can be moved */
+    t_Status = getStaticMemory(
+        ITC_PORT_ALLOCTYPE_ITC_STAMP_T,
+        &pu8_Array,
+        &u32_ArrayLength,
+        &u32_AllocSize);
+
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The cached leaves might be moved. Forget them instead of tracking
+         * them down. The next event will simply find them again */
+        for (uint32_t u32_I = 0; u32_I < u32_ArrayLength; u32_I++)
+        {
+            if (!isStaticMemorySlotFree(
+                    &pu8_Array[u32_I * u32_AllocSize], u32_AllocSize))
+            {
+                gpt_ItcStampNodeAllocationArray[u32_I].pt_InflationLeaf = NULL;
+            }
+        }
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = compactStaticArray(ITC_PORT_ALLOCTYPE_ITC_ID_T);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = compactStaticArray(ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the size of a snapshot of the static node allocation arrays
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_getSnapshotSize(
+    uint32_t *pu32_Size
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (pu32_Size)
+    {
+        t_Status = getSnapshotHeader(&gt_ItcSnapshotHeader, pu32_Size);
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Take a snapshot of the static node allocation arrays
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_snapshot(
+    uint8_t *pu8_Buffer,
+    uint32_t *pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    uint32_t u32_SnapshotSize;
+    uint32_t u32_Offset = sizeof(gt_ItcSnapshotHeader);
+    uint32_t u32_ArraySize;
+
+    if (!pu8_Buffer || !pu32_BufferSize)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = getSnapshotHeader(&gt_ItcSnapshotHeader, &u32_SnapshotSize);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && *pu32_BufferSize < u32_SnapshotSize)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        memcpy(
+            (void *)pu8_Buffer,
+            (const void *)&gt_ItcSnapshotHeader,
+            sizeof(gt_ItcSnapshotHeader));
+
+        /* The arrays are copied as they are, free slots included, so that the
+         * nodes keep their indexes when restored */
+        for (uint32_t u32_I = 0; u32_I < ITC_PORT_SNAPSHOT_ARRAY_COUNT; u32_I++)
+        {
+            u32_ArraySize = gt_ItcSnapshotHeader.ru32_ArrayLengths[u32_I] *
+                            gt_ItcSnapshotHeader.ru32_NodeSizes[u32_I];
+
+            memcpy(
+                (void *)&pu8_Buffer[u32_Offset],
+                (const void *)getStaticArray(grt_ItcSnapshotAllocTypes[u32_I]),
+                u32_ArraySize);
+
+            u32_Offset += u32_ArraySize;
+        }
+
+        *pu32_BufferSize = u32_SnapshotSize;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Restore a snapshot of the static node allocation arrays
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_restore(
+    const uint8_t *pu8_Buffer,
+    uint32_t u32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Port_SnapshotHeader_t *pt_Header = &gt_ItcSnapshotHeader;
+    uint32_t u32_LiveNodes;
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_AllocStats_t *pt_AllocStats;
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    if (!pu8_Buffer || u32_BufferSize < sizeof(gt_ItcSnapshotHeader))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        /* The buffer might not be suitably aligned for reading it directly */
+        memcpy(
+            (void *)&gt_ItcSnapshotHeader,
+            (const void *)pu8_Buffer,
+            sizeof(gt_ItcSnapshotHeader));
+
+        t_Status = validateSnapshotHeader(pt_Header, u32_BufferSize);
+    }
+
+    /* Make sure every node can be rebased before overwriting anything */
+    for (uint32_t u32_I = 0;
+         u32_I < ITC_PORT_SNAPSHOT_ARRAY_COUNT && t_Status == ITC_STATUS_SUCCESS;
+         u32_I++)
+    {
+        t_Status = validateSnapshotArray(
+            pt_Header, &pu8_Buffer[sizeof(*pt_Header)], u32_I);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_ENABLE_STATS
+        /* The nodes have been replaced. Start over */
+        memset((void *)&gt_ItcStats, 0, sizeof(gt_ItcStats));
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+        for (uint32_t u32_I = 0; u32_I < ITC_PORT_SNAPSHOT_ARRAY_COUNT; u32_I++)
+        {
+            u32_LiveNodes = restoreStaticArray(
+                pt_Header, &pu8_Buffer[sizeof(*pt_Header)], u32_I);
+
+#if ITC_CONFIG_ENABLE_STATS
+            pt_AllocStats = getAllocStats(grt_ItcSnapshotAllocTypes[u32_I]);
+
+            if (pt_AllocStats)
+            {
+                pt_AllocStats->u32_Live = u32_LiveNodes;
+                pt_AllocStats->u32_Peak = u32_LiveNodes;
+            }
+#else
+            (void)u32_LiveNodes;
+#endif /* ITC_CONFIG_ENABLE_STATS */
+        }
+
+        gu32_ItcIdNodeFreeSlotHint = 0;
+        gu32_ItcEventNodeFreeSlotHint = 0;
+        gu32_ItcStampNodeFreeSlotHint = 0;
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+        /* Release any leftover scratch nodes */
+        gu32_ItcScratchArenaTop = 0;
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+        /* The interned IDs have been replaced. The restored ones can still be
+         * released normally, but are no longer shared with new IDs */
+        ITC_Id_forgetInternedIds();
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+
+/******************************************************************************
+ * Return the free slots cached by the calling thread
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_flushThreadCache(void)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Port_AllocType_t rt_AllocTypes[] =
+    {
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+        ITC_PORT_ALLOCTYPE_ITC_STAMP_T,
+    };
+    uint64_t *pu64_Head;
+    ITC_Port_Magazine_t *pt_Magazine;
+
+    for (uint32_t u32_I = 0;
+         u32_I < sizeof(rt_AllocTypes) / sizeof(rt_AllocTypes[0]) &&
+         t_Status == ITC_STATUS_SUCCESS;
+         u32_I++)
+    {
+        t_Status = getConcurrentFreeList(
+            rt_AllocTypes[u32_I], &pu64_Head, &pt_Magazine);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = flushThreadMagazine(
+                rt_AllocTypes[u32_I], pt_Magazine->u32_Count);
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/******************************************************************************
+ * Init a port context
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_initContext(
+    ITC_Port_Context_t *pt_Context
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    /* The callbacks must either both be set or both be unset */
+    if (!pt_Context || (!pt_Context->pf_Malloc != !pt_Context->pf_Free))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    /* The node pools are not needed if the context has custom callbacks */
+    else if (!pt_Context->pf_Malloc)
+    {
+        t_Status = initContextPool(&pt_Context->t_IdPool);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = initContextPool(&pt_Context->t_EventPool);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = initContextPool(&pt_Context->t_StampPool);
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /* The scratch pool is always needed */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = initContextPool(&pt_Context->t_ScratchPool);
+    }
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Release all nodes allocated from the pools of a port context
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_resetContext(
+    ITC_Port_Context_t *pt_Context
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (pt_Context)
+    {
+        resetContextPool(&pt_Context->t_IdPool);
+        resetContextPool(&pt_Context->t_EventPool);
+        resetContextPool(&pt_Context->t_StampPool);
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+        resetContextPool(&pt_Context->t_ScratchPool);
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+        /* The interned IDs allocated from the context are gone */
+        ITC_Id_forgetInternedIds();
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Bind a port context to the calling thread
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_setContext(
+    ITC_Port_Context_t *pt_Context
+)
+{
+    gpt_ItcThreadContext = pt_Context;
+
+    /* Always succeeds */
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Get the port context bound to the calling thread
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_getContext(
+    ITC_Port_Context_t **ppt_Context
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (ppt_Context)
+    {
+        *ppt_Context = gpt_ItcThreadContext;
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+
+/******************************************************************************
+ * Begin using the scratch arena
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_arenaBegin(
+    uint32_t *pu32_Marker
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    const uint32_t *pu32_Top = getScratchArenaTop();
+
+    if (pu32_Marker && pu32_Top)
+    {
+        *pu32_Marker = *pu32_Top;
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Reset the scratch arena
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_arenaReset(
+    uint32_t u32_Marker
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    uint32_t *pu32_Top = getScratchArenaTop();
+
+    /* The marker must not point past the current top of the arena */
+    if (pu32_Top && u32_Marker <= *pu32_Top)
+    {
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
+        seekScratchChunk(u32_Marker);
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
+
+#if ITC_CONFIG_ENABLE_STATS
+        statsRecordFree(
+            ITC_PORT_ALLOCTYPE_SCRATCH, *pu32_Top - u32_Marker);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+        *pu32_Top = u32_Marker;
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE != ITC_MEMORY_ALLOCATION_TYPE_CUSTOM */
+
+#if ITC_CONFIG_ENABLE_STATS
+
+/******************************************************************************
+ * Get the statistics kept by libitc
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_getStats(
+    ITC_Port_Stats_t *pt_Stats
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+
+    if (pt_Stats)
+    {
+        *pt_Stats = gt_ItcStats;
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Reset the statistics kept by libitc
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_resetStats(void)
+{
+    uint32_t u32_I;
+
+    resetAllocStats(&gt_ItcStats.t_Id);
+    resetAllocStats(&gt_ItcStats.t_Event);
+    resetAllocStats(&gt_ItcStats.t_Stamp);
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    resetAllocStats(&gt_ItcStats.t_Scratch);
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+    for (u32_I = 0; u32_I < ITC_PORT_OPERATION_COUNT; u32_I++)
+    {
+        gt_ItcStats.rt_Operations[u32_I].u32_Calls = 0;
+        gt_ItcStats.rt_Operations[u32_I].u32_FailedCalls = 0;
+        gt_ItcStats.rt_Operations[u32_I].u32_NodesAllocated = 0;
+    }
+
+    /* Always succeeds */
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Begin tracking the statistics of an operation
+ ******************************************************************************/
+
+uint32_t ITC_Port_statsBeginOperation(void)
+{
+    return gu32_ItcStatsAllocationCount;
+}
+
+/******************************************************************************
+ * End tracking the statistics of an operation
+ ******************************************************************************/
+
+void ITC_Port_statsEndOperation(
+    const ITC_Port_Operation_t t_Operation,
+    const uint32_t u32_Marker,
+    const ITC_Status_t t_Status
+)
+{
+    ITC_Port_OperationStats_t *pt_OperationStats;
+
+    if (t_Operation < ITC_PORT_OPERATION_COUNT)
+    {
+        pt_OperationStats = &gt_ItcStats.rt_Operations[t_Operation];
+
+        pt_OperationStats->u32_Calls++;
+        pt_OperationStats->u32_NodesAllocated +=
+            gu32_ItcStatsAllocationCount - u32_Marker;
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            pt_OperationStats->u32_FailedCalls++;
+        }
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+#if ITC_CONFIG_ENABLE_TRACING
+#include "ITC_Port.h"
+#include "ITC_Port_package.h"
+
+#include <stddef.h>
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+/* The registered tracing hooks */
+static ITC_Port_TraceHooks_t gt_ItcTraceHooks = { NULL, NULL, NULL };
+
+/******************************************************************************
+ * Register the tracing hooks
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_setTraceHooks(
+    const ITC_Port_TraceHooks_t *const pt_Hooks
+)
+{
+    if (pt_Hooks)
+    {
+        gt_ItcTraceHooks = *pt_Hooks;
+    }
+    else
+    {
+        gt_ItcTraceHooks.pf_Begin = NULL;
+        gt_ItcTraceHooks.pf_End = NULL;
+        gt_ItcTraceHooks.pv_UserData = NULL;
+    }
+
+    /* Always succeeds */
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Check whether an end hook is registered
+ ******************************************************************************/
+
+bool ITC_Port_isTracing(void)
+{
+    return gt_ItcTraceHooks.pf_End != NULL;
+}
+
+/******************************************************************************
+ * Call the begin hook of a phase
+ ******************************************************************************/
+
+void ITC_Port_traceBegin(
+    const ITC_Port_TracePhase_t t_Phase
+)
+{
+    if (gt_ItcTraceHooks.pf_Begin)
+    {
+        gt_ItcTraceHooks.pf_Begin(gt_ItcTraceHooks.pv_UserData, t_Phase);
+    }
+}
+
+/******************************************************************************
+ * Call the end hook of a phase
+ ******************************************************************************/
+
+void ITC_Port_traceEnd(
+    const ITC_Port_TracePhase_t t_Phase,
+    const uint32_t u32_TreeSize
+)
+{
+    if (gt_ItcTraceHooks.pf_End)
+    {
+        gt_ItcTraceHooks.pf_End(
+            gt_ItcTraceHooks.pv_UserData, t_Phase, u32_TreeSize);
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+#include "ITC_Port.h"
+#include "ITC_Port_package.h"
+
+#include <stddef.h>
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+/* The reservation bound to the calling thread */
+static __thread ITC_Port_Reservation_t *gpt_ItcThreadReservation = NULL;
+
+/******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Get the pool of a reservation holding a node type
+ *
+ * @param pt_Reservation The reservation
+ * @param t_AllocType The type of the nodes
+ * @return `ITC_Port_ReservationPool_t *` The pool, or `NULL` if nodes of the
+ * type are not reserved
+ */
+static ITC_Port_ReservationPool_t *getReservationPool(
+    ITC_Port_Reservation_t *const pt_Reservation,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Port_ReservationPool_t *pt_Pool;
+
+    switch (t_AllocType)
+    {
+        case ITC_PORT_ALLOCTYPE_ITC_ID_T:
+        {
+            pt_Pool = &pt_Reservation->t_IdPool;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
+        {
+            pt_Pool = &pt_Reservation->t_EventPool;
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+        {
+            pt_Pool = &pt_Reservation->t_StampPool;
+            break;
+        }
+        default:
+        {
+            /* E.g. scratch nodes */
+            pt_Pool = NULL;
+            break;
+        }
+    }
+
+    return pt_Pool;
+}
+
+/**
+ * @brief Make sure a reservation pool holds at least a number of nodes
+ *
+ * @note On failure, the pool is left unmodified
+ * @param pt_Pool The pool
+ * @param u32_Count The number of nodes
+ * @param t_AllocType The type of the nodes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the pool cannot hold the
+ * nodes
+ */
+static ITC_Status_t fillReservationPool(
+    ITC_Port_ReservationPool_t *const pt_Pool,
+    const uint32_t u32_Count,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (u32_Count > pt_Pool->u32_Capacity)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else if (u32_Count > pt_Pool->u32_Count)
+    {
+        /* Allocate all missing nodes at once */
+        t_Status = ITC_Port_mallocBatch(
+            &pt_Pool->ppv_Nodes[pt_Pool->u32_Count],
+            u32_Count - pt_Pool->u32_Count,
+            t_AllocType);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            pt_Pool->u32_Count = u32_Count;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Shrink a reservation pool back to a number of nodes, deallocating
+ * the rest
+ *
+ * @param pt_Pool The pool
+ * @param u32_Count The number of nodes to keep
+ * @param t_AllocType The type of the nodes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t drainReservationPool(
+    ITC_Port_ReservationPool_t *const pt_Pool,
+    const uint32_t u32_Count,
+    const ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (u32_Count < pt_Pool->u32_Count)
+    {
+        t_Status = ITC_Port_freeBatch(
+            &pt_Pool->ppv_Nodes[u32_Count],
+            pt_Pool->u32_Count - u32_Count,
+            t_AllocType);
+
+        /* The nodes are gone even if deallocating some of them failed */
+        pt_Pool->u32_Count = u32_Count;
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE != ITC_MEMORY_ALLOCATION_TYPE_CUSTOM
+
+/******************************************************************************
+ * Allocate a batch of nodes
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_mallocBatch(
+    void **ppv_Ptrs,
+    uint32_t u32_Count,
+    ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Allocated = 0;
+
+    if (!ppv_Ptrs && u32_Count)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Allocated < u32_Count)
+    {
+        t_Status = ITC_Port_malloc(&ppv_Ptrs[u32_Allocated], t_AllocType);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            u32_Allocated++;
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS && u32_Allocated)
+    {
+        /* Allocate all nodes or none of them.
+         * Ignore return status. There is nothing else to do if the free
+         * fails. Also it is more important to convey why the allocation
+         * failed */
+        (void)ITC_Port_freeBatch(ppv_Ptrs, u32_Allocated, t_AllocType);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Deallocate a batch of nodes
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_freeBatch(
+    void *const *ppv_Ptrs,
+    uint32_t u32_Count,
+    ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus; /* The last free status */
+
+    if (!ppv_Ptrs && u32_Count)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Keep trying to free the nodes even if some frees fail */
+    for (uint32_t u32_I = 0; ppv_Ptrs && u32_I < u32_Count; u32_I++)
+    {
+        t_FreeStatus = ITC_Port_free(ppv_Ptrs[u32_I], t_AllocType);
+
+        if (t_FreeStatus != ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+    }
+
+    return t_Status;
 }
+
 #endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE != ITC_MEMORY_ALLOCATION_TYPE_CUSTOM */
+
+/******************************************************************************
+ * Init an empty reservation
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_initReservation(
+    ITC_Port_Reservation_t *pt_Reservation
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Reservation ||
+        (!pt_Reservation->t_IdPool.ppv_Nodes &&
+         pt_Reservation->t_IdPool.u32_Capacity) ||
+        (!pt_Reservation->t_EventPool.ppv_Nodes &&
+         pt_Reservation->t_EventPool.u32_Capacity) ||
+        (!pt_Reservation->t_StampPool.ppv_Nodes &&
+         pt_Reservation->t_StampPool.u32_Capacity))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        pt_Reservation->t_IdPool.u32_Count = 0;
+        pt_Reservation->t_EventPool.u32_Count = 0;
+        pt_Reservation->t_StampPool.u32_Count = 0;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Reserve nodes
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_reserve(
+    ITC_Port_Reservation_t *pt_Reservation,
+    const ITC_Stamp_NodeCount_t *pt_NodeCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_IdCount = 0;
+    uint32_t u32_EventCount = 0;
+
+    if (!pt_Reservation || !pt_NodeCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Remember the current counts, to be able to undo the reservation */
+        u32_IdCount = pt_Reservation->t_IdPool.u32_Count;
+        u32_EventCount = pt_Reservation->t_EventPool.u32_Count;
+
+        t_Status = fillReservationPool(
+            &pt_Reservation->t_IdPool,
+            pt_NodeCount->u32_IdNodes,
+            ITC_PORT_ALLOCTYPE_ITC_ID_T);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = fillReservationPool(
+            &pt_Reservation->t_EventPool,
+            pt_NodeCount->u32_EventNodes,
+            ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = fillReservationPool(
+                &pt_Reservation->t_StampPool,
+                pt_NodeCount->u32_StampNodes,
+                ITC_PORT_ALLOCTYPE_ITC_STAMP_T);
+        }
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Deallocate the nodes reserved so far.
+             * Ignore return statuses. There is nothing else to do if the
+             * free fails. Also it is more important to convey why the
+             * reservation failed */
+            (void)drainReservationPool(
+                &pt_Reservation->t_IdPool,
+                u32_IdCount,
+                ITC_PORT_ALLOCTYPE_ITC_ID_T);
+            (void)drainReservationPool(
+                &pt_Reservation->t_EventPool,
+                u32_EventCount,
+                ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Deallocate all reserved nodes
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_releaseReservation(
+    ITC_Port_Reservation_t *pt_Reservation
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus; /* The last free status */
+
+    if (!pt_Reservation)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        /* Keep trying to free the nodes even if some frees fail */
+        t_FreeStatus = drainReservationPool(
+            &pt_Reservation->t_IdPool, 0, ITC_PORT_ALLOCTYPE_ITC_ID_T);
+
+        if (t_FreeStatus != ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+
+        t_FreeStatus = drainReservationPool(
+            &pt_Reservation->t_EventPool, 0, ITC_PORT_ALLOCTYPE_ITC_EVENT_T);
+
+        if (t_FreeStatus != ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+
+        t_FreeStatus = drainReservationPool(
+            &pt_Reservation->t_StampPool, 0, ITC_PORT_ALLOCTYPE_ITC_STAMP_T);
+
+        if (t_FreeStatus != ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Bind a reservation to the calling thread
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_setReservation(
+    ITC_Port_Reservation_t *pt_Reservation
+)
+{
+    gpt_ItcThreadReservation = pt_Reservation;
+
+    /* Always succeeds */
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Get the reservation bound to the calling thread
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_getReservation(
+    ITC_Port_Reservation_t **ppt_Reservation
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (ppt_Reservation)
+    {
+        *ppt_Reservation = gpt_ItcThreadReservation;
+    }
+    else
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Allocate a node
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_mallocNode(
+    void **ppv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Port_ReservationPool_t *pt_Pool = NULL;
+
+    if (gpt_ItcThreadReservation)
+    {
+        pt_Pool = getReservationPool(gpt_ItcThreadReservation, t_AllocType);
+    }
+
+    if (!pt_Pool)
+    {
+        t_Status = ITC_Port_malloc(ppv_Ptr, t_AllocType);
+    }
+    else if (!ppv_Ptr)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (pt_Pool->u32_Count)
+    {
+        pt_Pool->u32_Count--;
+        *ppv_Ptr = pt_Pool->ppv_Nodes[pt_Pool->u32_Count];
+    }
+    else
+    {
+        /* Never fall back to allocating the node directly */
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Deallocate a node
+ ******************************************************************************/
+
+ITC_Status_t ITC_Port_freeNode(
+    void *pv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Port_ReservationPool_t *pt_Pool = NULL;
+
+    if (gpt_ItcThreadReservation && pv_Ptr)
+    {
+        pt_Pool = getReservationPool(gpt_ItcThreadReservation, t_AllocType);
+    }
+
+    if (pt_Pool && pt_Pool->u32_Count < pt_Pool->u32_Capacity)
+    {
+        /* Keep the node for upcoming allocations */
+        pt_Pool->ppv_Nodes[pt_Pool->u32_Count] = pv_Ptr;
+        pt_Pool->u32_Count++;
+    }
+    else
+    {
+        t_Status = ITC_Port_free(pv_Ptr, t_AllocType);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
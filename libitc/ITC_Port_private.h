@@ -12,7 +12,13 @@
 
 #include "ITC_Config.h"
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+#include "ITC_Event.h"
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
 
 /******************************************************************************
  * Defines
@@ -21,6 +27,121 @@
 /* Pattern used to detect free slots in the static allocation arrays */
 #define ITC_PORT_FREE_SLOT_PATTERN                                        (0x55)
 
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+
+#include "ITC_Port.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/* The magic number at the start of a node heap snapshot (`ITCP`) */
+#define ITC_PORT_SNAPSHOT_MAGIC                                   (0x49544350U)
+
+/* The version of the node heap snapshot format */
+#define ITC_PORT_SNAPSHOT_VERSION                                           (1U)
+
+/* The configuration options that change the layout or the meaning of the
+ * nodes. A snapshot can only be restored by a build with the same options */
+#define ITC_PORT_SNAPSHOT_FEATURES                                             \
+    (((uint32_t)ITC_CONFIG_USE_64BIT_EVENT_COUNTERS << 0U) |                   \
+     ((uint32_t)ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS << 1U) |                \
+     ((uint32_t)ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION << 2U) |            \
+     ((uint32_t)ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE << 3U) |             \
+     ((uint32_t)ITC_CONFIG_ENABLE_ID_INTERNING << 4U) |                        \
+     ((uint32_t)ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE << 5U))
+
+/* The number of static allocation arrays included in a snapshot */
+#define ITC_PORT_SNAPSHOT_ARRAY_COUNT                                       (3U)
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/** The header of a node heap snapshot. Followed by the raw contents of the ID,
+ * Event and Stamp node allocation arrays, in that order */
+typedef struct
+{
+    /** Always `ITC_PORT_SNAPSHOT_MAGIC` */
+    uint32_t u32_Magic;
+    /** The version of the snapshot format */
+    uint32_t u32_Version;
+    /** The `ITC_PORT_SNAPSHOT_FEATURES` of the build that took the snapshot */
+    uint32_t u32_Features;
+    /** The size of one node of each array */
+    uint32_t ru32_NodeSizes[ITC_PORT_SNAPSHOT_ARRAY_COUNT];
+    /** The length of each array in nodes */
+    uint32_t ru32_ArrayLengths[ITC_PORT_SNAPSHOT_ARRAY_COUNT];
+    /** The address of each array when the snapshot was taken. Used to rebase
+     * the pointers stored in the nodes */
+    uint64_t ru64_ArrayAddresses[ITC_PORT_SNAPSHOT_ARRAY_COUNT];
+} ITC_Port_SnapshotHeader_t;
+
+/** A pointer field of a node */
+typedef struct
+{
+    /** The type of the node holding the field */
+    ITC_Port_AllocType_t t_NodeType;
+    /** The offset of the field inside the node */
+    uint32_t u32_Offset;
+    /** The type of the node the field points to */
+    ITC_Port_AllocType_t t_TargetType;
+} ITC_Port_NodePointer_t;
+
 #endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
 
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/* The slot index marking the end of a concurrent free slot list. The slots
+ * are indexed from `1` */
+#define ITC_PORT_CONCURRENT_FREE_LIST_END                                   (0U)
+
+/* The number of bits to shift the tag of a concurrent free slot list head */
+#define ITC_PORT_CONCURRENT_FREE_LIST_TAG_SHIFT                            (32U)
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/** A per-thread cache of free slots of a static allocation array */
+typedef struct
+{
+    /** The generation of the global free lists the slots were taken from */
+    uint32_t u32_Generation;
+    /** The number of free slots in the magazine */
+    uint32_t u32_Count;
+    /** The free slots */
+    void *rpv_Slots[ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH];
+} ITC_Port_Magazine_t;
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA && \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/** A chunk of Event nodes, used to grow the scratch arena */
+typedef struct ITC_Port_ScratchChunk_t
+{
+    /** The next chunk in the arena. `NULL` if this is the last chunk */
+    struct ITC_Port_ScratchChunk_t *pt_Next;
+    /** The Event nodes of the chunk */
+    ITC_Event_t rt_Nodes[ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH];
+} ITC_Port_ScratchChunk_t;
+
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA && ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
+
 #endif /* ITC_PORT_PRIVATE_H_ */
@@ -68,3 +68,191 @@ ITC_Status_t ITC_SerDes_Util_validateDesLibVersion(
 
     return ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION;
 }
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/******************************************************************************
+ * Initialise a string sink
+ ******************************************************************************/
+
+void ITC_SerDes_Util_initStringSink(
+    ITC_SerDes_Util_StringSink_t *const pt_Sink,
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
+)
+{
+    pt_Sink->pfn_Writer = pfn_Writer;
+    pt_Sink->pv_Context = pv_Context;
+    pt_Sink->u32_Length = 0;
+}
+
+/******************************************************************************
+ * Append text to a string sink
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_appendToStringSink(
+    ITC_SerDes_Util_StringSink_t *const pt_Sink,
+    const char *const pc_Text,
+    const uint32_t u32_Length
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    /* Make room for the text */
+    if (u32_Length > (ITC_SER_TO_STR_SINK_CHUNK_LEN - pt_Sink->u32_Length))
+    {
+        t_Status = ITC_SerDes_Util_flushStringSink(pt_Sink);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (u32_Length > ITC_SER_TO_STR_SINK_CHUNK_LEN)
+        {
+            /* Batching would not save any writer calls */
+            t_Status = pt_Sink->pfn_Writer(
+                pt_Sink->pv_Context, pc_Text, u32_Length);
+        }
+        else
+        {
+            for (uint32_t u32_I = 0; u32_I < u32_Length; u32_I++)
+            {
+                pt_Sink->rc_Chunk[pt_Sink->u32_Length] = pc_Text[u32_I];
+                pt_Sink->u32_Length++;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Hand the pending chunk of a string sink to its writer
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_flushStringSink(
+    ITC_SerDes_Util_StringSink_t *const pt_Sink
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (pt_Sink->u32_Length > 0)
+    {
+        t_Status = pt_Sink->pfn_Writer(
+            pt_Sink->pv_Context, &pt_Sink->rc_Chunk[0], pt_Sink->u32_Length);
+
+        pt_Sink->u32_Length = 0;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/******************************************************************************
+ * Write bits to a bit stream
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_writeBits(
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer,
+    const uint32_t u32_Bits,
+    const uint32_t u32_BitCount
+)
+{
+    uint32_t u32_ByteOffset;
+    uint8_t u8_BitMask;
+
+    /* Check there is space left in the buffer. Done up front, so nothing is
+     * written if the bits do not fit */
+    if ((uint64_t)pt_Writer->u32_BitOffset + u32_BitCount >
+        (uint64_t)pt_Writer->u32_BufferSize * 8U)
+    {
+        return ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    /* Write the bits, most significant bit first */
+    for (uint32_t u32_I = u32_BitCount; u32_I > 0; u32_I--)
+    {
+        u32_ByteOffset = pt_Writer->u32_BitOffset / 8U;
+        u8_BitMask = (uint8_t)(0x80U >> (pt_Writer->u32_BitOffset % 8U));
+
+        /* Clear each byte before writing its first bit, so the unused
+         * bits at the end of the stream are always 0 */
+        if (u8_BitMask == 0x80U)
+        {
+            pt_Writer->pu8_Buffer[u32_ByteOffset] = 0;
+        }
+
+        if ((u32_Bits >> (u32_I - 1U)) & 1U)
+        {
+            pt_Writer->pu8_Buffer[u32_ByteOffset] |= u8_BitMask;
+        }
+
+        pt_Writer->u32_BitOffset++;
+    }
+
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Read bits from a bit stream
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_readBits(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    uint32_t *const pu32_Bits,
+    const uint32_t u32_BitCount
+)
+{
+    uint32_t u32_Bits = 0;
+    uint8_t u8_Byte;
+
+    /* Check there are enough bits left in the buffer */
+    if ((uint64_t)pt_Reader->u32_BitOffset + u32_BitCount >
+        (uint64_t)pt_Reader->u32_BufferSize * 8U)
+    {
+        return ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    /* Read the bits, most significant bit first */
+    for (uint32_t u32_I = 0; u32_I < u32_BitCount; u32_I++)
+    {
+        u8_Byte = pt_Reader->pu8_Buffer[pt_Reader->u32_BitOffset / 8U];
+
+        u32_Bits <<= 1U;
+        u32_Bits |=
+            (uint32_t)(u8_Byte >> (7U - (pt_Reader->u32_BitOffset % 8U))) & 1U;
+
+        pt_Reader->u32_BitOffset++;
+    }
+
+    *pu32_Bits = u32_Bits;
+
+    return ITC_STATUS_SUCCESS;
+}
+
+/******************************************************************************
+ * Check all bits of a bit stream have been read
+ ******************************************************************************/
+
+bool ITC_SerDes_Util_isBitReaderAtEnd(
+    const ITC_SerDes_Util_BitReader_t *const pt_Reader
+)
+{
+    const uint32_t u32_ByteOffset = pt_Reader->u32_BitOffset / 8U;
+    const uint32_t u32_BitOffset = pt_Reader->u32_BitOffset % 8U;
+
+    /* Nothing is left */
+    if (u32_BitOffset == 0)
+    {
+        return u32_ByteOffset == pt_Reader->u32_BufferSize;
+    }
+
+    /* Only the padding of the current byte is left, and it is all 0 */
+    return (u32_ByteOffset + 1U) == pt_Reader->u32_BufferSize &&
+           (pt_Reader->pu8_Buffer[u32_ByteOffset] &
+            (0xFFU >> u32_BitOffset)) == 0;
+}
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
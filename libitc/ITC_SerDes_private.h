@@ -11,6 +11,8 @@
 #ifndef ITC_SERDES_PRIVATE_H_
 #define ITC_SERDES_PRIVATE_H_
 
+#include "ITC_Config.h"
+
 #include <stdint.h>
 
 /******************************************************************************
@@ -58,6 +60,10 @@
 #define ITC_SERDES_EVENT_HEADER_MASK                                           \
     (ITC_SERDES_EVENT_IS_PARENT_MASK | ITC_SERDES_EVENT_COUNTER_LEN_MASK)
 
+/* The header of a serialised Event delta node, which stands for the whole
+ * matching subtree of the base Event. Uses the reserved bit 5 of the header */
+#define ITC_SERDES_EVENT_DELTA_COPY_HEADER                               (0x20U)
+
 /* The minimum possible length of a serialisation/deserialsation Event buffer
  * (a leaf Event) - requires 1 `ITC_SerDes_Header_t` */
 #define ITC_SERDES_EVENT_MIN_BUFFER_LEN            (sizeof(ITC_SerDes_Header_t))
@@ -162,6 +168,71 @@
         ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_MASK,                             \
         ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_OFFSET)
 
+/* The mask of the `Stamp count` length in a serialised Stamp batch header.
+ * The rest of the header bits are reserved and must be 0 */
+#define ITC_SERDES_STAMP_BATCH_COUNT_LEN_MASK                            (0x07U)
+
+/* The minimum possible length of a serialised Stamp batch, excluding the
+ * `ITC_VERSION_MAJOR` field (an empty batch). Requires:
+ *   - 1 batch header (`ITC_SerDes_Header_t`)
+ *   - 1 byte to denote the Stamp count */
+#define ITC_SERDES_STAMP_BATCH_MIN_BUFFER_LEN                                  \
+    (sizeof(ITC_SerDes_Header_t) + sizeof(uint8_t))
+
+/* The fields of a serialised Stamp, in the order a Stamp decoder reads them */
+/* The `ITC_VERSION_MAJOR` field */
+#define ITC_SERDES_STAMP_DECODER_FIELD_VERSION                              (0U)
+/* The Stamp header */
+#define ITC_SERDES_STAMP_DECODER_FIELD_HEADER                               (1U)
+/* The length of the ID component */
+#define ITC_SERDES_STAMP_DECODER_FIELD_ID_LEN                               (2U)
+/* The ID component */
+#define ITC_SERDES_STAMP_DECODER_FIELD_ID                                   (3U)
+/* The length of the Event component */
+#define ITC_SERDES_STAMP_DECODER_FIELD_EVENT_LEN                            (4U)
+/* The Event component */
+#define ITC_SERDES_STAMP_DECODER_FIELD_EVENT                                (5U)
+/* Past the end of the serialised Stamp */
+#define ITC_SERDES_STAMP_DECODER_FIELD_END                                  (6U)
+
+/* Set in the `ITC_VERSION_MAJOR` byte of data serialised in the compact (v2)
+ * format. Lib major versions never get this high, so it cannot be confused
+ * with a real version */
+#define ITC_SERDES_COMPACT_FORMAT_FLAG                                   (0x80U)
+
+/* The code of a parent node in a compact ITC ID */
+#define ITC_SERDES_COMPACT_PARENT_ID_CODE                                (0x01U)
+/* The length (in bits) of the code of a parent node in a compact ITC ID */
+#define ITC_SERDES_COMPACT_PARENT_ID_CODE_LEN                               (1U)
+/* The code of a leaf null node in a compact ITC ID */
+#define ITC_SERDES_COMPACT_NULL_ID_CODE                                  (0x00U)
+/* The code of a leaf seed node in a compact ITC ID */
+#define ITC_SERDES_COMPACT_SEED_ID_CODE                                  (0x01U)
+/* The length (in bits) of the code of a leaf node in a compact ITC ID */
+#define ITC_SERDES_COMPACT_LEAF_ID_CODE_LEN                                 (2U)
+
+/* The length (in bits) of the `IS_PARENT` and `HAS_COUNTER` flags of a node
+ * in a compact ITC Event */
+#define ITC_SERDES_COMPACT_EVENT_FLAGS_LEN                                  (2U)
+/* The `IS_PARENT` flag of a node in a compact ITC Event */
+#define ITC_SERDES_COMPACT_EVENT_IS_PARENT_FLAG                          (0x02U)
+/* The `HAS_COUNTER` flag of a node in a compact ITC Event */
+#define ITC_SERDES_COMPACT_EVENT_HAS_COUNTER_FLAG                        (0x01U)
+
+/* The length (in bits) of a LEB128 group */
+#define ITC_SERDES_LEB128_GROUP_LEN                                         (8U)
+/* The number of value bits in a LEB128 group */
+#define ITC_SERDES_LEB128_GROUP_VALUE_LEN                                   (7U)
+/* The mask of the value bits in a LEB128 group */
+#define ITC_SERDES_LEB128_GROUP_VALUE_MASK                               (0x7FU)
+/* The continuation flag of a LEB128 group */
+#define ITC_SERDES_LEB128_CONTINUATION_FLAG                              (0x80U)
+
+/* The minimum possible length of a compact serialisation/deserialisation ID,
+ * Event or Stamp buffer, excluding the `ITC_VERSION_MAJOR` field. A leaf ID
+ * and a leaf Event with a 0 counter fit in a single byte */
+#define ITC_SERDES_COMPACT_MIN_BUFFER_LEN                       (sizeof(uint8_t))
+
 /* The minimum possible length of an ID serialisation (to string) string buffer
  * - a NULL terminated buffer. Requires 1 byte for the NULL termination. Keeping
  * the minimum length requirement to be just a NULL terminator ensures that even
@@ -183,6 +254,29 @@
  * at least be NULL terminated. */
 #define ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN                                  (1)
 
+/* The maximum length of an Event counter serialised to string - the number of
+ * decimal digits of the biggest counter value */
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+#define ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN                                (20)
+#else
+#define ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN                                (10)
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+
+/* The number of delimiters a parent ID node adds when serialised to string -
+ * an opening bracket, a comma and space between the children and a closing
+ * bracket */
+#define ITC_SER_TO_STR_ID_PARENT_DELIMITERS_LEN                              (4)
+
+/* The number of delimiters a parent Event node adds when serialised to string -
+ * an opening bracket, a comma and space after the node counter and between the
+ * children, and a closing bracket */
+#define ITC_SER_TO_STR_EVENT_PARENT_DELIMITERS_LEN                           (6)
+
+/* The number of delimiters a Stamp adds when serialised to string - the
+ * opening and closing curly brackets, and the semicolon and space between the
+ * ID and Event components */
+#define ITC_SER_TO_STR_STAMP_DELIMITERS_LEN                                  (4)
+
 /******************************************************************************
  * Types
  ******************************************************************************/
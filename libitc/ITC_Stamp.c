@@ -8,6 +8,7 @@
  *
  */
 #include "ITC_Stamp.h"
+#include "ITC_Stamp_private.h"
 #include "ITC_Config.h"
 #include "ITC_SerDes.h"
 
@@ -21,10 +22,19 @@
 #include "ITC_Event_package.h"
 #include "ITC_Id_package.h"
 #include "ITC_Port.h"
+#include "ITC_Port_package.h"
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+#include "ITC_Packed.h"
+#include "ITC_Packed_package.h"
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+#include "ITC_CausalIndex.h"
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
 
 #include <stdbool.h>
 
-#include <string.h>
 #include <stddef.h>
 
 /******************************************************************************
@@ -35,6 +45,9 @@
  * @brief Validate an existing ITC Stamp
  *
  * Should be used to validate all incoming Stamps before any processing is done.
+ * The Stamp is not modified. If ::ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+ * is enabled, its Event might still need to be normalised with
+ * ::normaliseStamp() or ::getNormalisedStamp().
  *
  * @param pt_Stamp The Stamp to validate
  * @return `ITC_Status_t` The status of the operation
@@ -46,6 +59,8 @@ static ITC_Status_t validateStamp(
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_STAMP_VALIDATE);
+
     if (!pt_Stamp)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
@@ -65,9 +80,128 @@ static ITC_Status_t validateStamp(
         t_Status = ITC_Event_validate(pt_Stamp->pt_Event);
     }
 
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_STAMP_VALIDATE,
+        (t_Status == ITC_STATUS_SUCCESS) ?
+            ITC_Event_countNodes(pt_Stamp->pt_Event) :
+            0);
+
+    return t_Status;
+}
+
+/**
+ * @brief Validate an existing ITC Stamp and check its Event can be joined in
+ * place
+ *
+ * Same as ::validateStamp() followed by ::ITC_Event_validateForJoin(), but the
+ * Event tree is only traversed once.
+ *
+ * @param pt_Stamp The Stamp to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validateStampForJoin(
+    const ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_STAMP_VALIDATE);
+
+    if (!pt_Stamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (!pt_Stamp->pt_Id || !pt_Stamp->pt_Event)
+    {
+        t_Status = ITC_STATUS_CORRUPT_STAMP;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_validate(pt_Stamp->pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_validateForJoin(pt_Stamp->pt_Event);
+    }
+
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_STAMP_VALIDATE,
+        (t_Status == ITC_STATUS_SUCCESS) ?
+            ITC_Event_countNodes(pt_Stamp->pt_Event) :
+            0);
+
+    return t_Status;
+}
+
+/**
+ * @brief Check a trusted ITC Stamp about to be joined has both of its
+ * components
+ *
+ * Used instead of ::validateStampForJoin() for Stamps the caller guarantees are
+ * valid. The ID and Event trees are not traversed.
+ *
+ * @param pt_Stamp The Stamp to check
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t checkTrustedStampForJoin(
+    const ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Stamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (!pt_Stamp->pt_Id || !pt_Stamp->pt_Event)
+    {
+        t_Status = ITC_STATUS_CORRUPT_STAMP;
+    }
+
     return t_Status;
 }
 
+/**
+ * @brief Check a trusted ITC Stamp has both of its components
+ *
+ * Used instead of ::validateStamp() for Stamps the caller guarantees are
+ * valid. The ID and Event trees are not traversed.
+ *
+ * @param pt_Stamp The Stamp to check
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t checkTrustedStamp(
+    const ITC_Stamp_t *const pt_Stamp
+)
+{
+    /* Joining accepts the same Stamps */
+    return checkTrustedStampForJoin(pt_Stamp);
+}
+
+/**
+ * @brief Forget the cached inflation leaf of a Stamp
+ *
+ * Must be called whenever the ID or Event component of the Stamp is modified
+ * by anything other than adding new events to it
+ *
+ * @param pt_Stamp The Stamp
+ */
+static void resetInflationCache(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+    pt_Stamp->pt_InflationLeaf = NULL;
+#else
+    (void)pt_Stamp;
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+}
+
 /**
  * @brief Allocate a new Stamp without Id or Event components
  *
@@ -82,7 +216,7 @@ static ITC_Status_t newStamp(
     ITC_Status_t t_Status; /* The current status */
     ITC_Stamp_t *pt_Alloc;
 
-    t_Status = ITC_Port_malloc(
+    t_Status = ITC_PORT_MALLOC(
         (void **)&pt_Alloc, ITC_PORT_ALLOCTYPE_ITC_STAMP_T);
 
     if (t_Status == ITC_STATUS_SUCCESS)
@@ -90,6 +224,9 @@ static ITC_Status_t newStamp(
         /* Initialise members */
         pt_Alloc->pt_Event = NULL;
         pt_Alloc->pt_Id = NULL;
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+        pt_Alloc->pt_InflationLeaf = NULL;
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
 
         /* Return the pointer to the allocated memory */
         *ppt_Stamp = pt_Alloc;
@@ -103,6 +240,52 @@ static ITC_Status_t newStamp(
     return t_Status;
 }
 
+/**
+ * @brief Copy the ID component of a Stamp for use by another Stamp
+ *
+ * If ::ITC_CONFIG_ENABLE_ID_INTERNING is enabled and the ID is interned, the
+ * ID is shared instead of cloned.
+ *
+ * @param pt_Id The ID. Must be valid
+ * @param ppt_Id (out) The copy of the ID. Must be released with
+ * ::ITC_Id_destroy()
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t copyStampId(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_Id
+)
+{
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    return ITC_Id_share(pt_Id, ppt_Id);
+#else
+    return ITC_Id_cloneValidated(pt_Id, ppt_Id);
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+}
+
+/**
+ * @brief Intern a new ID before it becomes the ID component of a Stamp
+ *
+ * Does nothing if ::ITC_CONFIG_ENABLE_ID_INTERNING is disabled.
+ *
+ * @param ppt_Id (in) The ID. Must be valid. (out) The interned ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t internStampId(
+    ITC_Id_t **const ppt_Id
+)
+{
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    return ITC_Id_intern(ppt_Id);
+#else
+    (void)ppt_Id;
+
+    return ITC_STATUS_SUCCESS;
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+}
+
 /**
  * @brief Allocate a new ITC Stamp and init it with ID and Event components
  *
@@ -112,9 +295,9 @@ static ITC_Status_t newStamp(
  * deallocated in case of failure.
  * @param ppt_Stamp (out) The pointer to the new Stamp
  * @param pt_Id The pointer to an existing valid ID tree to be cloned.
- * Otherwise NULL.
+ * Otherwise NULL. It is not validated again
  * @param pt_Event The pointer to an existing valid Event tree to be cloned.
- * Otherwise NULL.
+ * Otherwise NULL. It is not validated again
  * @param b_CreateNullId Allocate a NULL ID instead of a Seed ID.
  * Ignored if pt_Id != NULL
  * @param b_CloneId Whether to clone or simply assign the passed ID to the
@@ -143,7 +326,7 @@ static ITC_Status_t newStampWithIdAndEvent(
         {
             if (b_CloneId)
             {
-                t_Status = ITC_Id_clone(pt_Id, &(*ppt_Stamp)->pt_Id);
+                t_Status = copyStampId(pt_Id, &(*ppt_Stamp)->pt_Id);
             }
             else
             {
@@ -166,7 +349,8 @@ static ITC_Status_t newStampWithIdAndEvent(
         {
             if (b_CloneEvent)
             {
-                t_Status = ITC_Event_clone(pt_Event, &(*ppt_Stamp)->pt_Event);
+                t_Status = ITC_Event_cloneValidated(
+                    pt_Event, &(*ppt_Stamp)->pt_Event);
             }
             else
             {
@@ -179,6 +363,11 @@ static ITC_Status_t newStampWithIdAndEvent(
         }
     }
 
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = internStampId(&(*ppt_Stamp)->pt_Id);
+    }
+
     if (t_Status != ITC_STATUS_SUCCESS && ppt_Stamp && *ppt_Stamp)
     {
         /* If the ID wasn't cloned do not deallocate it on failure */
@@ -203,792 +392,4705 @@ static ITC_Status_t newStampWithIdAndEvent(
 }
 
 /**
- * @brief Compare two existing Stamps
+ * @brief Copy the Event component of a Stamp for use by another Stamp
  *
- * - If `*pt_Stamp1 < *pt_Stamp2`:
- *      `*pt_Result == ITC_STAMP_COMPARISON_LESS_THAN`
- * - If `*pt_Stamp1 > *pt_Stamp2`:
- *      `*pt_Result == ITC_STAMP_COMPARISON_GREATER_THAN`
- * - If `*pt_Stamp1 == *pt_Stamp2`:
- *      `*pt_Result == ITC_STAMP_COMPARISON_EQUAL`
- * - If `*pt_Stamp1 <> *pt_Stamp2`:
- *      `*pt_Result == ITC_STAMP_COMPARISON_CONCURRENT`
+ * If ::ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS is enabled, the Event tree is
+ * shared instead of cloned.
  *
- * @param pt_Stamp1 The first Stamp
- * @param pt_Stamp2 The second Stamp
- * @param pt_Result The result of the comparison
+ * @param pt_Event The Event component of the Stamp. Must be valid
+ * @param ppt_Event (out) The copy of the Event. Must be released with
+ * ::ITC_Event_destroy()
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
-static ITC_Status_t compareStamps(
-    const ITC_Stamp_t *const pt_Stamp1,
-    const ITC_Stamp_t *const pt_Stamp2,
-    ITC_Stamp_Comparison_t *const pt_Result
+static ITC_Status_t copyStampEvent(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t **const ppt_Event
+)
+{
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    return ITC_Event_share(pt_Event, ppt_Event);
+#else
+    return ITC_Event_cloneValidated(pt_Event, ppt_Event);
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+}
 
+/**
+ * @brief Join the Event components of two Stamps in place
+ *
+ * If ::ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION is enabled, the joined Event
+ * is normalised by the next operation modifying it instead.
+ *
+ * @param ppt_Event (in) The first Event. Must be valid. (out) The joined Event
+ * @param ppt_OtherEvent (in) The second Event. Must be valid. (out) NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t joinStampEvents(
+    ITC_Event_t **const ppt_Event,
+    ITC_Event_t **const ppt_OtherEvent
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    bool b_IsLeq12; /* `pt_Stamp1->pt_Event <= pt_Stamp2->pt_Event` */
-    bool b_IsLeq21; /* `pt_Stamp2->pt_Event <= pt_Stamp1->pt_Event` */
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    return ITC_Event_joinValidatedLazy(ppt_Event, ppt_OtherEvent);
+#else
+    return ITC_Event_joinValidated(ppt_Event, ppt_OtherEvent);
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+}
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        /* Check if `pt_Stamp1->pt_Event <= pt_Stamp2->pt_Event` */
-        t_Status = ITC_Event_leq(
-            pt_Stamp1->pt_Event, pt_Stamp2->pt_Event, &b_IsLeq12);
-    }
+/**
+ * @brief Make sure the Event component of a Stamp is not shared with other
+ * Stamps, so it can be modified in place
+ *
+ * Does nothing if ::ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS is disabled.
+ *
+ * @param pt_Stamp The Stamp. Must be valid
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t unshareStampEvent(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    ITC_Status_t t_Status; /* The current status */
+    const ITC_Event_t *pt_SharedEvent = pt_Stamp->pt_Event;
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        /* Check if `pt_Stamp2->pt_Event <= pt_Stamp1->pt_Event` */
-        t_Status = ITC_Event_leq(
-            pt_Stamp2->pt_Event, pt_Stamp1->pt_Event, &b_IsLeq21);
-    }
+    ITC_PORT_TRACE_BEGIN(ITC_PORT_TRACE_PHASE_STAMP_UNSHARE);
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    t_Status = ITC_Event_unshare(&pt_Stamp->pt_Event);
+
+    ITC_PORT_TRACE_END(
+        ITC_PORT_TRACE_PHASE_STAMP_UNSHARE,
+        (t_Status == ITC_STATUS_SUCCESS) ?
+            ITC_Event_countNodes(pt_Stamp->pt_Event) :
+            0);
+
+    if (pt_Stamp->pt_Event != pt_SharedEvent)
     {
-        if (b_IsLeq12)
-        {
-            /* (*pt_Stamp1->pt_Event <= *pt_Stamp2->pt_Event) &&
-             * (*pt_Stamp2->pt_Event <= *pt_Stamp1->pt_Event) */
-            if (b_IsLeq21)
-            {
-                *pt_Result = ITC_STAMP_COMPARISON_EQUAL;
-            }
-            /* (*pt_Stamp1->pt_Event <= *pt_Stamp2->pt_Event) &&
-             * (*pt_Stamp2->pt_Event >= *pt_Stamp1->pt_Event) */
-            else
-            {
-                *pt_Result = ITC_STAMP_COMPARISON_LESS_THAN;
-            }
-        }
-        else
-        {
-            /* (*pt_Stamp1->pt_Event >= *pt_Stamp2->pt_Event) &&
-             * (*pt_Stamp2->pt_Event <= *pt_Stamp1->pt_Event) */
-            if (b_IsLeq21)
-            {
-                *pt_Result = ITC_STAMP_COMPARISON_GREATER_THAN;
-            }
-            /* (*pt_Stamp1->pt_Event >= *pt_Stamp2->pt_Event) &&
-             * (*pt_Stamp2->pt_Event >= *pt_Stamp1->pt_Event) */
-            else
-            {
-                *pt_Result = ITC_STAMP_COMPARISON_CONCURRENT;
-            }
-        }
+        /* The cached leaf belongs to the shared Event tree */
+        resetInflationCache(pt_Stamp);
     }
 
     return t_Status;
+#else
+    (void)pt_Stamp;
+
+    return ITC_STATUS_SUCCESS;
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
 }
 
 /**
- * @brief Serialise an `uint32_t` in network-endian
+ * @brief Finish the normalisation of the Event of a Stamp deferred by previous
+ * joins
  *
- * @param u32_Value The value to serialise
- * @param pu8_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
+ * Must only be used by operations that modify the Stamp. Read-only operations
+ * must use ::getNormalisedStamp() instead. Does nothing if
+ * ::ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION is disabled.
+ *
+ * @param pt_Stamp The Stamp. Must be valid
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
  */
-static ITC_Status_t u32ToNetwork(
-    uint32_t u32_Value,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize
+static ITC_Status_t normaliseStamp(
+    ITC_Stamp_t *const pt_Stamp
 )
 {
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    uint32_t u32_ValueCopy = u32_Value;
-    /* The number of bytes needed to serialise the value */
-    uint32_t u32_BytesNeeded = 0;
 
-    /* Determine the bytes needed to serialise the value */
-    do
+    /* The dirty nodes always extend up to the root */
+    if (pt_Stamp->pt_Event->b_IsDirty)
     {
-        u32_ValueCopy >>= 8U;
-        u32_BytesNeeded++;
-    } while (u32_ValueCopy != 0);
+        /* Other Stamps sharing the Event tree might be reading it */
+        t_Status = unshareStampEvent(pt_Stamp);
 
-    if (u32_BytesNeeded > *pu32_BufferSize)
-    {
-        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-    }
-    else
-    {
-        /* Serialise in network-endian */
-        for (uint32_t u32_I = u32_BytesNeeded; u32_I > 0; u32_I--)
+        if (t_Status == ITC_STATUS_SUCCESS)
         {
-            pu8_Buffer[u32_I - 1] = (uint8_t)(u32_Value & 0xFFU);
-            u32_Value >>= 8U;
+            t_Status = ITC_Event_normaliseDirty(pt_Stamp->pt_Event);
         }
 
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_BytesNeeded;
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* The cached leaf might have been collapsed */
+            resetInflationCache(pt_Stamp);
+        }
     }
 
     return t_Status;
+#else
+    (void)pt_Stamp;
+
+    return ITC_STATUS_SUCCESS;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
 }
 
 /**
- * @brief Deserialise an `uint32_t` from network-endian
+ * @brief Release a Stamp returned by ::getNormalisedStamp()
  *
- * @param pu8_Buffer The buffer holding the serialised data
- * @param u32_BufferSize The size of the buffer in bytes
- * @param pu32_Value The pointer to the value
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INVALID_PARAM` if `u32_BufferSize > sizeof(uint32_t)`
+ * @param ppt_StampCopy (in) The copy of the Stamp allocated by
+ * ::getNormalisedStamp(), or NULL. (out) NULL
  */
-static ITC_Status_t u32FromNetwork(
-    const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    uint32_t *const pu32_Value
+static void releaseNormalisedStamp(
+    ITC_Stamp_t **const ppt_StampCopy
 )
 {
-    if (u32_BufferSize > sizeof(uint32_t))
+    if (*ppt_StampCopy)
     {
-        /* The buffer is to big to fit into an uint32_t.
-         * This is probably an input error */
-        return ITC_STATUS_INVALID_PARAM;
-    }
-
-    /* Init the value */
-    *pu32_Value = 0;
+        /* The ID is borrowed from the original Stamp */
+        (*ppt_StampCopy)->pt_Id = NULL;
 
-    /* Deserialise from network-endian */
-    for (uint32_t u32_I = 0; u32_I < u32_BufferSize; u32_I++)
-    {
-        *pu32_Value <<= 8U;
-        *pu32_Value |= pu8_Buffer[u32_I];
+        /* Ignore return status. There is nothing else to do if the destroy
+         * fails */
+        (void)ITC_Stamp_destroy(ppt_StampCopy);
     }
-
-    return ITC_STATUS_SUCCESS;
 }
 
 /**
- * @brief Serialise an existing ITC Stamp
+ * @brief Get a Stamp with a normalised Event for a read-only operation
  *
- * Data format:
- *  - Byte 0: The major component of the version of the `libitc` library used to
- *      serialise the data
- *  - Byte 1: The Stamp header.
- *      Contains 2 fields:
- *      - Bits 0 - 2: The length of the `ID component length` field (see below)
- *      - Bits 3 - 5: The length of the `Event component length` field
- *        (see below)
- *      - Bits 6 - 7: Reserved, always 0
- *  - Bytes 2 - 5: ID component length. Can be 1 - 4 bytes long. The length of
- *    this field is encoded in the Stamp header. Serialised in network-endian.
- *  - Bytes (3 - 6) - <ID_END> (see above): The ID tree, **without** a version
- *    field. See ::serialiseId()
- *  - Bytes <ID_END + 1> - <ID_END + 4>: Event component length. Can be 1 - 4
- *    bytes long. The length of this field is encoded in the Stamp header.
- *    Serialised in network-endian.
- *  - Bytes (<ID_END + 2> - <ID_END + 5>) - <EVENT_END> (see above): The Event
- *    tree, **without** a version field. See ::serialiseEvent()
+ * If ::ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION is enabled and the Event of
+ * the Stamp still needs to be normalised, a copy of the Stamp with a
+ * normalised clone of the Event is allocated instead. The copy borrows the ID
+ * of the Stamp. The Stamp itself is never modified.
  *
- * @param ppt_Stamp The pointer to the Stamp
- * @param pu8_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
+ * @param pt_Stamp The Stamp. Must be valid
+ * @param ppt_StampCopy (out) The allocated copy of the Stamp, or NULL. Must be
+ * released with ::releaseNormalisedStamp()
+ * @param ppt_NormalisedStamp (out) Either `pt_Stamp` or `*ppt_StampCopy`
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
  */
-static ITC_Status_t serialiseStamp(
+static ITC_Status_t getNormalisedStamp(
     const ITC_Stamp_t *const pt_Stamp,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize
+    ITC_Stamp_t **const ppt_StampCopy,
+    const ITC_Stamp_t **const ppt_NormalisedStamp
 )
 {
-    ITC_Status_t t_Status; /* The current status */
-    ITC_SerDes_Header_t t_StampHeader = 0;
-    uint32_t u32_Offset = 0; /* The current offset into the buffer */
-    uint32_t u32_ComponentLength; /* The current serialised component size*/
-    /* The serialised `u32_ComponentLength` */
-    uint8_t ru8_ComponentLength[sizeof(uint32_t)] = { 0 };
-    /* The length of `ru8_ComponentLength` */
-    uint32_t u32_ComponentLengthLength;
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    *ppt_StampCopy = NULL;
+    *ppt_NormalisedStamp = pt_Stamp;
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    if (pt_Stamp->pt_Event->b_IsDirty)
+    {
+        /* Keep the copy off the stack of the (possibly deeply nested)
+         * read-only operations */
+        t_Status = newStamp(ppt_StampCopy);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            (*ppt_StampCopy)->pt_Id = pt_Stamp->pt_Id;
+
+            t_Status = ITC_Event_cloneValidated(
+                pt_Stamp->pt_Event, &(*ppt_StampCopy)->pt_Event);
+        }
 
-    /* Add the lib version (provided by build system c args) */
-    pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Event_normaliseDirty((*ppt_StampCopy)->pt_Event);
+        }
 
-    /* Increment offset */
-    u32_Offset += ITC_VERSION_MAJOR_LEN;
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            *ppt_NormalisedStamp = *ppt_StampCopy;
+        }
+        else
+        {
+            releaseNormalisedStamp(ppt_StampCopy);
+        }
+    }
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
 
-    /* Leave space for the header */
-    u32_Offset += sizeof(ITC_SerDes_Header_t);
+    return t_Status;
+}
 
-    /* Calculate the size of the buffer */
-    u32_ComponentLength = *pu32_BufferSize - u32_Offset;
+/**
+ * @brief Compact the Event of a joined Stamp from the depth set by
+ * ::ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
+ *
+ * Does nothing if ::ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH is `0`.
+ *
+ * @param pt_Stamp The joined Stamp. Must be valid and its Event not shared
+ */
+static void compactJoinedStamp(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+#if ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_ReclaimedNodes;
 
-    /* Serialise ID component */
-    t_Status = ITC_SerDes_Util_serialiseId(
-        pt_Stamp->pt_Id,
-        &pu8_Buffer[u32_Offset],
-        &u32_ComponentLength,
-        false);
+    /* The compaction needs a normalised Event */
+    t_Status = normaliseStamp(pt_Stamp);
 
+    /* Ignore the return status. The compaction leaves the Stamp unmodified on
+     * failure, and it is more important to convey that the overall join
+     * operation was successful */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Set the size of the buffer */
-        u32_ComponentLengthLength = sizeof(ru8_ComponentLength);
-
-        /* Serialise the ID component length */
-        t_Status = u32ToNetwork(
-            u32_ComponentLength,
-            &ru8_ComponentLength[0],
-            &u32_ComponentLengthLength);
+        (void)ITC_Event_compactValidated(
+            pt_Stamp->pt_Event,
+            pt_Stamp->pt_Id,
+            ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH,
+            &u32_ReclaimedNodes);
     }
+#else
+    (void)pt_Stamp;
+#endif /* ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
+}
 
-    /* Check there is enough space left in the buffer before continuing */
-    if (t_Status == ITC_STATUS_SUCCESS &&
-        (*pu32_BufferSize <
-         (u32_Offset + u32_ComponentLengthLength + u32_ComponentLength)))
+/**
+ * @brief Map the results of the two-way Event `leq` checks of a Stamp
+ * comparison to an `ITC_Stamp_Comparison_t`
+ *
+ * @param b_IsLeq12 `Event1 <= Event2`
+ * @param b_IsLeq21 `Event2 <= Event1`
+ * @param pt_Result The result of the comparison
+ */
+static void getStampComparison(
+    const bool b_IsLeq12,
+    const bool b_IsLeq21,
+    ITC_Stamp_Comparison_t *const pt_Result
+)
+{
+    if (b_IsLeq12)
     {
-        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        /* (Event1 <= Event2) && (Event2 <= Event1) */
+        if (b_IsLeq21)
+        {
+            *pt_Result = ITC_STAMP_COMPARISON_EQUAL;
+        }
+        /* (Event1 <= Event2) && (Event2 >= Event1) */
+        else
+        {
+            *pt_Result = ITC_STAMP_COMPARISON_LESS_THAN;
+        }
     }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
+    else
     {
-        /* Move contents to free space for the ID component length */
-        memmove(
-            &pu8_Buffer[u32_Offset + u32_ComponentLengthLength],
-            &pu8_Buffer[u32_Offset],
-            u32_ComponentLength);
-
-        /* Copy the serialised ID component length */
-        memcpy(
-            &pu8_Buffer[u32_Offset],
-            &ru8_ComponentLength[0],
-            u32_ComponentLengthLength);
-
-        /* Set the `ID component length` length in the header */
-        t_StampHeader = ITC_SERDES_STAMP_SET_ID_COMPONENT_LEN_LEN(
-            t_StampHeader, u32_ComponentLengthLength);
+        /* (Event1 >= Event2) && (Event2 <= Event1) */
+        if (b_IsLeq21)
+        {
+            *pt_Result = ITC_STAMP_COMPARISON_GREATER_THAN;
+        }
+        /* (Event1 >= Event2) && (Event2 >= Event1) */
+        else
+        {
+            *pt_Result = ITC_STAMP_COMPARISON_CONCURRENT;
+        }
+    }
+}
 
-        /* Increment the offset */
-        u32_Offset += u32_ComponentLength + u32_ComponentLengthLength;
+/**
+ * @brief Compare two existing Stamps
+ *
+ * - If `*pt_Stamp1 < *pt_Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_LESS_THAN`
+ * - If `*pt_Stamp1 > *pt_Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_GREATER_THAN`
+ * - If `*pt_Stamp1 == *pt_Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_EQUAL`
+ * - If `*pt_Stamp1 <> *pt_Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_CONCURRENT`
+ *
+ * Neither Stamp is modified. See ::getNormalisedStamp().
+ *
+ * @param pt_Stamp1 The first Stamp
+ * @param pt_Stamp2 The second Stamp
+ * @param pt_Result The result of the comparison
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t compareStamps(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    ITC_Stamp_Comparison_t *const pt_Result
 
-        /* Set the size of the buffer */
-        u32_ComponentLength = *pu32_BufferSize - u32_Offset;
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp1 = NULL;
+    const ITC_Stamp_t *pt_NormalisedStamp2 = NULL;
+    ITC_Stamp_t *pt_StampCopy1 = NULL;
+    ITC_Stamp_t *pt_StampCopy2 = NULL;
+    bool b_IsLeq12; /* `pt_Stamp1->pt_Event <= pt_Stamp2->pt_Event` */
+    bool b_IsLeq21; /* `pt_Stamp2->pt_Event <= pt_Stamp1->pt_Event` */
 
-        /* Serialise Event component */
-        t_Status = ITC_SerDes_Util_serialiseEvent(
-            pt_Stamp->pt_Event,
-            &pu8_Buffer[u32_Offset],
-            &u32_ComponentLength,
-            false);
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp1, &pt_StampCopy1, &pt_NormalisedStamp1);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Set the size of the buffer */
-        u32_ComponentLengthLength = sizeof(ru8_ComponentLength);
-
-        /* Serialise the Event component length */
-        t_Status = u32ToNetwork(
-            u32_ComponentLength,
-            &ru8_ComponentLength[0],
-            &u32_ComponentLengthLength);
+        t_Status = getNormalisedStamp(
+            pt_Stamp2, &pt_StampCopy2, &pt_NormalisedStamp2);
     }
 
-    /* Check there is enough space left in the buffer before continuing */
-    if (t_Status == ITC_STATUS_SUCCESS &&
-        (*pu32_BufferSize <
-         (u32_Offset + u32_ComponentLengthLength + u32_ComponentLength)))
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        /* Check if `pt_Stamp1->pt_Event <= pt_Stamp2->pt_Event` and
+         * `pt_Stamp2->pt_Event <= pt_Stamp1->pt_Event` */
+        t_Status = ITC_Event_leqBidirectionalValidated(
+            pt_NormalisedStamp1->pt_Event,
+            pt_NormalisedStamp2->pt_Event,
+            &b_IsLeq12,
+            &b_IsLeq21);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Move contents to free space for the Event component length */
-        memmove(
-            &pu8_Buffer[u32_Offset + u32_ComponentLengthLength],
-            &pu8_Buffer[u32_Offset],
-            u32_ComponentLength);
+        getStampComparison(b_IsLeq12, b_IsLeq21, pt_Result);
+    }
 
-        /* Copy the serialised Event component length */
-        memcpy(
-            &pu8_Buffer[u32_Offset],
-            &ru8_ComponentLength[0],
-            u32_ComponentLengthLength);
+    releaseNormalisedStamp(&pt_StampCopy1);
+    releaseNormalisedStamp(&pt_StampCopy2);
 
-        /* Set the `Event component length` length in the header */
-        t_StampHeader = ITC_SERDES_STAMP_SET_EVENT_COMPONENT_LEN_LEN(
-            t_StampHeader, u32_ComponentLengthLength);
+    return t_Status;
+}
 
-        /* Increment the offset */
-        u32_Offset += u32_ComponentLength + u32_ComponentLengthLength;
+/**
+ * @brief Run a single job of an `ITC_Stamp_compareMany` call
+ *
+ * Validates and compares a contiguous range of the Stamps, so that each job
+ * writes a contiguous range of `pt_Results`.
+ *
+ * @param pv_JobContext The state shared by all jobs. Points to
+ * `ITC_Stamp_CompareManyJob_t`
+ * @param u32_Job The index of the job
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t compareManyJob(
+    void *pv_JobContext,
+    uint32_t u32_Job
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Stamp_CompareManyJob_t *pt_Job =
+        (const ITC_Stamp_CompareManyJob_t *)pv_JobContext;
+    uint32_t u32_First;
+    uint32_t u32_End;
 
-        /* Add the Stamp header */
-        pu8_Buffer[ITC_VERSION_MAJOR_LEN] = t_StampHeader;
+    if (!pt_Job || u32_Job >= pt_Job->u32_JobCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        /* Spread the Stamps as evenly as possible over the jobs */
+        u32_First = (uint32_t)(((uint64_t)pt_Job->u32_StampCount * u32_Job) /
+                               pt_Job->u32_JobCount);
+        u32_End = (uint32_t)(((uint64_t)pt_Job->u32_StampCount *
+                              (u32_Job + 1)) /
+                             pt_Job->u32_JobCount);
+
+        for (uint32_t u32_I = u32_First;
+             u32_I < u32_End && t_Status == ITC_STATUS_SUCCESS;
+             u32_I++)
+        {
+            t_Status = validateStamp(pt_Job->ppt_OtherStamps[u32_I]);
 
-        /* Return the size of the buffer */
-        *pu32_BufferSize = u32_Offset;
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = compareStamps(
+                    pt_Job->pt_Stamp,
+                    pt_Job->ppt_OtherStamps[u32_I],
+                    &pt_Job->pt_Results[u32_I]);
+            }
+        }
     }
 
     return t_Status;
 }
 
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-
 /**
- * @brief Serialise an existing ITC Stamp to ASCII string
+ * @brief Add a number of new Events to a Stamp
  *
- * @note The output buffer is always NULL-terminated
- * @param ppt_Stamp The pointer to the Stamp
- * @param pc_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes (including the NULL termination byte).
+ * @param pt_Stamp The Stamp
+ * @param t_EventCount The number of events to add
+ * @param b_IsTrusted Whether the Stamp is known to be valid. If `true`, its
+ * ID and Event trees are not validated
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
  */
-static ITC_Status_t serialiseStampToString(
-    const ITC_Stamp_t *const pt_Stamp,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+static ITC_Status_t addEventsToStamp(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Event_Counter_t t_EventCount,
+    const bool b_IsTrusted
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;        /* The current status */
-    uint32_t u32_Offset = 0;
-    uint32_t u32_ComponentSize = 0;
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* Whether the events were added by incrementing the cached leaf */
+    bool b_WasInflated = false;
 
-    if (*pu32_BufferSize < 1)
-    {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
 
-    /* Check there is space left in the buffer, taking into
-     * account the NULL termination byte */
-    if (t_Status == ITC_STATUS_SUCCESS && u32_Offset >= (*pu32_BufferSize - 1))
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        t_Status = (b_IsTrusted) ? checkTrustedStamp(pt_Stamp)
+                                 : validateStamp(pt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Add opening bracket */
-        pc_Buffer[u32_Offset] = '{';
-        /* Increment offset */
-        u32_Offset++;
-
-        /* Check there is space left in the buffer, taking into
-         * account min amount of space needed for the ID component.
-         * Do not include a NULL termination byte. That is included in the
-         * min ID component length */
-        if (u32_Offset >= (*pu32_BufferSize - ITC_SER_TO_STR_ID_MIN_BUFFER_LEN))
-        {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-        }
+        /* The Event tree is about to be modified in place */
+        t_Status = unshareStampEvent(pt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Calculate the space left in the buffer */
-        u32_ComponentSize = *pu32_BufferSize - u32_Offset;
+        /* Fill and grow need a normalised Event */
+        t_Status = normaliseStamp(pt_Stamp);
+    }
 
-        /* Serialise the ID component */
-        t_Status = ITC_SerDes_serialiseIdToString(
-            pt_Stamp->pt_Id, &pc_Buffer[u32_Offset], &u32_ComponentSize);
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Stamp->pt_InflationLeaf)
+    {
+        /* Fast path. A previous event established that fill does nothing and
+         * grow only increments this leaf */
+        t_Status = ITC_Event_inflateLeaf(
+            pt_Stamp->pt_Event,
+            pt_Stamp->pt_InflationLeaf,
+            t_EventCount,
+            &b_WasInflated);
     }
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS && !b_WasInflated)
     {
-        /* Increment offset but ignore the NULL byte in the end */
-        u32_Offset += u32_ComponentSize - 1;
+        /* Fill and grow may rebuild the Event tree */
+        resetInflationCache(pt_Stamp);
 
-        /* Check there is space left in the buffer, taking into
-         * account the NULL termination byte, the semicolon and space */
-        if (u32_Offset >= (*pu32_BufferSize - 2))
+        t_Status = ITC_Event_fillAndGrowValidated(
+            &pt_Stamp->pt_Event, pt_Stamp->pt_Id, t_EventCount);
+
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+        if (t_Status == ITC_STATUS_SUCCESS)
         {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            /* Check if the next event can take the fast path */
+            t_Status = ITC_Event_findInflationLeaf(
+                pt_Stamp->pt_Event,
+                pt_Stamp->pt_Id,
+                &pt_Stamp->pt_InflationLeaf);
         }
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        /* Add semicolon and space to separate the ID and Event components */
-        pc_Buffer[u32_Offset] = ';';
-        u32_Offset++;
-        pc_Buffer[u32_Offset] = ' ';
-        u32_Offset++;
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_EVENT, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
 
-        /* Check there is space left in the buffer, taking into
-         * account min amount of space needed for the Event component.
-         * Do not include a NULL termination byte. That is included in the
-         * min Event component length */
-        if (u32_Offset >=
-                (*pu32_BufferSize - ITC_SER_TO_STR_EVENT_MIN_BUFFER_LEN))
-        {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-        }
+    return t_Status;
+}
+
+/**
+ * @brief Fork an existing Stamp
+ *
+ * @param ppt_Stamp (in) The existing Stamp. (out) The first forked Stamp
+ * @param ppt_OtherStamp (out) The second forked Stamp
+ * @param b_IsTrusted Whether the Stamp is known to be valid. If `true`, its
+ * ID and Event trees are not validated
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t forkStamp(
+    ITC_Stamp_t **const ppt_Stamp,
+    ITC_Stamp_t **const ppt_OtherStamp,
+    const bool b_IsTrusted
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_SplitId1 = NULL;
+    ITC_Id_t *pt_SplitId2 = NULL;
+    ITC_Event_t *pt_Event = NULL;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    if (!ppt_Stamp || !ppt_OtherStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Calculate the space left in the buffer */
-        u32_ComponentSize = *pu32_BufferSize - u32_Offset;
+        /* Init Stamp */
+        *ppt_OtherStamp = NULL;
 
-        /* Serialise the Event component */
-        t_Status = ITC_SerDes_serialiseEventToString(
-            pt_Stamp->pt_Event, &pc_Buffer[u32_Offset], &u32_ComponentSize);
+        t_Status = (b_IsTrusted) ? checkTrustedStamp(*ppt_Stamp)
+                                 : validateStamp(*ppt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Increment offset but ignore the NULL byte in the end */
-        u32_Offset += u32_ComponentSize - 1;
-
-        /* Check there is space left in the buffer, taking into
-         * account the NULL termination byte */
-        if (u32_Offset >= (*pu32_BufferSize - 1))
-        {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-        }
+        /* Copy the Event component for the other Stamp */
+        t_Status = copyStampEvent((*ppt_Stamp)->pt_Event, &pt_Event);
     }
 
+#if ITC_CONFIG_ENABLE_ID_INTERNING
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Add closing bracket */
-        pc_Buffer[u32_Offset] = '}';
-        /* Increment offset */
-        u32_Offset++;
+        /* Split the ID. Interned IDs might be shared, so split a copy */
+        t_Status = ITC_Id_splitConstValidated(
+            (*ppt_Stamp)->pt_Id, &pt_SplitId1, &pt_SplitId2);
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Add a NULL termination byte */
-        pc_Buffer[u32_Offset] = '\0';
-        /* Increment offset */
-        u32_Offset++;
+        /* The other half gets interned by `newStampWithIdAndEvent` */
+        t_Status = internStampId(&pt_SplitId1);
+    }
+#else
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Split the ID in place. The Stamp keeps the first half. This leaves
+         * the ID unmodified on failure */
+        t_Status = ITC_Id_splitValidated(&(*ppt_Stamp)->pt_Id, &pt_SplitId2);
     }
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        /* Create the other Stamp */
+        t_Status = newStampWithIdAndEvent(
+            ppt_OtherStamp, pt_SplitId2, pt_Event, false, false, false);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Forget the ID and Event. The Stamp now has "ownership" of them
+             * and its destruct function will deallocated them when needed */
+            pt_SplitId2 = NULL;
+            pt_Event = NULL;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+        /* Destroy the first Stamp ID.
+         * Ignore return status. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall fork
+         * operation was successful. */
+        (void)ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+
+        /* Replace with the first half of the split ID */
+        (*ppt_Stamp)->pt_Id = pt_SplitId1;
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+        resetInflationCache(*ppt_Stamp);
+    }
+    else
+    {
+#if !ITC_CONFIG_ENABLE_ID_INTERNING
+        /* Undo the split. Summing the halves back in place restores the
+         * original ID without allocating any nodes */
+        if (pt_SplitId2)
+        {
+            (void)ITC_Id_sumValidated(&(*ppt_Stamp)->pt_Id, &pt_SplitId2);
+            resetInflationCache(*ppt_Stamp);
+        }
+#endif /* !ITC_CONFIG_ENABLE_ID_INTERNING */
+
+        /* Deallocate the Stamp and IDs.
+         * Ignore return status. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey original reason for
+         * the failure, rather than the destroy failure */
+        (void)ITC_Stamp_destroy(ppt_OtherStamp);
+        (void)ITC_Id_destroy(&pt_SplitId1);
+        (void)ITC_Id_destroy(&pt_SplitId2);
+        (void)ITC_Event_destroy(&pt_Event);
     }
 
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_FORK, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
-
 /**
- * @brief Deserialise an ITC Stamp
- *
- * For the expected data format see ::serialiseStamp()
+ * @brief Join two existing Stamps
  *
- * @param pu8_Buffer The buffer holding the serialised Stamp data
- * @param u32_BufferSize The size of the buffer in bytes
- * @param ppt_Stamp The pointer to the deserialised Stamp
+ * @param ppt_Stamp (in) The first existing Stamp. (out) The joined Stamp
+ * @param ppt_OtherStamp (in) The second existing Stamp. (out) NULL
+ * @param b_IsTrusted Whether the Stamps are known to be valid. If `true`,
+ * their ID and Event trees are not validated
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
-static ITC_Status_t deserialiseStamp(
-    const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    ITC_Stamp_t **const ppt_Stamp
+static ITC_Status_t joinStamps(
+    ITC_Stamp_t **const ppt_Stamp,
+    ITC_Stamp_t **const ppt_OtherStamp,
+    const bool b_IsTrusted
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_SerDes_Header_t t_StampHeader;
-    uint32_t u32_Offset = 0; /* The current offset into the buffer */
-    uint32_t u32_ComponentLength; /* The current serialised component size */
-    /* The length of the `serialised component length` length */
-    uint32_t u32_ComponentLengthLength;
-
-    ITC_Id_t *pt_Id = NULL;
-    ITC_Event_t *pt_Event = NULL;
+    ITC_Id_t *pt_SummedId = NULL;
 
-    /* Init stamp */
-    *ppt_Stamp = NULL;
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
 
-    /* Check the lib version */
-    t_Status = ITC_SerDes_Util_validateDesLibVersion(pu8_Buffer[u32_Offset]);
+    if (!ppt_Stamp || !ppt_OtherStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
+    /* Validate each tree only once. The sum and join below do not validate
+     * them again */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Increment the offset */
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
-
-        /* Get the stamp header */
-        t_StampHeader = pu8_Buffer[u32_Offset];
-
-        /* This is an invalid header */
-        if (t_StampHeader & ~ITC_SERDES_STAMP_HEADER_MASK)
-        {
-            t_Status = ITC_STATUS_CORRUPT_STAMP;
-        }
+        t_Status = (b_IsTrusted) ? checkTrustedStampForJoin(*ppt_Stamp)
+                                 : validateStampForJoin(*ppt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Increment the offset */
-        u32_Offset += sizeof(ITC_SerDes_Header_t);
-
-        /* Set the size of the buffer */
-        u32_ComponentLengthLength =
-            ITC_SERDES_STAMP_GET_ID_COMPONENT_LEN_LEN(t_StampHeader);
-
-        if ((u32_ComponentLengthLength < 1) ||
-            (u32_ComponentLengthLength > (u32_BufferSize - u32_Offset)))
-        {
-            t_Status = ITC_STATUS_CORRUPT_STAMP;
-        }
+        t_Status = (b_IsTrusted) ? checkTrustedStampForJoin(*ppt_OtherStamp)
+                                 : validateStampForJoin(*ppt_OtherStamp);
     }
 
+    /* Both Event trees are about to be modified in place */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Deserialise the ID component length */
-        t_Status = u32FromNetwork(
-            &pu8_Buffer[u32_Offset],
-            u32_ComponentLengthLength,
-            &u32_ComponentLength);
+        t_Status = unshareStampEvent(*ppt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Increment offset */
-        u32_Offset += u32_ComponentLengthLength;
-
-        if ((u32_ComponentLength < 1) ||
-            (u32_ComponentLength > (u32_BufferSize - u32_Offset)))
-        {
-            t_Status = ITC_STATUS_CORRUPT_STAMP;
-        }
+        t_Status = unshareStampEvent(*ppt_OtherStamp);
     }
 
+#if ITC_CONFIG_ENABLE_ID_INTERNING
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Deserialise the ID component */
-        t_Status = ITC_SerDes_Util_deserialiseId(
-            &pu8_Buffer[u32_Offset],
-            u32_ComponentLength,
-            false,
-            &pt_Id);
+        /* Interned IDs might be shared, so sum copies of them */
+        t_Status = ITC_Id_sumConstValidated(
+            (*ppt_Stamp)->pt_Id, (*ppt_OtherStamp)->pt_Id, &pt_SummedId);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Increment the offset */
-        u32_Offset += u32_ComponentLength;
-
-        /* Set the size of the buffer */
-        u32_ComponentLengthLength =
-            ITC_SERDES_STAMP_GET_EVENT_COMPONENT_LEN_LEN(t_StampHeader);
-
-        if ((u32_ComponentLengthLength < 1) ||
-            (u32_ComponentLengthLength > (u32_BufferSize - u32_Offset)))
-        {
-            t_Status = ITC_STATUS_CORRUPT_STAMP;
-        }
+        t_Status = internStampId(&pt_SummedId);
     }
+#else
+    /* The IDs are summed in place once the Events have been joined. Summing
+     * them cannot fail after this check */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_validateSum(
+            (*ppt_Stamp)->pt_Id, (*ppt_OtherStamp)->pt_Id);
+    }
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Deserialise the Event component length */
-        t_Status = u32FromNetwork(
-            &pu8_Buffer[u32_Offset],
-            u32_ComponentLengthLength,
-            &u32_ComponentLength);
+        /* Join the Events in place. This reuses the nodes of both Events and
+         * leaves them unmodified on failure. On success, the other Event is
+         * destroyed and its pointer is set to `NULL` */
+        t_Status = joinStampEvents(
+            &(*ppt_Stamp)->pt_Event,
+            &(*ppt_OtherStamp)->pt_Event);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Increment offset */
-        u32_Offset += u32_ComponentLengthLength;
+        /* Replace the ID and destroy the other source Stamp. The first Stamp
+         * becomes the joined Stamp.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall join
+         * operation was successful. */
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+        (void)ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+        (*ppt_Stamp)->pt_Id = pt_SummedId;
+#else
+        (void)ITC_Id_sumValidated(
+            &(*ppt_Stamp)->pt_Id, &(*ppt_OtherStamp)->pt_Id);
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+        resetInflationCache(*ppt_Stamp);
+        compactJoinedStamp(*ppt_Stamp);
+        (void)ITC_Stamp_destroy(ppt_OtherStamp);
+    }
+    else
+    {
+        /* Something went wrong, destroy anything that might have been created.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey the original reason
+         * for the failure, rather than the destroy failure. */
+        (void)ITC_Id_destroy(&pt_SummedId);
+    }
 
-        if ((u32_ComponentLength < 1) ||
-            (u32_ComponentLength > (u32_BufferSize - u32_Offset)))
-        {
-            t_Status = ITC_STATUS_CORRUPT_STAMP;
-        }
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_JOIN, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/**
+ * @brief Compare two existing Stamps
+ *
+ * See ::compareStamps() for the possible results.
+ *
+ * @param pt_Stamp1 The first Stamp
+ * @param pt_Stamp2 The second Stamp
+ * @param pt_Result The result of the comparison
+ * @param b_IsTrusted Whether the Stamps are known to be valid. If `true`,
+ * their ID and Event trees are not validated
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t compareTwoStamps(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    ITC_Stamp_Comparison_t *const pt_Result,
+    const bool b_IsTrusted
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    if (!pt_Result)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Deserialise the Event component */
-        t_Status = ITC_SerDes_Util_deserialiseEvent(
-            &pu8_Buffer[u32_Offset],
-            u32_ComponentLength,
-            false,
-            &pt_Event);
+        t_Status = (b_IsTrusted) ? checkTrustedStamp(pt_Stamp1)
+                                 : validateStamp(pt_Stamp1);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Increment offset */
-        u32_Offset += u32_ComponentLength;
-
-        /* Something has gone wrong, there is still data in the buffer */
-        if (u32_Offset < u32_BufferSize)
-        {
-            t_Status = ITC_STATUS_CORRUPT_STAMP;
-        }
+        t_Status = (b_IsTrusted) ? checkTrustedStamp(pt_Stamp2)
+                                 : validateStamp(pt_Stamp2);
     }
 
-    /* Create the Stamp */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newStampWithIdAndEvent(
-            ppt_Stamp, pt_Id, pt_Event, false, false, false);
+        /* Compare *pt_Stamp1 to *pt_Stamp2 */
+        t_Status = compareStamps(pt_Stamp1, pt_Stamp2, pt_Result);
     }
 
-    if (t_Status != ITC_STATUS_SUCCESS)
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_COMPARE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/**
+ * @brief Validate an array of Stamps to be joined
+ *
+ * Each Stamp is validated only once. Its Event is also checked to be joinable
+ * in place, so joining the Events cannot fail halfway through.
+ *
+ * @param ppt_Stamps The array of Stamps
+ * @param u32_StampCount The number of Stamps in the array
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the array is empty, or contains a
+ * `NULL` or duplicate Stamp
+ */
+static ITC_Status_t validateStampArray(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Stamps || u32_StampCount == 0)
     {
-        /* There is nothing else to do if a destroy call fails. Also it is more
-         * important to convey the deserialisation failed, rather than the
-         * destroy, so ignore return statuses */
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
-        if (*ppt_Stamp)
+    for (uint32_t u32_I = 0;
+         t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampCount;
+         u32_I++)
+    {
+        if (!ppt_Stamps[u32_I])
         {
-            (void)ITC_Stamp_destroy(ppt_Stamp);
+            t_Status = ITC_STATUS_INVALID_PARAM;
         }
-        else
+
+        /* The Events get joined in place, so the Stamps must be distinct.
+         * Shared Event trees get unshared before the join */
+        for (uint32_t u32_J = 0;
+             t_Status == ITC_STATUS_SUCCESS && u32_J < u32_I;
+             u32_J++)
         {
-            if (pt_Id)
-            {
-                (void)ITC_Id_destroy(&pt_Id);
-            }
-            if (pt_Event)
+            if (ppt_Stamps[u32_J] == ppt_Stamps[u32_I] ||
+                (ppt_Stamps[u32_J]->pt_Event == ppt_Stamps[u32_I]->pt_Event
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+                 && !ITC_Event_isShared(ppt_Stamps[u32_I]->pt_Event)
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+                 ))
             {
-                (void)ITC_Event_destroy(&pt_Event);
+                t_Status = ITC_STATUS_INVALID_PARAM;
             }
         }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = validateStampForJoin(ppt_Stamps[u32_I]);
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Sum the IDs of an array of Stamps
+ *
+ * @param ppt_Stamps The array of Stamps. Must be valid
+ * @param u32_StampCount The number of Stamps in the array. Must be `> 0`
+ * @param ppt_Id (out) The summed ID. `NULL` if `u32_StampCount == 1`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t sumStampIds(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    ITC_Id_t **const ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_SummedId = NULL;
+
+    *ppt_Id = NULL;
+
+    for (uint32_t u32_I = 1;
+         t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampCount;
+         u32_I++)
+    {
+        t_Status = ITC_Id_sumConstValidated(
+            (*ppt_Id) ? *ppt_Id : ppt_Stamps[0]->pt_Id,
+            ppt_Stamps[u32_I]->pt_Id,
+            &pt_SummedId);
+
+        /* Replace the intermediate sum.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails */
+        (void)ITC_Id_destroy(ppt_Id);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            *ppt_Id = pt_SummedId;
+            pt_SummedId = NULL;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Calculate the number of bytes needed to serialise an `uint32_t` in
+ * network-endian
+ *
+ * @param u32_Value The value
+ * @param pu32_Size (out) The number of bytes needed. Always at least 1
+ */
+static void getU32NetworkSize(
+    uint32_t u32_Value,
+    uint32_t *const pu32_Size
+)
+{
+    uint32_t u32_BytesNeeded = 0;
+
+    /* Determine the bytes needed to serialise the value */
+    do
+    {
+        u32_Value >>= 8U;
+        u32_BytesNeeded++;
+    } while (u32_Value != 0);
+
+    *pu32_Size = u32_BytesNeeded;
+}
+
+/**
+ * @brief Serialise an `uint32_t` in network-endian
+ *
+ * @param u32_Value The value to serialise
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t u32ToNetwork(
+    uint32_t u32_Value,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The number of bytes needed to serialise the value */
+    uint32_t u32_BytesNeeded;
+
+    getU32NetworkSize(u32_Value, &u32_BytesNeeded);
+
+    if (u32_BytesNeeded > *pu32_BufferSize)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        /* Serialise in network-endian */
+        for (uint32_t u32_I = u32_BytesNeeded; u32_I > 0; u32_I--)
+        {
+            pu8_Buffer[u32_I - 1] = (uint8_t)(u32_Value & 0xFFU);
+            u32_Value >>= 8U;
+        }
+
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_BytesNeeded;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an `uint32_t` from network-endian
+ *
+ * @param pu8_Buffer The buffer holding the serialised data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pu32_Value The pointer to the value
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if `u32_BufferSize > sizeof(uint32_t)`
+ */
+static ITC_Status_t u32FromNetwork(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    uint32_t *const pu32_Value
+)
+{
+    if (u32_BufferSize > sizeof(uint32_t))
+    {
+        /* The buffer is to big to fit into an uint32_t.
+         * This is probably an input error */
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Init the value */
+    *pu32_Value = 0;
+
+    /* Deserialise from network-endian */
+    for (uint32_t u32_I = 0; u32_I < u32_BufferSize; u32_I++)
+    {
+        *pu32_Value <<= 8U;
+        *pu32_Value |= pu8_Buffer[u32_I];
+    }
+
+    return ITC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Calculate the size of an existing ITC Stamp once serialised
+ *
+ * See ::serialiseStamp() for the data format.
+ *
+ * @param pt_Stamp The Stamp
+ * @param b_AddVersion Whether to include the `ITC_VERSION_MAJOR` field
+ * @param pu32_IdComponentLength (out) The size of the serialised ID component
+ * @param pu32_EventComponentLength (out) The size of the serialised Event
+ * component
+ * @param pu32_Size (out) The size of the serialised Stamp in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getSerialisedStampSize(
+    const ITC_Stamp_t *const pt_Stamp,
+    const bool b_AddVersion,
+    uint32_t *const pu32_IdComponentLength,
+    uint32_t *const pu32_EventComponentLength,
+    uint32_t *const pu32_Size
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    /* The length of the `ID component length` field */
+    uint32_t u32_IdComponentLengthLength;
+    /* The length of the `Event component length` field */
+    uint32_t u32_EventComponentLengthLength;
+
+    t_Status = ITC_SerDes_Util_getSerialisedIdSize(
+        pt_Stamp->pt_Id, pu32_IdComponentLength, false);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_getSerialisedEventSize(
+            pt_Stamp->pt_Event, pu32_EventComponentLength, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        getU32NetworkSize(
+            *pu32_IdComponentLength, &u32_IdComponentLengthLength);
+        getU32NetworkSize(
+            *pu32_EventComponentLength, &u32_EventComponentLengthLength);
+
+        *pu32_Size = ((b_AddVersion) ? (uint32_t)ITC_VERSION_MAJOR_LEN : 0U) +
+                     (uint32_t)sizeof(ITC_SerDes_Header_t) +
+                     u32_IdComponentLengthLength + *pu32_IdComponentLength +
+                     u32_EventComponentLengthLength +
+                     *pu32_EventComponentLength;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Serialise an existing ITC Stamp
+ *
+ * Data format:
+ *  - Byte 0: The major component of the version of the `libitc` library used to
+ *      serialise the data. Optional, can be ommitted.
+ *  - Byte 1: The Stamp header.
+ *      Contains 2 fields:
+ *      - Bits 0 - 2: The length of the `ID component length` field (see below)
+ *      - Bits 3 - 5: The length of the `Event component length` field
+ *        (see below)
+ *      - Bits 6 - 7: Reserved, always 0
+ *  - Bytes 2 - 5: ID component length. Can be 1 - 4 bytes long. The length of
+ *    this field is encoded in the Stamp header. Serialised in network-endian.
+ *  - Bytes (3 - 6) - <ID_END> (see above): The ID tree, **without** a version
+ *    field. See ::serialiseId()
+ *  - Bytes <ID_END + 1> - <ID_END + 4>: Event component length. Can be 1 - 4
+ *    bytes long. The length of this field is encoded in the Stamp header.
+ *    Serialised in network-endian.
+ *  - Bytes (<ID_END + 2> - <ID_END + 5>) - <EVENT_END> (see above): The Event
+ *    tree, **without** a version field. See ::serialiseEvent()
+ *
+ * @param ppt_Stamp The pointer to the Stamp
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
+ * the serialised data
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseStamp(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize,
+    const bool b_AddVersion
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_SerDes_Header_t t_StampHeader = 0;
+    uint32_t u32_Offset = 0; /* The current offset into the buffer */
+    uint32_t u32_IdComponentLength;
+    uint32_t u32_EventComponentLength;
+    uint32_t u32_StampLength; /* The total serialised Stamp size */
+    uint32_t u32_Length; /* The size of the current field */
+    uint32_t u32_HeaderOffset; /* The offset of the Stamp header */
+
+    /* Size everything up front, so each field can be written directly into
+     * its final position */
+    t_Status = getSerialisedStampSize(
+        pt_Stamp,
+        b_AddVersion,
+        &u32_IdComponentLength,
+        &u32_EventComponentLength,
+        &u32_StampLength);
+
+    if (t_Status == ITC_STATUS_SUCCESS && *pu32_BufferSize < u32_StampLength)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (b_AddVersion)
+        {
+            /* Add the lib version (provided by build system c args) */
+            pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+
+            /* Increment offset */
+            u32_Offset += ITC_VERSION_MAJOR_LEN;
+        }
+
+        /* Increment offset. Leave space for the header */
+        u32_HeaderOffset = u32_Offset;
+        u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+        /* Serialise the ID component length */
+        u32_Length = u32_StampLength - u32_Offset;
+        t_Status = u32ToNetwork(
+            u32_IdComponentLength, &pu8_Buffer[u32_Offset], &u32_Length);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Set the `ID component length` length in the header */
+        t_StampHeader = ITC_SERDES_STAMP_SET_ID_COMPONENT_LEN_LEN(
+            t_StampHeader, u32_Length);
+
+        /* Increment the offset */
+        u32_Offset += u32_Length;
+
+        /* Serialise ID component */
+        u32_Length = u32_IdComponentLength;
+        t_Status = ITC_SerDes_Util_serialiseId(
+            pt_Stamp->pt_Id, &pu8_Buffer[u32_Offset], &u32_Length, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment the offset */
+        u32_Offset += u32_Length;
+
+        /* Serialise the Event component length */
+        u32_Length = u32_StampLength - u32_Offset;
+        t_Status = u32ToNetwork(
+            u32_EventComponentLength, &pu8_Buffer[u32_Offset], &u32_Length);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Set the `Event component length` length in the header */
+        t_StampHeader = ITC_SERDES_STAMP_SET_EVENT_COMPONENT_LEN_LEN(
+            t_StampHeader, u32_Length);
+
+        /* Increment the offset */
+        u32_Offset += u32_Length;
+
+        /* Serialise Event component */
+        u32_Length = u32_EventComponentLength;
+        t_Status = ITC_SerDes_Util_serialiseEvent(
+            pt_Stamp->pt_Event, &pu8_Buffer[u32_Offset], &u32_Length, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment the offset */
+        u32_Offset += u32_Length;
+
+        /* Add the Stamp header */
+        pu8_Buffer[u32_HeaderOffset] = t_StampHeader;
+
+        /* Return the size of the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/**
+ * @brief Serialise an existing ITC Stamp to ASCII string
+ *
+ * @note The output buffer is always NULL-terminated
+ * @param ppt_Stamp The pointer to the Stamp. Ignored if `pt_View` is set
+ * @param pt_View The view of a serialised Stamp to serialise instead. Optional
+ * @param pc_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes (including the NULL termination byte).
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseStampToString(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_SerDes_StampView_t *const pt_View,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;        /* The current status */
+    uint32_t u32_Offset = 0;
+    uint32_t u32_ComponentSize = 0;
+
+    if (*pu32_BufferSize < 1)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Check there is space left in the buffer, taking into
+     * account the NULL termination byte */
+    if (t_Status == ITC_STATUS_SUCCESS && u32_Offset >= (*pu32_BufferSize - 1))
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Add opening bracket */
+        pc_Buffer[u32_Offset] = '{';
+        /* Increment offset */
+        u32_Offset++;
+
+        /* Check there is space left in the buffer, taking into
+         * account min amount of space needed for the ID component.
+         * Do not include a NULL termination byte. That is included in the
+         * min ID component length */
+        if (u32_Offset >= (*pu32_BufferSize - ITC_SER_TO_STR_ID_MIN_BUFFER_LEN))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Calculate the space left in the buffer */
+        u32_ComponentSize = *pu32_BufferSize - u32_Offset;
+
+        /* Serialise the ID component */
+        if (pt_View)
+        {
+            t_Status = ITC_SerDes_Util_serialisedIdToString(
+                &pt_View->pu8_Buffer[pt_View->u32_IdOffset],
+                pt_View->u32_IdLength,
+                &pc_Buffer[u32_Offset],
+                &u32_ComponentSize);
+        }
+        else
+        {
+            t_Status = ITC_SerDes_serialiseIdToString(
+                pt_Stamp->pt_Id, &pc_Buffer[u32_Offset], &u32_ComponentSize);
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment offset but ignore the NULL byte in the end */
+        u32_Offset += u32_ComponentSize - 1;
+
+        /* Check there is space left in the buffer, taking into
+         * account the NULL termination byte, the semicolon and space */
+        if (u32_Offset >= (*pu32_BufferSize - 2))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Add semicolon and space to separate the ID and Event components */
+        pc_Buffer[u32_Offset] = ';';
+        u32_Offset++;
+        pc_Buffer[u32_Offset] = ' ';
+        u32_Offset++;
+
+        /* Check there is space left in the buffer, taking into
+         * account min amount of space needed for the Event component.
+         * Do not include a NULL termination byte. That is included in the
+         * min Event component length */
+        if (u32_Offset >=
+                (*pu32_BufferSize - ITC_SER_TO_STR_EVENT_MIN_BUFFER_LEN))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Calculate the space left in the buffer */
+        u32_ComponentSize = *pu32_BufferSize - u32_Offset;
+
+        /* Serialise the Event component */
+        if (pt_View)
+        {
+            t_Status = ITC_SerDes_Util_serialisedEventToString(
+                &pt_View->pu8_Buffer[pt_View->u32_EventOffset],
+                pt_View->u32_EventLength,
+                &pc_Buffer[u32_Offset],
+                &u32_ComponentSize);
+        }
+        else
+        {
+            t_Status = ITC_SerDes_serialiseEventToString(
+                pt_Stamp->pt_Event,
+                &pc_Buffer[u32_Offset],
+                &u32_ComponentSize);
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment offset but ignore the NULL byte in the end */
+        u32_Offset += u32_ComponentSize - 1;
+
+        /* Check there is space left in the buffer, taking into
+         * account the NULL termination byte */
+        if (u32_Offset >= (*pu32_BufferSize - 1))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Add closing bracket */
+        pc_Buffer[u32_Offset] = '}';
+        /* Increment offset */
+        u32_Offset++;
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Add a NULL termination byte */
+        pc_Buffer[u32_Offset] = '\0';
+        /* Increment offset */
+        u32_Offset++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Serialise an existing ITC Stamp to ASCII string through a writer
+ *
+ * Kept out of line, so that the string sink does not share the stack frame of
+ * the caller.
+ *
+ * @param pt_Stamp The Stamp. Must be valid and normalised
+ * @param pfn_Writer The writer receiving the string
+ * @param pv_Context The user context passed to the writer
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+static ITC_STAMP_NOINLINE ITC_Status_t writeStampString(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_SerDes_Util_StringSink_t t_Sink;
+
+    ITC_SerDes_Util_initStringSink(&t_Sink, pfn_Writer, pv_Context);
+
+    t_Status = ITC_SerDes_Util_appendToStringSink(&t_Sink, "{", 1);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_writeIdString(pt_Stamp->pt_Id, &t_Sink);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Separate the ID and Event components */
+        t_Status = ITC_SerDes_Util_appendToStringSink(&t_Sink, "; ", 2);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status =
+            ITC_SerDes_Util_writeEventString(pt_Stamp->pt_Event, &t_Sink);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_appendToStringSink(&t_Sink, "}", 1);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_flushStringSink(&t_Sink);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+/**
+ * @brief Parse the layout of a serialised ITC Stamp
+ *
+ * Checks the Stamp header and component lengths, without looking into the
+ * serialised ID and Event components themselves.
+ *
+ * For the expected data format see ::serialiseStamp()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Stamp data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @param pu32_StampLength (out) The length of the serialised Stamp. If `NULL`,
+ * the Stamp must take up the whole buffer. Otherwise, it can be followed by
+ * other data
+ * @param pu32_IdOffset (out) The offset of the serialised ID component
+ * @param pu32_IdLength (out) The length of the serialised ID component
+ * @param pu32_EventOffset (out) The offset of the serialised Event component
+ * @param pu32_EventLength (out) The length of the serialised Event component
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_STAMP` if the Stamp layout is invalid
+ */
+static ITC_Status_t parseSerialisedStamp(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion,
+    uint32_t *const pu32_StampLength,
+    uint32_t *const pu32_IdOffset,
+    uint32_t *const pu32_IdLength,
+    uint32_t *const pu32_EventOffset,
+    uint32_t *const pu32_EventLength
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_SerDes_Header_t t_StampHeader;
+    uint32_t u32_Offset = 0; /* The current offset into the buffer */
+    /* The length of the `serialised component length` length */
+    uint32_t u32_ComponentLengthLength;
+
+    /* If input contains a version check it matches the current lib version
+     * (provided by build system c args) */
+    if (b_HasVersion)
+    {
+        t_Status = ITC_SerDes_Util_validateDesLibVersion(
+            pu8_Buffer[u32_Offset]);
+
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Get the stamp header */
+        t_StampHeader = pu8_Buffer[u32_Offset];
+
+        /* This is an invalid header */
+        if (t_StampHeader & ~ITC_SERDES_STAMP_HEADER_MASK)
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment the offset */
+        u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+        /* Set the size of the buffer */
+        u32_ComponentLengthLength =
+            ITC_SERDES_STAMP_GET_ID_COMPONENT_LEN_LEN(t_StampHeader);
+
+        if ((u32_ComponentLengthLength < 1) ||
+            (u32_ComponentLengthLength > (u32_BufferSize - u32_Offset)))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise the ID component length */
+        t_Status = u32FromNetwork(
+            &pu8_Buffer[u32_Offset],
+            u32_ComponentLengthLength,
+            pu32_IdLength);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment offset */
+        u32_Offset += u32_ComponentLengthLength;
+
+        if ((*pu32_IdLength < 1) ||
+            (*pu32_IdLength > (u32_BufferSize - u32_Offset)))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_IdOffset = u32_Offset;
+
+        /* Increment the offset */
+        u32_Offset += *pu32_IdLength;
+
+        /* Set the size of the buffer */
+        u32_ComponentLengthLength =
+            ITC_SERDES_STAMP_GET_EVENT_COMPONENT_LEN_LEN(t_StampHeader);
+
+        if ((u32_ComponentLengthLength < 1) ||
+            (u32_ComponentLengthLength > (u32_BufferSize - u32_Offset)))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise the Event component length */
+        t_Status = u32FromNetwork(
+            &pu8_Buffer[u32_Offset],
+            u32_ComponentLengthLength,
+            pu32_EventLength);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment offset */
+        u32_Offset += u32_ComponentLengthLength;
+
+        /* Unless the Stamp can be followed by other data, the Event
+         * component must take up the rest of the buffer. Otherwise, something
+         * has gone wrong */
+        if ((*pu32_EventLength < 1) ||
+            (*pu32_EventLength > (u32_BufferSize - u32_Offset)) ||
+            (!pu32_StampLength &&
+             *pu32_EventLength != (u32_BufferSize - u32_Offset)))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_EventOffset = u32_Offset;
+
+        if (pu32_StampLength)
+        {
+            *pu32_StampLength = u32_Offset + *pu32_EventLength;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an ITC Stamp
+ *
+ * For the expected data format see ::serialiseStamp()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Stamp data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @param pu32_StampLength (out) The length of the serialised Stamp. If `NULL`,
+ * the Stamp must take up the whole buffer. Otherwise, it can be followed by
+ * other data
+ * @param ppt_Stamp The pointer to the deserialised Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t deserialiseStamp(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion,
+    uint32_t *const pu32_StampLength,
+    ITC_Stamp_t **const ppt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_IdOffset;
+    uint32_t u32_IdLength;
+    uint32_t u32_EventOffset;
+    uint32_t u32_EventLength;
+
+    ITC_Id_t *pt_Id = NULL;
+    ITC_Event_t *pt_Event = NULL;
+
+    /* Init stamp */
+    *ppt_Stamp = NULL;
+
+    t_Status = parseSerialisedStamp(
+        pu8_Buffer,
+        u32_BufferSize,
+        b_HasVersion,
+        pu32_StampLength,
+        &u32_IdOffset,
+        &u32_IdLength,
+        &u32_EventOffset,
+        &u32_EventLength);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise the ID component */
+        t_Status = ITC_SerDes_Util_deserialiseId(
+            &pu8_Buffer[u32_IdOffset],
+            u32_IdLength,
+            false,
+            &pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise the Event component */
+        t_Status = ITC_SerDes_Util_deserialiseEvent(
+            &pu8_Buffer[u32_EventOffset],
+            u32_EventLength,
+            false,
+            &pt_Event);
+    }
+
+    /* Create the Stamp */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStampWithIdAndEvent(
+            ppt_Stamp, pt_Id, pt_Event, false, false, false);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if a destroy call fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy, so ignore return statuses */
+
+        if (*ppt_Stamp)
+        {
+            (void)ITC_Stamp_destroy(ppt_Stamp);
+        }
+        else
+        {
+            if (pt_Id)
+            {
+                (void)ITC_Id_destroy(&pt_Id);
+            }
+            if (pt_Event)
+            {
+                (void)ITC_Event_destroy(&pt_Event);
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Calculate the size of an array of ITC Stamps once serialised as a
+ * batch
+ *
+ * See ::ITC_SerDes_serialiseStampBatch() for the data format. Each Stamp is
+ * also validated.
+ *
+ * @param ppt_Stamps The array of Stamps
+ * @param u32_StampCount The number of Stamps in the array
+ * @param pu32_Size (out) The size of the serialised batch in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the size does not fit in an
+ * `uint32_t`
+ */
+static ITC_Status_t getSerialisedStampBatchSize(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    uint32_t *const pu32_Size
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+    uint32_t u32_IdComponentLength;
+    uint32_t u32_EventComponentLength;
+    uint32_t u32_StampLength;
+    uint32_t u32_Size;
+
+    /* The Stamp count */
+    getU32NetworkSize(u32_StampCount, &u32_Size);
+
+    /* The version and the batch header */
+    u32_Size += (uint32_t)ITC_VERSION_MAJOR_LEN +
+                (uint32_t)sizeof(ITC_SerDes_Header_t);
+
+    for (uint32_t u32_I = 0;
+         t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampCount;
+         u32_I++)
+    {
+        t_Status = validateStamp(ppt_Stamps[u32_I]);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = getNormalisedStamp(
+                ppt_Stamps[u32_I], &pt_StampCopy, &pt_NormalisedStamp);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* The Stamps share the version of the batch */
+                t_Status = getSerialisedStampSize(
+                    pt_NormalisedStamp,
+                    false,
+                    &u32_IdComponentLength,
+                    &u32_EventComponentLength,
+                    &u32_StampLength);
+
+                releaseNormalisedStamp(&pt_StampCopy);
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            if (u32_StampLength > (UINT32_MAX - u32_Size))
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            else
+            {
+                u32_Size += u32_StampLength;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_Size = u32_Size;
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+
+/**
+ * @brief Get a Stamp decoder ready for a new Stamp
+ *
+ * @warning Does not release any partially deserialised trees
+ * @param pt_Decoder The decoder
+ */
+static void initStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder
+)
+{
+    pt_Decoder->t_IdDecoder.pt_Root = NULL;
+    pt_Decoder->t_IdDecoder.pt_Parent = NULL;
+    pt_Decoder->t_EventDecoder.pt_Root = NULL;
+    pt_Decoder->t_EventDecoder.pt_Parent = NULL;
+    pt_Decoder->t_EventDecoder.t_Counter = 0;
+    pt_Decoder->t_EventDecoder.u8_Header = 0;
+    pt_Decoder->t_EventDecoder.u8_CounterBytesLeft = 0;
+    pt_Decoder->t_Status = ITC_STATUS_SUCCESS;
+    pt_Decoder->u32_FieldBytesLeft = 0;
+    pt_Decoder->u32_ComponentLen = 0;
+    pt_Decoder->u8_Field = ITC_SERDES_STAMP_DECODER_FIELD_VERSION;
+    pt_Decoder->u8_StampHeader = 0;
+}
+
+/**
+ * @brief Feed the next part of a serialised ITC Stamp to a Stamp decoder
+ *
+ * For the expected data format see ::serialiseStamp(). The fields are read in
+ * the same order and with the same checks as during ::deserialiseStamp()
+ *
+ * @param pt_Decoder The decoder
+ * @param pu8_Buffer The buffer holding the next part of the serialised Stamp
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t feedStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Offset = 0; /* The current offset into the buffer */
+    /* The number of bytes of the current component in the buffer */
+    uint32_t u32_ChunkSize;
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Offset < u32_BufferSize)
+    {
+        switch (pt_Decoder->u8_Field)
+        {
+            case ITC_SERDES_STAMP_DECODER_FIELD_VERSION:
+            {
+                /* Check the lib version */
+                t_Status = ITC_SerDes_Util_validateDesLibVersion(
+                    pu8_Buffer[u32_Offset]);
+
+                pt_Decoder->u8_Field = ITC_SERDES_STAMP_DECODER_FIELD_HEADER;
+                u32_Offset += ITC_VERSION_MAJOR_LEN;
+                break;
+            }
+            case ITC_SERDES_STAMP_DECODER_FIELD_HEADER:
+            {
+                pt_Decoder->u8_StampHeader = pu8_Buffer[u32_Offset];
+
+                /* This is an invalid header or the component lengths do not
+                 * fit into an `uint32_t` */
+                if ((pt_Decoder->u8_StampHeader &
+                     ~ITC_SERDES_STAMP_HEADER_MASK) ||
+                    (ITC_SERDES_STAMP_GET_ID_COMPONENT_LEN_LEN(
+                         pt_Decoder->u8_StampHeader) < 1) ||
+                    (ITC_SERDES_STAMP_GET_ID_COMPONENT_LEN_LEN(
+                         pt_Decoder->u8_StampHeader) > sizeof(uint32_t)) ||
+                    (ITC_SERDES_STAMP_GET_EVENT_COMPONENT_LEN_LEN(
+                         pt_Decoder->u8_StampHeader) < 1) ||
+                    (ITC_SERDES_STAMP_GET_EVENT_COMPONENT_LEN_LEN(
+                         pt_Decoder->u8_StampHeader) > sizeof(uint32_t)))
+                {
+                    t_Status = ITC_STATUS_CORRUPT_STAMP;
+                }
+
+                pt_Decoder->u8_Field = ITC_SERDES_STAMP_DECODER_FIELD_ID_LEN;
+                pt_Decoder->u32_FieldBytesLeft =
+                    ITC_SERDES_STAMP_GET_ID_COMPONENT_LEN_LEN(
+                        pt_Decoder->u8_StampHeader);
+                pt_Decoder->u32_ComponentLen = 0;
+                u32_Offset += sizeof(ITC_SerDes_Header_t);
+                break;
+            }
+            case ITC_SERDES_STAMP_DECODER_FIELD_ID_LEN:
+            case ITC_SERDES_STAMP_DECODER_FIELD_EVENT_LEN:
+            {
+                /* Deserialise the next byte of the component length from
+                 * network-endian */
+                pt_Decoder->u32_ComponentLen <<= 8U;
+                pt_Decoder->u32_ComponentLen |= pu8_Buffer[u32_Offset];
+                pt_Decoder->u32_FieldBytesLeft--;
+
+                if (pt_Decoder->u32_FieldBytesLeft == 0)
+                {
+                    if (pt_Decoder->u32_ComponentLen < 1)
+                    {
+                        t_Status = ITC_STATUS_CORRUPT_STAMP;
+                    }
+
+                    /* The component follows its length */
+                    pt_Decoder->u8_Field++;
+                    pt_Decoder->u32_FieldBytesLeft =
+                        pt_Decoder->u32_ComponentLen;
+                }
+
+                u32_Offset++;
+                break;
+            }
+            case ITC_SERDES_STAMP_DECODER_FIELD_ID:
+            case ITC_SERDES_STAMP_DECODER_FIELD_EVENT:
+            {
+                /* Take as much of the component as is available */
+                u32_ChunkSize = u32_BufferSize - u32_Offset;
+
+                if (u32_ChunkSize > pt_Decoder->u32_FieldBytesLeft)
+                {
+                    u32_ChunkSize = pt_Decoder->u32_FieldBytesLeft;
+                }
+
+                if (pt_Decoder->u8_Field == ITC_SERDES_STAMP_DECODER_FIELD_ID)
+                {
+                    t_Status = ITC_SerDes_Util_feedIdDecoder(
+                        &pt_Decoder->t_IdDecoder,
+                        &pu8_Buffer[u32_Offset],
+                        u32_ChunkSize);
+                }
+                else
+                {
+                    t_Status = ITC_SerDes_Util_feedEventDecoder(
+                        &pt_Decoder->t_EventDecoder,
+                        &pu8_Buffer[u32_Offset],
+                        u32_ChunkSize);
+                }
+
+                pt_Decoder->u32_FieldBytesLeft -= u32_ChunkSize;
+                u32_Offset += u32_ChunkSize;
+
+                /* The whole component has been read */
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    pt_Decoder->u32_FieldBytesLeft == 0)
+                {
+                    if (pt_Decoder->u8_Field ==
+                        ITC_SERDES_STAMP_DECODER_FIELD_ID)
+                    {
+                        t_Status = ITC_SerDes_Util_finishIdDecoder(
+                            &pt_Decoder->t_IdDecoder);
+
+                        pt_Decoder->u32_FieldBytesLeft =
+                            ITC_SERDES_STAMP_GET_EVENT_COMPONENT_LEN_LEN(
+                                pt_Decoder->u8_StampHeader);
+                        pt_Decoder->u32_ComponentLen = 0;
+                    }
+                    else
+                    {
+                        t_Status = ITC_SerDes_Util_finishEventDecoder(
+                            &pt_Decoder->t_EventDecoder);
+                    }
+
+                    pt_Decoder->u8_Field++;
+                }
+
+                break;
+            }
+            default:
+            {
+                /* The data continues past the end of the Stamp */
+                t_Status = ITC_STATUS_CORRUPT_STAMP;
+                break;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/**
+ * @brief Calculate the size of an existing ITC Stamp once serialised in the
+ * compact format
+ *
+ * See ::serialiseStampCompact() for the data format.
+ *
+ * @param pt_Stamp The Stamp
+ * @param pu32_Size (out) The size of the serialised Stamp in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getSerialisedStampCompactSize(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Size
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    uint32_t u32_IdBitCount;
+    uint32_t u32_EventBitCount;
+
+    t_Status = ITC_SerDes_Util_getSerialisedIdCompactBitCount(
+        pt_Stamp->pt_Id, &u32_IdBitCount);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_getSerialisedEventCompactBitCount(
+            pt_Stamp->pt_Event, &u32_EventBitCount);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_Size = (uint32_t)ITC_VERSION_MAJOR_LEN +
+                     ((u32_IdBitCount + u32_EventBitCount + 7U) / 8U);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Serialise an existing ITC Stamp in the compact format
+ *
+ * Data format:
+ *  - Byte 0: The major component of the version of the `libitc` library used to
+ *      serialise the data, with ::ITC_SERDES_COMPACT_FORMAT_FLAG set
+ *  - Bytes 1 - <END>: A single bit stream holding the ID tree followed by the
+ *    Event tree, **without** version fields or component lengths. See
+ *    ::ITC_SerDes_Util_serialiseIdCompact() and
+ *    ::ITC_SerDes_Util_serialiseEventCompact(). The bit stream is padded with
+ *    `0` bits to a whole number of bytes
+ *
+ * @param pt_Stamp The Stamp
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseStampCompact(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_SerDes_Util_BitWriter_t t_Writer = { 0 };
+    uint32_t u32_StampLength; /* The total serialised Stamp size */
+
+    /* Size everything up front, so nothing gets written on failure */
+    t_Status = getSerialisedStampCompactSize(pt_Stamp, &u32_StampLength);
+
+    if (t_Status == ITC_STATUS_SUCCESS && *pu32_BufferSize < u32_StampLength)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Writer.pu8_Buffer = &pu8_Buffer[ITC_VERSION_MAJOR_LEN];
+        t_Writer.u32_BufferSize =
+            u32_StampLength - (uint32_t)ITC_VERSION_MAJOR_LEN;
+
+        /* Serialise ID component */
+        t_Status = ITC_SerDes_Util_serialiseIdCompact(
+            pt_Stamp->pt_Id, &t_Writer);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Serialise Event component directly after the ID */
+        t_Status = ITC_SerDes_Util_serialiseEventCompact(
+            pt_Stamp->pt_Event, &t_Writer);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Add the lib version (provided by build system c args) and mark the
+         * data as compact */
+        pu8_Buffer[0] = ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG;
+
+        /* Return the size of the buffer */
+        *pu32_BufferSize = u32_StampLength;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an ITC Stamp in the compact format
+ *
+ * For the expected data format see ::serialiseStampCompact()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Stamp data
+ * @param u32_BufferSize The size of the buffer in bytes. Must be `> 0`
+ * @param ppt_Stamp The pointer to the deserialised Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_STAMP` if data follows the Event component
+ */
+static ITC_Status_t deserialiseStampCompact(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Stamp_t **const ppt_Stamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_SerDes_Util_BitReader_t t_Reader = {
+        .pu8_Buffer = &pu8_Buffer[ITC_VERSION_MAJOR_LEN],
+        .u32_BufferSize = u32_BufferSize - (uint32_t)ITC_VERSION_MAJOR_LEN,
+        .u32_BitOffset = 0,
+    };
+
+    ITC_Id_t *pt_Id = NULL;
+    ITC_Event_t *pt_Event = NULL;
+
+    /* Init stamp */
+    *ppt_Stamp = NULL;
+
+    t_Status = ITC_SerDes_Util_validateDesLibVersion(
+        pu8_Buffer[0] & (uint8_t)~ITC_SERDES_COMPACT_FORMAT_FLAG);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise the ID component */
+        t_Status = ITC_SerDes_Util_deserialiseIdCompact(&t_Reader, &pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise the Event component */
+        t_Status = ITC_SerDes_Util_deserialiseEventCompact(
+            &t_Reader, &pt_Event);
+    }
+
+    /* Check nothing but padding follows the Event component */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        !ITC_SerDes_Util_isBitReaderAtEnd(&t_Reader))
+    {
+        t_Status = ITC_STATUS_CORRUPT_STAMP;
+    }
+
+    /* Create the Stamp */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStampWithIdAndEvent(
+            ppt_Stamp, pt_Id, pt_Event, false, false, false);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if a destroy call fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy, so ignore return statuses */
+
+        if (*ppt_Stamp)
+        {
+            (void)ITC_Stamp_destroy(ppt_Stamp);
+        }
+        else
+        {
+            if (pt_Id)
+            {
+                (void)ITC_Id_destroy(&pt_Id);
+            }
+            if (pt_Event)
+            {
+                (void)ITC_Event_destroy(&pt_Event);
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+
+/**
+ * @brief Check what the summaries of two (sets of) Events tell about
+ * `Event1 <= Event2`
+ *
+ * @param pt_Summary1 The summary of the first (set of) Events
+ * @param pt_Summary2 The summary of the second (set of) Events
+ * @param pb_CanBeLeq (out) Whether `Event1 <= Event2` is possible
+ * @param pb_CanBeNotLeq (out) Whether `!(Event1 <= Event2)` is possible
+ */
+static void getCausalIndexSummaryLeq(
+    const ITC_CausalIndex_Summary_t *const pt_Summary1,
+    const ITC_CausalIndex_Summary_t *const pt_Summary2,
+    bool *const pb_CanBeLeq,
+    bool *const pb_CanBeNotLeq
+)
+{
+    *pb_CanBeLeq = true;
+    *pb_CanBeNotLeq = false;
+
+    for (uint32_t u32_I = 0;
+         u32_I < ITC_CAUSAL_INDEX_CELL_COUNT && *pb_CanBeLeq;
+         u32_I++)
+    {
+        /* Some part of Event1 is certainly bigger than Event2 */
+        if (pt_Summary1->rt_Min[u32_I] > pt_Summary2->rt_Max[u32_I])
+        {
+            *pb_CanBeLeq = false;
+            *pb_CanBeNotLeq = true;
+        }
+        /* Some part of Event1 might be bigger than Event2 */
+        else if (pt_Summary1->rt_Max[u32_I] > pt_Summary2->rt_Min[u32_I])
+        {
+            *pb_CanBeNotLeq = true;
+        }
+    }
+}
+
+/**
+ * @brief Get the possible results of comparing a (set of) indexed Stamps to
+ * the queried Stamp
+ *
+ * @param pt_Summary The summary of the (set of) indexed Stamps
+ * @param pt_QuerySummary The summary of the queried Stamp
+ * @return `uint32_t` The possible results. A combination of
+ * `ITC_Stamp_Comparison_t` values
+ */
+static uint32_t getCausalIndexPossibleRelations(
+    const ITC_CausalIndex_Summary_t *const pt_Summary,
+    const ITC_CausalIndex_Summary_t *const pt_QuerySummary
+)
+{
+    uint32_t u32_Relations = 0;
+    bool b_CanBeLeq12;
+    bool b_CanBeNotLeq12;
+    bool b_CanBeLeq21;
+    bool b_CanBeNotLeq21;
+
+    getCausalIndexSummaryLeq(
+        pt_Summary, pt_QuerySummary, &b_CanBeLeq12, &b_CanBeNotLeq12);
+    getCausalIndexSummaryLeq(
+        pt_QuerySummary, pt_Summary, &b_CanBeLeq21, &b_CanBeNotLeq21);
+
+    if (b_CanBeLeq12 && b_CanBeLeq21)
+    {
+        u32_Relations |= (uint32_t)ITC_STAMP_COMPARISON_EQUAL;
+    }
+
+    if (b_CanBeLeq12 && b_CanBeNotLeq21)
+    {
+        u32_Relations |= (uint32_t)ITC_STAMP_COMPARISON_LESS_THAN;
+    }
+
+    if (b_CanBeNotLeq12 && b_CanBeLeq21)
+    {
+        u32_Relations |= (uint32_t)ITC_STAMP_COMPARISON_GREATER_THAN;
+    }
+
+    if (b_CanBeNotLeq12 && b_CanBeNotLeq21)
+    {
+        u32_Relations |= (uint32_t)ITC_STAMP_COMPARISON_CONCURRENT;
+    }
+
+    return u32_Relations;
+}
+
+/**
+ * @brief Recalculate the combined summary of a causal index bucket
+ *
+ * @param pt_Index The index
+ * @param u32_Bucket The bucket
+ */
+static void refreshCausalIndexBucket(
+    ITC_CausalIndex_t *const pt_Index,
+    const uint32_t u32_Bucket
+)
+{
+    ITC_CausalIndex_Bucket_t *pt_Bucket = &pt_Index->pt_Buckets[u32_Bucket];
+    const ITC_CausalIndex_Summary_t *pt_Summary;
+    uint32_t u32_Slot = u32_Bucket * ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH;
+    uint32_t u32_End = u32_Slot + ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH;
+
+    /* The last bucket may be cut short */
+    if (u32_End > pt_Index->u32_Capacity)
+    {
+        u32_End = pt_Index->u32_Capacity;
+    }
+
+    pt_Bucket->u32_Count = 0;
+
+    for (; u32_Slot < u32_End; u32_Slot++)
+    {
+        if (pt_Index->pt_Entries[u32_Slot].pt_Stamp)
+        {
+            pt_Summary = &pt_Index->pt_Entries[u32_Slot].t_Summary;
+
+            if (pt_Bucket->u32_Count == 0)
+            {
+                pt_Bucket->t_Summary = *pt_Summary;
+            }
+            else
+            {
+                for (uint32_t u32_I = 0;
+                     u32_I < ITC_CAUSAL_INDEX_CELL_COUNT;
+                     u32_I++)
+                {
+                    if (pt_Summary->rt_Min[u32_I] <
+                        pt_Bucket->t_Summary.rt_Min[u32_I])
+                    {
+                        pt_Bucket->t_Summary.rt_Min[u32_I] =
+                            pt_Summary->rt_Min[u32_I];
+                    }
+
+                    if (pt_Summary->rt_Max[u32_I] >
+                        pt_Bucket->t_Summary.rt_Max[u32_I])
+                    {
+                        pt_Bucket->t_Summary.rt_Max[u32_I] =
+                            pt_Summary->rt_Max[u32_I];
+                    }
+                }
+            }
+
+            pt_Bucket->u32_Count++;
+        }
+    }
+}
+
+/**
+ * @brief Put a Stamp into a slot of a causal index
+ *
+ * @note On failure, the index is left unmodified
+ * @param pt_Index The index
+ * @param u32_Slot The slot. Can be free or already hold a Stamp
+ * @param pt_Stamp The Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t setCausalIndexEntry(
+    ITC_CausalIndex_t *const pt_Index,
+    const uint32_t u32_Slot,
+    const ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_CausalIndex_Entry_t *pt_Entry = &pt_Index->pt_Entries[u32_Slot];
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+
+    t_Status = validateStamp(pt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    /* The summary is only written on success */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_getCellBounds(
+            pt_NormalisedStamp->pt_Event,
+            ITC_CONFIG_CAUSAL_INDEX_DEPTH,
+            &pt_Entry->t_Summary.rt_Min[0],
+            &pt_Entry->t_Summary.rt_Max[0]);
+    }
+
+    releaseNormalisedStamp(&pt_StampCopy);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (!pt_Entry->pt_Stamp)
+        {
+            pt_Index->u32_Count++;
+        }
+
+        pt_Entry->pt_Stamp = pt_Stamp;
+
+        refreshCausalIndexBucket(
+            pt_Index, u32_Slot / ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Get the relation of an indexed Stamp to the queried Stamp, if it
+ * might be one of the relations the query looks for
+ *
+ * The Stamps are only compared in full if their summaries cannot settle the
+ * relation.
+ *
+ * @param pt_Query The state of the query
+ * @param pt_Entry The entry of the indexed Stamp
+ * @param pu32_Relation (out) The relation of the indexed Stamp to the queried
+ * Stamp, or `0` if it is certainly none of the relations the query looks for
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getCausalIndexEntryRelation(
+    ITC_CausalIndex_Query_t *const pt_Query,
+    const ITC_CausalIndex_Entry_t *const pt_Entry,
+    uint32_t *const pu32_Relation
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Stamp_Comparison_t t_Result;
+    uint32_t u32_Relations = getCausalIndexPossibleRelations(
+        &pt_Entry->t_Summary, &pt_Query->t_Summary);
+
+    if ((u32_Relations & pt_Query->u32_Relations) == 0)
+    {
+        *pu32_Relation = 0;
+    }
+    /* The summaries settle the relation */
+    else if ((u32_Relations & (u32_Relations - 1U)) == 0)
+    {
+        *pu32_Relation = u32_Relations;
+    }
+    else
+    {
+        /* Both Stamps have already been validated */
+        t_Status = compareStamps(
+            pt_Entry->pt_Stamp, pt_Query->pt_Stamp, &t_Result);
+        pt_Query->u32_Comparisons++;
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            *pu32_Relation = (uint32_t)t_Result;
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+
+/**
+ * @brief Subtract the Event of a base Stamp from a Stamp, or add it back
+ *
+ * @note On failure, the Stamp is left unmodified
+ * @param pt_Stamp The Stamp to rebase
+ * @param pt_Base The base Stamp
+ * @param b_Restore Whether to add the base back. Otherwise it is subtracted
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t rebaseStamp(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base,
+    const bool b_Restore
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedBase = NULL;
+    ITC_Stamp_t *pt_BaseCopy = NULL;
+    ITC_Event_t *pt_RebasedEvent = NULL;
+
+    t_Status = validateStamp(pt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Base);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = normaliseStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Base, &pt_BaseCopy, &pt_NormalisedBase);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The rebased Event is a new tree, so a shared Event is left
+         * untouched */
+        t_Status = ITC_Event_rebaseValidated(
+            pt_Stamp->pt_Event,
+            pt_NormalisedBase->pt_Event,
+            b_Restore,
+            &pt_RebasedEvent);
+    }
+
+    releaseNormalisedStamp(&pt_BaseCopy);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Ignore return status. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall
+         * operation was successful. */
+        (void)ITC_Event_destroy(&pt_Stamp->pt_Event);
+
+        pt_Stamp->pt_Event = pt_RebasedEvent;
+        resetInflationCache(pt_Stamp);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Get an existing ITC Stamp with the base it was rebased onto added
+ * back
+ *
+ * @param pt_Stamp The Stamp
+ * @param pt_Base The base Stamp `pt_Stamp` was rebased onto, or `NULL` if it
+ * was not rebased
+ * @param ppt_RestoredStamp (out) The restored copy of the Stamp. `NULL` if
+ * `pt_Base == NULL`, in which case `pt_Stamp` can be used as is
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newUnrebasedStamp(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base,
+    ITC_Stamp_t **const ppt_RestoredStamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    *ppt_RestoredStamp = NULL;
+
+    if (pt_Base)
+    {
+        t_Status = ITC_Stamp_clone(pt_Stamp, ppt_RestoredStamp);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = rebaseStamp(*ppt_RestoredStamp, pt_Base, true);
+        }
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* There is nothing else to do if the destroy fails. Also it is
+             * more important to convey the original failure */
+            (void)ITC_Stamp_destroy(ppt_RestoredStamp);
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/**
+ * @brief Validate an existing ITC Stamp and count the nodes of its ID and
+ * Event
+ *
+ * @param pt_Stamp The Stamp
+ * @param pu32_IdNodes (out) The number of nodes in the ID tree
+ * @param pu32_EventNodes (out) The number of nodes in the Event tree
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t countStampNodes(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_IdNodes,
+    uint32_t *const pu32_EventNodes
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateStamp(pt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_IdNodes = ITC_Id_countNodes(pt_Stamp->pt_Id);
+        *pu32_EventNodes = ITC_Event_countNodes(pt_Stamp->pt_Event);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Allocate a new ITC seed Stamp and initialise it
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_newSeed(
+    ITC_Stamp_t **const ppt_Stamp
+)
+{
+    if (!ppt_Stamp)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return newStampWithIdAndEvent(ppt_Stamp, NULL, NULL, false, false, false);
+}
+
+/******************************************************************************
+ * Allocate a new ITC peek Stamp based on an existing Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_newPeek(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_t **const ppt_PeekStamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_Event = NULL;
+
+    if (!ppt_PeekStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = copyStampEvent(pt_Stamp->pt_Event, &pt_Event);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStampWithIdAndEvent(
+            ppt_PeekStamp, NULL, pt_Event, true, false, false);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Ignore return status. It is more important to convey the
+             * original reason for the failure */
+            (void)ITC_Event_destroy(&pt_Event);
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Free an allocated ITC Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_destroy(
+    ITC_Stamp_t **const ppt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+
+    if (!ppt_Stamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (*ppt_Stamp)
+    {
+        if ((*ppt_Stamp)->pt_Event)
+        {
+            /* Destroy the Event tree */
+            t_FreeStatus = ITC_Event_destroy(&(*ppt_Stamp)->pt_Event);
+
+            if (t_FreeStatus != ITC_STATUS_SUCCESS)
+            {
+                t_Status = t_FreeStatus;
+            }
+        }
+
+        if ((*ppt_Stamp)->pt_Id)
+        {
+            /* Destroy the ID tree */
+            t_FreeStatus = ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+
+            if (t_FreeStatus != ITC_STATUS_SUCCESS)
+            {
+                t_Status = t_FreeStatus;
+            }
+        }
+
+        t_FreeStatus = ITC_PORT_FREE(
+            *ppt_Stamp, ITC_PORT_ALLOCTYPE_ITC_STAMP_T);
+
+        if (t_FreeStatus != ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Sanitize the freed pointer regardless of the exit status */
+        *ppt_Stamp = NULL;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Clone an existing ITC Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_clone(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_t **const ppt_ClonedStamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_Event = NULL;
+
+    if (!ppt_ClonedStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = copyStampEvent(pt_Stamp->pt_Event, &pt_Event);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStampWithIdAndEvent(
+            ppt_ClonedStamp, pt_Stamp->pt_Id, pt_Event, false, true, false);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Ignore return status. It is more important to convey the
+             * original reason for the failure */
+            (void)ITC_Event_destroy(&pt_Event);
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Validate a Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_validate(
+    const ITC_Stamp_t *const pt_Stamp
+)
+{
+    return validateStamp(pt_Stamp);
+}
+
+/******************************************************************************
+ * Fork an existing Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_fork(
+    ITC_Stamp_t **const ppt_Stamp,
+    ITC_Stamp_t **const ppt_OtherStamp
+)
+{
+    return forkStamp(ppt_Stamp, ppt_OtherStamp, false);
+}
+
+/******************************************************************************
+ * Add a new Event to the Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_event(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    return addEventsToStamp(pt_Stamp, 1, false);
+}
+
+/******************************************************************************
+ * Add a number of new Events to the Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_eventN(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Event_Counter_t t_EventCount
+)
+{
+    return addEventsToStamp(pt_Stamp, t_EventCount, false);
+}
+
+/******************************************************************************
+ * Join two existing Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_join(
+    ITC_Stamp_t **const ppt_Stamp,
+    ITC_Stamp_t **const ppt_OtherStamp
+)
+{
+    return joinStamps(ppt_Stamp, ppt_OtherStamp, false);
+}
+
+/******************************************************************************
+ * Join an array of existing Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_joinMany(
+    ITC_Stamp_t **const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    ITC_Stamp_t **const ppt_JoinedStamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_SummedId = NULL;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    t_Status = validateStampArray(
+        (const ITC_Stamp_t *const *)ppt_Stamps, u32_StampCount);
+
+    if (t_Status == ITC_STATUS_SUCCESS && !ppt_JoinedStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* All Event trees are about to be modified in place */
+    for (uint32_t u32_I = 0;
+         t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampCount;
+         u32_I++)
+    {
+        t_Status = unshareStampEvent(ppt_Stamps[u32_I]);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = sumStampIds(
+            (const ITC_Stamp_t *const *)ppt_Stamps,
+            u32_StampCount,
+            &pt_SummedId);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && pt_SummedId)
+    {
+        t_Status = internStampId(&pt_SummedId);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Join the Events in place with a balanced reduction, so each Event
+         * node takes part in at most `log2(u32_StampCount)` joins. All Events
+         * have been validated, so this cannot fail halfway through.
+         * On success, the joined Event ends up in the first Stamp.
+         * 64-bit indexes avoid wrapping around for huge Stamp counts */
+        for (uint64_t u64_Step = 1;
+             t_Status == ITC_STATUS_SUCCESS && u64_Step < u32_StampCount;
+             u64_Step *= 2)
+        {
+            for (uint64_t u64_I = 0;
+                 t_Status == ITC_STATUS_SUCCESS &&
+                 u64_I + u64_Step < u32_StampCount;
+                 u64_I += 2 * u64_Step)
+            {
+                t_Status = joinStampEvents(
+                    &ppt_Stamps[u64_I]->pt_Event,
+                    &ppt_Stamps[u64_I + u64_Step]->pt_Event);
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Replace the ID of the first Stamp, which becomes the joined Stamp,
+         * and destroy all other source Stamps.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall join
+         * operation was successful. */
+        if (pt_SummedId)
+        {
+            (void)ITC_Id_destroy(&ppt_Stamps[0]->pt_Id);
+            ppt_Stamps[0]->pt_Id = pt_SummedId;
+        }
+
+        resetInflationCache(ppt_Stamps[0]);
+        compactJoinedStamp(ppt_Stamps[0]);
+        *ppt_JoinedStamp = ppt_Stamps[0];
+        ppt_Stamps[0] = NULL;
+
+        for (uint32_t u32_I = 1; u32_I < u32_StampCount; u32_I++)
+        {
+            (void)ITC_Stamp_destroy(&ppt_Stamps[u32_I]);
+        }
+    }
+    else
+    {
+        /* Something went wrong, destroy anything that might have been created.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey the original reason
+         * for the failure, rather than the destroy failure. */
+        (void)ITC_Id_destroy(&pt_SummedId);
+    }
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_JOIN, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Join an array of Stamps similar to ::ITC_Stamp_joinMany() but do not modify
+ * the source Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_joinManyConst(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    ITC_Stamp_t **const ppt_JoinedStamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_SummedId = NULL;
+    ITC_Event_t *pt_JoinedEvent = NULL;
+    ITC_Event_t *pt_ClonedEvent = NULL;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    t_Status = validateStampArray(ppt_Stamps, u32_StampCount);
+
+    if (t_Status == ITC_STATUS_SUCCESS && !ppt_JoinedStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = sumStampIds(ppt_Stamps, u32_StampCount, &pt_SummedId);
+    }
+
+    /* A single Stamp has nothing to sum it with */
+    if (t_Status == ITC_STATUS_SUCCESS && !pt_SummedId)
+    {
+        t_Status = copyStampId(ppt_Stamps[0]->pt_Id, &pt_SummedId);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_cloneValidated(
+            ppt_Stamps[0]->pt_Event, &pt_JoinedEvent);
+    }
+
+    /* Join a copy of every other Event into the result in place. Unlike
+     * `ITC_Event_joinConst`, this does not create a new intermediate Event
+     * for every step */
+    for (uint32_t u32_I = 1;
+         t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampCount;
+         u32_I++)
+    {
+        t_Status = ITC_Event_cloneValidated(
+            ppt_Stamps[u32_I]->pt_Event, &pt_ClonedEvent);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = joinStampEvents(&pt_JoinedEvent, &pt_ClonedEvent);
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStampWithIdAndEvent(
+            ppt_JoinedStamp,
+            pt_SummedId,
+            pt_JoinedEvent,
+            false,
+            false,
+            false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        compactJoinedStamp(*ppt_JoinedStamp);
+    }
+    else
+    {
+        /* Something went wrong, destroy anything that might have been created.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey the original reason
+         * for the failure, rather than the destroy failure. */
+        (void)ITC_Id_destroy(&pt_SummedId);
+        (void)ITC_Event_destroy(&pt_JoinedEvent);
+        (void)ITC_Event_destroy(&pt_ClonedEvent);
+    }
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_JOIN, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Compare two existing Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_compare(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    ITC_Stamp_Comparison_t *const pt_Result
+
+)
+{
+    return compareTwoStamps(pt_Stamp1, pt_Stamp2, pt_Result, false);
+}
+
+/******************************************************************************
+ * Compare an existing Stamp against an array of existing Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_compareMany(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const *const ppt_OtherStamps,
+    const uint32_t u32_StampCount,
+    ITC_Stamp_Comparison_t *const pt_Results,
+    const ITC_Stamp_Executor_t *const pt_Executor
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Stamp_CompareManyJob_t t_Job;
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    if (!ppt_OtherStamps || u32_StampCount == 0 || !pt_Results ||
+        (pt_Executor && !pt_Executor->pf_Run))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Validate the shared Stamp only once */
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Job.pt_Stamp = pt_NormalisedStamp;
+        t_Job.ppt_OtherStamps = ppt_OtherStamps;
+        t_Job.pt_Results = pt_Results;
+        t_Job.u32_StampCount = u32_StampCount;
+        t_Job.u32_JobCount = 1;
+
+        if (pt_Executor && pt_Executor->u32_MaxJobs > 1)
+        {
+            /* Every job must have at least one Stamp to compare */
+            t_Job.u32_JobCount = (pt_Executor->u32_MaxJobs < u32_StampCount)
+                ? pt_Executor->u32_MaxJobs
+                : u32_StampCount;
+        }
+
+        if (t_Job.u32_JobCount > 1)
+        {
+            t_Status = pt_Executor->pf_Run(
+                pt_Executor->pv_UserData,
+                compareManyJob,
+                (void *)&t_Job,
+                t_Job.u32_JobCount);
+        }
+        else
+        {
+            /* Not worth dispatching */
+            t_Status = compareManyJob((void *)&t_Job, 0);
+        }
+    }
+
+    releaseNormalisedStamp(&pt_StampCopy);
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_COMPARE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Compact the Event of an existing Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_compact(
+    ITC_Stamp_t *const pt_Stamp,
+    const uint32_t u32_MaxDepth,
+    uint32_t *const pu32_ReclaimedNodes
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    uint32_t u32_NormalisedNodes = 0;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+    if (!pu32_ReclaimedNodes)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The Event tree is about to be modified in place */
+        t_Status = unshareStampEvent(pt_Stamp);
+    }
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Stamp->pt_Event->b_IsDirty)
+    {
+        /* The nodes released by the deferred normalisation are reclaimed
+         * too */
+        u32_NormalisedNodes = ITC_Event_countNodes(pt_Stamp->pt_Event);
+    }
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The compaction needs a normalised Event */
+        t_Status = normaliseStamp(pt_Stamp);
+    }
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    if (t_Status == ITC_STATUS_SUCCESS && u32_NormalisedNodes > 0)
+    {
+        u32_NormalisedNodes -= ITC_Event_countNodes(pt_Stamp->pt_Event);
+    }
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_compactValidated(
+            pt_Stamp->pt_Event,
+            pt_Stamp->pt_Id,
+            u32_MaxDepth,
+            pu32_ReclaimedNodes);
+    }
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_ReclaimedNodes += u32_NormalisedNodes;
+    }
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+    if (t_Status == ITC_STATUS_SUCCESS && *pu32_ReclaimedNodes > 0)
+    {
+        /* The cached leaf might have been collapsed */
+        resetInflationCache(pt_Stamp);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+
+/******************************************************************************
+ * Finish the normalisation of the Event of a Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_normalise(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateStamp(pt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = normaliseStamp(pt_Stamp);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+
+/******************************************************************************
+ * Rebase the Event of a Stamp onto a base Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_rebase(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base
+)
+{
+    return rebaseStamp(pt_Stamp, pt_Base, false);
+}
+
+/******************************************************************************
+ * Add the Event of a base Stamp back to a rebased Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_unrebase(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base
+)
+{
+    return rebaseStamp(pt_Stamp, pt_Base, true);
+}
+
+/******************************************************************************
+ * Compare two Stamps rebased onto possibly different bases
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_compareRebased(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Base1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    const ITC_Stamp_t *const pt_Base2,
+    ITC_Stamp_Comparison_t *const pt_Result
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Stamp_t *pt_RestoredStamp1 = NULL;
+    ITC_Stamp_t *pt_RestoredStamp2 = NULL;
+
+    if (!pt_Result)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    /* Subtracting the same base keeps the order of the Stamps */
+    else if (pt_Base1 == pt_Base2)
+    {
+        t_Status = ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, pt_Result);
+    }
+    else
+    {
+        t_Status = newUnrebasedStamp(pt_Stamp1, pt_Base1, &pt_RestoredStamp1);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status =
+                newUnrebasedStamp(pt_Stamp2, pt_Base2, &pt_RestoredStamp2);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Stamp_compare(
+                (pt_RestoredStamp1) ? pt_RestoredStamp1 : pt_Stamp1,
+                (pt_RestoredStamp2) ? pt_RestoredStamp2 : pt_Stamp2,
+                pt_Result);
+        }
+
+        /* Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey the result of the
+         * comparison */
+        (void)ITC_Stamp_destroy(&pt_RestoredStamp1);
+        (void)ITC_Stamp_destroy(&pt_RestoredStamp2);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/******************************************************************************
+ * Get the worst-case number of nodes forking a Stamp allocates
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_getForkNodeCount(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_NodeCount_t *const pt_NodeCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_IdNodes;
+    uint32_t u32_EventNodes;
+
+    if (!pt_NodeCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = countStampNodes(pt_Stamp, &u32_IdNodes, &u32_EventNodes);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Splitting an ID with `n` nodes results in at most `2n + 4` nodes,
+         * as `split(1) = ((1, 0), (0, 1))` is the only rule adding more than
+         * 2 nodes (plus any copied subtrees) per node. The other Stamp gets
+         * a copy of the Event */
+        pt_NodeCount->u32_IdNodes = 2U * u32_IdNodes + 4U;
+        pt_NodeCount->u32_EventNodes = u32_EventNodes;
+        pt_NodeCount->u32_StampNodes = 1;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the worst-case number of nodes adding events to a Stamp allocates
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_getEventNodeCount(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_NodeCount_t *const pt_NodeCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_IdNodes;
+    uint32_t u32_EventNodes;
+
+    if (!pt_NodeCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = countStampNodes(pt_Stamp, &u32_IdNodes, &u32_EventNodes);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Unsharing the Event, plus the temporary copies made by fill and
+         * grow. Filling never adds nodes, while growing expands at most one
+         * leaf into 3 nodes for each level of the ID tree */
+        pt_NodeCount->u32_IdNodes = 0;
+        pt_NodeCount->u32_EventNodes = 3U * u32_EventNodes + u32_IdNodes;
+        pt_NodeCount->u32_StampNodes = 0;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the worst-case number of nodes joining two Stamps allocates
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_getJoinNodeCount(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_OtherStamp,
+    ITC_Stamp_NodeCount_t *const pt_NodeCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_IdNodes;
+    uint32_t u32_EventNodes;
+    uint32_t u32_OtherIdNodes;
+    uint32_t u32_OtherEventNodes;
+
+    if (!pt_NodeCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = countStampNodes(pt_Stamp, &u32_IdNodes, &u32_EventNodes);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = countStampNodes(
+            pt_OtherStamp, &u32_OtherIdNodes, &u32_OtherEventNodes);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The Events are joined and the IDs are summed in place. Nodes are
+         * only allocated to unshare the Events, or to copy interned IDs */
+        pt_NodeCount->u32_IdNodes = u32_IdNodes + u32_OtherIdNodes;
+        pt_NodeCount->u32_EventNodes = u32_EventNodes + u32_OtherEventNodes;
+        pt_NodeCount->u32_StampNodes = 0;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+/******************************************************************************
+ * Serialise an existing ITC Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_serialiseStamp(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        pu8_Buffer,
+        pu32_BufferSize,
+        ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseStamp(
+            pt_NormalisedStamp, pu8_Buffer, pu32_BufferSize, true);
+    }
+
+    releaseNormalisedStamp(&pt_StampCopy);
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_SERIALISE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the size of an existing ITC Stamp once serialised
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_getSerialisedStampSize(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Size
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+    uint32_t u32_IdComponentLength;
+    uint32_t u32_EventComponentLength;
+
+    if (!pu32_Size)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getSerialisedStampSize(
+            pt_NormalisedStamp,
+            true,
+            &u32_IdComponentLength,
+            &u32_EventComponentLength,
+            pu32_Size);
+    }
+
+    releaseNormalisedStamp(&pt_StampCopy);
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/******************************************************************************
+ * Serialise an existing ITC Stamp in the compact format
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_serialiseStampCompact(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        pu8_Buffer,
+        pu32_BufferSize,
+        ITC_SERDES_COMPACT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseStampCompact(
+            pt_NormalisedStamp, pu8_Buffer, pu32_BufferSize);
+    }
+
+    releaseNormalisedStamp(&pt_StampCopy);
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_SERIALISE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the size of an existing ITC Stamp once serialised in the compact format
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_getSerialisedStampCompactSize(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Size
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+
+    if (!pu32_Size)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getSerialisedStampCompactSize(
+            pt_NormalisedStamp, pu32_Size);
+    }
+
+    releaseNormalisedStamp(&pt_StampCopy);
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+/******************************************************************************
+ * Deserialise an ITC Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_deserialiseStamp(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Stamp_t **const ppt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    /* The minimum size of the serialised data */
+    uint32_t u32_MinBufferSize =
+        ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    /* The version field selects the format */
+    const bool b_IsCompact = pu8_Buffer && u32_BufferSize &&
+        (pu8_Buffer[0] & ITC_SERDES_COMPACT_FORMAT_FLAG);
+
+    if (b_IsCompact)
+    {
+        u32_MinBufferSize =
+            ITC_SERDES_COMPACT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN;
+    }
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+    if (!ppt_Stamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer, &u32_BufferSize, u32_MinBufferSize, false);
+    }
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsCompact)
+    {
+        t_Status = deserialiseStampCompact(
+            pu8_Buffer, u32_BufferSize, ppt_Stamp);
+    }
+    else
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseStamp(
+            pu8_Buffer, u32_BufferSize, true, NULL, ppt_Stamp);
+    }
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_DESERIALISE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/******************************************************************************
+ * Get the worst-case number of nodes deserialising an ITC Stamp allocates
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_getDeserialisedStampNodeCount(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Stamp_NodeCount_t *const pt_NodeCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The minimum size of the serialised data */
+    uint32_t u32_MinBufferSize =
+        ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN;
+    uint32_t u32_IdOffset;
+    uint32_t u32_IdLength;
+    uint32_t u32_EventOffset;
+    uint32_t u32_EventLength;
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    /* The version field selects the format */
+    const bool b_IsCompact = pu8_Buffer && u32_BufferSize &&
+        (pu8_Buffer[0] & ITC_SERDES_COMPACT_FORMAT_FLAG);
+
+    if (b_IsCompact)
+    {
+        u32_MinBufferSize =
+            ITC_SERDES_COMPACT_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN;
+    }
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+    if (!pt_NodeCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer, &u32_BufferSize, u32_MinBufferSize, false);
+    }
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsCompact)
+    {
+        /* The trees are bit-packed. An ID with `n` nodes takes up at least
+         * `3n / 2` bits (1 bit per parent and 2 bits per leaf), while every
+         * Event node takes up at least 2 bits */
+        u32_EventLength = u32_BufferSize - (uint32_t)ITC_VERSION_MAJOR_LEN;
+        u32_IdLength = (u32_EventLength <= UINT32_MAX / 16U)
+                           ? (16U * u32_EventLength) / 3U
+                           : UINT32_MAX;
+        u32_EventLength = (u32_EventLength <= UINT32_MAX / 4U)
+                              ? 4U * u32_EventLength
+                              : UINT32_MAX;
+    }
+    else
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Every node takes up at least a byte */
+        t_Status = parseSerialisedStamp(
+            pu8_Buffer,
+            u32_BufferSize,
+            true,
+            NULL,
+            &u32_IdOffset,
+            &u32_IdLength,
+            &u32_EventOffset,
+            &u32_EventLength);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_NodeCount->u32_IdNodes = u32_IdLength;
+        pt_NodeCount->u32_EventNodes = u32_EventLength;
+        pt_NodeCount->u32_StampNodes = 1;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+/******************************************************************************
+ * Compare two serialised Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_compareSerialisedStamps(
+    const uint8_t *const pu8_Buffer1,
+    const uint32_t u32_BufferSize1,
+    const uint8_t *const pu8_Buffer2,
+    const uint32_t u32_BufferSize2,
+    ITC_Stamp_Comparison_t *const pt_Result
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_IdOffset;
+    uint32_t u32_IdLength;
+    uint32_t u32_EventOffset1;
+    uint32_t u32_EventLength1;
+    uint32_t u32_EventOffset2;
+    uint32_t u32_EventLength2;
+    bool b_IsLeq12; /* `Event1 <= Event2` */
+    bool b_IsLeq21; /* `Event2 <= Event1` */
+
+    if (!pt_Result)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer1,
+            &u32_BufferSize1,
+            ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+            false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer2,
+            &u32_BufferSize2,
+            ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+            false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = parseSerialisedStamp(
+            pu8_Buffer1,
+            u32_BufferSize1,
+            true,
+            NULL,
+            &u32_IdOffset,
+            &u32_IdLength,
+            &u32_EventOffset1,
+            &u32_EventLength1);
+    }
+
+    /* The ID is not needed for the comparison, but is still validated to
+     * reject the same Stamps as ::ITC_SerDes_deserialiseStamp() */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateSerialisedId(
+            &pu8_Buffer1[u32_IdOffset], u32_IdLength, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = parseSerialisedStamp(
+            pu8_Buffer2,
+            u32_BufferSize2,
+            true,
+            NULL,
+            &u32_IdOffset,
+            &u32_IdLength,
+            &u32_EventOffset2,
+            &u32_EventLength2);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateSerialisedId(
+            &pu8_Buffer2[u32_IdOffset], u32_IdLength, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check if `Event1 <= Event2` and `Event2 <= Event1` */
+        t_Status = ITC_SerDes_Util_leqSerialisedEvents(
+            &pu8_Buffer1[u32_EventOffset1],
+            u32_EventLength1,
+            &pu8_Buffer2[u32_EventOffset2],
+            u32_EventLength2,
+            false,
+            &b_IsLeq12,
+            &b_IsLeq21);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        getStampComparison(b_IsLeq12, b_IsLeq21, pt_Result);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Initialise a read-only view of a serialised ITC Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_initStampView(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_SerDes_StampView_t *const pt_View
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_SerDes_StampView_t t_View;
+
+    if (!pt_View)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_View.pu8_Buffer = pu8_Buffer;
+        t_View.u32_BufferSize = u32_BufferSize;
+
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer,
+            &t_View.u32_BufferSize,
+            ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+            false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = parseSerialisedStamp(
+            pu8_Buffer,
+            u32_BufferSize,
+            true,
+            NULL,
+            &t_View.u32_IdOffset,
+            &t_View.u32_IdLength,
+            &t_View.u32_EventOffset,
+            &t_View.u32_EventLength);
+    }
+
+    /* Validate both components up front, so reading them later is safe */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateSerialisedId(
+            &pu8_Buffer[t_View.u32_IdOffset], t_View.u32_IdLength, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateSerialisedEvent(
+            &pu8_Buffer[t_View.u32_EventOffset],
+            t_View.u32_EventLength,
+            false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pt_View = t_View;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Compare two serialised Stamps through their views
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_compareStampViews(
+    const ITC_SerDes_StampView_t *const pt_View1,
+    const ITC_SerDes_StampView_t *const pt_View2,
+    ITC_Stamp_Comparison_t *const pt_Result
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    bool b_IsLeq12; /* `Event1 <= Event2` */
+    bool b_IsLeq21; /* `Event2 <= Event1` */
+
+    if (!pt_View1 || !pt_View1->pu8_Buffer ||
+        !pt_View2 || !pt_View2->pu8_Buffer ||
+        !pt_Result)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check if `Event1 <= Event2` and `Event2 <= Event1` */
+        t_Status = ITC_SerDes_Util_leqSerialisedEvents(
+            &pt_View1->pu8_Buffer[pt_View1->u32_EventOffset],
+            pt_View1->u32_EventLength,
+            &pt_View2->pu8_Buffer[pt_View2->u32_EventOffset],
+            pt_View2->u32_EventLength,
+            false,
+            &b_IsLeq12,
+            &b_IsLeq21);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        getStampComparison(b_IsLeq12, b_IsLeq21, pt_Result);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Deserialise the Stamp a view points to into a new ITC Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_getStampFromView(
+    const ITC_SerDes_StampView_t *const pt_View,
+    ITC_Stamp_t **const ppt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    if (!pt_View || !pt_View->pu8_Buffer || !ppt_Stamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseStamp(
+            pt_View->pu8_Buffer,
+            pt_View->u32_BufferSize,
+            true,
+            NULL,
+            ppt_Stamp);
+    }
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_DESERIALISE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Serialise an array of existing ITC Stamps into a single buffer
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_serialiseStampBatch(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Offset = 0; /* The current offset into the buffer */
+    const ITC_Stamp_t *pt_NormalisedStamp;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+    uint32_t u32_BatchLength;
+    uint32_t u32_Length; /* The size of the current field */
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    if (!ppt_Stamps)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer,
+            pu32_BufferSize,
+            ITC_SERDES_STAMP_BATCH_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+            true);
+    }
+
+    /* Validate and size all Stamps before writing anything */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getSerialisedStampBatchSize(
+            ppt_Stamps, u32_StampCount, &u32_BatchLength);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && *pu32_BufferSize < u32_BatchLength)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Add the lib version (provided by build system c args) */
+        pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+
+        /* Increment offset. Leave space for the header */
+        u32_Offset += ITC_VERSION_MAJOR_LEN + sizeof(ITC_SerDes_Header_t);
+
+        /* Serialise the Stamp count */
+        u32_Length = u32_BatchLength - u32_Offset;
+        t_Status = u32ToNetwork(
+            u32_StampCount, &pu8_Buffer[u32_Offset], &u32_Length);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Add the batch header */
+        pu8_Buffer[ITC_VERSION_MAJOR_LEN] = (ITC_SerDes_Header_t)(
+            u32_Length & ITC_SERDES_STAMP_BATCH_COUNT_LEN_MASK);
+
+        /* Increment the offset */
+        u32_Offset += u32_Length;
+    }
+
+    /* Serialise the Stamps back to back, without their own version field */
+    for (uint32_t u32_I = 0;
+         t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampCount;
+         u32_I++)
+    {
+        t_Status = getNormalisedStamp(
+            ppt_Stamps[u32_I], &pt_StampCopy, &pt_NormalisedStamp);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            u32_Length = u32_BatchLength - u32_Offset;
+            t_Status = serialiseStamp(
+                pt_NormalisedStamp,
+                &pu8_Buffer[u32_Offset],
+                &u32_Length,
+                false);
+
+            releaseNormalisedStamp(&pt_StampCopy);
+
+            /* Increment the offset */
+            u32_Offset += u32_Length;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_SERIALISE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the size of an array of existing ITC Stamps once serialised as a batch
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_getSerialisedStampBatchSize(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    uint32_t *const pu32_Size
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Stamps || !pu32_Size)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getSerialisedStampBatchSize(
+            ppt_Stamps, u32_StampCount, pu32_Size);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Deserialise a batch of ITC Stamps into an array
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_deserialiseStampBatch(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Stamp_t **const ppt_Stamps,
+    uint32_t *const pu32_StampCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Offset = 0; /* The current offset into the buffer */
+    uint32_t u32_StampCount = 0;
+    uint32_t u32_Length; /* The size of the current field */
+    uint32_t u32_I = 0;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    if (!ppt_Stamps || !pu32_StampCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer,
+            &u32_BufferSize,
+            ITC_SERDES_STAMP_BATCH_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+            false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check the lib version */
+        t_Status = ITC_SerDes_Util_validateDesLibVersion(pu8_Buffer[0]);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment the offset */
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+
+        /* Get the `Stamp count` length from the batch header */
+        u32_Length = pu8_Buffer[u32_Offset];
+
+        /* The rest of the header bits are reserved */
+        if ((u32_Length & ~ITC_SERDES_STAMP_BATCH_COUNT_LEN_MASK) ||
+            (u32_Length < 1) ||
+            (u32_Length > sizeof(uint32_t)))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment the offset */
+        u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+        if (u32_Length > (u32_BufferSize - u32_Offset))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise the Stamp count */
+        t_Status = u32FromNetwork(
+            &pu8_Buffer[u32_Offset], u32_Length, &u32_StampCount);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Increment the offset */
+        u32_Offset += u32_Length;
+
+        if (u32_StampCount > *pu32_StampCount)
+        {
+            /* Let the caller know how big the array must be */
+            *pu32_StampCount = u32_StampCount;
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampCount)
+    {
+        if ((u32_BufferSize - u32_Offset) < ITC_SERDES_STAMP_MIN_BUFFER_LEN)
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+        else
+        {
+            t_Status = deserialiseStamp(
+                &pu8_Buffer[u32_Offset],
+                u32_BufferSize - u32_Offset,
+                false,
+                &u32_Length,
+                &ppt_Stamps[u32_I]);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += u32_Length;
+            u32_I++;
+        }
+    }
+
+    /* The last Stamp must take up the rest of the buffer. Otherwise,
+     * something has gone wrong */
+    if (t_Status == ITC_STATUS_SUCCESS && u32_Offset != u32_BufferSize)
+    {
+        t_Status = ITC_STATUS_CORRUPT_STAMP;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_StampCount = u32_StampCount;
+    }
+    else
+    {
+        /* There is nothing else to do if a destroy call fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy, so ignore return statuses */
+        while (u32_I > 0)
+        {
+            u32_I--;
+            (void)ITC_Stamp_destroy(&ppt_Stamps[u32_I]);
+        }
+    }
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_DESERIALISE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+
+/******************************************************************************
+ * Initialise a Stamp decoder
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_initStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Decoder)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        initStampDecoder(pt_Decoder);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Feed the next part of a serialised Stamp to a Stamp decoder
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_feedStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Decoder)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer, &u32_BufferSize, sizeof(uint8_t), false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the status of the first failed feed, if any */
+        t_Status = pt_Decoder->t_Status;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = feedStampDecoder(pt_Decoder, pu8_Buffer, u32_BufferSize);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Release the partially deserialised trees and remember the
+             * failure */
+            ITC_SerDes_Util_resetIdDecoder(&pt_Decoder->t_IdDecoder);
+            ITC_SerDes_Util_resetEventDecoder(&pt_Decoder->t_EventDecoder);
+            pt_Decoder->t_Status = t_Status;
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the Stamp deserialised by a Stamp decoder
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_finishStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder,
+    ITC_Stamp_t **const ppt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Decoder || !ppt_Stamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        /* Return the status of the first failed feed, if any */
+        t_Status = pt_Decoder->t_Status;
+
+        /* The decoder has not been fed a whole Stamp */
+        if (t_Status == ITC_STATUS_SUCCESS &&
+            pt_Decoder->u8_Field != ITC_SERDES_STAMP_DECODER_FIELD_END)
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = newStampWithIdAndEvent(
+                ppt_Stamp,
+                pt_Decoder->t_IdDecoder.pt_Root,
+                pt_Decoder->t_EventDecoder.pt_Root,
+                false,
+                false,
+                false);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* The trees are now owned by the Stamp */
+            pt_Decoder->t_IdDecoder.pt_Root = NULL;
+            pt_Decoder->t_EventDecoder.pt_Root = NULL;
+        }
+
+        /* Get ready for the next Stamp */
+        ITC_SerDes_Util_resetIdDecoder(&pt_Decoder->t_IdDecoder);
+        ITC_SerDes_Util_resetEventDecoder(&pt_Decoder->t_EventDecoder);
+        initStampDecoder(pt_Decoder);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Reset a Stamp decoder
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_resetStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Decoder)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        ITC_SerDes_Util_resetIdDecoder(&pt_Decoder->t_IdDecoder);
+        ITC_SerDes_Util_resetEventDecoder(&pt_Decoder->t_EventDecoder);
+        initStampDecoder(pt_Decoder);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/******************************************************************************
+ * Serialise an existing ITC Stamp to string
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_serialiseStampToString(
+    const ITC_Stamp_t *const pt_Stamp,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        (uint8_t *)&pc_Buffer[0],
+        pu32_BufferSize,
+        ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN,
+        true);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseStampToString(
+            pt_NormalisedStamp, NULL, &pc_Buffer[0], pu32_BufferSize);
+    }
+
+    releaseNormalisedStamp(&pt_StampCopy);
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_SERIALISE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Serialise the Stamp a view points to to string
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_serialiseStampViewToString(
+    const ITC_SerDes_StampView_t *const pt_View,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_View || !pt_View->pu8_Buffer)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            (uint8_t *)&pc_Buffer[0],
+            pu32_BufferSize,
+            ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN,
+            true);
+    }
+
+    /* The view was validated when it was initialised */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = serialiseStampToString(
+            NULL, pt_View, &pc_Buffer[0], pu32_BufferSize);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the length of an existing ITC Stamp once serialised to string
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_getStampStringLength(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Length
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+    uint32_t u32_IdLength;
+    uint32_t u32_EventLength;
+
+    if (!pu32_Length)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_getIdStringLength(pt_Stamp->pt_Id, &u32_IdLength);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_getEventStringLength(
+            pt_NormalisedStamp->pt_Event, &u32_EventLength);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Only keep a single NULL termination byte */
+        *pu32_Length = (u32_IdLength - 1) + (u32_EventLength - 1) +
+                       ITC_SER_TO_STR_STAMP_DELIMITERS_LEN + 1;
+    }
+
+    releaseNormalisedStamp(&pt_StampCopy);
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Serialise an existing ITC Stamp to string through a writer
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_writeStampString(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+
+#if ITC_CONFIG_ENABLE_STATS
+    const uint32_t u32_StatsMarker = ITC_Port_statsBeginOperation();
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    if (!pfn_Writer)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = writeStampString(pt_NormalisedStamp, pfn_Writer, pv_Context);
     }
 
+    releaseNormalisedStamp(&pt_StampCopy);
+
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_statsEndOperation(
+        ITC_PORT_OPERATION_SERIALISE, u32_StatsMarker, t_Status);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
     return t_Status;
 }
 
-/******************************************************************************
- * Public functions
- ******************************************************************************/
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
 
 /******************************************************************************
- * Allocate a new ITC seed Stamp and initialise it
+ * Allocate a new ITC Stamp, initialising it with a copy of the passed ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_newSeed(
+ITC_Status_t ITC_Stamp_newFromId(
+    ITC_Id_t *const pt_Id,
     ITC_Stamp_t **const ppt_Stamp
 )
 {
-    if (!ppt_Stamp)
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Id || !ppt_Stamp)
     {
-        return ITC_STATUS_INVALID_PARAM;
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    return newStampWithIdAndEvent(ppt_Stamp, NULL, NULL, false, false, false);
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_validate(pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStampWithIdAndEvent(
+            ppt_Stamp, pt_Id, NULL, false, true, false);
+    }
+
+    return t_Status;
 }
 
 /******************************************************************************
- * Allocate a new ITC peek Stamp based on an existing Stamp
+ * Allocate a new ITC Stamp, initialising it with a copy of the passed ID and Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_newPeek(
-    const ITC_Stamp_t *const pt_Stamp,
-    ITC_Stamp_t **const ppt_PeekStamp
+ITC_Status_t ITC_Stamp_newFromIdAndEvent(
+    ITC_Id_t *const pt_Id,
+    ITC_Event_t *const pt_Event,
+    ITC_Stamp_t **const ppt_Stamp
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_PeekStamp)
+    if (!pt_Id || !pt_Event || !ppt_Stamp)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(pt_Stamp);
+        t_Status = ITC_Id_validate(pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_validate(pt_Event);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
         t_Status = newStampWithIdAndEvent(
-            ppt_PeekStamp, NULL, pt_Stamp->pt_Event, true, false, true);
+            ppt_Stamp, pt_Id, pt_Event, false, true, true);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Free an allocated ITC Stamp
+ * Allocate a new ITC peek Stamp, initialising it with a copy of the passed Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_destroy(
+ITC_Status_t ITC_Stamp_newPeekFromEvent(
+    ITC_Event_t *const pt_Event,
     ITC_Stamp_t **const ppt_Stamp
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
 
-    if (!ppt_Stamp)
+    if (!pt_Event || !ppt_Stamp)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
-    else if (*ppt_Stamp)
-    {
-        if ((*ppt_Stamp)->pt_Event)
-        {
-            /* Destroy the Event tree */
-            t_FreeStatus = ITC_Event_destroy(&(*ppt_Stamp)->pt_Event);
-
-            if (t_FreeStatus != ITC_STATUS_SUCCESS)
-            {
-                t_Status = t_FreeStatus;
-            }
-        }
-
-        if ((*ppt_Stamp)->pt_Id)
-        {
-            /* Destroy the ID tree */
-            t_FreeStatus = ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
-
-            if (t_FreeStatus != ITC_STATUS_SUCCESS)
-            {
-                t_Status = t_FreeStatus;
-            }
-        }
-
-        t_FreeStatus = ITC_Port_free(
-            *ppt_Stamp, ITC_PORT_ALLOCTYPE_ITC_STAMP_T);
 
-        if (t_FreeStatus != ITC_STATUS_SUCCESS)
-        {
-            t_Status = t_FreeStatus;
-        }
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_validate(pt_Event);
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Sanitize the freed pointer regardless of the exit status */
-        *ppt_Stamp = NULL;
+        t_Status = newStampWithIdAndEvent(
+            ppt_Stamp, NULL, pt_Event, true, false, true);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Clone an existing ITC Stamp
+ * Get a copy of the ID component of a Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_clone(
+ITC_Status_t ITC_Stamp_getId(
     const ITC_Stamp_t *const pt_Stamp,
-    ITC_Stamp_t **const ppt_ClonedStamp
+    ITC_Id_t **const ppt_Id
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_ClonedStamp)
-    {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
-
     if (t_Status == ITC_STATUS_SUCCESS)
     {
         t_Status = validateStamp(pt_Stamp);
@@ -996,420 +5098,451 @@ ITC_Status_t ITC_Stamp_clone(
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newStampWithIdAndEvent(
-            ppt_ClonedStamp,
-            pt_Stamp->pt_Id,
-            pt_Stamp->pt_Event,
-            false,
-            true,
-            true);
+        t_Status = ITC_Id_cloneValidated(pt_Stamp->pt_Id, ppt_Id);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Validate a Stamp
+ * Get a copy of the Event component of a Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_validate(
-    const ITC_Stamp_t *const pt_Stamp
+ITC_Status_t ITC_Stamp_getEvent(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Event_t **const ppt_Event
 )
 {
-    return validateStamp(pt_Stamp);
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_cloneValidated(pt_Stamp->pt_Event, ppt_Event);
+    }
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Only the copy is normalised. The Event API expects normalised
+         * Events */
+        t_Status = ITC_Event_normaliseDirty(*ppt_Event);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* There is nothing else to do if the destroy fails. Also it is
+             * more important to convey the original failure */
+            (void)ITC_Event_destroy(ppt_Event);
+        }
+    }
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+    return t_Status;
 }
 
 /******************************************************************************
- * Fork an existing Stamp
+ * Set the ID component of an existing Stamp.
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_fork(
-    ITC_Stamp_t **const ppt_Stamp,
-    ITC_Stamp_t **const ppt_OtherStamp
+ITC_Status_t ITC_Stamp_setId(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Id_t *const pt_Id
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t *pt_SplitId1 = NULL;
-    ITC_Id_t *pt_SplitId2 = NULL;
 
-    if (!ppt_Stamp || !ppt_OtherStamp)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_STATUS_INVALID_PARAM;
+        t_Status = validateStamp(pt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Init Stamp */
-        *ppt_OtherStamp = NULL;
+        t_Status = ITC_Id_validate(pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        resetInflationCache(pt_Stamp);
 
-        t_Status = validateStamp(*ppt_Stamp);
+        t_Status = ITC_Id_destroy(&pt_Stamp->pt_Id);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Split the ID */
-        t_Status = ITC_Id_splitConst(
-            (*ppt_Stamp)->pt_Id, &pt_SplitId1, &pt_SplitId2);
+        t_Status = ITC_Id_cloneValidated(pt_Id, &pt_Stamp->pt_Id);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Create the other Stamp and clone the Event component */
-        t_Status = newStampWithIdAndEvent(
-            ppt_OtherStamp,
-            pt_SplitId2,
-            (*ppt_Stamp)->pt_Event,
-            false,
-            false,
-            true);
+        t_Status = internStampId(&pt_Stamp->pt_Id);
+    }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Forget the ID. The Stamp now has "ownership" of it and its
-             * destruct function will deallocated it when needed */
-            pt_SplitId2 = NULL;
-        }
+    return t_Status;
+}
+
+/******************************************************************************
+ * Set the Event component of an existing Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_setEvent(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Event_t *const pt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Destroy the first Stamp ID.
-         * Ignore return status. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall fork
-         * operation was successful. */
-        (void)ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+        t_Status = ITC_Event_validate(pt_Event);
+    }
 
-        /* Replace with the first half of the split ID */
-        (*ppt_Stamp)->pt_Id = pt_SplitId1;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        resetInflationCache(pt_Stamp);
+
+        t_Status = ITC_Event_destroy(&pt_Stamp->pt_Event);
     }
-    else
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Deallocate the Stamp and IDs.
-         * Ignore return status. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey original reason for
-         * the failure, rather than the destroy failure */
-        (void)ITC_Stamp_destroy(ppt_OtherStamp);
-        (void)ITC_Id_destroy(&pt_SplitId1);
-        (void)ITC_Id_destroy(&pt_SplitId2);
+        t_Status = ITC_Event_cloneValidated(pt_Event, &pt_Stamp->pt_Event);
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+#if ITC_CONFIG_ENABLE_UNCHECKED_API
+
 /******************************************************************************
- * Add a new Event to the Stamp
+ * Fork an existing trusted Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_event(
+ITC_Status_t ITC_Stamp_forkUnchecked(
+    ITC_Stamp_t **const ppt_Stamp,
+    ITC_Stamp_t **const ppt_OtherStamp
+)
+{
+    return forkStamp(ppt_Stamp, ppt_OtherStamp, true);
+}
+
+/******************************************************************************
+ * Add a new Event to a trusted Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_eventUnchecked(
     ITC_Stamp_t *const pt_Stamp
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    bool b_WasFilled = false;
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateStamp(pt_Stamp);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = ITC_Event_fill(
-            &pt_Stamp->pt_Event, pt_Stamp->pt_Id, &b_WasFilled);
-    }
+    return addEventsToStamp(pt_Stamp, 1, true);
+}
+
+/******************************************************************************
+ * Add a number of new Events to a trusted Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_eventNUnchecked(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Event_Counter_t t_EventCount
+)
+{
+    return addEventsToStamp(pt_Stamp, t_EventCount, true);
+}
+
+/******************************************************************************
+ * Join two existing trusted Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_joinUnchecked(
+    ITC_Stamp_t **const ppt_Stamp,
+    ITC_Stamp_t **const ppt_OtherStamp
+)
+{
+    return joinStamps(ppt_Stamp, ppt_OtherStamp, true);
+}
+
+/******************************************************************************
+ * Compare two existing trusted Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_compareUnchecked(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    ITC_Stamp_Comparison_t *const pt_Result
+)
+{
+    return compareTwoStamps(pt_Stamp1, pt_Stamp2, pt_Result, true);
+}
 
-    if (t_Status == ITC_STATUS_SUCCESS && !b_WasFilled)
-    {
-        t_Status = ITC_Event_grow(&pt_Stamp->pt_Event, pt_Stamp->pt_Id);
-    }
+#endif /* ITC_CONFIG_ENABLE_UNCHECKED_API */
 
-    return t_Status;
-}
+#if ITC_CONFIG_ENABLE_PACKED_API
 
 /******************************************************************************
- * Join two existing Stamps
+ * Pack an existing ITC Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_join(
-    ITC_Stamp_t **const ppt_Stamp,
-    ITC_Stamp_t **const ppt_OtherStamp
+ITC_Status_t ITC_PackedStamp_fromStamp(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_PackedStamp_t *const pt_PackedStamp
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t *pt_SummedId = NULL;
-    ITC_Event_t *pt_JoinedEvent = NULL;
-    ITC_Stamp_t *pt_JoinedStamp = NULL;
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
 
-    if (!ppt_Stamp || !ppt_OtherStamp)
+    if (!pt_PackedStamp)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(*ppt_Stamp);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateStamp(*ppt_OtherStamp);
+        t_Status = validateStamp(pt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_Id_sumConst(
-            (*ppt_Stamp)->pt_Id, (*ppt_OtherStamp)->pt_Id, &pt_SummedId);
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_Event_joinConst(
-            (*ppt_Stamp)->pt_Event,
-            (*ppt_OtherStamp)->pt_Event,
-            &pt_JoinedEvent);
+        t_Status = ITC_PackedId_fromId(pt_Stamp->pt_Id, &pt_PackedStamp->t_Id);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newStamp(&pt_JoinedStamp);
+        t_Status = ITC_PackedEvent_fromEvent(
+            pt_NormalisedStamp->pt_Event, &pt_PackedStamp->t_Event);
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        /* Destroy the source Stamps
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall join
-         * operation was successful. */
-        (void)ITC_Stamp_destroy(ppt_Stamp);
-        (void)ITC_Stamp_destroy(ppt_OtherStamp);
-
-        /* Create the new Stamp. */
-        pt_JoinedStamp->pt_Event = pt_JoinedEvent;
-        pt_JoinedStamp->pt_Id = pt_SummedId;
-        /* Forget the ID and Event. The Stamp now has "ownership" */
-        pt_SummedId = NULL;
-        pt_JoinedEvent = NULL;
-
-        /* Return the joined Stamp */
-        *ppt_Stamp = pt_JoinedStamp;
-    }
-    else
-    {
-        /* Something went wrong, destroy anything that might have been created.
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey the original reason
-         * for the failure, rather than the destroy failure. */
-        (void)ITC_Id_destroy(&pt_SummedId);
-        (void)ITC_Event_destroy(&pt_JoinedEvent);
-        (void)ITC_Stamp_destroy(&pt_JoinedStamp);
-    }
+    releaseNormalisedStamp(&pt_StampCopy);
 
     return t_Status;
 }
 
 /******************************************************************************
- * Compare two existing Stamps
+ * Unpack a packed Stamp into a newly allocated ITC Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_compare(
-    const ITC_Stamp_t *const pt_Stamp1,
-    const ITC_Stamp_t *const pt_Stamp2,
-    ITC_Stamp_Comparison_t *const pt_Result
-
+ITC_Status_t ITC_PackedStamp_toStamp(
+    const ITC_PackedStamp_t *const pt_PackedStamp,
+    ITC_Stamp_t **const ppt_Stamp
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_Id = NULL;
+    ITC_Event_t *pt_Event = NULL;
 
-    if (!pt_Result)
+    if (!pt_PackedStamp || !ppt_Stamp)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(pt_Stamp1);
+        t_Status = ITC_PackedId_toId(&pt_PackedStamp->t_Id, &pt_Id);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(pt_Stamp2);
+        t_Status = ITC_PackedEvent_toEvent(&pt_PackedStamp->t_Event, &pt_Event);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Compare *pt_Stamp1 to *pt_Stamp2 */
-        t_Status = compareStamps(pt_Stamp1, pt_Stamp2, pt_Result);
+        t_Status = newStampWithIdAndEvent(
+            ppt_Stamp, pt_Id, pt_Event, false, false, false);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if a destroy call fails. Also it is more
+         * important to convey the unpacking failed, rather than the destroy,
+         * so ignore return statuses */
+        if (pt_Id)
+        {
+            (void)ITC_Id_destroy(&pt_Id);
+        }
+        if (pt_Event)
+        {
+            (void)ITC_Event_destroy(&pt_Event);
+        }
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+
 /******************************************************************************
- * Serialise an existing ITC Stamp
+ * Initialise an empty causal index
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_serialiseStamp(
-    const ITC_Stamp_t *const pt_Stamp,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize
+ITC_Status_t ITC_CausalIndex_init(
+    ITC_CausalIndex_t *const pt_Index
 )
 {
-    ITC_Status_t t_Status; /* The current status */
+    uint32_t u32_I;
 
-    t_Status = ITC_SerDes_Util_validateBuffer(
-        pu8_Buffer,
-        pu32_BufferSize,
-        ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
-        true);
+    if (!pt_Index || !pt_Index->pt_Entries || !pt_Index->pt_Buckets ||
+        pt_Index->u32_Capacity == 0)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    for (u32_I = 0; u32_I < pt_Index->u32_Capacity; u32_I++)
     {
-        t_Status = validateStamp(pt_Stamp);
+        pt_Index->pt_Entries[u32_I].pt_Stamp = NULL;
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    for (u32_I = 0;
+         u32_I < ITC_CAUSAL_INDEX_BUCKET_COUNT(pt_Index->u32_Capacity);
+         u32_I++)
     {
-        t_Status = serialiseStamp(pt_Stamp, pu8_Buffer, pu32_BufferSize);
+        pt_Index->pt_Buckets[u32_I].u32_Count = 0;
     }
 
-    return t_Status;
+    pt_Index->u32_Count = 0;
+
+    return ITC_STATUS_SUCCESS;
 }
 
 /******************************************************************************
- * Deserialise an ITC Stamp
+ * Add a Stamp to a causal index
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_deserialiseStamp(
-    const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    ITC_Stamp_t **const ppt_Stamp
+ITC_Status_t ITC_CausalIndex_insert(
+    ITC_CausalIndex_t *const pt_Index,
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Slot
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Slot = 0;
 
-    if (!ppt_Stamp)
+    if (!pt_Index || !pt_Index->pt_Entries || !pt_Index->pt_Buckets ||
+        !pu32_Slot)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
+    else if (pt_Index->u32_Count >= pt_Index->u32_Capacity)
     {
-        t_Status = ITC_SerDes_Util_validateBuffer(
-            pu8_Buffer,
-            &u32_BufferSize,
-            ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
-            false);
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = deserialiseStamp(pu8_Buffer, u32_BufferSize, ppt_Stamp);
-    }
-
-    return t_Status;
-}
-
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-
-/******************************************************************************
- * Serialise an existing ITC Stamp to string
- ******************************************************************************/
-
-ITC_Status_t ITC_SerDes_serialiseStampToString(
-    const ITC_Stamp_t *const pt_Stamp,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
-)
-{
-    ITC_Status_t t_Status; /* The current status */
+        /* Skip the full buckets. As the index is not full, there must be a
+         * free slot left */
+        while (pt_Index->pt_Buckets[
+                   u32_Slot / ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH].u32_Count ==
+               ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH)
+        {
+            u32_Slot += ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH;
+        }
 
-    t_Status = ITC_SerDes_Util_validateBuffer(
-        (uint8_t *)&pc_Buffer[0],
-        pu32_BufferSize,
-        ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN,
-        true);
+        while (pt_Index->pt_Entries[u32_Slot].pt_Stamp)
+        {
+            u32_Slot++;
+        }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateStamp(pt_Stamp);
+        t_Status = setCausalIndexEntry(pt_Index, u32_Slot, pt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = serialiseStampToString(
-            pt_Stamp, &pc_Buffer[0], pu32_BufferSize);
+        *pu32_Slot = u32_Slot;
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
-
-#if ITC_CONFIG_ENABLE_EXTENDED_API
-
 /******************************************************************************
- * Allocate a new ITC Stamp, initialising it with a copy of the passed ID
+ * Replace the Stamp in a slot of a causal index
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_newFromId(
-    ITC_Id_t *const pt_Id,
-    ITC_Stamp_t **const ppt_Stamp
+ITC_Status_t ITC_CausalIndex_update(
+    ITC_CausalIndex_t *const pt_Index,
+    const uint32_t u32_Slot,
+    const ITC_Stamp_t *const pt_Stamp
 )
 {
-    if (!pt_Id || !ppt_Stamp)
+    if (!pt_Index || !pt_Index->pt_Entries || !pt_Index->pt_Buckets ||
+        u32_Slot >= pt_Index->u32_Capacity ||
+        !pt_Index->pt_Entries[u32_Slot].pt_Stamp)
     {
         return ITC_STATUS_INVALID_PARAM;
     }
 
-    return newStampWithIdAndEvent(ppt_Stamp, pt_Id, NULL, false, true, false);
+    return setCausalIndexEntry(pt_Index, u32_Slot, pt_Stamp);
 }
 
 /******************************************************************************
- * Allocate a new ITC Stamp, initialising it with a copy of the passed ID and Event
+ * Remove the Stamp in a slot of a causal index
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_newFromIdAndEvent(
-    ITC_Id_t *const pt_Id,
-    ITC_Event_t *const pt_Event,
-    ITC_Stamp_t **const ppt_Stamp
+ITC_Status_t ITC_CausalIndex_remove(
+    ITC_CausalIndex_t *const pt_Index,
+    const uint32_t u32_Slot
 )
 {
-    if (!pt_Id || !pt_Event || !ppt_Stamp)
+    if (!pt_Index || !pt_Index->pt_Entries || !pt_Index->pt_Buckets ||
+        u32_Slot >= pt_Index->u32_Capacity ||
+        !pt_Index->pt_Entries[u32_Slot].pt_Stamp)
     {
         return ITC_STATUS_INVALID_PARAM;
     }
 
-    return newStampWithIdAndEvent(
-        ppt_Stamp, pt_Id, pt_Event, false, true, true);
-}
-
-/******************************************************************************
- * Allocate a new ITC peek Stamp, initialising it with a copy of the passed Event
- ******************************************************************************/
+    pt_Index->pt_Entries[u32_Slot].pt_Stamp = NULL;
+    pt_Index->u32_Count--;
 
-ITC_Status_t ITC_Stamp_newPeekFromEvent(
-    ITC_Event_t *const pt_Event,
-    ITC_Stamp_t **const ppt_Stamp
-)
-{
-    if (!pt_Event || !ppt_Stamp)
-    {
-        return ITC_STATUS_INVALID_PARAM;
-    }
+    refreshCausalIndexBucket(
+        pt_Index, u32_Slot / ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH);
 
-    return newStampWithIdAndEvent(ppt_Stamp, NULL, pt_Event, true, false, true);
+    return ITC_STATUS_SUCCESS;
 }
 
 /******************************************************************************
- * Get a copy of the ID component of a Stamp
+ * Start looking for the indexed Stamps with a given relation to a Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_getId(
+ITC_Status_t ITC_CausalIndex_beginQuery(
+    const ITC_CausalIndex_t *const pt_Index,
     const ITC_Stamp_t *const pt_Stamp,
-    ITC_Id_t **const ppt_Id
+    const uint32_t u32_Relations,
+    ITC_CausalIndex_Query_t *const pt_Query
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Stamp_t *pt_NormalisedStamp = NULL;
+    ITC_Stamp_t *pt_StampCopy = NULL;
+    const uint32_t u32_AllRelations =
+        (uint32_t)ITC_STAMP_COMPARISON_LESS_THAN |
+        (uint32_t)ITC_STAMP_COMPARISON_GREATER_THAN |
+        (uint32_t)ITC_STAMP_COMPARISON_EQUAL |
+        (uint32_t)ITC_STAMP_COMPARISON_CONCURRENT;
+
+    if (!pt_Index || !pt_Index->pt_Entries || !pt_Index->pt_Buckets ||
+        !pt_Query || u32_Relations == 0 || (u32_Relations & ~u32_AllRelations))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
@@ -1418,102 +5551,124 @@ ITC_Status_t ITC_Stamp_getId(
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_Id_clone(pt_Stamp->pt_Id, ppt_Id);
+        t_Status = getNormalisedStamp(
+            pt_Stamp, &pt_StampCopy, &pt_NormalisedStamp);
     }
 
-    return t_Status;
-}
-
-/******************************************************************************
- * Get a copy of the Event component of a Stamp
- ******************************************************************************/
-
-ITC_Status_t ITC_Stamp_getEvent(
-    const ITC_Stamp_t *const pt_Stamp,
-    ITC_Event_t **const ppt_Event
-)
-{
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(pt_Stamp);
+        t_Status = ITC_Event_getCellBounds(
+            pt_NormalisedStamp->pt_Event,
+            ITC_CONFIG_CAUSAL_INDEX_DEPTH,
+            &pt_Query->t_Summary.rt_Min[0],
+            &pt_Query->t_Summary.rt_Max[0]);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_Event_clone(pt_Stamp->pt_Event, ppt_Event);
+        pt_Query->pt_Index = pt_Index;
+        pt_Query->pt_Stamp = pt_Stamp;
+        pt_Query->u32_Relations = u32_Relations;
+        pt_Query->u32_NextSlot = 0;
+        pt_Query->u32_BucketRelation = 0;
+        pt_Query->u32_Comparisons = 0;
     }
 
+    releaseNormalisedStamp(&pt_StampCopy);
+
     return t_Status;
 }
 
 /******************************************************************************
- * Set the ID component of an existing Stamp.
+ * Find the next indexed Stamp matching a query
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_setId(
-    ITC_Stamp_t *const pt_Stamp,
-    const ITC_Id_t *const pt_Id
+ITC_Status_t ITC_CausalIndex_nextMatch(
+    ITC_CausalIndex_Query_t *const pt_Query,
+    uint32_t *const pu32_Slot,
+    ITC_Stamp_Comparison_t *const pt_Relation,
+    bool *const pb_Found
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateStamp(pt_Stamp);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
+    const ITC_CausalIndex_t *pt_Index;
+    const ITC_CausalIndex_Bucket_t *pt_Bucket;
+    uint32_t u32_Slot;
+    uint32_t u32_Relation;
+    bool b_SkipBucket;
+
+    if (!pt_Query || !pt_Query->pt_Index || !pu32_Slot || !pt_Relation ||
+        !pb_Found)
     {
-        t_Status = ITC_Id_validate(pt_Id);
+        return ITC_STATUS_INVALID_PARAM;
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = ITC_Id_destroy(&pt_Stamp->pt_Id);
-    }
+    pt_Index = pt_Query->pt_Index;
+    *pb_Found = false;
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    while (t_Status == ITC_STATUS_SUCCESS && !*pb_Found &&
+           pt_Query->u32_NextSlot < pt_Index->u32_Capacity)
     {
-        t_Status = ITC_Id_clone(pt_Id, &pt_Stamp->pt_Id);
-    }
-
-    return t_Status;
-}
-
-/******************************************************************************
- * Set the Event component of an existing Stamp
- ******************************************************************************/
+        u32_Slot = pt_Query->u32_NextSlot;
+        u32_Relation = 0;
+        b_SkipBucket = false;
 
-ITC_Status_t ITC_Stamp_setEvent(
-    ITC_Stamp_t *const pt_Stamp,
-    const ITC_Event_t *const pt_Event
-)
-{
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+        /* Entering a new bucket. Try to settle all of its Stamps at once */
+        if (u32_Slot % ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH == 0)
+        {
+            pt_Bucket = &pt_Index->pt_Buckets[
+                u32_Slot / ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH];
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateStamp(pt_Stamp);
-    }
+            if (pt_Bucket->u32_Count > 0)
+            {
+                u32_Relation = getCausalIndexPossibleRelations(
+                    &pt_Bucket->t_Summary, &pt_Query->t_Summary);
+            }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = ITC_Event_validate(pt_Event);
-    }
+            pt_Query->u32_BucketRelation =
+                ((u32_Relation & (u32_Relation - 1U)) == 0) ? u32_Relation : 0;
+            b_SkipBucket = (u32_Relation & pt_Query->u32_Relations) == 0;
+        }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = ITC_Event_destroy(&pt_Stamp->pt_Event);
-    }
+        /* None of the Stamps in the bucket can match */
+        if (b_SkipBucket)
+        {
+            pt_Query->u32_NextSlot =
+                (pt_Index->u32_Capacity - u32_Slot >
+                 ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH)
+                    ? u32_Slot + ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH
+                    : pt_Index->u32_Capacity;
+        }
+        else
+        {
+            pt_Query->u32_NextSlot++;
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = ITC_Event_clone(pt_Event, &pt_Stamp->pt_Event);
+            if (pt_Index->pt_Entries[u32_Slot].pt_Stamp)
+            {
+                if (pt_Query->u32_BucketRelation)
+                {
+                    u32_Relation = pt_Query->u32_BucketRelation;
+                }
+                else
+                {
+                    t_Status = getCausalIndexEntryRelation(
+                        pt_Query,
+                        &pt_Index->pt_Entries[u32_Slot],
+                        &u32_Relation);
+                }
+
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    (u32_Relation & pt_Query->u32_Relations))
+                {
+                    *pu32_Slot = u32_Slot;
+                    *pt_Relation = (ITC_Stamp_Comparison_t)u32_Relation;
+                    *pb_Found = true;
+                }
+            }
+        }
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
@@ -0,0 +1,50 @@
+/**
+ * @file ITC_Stamp_private.h
+ * @brief Private definitions for the Interval Tree Clock's Stamp mechanism
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_STAMP_PRIVATE_H_
+#define ITC_STAMP_PRIVATE_H_
+
+#include "ITC_Stamp.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+#if defined(__GNUC__)
+/** Keeps the stack frame of a function out of the frames of its callers */
+#define ITC_STAMP_NOINLINE                              __attribute__((noinline))
+#else
+/** Keeps the stack frame of a function out of the frames of its callers */
+#define ITC_STAMP_NOINLINE
+#endif /* defined(__GNUC__) */
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/** The state shared by all jobs of an `ITC_Stamp_compareMany` call. Only read
+ * by the jobs */
+typedef struct
+{
+    /** The already validated Stamp to compare against */
+    const ITC_Stamp_t *pt_Stamp;
+    /** The array of Stamps to compare */
+    const ITC_Stamp_t *const *ppt_OtherStamps;
+    /** The result of each comparison. Each job only writes the results of its
+     * own Stamps */
+    ITC_Stamp_Comparison_t *pt_Results;
+    /** The number of Stamps in `ppt_OtherStamps` */
+    uint32_t u32_StampCount;
+    /** The number of jobs the comparisons are split into */
+    uint32_t u32_JobCount;
+} ITC_Stamp_CompareManyJob_t;
+
+#endif /* ITC_STAMP_PRIVATE_H_ */
@@ -10,8 +10,10 @@
 #ifndef ITC_H_
 #define ITC_H_
 
+#include "ITC_CausalIndex.h"
 #include "ITC_Event.h"
 #include "ITC_Id.h"
+#include "ITC_Packed.h"
 #include "ITC_Stamp.h"
 #include "ITC_Status.h"
 #include "ITC_SerDes.h"
@@ -0,0 +1,267 @@
+/**
+ * @file ITC_CausalIndex.h
+ * @brief Definitions for the Interval Tree Clock's causal index
+ *
+ * The causal index answers which of a (large) set of Stamps are dominated by,
+ * dominate, are equal or concurrent to a given Stamp, without comparing it
+ * against each of them.
+ *
+ * For every Stamp, the index keeps a summary of its Event: the interval of the
+ * Event is split into `ITC_CAUSAL_INDEX_CELL_COUNT` equally sized cells, and
+ * the summary holds the lowest and highest absolute event count within each
+ * cell. If the highest count of every cell of one Event is `<=` the lowest
+ * count of the same cell of another Event, the first Event is `<=` the second
+ * one. If the lowest count of any cell is `>` the highest count of the same
+ * cell of the other Event, it is not. Only when the summaries cannot settle
+ * the relation are the full Events compared.
+ *
+ * The entries are grouped into buckets of
+ * `ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH` consecutive slots, each with a
+ * combined summary of its entries (the lowest minimum and highest maximum of
+ * each cell). A query settles a whole bucket at once where possible, so that
+ * none of its entries need to be looked at.
+ *
+ * The index only references the Stamps, it does not own them. An indexed
+ * Stamp must not be destroyed or modified (e.g. by adding an event or joining
+ * it) while it is in the index, unless its slot is updated with
+ * ::ITC_CausalIndex_update() or removed with ::ITC_CausalIndex_remove()
+ * right afterwards, before the index is queried again.
+ *
+ * The buffers holding the entries and buckets are owned by the caller. The
+ * index never allocates any memory, unless
+ * `ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION` is enabled and the Event of a
+ * Stamp still needs to be normalised (see `ITC_Stamp_normalise`).
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_CAUSAL_INDEX_H_
+#define ITC_CAUSAL_INDEX_H_
+
+#include "ITC_Config.h"
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+
+#include "ITC_Event.h"
+#include "ITC_Stamp.h"
+#include "ITC_Status.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/** The number of cells each Event summary is split into */
+#define ITC_CAUSAL_INDEX_CELL_COUNT                                            \
+    (1U << ITC_CONFIG_CAUSAL_INDEX_DEPTH)
+
+/**
+ * @brief The number of buckets needed by an index with a given capacity
+ *
+ * @param u32_Capacity The number of entries of the index
+ */
+#define ITC_CAUSAL_INDEX_BUCKET_COUNT(u32_Capacity)                            \
+    (((u32_Capacity) + ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH - 1U) /           \
+     ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH)
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/* The summary of one or more Events */
+typedef struct
+{
+    /** The lowest absolute event count within each cell */
+    ITC_Event_Counter_t rt_Min[ITC_CAUSAL_INDEX_CELL_COUNT];
+    /** The highest absolute event count within each cell */
+    ITC_Event_Counter_t rt_Max[ITC_CAUSAL_INDEX_CELL_COUNT];
+} ITC_CausalIndex_Summary_t;
+
+/* A single slot of the causal index */
+typedef struct
+{
+    /** The indexed Stamp. `NULL` if the slot is free */
+    const ITC_Stamp_t *pt_Stamp;
+    /** The summary of the Event of `pt_Stamp` */
+    ITC_CausalIndex_Summary_t t_Summary;
+} ITC_CausalIndex_Entry_t;
+
+/* A bucket of consecutive causal index slots */
+typedef struct
+{
+    /** The combined summary of the Events of all indexed Stamps in the bucket.
+     * Only valid if `u32_Count > 0` */
+    ITC_CausalIndex_Summary_t t_Summary;
+    /** The number of indexed Stamps in the bucket */
+    uint32_t u32_Count;
+} ITC_CausalIndex_Bucket_t;
+
+/* The causal index */
+typedef struct
+{
+    /** The buffer holding the slots of the index */
+    ITC_CausalIndex_Entry_t *pt_Entries;
+    /** The buffer holding the buckets of the index. Must have room for
+     * `ITC_CAUSAL_INDEX_BUCKET_COUNT(u32_Capacity)` buckets */
+    ITC_CausalIndex_Bucket_t *pt_Buckets;
+    /** The number of slots `pt_Entries` can hold */
+    uint32_t u32_Capacity;
+    /** The number of indexed Stamps */
+    uint32_t u32_Count;
+} ITC_CausalIndex_t;
+
+/* The state of a causal index query */
+typedef struct
+{
+    /** The queried index */
+    const ITC_CausalIndex_t *pt_Index;
+    /** The queried Stamp */
+    const ITC_Stamp_t *pt_Stamp;
+    /** The summary of the Event of `pt_Stamp` */
+    ITC_CausalIndex_Summary_t t_Summary;
+    /** The relations to look for. A combination of `ITC_Stamp_Comparison_t`
+     * values */
+    uint32_t u32_Relations;
+    /** The next slot to look at */
+    uint32_t u32_NextSlot;
+    /** The relation all Stamps in the current bucket have with `pt_Stamp`, or
+     * `0` if the Stamps in the current bucket must be looked at one by one */
+    uint32_t u32_BucketRelation;
+    /** The number of full Event comparisons done so far. Shows how well the
+     * summaries work for the indexed Stamps */
+    uint32_t u32_Comparisons;
+} ITC_CausalIndex_Query_t;
+
+/******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/**
+ * @brief Initialise an empty causal index
+ *
+ * @param pt_Index The index. `pt_Entries`, `pt_Buckets` and `u32_Capacity`
+ * must be set by the caller
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_CausalIndex_init(
+    ITC_CausalIndex_t *const pt_Index
+);
+
+/**
+ * @brief Add a Stamp to a causal index
+ *
+ * The Stamp takes the first free slot of the index.
+ *
+ * @note On failure, the index is left unmodified
+ * @param pt_Index The index
+ * @param pt_Stamp The Stamp to add. Must stay valid while it is in the index
+ * @param pu32_Slot (out) The slot of the Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the index is full
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * the Stamp cannot be represented
+ */
+ITC_Status_t ITC_CausalIndex_insert(
+    ITC_CausalIndex_t *const pt_Index,
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Slot
+);
+
+/**
+ * @brief Replace the Stamp in a slot of a causal index
+ *
+ * Must also be called after the Stamp in the slot was modified (e.g. joined
+ * with another Stamp), with the modified Stamp.
+ *
+ * @note On failure, the index is left unmodified
+ * @param pt_Index The index
+ * @param u32_Slot The slot. Must hold a Stamp
+ * @param pt_Stamp The new Stamp of the slot. Must stay valid while it is in
+ * the index
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the slot is free
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * the Stamp cannot be represented
+ */
+ITC_Status_t ITC_CausalIndex_update(
+    ITC_CausalIndex_t *const pt_Index,
+    const uint32_t u32_Slot,
+    const ITC_Stamp_t *const pt_Stamp
+);
+
+/**
+ * @brief Remove the Stamp in a slot of a causal index
+ *
+ * The Stamp itself is not modified, and can be destroyed afterwards.
+ *
+ * @param pt_Index The index
+ * @param u32_Slot The slot. Must hold a Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the slot is free
+ */
+ITC_Status_t ITC_CausalIndex_remove(
+    ITC_CausalIndex_t *const pt_Index,
+    const uint32_t u32_Slot
+);
+
+/**
+ * @brief Start looking for the indexed Stamps with a given relation to a
+ * Stamp
+ *
+ * The relation of an indexed Stamp is the result of comparing it to the
+ * queried Stamp with ::ITC_Stamp_compare(), e.g. the Stamps dominated by the
+ * queried Stamp are found with `ITC_STAMP_COMPARISON_LESS_THAN`. The matching
+ * Stamps are then retrieved with ::ITC_CausalIndex_nextMatch().
+ *
+ * @note The index must not be modified until the query is done. Several
+ * queries on the same index can be interleaved
+ * @param pt_Index The index
+ * @param pt_Stamp The queried Stamp. Must stay valid until the query is done
+ * @param u32_Relations The relations to look for. Any combination of
+ * `ITC_Stamp_Comparison_t` values
+ * @param pt_Query (out) The state of the query
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * the Stamp cannot be represented
+ */
+ITC_Status_t ITC_CausalIndex_beginQuery(
+    const ITC_CausalIndex_t *const pt_Index,
+    const ITC_Stamp_t *const pt_Stamp,
+    const uint32_t u32_Relations,
+    ITC_CausalIndex_Query_t *const pt_Query
+);
+
+/**
+ * @brief Find the next indexed Stamp matching a query
+ *
+ * The matches are found in slot order.
+ *
+ * @param pt_Query The state of the query
+ * @param pu32_Slot (out) The slot of the matching Stamp. Only set if a match
+ * was found
+ * @param pt_Relation (out) The relation of the matching Stamp to the queried
+ * Stamp. Only set if a match was found
+ * @param pb_Found (out) Whether a match was found. `false` once all matches
+ * have been found
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_CausalIndex_nextMatch(
+    ITC_CausalIndex_Query_t *const pt_Query,
+    uint32_t *const pu32_Slot,
+    ITC_Stamp_Comparison_t *const pt_Relation,
+    bool *const pb_Found
+);
+
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+
+#endif /* ITC_CAUSAL_INDEX_H_ */
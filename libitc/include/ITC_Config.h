@@ -23,6 +23,19 @@
  *   saturate in about 136 years.
  * - 64 bit counters allow for `2^64 - 1` events to be witnessed. If an event
  *   happens every nanosecond, this counter will saturate in about 584.5 years.
+ *
+ * The width is fixed at compile time and applies to every Event tree. It
+ * does not affect the serialised format, as each counter is serialised using
+ * only as many bytes as its value needs. Thus 32 and 64 bit builds can
+ * exchange Events and Stamps, as long as the counters fit in 32 bits, while a
+ * 32 bit build fails with `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` on
+ * bigger ones.
+ *
+ * @note On 64 bit platforms and in the default configuration, a regular
+ * Event node has the same size with either width, as the counter is padded
+ * to the alignment of the node pointers.
+ * The width only changes the node size on 32 bit platforms and in the packed
+ * representation (see `ITC_CONFIG_ENABLE_PACKED_API`).
 */
 #define ITC_CONFIG_USE_64BIT_EVENT_COUNTERS                                  (0)
 #endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
@@ -66,10 +79,21 @@
  * or Stamp. When enabled, the following functions become available as part of
  * the public API:
  * - `ITC_SerDes_serialiseStampToString`
+ * - `ITC_SerDes_serialiseStampViewToString`
+ * - `ITC_SerDes_getStampStringLength`
+ * - `ITC_SerDes_writeStampString`
  * - `ITC_SerDes_serialiseIdToString` (requires
  *        `ITC_CONFIG_ENABLE_EXTENDED_API` to also be enabled)
+ * - `ITC_SerDes_getIdStringLength` (requires
+ *        `ITC_CONFIG_ENABLE_EXTENDED_API` to also be enabled)
+ * - `ITC_SerDes_writeIdString` (requires
+ *        `ITC_CONFIG_ENABLE_EXTENDED_API` to also be enabled)
  * - `ITC_SerDes_serialiseEventToString` (requires
  *        `ITC_CONFIG_ENABLE_EXTENDED_API` to also be enabled)
+ * - `ITC_SerDes_getEventStringLength` (requires
+ *        `ITC_CONFIG_ENABLE_EXTENDED_API` to also be enabled)
+ * - `ITC_SerDes_writeEventString` (requires
+ *        `ITC_CONFIG_ENABLE_EXTENDED_API` to also be enabled)
  */
 #define ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API                            (0)
 #endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
@@ -80,10 +104,453 @@
  * - ITC_MEMORY_ALLOCATION_TYPE_MALLOC
  * - ITC_MEMORY_ALLOCATION_TYPE_STATIC
  * - ITC_MEMORY_ALLOCATION_TYPE_CUSTOM
+ * - ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST
+ * - ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+ * - ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
  *
  * See `ITC_Memory.h` for more information.
  */
 #define ITC_CONFIG_MEMORY_ALLOCATION_TYPE    (ITC_MEMORY_ALLOCATION_TYPE_MALLOC)
 #endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE */
 
+#ifndef ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS
+/** Enabling this setting makes the
+ * `ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST` allocator fill the free slots
+ * with a known pattern and validate it on every allocation and deallocation.
+ * This helps catch use-after-free and double free bugs, at the cost of
+ * touching the whole slot on every call.
+ *
+ * Has no effect when a different memory allocation type is used.
+ */
+#define ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS                           (0)
+#endif /* ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS */
+
+#ifndef ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH
+/** The number of free slots each thread can cache for each node type, when
+ * using the `ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST` allocator.
+ *
+ * Bigger magazines mean fewer trips to the shared global free lists, but also
+ * more free slots held back by each thread. Must be at least `2`.
+ *
+ * Has no effect when a different memory allocation type is used.
+ */
+#define ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH                     (16)
+#endif /* ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH */
+
+#if (ITC_CONFIG_MEMORY_ALLOCATION_TYPE == \
+     ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST) && \
+    (ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH < 2)
+/* A full magazine is flushed by half its length, which must free a slot */
+#error "ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH must be at least 2"
+#endif /* (ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST) && (ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH < 2) */
+
+#ifndef ITC_CONFIG_ENABLE_SCRATCH_ARENA
+/** Enabling this setting makes the temporary Event copies needed by the join
+ * operation get allocated from a scratch arena (using
+ * `ITC_PORT_ALLOCTYPE_SCRATCH`) instead of one by one from the regular Event
+ * nodes. The copies are bump-allocated and all of them are released at once
+ * with `ITC_Port_arenaReset` when the operation ends.
+ *
+ * The backup copies made by the fill and grow operations are not affected.
+ * These replace the original Event if the operation fails, so they are always
+ * allocated from the regular Event nodes.
+ *
+ * Depending on the chosen `ITC_CONFIG_MEMORY_ALLOCATION_TYPE`:
+ * - `ITC_MEMORY_ALLOCATION_TYPE_MALLOC` - the arena grows in chunks of
+ *   `ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH` nodes, which are kept for reuse
+ *   until `ITC_Port_fini` is called
+ * - `ITC_MEMORY_ALLOCATION_TYPE_STATIC`,
+ *   `ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST` and
+ *   `ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST` - requires the
+ *   `gpt_ItcScratchNodeAllocationArray` and
+ *   `gu32_ItcScratchNodeAllocationArrayLength` global variables to be defined
+ * - `ITC_MEMORY_ALLOCATION_TYPE_CONTEXT` - the arena is allocated from the
+ *   scratch node pool of the port context bound to the calling thread
+ * - `ITC_MEMORY_ALLOCATION_TYPE_CUSTOM` - requires the implementation of the
+ *   `ITC_Port_arenaBegin` and `ITC_Port_arenaReset` functions, as well as
+ *   handling `ITC_PORT_ALLOCTYPE_SCRATCH` in `ITC_Port_malloc` and
+ *   `ITC_Port_free`
+ *
+ * See `ITC_Port.h` for more information.
+ */
+#define ITC_CONFIG_ENABLE_SCRATCH_ARENA                                      (0)
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#ifndef ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH
+/** The number of Event nodes in each chunk of the scratch arena.
+ *
+ * Only used if `ITC_CONFIG_ENABLE_SCRATCH_ARENA` is enabled and
+ * `ITC_CONFIG_MEMORY_ALLOCATION_TYPE` is `ITC_MEMORY_ALLOCATION_TYPE_MALLOC`.
+ */
+#define ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH                               (32)
+#endif /* ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH */
+
+#ifndef ITC_CONFIG_ENABLE_PACKED_API
+/** Enabling this setting gives access to the packed (pointer-free) ID, Event
+ * and Stamp representations. These store the trees as flat pre-order arrays
+ * inside caller-provided buffers, using 2 bits per ID node and a single
+ * counter per Event node. When enabled, the following functions become
+ * available as part of the public API:
+ * - `ITC_PackedId_validate`
+ * - `ITC_PackedId_split`
+ * - `ITC_PackedId_sum`
+ * - `ITC_PackedEvent_validate`
+ * - `ITC_PackedEvent_leq`
+ * - `ITC_PackedEvent_join`
+ * - `ITC_PackedEvent_fill`
+ * - `ITC_PackedEvent_grow`
+ * - `ITC_PackedStamp_fromStamp`
+ * - `ITC_PackedStamp_toStamp`
+ * - `ITC_PackedId_fromId` (requires `ITC_CONFIG_ENABLE_EXTENDED_API` to also
+ *        be enabled)
+ * - `ITC_PackedId_toId` (requires `ITC_CONFIG_ENABLE_EXTENDED_API` to also be
+ *        enabled)
+ * - `ITC_PackedEvent_fromEvent` (requires `ITC_CONFIG_ENABLE_EXTENDED_API` to
+ *        also be enabled)
+ * - `ITC_PackedEvent_toEvent` (requires `ITC_CONFIG_ENABLE_EXTENDED_API` to
+ *        also be enabled)
+ *
+ * See `ITC_Packed.h` for more information.
+ */
+#define ITC_CONFIG_ENABLE_PACKED_API                                         (0)
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+/** Use the portable scalar kernels for the packed Event fast paths */
+#define ITC_PACKED_EVENT_SIMD_NONE                                           (0)
+/** Use the best SIMD kernels enabled by the compiler flags (e.g. `-mavx2`) */
+#define ITC_PACKED_EVENT_SIMD_NATIVE                                         (1)
+/** Detect the best SIMD kernels supported by the CPU at runtime */
+#define ITC_PACKED_EVENT_SIMD_RUNTIME_DISPATCH                               (2)
+
+#ifndef ITC_CONFIG_PACKED_EVENT_SIMD
+/** The kernels used by `ITC_PackedEvent_leq` and `ITC_PackedEvent_join` when
+ * both packed Events have the same shape (i.e. their parent nodes are
+ * stored at the same positions). The Events are then compared or joined
+ * element-wise, instead of walking the trees.
+ * Possible values:
+ * - `ITC_PACKED_EVENT_SIMD_NONE` - portable scalar kernels
+ * - `ITC_PACKED_EVENT_SIMD_NATIVE` - AVX2, SSE2 (32 bit counters only) or
+ *   AArch64 NEON kernels, depending on what the target the library is built
+ *   for supports. Falls back to the scalar kernels otherwise
+ * - `ITC_PACKED_EVENT_SIMD_RUNTIME_DISPATCH` - on x86, use the AVX2 kernels
+ *   if the CPU supports them and the `ITC_PACKED_EVENT_SIMD_NATIVE` kernels
+ *   otherwise. Requires GCC or Clang. Same as `ITC_PACKED_EVENT_SIMD_NATIVE`
+ *   on other targets
+ *
+ * Has no effect unless `ITC_CONFIG_ENABLE_PACKED_API` is enabled.
+ */
+#define ITC_CONFIG_PACKED_EVENT_SIMD                (ITC_PACKED_EVENT_SIMD_NONE)
+#endif /* ITC_CONFIG_PACKED_EVENT_SIMD */
+
+#ifndef ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+/** Enabling this setting makes each Stamp remember the Event leaf that
+ * `ITC_Stamp_event` inflated last, as long as adding another event is
+ * guaranteed to only increment that leaf again. Subsequent calls to
+ * `ITC_Stamp_event` then skip the fill and grow operations (and the Event
+ * copies they make) and directly increment the cached leaf instead.
+ *
+ * The cache is only set up for IDs owning a single contiguous interval, i.e.
+ * IDs with a single seed leaf, which is the case for Stamps created by
+ * forking. It is invalidated by any operation modifying the ID or Event of
+ * the Stamp outside of `ITC_Stamp_event` (e.g. `ITC_Stamp_setId`,
+ * `ITC_Stamp_setEvent`, `ITC_Stamp_fork` and `ITC_Stamp_join`).
+ *
+ * @warning The cache holds a pointer into the Event tree of the Stamp.
+ * Modifying the `pt_Event` or `pt_Id` members of an `ITC_Stamp_t` directly,
+ * instead of through the API, is not supported while this is enabled.
+ */
+#define ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE                              (0)
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+
+#ifndef ITC_CONFIG_ENABLE_STATS
+/** Enabling this setting makes libitc keep track of:
+ * - The number of live (currently allocated) and peak allocated nodes, as well
+ *   as the total number of allocations, frees and failed allocations, for each
+ *   `ITC_Port_AllocType_t`. For the static allocation types, the peak number
+ *   of nodes is the high-water mark of the corresponding allocation array
+ * - The number of calls, failed calls and nodes allocated during the calls of
+ *   the fork, event, join, compare, serialise and deserialise Stamp
+ *   operations
+ *
+ * The statistics can be read with `ITC_Port_getStats` and reset with
+ * `ITC_Port_resetStats`.
+ *
+ * @note If `ITC_CONFIG_MEMORY_ALLOCATION_TYPE` is
+ * `ITC_MEMORY_ALLOCATION_TYPE_CUSTOM`, the allocation statistics (and the
+ * number of nodes allocated by each operation) are not tracked and are always
+ * reported as `0`.
+ *
+ * See `ITC_Port.h` for more information.
+ */
+#define ITC_CONFIG_ENABLE_STATS                                              (0)
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+#ifndef ITC_CONFIG_ENABLE_TRACING
+/** Enabling this setting adds tracing hooks at the boundaries of the internal
+ * phases of the ID, Event and Stamp operations (e.g. the fill and grow phases
+ * of adding an event, or the clone and merge phases of joining two Events).
+ * Once a set of hooks is registered with `ITC_Port_setTraceHooks`, its begin
+ * callback is called when a phase starts, and its end callback is called with
+ * the size of the resulting tree when the phase ends. The hooks can then, for
+ * example, time the phases.
+ *
+ * When disabled, the hooks are compiled out completely.
+ *
+ * See `ITC_Port.h` for more information.
+ */
+#define ITC_CONFIG_ENABLE_TRACING                                            (0)
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+#ifndef ITC_CONFIG_ENABLE_NODE_RESERVATION
+/** Enabling this setting adds an API for reserving the nodes of upcoming
+ * operations up front. The worst-case number of nodes the fork, event, join
+ * and deserialise operations need can be queried with
+ * `ITC_Stamp_getForkNodeCount`, `ITC_Stamp_getEventNodeCount`,
+ * `ITC_Stamp_getJoinNodeCount` and
+ * `ITC_SerDes_getDeserialisedStampNodeCount`.
+ * The nodes are then reserved with a single call to `ITC_Port_mallocBatch`
+ * for each node type, using `ITC_Port_reserve`. While the reservation is
+ * bound to a thread with `ITC_Port_setReservation`, the operations of that
+ * thread allocate their nodes from the reservation only, so they can no
+ * longer run out of memory halfway through.
+ *
+ * If `ITC_CONFIG_MEMORY_ALLOCATION_TYPE` is
+ * `ITC_MEMORY_ALLOCATION_TYPE_CUSTOM`, this requires the implementation of
+ * the `ITC_Port_mallocBatch` and `ITC_Port_freeBatch` functions.
+ *
+ * See `ITC_Port.h` for more information.
+ */
+#define ITC_CONFIG_ENABLE_NODE_RESERVATION                                   (0)
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+#ifndef ITC_CONFIG_ENABLE_EVENT_REBASING
+/** Enabling this setting adds an API for rebasing the Event of a Stamp onto
+ * a base Stamp, such as a stable prefix all replicas are known to have
+ * witnessed. `ITC_Stamp_rebase` subtracts the Event of the base from the
+ * Event of a Stamp, so the event counters (and thus the serialised Stamp)
+ * shrink back to the events witnessed since the base. `ITC_Stamp_unrebase`
+ * adds the base back, while `ITC_Stamp_compareRebased` compares Stamps
+ * rebased onto different bases.
+ *
+ * Stamps rebased onto the same base can be forked, joined and compared with
+ * each other as usual.
+ */
+#define ITC_CONFIG_ENABLE_EVENT_REBASING                                     (0)
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+#ifndef ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+/** Enabling this setting adds support for the compact (v2) serialisation
+ * format. Instead of spending a whole byte on each node header, the compact
+ * format bit-packs the ID and Event trees and LEB128-encodes the event
+ * counters. The `ITC_VERSION_MAJOR` byte of data serialised in this format
+ * has its most significant bit set, which lets the deserialisation functions
+ * select the right decoder.
+ *
+ * Once enabled, Stamps (and, if `ITC_CONFIG_ENABLE_EXTENDED_API` is enabled,
+ * IDs and Events) can be serialised in the compact format with the
+ * `*Compact` serialisation functions. The regular deserialisation functions
+ * accept both formats.
+ *
+ * @note Functions operating directly on serialised data (e.g.
+ * `ITC_SerDes_compareSerialisedStamps`) only accept the default format.
+ *
+ * See `ITC_SerDes.h` for more information.
+ */
+#define ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT                              (0)
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+#ifndef ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+/** Enabling this setting adds a resumable Stamp decoder
+ * (`ITC_SerDes_StampDecoder_t`), which deserialises a Stamp from a sequence of
+ * partial buffers (e.g. network frames) as they arrive. The ID and Event trees
+ * are built incrementally, so the serialised Stamp never has to be reassembled
+ * into a single buffer first.
+ *
+ * @note The decoder only accepts the default serialisation format.
+ *
+ * See `ITC_SerDes.h` for more information.
+ */
+#define ITC_CONFIG_ENABLE_STREAMING_DESERIALISER                             (0)
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
+#ifndef ITC_CONFIG_ENABLE_UNCHECKED_API
+/** Enabling this setting adds unchecked variants of the most frequently used
+ * Stamp operations (`ITC_Stamp_forkUnchecked`, `ITC_Stamp_eventUnchecked`,
+ * `ITC_Stamp_eventNUnchecked`, `ITC_Stamp_joinUnchecked` and
+ * `ITC_Stamp_compareUnchecked`). These skip validating the ID and Event trees
+ * of the passed Stamps, which otherwise costs a full traversal of each tree on
+ * every call.
+ *
+ * @warning Only pass Stamps produced by libitc itself to the unchecked
+ * functions (e.g. Stamps returned by the other Stamp operations, or Stamps
+ * deserialised with `ITC_SerDes_deserialiseStamp`, which are fully validated
+ * while being deserialised). Passing a corrupt Stamp results in undefined
+ * behaviour. Keep using the regular functions for untrusted input.
+ */
+#define ITC_CONFIG_ENABLE_UNCHECKED_API                                      (0)
+#endif /* ITC_CONFIG_ENABLE_UNCHECKED_API */
+
+#ifndef ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+/** Enabling this setting makes `ITC_Stamp_fork`, `ITC_Stamp_clone` and
+ * `ITC_Stamp_newPeek` share the (immutable) Event tree of the source Stamp
+ * with the new Stamp, instead of copying it. This makes them O(1) in time and
+ * memory, regardless of the size of the Event tree. The shared tree is
+ * reference counted and only copied when one of the Stamps sharing it is
+ * modified (i.e. by `ITC_Stamp_event`, `ITC_Stamp_join` and their variants).
+ * Stamps that are only compared, serialised or destroyed never copy it.
+ *
+ * The reference count is updated atomically, so Stamps sharing an Event tree
+ * can be used from different threads.
+ *
+ * @note Requires a compiler supporting the GCC `__atomic` builtins.
+ *
+ * @warning Several Stamps may point to the same `pt_Event` while this is
+ * enabled. Modifying the `pt_Event` member of an `ITC_Stamp_t` (or the Event
+ * tree it points to) directly, instead of through the API, is not supported.
+ */
+#define ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS                               (0)
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+
+#ifndef ITC_CONFIG_ENABLE_ID_INTERNING
+/** Enabling this setting makes all Stamps with structurally equal IDs share a
+ * single, reference counted copy of the ID tree. The IDs of new Stamps (e.g.
+ * created by `ITC_Stamp_newSeed`, `ITC_Stamp_fork`, `ITC_Stamp_join` or
+ * deserialised) are looked up in a global intern table and replaced by the
+ * already interned ID if there is one. `ITC_Stamp_clone` and
+ * `ITC_Stamp_newPeek` then only need to take another reference to it.
+ *
+ * This is useful if many Stamps with the same few ID shapes are kept alive at
+ * the same time. Creating a Stamp ID costs an extra hash and lookup though.
+ * If the table is full, new IDs are simply not interned.
+ *
+ * Access to the intern table is serialised with a spinlock, so Stamps can be
+ * used from different threads.
+ *
+ * @note Requires a compiler supporting the GCC `__atomic` builtins.
+ *
+ * @warning The ID of a Stamp may be shared with other Stamps while this is
+ * enabled. Modifying the `pt_Id` member of an `ITC_Stamp_t` (or the ID tree it
+ * points to) directly, instead of through the API, is not supported. When
+ * using `ITC_MEMORY_ALLOCATION_TYPE_CONTEXT`, all Stamps must be allocated
+ * through the same port context. `ITC_Port_resetContext` empties the intern
+ * table.
+ */
+#define ITC_CONFIG_ENABLE_ID_INTERNING                                       (0)
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+
+#ifndef ITC_CONFIG_ID_INTERN_TABLE_LENGTH
+/** The maximum number of distinct IDs that can be interned at the same time.
+ * Must be a power of 2.
+ *
+ * Only used if `ITC_CONFIG_ENABLE_ID_INTERNING` is enabled.
+ */
+#define ITC_CONFIG_ID_INTERN_TABLE_LENGTH                                  (512)
+#endif /* ITC_CONFIG_ID_INTERN_TABLE_LENGTH */
+
+#ifndef ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+/** Enabling this setting defers the normalisation of the Event tree after
+ * `ITC_Stamp_join` and `ITC_Stamp_joinMany`. The nodes touched by the join are
+ * only marked as dirty. They get normalised by the next Stamp operation that
+ * modifies the Event (e.g. `ITC_Stamp_event`), or explicitly by calling
+ * `ITC_Stamp_normalise`. Only the dirty nodes are visited.
+ *
+ * This is useful when the same Stamp is joined with many other Stamps in a
+ * row, as the intermediate Event trees are never normalised.
+ *
+ * Read-only Stamp operations (e.g. `ITC_Stamp_compare` or
+ * `ITC_SerDes_serialiseStamp`) never modify the Stamp. If its Event still
+ * needs to be normalised, they work on a normalised copy of it instead, which
+ * allocates memory for every such operation. Call `ITC_Stamp_normalise` on
+ * joined Stamps that are going to be read many times to avoid this.
+ */
+#define ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION                           (0)
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+#ifndef ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+/** Enabling this setting caches the maximum event count of every parent Event
+ * subtree in the node itself. The cache is kept up to date by the Event
+ * operations and is used to:
+ * - Stop `leq` from walking the subtrees of the first Event, which are fully
+ *   covered by a leaf of the second Event (i.e. `max(e1) <= n2`)
+ * - Maximise the Event subtrees during `fill` without walking them first
+ *
+ * Event nodes built by hand (i.e. with `ITC_Event_new`) start off with an
+ * unknown maximum and are only walked as usual.
+ *
+ * This increases the size of each Event node by one `ITC_Event_Counter_t`.
+ */
+#define ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE                            (0)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
+#ifndef ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH
+/** The number of frames in the explicit stack used by the Event `leq`
+ * traversals (i.e. `ITC_Stamp_leq` and `ITC_Stamp_compare`). Setting this to
+ * `0` disables the explicit stack.
+ *
+ * By default, the Event trees are walked through their `pt_Parent` back-links,
+ * un-lifting the event counts on every level on the way back up. With the
+ * explicit stack, the next right subtree and its lifted event count are pushed
+ * when descending, so backtracking jumps straight to it. Event trees deeper
+ * than the stack are walked through the `pt_Parent` back-links as usual.
+ *
+ * The stack is not kept on the call stack but in a static array. It is
+ * thread-local if `ITC_CONFIG_MEMORY_ALLOCATION_TYPE` is
+ * `ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST` or
+ * `ITC_MEMORY_ALLOCATION_TYPE_CONTEXT`. Otherwise, it is **NOT** thread-safe
+ * and must be disabled when using `libitc` from multiple threads.
+ *
+ * Each frame takes up two pointers, two `ITC_Event_Counter_t`s and two flags.
+ */
+#define ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH                              (0)
+#endif /* ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH */
+
+#ifndef ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
+/** The depth from which the Event of every joined Stamp is compacted with
+ * `ITC_Stamp_compact`. Setting this to `0` disables the automatic compaction.
+ *
+ * Joins are where the Event trees of long-lived Stamps grow, as the joined
+ * Stamp takes over the (possibly deep) Event subtrees of the intervals its ID
+ * now owns. Compacting them right away keeps the Event trees, and their
+ * serialised size, bounded, at the cost of an extra walk over the Event tree
+ * on every join. The compaction inflates the joined Stamp, in the same way
+ * adding an event does.
+ *
+ * If `ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION` is enabled, the joined Event
+ * is normalised right away, as required by the compaction.
+ */
+#define ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH                               (0)
+#endif /* ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
+
+#ifndef ITC_CONFIG_ENABLE_CAUSAL_INDEX
+/** Enabling this setting adds `ITC_CausalIndex_t`, an index over a set of
+ * Stamps, which finds the Stamps that are dominated by, dominate, are equal
+ * or concurrent to a given Stamp without comparing it against each of them.
+ *
+ * See `ITC_CausalIndex.h` for more information.
+ */
+#define ITC_CONFIG_ENABLE_CAUSAL_INDEX                                       (0)
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+
+#ifndef ITC_CONFIG_CAUSAL_INDEX_DEPTH
+/** The depth of the summaries the causal index keeps of each Event. The
+ * interval of every Event is split into `2^depth` equally sized cells, and the
+ * index keeps the lowest and highest absolute event count of each cell. Deeper
+ * summaries settle more queries without a full Event comparison, but every
+ * index entry takes up `2 * 2^depth` event counters.
+ *
+ * Only used if `ITC_CONFIG_ENABLE_CAUSAL_INDEX` is enabled.
+ */
+#define ITC_CONFIG_CAUSAL_INDEX_DEPTH                                        (3)
+#endif /* ITC_CONFIG_CAUSAL_INDEX_DEPTH */
+
+#ifndef ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH
+/** The number of consecutive causal index entries summarised together. A query
+ * skips (or accepts) a whole bucket at once, if the combined summary of its
+ * entries already settles their relation to the queried Stamp.
+ *
+ * Only used if `ITC_CONFIG_ENABLE_CAUSAL_INDEX` is enabled.
+ */
+#define ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH                               (16)
+#endif /* ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH */
+
 #endif /* ITC_CONFIG_H_ */
@@ -13,6 +13,7 @@
 #include "ITC_Config.h"
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
 /* The ITC Event counter */
@@ -33,6 +34,22 @@ typedef struct ITC_Event_t
     struct ITC_Event_t *pt_Parent;
     /** Counts the number of events witnessed by this node in the event tree */
     ITC_Event_Counter_t t_Count;
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    /** The number of additional Stamps sharing this Event tree. Only used by
+     * the root node, `0` otherwise. Must not be modified by the user */
+    uint32_t u32_ShareCount;
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    /** Whether this subtree might not be normalised yet. Must not be modified
+     * by the user */
+    bool b_IsDirty;
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+    /** The maximum event count found in the subtrees of this node, relative
+     * to `t_Count` (i.e. `max(e) - n`). Only used by parent nodes. Must not be
+     * modified by the user */
+    ITC_Event_Counter_t t_ChildrenMax;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
 } ITC_Event_t;
 
 /* Late include. We need to define the types first */
@@ -74,13 +74,21 @@ ITC_Status_t ITC_Event_validate(
 /**
  * @brief Join two existing Events into a single Event
  *
+ * The join is performed in place - the joined Event is built from the nodes
+ * of both source Events and no new memory is allocated. Use
+ * ::ITC_Event_joinConst() if the source Events must be preserved.
+ *
  * @note On success, `ppt_OtherEvent` will be automatically deallocated to
  * prevent it from being used again accidentally (as well as to reduce developer
  * cleanup burden)
+ * @note On failure, both Events are left unmodified
  * @param ppt_Event (in) The first existing Event. (out) The joined Event
  * @param ppt_OtherEvent (in) The second existing Event. (out) NULL
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if both pointers refer to the same Event
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * either Event cannot be represented
  */
 ITC_Status_t ITC_Event_join(
     ITC_Event_t **const ppt_Event,
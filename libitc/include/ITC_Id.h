@@ -10,7 +10,10 @@
 #ifndef ITC_ID_H_
 #define ITC_ID_H_
 
+#include "ITC_Config.h"
+
 #include <stdbool.h>
+#include <stdint.h>
 
 /* The ITC ID */
 typedef struct ITC_Id_t
@@ -25,6 +28,14 @@ typedef struct ITC_Id_t
      * ID is owned by it (i.e. it can be used to inflate events) or not.
      * Parent (i.e. not leaf IDs) should always have this set to `false` */
     bool b_IsOwner;
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    /** Whether this ID tree is stored in the intern table. Only used by the
+     * root node, `false` otherwise. Must not be modified by the user */
+    bool b_IsInterned;
+    /** The number of additional references to this interned ID tree. Only used
+     * by the root node, `0` otherwise. Must not be modified by the user */
+    uint32_t u32_ShareCount;
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
 } ITC_Id_t;
 
 /* Late include. We need to define the types first */
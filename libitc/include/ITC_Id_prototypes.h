@@ -87,6 +87,8 @@ ITC_Status_t ITC_Id_validate(
 /**
  * @brief Split an existing ITC ID into two distinct (non-overlaping) ITC IDs
  *
+ * @note The nodes of the existing ID are reused by the two halves. On failure,
+ * the existing ID is left unmodified
  * @param ppt_Id (in) The existing ID. (out) The first split ID
  * @param ppt_OtherId (out) The second split ID
  * @return `ITC_Status_t` The status of the operation
@@ -102,7 +104,7 @@ ITC_Status_t ITC_Id_split(
  *
  * @note On success, `ppt_OtherId` will be automatically deallocated to prevent
  * it from being used again accidentally (as well as to reduce developer
- * cleanup burden)
+ * cleanup burden). The nodes of both IDs are reused by the summed ID
  * @param ppt_Id (in) The first existing ID. (out) The summed ID
  * @param ppt_OtherId (in) The second existing ID. (out) NULL
  * @return `ITC_Status_t` The status of the operation
@@ -51,4 +51,78 @@
  */
 #define ITC_MEMORY_ALLOCATION_TYPE_CUSTOM                                    (2)
 
+/** Same as `ITC_MEMORY_ALLOCATION_TYPE_STATIC` (i.e. requires the same global
+ * variables to be defined and `ITC_Port_init` to be called), but keeps the free
+ * slots of each array in an intrusive linked list, which makes allocating and
+ * deallocating ITC nodes `O(1)` instead of `O(n)`, where `n` is the length of
+ * the array.
+ *
+ * Because the link to the next free slot is stored inside the free slot
+ * itself, the contents of the free slots are not filled with a fixed pattern.
+ * See `ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS` in `ITC_Config.h` for
+ * enabling additional slot validation.
+ *
+ * @warning Same as `ITC_MEMORY_ALLOCATION_TYPE_STATIC`, this is inherently
+ * **NOT** thread-safe.
+ *
+ * See `ITC_Port.h` for more information.
+ */
+#define ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST                          (3)
+
+/** Same as `ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST` (i.e. requires the
+ * same global variables to be defined and `ITC_Port_init` to be called), but
+ * safe to use from multiple threads at the same time.
+ *
+ * The free slots of each array are kept in a lock-free global free list. In
+ * front of it, every thread keeps a small cache (a magazine) of free slots for
+ * each node type, so most allocations and deallocations do not touch the
+ * global free list at all. When a magazine runs empty, it gets refilled from
+ * the global free list. When it gets full, half of it is returned to the
+ * global free list. See `ITC_CONFIG_CONCURRENT_FREE_LIST_MAGAZINE_LENGTH` in
+ * `ITC_Config.h` for configuring the size of the magazines.
+ *
+ * Because the free slots cached by a thread can only be allocated by that
+ * thread, `ITC_Port_flushThreadCache` must be called before a thread using
+ * `libitc` exits. Otherwise, the slots in its magazines are lost until
+ * `ITC_Port_init` is called again.
+ *
+ * @note Requires a compiler supporting the GCC `__atomic` builtins and the
+ * `__thread` storage class (e.g. GCC or Clang).
+ *
+ * @warning `ITC_Port_init` and `ITC_Port_fini` are **NOT** thread-safe and
+ * must not be called while other threads are using `libitc`. The scratch arena
+ * (`ITC_CONFIG_ENABLE_SCRATCH_ARENA`) and the statistics
+ * (`ITC_CONFIG_ENABLE_STATS`) are **NOT** thread-safe either, and must be
+ * disabled when using `libitc` from multiple threads.
+ *
+ * See `ITC_Port.h` for more information.
+ */
+#define ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST                      (4)
+
+/** Allocate and deallocate ITC nodes through the port context bound to the
+ * calling thread (see `ITC_Port_Context_t`), instead of through a single set
+ * of global arrays. Each context either owns its own node pools, or provides
+ * its own allocation callbacks. The global variables required by
+ * `ITC_MEMORY_ALLOCATION_TYPE_STATIC` are not used.
+ *
+ * This allows, for example, each thread or shard of an application to have a
+ * private pool of nodes, and to release all the nodes allocated from it at
+ * once with `ITC_Port_resetContext`, instead of destroying every
+ * Stamp separately.
+ *
+ * A context must be bound to the calling thread with `ITC_Port_setContext`
+ * before working with `libitc`'s public API. Nodes must be deallocated through
+ * the same context they were allocated from.
+ *
+ * @note Requires a compiler supporting the `__thread` storage class (e.g. GCC
+ * or Clang).
+ *
+ * @warning A context must not be bound to more than one thread at the same
+ * time. The statistics (`ITC_CONFIG_ENABLE_STATS`) are shared by all contexts
+ * and are **NOT** thread-safe.
+ *
+ * See `ITC_Port.h` for more information.
+ */
+#define ITC_MEMORY_ALLOCATION_TYPE_CONTEXT                                   (5)
+
 #endif /* ITC_MEMORY_H_ */
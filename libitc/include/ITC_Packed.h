@@ -0,0 +1,330 @@
+/**
+ * @file ITC_Packed.h
+ * @brief Definitions for the Interval Tree Clock's packed (pointer-free) ID,
+ * Event and Stamp representations
+ *
+ * The packed representations store the ID and Event trees as flat arrays in
+ * pre-order (i.e. the root is stored first, followed by its left subtree, then
+ * its right subtree). The structure of the tree is implied by the order of the
+ * nodes, thus no pointers or indices need to be stored:
+ *  - Each packed ID node takes up 2 bits. 4 nodes are stored in each byte,
+ *    starting from the least significant bits.
+ *  - Each packed Event node takes up a single `ITC_Event_Counter_t`. Leaf
+ *    nodes hold their absolute event count (i.e. the sum of all counters on
+ *    the path from the root to the leaf), while parent nodes hold
+ *    `ITC_PACKED_EVENT_PARENT_NODE`. As a consequence, the absolute event count
+ *    of a leaf can never reach `ITC_PACKED_EVENT_PARENT_NODE`.
+ *
+ * The buffers holding the nodes are owned by the caller. All operations work
+ * directly on the packed data and never allocate any of the regular ID or
+ * Event nodes.
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_PACKED_H_
+#define ITC_PACKED_H_
+
+#include "ITC_Config.h"
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+
+#include "ITC_Id.h"
+#include "ITC_Event.h"
+#include "ITC_Stamp.h"
+#include "ITC_Status.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/** The number of packed ID nodes stored in each byte */
+#define ITC_PACKED_ID_NODES_PER_BYTE                                        (4U)
+
+/** The value of a parent node in a packed Event */
+#define ITC_PACKED_EVENT_PARENT_NODE                                           \
+    ((ITC_Event_Counter_t)~(ITC_Event_Counter_t)0)
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/* The packed ITC ID */
+typedef struct
+{
+    /** The buffer holding the ID nodes in pre-order */
+    uint8_t *pu8_Nodes;
+    /** The maximum number of nodes `pu8_Nodes` can hold. Must not exceed
+     * `ITC_PACKED_ID_NODES_PER_BYTE` times the size of the buffer in bytes */
+    uint32_t u32_Capacity;
+    /** The number of nodes in the packed ID */
+    uint32_t u32_Length;
+} ITC_PackedId_t;
+
+/* The packed ITC Event */
+typedef struct
+{
+    /** The buffer holding the Event nodes in pre-order */
+    ITC_Event_Counter_t *pt_Nodes;
+    /** The maximum number of nodes `pt_Nodes` can hold */
+    uint32_t u32_Capacity;
+    /** The number of nodes in the packed Event */
+    uint32_t u32_Length;
+} ITC_PackedEvent_t;
+
+/* The packed ITC Stamp */
+typedef struct
+{
+    /** The packed ITC ID */
+    ITC_PackedId_t t_Id;
+    /** The packed ITC Event */
+    ITC_PackedEvent_t t_Event;
+} ITC_PackedStamp_t;
+
+/******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
+/**
+ * @brief Pack an existing ITC ID
+ *
+ * @param pt_Id The ID to pack
+ * @param pt_PackedId The packed ID. `pu8_Nodes` and `u32_Capacity` must be
+ * set by the caller. On success, `u32_Length` holds the number of nodes used.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_PackedId_fromId(
+    const ITC_Id_t *const pt_Id,
+    ITC_PackedId_t *const pt_PackedId
+);
+
+/**
+ * @brief Unpack a packed ID into a newly allocated ITC ID
+ *
+ * @param pt_PackedId The packed ID
+ * @param ppt_Id (out) The pointer to the unpacked ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_PackedId_toId(
+    const ITC_PackedId_t *const pt_PackedId,
+    ITC_Id_t **const ppt_Id
+);
+
+/**
+ * @brief Pack an existing ITC Event
+ *
+ * @param pt_Event The Event to pack
+ * @param pt_PackedEvent The packed Event. `pt_Nodes` and `u32_Capacity` must
+ * be set by the caller. On success, `u32_Length` holds the number of nodes
+ * used.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the absolute event count of a
+ * leaf cannot be represented
+ */
+ITC_Status_t ITC_PackedEvent_fromEvent(
+    const ITC_Event_t *const pt_Event,
+    ITC_PackedEvent_t *const pt_PackedEvent
+);
+
+/**
+ * @brief Unpack a packed Event into a newly allocated ITC Event
+ *
+ * @param pt_PackedEvent The packed Event
+ * @param ppt_Event (out) The pointer to the unpacked Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_PackedEvent_toEvent(
+    const ITC_PackedEvent_t *const pt_PackedEvent,
+    ITC_Event_t **const ppt_Event
+);
+
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+/**
+ * @brief Validate a packed ID
+ *
+ * @param pt_PackedId The packed ID to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if the packed ID is not a valid normalised
+ * ID
+ */
+ITC_Status_t ITC_PackedId_validate(
+    const ITC_PackedId_t *const pt_PackedId
+);
+
+/**
+ * @brief Split a packed ID into two distinct (non-overlaping) packed IDs
+ *
+ * @param pt_PackedId The packed ID to split
+ * @param pt_PackedId1 The first half of the split ID. `pu8_Nodes` and
+ * `u32_Capacity` must be set by the caller
+ * @param pt_PackedId2 The second half of the split ID. `pu8_Nodes` and
+ * `u32_Capacity` must be set by the caller
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if a buffer is not big enough
+ */
+ITC_Status_t ITC_PackedId_split(
+    const ITC_PackedId_t *const pt_PackedId,
+    ITC_PackedId_t *const pt_PackedId1,
+    ITC_PackedId_t *const pt_PackedId2
+);
+
+/**
+ * @brief Sum two packed IDs into a single packed ID
+ *
+ * @param pt_PackedId1 The first packed ID
+ * @param pt_PackedId2 The second packed ID
+ * @param pt_PackedId The summed ID. `pu8_Nodes` and `u32_Capacity` must be
+ * set by the caller
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the IDs overlap
+ */
+ITC_Status_t ITC_PackedId_sum(
+    const ITC_PackedId_t *const pt_PackedId1,
+    const ITC_PackedId_t *const pt_PackedId2,
+    ITC_PackedId_t *const pt_PackedId
+);
+
+/**
+ * @brief Validate a packed Event
+ *
+ * @param pt_PackedEvent The packed Event to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the packed Event is not a valid
+ * normalised Event
+ */
+ITC_Status_t ITC_PackedEvent_validate(
+    const ITC_PackedEvent_t *const pt_PackedEvent
+);
+
+/**
+ * @brief Check if a packed Event is `less than or equal` (`<=`) to another
+ * packed Event
+ *
+ * If both packed Events have the same shape, their counters are compared
+ * element-wise (see `ITC_CONFIG_PACKED_EVENT_SIMD`).
+ *
+ * @param pt_PackedEvent1 The first packed Event
+ * @param pt_PackedEvent2 The second packed Event
+ * @param pb_IsLeq (out) `true` if `*pt_PackedEvent1 <= *pt_PackedEvent2`.
+ * Otherwise `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_PackedEvent_leq(
+    const ITC_PackedEvent_t *const pt_PackedEvent1,
+    const ITC_PackedEvent_t *const pt_PackedEvent2,
+    bool *const pb_IsLeq
+);
+
+/**
+ * @brief Join two packed Events into a new packed Event
+ *
+ * If both packed Events have the same shape and the joined Event can hold as
+ * many nodes as them, their counters are joined element-wise (see
+ * `ITC_CONFIG_PACKED_EVENT_SIMD`).
+ *
+ * @param pt_PackedEvent1 The first packed Event
+ * @param pt_PackedEvent2 The second packed Event
+ * @param pt_PackedEvent The joined Event. `pt_Nodes` and `u32_Capacity` must
+ * be set by the caller. Must not share its buffer with any of the other
+ * packed Events.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_PackedEvent_join(
+    const ITC_PackedEvent_t *const pt_PackedEvent1,
+    const ITC_PackedEvent_t *const pt_PackedEvent2,
+    ITC_PackedEvent_t *const pt_PackedEvent
+);
+
+/**
+ * @brief Fill a packed Event in place
+ *
+ * The filled Event never needs more nodes than the original Event.
+ *
+ * @param pt_PackedEvent The packed Event to fill
+ * @param pt_PackedId The packed ID showing the ownership information for the
+ * interval
+ * @param pb_WasFilled (out) Whether the Event was filled or not
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_PackedEvent_fill(
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    const ITC_PackedId_t *const pt_PackedId,
+    bool *const pb_WasFilled
+);
+
+/**
+ * @brief Grow a packed Event in place
+ *
+ * Growing the Event might need up to 2 more nodes for each level of the
+ * packed ID tree.
+ *
+ * @param pt_PackedEvent The packed Event to grow
+ * @param pt_PackedId The packed ID showing the ownership information for the
+ * interval
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the grown counter would
+ * overflow
+ */
+ITC_Status_t ITC_PackedEvent_grow(
+    ITC_PackedEvent_t *const pt_PackedEvent,
+    const ITC_PackedId_t *const pt_PackedId
+);
+
+/**
+ * @brief Pack an existing ITC Stamp
+ *
+ * @param pt_Stamp The Stamp to pack
+ * @param pt_PackedStamp The packed Stamp. The `pu8_Nodes`, `pt_Nodes` and
+ * `u32_Capacity` fields of the packed ID and Event must be set by the caller
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if a buffer is not big enough
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the absolute event count of a
+ * leaf cannot be represented
+ */
+ITC_Status_t ITC_PackedStamp_fromStamp(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_PackedStamp_t *const pt_PackedStamp
+);
+
+/**
+ * @brief Unpack a packed Stamp into a newly allocated ITC Stamp
+ *
+ * @param pt_PackedStamp The packed Stamp
+ * @param ppt_Stamp (out) The pointer to the unpacked Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_PackedStamp_toStamp(
+    const ITC_PackedStamp_t *const pt_PackedStamp,
+    ITC_Stamp_t **const ppt_Stamp
+);
+
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+#endif /* ITC_PACKED_H_ */
@@ -31,13 +31,263 @@ typedef enum {
     ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
     /** Corresponds to an `ITC_Stamp_t` */
     ITC_PORT_ALLOCTYPE_ITC_STAMP_T,
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /** Corresponds to a temporary `ITC_Event_t`, allocated from the scratch
+     * arena. Deallocating it is a no-op, as the memory is only released by
+     * `ITC_Port_arenaReset` */
+    ITC_PORT_ALLOCTYPE_SCRATCH,
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
 } ITC_Port_AllocType_t;
 
+#if ITC_CONFIG_ENABLE_STATS
+
+/**
+ * Enum used to specify which Stamp operation the statistics are for.
+ */
+typedef enum {
+    /** `ITC_Stamp_fork` */
+    ITC_PORT_OPERATION_FORK,
+    /** `ITC_Stamp_event` and `ITC_Stamp_eventN` */
+    ITC_PORT_OPERATION_EVENT,
+    /** `ITC_Stamp_join`, `ITC_Stamp_joinMany` and `ITC_Stamp_joinManyConst` */
+    ITC_PORT_OPERATION_JOIN,
+    /** `ITC_Stamp_compare` and `ITC_Stamp_compareMany` */
+    ITC_PORT_OPERATION_COMPARE,
+    /** `ITC_SerDes_serialiseStamp` and `ITC_SerDes_serialiseStampToString` */
+    ITC_PORT_OPERATION_SERIALISE,
+    /** `ITC_SerDes_deserialiseStamp` */
+    ITC_PORT_OPERATION_DESERIALISE,
+    /** The number of operations. Not a valid operation */
+    ITC_PORT_OPERATION_COUNT,
+} ITC_Port_Operation_t;
+
+/**
+ * The allocation statistics for a single `ITC_Port_AllocType_t`.
+ *
+ * @note All counters wrap around on overflow
+ */
+typedef struct
+{
+    /** The number of currently allocated nodes. For
+     * `ITC_PORT_ALLOCTYPE_SCRATCH`, the number of nodes currently in use in
+     * the scratch arena */
+    uint32_t u32_Live;
+    /** The largest value of `u32_Live` since the statistics were last reset */
+    uint32_t u32_Peak;
+    /** The total number of successful allocations */
+    uint32_t u32_Allocations;
+    /** The total number of successful frees. For
+     * `ITC_PORT_ALLOCTYPE_SCRATCH`, the total number of nodes released by
+     * `ITC_Port_arenaReset` */
+    uint32_t u32_Frees;
+    /** The total number of failed allocations */
+    uint32_t u32_FailedAllocations;
+} ITC_Port_AllocStats_t;
+
+/**
+ * The statistics for a single Stamp operation.
+ *
+ * @note All counters wrap around on overflow
+ */
+typedef struct
+{
+    /** The total number of calls */
+    uint32_t u32_Calls;
+    /** The total number of calls that did not return `ITC_STATUS_SUCCESS` */
+    uint32_t u32_FailedCalls;
+    /** The total number of nodes (of any type) allocated during the calls */
+    uint32_t u32_NodesAllocated;
+} ITC_Port_OperationStats_t;
+
+/**
+ * The statistics kept by libitc.
+ */
+typedef struct
+{
+    /** The `ITC_PORT_ALLOCTYPE_ITC_ID_T` allocation statistics */
+    ITC_Port_AllocStats_t t_Id;
+    /** The `ITC_PORT_ALLOCTYPE_ITC_EVENT_T` allocation statistics */
+    ITC_Port_AllocStats_t t_Event;
+    /** The `ITC_PORT_ALLOCTYPE_ITC_STAMP_T` allocation statistics */
+    ITC_Port_AllocStats_t t_Stamp;
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /** The `ITC_PORT_ALLOCTYPE_SCRATCH` allocation statistics */
+    ITC_Port_AllocStats_t t_Scratch;
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+    /** The statistics of each operation, indexed by `ITC_Port_Operation_t` */
+    ITC_Port_OperationStats_t rt_Operations[ITC_PORT_OPERATION_COUNT];
+} ITC_Port_Stats_t;
+
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/**
+ * Enum used to specify which internal phase of an operation is being traced.
+ *
+ * Phases may be nested (e.g. an Event fill phase happens during an event
+ * Stamp operation, after the Stamp validate phase has ended), but a phase
+ * never starts again before it has ended.
+ */
+typedef enum {
+    /** Validating the ID and Event trees of a Stamp. The tree size is the
+     * number of nodes in the Event tree */
+    ITC_PORT_TRACE_PHASE_STAMP_VALIDATE,
+    /** Making sure the Event tree of a Stamp is not shared before modifying
+     * it. Only traced if `ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS` is enabled.
+     * The tree size is the number of nodes in the Event tree */
+    ITC_PORT_TRACE_PHASE_STAMP_UNSHARE,
+    /** Filling an Event while adding events. The tree size is the number of
+     * nodes in the filled Event tree */
+    ITC_PORT_TRACE_PHASE_EVENT_FILL,
+    /** Growing an Event while adding events. The tree size is the number of
+     * nodes in the grown Event tree */
+    ITC_PORT_TRACE_PHASE_EVENT_GROW,
+    /** Cloning the source Events of a join that must not modify them. The
+     * tree size is the total number of nodes in both clones */
+    ITC_PORT_TRACE_PHASE_EVENT_JOIN_CLONE,
+    /** Merging two Events into the joined Event. Unless lazy Event
+     * normalisation is enabled, this includes normalising the joined nodes.
+     * The tree size is the number of nodes in the joined Event tree */
+    ITC_PORT_TRACE_PHASE_EVENT_JOIN_MERGE,
+    /** Normalising the dirty nodes of a lazily joined Event. The tree size is
+     * the number of nodes in the normalised Event tree */
+    ITC_PORT_TRACE_PHASE_EVENT_NORMALISE,
+    /** Compacting an Event. The tree size is the number of nodes in the
+     * compacted Event tree */
+    ITC_PORT_TRACE_PHASE_EVENT_COMPACT,
+    /** Comparing two Events. The tree size is the total number of nodes in
+     * both Event trees */
+    ITC_PORT_TRACE_PHASE_EVENT_COMPARE,
+    /** Splitting an ID. The tree size is the total number of nodes in both
+     * halves */
+    ITC_PORT_TRACE_PHASE_ID_SPLIT,
+    /** Summing two IDs. The tree size is the number of nodes in the summed
+     * ID tree */
+    ITC_PORT_TRACE_PHASE_ID_SUM,
+    /** The number of phases. Not a valid phase */
+    ITC_PORT_TRACE_PHASE_COUNT,
+} ITC_Port_TracePhase_t;
+
+/**
+ * The user-provided tracing hooks.
+ *
+ * The hooks are called from the libitc API calls and must not call back into
+ * libitc themselves.
+ */
+typedef struct
+{
+    /** Called when a phase begins. Can be `NULL` */
+    void (*pf_Begin)(
+        void *pv_UserData,
+        ITC_Port_TracePhase_t t_Phase);
+    /** Called when a phase ends, with the size of the tree the phase
+     * resulted in. See `ITC_Port_TracePhase_t` for what the size of each
+     * phase refers to. The size is `0` if the phase failed. Can be `NULL` */
+    void (*pf_End)(
+        void *pv_UserData,
+        ITC_Port_TracePhase_t t_Phase,
+        uint32_t u32_TreeSize);
+    /** User data passed to the hooks. Not used by libitc */
+    void *pv_UserData;
+} ITC_Port_TraceHooks_t;
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/**
+ * A pool of nodes of a single type, owned by a port context.
+ *
+ * Nodes that have never been allocated are bump-allocated from the end of the
+ * pool, while deallocated nodes are kept in a free list for reuse. Releasing
+ * all nodes of the pool at once is therefore `O(1)`.
+ */
+typedef struct
+{
+    /** The memory backing the pool. Must be suitably aligned for the type of
+     * the nodes */
+    void *pv_Nodes;
+    /** The number of nodes in the pool */
+    uint32_t u32_Length;
+    /** The number of nodes bump-allocated so far. Managed by libitc */
+    uint32_t u32_Top;
+    /** The first node in the free list of the pool. Managed by libitc */
+    void *pv_FreeListHead;
+} ITC_Port_ContextPool_t;
+
+/**
+ * A port context, through which ITC nodes get allocated and deallocated.
+ */
+typedef struct ITC_Port_Context_t
+{
+    /** Custom node allocation callback. If `NULL`, the nodes are allocated
+     * from the pools of the context instead */
+    ITC_Status_t (*pf_Malloc)(
+        struct ITC_Port_Context_t *pt_Context,
+        void **ppv_Ptr,
+        ITC_Port_AllocType_t t_AllocType);
+    /** Custom node deallocation callback. Must be set if `pf_Malloc` is set */
+    ITC_Status_t (*pf_Free)(
+        struct ITC_Port_Context_t *pt_Context,
+        void *pv_Ptr,
+        ITC_Port_AllocType_t t_AllocType);
+    /** User data for the custom callbacks. Not used by libitc */
+    void *pv_UserData;
+    /** The ID node pool. Holds `ITC_Id_t` nodes */
+    ITC_Port_ContextPool_t t_IdPool;
+    /** The Event node pool. Holds `ITC_Event_t` nodes */
+    ITC_Port_ContextPool_t t_EventPool;
+    /** The Stamp node pool. Holds `ITC_Stamp_t` nodes */
+    ITC_Port_ContextPool_t t_StampPool;
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /** The scratch arena node pool. Holds `ITC_Event_t` nodes. Its free list
+     * is not used */
+    ITC_Port_ContextPool_t t_ScratchPool;
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+} ITC_Port_Context_t;
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/**
+ * A pool of reserved nodes of a single type.
+ */
+typedef struct
+{
+    /** The buffer holding the pointers to the reserved nodes */
+    void **ppv_Nodes;
+    /** The number of pointers `ppv_Nodes` can hold */
+    uint32_t u32_Capacity;
+    /** The number of reserved nodes in the pool. Managed by libitc */
+    uint32_t u32_Count;
+} ITC_Port_ReservationPool_t;
+
+/**
+ * The nodes reserved for upcoming operations.
+ *
+ * The buffers of the pools are owned by the caller.
+ */
+typedef struct
+{
+    /** The reserved `ITC_Id_t` nodes */
+    ITC_Port_ReservationPool_t t_IdPool;
+    /** The reserved `ITC_Event_t` nodes */
+    ITC_Port_ReservationPool_t t_EventPool;
+    /** The reserved `ITC_Stamp_t` nodes */
+    ITC_Port_ReservationPool_t t_StampPool;
+} ITC_Port_Reservation_t;
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
 /******************************************************************************
  * Global variables
  ******************************************************************************/
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
 
 /* The array storing all allocated ITC Id nodes */
 extern ITC_Id_t *gpt_ItcIdNodeAllocationArray;
@@ -57,7 +307,17 @@ extern ITC_Stamp_t *gpt_ItcStampNodeAllocationArray;
 /* The length of the `gpt_ItcStampNodeAllocationArray` array */
 extern uint32_t gu32_ItcStampNodeAllocationArrayLength;
 
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+
+/* The array backing the scratch arena */
+extern ITC_Event_t *gpt_ItcScratchNodeAllocationArray;
+
+/* The length of the `gpt_ItcScratchNodeAllocationArray` array */
+extern uint32_t gu32_ItcScratchNodeAllocationArrayLength;
+
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
 
 /******************************************************************************
  * Functions
@@ -115,4 +375,385 @@ ITC_Status_t ITC_Port_free(
     ITC_Port_AllocType_t t_AllocType
 );
 
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+
+/**
+ * @brief Compact the static node allocation arrays
+ *
+ * Moves the live ID and Event nodes at the end of their allocation arrays
+ * into the free slots at the beginning, so that the free slots end up in one
+ * contiguous block, and updates the nodes and Stamps pointing to them.
+ *
+ * Stamp nodes are never moved, and neither are the roots of IDs and Events
+ * which are not owned by a Stamp (i.e. those created directly with the ID or
+ * Event API). Pointers to them stay valid. Pointers to any other ID or Event
+ * node are invalidated.
+ *
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_compact(void);
+
+/**
+ * @brief Get the size of a snapshot of the static node allocation arrays
+ *
+ * @param pu32_Size (out) The size of the snapshot in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_getSnapshotSize(
+    uint32_t *pu32_Size
+);
+
+/**
+ * @brief Take a snapshot of the static node allocation arrays
+ *
+ * Copies the ID, Event and Stamp node allocation arrays as they are, so they
+ * can be stored (e.g. in flash) and restored with ::ITC_Port_restore(),
+ * without serialising each Stamp.
+ *
+ * @note The snapshot uses the native byte order and node layout. It can only
+ * be restored by a build of `libitc` with the same configuration, on the same
+ * architecture, with allocation arrays of the same length
+ *
+ * @param pu8_Buffer The buffer to hold the snapshot
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the snapshot
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is too small.
+ * See ::ITC_Port_getSnapshotSize()
+ */
+ITC_Status_t ITC_Port_snapshot(
+    uint8_t *pu8_Buffer,
+    uint32_t *pu32_BufferSize
+);
+
+/**
+ * @brief Restore a snapshot of the static node allocation arrays
+ *
+ * Replaces the contents of the ID, Event and Stamp node allocation arrays
+ * with the snapshot, and rebases the pointers stored in the nodes onto the
+ * current arrays. All nodes allocated before the call are released. The
+ * restored Stamps keep their index in the Stamp node allocation array, i.e.
+ * `&gpt_ItcStampNodeAllocationArray[i]` is the Stamp that was at index `i`
+ * when the snapshot was taken.
+ *
+ * Every pointer is checked to point to a live node of the snapshot before
+ * anything is overwritten. The trees themselves are not validated (see
+ * ::ITC_Stamp_validate()).
+ *
+ * @param pu8_Buffer The buffer holding the snapshot
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION` if the snapshot was
+ * taken by a build with an incompatible configuration
+ * @retval `ITC_STATUS_CORRUPT_ID` if an ID node points outside the snapshot
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if an Event node points outside the
+ * snapshot
+ * @retval `ITC_STATUS_CORRUPT_STAMP` if a Stamp node points outside the
+ * snapshot
+ */
+ITC_Status_t ITC_Port_restore(
+    const uint8_t *pu8_Buffer,
+    uint32_t u32_BufferSize
+);
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+
+/**
+ * @brief Return the free slots cached by the calling thread
+ *
+ * Moves all free slots from the calling thread's magazines back to the global
+ * free lists, where they can be allocated by any thread. Must be called before
+ * a thread using `libitc` exits.
+ *
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_flushThreadCache(void);
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/**
+ * @brief Init a port context
+ *
+ * Validates the context and releases all nodes of its pools. Must be called
+ * after setting the `pv_Nodes` and `u32_Length` fields of the pools (or the
+ * custom callbacks) and before binding the context to a thread.
+ *
+ * @param pt_Context The context
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_initContext(
+    ITC_Port_Context_t *pt_Context
+);
+
+/**
+ * @brief Release all nodes allocated from the pools of a port context
+ *
+ * Releases the nodes in `O(1)`, regardless of how many nodes have been
+ * allocated. Any IDs, Events and Stamps allocated from the context become
+ * invalid and must not be used (or destroyed) afterwards.
+ *
+ * @note Only the scratch pool is reset for contexts with custom allocation
+ * callbacks. The released nodes are not recorded in the statistics
+ * @param pt_Context The context
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_resetContext(
+    ITC_Port_Context_t *pt_Context
+);
+
+/**
+ * @brief Bind a port context to the calling thread
+ *
+ * All nodes allocated or deallocated by the calling thread afterwards go
+ * through the context.
+ *
+ * @param pt_Context The context or `NULL` to unbind the current context
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_setContext(
+    ITC_Port_Context_t *pt_Context
+);
+
+/**
+ * @brief Get the port context bound to the calling thread
+ *
+ * @param ppt_Context (out) The context or `NULL` if no context is bound
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_getContext(
+    ITC_Port_Context_t **ppt_Context
+);
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+
+/**
+ * @brief Begin using the scratch arena
+ *
+ * Returns a marker of the current position in the scratch arena. All
+ * `ITC_PORT_ALLOCTYPE_SCRATCH` allocations made after this call can be
+ * released at once by passing the marker to `ITC_Port_arenaReset`.
+ * Calls can be nested, as long as the markers are reset in reverse order.
+ *
+ * @param pu32_Marker (out) The current position in the scratch arena
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_arenaBegin(
+    uint32_t *pu32_Marker
+);
+
+/**
+ * @brief Reset the scratch arena
+ *
+ * Releases all `ITC_PORT_ALLOCTYPE_SCRATCH` allocations made since the
+ * `ITC_Port_arenaBegin` call that returned the marker.
+ *
+ * @param u32_Marker The marker returned by `ITC_Port_arenaBegin`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_arenaReset(
+    uint32_t u32_Marker
+);
+
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/**
+ * @brief Allocate a batch of nodes
+ *
+ * Used by ::ITC_Port_reserve() to fill the pools of a reservation.
+ * Implemented by libitc on top of ::ITC_Port_malloc(), unless
+ * `ITC_CONFIG_MEMORY_ALLOCATION_TYPE` is `ITC_MEMORY_ALLOCATION_TYPE_CUSTOM`.
+ *
+ * @note On failure, no nodes must be allocated
+ * @param ppv_Ptrs (out) The pointers to the allocated nodes
+ * @param u32_Count The number of nodes to allocate
+ * @param t_AllocType The type of the nodes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_mallocBatch(
+    void **ppv_Ptrs,
+    uint32_t u32_Count,
+    ITC_Port_AllocType_t t_AllocType
+);
+
+/**
+ * @brief Deallocate a batch of nodes
+ *
+ * Used by ::ITC_Port_releaseReservation() to empty the pools of a
+ * reservation. Implemented by libitc on top of ::ITC_Port_free(), unless
+ * `ITC_CONFIG_MEMORY_ALLOCATION_TYPE` is `ITC_MEMORY_ALLOCATION_TYPE_CUSTOM`.
+ *
+ * @param ppv_Ptrs The pointers to the nodes to be freed
+ * @param u32_Count The number of nodes to free
+ * @param t_AllocType The type of the nodes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_freeBatch(
+    void *const *ppv_Ptrs,
+    uint32_t u32_Count,
+    ITC_Port_AllocType_t t_AllocType
+);
+
+/**
+ * @brief Init an empty reservation
+ *
+ * Must be called after setting the `ppv_Nodes` and `u32_Capacity` fields of
+ * the pools.
+ *
+ * @param pt_Reservation The reservation
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_initReservation(
+    ITC_Port_Reservation_t *pt_Reservation
+);
+
+/**
+ * @brief Make sure a reservation holds at least a given number of nodes of
+ * each type
+ *
+ * The missing nodes of each type are allocated with a single
+ * ::ITC_Port_mallocBatch() call. The node counts of several upcoming
+ * operations can be added up and reserved at once.
+ *
+ * @note On failure, the reservation is left unmodified
+ * @param pt_Reservation The reservation
+ * @param pt_NodeCount The number of nodes of each type, e.g. as returned by
+ * ::ITC_Stamp_getJoinNodeCount()
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if a pool cannot hold the nodes
+ * or the nodes cannot be allocated
+ */
+ITC_Status_t ITC_Port_reserve(
+    ITC_Port_Reservation_t *pt_Reservation,
+    const ITC_Stamp_NodeCount_t *pt_NodeCount
+);
+
+/**
+ * @brief Deallocate all nodes held by a reservation
+ *
+ * The nodes of each type are deallocated with a single ::ITC_Port_freeBatch()
+ * call.
+ *
+ * @param pt_Reservation The reservation
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_releaseReservation(
+    ITC_Port_Reservation_t *pt_Reservation
+);
+
+/**
+ * @brief Bind a reservation to the calling thread
+ *
+ * While bound, the ID, Event and Stamp nodes allocated by the calling thread
+ * are taken from the reservation, without calling ::ITC_Port_malloc(). Once
+ * the pool of a node type is empty, allocating a node of that type fails
+ * with `ITC_STATUS_INSUFFICIENT_RESOURCES`. The deallocated nodes are put
+ * back into the reservation while their pool has room for them, and are
+ * deallocated with ::ITC_Port_free() otherwise.
+ *
+ * @note The nodes of the scratch arena are not taken from the reservation.
+ * The statistics count the reserved nodes as allocated when they are
+ * reserved, not when an operation takes them from the reservation
+ * @param pt_Reservation The reservation or `NULL` to unbind the current
+ * reservation
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_setReservation(
+    ITC_Port_Reservation_t *pt_Reservation
+);
+
+/**
+ * @brief Get the reservation bound to the calling thread
+ *
+ * @param ppt_Reservation (out) The reservation or `NULL` if no reservation is
+ * bound
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_getReservation(
+    ITC_Port_Reservation_t **ppt_Reservation
+);
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+#if ITC_CONFIG_ENABLE_STATS
+
+/**
+ * @brief Get the statistics kept by libitc
+ *
+ * Copies the current statistics without any locking. The statistics are only
+ * updated by the libitc API calls, so if these can happen concurrently with
+ * this call, the copied counters might be from slightly different points in
+ * time. Each counter is a single `uint32_t`, so on platforms where these are
+ * read and written atomically, the individual counters are never torn.
+ *
+ * @param pt_Stats (out) The statistics
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_getStats(
+    ITC_Port_Stats_t *pt_Stats
+);
+
+/**
+ * @brief Reset the statistics kept by libitc
+ *
+ * Clears all counters, except for the number of live nodes. The peak number
+ * of nodes is set to the number of live nodes.
+ *
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_resetStats(void);
+
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/**
+ * @brief Register the tracing hooks
+ *
+ * The hooks are copied and replace any previously registered hooks. They are
+ * shared by all threads, so they should be registered before any other
+ * libitc API calls are made, and must be thread-safe if the API is used from
+ * several threads.
+ *
+ * The tree sizes passed to the end hook are only counted while hooks are
+ * registered, as counting them walks the trees again.
+ *
+ * @param pt_Hooks The hooks to register, or `NULL` to unregister the current
+ * hooks
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_setTraceHooks(
+    const ITC_Port_TraceHooks_t *const pt_Hooks
+);
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
 #endif /* ITC_PORT_H_ */
@@ -20,6 +20,129 @@
 #include "ITC_Event.h"
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+#include "ITC_Id.h"
+#include "ITC_Event.h"
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+
+/**
+ * @brief The state of an ITC ID tree being incrementally deserialised
+ *
+ * @warning Internal to ::ITC_SerDes_StampDecoder_t. Do not access its members
+ * directly
+ */
+typedef struct
+{
+    /** The root of the ID tree. `NULL` if no node has been deserialised yet */
+    ITC_Id_t *pt_Root;
+    /** The parent of the next node. `NULL` if the next node is the root or if
+     * the tree is complete */
+    ITC_Id_t *pt_Parent;
+} ITC_SerDes_IdDecoder_t;
+
+/**
+ * @brief The state of an ITC Event tree being incrementally deserialised
+ *
+ * @warning Internal to ::ITC_SerDes_StampDecoder_t. Do not access its members
+ * directly
+ */
+typedef struct
+{
+    /** The root of the Event tree. `NULL` if no node has been deserialised
+     * yet */
+    ITC_Event_t *pt_Root;
+    /** The parent of the next node. `NULL` if the next node is the root or if
+     * the tree is complete */
+    ITC_Event_t *pt_Parent;
+    /** The event counter of the next node, as read so far */
+    ITC_Event_Counter_t t_Counter;
+    /** The header of the next node */
+    uint8_t u8_Header;
+    /** The number of event counter bytes of the next node still to be read.
+     * `0` if the next byte is a node header */
+    uint8_t u8_CounterBytesLeft;
+} ITC_SerDes_EventDecoder_t;
+
+/**
+ * @brief A resumable ITC Stamp decoder
+ *
+ * Deserialises a Stamp from a sequence of partial buffers. See
+ * ::ITC_SerDes_initStampDecoder()
+ *
+ * @warning Do not access its members directly
+ */
+typedef struct
+{
+    /** The ID component being deserialised */
+    ITC_SerDes_IdDecoder_t t_IdDecoder;
+    /** The Event component being deserialised */
+    ITC_SerDes_EventDecoder_t t_EventDecoder;
+    /** The status of the first failed feed. Returned by all subsequent feeds
+     * until the decoder is reset */
+    ITC_Status_t t_Status;
+    /** The number of bytes of the current field still to be read */
+    uint32_t u32_FieldBytesLeft;
+    /** The length of the current component, as read so far */
+    uint32_t u32_ComponentLen;
+    /** The current field of the serialised Stamp */
+    uint8_t u8_Field;
+    /** The serialised Stamp header */
+    uint8_t u8_StampHeader;
+} ITC_SerDes_StampDecoder_t;
+
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
+/**
+ * @brief A read-only view of a serialised ITC Stamp
+ *
+ * Points directly into the buffer holding the serialised Stamp, which allows
+ * reading the Stamp without deserialising it or allocating any memory.
+ *
+ * @warning The buffer must outlive the view and must not be modified while
+ * the view is in use
+ */
+typedef struct
+{
+    /** The buffer holding the serialised Stamp */
+    const uint8_t *pu8_Buffer;
+    /** The size of the buffer in bytes */
+    uint32_t u32_BufferSize;
+    /** The offset of the serialised ID component */
+    uint32_t u32_IdOffset;
+    /** The length of the serialised ID component */
+    uint32_t u32_IdLength;
+    /** The offset of the serialised Event component */
+    uint32_t u32_EventOffset;
+    /** The length of the serialised Event component */
+    uint32_t u32_EventLength;
+} ITC_SerDes_StampView_t;
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/**
+ * @brief Receives the text emitted by the streaming string serialisers
+ *
+ * See ::ITC_SerDes_writeStampString()
+ *
+ * @param pv_Context The user context passed to the serialiser
+ * @param pc_Chunk The next chunk of text. Not NULL-terminated
+ * @param u32_ChunkLength The length of the chunk in bytes. Never `0`
+ * @return `ITC_Status_t` The status of the operation. Any status other than
+ * `ITC_STATUS_SUCCESS` aborts the serialisation and is returned to the caller
+ */
+typedef ITC_Status_t (*ITC_SerDes_StringWriter_t)(
+    void *pv_Context,
+    const char *pc_Chunk,
+    uint32_t u32_ChunkLength
+);
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
 
 /******************************************************************************
  * Functions
@@ -51,9 +174,55 @@ ITC_Status_t ITC_SerDes_serialiseId(
     uint32_t *const pu32_BufferSize
 );
 
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/**
+ * @brief Serialise an existing ITC Id in the compact (v2) format
+ *
+ * The ID tree is bit-packed, using 1 bit per parent node and 2 bits per leaf
+ * node. The data can be deserialised with ::ITC_SerDes_deserialiseId().
+ *
+ * @warning See ::ITC_SerDes_serialiseId()
+ *
+ * @param pt_Id The Id
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_serialiseIdCompact(
+    const ITC_Id_t *const pt_Id,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+);
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+/**
+ * @brief Get the size of an existing ITC Id once serialised
+ *
+ * The size is exact, i.e. ::ITC_SerDes_serialiseId() succeeds with a buffer of
+ * this size and returns the same size.
+ *
+ * @param pt_Id The Id
+ * @param pu32_Size (out) The size of the serialised Id in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getSerialisedIdSize(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_Size
+);
+
 /**
  * @brief Deserialise an ITC Id
  *
+ * The format of the data is selected by its version field. Data serialised in
+ * the compact format is only accepted if
+ * `ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT` is enabled.
+ *
  * @warning A few basic checks are performed on the serialised data during
  * deserialisation to ensure data correctness. However, it is strongly
  * recommended to further protect the serialised data integrity with a checksum
@@ -97,9 +266,56 @@ ITC_Status_t ITC_SerDes_serialiseEvent(
     uint32_t *const pu32_BufferSize
 );
 
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/**
+ * @brief Serialise an existing ITC Event in the compact (v2) format
+ *
+ * The Event tree is bit-packed and the event counters are LEB128-encoded.
+ * A leaf node with a `0` event counter only takes 2 bits. The data can be
+ * deserialised with ::ITC_SerDes_deserialiseEvent().
+ *
+ * @warning See ::ITC_SerDes_serialiseEvent()
+ *
+ * @param pt_Event The Event
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_serialiseEventCompact(
+    const ITC_Event_t *const pt_Event,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+);
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+/**
+ * @brief Get the size of an existing ITC Event once serialised
+ *
+ * The size is exact, i.e. ::ITC_SerDes_serialiseEvent() succeeds with a
+ * buffer of this size and returns the same size.
+ *
+ * @param pt_Event The Event
+ * @param pu32_Size (out) The size of the serialised Event in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getSerialisedEventSize(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_Size
+);
+
 /**
  * @brief Deserialise an ITC Event
  *
+ * The format of the data is selected by its version field. Data serialised in
+ * the compact format is only accepted if
+ * `ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT` is enabled.
+ *
  * @warning A few basic checks are performed on the serialised data during
  * deserialisation to ensure data correctness. However, it is strongly
  * recommended to further protect the serialised data integrity with a checksum
@@ -119,6 +335,88 @@ ITC_Status_t ITC_SerDes_deserialiseEvent(
     ITC_Event_t **const ppt_Event
 );
 
+/**
+ * @brief Check if a serialised Event is `<=` to another serialised Event
+ *
+ * The check is performed directly on the serialised data, without
+ * deserialising the Events or allocating any memory. Both buffers are
+ * validated in the same way as during ::ITC_SerDes_deserialiseEvent().
+ *
+ * @note Walking the serialised Event trees in place costs `O(n * depth)` time
+ * in the worst case
+ *
+ * @param pu8_Buffer1 The buffer holding the first serialised Event data
+ * @param u32_BufferSize1 The size of the first buffer in bytes
+ * @param pu8_Buffer2 The buffer holding the second serialised Event data
+ * @param u32_BufferSize2 The size of the second buffer in bytes
+ * @param pb_IsLeq (out) `true` if `Event1 <= Event2`. Otherwise `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_leqSerialisedEvents(
+    const uint8_t *const pu8_Buffer1,
+    const uint32_t u32_BufferSize1,
+    const uint8_t *const pu8_Buffer2,
+    const uint32_t u32_BufferSize2,
+    bool *const pb_IsLeq
+);
+
+/**
+ * @brief Serialise the difference of an existing ITC Event to a base Event
+ *
+ * Subtrees of `pt_Event` which are identical to the subtree at the same
+ * position in `pt_Base` are replaced with a single byte, so only the parts of
+ * the Event that changed since `pt_Base` (e.g. the last Event exchanged with a
+ * peer) are serialised in full. The delta can be turned back into
+ * `pt_Event` with ::ITC_SerDes_applyEventDelta(), given the same base Event.
+ *
+ * @note `pt_Event` does not need to be derived from `pt_Base`, but the delta
+ * is only smaller than the output of ::ITC_SerDes_serialiseEvent() if the
+ * two Events share subtrees
+ * @note Comparing the subtrees costs `O(n * depth)` time in the worst case
+ *
+ * @param pt_Base The base Event
+ * @param pt_Event The Event
+ * @param pu8_Buffer The buffer to hold the serialised delta
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_serialiseEventDelta(
+    const ITC_Event_t *const pt_Base,
+    const ITC_Event_t *const pt_Event,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+);
+
+/**
+ * @brief Rebuild an ITC Event from a base Event and a serialised delta
+ *
+ * See ::ITC_SerDes_serialiseEventDelta().
+ *
+ * @warning The base Event must be identical to the one the delta was
+ * serialised against. Applying the delta to a different base Event fails if
+ * the shapes of the Events do not match, but otherwise silently results in a
+ * different Event.
+ *
+ * @param pt_Base The base Event
+ * @param pu8_Buffer The buffer holding the serialised delta
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param ppt_Event The pointer to the rebuilt Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the delta is invalid or does not
+ * match the base Event
+ */
+ITC_Status_t ITC_SerDes_applyEventDelta(
+    const ITC_Event_t *const pt_Base,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Event_t **const ppt_Event
+);
+
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 
 /**
@@ -145,9 +443,77 @@ ITC_Status_t ITC_SerDes_serialiseStamp(
     uint32_t *const pu32_BufferSize
 );
 
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/**
+ * @brief Serialise an existing ITC Stamp in the compact (v2) format
+ *
+ * The ID and Event trees are bit-packed back to back, and the event counters
+ * are LEB128-encoded. A seed Stamp takes 2 bytes, compared to 6 bytes in the
+ * default format. The data can be deserialised with
+ * ::ITC_SerDes_deserialiseStamp().
+ *
+ * @warning See ::ITC_SerDes_serialiseStamp()
+ * @note ::ITC_SerDes_compareSerialisedStamps() only accepts the default format
+ *
+ * @param pt_Stamp The Stamp
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_serialiseStampCompact(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+);
+
+/**
+ * @brief Get the size of an existing ITC Stamp once serialised in the compact
+ * (v2) format
+ *
+ * The size is exact, i.e. ::ITC_SerDes_serialiseStampCompact() succeeds with a
+ * buffer of this size and returns the same size.
+ *
+ * @param pt_Stamp The Stamp
+ * @param pu32_Size (out) The size of the serialised Stamp in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getSerialisedStampCompactSize(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Size
+);
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+/**
+ * @brief Get the size of an existing ITC Stamp once serialised
+ *
+ * The size is exact, i.e. ::ITC_SerDes_serialiseStamp() succeeds with a
+ * buffer of this size and returns the same size. Use it to allocate the
+ * serialisation buffer up front instead of retrying on
+ * `ITC_STATUS_INSUFFICIENT_RESOURCES`.
+ *
+ * @param pt_Stamp The Stamp
+ * @param pu32_Size (out) The size of the serialised Stamp in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getSerialisedStampSize(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Size
+);
+
 /**
  * @brief Deserialise an ITC Stamp
  *
+ * The format of the data is selected by its version field. Data serialised in
+ * the compact format is only accepted if
+ * `ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT` is enabled.
+ *
  * @warning A few basic checks are performed on the serialised data during
  * deserialisation to ensure data correctness. However, it is strongly
  * recommended to further protect the serialised data integrity with a checksum
@@ -167,6 +533,292 @@ ITC_Status_t ITC_SerDes_deserialiseStamp(
     ITC_Stamp_t **const ppt_Stamp
 );
 
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/**
+ * @brief Get the worst-case number of nodes deserialising an ITC Stamp
+ * allocates
+ *
+ * Only the layout of the serialised data is checked. Reserving this many
+ * nodes with `ITC_Port_reserve` guarantees ::ITC_SerDes_deserialiseStamp()
+ * does not run out of memory.
+ *
+ * @param pu8_Buffer The buffer holding the serialised Stamp data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pt_NodeCount (out) The number of nodes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getDeserialisedStampNodeCount(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Stamp_NodeCount_t *const pt_NodeCount
+);
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+/**
+ * @brief Compare two serialised Stamps
+ *
+ * The comparison is performed directly on the serialised data, without
+ * deserialising the Stamps or allocating any memory. Both buffers are
+ * validated in the same way as during ::ITC_SerDes_deserialiseStamp().
+ *
+ * - If `Stamp1 < Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_LESS_THAN`
+ * - If `Stamp1 > Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_GREATER_THAN`
+ * - If `Stamp1 == Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_EQUAL`
+ * - If `Stamp1 <> Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_CONCURRENT`
+ *
+ * @note Walking the serialised Event trees in place costs `O(n * depth)` time
+ * in the worst case
+ *
+ * @param pu8_Buffer1 The buffer holding the first serialised Stamp data
+ * @param u32_BufferSize1 The size of the first buffer in bytes
+ * @param pu8_Buffer2 The buffer holding the second serialised Stamp data
+ * @param u32_BufferSize2 The size of the second buffer in bytes
+ * @param pt_Result The result of the comparison
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_compareSerialisedStamps(
+    const uint8_t *const pu8_Buffer1,
+    const uint32_t u32_BufferSize1,
+    const uint8_t *const pu8_Buffer2,
+    const uint32_t u32_BufferSize2,
+    ITC_Stamp_Comparison_t *const pt_Result
+);
+
+/**
+ * @brief Serialise an array of existing ITC Stamps into a single buffer
+ *
+ * All Stamps share a single version field, which makes the batch smaller than
+ * serialising each Stamp on its own. Every Stamp is validated and sized before
+ * anything is written to the buffer.
+ *
+ * Data format:
+ *  - Byte 0: The major component of the version of the `libitc` library used to
+ *      serialise the data
+ *  - Byte 1: The batch header. Bits 0-2 contain the length of the `Stamp count`
+ *      field. The rest of the bits are reserved and set to 0
+ *  - Bytes (2 - N): The number of Stamps in the batch (network-endian)
+ *  - Bytes (N+1 - ...): The Stamps, serialised back to back as by
+ *      ::ITC_SerDes_serialiseStamp(), but without their version field
+ *
+ * @param ppt_Stamps The array of Stamps. Must not contain `NULL` entries
+ * @param u32_StampCount The number of Stamps in the array. Can be `0`
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_serialiseStampBatch(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+);
+
+/**
+ * @brief Get the size of an array of existing ITC Stamps once serialised as a
+ * batch
+ *
+ * The size is exact, i.e. ::ITC_SerDes_serialiseStampBatch() succeeds with a
+ * buffer of this size and returns the same size.
+ *
+ * @param ppt_Stamps The array of Stamps. Must not contain `NULL` entries
+ * @param u32_StampCount The number of Stamps in the array. Can be `0`
+ * @param pu32_Size (out) The size of the serialised batch in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getSerialisedStampBatchSize(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    uint32_t *const pu32_Size
+);
+
+/**
+ * @brief Deserialise a batch of ITC Stamps into an array
+ *
+ * See ::ITC_SerDes_serialiseStampBatch() for the expected data format.
+ * If any of the Stamps fails to deserialise, the ones already deserialised are
+ * destroyed again, so nothing is returned to the caller.
+ *
+ * @warning See ::ITC_SerDes_deserialiseStamp()
+ *
+ * @param pu8_Buffer The buffer holding the serialised batch
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param ppt_Stamps The array to hold the deserialised Stamps
+ * @param pu32_StampCount (in) The number of entries in the array. (out) The
+ * number of deserialised Stamps. If the array is too small, the number of
+ * Stamps in the batch
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the array is not big enough
+ */
+ITC_Status_t ITC_SerDes_deserialiseStampBatch(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Stamp_t **const ppt_Stamps,
+    uint32_t *const pu32_StampCount
+);
+
+/**
+ * @brief Initialise a read-only view of a serialised ITC Stamp
+ *
+ * The buffer is validated once, in the same way as during
+ * ::ITC_SerDes_deserialiseStamp(). Afterwards the view can be read without
+ * allocating any memory, and is only deserialised on demand via
+ * ::ITC_SerDes_getStampFromView().
+ *
+ * @note Only the default serialisation format is supported
+ * @warning The buffer must outlive the view and must not be modified while
+ * the view is in use
+ *
+ * @param pu8_Buffer The buffer holding the serialised Stamp data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pt_View The view
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_initStampView(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_SerDes_StampView_t *const pt_View
+);
+
+/**
+ * @brief Compare two serialised Stamps through their views
+ *
+ * Same as ::ITC_SerDes_compareSerialisedStamps(), without allocating any
+ * memory.
+ *
+ * - If `Stamp1 < Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_LESS_THAN`
+ * - If `Stamp1 > Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_GREATER_THAN`
+ * - If `Stamp1 == Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_EQUAL`
+ * - If `Stamp1 <> Stamp2`:
+ *      `*pt_Result == ITC_STAMP_COMPARISON_CONCURRENT`
+ *
+ * @param pt_View1 The view of the first Stamp
+ * @param pt_View2 The view of the second Stamp
+ * @param pt_Result The result of the comparison
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_compareStampViews(
+    const ITC_SerDes_StampView_t *const pt_View1,
+    const ITC_SerDes_StampView_t *const pt_View2,
+    ITC_Stamp_Comparison_t *const pt_Result
+);
+
+/**
+ * @brief Deserialise the Stamp a view points to into a new ITC Stamp
+ *
+ * Use this once the Stamp needs to be modified, e.g. to add an event or join
+ * it with another Stamp.
+ *
+ * @param pt_View The view
+ * @param ppt_Stamp The pointer to the deserialised Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getStampFromView(
+    const ITC_SerDes_StampView_t *const pt_View,
+    ITC_Stamp_t **const ppt_Stamp
+);
+
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+
+/**
+ * @brief Initialise a Stamp decoder
+ *
+ * The decoder accepts the same data as ::ITC_SerDes_deserialiseStamp(), split
+ * into any number of partial buffers. Feed the buffers in order with
+ * ::ITC_SerDes_feedStampDecoder(), then get the Stamp with
+ * ::ITC_SerDes_finishStampDecoder(). The ID and Event trees are built as the
+ * data arrives, so the memory used by the decoder is bounded by the size of
+ * the trees rather than the size of the serialised data.
+ *
+ * @note The decoder does not allocate anything until it is fed. A decoder
+ * abandoned halfway through a Stamp must be reset with
+ * ::ITC_SerDes_resetStampDecoder() to release the partially deserialised
+ * trees
+ * @note Data serialised in the compact format is not supported
+ *
+ * @param pt_Decoder The decoder
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_initStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder
+);
+
+/**
+ * @brief Feed the next part of a serialised Stamp to a Stamp decoder
+ *
+ * Once a feed fails, the partially deserialised trees are released and all
+ * subsequent feeds return the same status until the decoder is reset or
+ * finished.
+ *
+ * @warning See ::ITC_SerDes_deserialiseStamp()
+ *
+ * @param pt_Decoder The decoder
+ * @param pu8_Buffer The buffer holding the next part of the serialised Stamp
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_STAMP` if the data continues past the end of the
+ * serialised Stamp
+ */
+ITC_Status_t ITC_SerDes_feedStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize
+);
+
+/**
+ * @brief Get the Stamp deserialised by a Stamp decoder
+ *
+ * The decoder is reset afterwards (whether the operation succeeds or not) and
+ * can be reused for the next Stamp.
+ *
+ * @param pt_Decoder The decoder
+ * @param ppt_Stamp The pointer to the deserialised Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_STAMP` if the decoder has not been fed a whole
+ * Stamp
+ */
+ITC_Status_t ITC_SerDes_finishStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder,
+    ITC_Stamp_t **const ppt_Stamp
+);
+
+/**
+ * @brief Reset a Stamp decoder
+ *
+ * Releases any partially deserialised trees and gets the decoder ready for a
+ * new Stamp.
+ *
+ * @param pt_Decoder The decoder
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_resetStampDecoder(
+    ITC_SerDes_StampDecoder_t *const pt_Decoder
+);
+
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
 #if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
 
 #if ITC_CONFIG_ENABLE_EXTENDED_API
@@ -207,6 +859,79 @@ ITC_Status_t ITC_SerDes_serialiseEventToString(
     uint32_t *const pu32_BufferSize
 );
 
+/**
+ * @brief Get the length of an existing ITC Id once serialised to ASCII string
+ *
+ * The length is exact, i.e. ::ITC_SerDes_serialiseIdToString() succeeds with a
+ * buffer of this size and returns the same size.
+ *
+ * @param pt_Id The Id
+ * @param pu32_Length (out) The length of the string in bytes (including the
+ * NULL termination byte)
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getIdStringLength(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_Length
+);
+
+/**
+ * @brief Get the length of an existing ITC Event once serialised to ASCII
+ * string
+ *
+ * The length is exact, i.e. ::ITC_SerDes_serialiseEventToString() succeeds
+ * with a buffer of this size and returns the same size.
+ *
+ * @param pt_Event The Event
+ * @param pu32_Length (out) The length of the string in bytes (including the
+ * NULL termination byte)
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getEventStringLength(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_Length
+);
+
+/**
+ * @brief Serialise an existing ITC Id to ASCII string through a writer
+ *
+ * Produces the same output as ::ITC_SerDes_serialiseIdToString(), without the
+ * NULL termination byte. See ::ITC_SerDes_writeStampString()
+ *
+ * @param pt_Id The Id
+ * @param pfn_Writer The writer receiving the string
+ * @param pv_Context The user context passed to the writer. Optional
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+ITC_Status_t ITC_SerDes_writeIdString(
+    const ITC_Id_t *const pt_Id,
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
+);
+
+/**
+ * @brief Serialise an existing ITC Event to ASCII string through a writer
+ *
+ * Produces the same output as ::ITC_SerDes_serialiseEventToString(), without
+ * the NULL termination byte. See ::ITC_SerDes_writeStampString()
+ *
+ * @param pt_Event The Event
+ * @param pfn_Writer The writer receiving the string
+ * @param pv_Context The user context passed to the writer. Optional
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+ITC_Status_t ITC_SerDes_writeEventString(
+    const ITC_Event_t *const pt_Event,
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
+);
+
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 
 /**
@@ -227,6 +952,72 @@ ITC_Status_t ITC_SerDes_serialiseStampToString(
     uint32_t *const pu32_BufferSize
 );
 
+/**
+ * @brief Serialise the Stamp a view points to to ASCII string
+ *
+ * Produces the same output as ::ITC_SerDes_serialiseStampToString(), without
+ * deserialising the Stamp or allocating any memory.
+ *
+ * @note The output buffer is always NULL-terminated
+ * @note Walking the serialised trees in place costs `O(n * depth)` time in the
+ * worst case
+ * @param pt_View The view
+ * @param pc_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes (including the NULL termination byte).
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_serialiseStampViewToString(
+    const ITC_SerDes_StampView_t *const pt_View,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+);
+
+/**
+ * @brief Get the length of an existing ITC Stamp once serialised to ASCII
+ * string
+ *
+ * The length is exact, i.e. ::ITC_SerDes_serialiseStampToString() succeeds
+ * with a buffer of this size and returns the same size. Allows sizing the
+ * buffer up front instead of retrying with bigger ones.
+ *
+ * @param pt_Stamp The Stamp
+ * @param pu32_Length (out) The length of the string in bytes (including the
+ * NULL termination byte)
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getStampStringLength(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Length
+);
+
+/**
+ * @brief Serialise an existing ITC Stamp to ASCII string through a writer
+ *
+ * Produces the same output as ::ITC_SerDes_serialiseStampToString(), without
+ * the NULL termination byte. Instead of filling a caller-provided buffer, the
+ * string is batched into a small fixed-size chunk on the stack and handed to
+ * `pfn_Writer` whenever the chunk fills up, which allows streaming a Stamp of
+ * any size to a log or socket.
+ *
+ * @note If the writer fails, the chunks it already received form an
+ * incomplete string
+ * @param pt_Stamp The Stamp
+ * @param pfn_Writer The writer receiving the string
+ * @param pv_Context The user context passed to the writer. Optional
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+ITC_Status_t ITC_SerDes_writeStampString(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
+);
+
 #endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
 
 #endif /* ITC_SERDES_H_ */
@@ -10,8 +10,12 @@
 #ifndef ITC_STAMP_H_
 #define ITC_STAMP_H_
 
+#include "ITC_Config.h"
 #include "ITC_Id.h"
 #include "ITC_Event.h"
+#include "ITC_Status.h"
+
+#include <stdint.h>
 
 /* The Stamp comparison enum */
 typedef enum
@@ -33,8 +37,49 @@ typedef struct
     ITC_Id_t *pt_Id;
     /* The ITC Event */
     ITC_Event_t *pt_Event;
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+    /* The Event leaf the next `ITC_Stamp_event` call will increment.
+     * NULL if not known. Must not be modified by the user */
+    ITC_Event_t *pt_InflationLeaf;
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
 } ITC_Stamp_t;
 
+/* Runs the jobs of a batch Stamp operation, such as `ITC_Stamp_compareMany`,
+ * for example on a thread pool */
+typedef struct
+{
+    /* Call `pf_Job(pv_JobContext, u32_Job)` exactly once for every `u32_Job`
+     * in `[0, u32_JobCount)` and return once all calls have completed. The
+     * calls may run in any order and on any threads, including in parallel.
+     * Must return `ITC_STATUS_SUCCESS` if all calls succeeded, or the status
+     * returned by any of the failed calls otherwise */
+    ITC_Status_t (*pf_Run)(
+        void *pv_UserData,
+        ITC_Status_t (*pf_Job)(void *pv_JobContext, uint32_t u32_Job),
+        void *pv_JobContext,
+        uint32_t u32_JobCount);
+    /* User data passed to `pf_Run`. Not used by libitc */
+    void *pv_UserData;
+    /* The maximum number of jobs to split the operation into (e.g. the number
+     * of worker threads). `0` is treated as `1` */
+    uint32_t u32_MaxJobs;
+} ITC_Stamp_Executor_t;
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/* The number of nodes of each type an operation needs */
+typedef struct
+{
+    /* The number of `ITC_Id_t` nodes */
+    uint32_t u32_IdNodes;
+    /* The number of `ITC_Event_t` nodes */
+    uint32_t u32_EventNodes;
+    /* The number of `ITC_Stamp_t` nodes */
+    uint32_t u32_StampNodes;
+} ITC_Stamp_NodeCount_t;
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
 /* Late include. We need to define the types first */
 #include "ITC_Stamp_prototypes.h"
 
@@ -107,13 +107,39 @@ ITC_Status_t ITC_Stamp_event(
     ITC_Stamp_t *const pt_Stamp
 );
 
+/**
+ * @brief Add a number of new Events to the Stamp
+ *
+ * Fills the Event component of the Stamp once, which accounts for a single
+ * event, and then adds the remaining events (or all of them, if filling was not
+ * possible) by growing it once. The resulting Event tree may differ from
+ * calling ::ITC_Stamp_event() `t_EventCount` times (which may fill the Event
+ * more than once), but it is an equally valid inflation of the Stamp.
+ *
+ * @note If adding the events would overflow an event counter, the Stamp is
+ * left unmodified
+ * @param pt_Stamp The existing Stamp
+ * @param t_EventCount The number of events to add. Does nothing if `0`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if adding the events would
+ * overflow an event counter
+ */
+ITC_Status_t ITC_Stamp_eventN(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Event_Counter_t t_EventCount
+);
+
 /**
  * @brief Join two existing Stamps
  * Joins 2 stamps into a single Stamp, combining their IDs and event histories.
+ * The event histories are joined in place, reusing the Event nodes of both
+ * Stamps.
  *
  * @note On success, `ppt_OtherStamp` will be automatically deallocated to
  * prevent it from being used again accidentally (as well as to reduce developer
  * cleanup burden)
+ * @note On failure, both Stamps are left unmodified
  * @param ppt_Stamp (in) The first existing Stamp. (out) The joined Stamp
  * @param ppt_OtherStamp (in) The second existing Stamp. (out) NULL
  * @return `ITC_Status_t` The status of the operation
@@ -124,6 +150,45 @@ ITC_Status_t ITC_Stamp_join(
     ITC_Stamp_t **const ppt_OtherStamp
 );
 
+/**
+ * @brief Join an array of existing Stamps
+ * Joins all Stamps into a single Stamp, combining their IDs and event
+ * histories. Each Stamp is validated only once and the event histories are
+ * joined in place with a balanced pairwise reduction, reusing the Event nodes
+ * of all Stamps.
+ *
+ * @note On success, all Stamps in `ppt_Stamps` will be automatically
+ * deallocated (or reused for the joined Stamp) and their pointers set to
+ * `NULL`
+ * @note On failure, all Stamps are left unmodified
+ * @param ppt_Stamps (in) The array of existing Stamps. (out) An array of NULLs
+ * @param u32_StampCount The number of Stamps in the array. Must be `> 0`
+ * @param ppt_JoinedStamp (out) The joined Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_joinMany(
+    ITC_Stamp_t **const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    ITC_Stamp_t **const ppt_JoinedStamp
+);
+
+/**
+ * @brief Join an array of existing Stamps similar to ::ITC_Stamp_joinMany()
+ * but do not modify the source Stamps
+ *
+ * @param ppt_Stamps The array of existing Stamps
+ * @param u32_StampCount The number of Stamps in the array. Must be `> 0`
+ * @param ppt_JoinedStamp (out) The joined Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_joinManyConst(
+    const ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampCount,
+    ITC_Stamp_t **const ppt_JoinedStamp
+);
+
 /**
  * @brief Compare two existing Stamps
  *
@@ -148,6 +213,221 @@ ITC_Status_t ITC_Stamp_compare(
     ITC_Stamp_Comparison_t *const pt_Result
 );
 
+/**
+ * @brief Compare an existing Stamp against an array of existing Stamps
+ *
+ * Equivalent to calling `ITC_Stamp_compare(pt_Stamp, ppt_OtherStamps[i],
+ * &pt_Results[i])` for every Stamp in the array, but `pt_Stamp` is only
+ * validated once. The comparisons can optionally be spread over multiple
+ * threads with an executor. The Stamps are only read, so the jobs need no
+ * synchronisation and do not allocate any memory.
+ *
+ * @note On failure, the contents of `pt_Results` are undefined
+ * @note If `ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION` is enabled, the Stamps
+ * whose Event still needs to be normalised are compared using a normalised
+ * copy of it, which does allocate memory. Normalise joined Stamps with
+ * `ITC_Stamp_normalise` first to avoid this
+ * @param pt_Stamp The Stamp to compare against
+ * @param ppt_OtherStamps The array of Stamps to compare
+ * @param u32_StampCount The number of Stamps in the array. Must be `> 0`
+ * @param pt_Results (out) The result of each comparison. Must be able to hold
+ * `u32_StampCount` results
+ * @param pt_Executor The executor to run the comparisons with or `NULL` to run
+ * them on the calling thread
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_compareMany(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const *const ppt_OtherStamps,
+    const uint32_t u32_StampCount,
+    ITC_Stamp_Comparison_t *const pt_Results,
+    const ITC_Stamp_Executor_t *const pt_Executor
+);
+
+/**
+ * @brief Compact the Event of an existing Stamp
+ *
+ * Collapses the Event subtrees that are fully owned by the ID of the Stamp,
+ * starting at depth `u32_MaxDepth`, into leafs holding their maximum event
+ * count. This bounds the size of Event trees fragmented by many fork and join
+ * cycles, which speeds up comparing, joining and serialising the Stamp.
+ *
+ * Collapsing an owned subtree is the same inflation adding an event performs,
+ * so the compacted Stamp is `>=` the original one, and other Stamps compare
+ * to it as if it had recorded a new event. The history of the intervals not
+ * owned by the ID is not modified, so subtrees the ID only partly owns can
+ * still be deeper than `u32_MaxDepth`. The ID component is not modified, as it
+ * is always kept normalised.
+ *
+ * @note On failure, the Stamp is left unmodified
+ * @param pt_Stamp The existing Stamp
+ * @param u32_MaxDepth The depth from which the owned subtrees are collapsed.
+ * `0` collapses them all, starting with the root
+ * @param pu32_ReclaimedNodes (out) The number of Event nodes released
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * the Stamp cannot be represented
+ */
+ITC_Status_t ITC_Stamp_compact(
+    ITC_Stamp_t *const pt_Stamp,
+    const uint32_t u32_MaxDepth,
+    uint32_t *const pu32_ReclaimedNodes
+);
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+
+/**
+ * @brief Finish the normalisation of the Event of a Stamp deferred by previous
+ * joins
+ *
+ * Every Stamp operation modifying the Event does this automatically.
+ * Read-only operations never modify the Stamp, and normalise a copy of its
+ * Event instead. Calling this explicitly avoids allocating the copy for each
+ * of them.
+ *
+ * @param pt_Stamp The Stamp to normalise
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_normalise(
+    ITC_Stamp_t *const pt_Stamp
+);
+
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+
+/**
+ * @brief Rebase the Event of a Stamp onto a base Stamp
+ *
+ * Subtracts the Event of the base from the Event of the Stamp, e.g. a stable
+ * prefix Stamp all replicas have agreed on. The rebased Event only holds the
+ * events witnessed since the base, which keeps its counters (and serialised
+ * size) small. The ID of the base is ignored.
+ *
+ * Rebased Stamps can be forked, joined and compared with Stamps rebased onto
+ * the same base as usual. Use ::ITC_Stamp_compareRebased() for Stamps rebased
+ * onto different bases, or ::ITC_Stamp_unrebase() to restore the original
+ * Stamp.
+ *
+ * @note On failure, the Stamp is left unmodified
+ * @param pt_Stamp The Stamp to rebase
+ * @param pt_Base The base Stamp. Must be `<=` `pt_Stamp`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_UNDERFLOW` if the base is not `<=` the
+ * Stamp
+ */
+ITC_Status_t ITC_Stamp_rebase(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base
+);
+
+/**
+ * @brief Add the Event of a base Stamp back to a Stamp rebased onto it
+ *
+ * Reverses ::ITC_Stamp_rebase(). Also used to move a Stamp from one base onto
+ * another, by unrebasing it from the old base and rebasing it onto the new
+ * one.
+ *
+ * @note On failure, the Stamp is left unmodified
+ * @param pt_Stamp The rebased Stamp
+ * @param pt_Base The base Stamp `pt_Stamp` was rebased onto
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * the restored Stamp cannot be represented
+ */
+ITC_Status_t ITC_Stamp_unrebase(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base
+);
+
+/**
+ * @brief Compare two Stamps rebased onto possibly different bases
+ *
+ * Gives the same result as comparing the original Stamps with
+ * ::ITC_Stamp_compare(). If both Stamps have the same base, they are
+ * compared directly. Otherwise, temporary copies of the Stamps are unrebased
+ * before comparing them.
+ *
+ * @param pt_Stamp1 The first Stamp
+ * @param pt_Base1 The base Stamp `pt_Stamp1` was rebased onto, or `NULL` if
+ * it was not rebased
+ * @param pt_Stamp2 The second Stamp
+ * @param pt_Base2 The base Stamp `pt_Stamp2` was rebased onto, or `NULL` if
+ * it was not rebased
+ * @param pt_Result (out) The result of the comparison
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_compareRebased(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Base1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    const ITC_Stamp_t *const pt_Base2,
+    ITC_Stamp_Comparison_t *const pt_Result
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/**
+ * @brief Get the worst-case number of nodes forking a Stamp allocates
+ *
+ * Reserving this many nodes with `ITC_Port_reserve` guarantees
+ * ::ITC_Stamp_fork() does not run out of memory.
+ *
+ * @param pt_Stamp The Stamp to fork
+ * @param pt_NodeCount (out) The number of nodes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_getForkNodeCount(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_NodeCount_t *const pt_NodeCount
+);
+
+/**
+ * @brief Get the worst-case number of nodes adding events to a Stamp
+ * allocates
+ *
+ * Reserving this many nodes with `ITC_Port_reserve` guarantees
+ * ::ITC_Stamp_event() and ::ITC_Stamp_eventN() do not run out of memory.
+ *
+ * @param pt_Stamp The Stamp to add the events to
+ * @param pt_NodeCount (out) The number of nodes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_getEventNodeCount(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_NodeCount_t *const pt_NodeCount
+);
+
+/**
+ * @brief Get the worst-case number of nodes joining two Stamps allocates
+ *
+ * Reserving this many nodes with `ITC_Port_reserve` guarantees
+ * ::ITC_Stamp_join() does not run out of memory.
+ *
+ * @param pt_Stamp The first Stamp to join
+ * @param pt_OtherStamp The second Stamp to join
+ * @param pt_NodeCount (out) The number of nodes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_getJoinNodeCount(
+    const ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_OtherStamp,
+    ITC_Stamp_NodeCount_t *const pt_NodeCount
+);
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
 #if ITC_CONFIG_ENABLE_EXTENDED_API
 
 /**
@@ -251,4 +531,85 @@ ITC_Status_t ITC_Stamp_setEvent(
 
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 
+#if ITC_CONFIG_ENABLE_UNCHECKED_API
+
+/**
+ * @brief Fork an existing Stamp, similar to ::ITC_Stamp_fork(), but without
+ * validating it first
+ *
+ * @warning The Stamp must be valid. See `ITC_CONFIG_ENABLE_UNCHECKED_API`
+ * @param ppt_Stamp (in) The existing Stamp. (out) The first forked Stamp
+ * @param ppt_OtherStamp (out) The second forked Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_forkUnchecked(
+    ITC_Stamp_t **const ppt_Stamp,
+    ITC_Stamp_t **const ppt_OtherStamp
+);
+
+/**
+ * @brief Add a new Event to the Stamp, similar to ::ITC_Stamp_event(), but
+ * without validating it first
+ *
+ * @warning The Stamp must be valid. See `ITC_CONFIG_ENABLE_UNCHECKED_API`
+ * @param pt_Stamp The existing Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_eventUnchecked(
+    ITC_Stamp_t *const pt_Stamp
+);
+
+/**
+ * @brief Add a number of new Events to the Stamp, similar to
+ * ::ITC_Stamp_eventN(), but without validating it first
+ *
+ * @warning The Stamp must be valid. See `ITC_CONFIG_ENABLE_UNCHECKED_API`
+ * @param pt_Stamp The existing Stamp
+ * @param t_EventCount The number of events to add. Does nothing if `0`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if adding the events would
+ * overflow an event counter
+ */
+ITC_Status_t ITC_Stamp_eventNUnchecked(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Event_Counter_t t_EventCount
+);
+
+/**
+ * @brief Join two existing Stamps, similar to ::ITC_Stamp_join(), but without
+ * validating them first
+ *
+ * @warning Both Stamps must be valid. See `ITC_CONFIG_ENABLE_UNCHECKED_API`
+ * @param ppt_Stamp (in) The first existing Stamp. (out) The joined Stamp
+ * @param ppt_OtherStamp (in) The second existing Stamp. (out) NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_joinUnchecked(
+    ITC_Stamp_t **const ppt_Stamp,
+    ITC_Stamp_t **const ppt_OtherStamp
+);
+
+/**
+ * @brief Compare two existing Stamps, similar to ::ITC_Stamp_compare(), but
+ * without validating them first
+ *
+ * @warning Both Stamps must be valid. See `ITC_CONFIG_ENABLE_UNCHECKED_API`
+ * @param pt_Stamp1 The first Stamp
+ * @param pt_Stamp2 The second Stamp
+ * @param pt_Result (out) The result of the comparison
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_compareUnchecked(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    ITC_Stamp_Comparison_t *const pt_Result
+);
+
+#endif /* ITC_CONFIG_ENABLE_UNCHECKED_API */
+
 #endif /* ITC_STAMP_PROTOTYPES_H_ */
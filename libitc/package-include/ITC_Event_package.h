@@ -74,8 +74,91 @@ ITC_Status_t ITC_Event_validate(
     const ITC_Event_t *const pt_Event
 );
 
+/**
+ * @brief Join two existing Events into a single Event
+ *
+ * The join is performed in place - the joined Event is built from the nodes
+ * of both source Events and no new memory is allocated.
+ *
+ * @note On success, `ppt_OtherEvent` will be automatically deallocated
+ * @note On failure, both Events are left unmodified
+ * @param ppt_Event (in) The first existing Event. (out) The joined Event
+ * @param ppt_OtherEvent (in) The second existing Event. (out) NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_join(
+    ITC_Event_t **const ppt_Event,
+    ITC_Event_t **const ppt_OtherEvent
+);
+
 #endif /* !ITC_CONFIG_ENABLE_EXTENDED_API */
 
+/**
+ * @brief Clone an Event, similar to ::ITC_Event_clone(), but without
+ * validating it first
+ *
+ * @note The Event must have passed ::ITC_Event_validate()
+ * @param pt_Event The existing Event
+ * @param ppt_ClonedEvent (out) The pointer to the cloned Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_cloneValidated(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t **const ppt_ClonedEvent
+);
+
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+
+/**
+ * @brief Share an Event tree instead of cloning it
+ *
+ * Increments the share count of the Event and returns the same Event. Each
+ * reference must be released with ::ITC_Event_destroy(), which only
+ * deallocates the Event once the last reference is released.
+ *
+ * @note The Event must have passed ::ITC_Event_validate(). A shared Event must
+ * not be modified in place. Use ::ITC_Event_unshare() first
+ * @param pt_Event The existing Event. Must be the root of an Event tree
+ * @param ppt_SharedEvent (out) The shared reference to the Event. Only
+ * differs from `pt_Event` if the share count was saturated, in which case
+ * the Event is cloned instead
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_share(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t **const ppt_SharedEvent
+);
+
+/**
+ * @brief Make sure an Event tree is not shared, so it can be modified in place
+ *
+ * If the Event is shared, it is replaced by a private copy of itself and the
+ * shared reference is released. Otherwise, it is left as is.
+ *
+ * @note On failure, the Event is left unmodified
+ * @param ppt_Event (in) The existing Event. (out) The unshared Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_unshare(
+    ITC_Event_t **const ppt_Event
+);
+
+/**
+ * @brief Check if an Event tree is shared
+ *
+ * @param pt_Event The existing Event. Must be the root of an Event tree
+ * @return `bool` `true` if the Event is shared. Otherwise `false`
+ */
+bool ITC_Event_isShared(
+    const ITC_Event_t *const pt_Event
+);
+
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+
 /**
  * @brief Join two Events similar to ::ITC_Event_join() but do not modify the source Events
  *
@@ -91,6 +174,80 @@ ITC_Status_t ITC_Event_joinConst(
     ITC_Event_t **const ppt_Event
 );
 
+/**
+ * @brief Validate an Event and check it can be joined in place
+ *
+ * An Event that passes this check can be joined with ::ITC_Event_joinValidated()
+ * any number of times without it failing halfway through. The result of such a
+ * join also passes this check.
+ *
+ * @param pt_Event The Event to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of the
+ * Event cannot be represented
+ */
+ITC_Status_t ITC_Event_validateForJoin(
+    const ITC_Event_t *const pt_Event
+);
+
+/**
+ * @brief Join two Events in place, similar to ::ITC_Event_join(), but without
+ * validating them first
+ *
+ * Useful when joining many Events, each of which only needs to be validated
+ * once.
+ *
+ * @note Both Events must have passed ::ITC_Event_validateForJoin()
+ * @note On success, `ppt_OtherEvent` will be automatically deallocated
+ * @param ppt_Event (in) The first existing Event. (out) The joined Event
+ * @param ppt_OtherEvent (in) The second existing Event. (out) NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_joinValidated(
+    ITC_Event_t **const ppt_Event,
+    ITC_Event_t **const ppt_OtherEvent
+);
+
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+
+/**
+ * @brief Join two Events that have already been validated in place, but do
+ * not normalise the joined Event
+ *
+ * The nodes touched by the join are marked as dirty instead. The joined Event
+ * must be normalised with ::ITC_Event_normaliseDirty() before anything other
+ * than another join is done with it.
+ *
+ * @note Both Events must have passed ::ITC_Event_validateForJoin()
+ * @note On success, `ppt_OtherEvent` will be automatically deallocated
+ * @param ppt_Event (in) The first existing Event. (out) The joined Event
+ * @param ppt_OtherEvent (in) The second existing Event. (out) NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_joinValidatedLazy(
+    ITC_Event_t **const ppt_Event,
+    ITC_Event_t **const ppt_OtherEvent
+);
+
+/**
+ * @brief Normalise the nodes of an Event marked as dirty by
+ * ::ITC_Event_joinValidatedLazy()
+ *
+ * Only the dirty nodes are visited. Does nothing if the Event is not dirty.
+ *
+ * @param pt_Event The Event to normalise. Must be valid
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_normaliseDirty(
+    ITC_Event_t *const pt_Event
+);
+
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
 /**
  * @brief Check if an Event is `less than or equal` (`<=`) to another Event
  *
@@ -106,6 +263,53 @@ ITC_Status_t ITC_Event_leq(
     bool *const pb_IsLeq
 );
 
+/**
+ * @brief Check if two Events are `less than or equal` (`<=`) to each other in
+ * both directions
+ *
+ * Same as calling ::ITC_Event_leq() twice, with the Events swapped the second
+ * time, but both checks are done in a single traversal of the Event trees.
+ * The traversal stops early if both checks fail (i.e. the Events are
+ * concurrent).
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pb_IsLeq12 (out) `true` if `*pt_Event1 <= *pt_Event2`. Otherwise
+ * `false`
+ * @param pb_IsLeq21 (out) `true` if `*pt_Event2 <= *pt_Event1`. Otherwise
+ * `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_leqBidirectional(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    bool *const pb_IsLeq12,
+    bool *const pb_IsLeq21
+);
+
+/**
+ * @brief Check if two Events are `less than or equal` (`<=`) to each other in
+ * both directions, similar to ::ITC_Event_leqBidirectional(), but without
+ * validating them first
+ *
+ * @note Both Events must have passed ::ITC_Event_validate()
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pb_IsLeq12 (out) `true` if `*pt_Event1 <= *pt_Event2`. Otherwise
+ * `false`
+ * @param pb_IsLeq21 (out) `true` if `*pt_Event2 <= *pt_Event1`. Otherwise
+ * `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_leqBidirectionalValidated(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    bool *const pb_IsLeq12,
+    bool *const pb_IsLeq21
+);
+
 /**
  * @brief Fill an Event
  *
@@ -142,6 +346,217 @@ ITC_Status_t ITC_Event_grow(
     const ITC_Id_t *const pt_Id
 );
 
+/**
+ * @brief Add a number of events to an Event
+ *
+ * Fills the Event (and grows it, if filling was not possible) only once. The
+ * fill counts as a single event, while the grow adds all of the remaining
+ * events to a single leaf.
+ *
+ * @note If `t_EventCount > 1`, the absolute event count of every leaf of the
+ * Event must be able to grow by `t_EventCount` without overflowing. This is
+ * checked before modifying the Event. On failure, the Event is left unmodified,
+ * unless growing the filled Event fails due to a memory allocation error
+ * @param ppt_Event The Event to add the events to
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param t_EventCount The number of events to add. Does nothing if `0`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the events cannot be added
+ * without overflowing an event counter
+ */
+ITC_Status_t ITC_Event_fillAndGrow(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    const ITC_Event_Counter_t t_EventCount
+);
+
+/**
+ * @brief Add a number of events to an Event, similar to
+ * ::ITC_Event_fillAndGrow(), but without validating the Event and ID first
+ *
+ * @note The Event must have passed ::ITC_Event_validate() and the ID must have
+ * passed ::ITC_Id_validate()
+ * @param ppt_Event The Event to add the events to
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param t_EventCount The number of events to add. Does nothing if `0`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the events cannot be added
+ * without overflowing an event counter
+ */
+ITC_Status_t ITC_Event_fillAndGrowValidated(
+    ITC_Event_t **const ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    const ITC_Event_Counter_t t_EventCount
+);
+
+/**
+ * @brief Compact an Event by collapsing the subtrees that are fully owned by
+ * an ID into leafs, starting at a given depth
+ *
+ * Collapsing an owned subtree into its maximum is the same inflation adding an
+ * event performs, so the compacted Event is always `>=` the original one. The
+ * Event is only modified where the ID owns the interval. Subtrees the ID only
+ * partly owns are descended into, so the resulting tree can still be deeper
+ * than `u32_MaxDepth`.
+ *
+ * @note The Event must have passed ::ITC_Event_validate(), be normalised and
+ * not be shared. The ID must have passed ::ITC_Id_validate()
+ * @note On failure, the Event is left unmodified
+ * @param pt_Event The Event to compact
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param u32_MaxDepth The depth from which the owned subtrees are collapsed.
+ * `0` collapses them all, starting with the root
+ * @param pu32_ReclaimedNodes (out) The number of Event nodes released
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * the Event cannot be represented
+ */
+ITC_Status_t ITC_Event_compactValidated(
+    ITC_Event_t *const pt_Event,
+    const ITC_Id_t *const pt_Id,
+    const uint32_t u32_MaxDepth,
+    uint32_t *const pu32_ReclaimedNodes
+);
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+
+/**
+ * @brief Get the lowest and highest absolute event count of an Event within
+ * each of the `2^u32_Depth` equally sized cells its interval is split into
+ *
+ * Used to bound the comparisons of the Stamps in an `ITC_CausalIndex_t`. If
+ * the highest count of every cell of an Event is `<=` the lowest count of the
+ * same cell of another Event, the first Event is `<=` the second one. If the
+ * lowest count of any cell is `>` the highest count of the same cell of the
+ * other Event, it is not.
+ *
+ * @note The Event must have passed ::ITC_Event_validate()
+ * @param pt_Event The Event
+ * @param u32_Depth The depth of the cells. Must be `< 32`
+ * @param pt_Min (out) The lowest absolute event count of each cell. Must have
+ * room for `2^u32_Depth` counters
+ * @param pt_Max (out) The highest absolute event count of each cell. Must
+ * have room for `2^u32_Depth` counters
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * the Event cannot be represented
+ */
+ITC_Status_t ITC_Event_getCellBounds(
+    const ITC_Event_t *const pt_Event,
+    const uint32_t u32_Depth,
+    ITC_Event_Counter_t *const pt_Min,
+    ITC_Event_Counter_t *const pt_Max
+);
+
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+
+/**
+ * @brief Subtract a base Event from an Event, or add it back
+ *
+ * Subtracting gives the Event whose absolute event count at every point of
+ * the interval is the count of the Event minus the count of the base. Adding
+ * the base back restores the original Event.
+ *
+ * @note Both Events must have passed ::ITC_Event_validate() and be
+ * normalised
+ * @param pt_Event The Event to rebase. It is not modified
+ * @param pt_Base The base Event
+ * @param b_Restore Whether to add the base back. Otherwise it is subtracted
+ * @param ppt_RebasedEvent (out) The pointer to the new rebased Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_UNDERFLOW` if the base is not `<=` the
+ * Event
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if an absolute event count of
+ * either Event, or of the restored Event, cannot be represented
+ */
+ITC_Status_t ITC_Event_rebaseValidated(
+    const ITC_Event_t *const pt_Event,
+    const ITC_Event_t *const pt_Base,
+    const bool b_Restore,
+    ITC_Event_t **const ppt_RebasedEvent
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+#if ITC_CONFIG_ENABLE_TRACING || ITC_CONFIG_ENABLE_NODE_RESERVATION || \
+    ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+
+/**
+ * @brief Count the nodes of an Event
+ *
+ * Used to report the tree sizes to the tracing hooks, to work out the
+ * number of nodes to reserve for an operation, and the number of nodes
+ * released by a deferred normalisation.
+ *
+ * @param pt_Event The Event. Must be valid
+ * @return `uint32_t` The number of nodes in the Event tree, or `0` if the
+ * Event is `NULL`
+ */
+uint32_t ITC_Event_countNodes(
+    const ITC_Event_t *const pt_Event
+);
+
+#endif /* ITC_CONFIG_ENABLE_TRACING || ITC_CONFIG_ENABLE_NODE_RESERVATION || ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+
+/**
+ * @brief Find the Event leaf that adding a new event will inflate
+ *
+ * Looks for the case where filling the Event is guaranteed to do nothing and
+ * growing it is guaranteed to only increment a single leaf, both now and after
+ * any number of subsequent events (using the same ID). This is the case when
+ * the ID owns a single contiguous interval, which lines up with an Event leaf,
+ * and the sibling of that leaf has a relative event count of 0.
+ *
+ * @note The Event and ID must be valid. They are not validated again
+ * @param pt_Event The Event
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param ppt_InflationLeaf (out) The Event leaf to increment when adding a
+ * new event. `NULL` if adding a new event requires a full fill/grow operation
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_findInflationLeaf(
+    ITC_Event_t *const pt_Event,
+    const ITC_Id_t *const pt_Id,
+    ITC_Event_t **const ppt_InflationLeaf
+);
+
+/**
+ * @brief Add a number of new events by incrementing a leaf previously found
+ * with ::ITC_Event_findInflationLeaf()
+ *
+ * @note The Event must be valid. It must not have been modified by anything
+ * other than this function since the leaf was found
+ * @param pt_Event The Event
+ * @param pt_InflationLeaf The Event leaf to increment
+ * @param t_EventCount The number of events to add
+ * @param pb_WasInflated (out) `true` if the leaf was incremented. `false` if
+ * the leaf is no longer part of the Event, in which case a full fill/grow
+ * operation is needed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the leaf cannot be
+ * incremented, using the same rules as ::ITC_Event_fillAndGrow(). The leaf is
+ * left unmodified
+ */
+ITC_Status_t ITC_Event_inflateLeaf(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t *const pt_InflationLeaf,
+    const ITC_Event_Counter_t t_EventCount,
+    bool *const pb_WasInflated
+);
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+
 #if IS_UNIT_TEST_BUILD
 
 /**
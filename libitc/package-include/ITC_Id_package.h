@@ -85,6 +85,94 @@ ITC_Status_t ITC_Id_validate(
 
 #endif /* !ITC_CONFIG_ENABLE_EXTENDED_API */
 
+/**
+ * @brief Clone an ID, similar to ::ITC_Id_clone(), but without validating it
+ * first
+ *
+ * @note The ID must have passed ::ITC_Id_validate()
+ * @param pt_Id The existing ID
+ * @param ppt_ClonedId (out) The pointer to the cloned ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_cloneValidated(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_ClonedId
+);
+
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+
+/**
+ * @brief Intern an ID
+ *
+ * Looks up a structurally equal ID in the intern table. If there is one, the
+ * passed ID is deallocated and replaced by a new reference to the interned
+ * one. Otherwise, the passed ID is added to the table. If the table is full,
+ * the ID is left as is.
+ *
+ * Each reference to an interned ID must be released with ::ITC_Id_destroy(),
+ * which only deallocates the ID once the last reference is released.
+ *
+ * @note The ID must have passed ::ITC_Id_validate() and must not be modified
+ * in place after being interned
+ * @param ppt_Id (in) The existing ID. Must be the root of an ID tree.
+ * (out) The interned ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_intern(
+    ITC_Id_t **const ppt_Id
+);
+
+/**
+ * @brief Share an ID instead of cloning it
+ *
+ * If the ID is interned, returns a new reference to it. Otherwise, behaves
+ * like ::ITC_Id_cloneValidated().
+ *
+ * @note The ID must have passed ::ITC_Id_validate()
+ * @param pt_Id The existing ID. Must be the root of an ID tree
+ * @param ppt_SharedId (out) The shared (or cloned) ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_share(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_SharedId
+);
+
+/**
+ * @brief Get the number of distinct IDs in the intern table
+ *
+ * @return `uint32_t` The number of interned IDs
+ */
+uint32_t ITC_Id_getInternedIdCount(void);
+
+/**
+ * @brief Forget all IDs in the intern table without deallocating them
+ *
+ * Used when the memory of the interned IDs is reclaimed without destroying
+ * them (i.e. ::ITC_Port_resetContext()).
+ */
+void ITC_Id_forgetInternedIds(void);
+
+/**
+ * @brief Update the intern table after an interned ID root has been moved
+ *
+ * Used when the nodes of an ID are relocated without destroying them (i.e.
+ * ::ITC_Port_compact()).
+ *
+ * @note The children of the moved root must already point to its new location
+ * @param pt_Id The old location of the interned ID root
+ * @param pt_NewId The new location of the interned ID root
+ */
+void ITC_Id_relocateInternedId(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t *const pt_NewId
+);
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+
 /**
  * @brief Split an ID similar to ::ITC_Id_split() but do not modify the source ID
  *
@@ -100,6 +188,23 @@ ITC_Status_t ITC_Id_splitConst(
     ITC_Id_t **const ppt_Id2
 );
 
+/**
+ * @brief Split an ID similar to ::ITC_Id_splitConst(), but without validating
+ * it first
+ *
+ * @note The ID must have passed ::ITC_Id_validate()
+ * @param pt_Id The existing ID
+ * @param ppt_Id1 The first half of the split ID
+ * @param ppt_Id2 The second half of the split ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_splitConstValidated(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **const ppt_Id1,
+    ITC_Id_t **const ppt_Id2
+);
+
 /**
  * @brief Sum two IDs similar to ::ITC_Id_sum() but do not modify the source IDs
  *
@@ -115,6 +220,97 @@ ITC_Status_t ITC_Id_sumConst(
     ITC_Id_t **const ppt_Id
 );
 
+/**
+ * @brief Sum two IDs similar to ::ITC_Id_sumConst(), but without validating
+ * them first
+ *
+ * @note Both IDs must have passed ::ITC_Id_validate()
+ * @param pt_Id1 The first existing ID
+ * @param pt_Id2 The second existing ID
+ * @param ppt_Id The summed ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_sumConstValidated(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2,
+    ITC_Id_t **const ppt_Id
+);
+
+/**
+ * @brief Split an ID in place similar to ::ITC_Id_split(), but without
+ * validating it first
+ *
+ * The nodes of the ID are moved into the two halves instead of being cloned.
+ * Only the nodes that do not exist in the original ID are allocated. If the
+ * ID is interned, a copy of it is split instead, and the ID is released.
+ *
+ * @note The ID must have passed ::ITC_Id_validate(). On failure, the ID is
+ * left unmodified
+ * @param ppt_Id (in) The ID to split. (out) The first half of the split ID
+ * @param ppt_OtherId (out) The second half of the split ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_splitValidated(
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t **const ppt_OtherId
+);
+
+/**
+ * @brief Check whether two IDs can be summed, i.e. their intervals do not
+ * overlap
+ *
+ * @note Both IDs must have passed ::ITC_Id_validate()
+ * @param pt_Id1 The first ID
+ * @param pt_Id2 The second ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the intervals overlap
+ */
+ITC_Status_t ITC_Id_validateSum(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2
+);
+
+/**
+ * @brief Sum two IDs in place similar to ::ITC_Id_sum(), but without
+ * validating them first
+ *
+ * The nodes of both IDs are moved into the summed ID instead of being cloned,
+ * and the remaining ones are deallocated. No nodes are allocated. If either
+ * ID is interned, copies of them are summed instead, and both IDs are
+ * released.
+ *
+ * @note Both IDs must have passed ::ITC_Id_validate() and
+ * ::ITC_Id_validateSum()
+ * @param ppt_Id (in) The first ID. (out) The summed ID
+ * @param ppt_OtherId (in) The second ID. (out) `NULL`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_sumValidated(
+    ITC_Id_t **const ppt_Id,
+    ITC_Id_t **const ppt_OtherId
+);
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/**
+ * @brief Count the nodes of an ID
+ *
+ * Used to work out the number of nodes to reserve for an operation.
+ *
+ * @param pt_Id The ID. Must be valid
+ * @return `uint32_t` The number of nodes in the ID tree, or `0` if the ID is
+ * `NULL`
+ */
+uint32_t ITC_Id_countNodes(
+    const ITC_Id_t *const pt_Id
+);
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
 #if IS_UNIT_TEST_BUILD
 
 /**
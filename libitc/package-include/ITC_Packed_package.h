@@ -0,0 +1,108 @@
+/**
+ * @file ITC_Packed_package.h
+ * @brief Package definitions for the Interval Tree Clock's packed ID, Event
+ * and Stamp representations
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_PACKED_PACKAGE_H_
+#define ITC_PACKED_PACKAGE_H_
+
+#include "ITC_Config.h"
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+
+#include "ITC_Packed.h"
+
+#include "ITC_Id.h"
+#include "ITC_Event.h"
+#include "ITC_Status.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+#if !ITC_CONFIG_ENABLE_EXTENDED_API
+
+/**
+ * @brief Pack an existing ITC ID
+ *
+ * @param pt_Id The ID to pack
+ * @param pt_PackedId The packed ID. `pu8_Nodes` and `u32_Capacity` must be
+ * set by the caller. On success, `u32_Length` holds the number of nodes used.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_PackedId_fromId(
+    const ITC_Id_t *const pt_Id,
+    ITC_PackedId_t *const pt_PackedId
+);
+
+/**
+ * @brief Unpack a packed ID into a newly allocated ITC ID
+ *
+ * @param pt_PackedId The packed ID
+ * @param ppt_Id (out) The pointer to the unpacked ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_PackedId_toId(
+    const ITC_PackedId_t *const pt_PackedId,
+    ITC_Id_t **const ppt_Id
+);
+
+/**
+ * @brief Pack an existing ITC Event
+ *
+ * @param pt_Event The Event to pack
+ * @param pt_PackedEvent The packed Event. `pt_Nodes` and `u32_Capacity` must
+ * be set by the caller. On success, `u32_Length` holds the number of nodes
+ * used.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the absolute event count of a
+ * leaf cannot be represented
+ */
+ITC_Status_t ITC_PackedEvent_fromEvent(
+    const ITC_Event_t *const pt_Event,
+    ITC_PackedEvent_t *const pt_PackedEvent
+);
+
+/**
+ * @brief Unpack a packed Event into a newly allocated ITC Event
+ *
+ * @param pt_PackedEvent The packed Event
+ * @param ppt_Event (out) The pointer to the unpacked Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_PackedEvent_toEvent(
+    const ITC_PackedEvent_t *const pt_PackedEvent,
+    ITC_Event_t **const ppt_Event
+);
+
+#endif /* !ITC_CONFIG_ENABLE_EXTENDED_API */
+
+/**
+ * @brief Find the end of a packed ID subtree
+ *
+ * @note The packed ID must be valid. See ::ITC_PackedId_validate()
+ * @param pt_PackedId The packed ID
+ * @param pu32_Index (in) The index of the root node of the subtree. (out) The
+ * index of the first node after the subtree
+ */
+void ITC_PackedId_skipSubtree(
+    const ITC_PackedId_t *const pt_PackedId,
+    uint32_t *const pu32_Index
+);
+
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+#endif /* ITC_PACKED_PACKAGE_H_ */
@@ -0,0 +1,176 @@
+/**
+ * @file ITC_Port_package.h
+ * @brief Package port-specific definitions
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_PORT_PACKAGE_H_
+#define ITC_PORT_PACKAGE_H_
+
+#include "ITC_Port.h"
+
+#include "ITC_Status.h"
+#include "ITC_Config.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/** Trace the beginning of a phase. See ::ITC_Port_traceBegin() */
+#define ITC_PORT_TRACE_BEGIN(t_Phase)                                          \
+    ITC_Port_traceBegin(t_Phase)
+
+/** Trace the end of a phase. See ::ITC_Port_traceEnd()
+ * `u32_TreeSize` is only evaluated if there is an end hook to pass it to */
+#define ITC_PORT_TRACE_END(t_Phase, u32_TreeSize)                              \
+    do                                                                         \
+    {                                                                          \
+        if (ITC_Port_isTracing())                                              \
+        {                                                                      \
+            ITC_Port_traceEnd((t_Phase), (u32_TreeSize));                      \
+        }                                                                      \
+    } while (0)
+
+#else
+
+/** Tracing is disabled. Compiles to nothing */
+#define ITC_PORT_TRACE_BEGIN(t_Phase)
+
+/** Tracing is disabled. Compiles to nothing */
+#define ITC_PORT_TRACE_END(t_Phase, u32_TreeSize)
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/** Allocate a node. See ::ITC_Port_mallocNode() */
+#define ITC_PORT_MALLOC(ppv_Ptr, t_AllocType)                                  \
+    ITC_Port_mallocNode((ppv_Ptr), (t_AllocType))
+
+/** Deallocate a node. See ::ITC_Port_freeNode() */
+#define ITC_PORT_FREE(pv_Ptr, t_AllocType)                                     \
+    ITC_Port_freeNode((pv_Ptr), (t_AllocType))
+
+#else
+
+/** Node reservation is disabled. Allocate the node directly */
+#define ITC_PORT_MALLOC(ppv_Ptr, t_AllocType)                                  \
+    ITC_Port_malloc((ppv_Ptr), (t_AllocType))
+
+/** Node reservation is disabled. Deallocate the node directly */
+#define ITC_PORT_FREE(pv_Ptr, t_AllocType)                                     \
+    ITC_Port_free((pv_Ptr), (t_AllocType))
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+/******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/**
+ * @brief Allocate a node, taking it from the reservation bound to the calling
+ * thread if there is one
+ *
+ * See ::ITC_Port_setReservation()
+ *
+ * @param ppv_Ptr (out) Pointer to the allocated node
+ * @param t_AllocType The type of the node
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the reservation holds no
+ * more nodes of the type
+ */
+ITC_Status_t ITC_Port_mallocNode(
+    void **ppv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+);
+
+/**
+ * @brief Deallocate a node, putting it back into the reservation bound to the
+ * calling thread if there is one with room for it
+ *
+ * See ::ITC_Port_setReservation()
+ *
+ * @param pv_Ptr Pointer to the node to be freed
+ * @param t_AllocType The type of the node
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Port_freeNode(
+    void *pv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+);
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+#if ITC_CONFIG_ENABLE_STATS
+
+/**
+ * @brief Begin tracking the statistics of an operation
+ *
+ * @return `uint32_t` A marker, which must be passed to
+ * ::ITC_Port_statsEndOperation() when the operation ends
+ */
+uint32_t ITC_Port_statsBeginOperation(void);
+
+/**
+ * @brief End tracking the statistics of an operation
+ *
+ * @param t_Operation The operation
+ * @param u32_Marker The marker returned by ::ITC_Port_statsBeginOperation()
+ * @param t_Status The status the operation returned
+ */
+void ITC_Port_statsEndOperation(
+    const ITC_Port_Operation_t t_Operation,
+    const uint32_t u32_Marker,
+    const ITC_Status_t t_Status
+);
+
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/**
+ * @brief Check whether an end hook is registered
+ *
+ * The tree sizes passed to ::ITC_Port_traceEnd() only need to be counted if
+ * this is `true`.
+ *
+ * @return `true` if an end hook is registered. Otherwise `false`
+ */
+bool ITC_Port_isTracing(void);
+
+/**
+ * @brief Call the begin hook of a phase, if one is registered
+ *
+ * @param t_Phase The phase
+ */
+void ITC_Port_traceBegin(
+    const ITC_Port_TracePhase_t t_Phase
+);
+
+/**
+ * @brief Call the end hook of a phase, if one is registered
+ *
+ * @param t_Phase The phase
+ * @param u32_TreeSize The size of the tree the phase resulted in. See
+ * `ITC_Port_TracePhase_t`
+ */
+void ITC_Port_traceEnd(
+    const ITC_Port_TracePhase_t t_Phase,
+    const uint32_t u32_TreeSize
+);
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+#endif /* ITC_PORT_PACKAGE_H_ */
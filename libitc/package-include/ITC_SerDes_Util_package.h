@@ -14,6 +14,74 @@
 #include "ITC_Id.h"
 #include "ITC_Event.h"
 #include "ITC_Status.h"
+#include "ITC_Config.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+#include "ITC_SerDes.h"
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+#include "ITC_SerDes.h"
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/* The size of the chunk the streaming string serialisers batch their output
+ * into before handing it to the writer */
+#define ITC_SER_TO_STR_SINK_CHUNK_LEN                                       (64)
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/* Batches the output of the streaming string serialisers into chunks */
+typedef struct
+{
+    /** The writer receiving the chunks */
+    ITC_SerDes_StringWriter_t pfn_Writer;
+    /** The user context passed to the writer */
+    void *pv_Context;
+    /** The length of the pending chunk in bytes */
+    uint32_t u32_Length;
+    /** The pending chunk */
+    char rc_Chunk[ITC_SER_TO_STR_SINK_CHUNK_LEN];
+} ITC_SerDes_Util_StringSink_t;
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/* Writes a stream of bits into a buffer, most significant bit first */
+typedef struct
+{
+    /** The buffer to write to */
+    uint8_t *pu8_Buffer;
+    /** The size of the buffer in bytes */
+    uint32_t u32_BufferSize;
+    /** The number of bits written so far */
+    uint32_t u32_BitOffset;
+} ITC_SerDes_Util_BitWriter_t;
+
+/* Reads a stream of bits from a buffer, most significant bit first */
+typedef struct
+{
+    /** The buffer to read from */
+    const uint8_t *pu8_Buffer;
+    /** The size of the buffer in bytes */
+    uint32_t u32_BufferSize;
+    /** The number of bits read so far */
+    uint32_t u32_BitOffset;
+} ITC_SerDes_Util_BitReader_t;
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 
 /******************************************************************************
  * Functions
@@ -81,6 +149,24 @@ ITC_Status_t ITC_SerDes_Util_serialiseId(
     const bool b_AddVersion
 );
 
+/**
+ * @brief Get the size of an existing ITC Id once serialised
+ *
+ * The size is exact, i.e. ::ITC_SerDes_Util_serialiseId() succeeds with a
+ * buffer of this size and returns the same size.
+ *
+ * @param pt_Id The Id
+ * @param pu32_Size (out) The size of the serialised Id in bytes
+ * @param b_AddVersion Whether to account for the `ITC_VERSION_MAJOR` field
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_getSerialisedIdSize(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_Size,
+    const bool b_AddVersion
+);
+
 /**
  * @brief Deserialise an ITC Id
  *
@@ -133,6 +219,24 @@ ITC_Status_t ITC_SerDes_Util_serialiseEvent(
     const bool b_AddVersion
 );
 
+/**
+ * @brief Get the size of an existing ITC Event once serialised
+ *
+ * The size is exact, i.e. ::ITC_SerDes_Util_serialiseEvent() succeeds with a
+ * buffer of this size and returns the same size.
+ *
+ * @param pt_Event The Event
+ * @param pu32_Size (out) The size of the serialised Event in bytes
+ * @param b_AddVersion Whether to account for the `ITC_VERSION_MAJOR` field
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_getSerialisedEventSize(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_Size,
+    const bool b_AddVersion
+);
+
 /**
  * @brief Deserialise an ITC Event
  *
@@ -158,4 +262,447 @@ ITC_Status_t ITC_SerDes_Util_deserialiseEvent(
     ITC_Event_t **const ppt_Event
 );
 
+/**
+ * @brief Validate a serialised ITC Id without deserialising it
+ *
+ * Performs the same checks as ::ITC_SerDes_Util_deserialiseId()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Id data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if the serialised Id is invalid
+ */
+ITC_Status_t ITC_SerDes_Util_validateSerialisedId(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion
+);
+
+/**
+ * @brief Check if a serialised Event is `<=` to another serialised Event,
+ * without deserialising either of them
+ *
+ * Both buffers are validated in the same way as during
+ * ::ITC_SerDes_Util_deserialiseEvent()
+ *
+ * @param pu8_Buffer1 The buffer holding the first serialised Event data
+ * @param u32_BufferSize1 The size of the first buffer in bytes
+ * @param pu8_Buffer2 The buffer holding the second serialised Event data
+ * @param u32_BufferSize2 The size of the second buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised inputs
+ * @param pb_IsLeq12 (out) `true` if `Event1 <= Event2`. Otherwise `false`
+ * @param pb_IsLeq21 (out) `true` if `Event2 <= Event1`. Otherwise `false`.
+ * Optional, the check is skipped if NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_leqSerialisedEvents(
+    const uint8_t *const pu8_Buffer1,
+    const uint32_t u32_BufferSize1,
+    const uint8_t *const pu8_Buffer2,
+    const uint32_t u32_BufferSize2,
+    const bool b_HasVersion,
+    bool *const pb_IsLeq12,
+    bool *const pb_IsLeq21
+);
+
+/**
+ * @brief Validate a serialised ITC Event without deserialising it
+ *
+ * Performs the same checks as ::ITC_SerDes_Util_deserialiseEvent()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Event data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the serialised Event is invalid
+ */
+ITC_Status_t ITC_SerDes_Util_validateSerialisedEvent(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion
+);
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/**
+ * @brief Serialise a serialised ITC Id to ASCII string, without deserialising
+ * it
+ *
+ * @note The output buffer is always NULL-terminated
+ * @warning The serialised Id is not validated. See
+ * ::ITC_SerDes_Util_validateSerialisedId()
+ * @param pu8_Buffer The buffer holding the serialised Id data (without the
+ * `ITC_VERSION_MAJOR` field)
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pc_Buffer The buffer to hold the string
+ * @param pu32_StringSize (in) The size of the string buffer in bytes. (out)
+ * The size of the data inside the string buffer in bytes (including the NULL
+ * termination byte).
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_Util_serialisedIdToString(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    char *const pc_Buffer,
+    uint32_t *const pu32_StringSize
+);
+
+/**
+ * @brief Serialise a serialised ITC Event to ASCII string, without
+ * deserialising it
+ *
+ * @note The output buffer is always NULL-terminated
+ * @warning The serialised Event is not validated. See
+ * ::ITC_SerDes_Util_validateSerialisedEvent()
+ * @param pu8_Buffer The buffer holding the serialised Event data (without the
+ * `ITC_VERSION_MAJOR` field)
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pc_Buffer The buffer to hold the string
+ * @param pu32_StringSize (in) The size of the string buffer in bytes. (out)
+ * The size of the data inside the string buffer in bytes (including the NULL
+ * termination byte).
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_Util_serialisedEventToString(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    char *const pc_Buffer,
+    uint32_t *const pu32_StringSize
+);
+
+/**
+ * @brief Initialise a string sink
+ *
+ * @param pt_Sink The sink
+ * @param pfn_Writer The writer receiving the chunks
+ * @param pv_Context The user context passed to the writer
+ */
+void ITC_SerDes_Util_initStringSink(
+    ITC_SerDes_Util_StringSink_t *const pt_Sink,
+    const ITC_SerDes_StringWriter_t pfn_Writer,
+    void *const pv_Context
+);
+
+/**
+ * @brief Append text to a string sink
+ *
+ * Hands the pending chunk to the writer first if the text does not fit in it.
+ * Text longer than the chunk itself is handed to the writer directly.
+ *
+ * @param pt_Sink The sink
+ * @param pc_Text The text to append. Need not be NULL-terminated
+ * @param u32_Length The length of the text in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+ITC_Status_t ITC_SerDes_Util_appendToStringSink(
+    ITC_SerDes_Util_StringSink_t *const pt_Sink,
+    const char *const pc_Text,
+    const uint32_t u32_Length
+);
+
+/**
+ * @brief Hand the pending chunk of a string sink to its writer
+ *
+ * @param pt_Sink The sink
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+ITC_Status_t ITC_SerDes_Util_flushStringSink(
+    ITC_SerDes_Util_StringSink_t *const pt_Sink
+);
+
+/**
+ * @brief Serialise an existing ITC Id to ASCII string through a string sink
+ *
+ * See ::ITC_SerDes_writeIdString()
+ *
+ * @param pt_Id The Id
+ * @param pt_Sink The sink. Not flushed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+ITC_Status_t ITC_SerDes_Util_writeIdString(
+    const ITC_Id_t *const pt_Id,
+    ITC_SerDes_Util_StringSink_t *const pt_Sink
+);
+
+/**
+ * @brief Serialise an existing ITC Event to ASCII string through a string sink
+ *
+ * See ::ITC_SerDes_writeEventString()
+ *
+ * @param pt_Event The Event
+ * @param pt_Sink The sink. Not flushed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval The status returned by the writer if it fails
+ */
+ITC_Status_t ITC_SerDes_Util_writeEventString(
+    const ITC_Event_t *const pt_Event,
+    ITC_SerDes_Util_StringSink_t *const pt_Sink
+);
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+
+/**
+ * @brief Write bits to a bit stream
+ *
+ * @param pt_Writer The bit stream
+ * @param u32_Bits The bits to write, right-aligned
+ * @param u32_BitCount The number of bits to write. Must be `<= 32`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough.
+ * Nothing is written in this case
+ */
+ITC_Status_t ITC_SerDes_Util_writeBits(
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer,
+    const uint32_t u32_Bits,
+    const uint32_t u32_BitCount
+);
+
+/**
+ * @brief Read bits from a bit stream
+ *
+ * @param pt_Reader The bit stream
+ * @param pu32_Bits (out) The bits read, right-aligned
+ * @param u32_BitCount The number of bits to read. Must be `<= 32`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if there are not enough bits
+ * left in the buffer. Nothing is read in this case
+ */
+ITC_Status_t ITC_SerDes_Util_readBits(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    uint32_t *const pu32_Bits,
+    const uint32_t u32_BitCount
+);
+
+/**
+ * @brief Check all bits of a bit stream have been read
+ *
+ * The bits left in the last partially read byte are padding and must be `0`.
+ *
+ * @param pt_Reader The bit stream
+ * @return `true` if only padding is left. Otherwise `false`
+ */
+bool ITC_SerDes_Util_isBitReaderAtEnd(
+    const ITC_SerDes_Util_BitReader_t *const pt_Reader
+);
+
+/**
+ * @brief Serialise an existing ITC Id in the compact format
+ *
+ * The ID tree is serialised in pre-order. Parent nodes are encoded as a
+ * single `1` bit, leaf nodes as a `0` bit followed by the ownership bit.
+ *
+ * @param pt_Id The Id
+ * @param pt_Writer The bit stream to write the serialised Id to
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_Util_serialiseIdCompact(
+    const ITC_Id_t *const pt_Id,
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer
+);
+
+/**
+ * @brief Deserialise an ITC Id in the compact format
+ *
+ * See ::ITC_SerDes_Util_serialiseIdCompact() for the data format. Stops at the
+ * last node of the tree, the rest of the bit stream is left unread.
+ *
+ * @param pt_Reader The bit stream holding the serialised Id
+ * @param ppt_Id The pointer to the deserialised Id
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if the serialised Id is invalid
+ */
+ITC_Status_t ITC_SerDes_Util_deserialiseIdCompact(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    ITC_Id_t **const ppt_Id
+);
+
+/**
+ * @brief Get the size of an existing ITC Id once serialised in the compact
+ * format
+ *
+ * @param pt_Id The Id
+ * @param pu32_BitCount (out) The size of the serialised Id in bits
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_getSerialisedIdCompactBitCount(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_BitCount
+);
+
+/**
+ * @brief Serialise an existing ITC Event in the compact format
+ *
+ * The Event tree is serialised in pre-order. Each node is encoded as an
+ * `IS_PARENT` bit, followed by a `HAS_COUNTER` bit. If the event counter is
+ * not `0`, `counter - 1` follows as an unsigned LEB128 number. A leaf with a
+ * `0` counter thus takes only 2 bits.
+ *
+ * @param pt_Event The Event
+ * @param pt_Writer The bit stream to write the serialised Event to
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_Util_serialiseEventCompact(
+    const ITC_Event_t *const pt_Event,
+    ITC_SerDes_Util_BitWriter_t *const pt_Writer
+);
+
+/**
+ * @brief Deserialise an ITC Event in the compact format
+ *
+ * See ::ITC_SerDes_Util_serialiseEventCompact() for the data format. Stops at
+ * the last node of the tree, the rest of the bit stream is left unread.
+ *
+ * @param pt_Reader The bit stream holding the serialised Event
+ * @param ppt_Event The pointer to the deserialised Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the serialised Event is invalid
+ * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if an event counter does
+ * not fit into an `ITC_Event_Counter_t`
+ */
+ITC_Status_t ITC_SerDes_Util_deserialiseEventCompact(
+    ITC_SerDes_Util_BitReader_t *const pt_Reader,
+    ITC_Event_t **const ppt_Event
+);
+
+/**
+ * @brief Get the size of an existing ITC Event once serialised in the compact
+ * format
+ *
+ * @param pt_Event The Event
+ * @param pu32_BitCount (out) The size of the serialised Event in bits
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_getSerialisedEventCompactBitCount(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_BitCount
+);
+
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+
+/**
+ * @brief Feed the next part of a serialised ID (without the
+ * `ITC_VERSION_MAJOR` field) to an ID decoder
+ *
+ * The ID is validated as soon as its last node has been deserialised.
+ *
+ * @note On failure, the partially deserialised ID is left in the decoder.
+ * Release it with ::ITC_SerDes_Util_resetIdDecoder()
+ * @param pt_Decoder The decoder
+ * @param pu8_Buffer The buffer holding the next part of the serialised ID
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if the serialised ID is invalid or the data
+ * continues past its end
+ */
+ITC_Status_t ITC_SerDes_Util_feedIdDecoder(
+    ITC_SerDes_IdDecoder_t *const pt_Decoder,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize
+);
+
+/**
+ * @brief Check an ID decoder has deserialised a whole ID
+ *
+ * On success the ID is available in `pt_Decoder->pt_Root`.
+ *
+ * @param pt_Decoder The decoder
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_ID` if the ID is incomplete
+ */
+ITC_Status_t ITC_SerDes_Util_finishIdDecoder(
+    const ITC_SerDes_IdDecoder_t *const pt_Decoder
+);
+
+/**
+ * @brief Reset an ID decoder, releasing any deserialised nodes
+ *
+ * @param pt_Decoder The decoder
+ */
+void ITC_SerDes_Util_resetIdDecoder(
+    ITC_SerDes_IdDecoder_t *const pt_Decoder
+);
+
+/**
+ * @brief Feed the next part of a serialised Event (without the
+ * `ITC_VERSION_MAJOR` field) to an Event decoder
+ *
+ * The Event is validated as soon as its last node has been deserialised.
+ *
+ * @note On failure, the partially deserialised Event is left in the decoder.
+ * Release it with ::ITC_SerDes_Util_resetEventDecoder()
+ * @param pt_Decoder The decoder
+ * @param pu8_Buffer The buffer holding the next part of the serialised Event
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the serialised Event is invalid or the
+ * data continues past its end
+ * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if an event counter does
+ * not fit into an `ITC_Event_Counter_t`
+ */
+ITC_Status_t ITC_SerDes_Util_feedEventDecoder(
+    ITC_SerDes_EventDecoder_t *const pt_Decoder,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize
+);
+
+/**
+ * @brief Check an Event decoder has deserialised a whole Event
+ *
+ * On success the Event is available in `pt_Decoder->pt_Root`.
+ *
+ * @param pt_Decoder The decoder
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_EVENT` if the Event is incomplete
+ */
+ITC_Status_t ITC_SerDes_Util_finishEventDecoder(
+    const ITC_SerDes_EventDecoder_t *const pt_Decoder
+);
+
+/**
+ * @brief Reset an Event decoder, releasing any deserialised nodes
+ *
+ * @param pt_Decoder The decoder
+ */
+void ITC_SerDes_Util_resetEventDecoder(
+    ITC_SerDes_EventDecoder_t *const pt_Decoder
+);
+
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+
 #endif /* ITC_SERDES_UTIL_PACKAGE_H_ */
@@ -58,6 +58,41 @@ ITC_Status_t ITC_SerDes_serialiseEventToString(
     char *const pc_Buffer,
     uint32_t *const pu32_BufferSize
 );
+
+/**
+ * @brief Get the length of an existing ITC Id once serialised to ASCII string
+ *
+ * The length is exact, i.e. ::ITC_SerDes_serialiseIdToString() succeeds with a
+ * buffer of this size and returns the same size.
+ *
+ * @param pt_Id The Id
+ * @param pu32_Length (out) The length of the string in bytes (including the
+ * NULL termination byte)
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getIdStringLength(
+    const ITC_Id_t *const pt_Id,
+    uint32_t *const pu32_Length
+);
+
+/**
+ * @brief Get the length of an existing ITC Event once serialised to ASCII
+ * string
+ *
+ * The length is exact, i.e. ::ITC_SerDes_serialiseEventToString() succeeds
+ * with a buffer of this size and returns the same size.
+ *
+ * @param pt_Event The Event
+ * @param pu32_Length (out) The length of the string in bytes (including the
+ * NULL termination byte)
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_getEventStringLength(
+    const ITC_Event_t *const pt_Event,
+    uint32_t *const pu32_Length
+);
 #endif /* !(ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API && ITC_CONFIG_ENABLE_EXTENDED_API) */
 
 #endif /* ITC_SERDES_PACKAGE_H_ */
@@ -16,9 +16,13 @@
 #include "ITC_Event_package.h"
 #include "ITC_TestUtil.h"
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT || \
+    ITC_CONFIG_ENABLE_SCRATCH_ARENA
 #include "ITC_Port.h"
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT || ITC_CONFIG_ENABLE_SCRATCH_ARENA */
 
 /******************************************************************************
  *  Private functions
@@ -1567,7 +1571,10 @@ const uint32_t gu32_InvalidSerialisedStampTableSize =
     ARRAY_COUNT(gpv_InvalidSerialisedStampConstructorTable);
 
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
 
 /* The array storing all allocated ITC Id nodes */
 ITC_Id_t grt_ItcIdNodeAllocationArray[MAX_ITC_ID_NODES] = { 0 };
@@ -1590,7 +1597,25 @@ ITC_Stamp_t *gpt_ItcStampNodeAllocationArray = &grt_ItcStampNodeAllocationArray[
 /* The length of the `gpt_ItcStampNodeAllocationArray` array */
 uint32_t gu32_ItcStampNodeAllocationArrayLength = ARRAY_COUNT(grt_ItcStampNodeAllocationArray);
 
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+
+/* The array backing the scratch arena */
+ITC_Event_t grt_ItcScratchNodeAllocationArray[MAX_ITC_SCRATCH_NODES] = { 0 };
+ITC_Event_t *gpt_ItcScratchNodeAllocationArray = &grt_ItcScratchNodeAllocationArray[0];
+
+/* The length of the `gpt_ItcScratchNodeAllocationArray` array */
+uint32_t gu32_ItcScratchNodeAllocationArrayLength = ARRAY_COUNT(grt_ItcScratchNodeAllocationArray);
+
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/* The port context backed by the static test node arrays */
+ITC_Port_Context_t gt_ItcTestContext = { 0 };
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 
 /******************************************************************************
  *  Public functions
@@ -1657,3 +1682,99 @@ ITC_Status_t ITC_TestUtil_newEvent(
 
     return t_Status;
 }
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/******************************************************************************
+ * Test all nodes in the static allocation arrays are free
+ ******************************************************************************/
+
+void ITC_TestUtil_testAllStaticNodesAreFree(void)
+{
+    const ITC_Port_AllocType_t rt_AllocTypes[] =
+    {
+        ITC_PORT_ALLOCTYPE_ITC_ID_T,
+        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
+        ITC_PORT_ALLOCTYPE_ITC_STAMP_T,
+    };
+    const uint32_t ru32_ArrayLengths[] =
+    {
+        MAX_ITC_ID_NODES,
+        MAX_ITC_EVENT_NODES,
+        MAX_ITC_STAMP_NODES,
+    };
+    /* The Event array is the largest one */
+    void *rpv_Nodes[MAX_ITC_EVENT_NODES + 1];
+    void *pv_Node;
+    uint32_t u32_Count;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rt_AllocTypes); u32_I++)
+    {
+        u32_Count = 0;
+
+        /* Allocate all free slots */
+        while (u32_Count < ARRAY_COUNT(rpv_Nodes) &&
+               ITC_Port_malloc(&pv_Node, rt_AllocTypes[u32_I]) ==
+                   ITC_STATUS_SUCCESS)
+        {
+            rpv_Nodes[u32_Count++] = pv_Node;
+        }
+
+        /* Give them back */
+        for (uint32_t u32_J = 0; u32_J < u32_Count; u32_J++)
+        {
+            TEST_SUCCESS(ITC_Port_free(rpv_Nodes[u32_J], rt_AllocTypes[u32_I]));
+        }
+
+        TEST_ASSERT_EQUAL_UINT(ru32_ArrayLengths[u32_I], u32_Count);
+    }
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/******************************************************************************
+ * Init the test port context and bind it to the calling thread
+ ******************************************************************************/
+
+void ITC_TestUtil_initTestContext(void)
+{
+    gt_ItcTestContext.t_IdPool.pv_Nodes = gpt_ItcIdNodeAllocationArray;
+    gt_ItcTestContext.t_IdPool.u32_Length = gu32_ItcIdNodeAllocationArrayLength;
+    gt_ItcTestContext.t_EventPool.pv_Nodes = gpt_ItcEventNodeAllocationArray;
+    gt_ItcTestContext.t_EventPool.u32_Length =
+        gu32_ItcEventNodeAllocationArrayLength;
+    gt_ItcTestContext.t_StampPool.pv_Nodes = gpt_ItcStampNodeAllocationArray;
+    gt_ItcTestContext.t_StampPool.u32_Length =
+        gu32_ItcStampNodeAllocationArrayLength;
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    gt_ItcTestContext.t_ScratchPool.pv_Nodes =
+        gpt_ItcScratchNodeAllocationArray;
+    gt_ItcTestContext.t_ScratchPool.u32_Length =
+        gu32_ItcScratchNodeAllocationArrayLength;
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+    TEST_SUCCESS(ITC_Port_initContext(&gt_ItcTestContext));
+    TEST_SUCCESS(ITC_Port_setContext(&gt_ItcTestContext));
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+
+/******************************************************************************
+ * Test all scratch arena nodes have been released
+ ******************************************************************************/
+
+void ITC_TestUtil_testScratchArenaIsEmpty(void)
+{
+    uint32_t u32_Marker;
+
+    TEST_SUCCESS(ITC_Port_arenaBegin(&u32_Marker));
+    TEST_ASSERT_EQUAL_UINT32(0, u32_Marker);
+}
+
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
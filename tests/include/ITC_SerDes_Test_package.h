@@ -11,6 +11,8 @@
 #ifndef ITC_SERDES_TEST_PACKAGE_H_
 #define ITC_SERDES_TEST_PACKAGE_H_
 
+#include "ITC_Config.h"
+
 #include <stdint.h>
 
 /******************************************************************************
@@ -21,6 +23,9 @@
  * c_args) */
 #define ITC_VERSION_MAJOR_LEN                                  (sizeof(uint8_t))
 
+/* Set in the version field of data serialised in the compact format */
+#define ITC_SERDES_COMPACT_FORMAT_FLAG                                   (0x80U)
+
 /* Set a field in a serialised ITC node header */
 #define ITC_SERDES_HEADER_SET(t_Header, t_Field, t_Mask, t_Offset)             \
   (((t_Header) & ~(t_Mask)) |                                                  \
@@ -54,6 +59,10 @@
 #define ITC_SERDES_EVENT_HEADER_MASK                                           \
     (ITC_SERDES_EVENT_IS_PARENT_MASK | ITC_SERDES_EVENT_COUNTER_LEN_MASK)
 
+/* The header of a serialised Event delta node, which stands for the whole
+ * matching subtree of the base Event */
+#define ITC_SERDES_EVENT_DELTA_COPY_HEADER                               (0x20U)
+
 /* The minimum possible length of a serialisation/deserialsation Event buffer
  * (a leaf Event) - version number + 1 `ITC_SerDes_Header_t` */
 #define ITC_SERDES_EVENT_MIN_BUFFER_LEN                                        \
@@ -143,6 +152,14 @@
    ITC_SERDES_STAMP_SET_EVENT_COMPONENT_LEN_LEN(                               \
         (ITC_SerDes_Header_t)0U, u8_LenEvent))
 
+/* The minimum possible length of a serialised Stamp batch (an empty batch).
+ * Requires:
+ *   - version number
+ *   - 1 batch header (`ITC_SerDes_Header_t`)
+ *   - 1 byte to denote the Stamp count */
+#define ITC_SERDES_STAMP_BATCH_MIN_BUFFER_LEN                                  \
+    (ITC_VERSION_MAJOR_LEN + sizeof(ITC_SerDes_Header_t) + sizeof(uint8_t))
+
 /* The minimum possible length of an ID serialisation (to string) string buffer
  * - a NULL terminated buffer. Requires 1 byte for the NULL termination. Keeping
  * the minimum length requirement to be just a NULL terminator ensures that even
@@ -164,6 +181,14 @@
  * at least be NULL terminated. */
 #define ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN                                  (1)
 
+/* The maximum length of an Event counter serialised to string - the number of
+ * decimal digits of the biggest counter value */
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+#define ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN                                (20)
+#else
+#define ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN                                (10)
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+
 /******************************************************************************
  * Types
  ******************************************************************************/
@@ -13,6 +13,7 @@
 #include "ITC_Id.h"
 #include "ITC_Event.h"
 #include "ITC_Stamp.h"
+#include "ITC_Port.h"
 #include "ITC_Status.h"
 #include "ITC_Config.h"
 
@@ -34,16 +35,32 @@
  */
 #define FIRST_NORMALISATION_RELATED_INVALID_EVENT_INDEX                      (7)
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
 
 /* The maximum number of statically allocated ITC ID nodes */
+#ifndef MAX_ITC_ID_NODES
 #define MAX_ITC_ID_NODES                                                    (82)
+#endif /* MAX_ITC_ID_NODES */
 /* The maximum number of statically allocated ITC Event nodes */
+#ifndef MAX_ITC_EVENT_NODES
 #define MAX_ITC_EVENT_NODES                                                (104)
+#endif /* MAX_ITC_EVENT_NODES */
 /* The maximum number of statically allocated ITC Stamp nodes */
+#ifndef MAX_ITC_STAMP_NODES
 #define MAX_ITC_STAMP_NODES                                                 (11)
+#endif /* MAX_ITC_STAMP_NODES */
 
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+/* The maximum number of statically allocated scratch arena nodes */
+#ifndef MAX_ITC_SCRATCH_NODES
+#define MAX_ITC_SCRATCH_NODES                                              (104)
+#endif /* MAX_ITC_SCRATCH_NODES */
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 
 /******************************************************************************
  *  Global variables
@@ -211,4 +228,41 @@ ITC_Status_t ITC_TestUtil_newEvent(
     ITC_Event_Counter_t t_Count
 );
 
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/**
+ * @brief Test all nodes in the static allocation arrays are free
+ *
+ * The free slots do not contain a fixed pattern in this mode. Instead, test
+ * every slot of each array can be allocated, then free them again.
+ */
+void ITC_TestUtil_testAllStaticNodesAreFree(void);
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/**
+ * @brief The port context backed by the static test node arrays
+ */
+extern ITC_Port_Context_t gt_ItcTestContext;
+
+/**
+ * @brief Init the test port context and bind it to the calling thread
+ */
+void ITC_TestUtil_initTestContext(void);
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+
+/**
+ * @brief Test all scratch arena nodes have been released
+ */
+void ITC_TestUtil_testScratchArenaIsEmpty(void);
+
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
 #endif /* ITC_TESTUTIL_H_ */
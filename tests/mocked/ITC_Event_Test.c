@@ -176,6 +176,7 @@ void ITC_Event_Test_normaliseEventIsRecoveredOnFailure(void)
 /* Test failed summing of two Events is properly cleaned up */
 void ITC_Event_Test_joinedEventIsDestroyedOnFailure(void)
 {
+#if !ITC_CONFIG_ENABLE_SCRATCH_ARENA
     ITC_Event_t rt_NewEvent[3] = { 0 };
     ITC_Event_t *rpt_NewEvent[] = {
         &rt_NewEvent[0],
@@ -295,50 +296,21 @@ void ITC_Event_Test_joinedEventIsDestroyedOnFailure(void)
     TEST_FAILURE(
         ITC_Event_joinConst(gpt_ParentEvent, gpt_LeafEvent, &pt_ResultEvent),
         ITC_STATUS_FAILURE);
+#else
+    TEST_IGNORE_MESSAGE("Scratch arena is enabled");
+#endif /* !ITC_CONFIG_ENABLE_SCRATCH_ARENA */
 }
 
-/* Test successful joining of two Events is properly cleaned up */
-void ITC_Event_Test_joinOriginalAndCopiedEventsAreDestroyedOnSucess(void)
+/* Test successful joining of two Events in place only destroys the leftover
+ * nodes of the other Event */
+void ITC_Event_Test_joinOnlyOtherEventIsDestroyedOnSucess(void)
 {
-#if ITC_CONFIG_ENABLE_EXTENDED_API
     ITC_Event_t t_OtherEvent = gt_LeafNode;
     ITC_Event_t *pt_OtherEvent = &t_OtherEvent;
+    ITC_Event_t *pt_OriginalEvent = gpt_LeafEvent;
 
-    ITC_Event_t t_NewEvent1 = { 0 };
-    ITC_Event_t *pt_NewEvent1 = &t_NewEvent1;
-    ITC_Event_t t_NewEvent2 = { 0 };
-    ITC_Event_t *pt_NewEvent2 = &t_NewEvent2;
-    ITC_Event_t t_NewEvent3 = { 0 };
-    ITC_Event_t *pt_NewEvent3 = &t_NewEvent3;
-
-    /* Setup expectations */
-    ITC_Port_malloc_ExpectAndReturn(
-        NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T, ITC_STATUS_SUCCESS);
-    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
-    ITC_Port_malloc_ReturnThruPtr_ppv_Ptr((void **)&pt_NewEvent1);
-
-    ITC_Port_malloc_ExpectAndReturn(
-        NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T, ITC_STATUS_SUCCESS);
-    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
-    ITC_Port_malloc_ReturnThruPtr_ppv_Ptr((void **)&pt_NewEvent2);
-
-    ITC_Port_malloc_ExpectAndReturn(
-        NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T, ITC_STATUS_SUCCESS);
-    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
-    ITC_Port_malloc_ReturnThruPtr_ppv_Ptr((void **)&pt_NewEvent3);
-
-    ITC_Port_free_ExpectAndReturn(
-        pt_NewEvent1,
-        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
-        ITC_STATUS_SUCCESS);
-    ITC_Port_free_ExpectAndReturn(
-        pt_NewEvent2,
-        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
-        ITC_STATUS_SUCCESS);
-    ITC_Port_free_ExpectAndReturn(
-        gpt_LeafEvent,
-        ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
-        ITC_STATUS_SUCCESS);
+    /* Setup expectations.
+     * The join is done in place, so nothing gets allocated */
     ITC_Port_free_ExpectAndReturn(
         pt_OtherEvent,
         ITC_PORT_ALLOCTYPE_ITC_EVENT_T,
@@ -347,9 +319,8 @@ void ITC_Event_Test_joinOriginalAndCopiedEventsAreDestroyedOnSucess(void)
     /* Test joining the Events */
     TEST_SUCCESS(ITC_Event_join(&gpt_LeafEvent, &pt_OtherEvent));
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(gpt_LeafEvent, 0);
-#else
-    TEST_IGNORE_MESSAGE("Extended API support is disabled");
-#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+    TEST_ASSERT_EQUAL_PTR(pt_OriginalEvent, gpt_LeafEvent);
+    TEST_ASSERT_NULL(pt_OtherEvent);
 }
 
 /* Test failed maximise an Event is properly recovered from */
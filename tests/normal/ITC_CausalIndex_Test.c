@@ -0,0 +1,730 @@
+/**
+ * @file ITC_CausalIndex_Test.c
+ * @brief Unit tests for the Interval Tree Clock's causal index
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_CausalIndex.h"
+#include "ITC_CausalIndex_Test.h"
+
+#include "ITC_Config.h"
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+#include "ITC_Stamp.h"
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+
+#include "ITC_Test_package.h"
+#include "ITC_TestUtil.h"
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+#include "ITC_Port.h"
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#include <string.h>
+
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/** The capacity of the test index. Spans several buckets, the last one being
+ * cut short */
+#define TEST_INDEX_CAPACITY                                                    \
+    (2U * ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH + 3U)
+
+/** The number of distinct Stamps used by the tests */
+#define TEST_STAMP_COUNT                                                     (6)
+
+/** All Stamp comparison results */
+#define TEST_ALL_RELATIONS                                                     \
+    ((uint32_t)ITC_STAMP_COMPARISON_LESS_THAN |                                \
+     (uint32_t)ITC_STAMP_COMPARISON_GREATER_THAN |                             \
+     (uint32_t)ITC_STAMP_COMPARISON_EQUAL |                                    \
+     (uint32_t)ITC_STAMP_COMPARISON_CONCURRENT)
+
+/******************************************************************************
+ *  Global variables
+ ******************************************************************************/
+
+/* The slots of the test index */
+static ITC_CausalIndex_Entry_t grt_Entries[TEST_INDEX_CAPACITY];
+
+/* The buckets of the test index */
+static ITC_CausalIndex_Bucket_t grt_Buckets[
+    ITC_CAUSAL_INDEX_BUCKET_COUNT(TEST_INDEX_CAPACITY)];
+
+/* The relations queried by the tests */
+static const uint32_t gru32_Relations[] =
+{
+    (uint32_t)ITC_STAMP_COMPARISON_LESS_THAN,
+    (uint32_t)ITC_STAMP_COMPARISON_GREATER_THAN,
+    (uint32_t)ITC_STAMP_COMPARISON_EQUAL,
+    (uint32_t)ITC_STAMP_COMPARISON_CONCURRENT,
+    (uint32_t)ITC_STAMP_COMPARISON_LESS_THAN |
+        (uint32_t)ITC_STAMP_COMPARISON_EQUAL,
+    TEST_ALL_RELATIONS,
+};
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Initialise an empty test index
+ *
+ * @param pt_Index The index
+ */
+static void initTestIndex(
+    ITC_CausalIndex_t *pt_Index
+)
+{
+    pt_Index->pt_Entries = &grt_Entries[0];
+    pt_Index->pt_Buckets = &grt_Buckets[0];
+    pt_Index->u32_Capacity = TEST_INDEX_CAPACITY;
+
+    TEST_SUCCESS(ITC_CausalIndex_init(pt_Index));
+}
+
+/**
+ * @brief Create Stamps with all kinds of relations to each other
+ *
+ * @param ppt_Stamps (out) The Stamps. Must have room for `TEST_STAMP_COUNT`
+ * Stamps
+ */
+static void newTestStamps(
+    ITC_Stamp_t **ppt_Stamps
+)
+{
+    ITC_Stamp_t *pt_PeekStamp;
+
+    /* 0: A seed that has not seen any events */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&ppt_Stamps[0]));
+
+    /* 1 and 2: Concurrent forks, that have each seen an event */
+    TEST_SUCCESS(ITC_Stamp_clone(ppt_Stamps[0], &ppt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_fork(&ppt_Stamps[1], &ppt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(ppt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_event(ppt_Stamps[2]));
+
+    /* 3: Equal to 1 */
+    TEST_SUCCESS(ITC_Stamp_newPeek(ppt_Stamps[1], &ppt_Stamps[3]));
+
+    /* 4: Dominates 1, concurrent to 2 */
+    TEST_SUCCESS(ITC_Stamp_clone(ppt_Stamps[1], &ppt_Stamps[4]));
+    TEST_SUCCESS(ITC_Stamp_event(ppt_Stamps[4]));
+    TEST_SUCCESS(ITC_Stamp_event(ppt_Stamps[4]));
+
+    /* 5: Dominates 1 and 2 */
+    TEST_SUCCESS(ITC_Stamp_clone(ppt_Stamps[2], &ppt_Stamps[5]));
+    TEST_SUCCESS(ITC_Stamp_newPeek(ppt_Stamps[1], &pt_PeekStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&ppt_Stamps[5], &pt_PeekStamp));
+}
+
+/**
+ * @brief Destroy the Stamps created with ::newTestStamps()
+ *
+ * @param ppt_Stamps The Stamps
+ */
+static void destroyTestStamps(
+    ITC_Stamp_t **ppt_Stamps
+)
+{
+    for (uint32_t u32_I = 0; u32_I < TEST_STAMP_COUNT; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&ppt_Stamps[u32_I]));
+    }
+}
+
+/**
+ * @brief Test every query of an index finds exactly the Stamps comparing
+ * to the queried Stamp accordingly
+ *
+ * @param pt_Index The index
+ * @param pt_Stamp The queried Stamp
+ */
+static void testQueriesMatchCompare(
+    const ITC_CausalIndex_t *pt_Index,
+    const ITC_Stamp_t *pt_Stamp
+)
+{
+    ITC_CausalIndex_Query_t t_Query;
+    ITC_Stamp_Comparison_t t_Relation;
+    ITC_Stamp_Comparison_t t_Expected;
+    uint32_t u32_Slot;
+    uint32_t u32_ExpectedSlot;
+    bool b_Found;
+
+    for (uint32_t u32_I = 0;
+         u32_I < sizeof(gru32_Relations) / sizeof(gru32_Relations[0]);
+         u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_CausalIndex_beginQuery(
+                pt_Index, pt_Stamp, gru32_Relations[u32_I], &t_Query));
+
+        u32_ExpectedSlot = 0;
+
+        do
+        {
+            TEST_SUCCESS(
+                ITC_CausalIndex_nextMatch(
+                    &t_Query, &u32_Slot, &t_Relation, &b_Found));
+
+            /* Every slot skipped over must not match */
+            while (u32_ExpectedSlot < pt_Index->u32_Capacity &&
+                   (!b_Found || u32_ExpectedSlot < u32_Slot))
+            {
+                if (pt_Index->pt_Entries[u32_ExpectedSlot].pt_Stamp)
+                {
+                    TEST_SUCCESS(
+                        ITC_Stamp_compare(
+                            pt_Index->pt_Entries[u32_ExpectedSlot].pt_Stamp,
+                            pt_Stamp,
+                            &t_Expected));
+                    TEST_ASSERT_EQUAL_UINT32(
+                        0, (uint32_t)t_Expected & gru32_Relations[u32_I]);
+                }
+
+                u32_ExpectedSlot++;
+            }
+
+            /* The match must have the reported relation */
+            if (b_Found)
+            {
+                TEST_ASSERT_EQUAL_UINT32(u32_ExpectedSlot, u32_Slot);
+                TEST_ASSERT_NOT_NULL(pt_Index->pt_Entries[u32_Slot].pt_Stamp);
+                TEST_SUCCESS(
+                    ITC_Stamp_compare(
+                        pt_Index->pt_Entries[u32_Slot].pt_Stamp,
+                        pt_Stamp,
+                        &t_Expected));
+                TEST_ASSERT_EQUAL(t_Expected, t_Relation);
+                TEST_ASSERT_NOT_EQUAL(
+                    0, (uint32_t)t_Relation & gru32_Relations[u32_I]);
+
+                u32_ExpectedSlot++;
+            }
+        } while (b_Found);
+
+        /* Once done, the query stays done */
+        TEST_SUCCESS(
+            ITC_CausalIndex_nextMatch(
+                &t_Query, &u32_Slot, &t_Relation, &b_Found));
+        TEST_ASSERT_FALSE(b_Found);
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/* Init test */
+void setUp(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    static bool b_MemoryInit = false;
+
+    if (!b_MemoryInit)
+    {
+        TEST_SUCCESS(ITC_Port_init());
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        ITC_TestUtil_initTestContext();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+        b_MemoryInit = true;
+    }
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/* Fini test */
+void tearDown(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+/* Test all memory is freed at the end of each test */
+
+    TEST_ASSERT_EQUAL_UINT(
+        ITC_PORT_FREE_SLOT_PATTERN,
+        ((uint8_t *)gpt_ItcIdNodeAllocationArray)[0]);
+    TEST_ASSERT_EQUAL_UINT(
+        0,
+        memcmp((const void *)&((uint8_t *)gpt_ItcIdNodeAllocationArray)[0],
+               (const void *)&((uint8_t *)gpt_ItcIdNodeAllocationArray)[1],
+               (gu32_ItcIdNodeAllocationArrayLength * sizeof(ITC_Id_t)) -
+                   1));
+
+    TEST_ASSERT_EQUAL_UINT(
+        ITC_PORT_FREE_SLOT_PATTERN,
+        ((uint8_t *)gpt_ItcEventNodeAllocationArray)[0]);
+    TEST_ASSERT_EQUAL_UINT(
+        0,
+        memcmp((const void *)&((uint8_t *)gpt_ItcEventNodeAllocationArray)[0],
+               (const void *)&((uint8_t *)gpt_ItcEventNodeAllocationArray)[1],
+               (gu32_ItcEventNodeAllocationArrayLength * sizeof(ITC_Event_t)) -
+                   1));
+
+    TEST_ASSERT_EQUAL_UINT(
+        ITC_PORT_FREE_SLOT_PATTERN,
+        ((uint8_t *)gpt_ItcStampNodeAllocationArray)[0]);
+    TEST_ASSERT_EQUAL_UINT(
+        0,
+        memcmp((const void *)&((uint8_t *)gpt_ItcStampNodeAllocationArray)[0],
+               (const void *)&((uint8_t *)gpt_ItcStampNodeAllocationArray)[1],
+               (gu32_ItcStampNodeAllocationArrayLength * sizeof(ITC_Stamp_t)) -
+                   1));
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* Test all memory is freed at the end of each test */
+    ITC_TestUtil_testAllStaticNodesAreFree();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /* Test the scratch arena is released at the end of each test */
+    ITC_TestUtil_testScratchArenaIsEmpty();
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+}
+
+/* Test initialising a causal index fails with invalid param */
+void ITC_CausalIndex_Test_initFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index = { NULL, &grt_Buckets[0], 1, 0 };
+
+    TEST_FAILURE(ITC_CausalIndex_init(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_CausalIndex_init(&t_Index), ITC_STATUS_INVALID_PARAM);
+
+    t_Index.pt_Entries = &grt_Entries[0];
+    t_Index.pt_Buckets = NULL;
+    TEST_FAILURE(ITC_CausalIndex_init(&t_Index), ITC_STATUS_INVALID_PARAM);
+
+    t_Index.pt_Buckets = &grt_Buckets[0];
+    t_Index.u32_Capacity = 0;
+    TEST_FAILURE(ITC_CausalIndex_init(&t_Index), ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
+
+/* Test modifying a causal index fails with invalid param */
+void ITC_CausalIndex_Test_modifyFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index;
+    ITC_Stamp_t *pt_Stamp;
+    uint32_t u32_Slot;
+
+    initTestIndex(&t_Index);
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_CausalIndex_insert(NULL, pt_Stamp, &u32_Slot),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_insert(&t_Index, NULL, &u32_Slot),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_insert(&t_Index, pt_Stamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* The slots must hold a Stamp */
+    TEST_FAILURE(
+        ITC_CausalIndex_update(&t_Index, 0, pt_Stamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_remove(&t_Index, 0), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_CausalIndex_insert(&t_Index, pt_Stamp, &u32_Slot));
+
+    TEST_FAILURE(
+        ITC_CausalIndex_update(NULL, u32_Slot, pt_Stamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_update(&t_Index, u32_Slot, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_update(&t_Index, TEST_INDEX_CAPACITY, pt_Stamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_remove(NULL, u32_Slot), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_remove(&t_Index, TEST_INDEX_CAPACITY),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* A failed update leaves the slot unmodified */
+    TEST_ASSERT_EQUAL_PTR(pt_Stamp, t_Index.pt_Entries[u32_Slot].pt_Stamp);
+    TEST_ASSERT_EQUAL_UINT32(1, t_Index.u32_Count);
+
+    TEST_SUCCESS(ITC_CausalIndex_remove(&t_Index, u32_Slot));
+    TEST_ASSERT_EQUAL_UINT32(0, t_Index.u32_Count);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
+
+/* Test adding an invalid Stamp to a causal index fails */
+void ITC_CausalIndex_Test_insertFailWithCorruptStamp(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index;
+    ITC_Stamp_t *pt_Stamp;
+    uint32_t u32_Slot;
+
+    initTestIndex(&t_Index);
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_CausalIndex_insert(&t_Index, pt_Stamp, &u32_Slot),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+        TEST_ASSERT_EQUAL_UINT32(0, t_Index.u32_Count);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
+
+/* Test adding a Stamp to a full causal index fails with insufficient
+ * resources */
+void ITC_CausalIndex_Test_insertFailWhenFull(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index;
+    ITC_Stamp_t *pt_Stamp;
+    uint32_t u32_Slot;
+
+    initTestIndex(&t_Index);
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* The slots are handed out in order */
+    for (uint32_t u32_I = 0; u32_I < TEST_INDEX_CAPACITY; u32_I++)
+    {
+        TEST_SUCCESS(ITC_CausalIndex_insert(&t_Index, pt_Stamp, &u32_Slot));
+        TEST_ASSERT_EQUAL_UINT32(u32_I, u32_Slot);
+    }
+
+    TEST_FAILURE(
+        ITC_CausalIndex_insert(&t_Index, pt_Stamp, &u32_Slot),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Freed slots are reused */
+    TEST_SUCCESS(
+        ITC_CausalIndex_remove(
+            &t_Index, ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH + 1U));
+    TEST_SUCCESS(ITC_CausalIndex_insert(&t_Index, pt_Stamp, &u32_Slot));
+    TEST_ASSERT_EQUAL_UINT32(
+        ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH + 1U, u32_Slot);
+    TEST_ASSERT_EQUAL_UINT32(TEST_INDEX_CAPACITY, t_Index.u32_Count);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
+
+/* Test querying a causal index fails with invalid param */
+void ITC_CausalIndex_Test_queryFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index;
+    ITC_CausalIndex_Query_t t_Query;
+    ITC_Stamp_Comparison_t t_Relation;
+    ITC_Stamp_t *pt_Stamp;
+    uint32_t u32_Slot;
+    bool b_Found;
+
+    initTestIndex(&t_Index);
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_CausalIndex_beginQuery(
+            NULL, pt_Stamp, TEST_ALL_RELATIONS, &t_Query),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_beginQuery(
+            &t_Index, NULL, TEST_ALL_RELATIONS, &t_Query),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_beginQuery(
+            &t_Index, pt_Stamp, TEST_ALL_RELATIONS, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_beginQuery(&t_Index, pt_Stamp, 0, &t_Query),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_beginQuery(
+            &t_Index, pt_Stamp, TEST_ALL_RELATIONS + 1U, &t_Query),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(
+        ITC_CausalIndex_beginQuery(
+            &t_Index, pt_Stamp, TEST_ALL_RELATIONS, &t_Query));
+
+    TEST_FAILURE(
+        ITC_CausalIndex_nextMatch(NULL, &u32_Slot, &t_Relation, &b_Found),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_nextMatch(&t_Query, NULL, &t_Relation, &b_Found),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_nextMatch(&t_Query, &u32_Slot, NULL, &b_Found),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_CausalIndex_nextMatch(&t_Query, &u32_Slot, &t_Relation, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Nothing to find in an empty index */
+    TEST_SUCCESS(
+        ITC_CausalIndex_nextMatch(&t_Query, &u32_Slot, &t_Relation, &b_Found));
+    TEST_ASSERT_FALSE(b_Found);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
+
+/* Test querying a causal index with an invalid Stamp fails */
+void ITC_CausalIndex_Test_queryFailWithCorruptStamp(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index;
+    ITC_CausalIndex_Query_t t_Query;
+    ITC_Stamp_t *pt_Stamp;
+
+    initTestIndex(&t_Index);
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_CausalIndex_beginQuery(
+                &t_Index, pt_Stamp, TEST_ALL_RELATIONS, &t_Query),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
+
+/* Test querying a causal index finds the same Stamps as comparing against each
+ * of them */
+void ITC_CausalIndex_Test_queryMatchesCompare(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index;
+    ITC_Stamp_t *rpt_Stamps[TEST_STAMP_COUNT];
+    uint32_t u32_Slot;
+
+    initTestIndex(&t_Index);
+    newTestStamps(&rpt_Stamps[0]);
+
+    /* Fill the whole index, so every bucket holds a mix of Stamps */
+    for (uint32_t u32_I = 0; u32_I < TEST_INDEX_CAPACITY; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_CausalIndex_insert(
+                &t_Index,
+                rpt_Stamps[(u32_I * 5U) % TEST_STAMP_COUNT],
+                &u32_Slot));
+    }
+
+    for (uint32_t u32_I = 0; u32_I < TEST_STAMP_COUNT; u32_I++)
+    {
+        testQueriesMatchCompare(&t_Index, rpt_Stamps[u32_I]);
+    }
+
+    /* Leave a bucket with the same Stamp only, and another bucket empty */
+    for (uint32_t u32_I = 0; u32_I < TEST_INDEX_CAPACITY; u32_I++)
+    {
+        if (u32_I < ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH)
+        {
+            TEST_SUCCESS(
+                ITC_CausalIndex_update(&t_Index, u32_I, rpt_Stamps[4]));
+        }
+        else if (u32_I < 2U * ITC_CONFIG_CAUSAL_INDEX_BUCKET_LENGTH)
+        {
+            TEST_SUCCESS(ITC_CausalIndex_remove(&t_Index, u32_I));
+        }
+    }
+
+    for (uint32_t u32_I = 0; u32_I < TEST_STAMP_COUNT; u32_I++)
+    {
+        testQueriesMatchCompare(&t_Index, rpt_Stamps[u32_I]);
+    }
+
+    destroyTestStamps(&rpt_Stamps[0]);
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
+
+/* Test indexed Stamps can be updated after being joined */
+void ITC_CausalIndex_Test_updateJoinedStamp(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index;
+    ITC_CausalIndex_Query_t t_Query;
+    ITC_Stamp_Comparison_t t_Relation;
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    uint32_t u32_Slot;
+    uint32_t u32_OtherSlot;
+    bool b_Found;
+
+    initTestIndex(&t_Index);
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+
+    TEST_SUCCESS(ITC_CausalIndex_insert(&t_Index, pt_Stamp, &u32_Slot));
+    TEST_SUCCESS(
+        ITC_CausalIndex_insert(&t_Index, pt_OtherStamp, &u32_OtherSlot));
+
+    /* The Stamps are concurrent */
+    TEST_SUCCESS(
+        ITC_CausalIndex_beginQuery(
+            &t_Index,
+            pt_Stamp,
+            (uint32_t)ITC_STAMP_COMPARISON_CONCURRENT,
+            &t_Query));
+    TEST_SUCCESS(
+        ITC_CausalIndex_nextMatch(&t_Query, &u32_Slot, &t_Relation, &b_Found));
+    TEST_ASSERT_TRUE(b_Found);
+    TEST_ASSERT_EQUAL_UINT32(u32_OtherSlot, u32_Slot);
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Relation);
+    TEST_SUCCESS(
+        ITC_CausalIndex_nextMatch(&t_Query, &u32_Slot, &t_Relation, &b_Found));
+    TEST_ASSERT_FALSE(b_Found);
+
+    /* Retire the other Stamp into the first one */
+    TEST_SUCCESS(ITC_CausalIndex_remove(&t_Index, u32_OtherSlot));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_CausalIndex_update(&t_Index, 0, pt_Stamp));
+    TEST_ASSERT_EQUAL_UINT32(1, t_Index.u32_Count);
+
+    /* The joined Stamp is only equal to itself */
+    testQueriesMatchCompare(&t_Index, pt_Stamp);
+    TEST_SUCCESS(
+        ITC_CausalIndex_beginQuery(
+            &t_Index, pt_Stamp, TEST_ALL_RELATIONS, &t_Query));
+    TEST_SUCCESS(
+        ITC_CausalIndex_nextMatch(&t_Query, &u32_Slot, &t_Relation, &b_Found));
+    TEST_ASSERT_TRUE(b_Found);
+    TEST_ASSERT_EQUAL_UINT32(0, u32_Slot);
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Relation);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
+
+/* Test the summaries settle the relations of a causal history without
+ * comparing the full Events */
+void ITC_CausalIndex_Test_querySkipsSettledComparisons(void)
+{
+#if ITC_CONFIG_ENABLE_CAUSAL_INDEX
+    ITC_CausalIndex_t t_Index;
+    ITC_CausalIndex_Query_t t_Query;
+    ITC_Stamp_Comparison_t t_Relation;
+    ITC_Stamp_t *rpt_History[TEST_STAMP_COUNT];
+    uint32_t u32_Slot;
+    uint32_t u32_Matches;
+    bool b_Found;
+
+    initTestIndex(&t_Index);
+
+    /* Every version of the Stamp dominates all the previous ones */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_History[0]));
+
+    for (uint32_t u32_I = 1; u32_I < TEST_STAMP_COUNT; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Stamp_clone(rpt_History[u32_I - 1], &rpt_History[u32_I]));
+        TEST_SUCCESS(ITC_Stamp_event(rpt_History[u32_I]));
+    }
+
+    for (uint32_t u32_I = 0; u32_I < TEST_INDEX_CAPACITY; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_CausalIndex_insert(
+                &t_Index, rpt_History[u32_I % TEST_STAMP_COUNT], &u32_Slot));
+    }
+
+    TEST_SUCCESS(
+        ITC_CausalIndex_beginQuery(
+            &t_Index,
+            rpt_History[2],
+            (uint32_t)ITC_STAMP_COMPARISON_LESS_THAN,
+            &t_Query));
+
+    u32_Matches = 0;
+
+    do
+    {
+        TEST_SUCCESS(
+            ITC_CausalIndex_nextMatch(
+                &t_Query, &u32_Slot, &t_Relation, &b_Found));
+
+        if (b_Found)
+        {
+            TEST_ASSERT_TRUE((u32_Slot % TEST_STAMP_COUNT) < 2U);
+            TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Relation);
+            u32_Matches++;
+        }
+    } while (b_Found);
+
+    /* The Events of a seed Stamp are leafs, which the summaries describe
+     * exactly */
+    TEST_ASSERT_EQUAL_UINT32(
+        (TEST_INDEX_CAPACITY / TEST_STAMP_COUNT) * 2U +
+            ((TEST_INDEX_CAPACITY % TEST_STAMP_COUNT > 2U) ?
+                2U :
+                TEST_INDEX_CAPACITY % TEST_STAMP_COUNT),
+        u32_Matches);
+    TEST_ASSERT_EQUAL_UINT32(0, t_Query.u32_Comparisons);
+
+    testQueriesMatchCompare(&t_Index, rpt_History[2]);
+
+    destroyTestStamps(&rpt_History[0]);
+#else
+    TEST_IGNORE_MESSAGE("Causal index is disabled");
+#endif /* ITC_CONFIG_ENABLE_CAUSAL_INDEX */
+}
@@ -15,16 +15,39 @@
 #include "ITC_Test_package.h"
 #include "ITC_TestUtil.h"
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
 #include "ITC_Port.h"
 
 #include <string.h>
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 
 /******************************************************************************
  *  Private functions
  ******************************************************************************/
 
+/* Test the single traversal comparison matches the expected results in both
+ * directions */
+static void checkEventLeqBidirectional(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    const bool b_ExpectedIsLeq12,
+    const bool b_ExpectedIsLeq21
+)
+{
+    bool b_IsLeq12; /* `pt_Event1 <= pt_Event2` */
+    bool b_IsLeq21; /* `pt_Event2 <= pt_Event1` */
+
+    TEST_SUCCESS(
+        ITC_Event_leqBidirectional(
+            pt_Event1, pt_Event2, &b_IsLeq12, &b_IsLeq21));
+
+    TEST_ASSERT_EQUAL(b_ExpectedIsLeq12, b_IsLeq12);
+    TEST_ASSERT_EQUAL(b_ExpectedIsLeq21, b_IsLeq21);
+}
+
 /* Test *pt_Event1 == *pt_Event2 */
 static void checkEventEqual(
     const ITC_Event_t *const pt_Event1,
@@ -40,6 +63,8 @@ static void checkEventEqual(
 
     TEST_ASSERT_TRUE(b_IsLeq12);
     TEST_ASSERT_TRUE(b_IsLeq21);
+
+    checkEventLeqBidirectional(pt_Event1, pt_Event2, true, true);
 }
 
 /* Test *pt_Event1 < *pt_Event2 */
@@ -57,6 +82,8 @@ static void checkEventLessThan(
 
     TEST_ASSERT_TRUE(b_IsLeq12);
     TEST_ASSERT_FALSE(b_IsLeq21);
+
+    checkEventLeqBidirectional(pt_Event1, pt_Event2, true, false);
 }
 
 /* Test *pt_Event1 > *pt_Event2 */
@@ -74,6 +101,8 @@ static void checkEventGreaterThan(
 
     TEST_ASSERT_FALSE(b_IsLeq12);
     TEST_ASSERT_TRUE(b_IsLeq21);
+
+    checkEventLeqBidirectional(pt_Event1, pt_Event2, false, true);
 }
 
 /* Test *pt_Event1 <> *pt_Event2 */
@@ -91,6 +120,8 @@ static void checkEventConcurrent(
 
     TEST_ASSERT_FALSE(b_IsLeq12);
     TEST_ASSERT_FALSE(b_IsLeq21);
+
+    checkEventLeqBidirectional(pt_Event1, pt_Event2, false, false);
 }
 
 static ITC_Status_t joinEvent(
@@ -98,28 +129,59 @@ static ITC_Status_t joinEvent(
     ITC_Event_t **ppt_OtherEvent
 )
 {
-#if !ITC_CONFIG_ENABLE_EXTENDED_API
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Event_t *pt_JoinedEvent;
+    ITC_Status_t t_ConstStatus;
+    ITC_Event_t *pt_ConstJoinedEvent = NULL;
+
+    /* Join the Events without modifying them first, so the result of the
+     * in-place join can be checked against it */
+    t_ConstStatus = ITC_Event_joinConst(
+        *ppt_Event, *ppt_OtherEvent, &pt_ConstJoinedEvent);
+
+    t_Status = ITC_Event_join(ppt_Event, ppt_OtherEvent);
 
-    t_Status = ITC_Event_joinConst(
-        *ppt_Event, *ppt_OtherEvent, &pt_JoinedEvent);
+    /* Both join variants must agree */
+    TEST_ASSERT_EQUAL(t_ConstStatus, t_Status);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        (void)ITC_Event_destroy(ppt_Event);
-        (void)ITC_Event_destroy(ppt_OtherEvent);
-
-        /* Return the joined Event */
-        *ppt_Event = pt_JoinedEvent;
+        TEST_ASSERT_NULL(*ppt_OtherEvent);
+        checkEventEqual(*ppt_Event, pt_ConstJoinedEvent);
+        TEST_SUCCESS(ITC_Event_destroy(&pt_ConstJoinedEvent));
     }
 
     return t_Status;
-#else
-    return ITC_Event_join(ppt_Event, ppt_OtherEvent);
-#endif /* !ITC_CONFIG_ENABLE_EXTENDED_API */
 }
 
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+
+/* Test the cached maximum of every parent node in an Event is known and up to
+ * date. Returns `max(e)` */
+static ITC_Event_Counter_t checkEventChildrenMax(
+    const ITC_Event_t *const pt_Event
+)
+{
+    ITC_Event_Counter_t t_LeftMax;
+    ITC_Event_Counter_t t_RightMax;
+    ITC_Event_Counter_t t_Max = pt_Event->t_Count;
+
+    if (pt_Event->pt_Left)
+    {
+        t_LeftMax = checkEventChildrenMax(pt_Event->pt_Left);
+        t_RightMax = checkEventChildrenMax(pt_Event->pt_Right);
+
+        TEST_ASSERT_EQUAL(
+            (t_LeftMax > t_RightMax) ? t_LeftMax : t_RightMax,
+            pt_Event->t_ChildrenMax);
+
+        t_Max += pt_Event->t_ChildrenMax;
+    }
+
+    return t_Max;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+
 /******************************************************************************
  *  Public functions
  ******************************************************************************/
@@ -127,15 +189,21 @@ static ITC_Status_t joinEvent(
 /* Init test */
 void setUp(void)
 {
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
     static bool b_MemoryInit = false;
 
     if (!b_MemoryInit)
     {
         TEST_SUCCESS(ITC_Port_init());
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        ITC_TestUtil_initTestContext();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
         b_MemoryInit = true;
     }
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 }
 
 /* Fini test */
@@ -173,7 +241,17 @@ void tearDown(void)
                (const void *)&((uint8_t *)gpt_ItcStampNodeAllocationArray)[1],
                (gu32_ItcStampNodeAllocationArrayLength * sizeof(ITC_Stamp_t)) -
                    1));
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* Test all memory is freed at the end of each test */
+    ITC_TestUtil_testAllStaticNodesAreFree();
 #endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /* Test the scratch arena is released at the end of each test */
+    ITC_TestUtil_testScratchArenaIsEmpty();
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
 }
 
 /* Test destroying an Event fails with invalid param */
@@ -224,6 +302,23 @@ void ITC_Event_Test_cloneEventFailInvalidParam(void)
   TEST_FAILURE(ITC_Event_clone(pt_DummyEvent, NULL), ITC_STATUS_INVALID_PARAM);
 }
 
+/* Test cloning an already validated Event fails with invalid param */
+void ITC_Event_Test_cloneValidatedEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_DummyEvent = NULL;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_Event_cloneValidated(NULL, &pt_DummyEvent),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_cloneValidated(pt_Event, NULL), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
 /* Test cloning an Event fails with corrupt event */
 void ITC_Event_Test_cloneEventFailWithCorruptEvent(void)
 {
@@ -285,6 +380,91 @@ void ITC_Event_Test_cloneEventSuccessful(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_ClonedEvent));
 }
 
+/* Test sharing and unsharing an Event fails with invalid param */
+void ITC_Event_Test_shareAndUnshareEventFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_DummyEvent = NULL;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_Event_share(NULL, &pt_DummyEvent), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Event_share(pt_Event, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Event_unshare(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_unshare(&pt_DummyEvent), ITC_STATUS_INVALID_PARAM);
+    TEST_ASSERT_FALSE(ITC_Event_isShared(NULL));
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Copy-on-write Events are disabled");
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+}
+
+/* Test sharing and unsharing an Event succeeds */
+void ITC_Event_Test_shareAndUnshareEventSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_SharedEvent1;
+    ITC_Event_t *pt_SharedEvent2;
+    ITC_Event_t *pt_PrivateEvent;
+
+    /* clang-format off */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 2));
+    /* clang-format on */
+    TEST_ASSERT_FALSE(ITC_Event_isShared(pt_Event));
+
+    /* Test sharing returns the same Event */
+    TEST_SUCCESS(ITC_Event_share(pt_Event, &pt_SharedEvent1));
+    TEST_SUCCESS(ITC_Event_share(pt_Event, &pt_SharedEvent2));
+    TEST_ASSERT_TRUE(pt_SharedEvent1 == pt_Event);
+    TEST_ASSERT_TRUE(pt_SharedEvent2 == pt_Event);
+    TEST_ASSERT_EQUAL(2, pt_Event->u32_ShareCount);
+    TEST_ASSERT_TRUE(ITC_Event_isShared(pt_Event));
+
+    /* Test destroying a shared reference keeps the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_SharedEvent1));
+    TEST_ASSERT_NULL(pt_SharedEvent1);
+    TEST_ASSERT_EQUAL(1, pt_Event->u32_ShareCount);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+
+    /* Test unsharing replaces the reference with a private copy */
+    pt_PrivateEvent = pt_SharedEvent2;
+    TEST_SUCCESS(ITC_Event_unshare(&pt_PrivateEvent));
+    TEST_ASSERT_TRUE(pt_PrivateEvent != pt_Event);
+    TEST_ASSERT_FALSE(ITC_Event_isShared(pt_Event));
+    TEST_ASSERT_FALSE(ITC_Event_isShared(pt_PrivateEvent));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_PrivateEvent, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_PrivateEvent->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_PrivateEvent->pt_Right, 2);
+
+    /* Test unsharing an Event that is not shared does nothing */
+    pt_SharedEvent2 = pt_PrivateEvent;
+    TEST_SUCCESS(ITC_Event_unshare(&pt_PrivateEvent));
+    TEST_ASSERT_TRUE(pt_PrivateEvent == pt_SharedEvent2);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_PrivateEvent));
+
+    /* Test sharing a saturated Event falls back to cloning it */
+    pt_Event->u32_ShareCount = UINT32_MAX;
+    TEST_SUCCESS(ITC_Event_share(pt_Event, &pt_SharedEvent1));
+    TEST_ASSERT_TRUE(pt_SharedEvent1 != pt_Event);
+    TEST_ASSERT_FALSE(ITC_Event_isShared(pt_SharedEvent1));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_SharedEvent1, 1);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_SharedEvent1));
+    pt_Event->u32_ShareCount = 0;
+
+    /* Test destroying the last reference deallocates the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Copy-on-write Events are disabled");
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+}
+
 /* Test validating an Event fails with invalid param */
 void ITC_Event_Test_validateEventFailInvalidParam(void)
 {
@@ -569,14 +749,25 @@ void ITC_Event_Test_maximiseComplexEventSucceeds(void)
 /* Test joining Events fails with invalid param */
 void ITC_Event_Test_joinEventFailInvalidParam(void)
 {
-#if ITC_CONFIG_ENABLE_EXTENDED_API
     ITC_Event_t *pt_Dummy = NULL;
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_SameEvent;
 
     TEST_FAILURE(ITC_Event_join(NULL, &pt_Dummy), ITC_STATUS_INVALID_PARAM);
     TEST_FAILURE(ITC_Event_join(&pt_Dummy, NULL), ITC_STATUS_INVALID_PARAM);
-#else
-    TEST_IGNORE_MESSAGE("Extended API support is disabled");
-#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+    /* Test joining an Event with itself in place fails */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    pt_SameEvent = pt_Event;
+
+    TEST_FAILURE(
+        ITC_Event_join(&pt_Event, &pt_SameEvent), ITC_STATUS_INVALID_PARAM);
+
+    /* Test the Event hasn't changed */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 1);
+    TEST_ASSERT_EQUAL_PTR(pt_Event, pt_SameEvent);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
 }
 
 /* Test const joining Events fails with invalid param */
@@ -1050,6 +1241,323 @@ void ITC_Event_Test_joinTwoComplexEventsSucceeds(void)
     }
 }
 
+/* Test joining Events in place reuses the nodes of the source Events */
+void ITC_Event_Test_joinEventInPlaceReusesNodesSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_t *pt_OriginalRoot;
+    ITC_Event_t *pt_OriginalSubtree;
+
+    /* clang-format off */
+    /* Construct the (1, 2, 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+
+    /* Construct the (0, (0, 5, 0), 3) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 5));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 3));
+    /* clang-format on */
+
+    pt_OriginalRoot = pt_Event;
+    pt_OriginalSubtree = pt_OtherEvent->pt_Left;
+
+    /* Test joining the events */
+    TEST_SUCCESS(ITC_Event_join(&pt_Event, &pt_OtherEvent));
+    TEST_ASSERT_NULL(pt_OtherEvent);
+
+    /* clang-format off */
+    /* Test the joined event is a (3, (0, 2, 0), 0) event */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 3);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+    /* clang-format on */
+
+    /* Test the root node was kept and the deeper subtree was moved over from
+     * the other Event */
+    TEST_ASSERT_EQUAL_PTR(pt_OriginalRoot, pt_Event);
+    TEST_ASSERT_EQUAL_PTR(pt_OriginalSubtree, pt_Event->pt_Left);
+    TEST_ASSERT_EQUAL_PTR(pt_Event, pt_Event->pt_Left->pt_Parent);
+
+    /* Test the joined Event is valid */
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test validating an Event for joining fails with corrupt Event */
+void ITC_Event_Test_validateEventForJoinFailWithCorruptEvent(void)
+{
+    ITC_Event_t *pt_Event;
+
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidEventTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Event);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_Event_validateForJoin(pt_Event), ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Event);
+    }
+}
+
+/* Test validating an Event for joining fails with event counter overflow */
+void ITC_Event_Test_validateEventForJoinFailWithEventCounterOverflow(void)
+{
+    ITC_Event_t *pt_Event;
+
+    /* clang-format off */
+    /* Create the Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, ((ITC_Event_Counter_t)~0) - 1));
+    /* clang-format on */
+
+    /* The absolute count of the right leaf fits in an event counter */
+    TEST_SUCCESS(ITC_Event_validateForJoin(pt_Event));
+
+    /* Test for the failure */
+    pt_Event->pt_Right->t_Count++;
+    TEST_FAILURE(
+        ITC_Event_validateForJoin(pt_Event),
+        ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test joining validated Events fails with invalid param */
+void ITC_Event_Test_joinValidatedEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_NullEvent = NULL;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_Event_joinValidated(&pt_Event, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_joinValidated(NULL, &pt_Event), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_joinValidated(&pt_Event, &pt_NullEvent),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_joinValidated(&pt_NullEvent, &pt_Event),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_joinValidated(&pt_Event, &pt_Event),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test joining Events lazily and normalising them afterwards */
+void ITC_Event_Test_joinEventLazilyAndNormaliseDirtySucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+
+    TEST_FAILURE(ITC_Event_normaliseDirty(NULL), ITC_STATUS_INVALID_PARAM);
+
+    /* clang-format off */
+    /* Construct the (0, (0, 1, 0), 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Left, pt_Event->pt_Left, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Right, pt_Event->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+
+    /* Construct the (0, (0, 0, 1), 2) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 2));
+    /* clang-format on */
+
+    /* Test the lazy join leaves the (0, (0, 1, 1), 2) Event behind */
+    TEST_SUCCESS(ITC_Event_joinValidatedLazy(&pt_Event, &pt_OtherEvent));
+    TEST_ASSERT_NULL(pt_OtherEvent);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Right, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 2);
+    TEST_ASSERT_TRUE(pt_Event->b_IsDirty);
+    TEST_ASSERT_TRUE(pt_Event->pt_Left->b_IsDirty);
+
+    /* Test the dirty Event is still considered valid */
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+
+    /* Test the Event is normalised to (1, 0, 1) */
+    TEST_SUCCESS(ITC_Event_normaliseDirty(pt_Event));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 1);
+    TEST_ASSERT_FALSE(pt_Event->b_IsDirty);
+    TEST_ASSERT_FALSE(pt_Event->pt_Left->b_IsDirty);
+
+    /* Test normalising a clean Event does nothing */
+    TEST_SUCCESS(ITC_Event_normaliseDirty(pt_Event));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+
+    /* Test a clean node with a dirty child is considered corrupt */
+    pt_Event->pt_Left->b_IsDirty = true;
+    TEST_FAILURE(ITC_Event_validate(pt_Event), ITC_STATUS_CORRUPT_EVENT);
+    pt_Event->pt_Left->b_IsDirty = false;
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Lazy Event normalisation is disabled");
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+}
+
+/* Test the cached subtree maximums are kept up to date and used by leq */
+void ITC_Event_Test_cachedSubtreeMaxSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE
+    ITC_Event_t *pt_HandBuiltEvent;
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Id_t *pt_Id;
+    bool b_IsLeq;
+    bool b_WasFilled;
+
+    /* clang-format off */
+    /* Construct the (0, (1, 2, 0), 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_HandBuiltEvent, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_HandBuiltEvent->pt_Left, pt_HandBuiltEvent, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_HandBuiltEvent->pt_Left->pt_Left, pt_HandBuiltEvent->pt_Left, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_HandBuiltEvent->pt_Left->pt_Right, pt_HandBuiltEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_HandBuiltEvent->pt_Right, pt_HandBuiltEvent, 0));
+    /* clang-format on */
+
+    /* Test the maximum of a hand built Event is not known */
+    TEST_ASSERT_EQUAL(
+        (ITC_Event_Counter_t)~(ITC_Event_Counter_t)0,
+        pt_HandBuiltEvent->t_ChildrenMax);
+
+    /* Test Events built by the Event operations have known maximums */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 0));
+    TEST_SUCCESS(
+        ITC_Event_joinConst(pt_HandBuiltEvent, pt_OtherEvent, &pt_Event));
+    TEST_ASSERT_EQUAL(3, checkEventChildrenMax(pt_Event));
+    TEST_ASSERT_EQUAL(3, pt_Event->t_ChildrenMax);
+
+    /* Test a leaf covering the whole Event */
+    pt_OtherEvent->t_Count = 3;
+    TEST_SUCCESS(ITC_Event_leq(pt_Event, pt_OtherEvent, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    checkEventLeqBidirectional(pt_Event, pt_OtherEvent, true, false);
+    TEST_SUCCESS(ITC_Event_leq(pt_HandBuiltEvent, pt_OtherEvent, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+
+    /* Test a leaf only covering some of the Event */
+    pt_OtherEvent->t_Count = 2;
+    TEST_SUCCESS(ITC_Event_leq(pt_Event, pt_OtherEvent, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+    checkEventLeqBidirectional(pt_Event, pt_OtherEvent, false, false);
+    TEST_SUCCESS(ITC_Event_leq(pt_HandBuiltEvent, pt_OtherEvent, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+
+    /* clang-format off */
+    /* Test the (2, 1, 0) Event covers the left subtree */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 0));
+    /* clang-format on */
+    TEST_SUCCESS(ITC_Event_leq(pt_Event, pt_OtherEvent, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    checkEventLeqBidirectional(pt_Event, pt_OtherEvent, true, false);
+    checkEventLeqBidirectional(pt_OtherEvent, pt_Event, false, true);
+
+    /* Test the (2, 0, 1) Event does not */
+    pt_OtherEvent->pt_Left->t_Count = 0;
+    pt_OtherEvent->pt_Right->t_Count = 1;
+    TEST_SUCCESS(ITC_Event_leq(pt_Event, pt_OtherEvent, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+    checkEventLeqBidirectional(pt_Event, pt_OtherEvent, false, false);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+
+    /* clang-format off */
+    /* Create the ((1, 0), 0) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left->pt_Left, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Right, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    /* clang-format on */
+
+    /* Test growing the Event into (0, (1, 6, 0), 0) */
+    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Left, 6);
+    TEST_ASSERT_EQUAL(7, checkEventChildrenMax(pt_Event));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* clang-format off */
+    /* Create the (0, 1) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right, pt_Id));
+    /* clang-format on */
+
+    /* Test filling the Event into (1, (0, 6, 0), 0) */
+    TEST_SUCCESS(ITC_Event_fill(&pt_Event, pt_Id, &b_WasFilled));
+    TEST_ASSERT_TRUE(b_WasFilled);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Left, 6);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_ASSERT_EQUAL(7, checkEventChildrenMax(pt_Event));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Test joining the hand built Event in place keeps (1, (0, 6, 0), 0) */
+    TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_OtherEvent));
+    TEST_SUCCESS(ITC_Event_join(&pt_OtherEvent, &pt_HandBuiltEvent));
+    checkEventEqual(pt_Event, pt_OtherEvent);
+    TEST_ASSERT_EQUAL(7, checkEventChildrenMax(pt_OtherEvent));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+
+    /* clang-format off */
+    /* Construct the (3, (0, 0, 1), 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 0));
+    /* clang-format on */
+
+    /* Test joining it in place into (3, (1, 3, 0), 0) */
+    TEST_SUCCESS(ITC_Event_join(&pt_Event, &pt_OtherEvent));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 3);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Left, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_ASSERT_EQUAL(7, checkEventChildrenMax(pt_Event));
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Event subtree max caching is disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX_CACHE */
+}
+
 /* Test comparing events fails with invalid param */
 void ITC_Event_Test_compareFailInvalidParam(void)
 {
@@ -1313,23 +1821,268 @@ void ITC_Event_Test_compareTwoParentEventsWith2LevelDifferenceSucceeds(void)
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Right->pt_Left->pt_Right, pt_Event1->pt_Right->pt_Left, 0));
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Right->pt_Right, pt_Event1->pt_Right, 0));
 
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2, NULL, 1));
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left, pt_Event2, 0));
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left->pt_Left, pt_Event2->pt_Left, 3));
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left->pt_Right, pt_Event2->pt_Left, 0));
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left->pt_Right->pt_Left, pt_Event2->pt_Left->pt_Right, 3));
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left->pt_Right->pt_Right, pt_Event2->pt_Left->pt_Right, 0));
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Right, pt_Event2, 10));
-    /* clang-format on */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left, pt_Event2, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left->pt_Left, pt_Event2->pt_Left, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left->pt_Right, pt_Event2->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left->pt_Right->pt_Left, pt_Event2->pt_Left->pt_Right, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left->pt_Right->pt_Right, pt_Event2->pt_Left->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Right, pt_Event2, 10));
+    /* clang-format on */
+
+    /* Compare Events */
+    checkEventLessThan(pt_Event1, pt_Event2);
+    /* Compare the other way around */
+    checkEventGreaterThan(pt_Event2, pt_Event1);
+
+    /* Make the 2 Events concurrent */
+    pt_Event1->pt_Right->t_Count = 0;
+    pt_Event1->pt_Left->t_Count = 5;
+
+    /* Compare Events */
+    checkEventConcurrent(pt_Event1, pt_Event2);
+    /* Compare the other way around */
+    checkEventConcurrent(pt_Event2, pt_Event1);
+
+    /* Check events are equal to themselves */
+    checkEventEqual(pt_Event1, pt_Event1);
+    checkEventEqual(pt_Event2, pt_Event2);
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+}
+
+/* Test comparing events in both directions fails with invalid param */
+void ITC_Event_Test_compareBidirectionalFailInvalidParam(void)
+{
+    ITC_Event_t *pt_DummyEvent = NULL;
+    bool b_DummyIsLeq12;
+    bool b_DummyIsLeq21;
+
+    TEST_FAILURE(
+        ITC_Event_leqBidirectional(
+            pt_DummyEvent,
+            pt_DummyEvent,
+            NULL,
+            &b_DummyIsLeq21),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_leqBidirectional(
+            pt_DummyEvent,
+            pt_DummyEvent,
+            &b_DummyIsLeq12,
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_leqBidirectional(
+            pt_DummyEvent,
+            NULL,
+            &b_DummyIsLeq12,
+            &b_DummyIsLeq21),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_leqBidirectional(
+            NULL,
+            pt_DummyEvent,
+            &b_DummyIsLeq12,
+            &b_DummyIsLeq21),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test comparing already validated Events in both directions fails with
+ * invalid param */
+void ITC_Event_Test_compareBidirectionalValidatedFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Event;
+    bool b_DummyIsLeq12;
+    bool b_DummyIsLeq21;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_Event_leqBidirectionalValidated(
+            pt_Event, pt_Event, NULL, &b_DummyIsLeq21),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_leqBidirectionalValidated(
+            pt_Event, pt_Event, &b_DummyIsLeq12, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_leqBidirectionalValidated(
+            pt_Event, NULL, &b_DummyIsLeq12, &b_DummyIsLeq21),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_leqBidirectionalValidated(
+            NULL, pt_Event, &b_DummyIsLeq12, &b_DummyIsLeq21),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test comparing Events in both directions fails with corrupt Event */
+void ITC_Event_Test_compareBidirectionalFailWithCorruptEvent(void)
+{
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    bool b_IsLeq12;
+    bool b_IsLeq21;
+
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidEventTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Event1);
+
+        /* Construct the other Event */
+        TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2, NULL, 0));
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_Event_leqBidirectional(
+                pt_Event1, pt_Event2, &b_IsLeq12, &b_IsLeq21),
+            ITC_STATUS_CORRUPT_EVENT);
+        /* And the other way around */
+        TEST_FAILURE(
+            ITC_Event_leqBidirectional(
+                pt_Event2, pt_Event1, &b_IsLeq12, &b_IsLeq21),
+            ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Events */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Event1);
+        TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+    }
+}
+
+/* Test comparing Events in both directions fails with event counter overflow */
+void ITC_Event_Test_compareBidirectionalFailWithEventCounterOverflow(void)
+{
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    bool b_IsLeq12;
+    bool b_IsLeq21;
+
+    /* clang-format off */
+    /* Create the Events */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left, pt_Event1, ((ITC_Event_Counter_t)~0)));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Right, pt_Event1, 0));
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2, NULL, 2));
+    /* clang-format on */
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_Event_leqBidirectional(
+            pt_Event1, pt_Event2, &b_IsLeq12, &b_IsLeq21),
+        ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+    /* And the other way around */
+    TEST_FAILURE(
+        ITC_Event_leqBidirectional(
+            pt_Event2, pt_Event1, &b_IsLeq12, &b_IsLeq21),
+        ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+}
+
+/* Test comparing Events in both directions with mixed tree shapes succeeds */
+void ITC_Event_Test_compareBidirectionalMixedShapeEventsSucceeds(void)
+{
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+
+    /* clang-format off */
+    /* Create the Events. Each one is deeper than the other in one of the
+     * branches:
+     * - (1, (0, 0, 2), 0)
+     * - (0, 2, (0, 0, (1, 0, 3))) */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left, pt_Event1, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left->pt_Left, pt_Event1->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left->pt_Right, pt_Event1->pt_Left, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Right, pt_Event1, 0));
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left, pt_Event2, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Right, pt_Event2, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Right->pt_Left, pt_Event2->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Right->pt_Right, pt_Event2->pt_Right, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Right->pt_Right->pt_Left, pt_Event2->pt_Right->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Right->pt_Right->pt_Right, pt_Event2->pt_Right->pt_Right, 3));
+    /* clang-format on */
+
+    /* Compare Events */
+    checkEventConcurrent(pt_Event1, pt_Event2);
+    /* Compare the other way around */
+    checkEventConcurrent(pt_Event2, pt_Event1);
+
+    /* Make Event 2 bigger */
+    pt_Event2->t_Count = 1;
+
+    /* Compare Events */
+    checkEventLessThan(pt_Event1, pt_Event2);
+    /* Compare the other way around */
+    checkEventGreaterThan(pt_Event2, pt_Event1);
+
+    /* Check events are equal to themselves */
+    checkEventEqual(pt_Event1, pt_Event1);
+    checkEventEqual(pt_Event2, pt_Event2);
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+}
+
+/* Test comparing Events deeper than the explicit traversal stack succeeds */
+void ITC_Event_Test_compareDeepEventsSucceeds(void)
+{
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    ITC_Event_t *pt_Parent1;
+    ITC_Event_t *pt_Parent2;
+
+    /* Create right-leaning Events, which are deeper than the explicit
+     * traversal stack (if enabled):
+     * - (0, 0, (0, 0, (... (0, 0, 1))))
+     * - (0, 0, (0, 0, (... (0, 0, 2)))) */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2, NULL, 0));
+
+    pt_Parent1 = pt_Event1;
+    pt_Parent2 = pt_Event2;
+
+    for (uint32_t u32_I = 0;
+         u32_I < ITC_CONFIG_EVENT_TRAVERSAL_STACK_LENGTH + 2U;
+         u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(&pt_Parent1->pt_Left, pt_Parent1, 0));
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(&pt_Parent1->pt_Right, pt_Parent1, 0));
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(&pt_Parent2->pt_Left, pt_Parent2, 0));
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(&pt_Parent2->pt_Right, pt_Parent2, 0));
+
+        pt_Parent1 = pt_Parent1->pt_Right;
+        pt_Parent2 = pt_Parent2->pt_Right;
+    }
+
+    pt_Parent1->t_Count = 1;
+    pt_Parent2->t_Count = 2;
 
     /* Compare Events */
     checkEventLessThan(pt_Event1, pt_Event2);
     /* Compare the other way around */
     checkEventGreaterThan(pt_Event2, pt_Event1);
 
-    /* Make the 2 Events concurrent */
-    pt_Event1->pt_Right->t_Count = 0;
-    pt_Event1->pt_Left->t_Count = 5;
+    /* Make Event 1 bigger in a branch that is visited before the deepest
+     * nodes */
+    pt_Event1->pt_Left->t_Count = 1;
 
     /* Compare Events */
     checkEventConcurrent(pt_Event1, pt_Event2);
@@ -2516,6 +3269,78 @@ void ITC_Event_Test_growEventFailWithEventCounterOverflow(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
 }
 
+/* Test growing an Event fails once the Event nodes are exhausted, leaving
+ * the Event unmodified */
+void ITC_Event_Test_growEventFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    ITC_Event_t *pt_Event;
+    ITC_Id_t *pt_Id;
+    void *rpv_Nodes[MAX_ITC_EVENT_NODES];
+    uint32_t u32_NodeCount = 0;
+
+    /* Create the ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+
+    /* Create the Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    /* Exhaust the Event nodes */
+    while (ITC_Port_malloc(
+               &rpv_Nodes[u32_NodeCount], ITC_PORT_ALLOCTYPE_ITC_EVENT_T) ==
+           ITC_STATUS_SUCCESS)
+    {
+        /* Mark the slot as used */
+        memset(rpv_Nodes[u32_NodeCount], 0, sizeof(ITC_Event_t));
+        u32_NodeCount++;
+    }
+
+    /* Test growing the leaf Event fails without a single free node */
+    TEST_FAILURE(
+        ITC_Event_grow(&pt_Event, pt_Id), ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 0);
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+
+    /* Test again with a single free node. It is enough to back up (or
+     * restore) the Event, but not to grow it */
+    u32_NodeCount--;
+    TEST_SUCCESS(
+        ITC_Port_free(rpv_Nodes[u32_NodeCount], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    TEST_FAILURE(
+        ITC_Event_grow(&pt_Event, pt_Id), ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 0);
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+
+    /* Release the nodes */
+    while (u32_NodeCount > 0)
+    {
+        u32_NodeCount--;
+        TEST_SUCCESS(
+            ITC_Port_free(
+                rpv_Nodes[u32_NodeCount], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    }
+
+    /* Test the Event can still be grown */
+    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
 /* Test growing a leaf Event with null and seed IDs succeeds */
 void ITC_Event_Test_growLeafEventWithNullAndSeedIdsSucceeds(void)
 {
@@ -2861,3 +3686,246 @@ void ITC_Event_Test_grow1102010EventWith10010IdSucceeds(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
     TEST_SUCCESS(ITC_Event_destroy(&pt_OriginalEvent));
 }
+
+/* Test filling and growing an Event fails with invalid param */
+void ITC_Event_Test_fillAndGrowEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_DummyEvent = NULL;
+    ITC_Id_t *pt_DummyId = NULL;
+
+    TEST_FAILURE(
+        ITC_Event_fillAndGrow(&pt_DummyEvent, NULL, 1),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_fillAndGrow(NULL, pt_DummyId, 1), ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test filling and growing an already validated Event fails with invalid
+ * param */
+void ITC_Event_Test_fillAndGrowValidatedEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_NullEvent = NULL;
+    ITC_Id_t *pt_Id;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    TEST_FAILURE(
+        ITC_Event_fillAndGrowValidated(&pt_Event, NULL, 1),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_fillAndGrowValidated(NULL, pt_Id, 1),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_fillAndGrowValidated(&pt_NullEvent, pt_Id, 1),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
+/* Test filling and growing an Event fails with corrupt Event and ID */
+void ITC_Event_Test_fillAndGrowEventFailWithCorruptEventAndId(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Id_t *pt_Id;
+
+    /* Create a valid ID */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidEventTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Event);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_Event_fillAndGrow(&pt_Event, pt_Id, 2),
+            ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Event);
+    }
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Create a valid Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    /* Test different invalid IDs are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidIdTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Id */
+        gpv_InvalidIdConstructorTable[u32_I](&pt_Id);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_Event_fillAndGrow(&pt_Event, pt_Id, 2),
+            ITC_STATUS_CORRUPT_ID);
+
+        /* Destroy the Id */
+        gpv_InvalidIdDestructorTable[u32_I](&pt_Id);
+    }
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test filling and growing an Event fails with event counter overflow */
+void ITC_Event_Test_fillAndGrowEventFailWithEventCounterOverflow(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Id_t *pt_Id;
+
+    /* Create the ID */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    /* Create the Event */
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event, NULL, ((ITC_Event_Counter_t)~0) - 1));
+
+    /* Test for the failure. The Event can fit a single extra event */
+    TEST_FAILURE(
+        ITC_Event_fillAndGrow(&pt_Event, pt_Id, 2),
+        ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    /* Test the Event hasn't changed */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, ((ITC_Event_Counter_t)~0) - 1);
+
+    /* Test adding the single event succeeds */
+    TEST_SUCCESS(ITC_Event_fillAndGrow(&pt_Event, pt_Id, 1));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, ((ITC_Event_Counter_t)~0));
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Test again but this time make the error occur deeper in the tree */
+
+    /* Create the ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right, pt_Id));
+
+    /* clang-format off */
+    /* Add nodes to the event */
+    pt_Event->t_Count = ((ITC_Event_Counter_t)~0) - 3;
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 1));
+    /* clang-format on */
+
+    /* Test for the failure. The absolute count of the right leaf can only fit
+     * 2 extra events */
+    TEST_FAILURE(
+        ITC_Event_fillAndGrow(&pt_Event, pt_Id, 3),
+        ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    /* Test the Event hasn't changed */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, ((ITC_Event_Counter_t)~0) - 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 1);
+
+    /* Test adding the 2 events succeeds */
+    TEST_SUCCESS(ITC_Event_fillAndGrow(&pt_Event, pt_Id, 2));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, ((ITC_Event_Counter_t)~0) - 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 3);
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test filling and growing a leaf Event with null and seed IDs succeeds */
+void ITC_Event_Test_fillAndGrowLeafEventWithNullAndSeedIdsSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OriginalEvent;
+    ITC_Id_t *pt_SeedId;
+    ITC_Id_t *pt_NullId;
+
+    /* Create the IDs */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_SeedId, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_NullId, NULL));
+
+    /* Create the Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 2));
+
+    /* Retain a copy for comparison */
+    TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_OriginalEvent));
+
+    /* Add events with a null ID */
+    TEST_SUCCESS(ITC_Event_fillAndGrow(&pt_Event, pt_NullId, 3));
+
+    /* Test the Event hasn't changed */
+    checkEventEqual(pt_OriginalEvent, pt_Event);
+
+    /* Add no events with a seed ID */
+    TEST_SUCCESS(ITC_Event_fillAndGrow(&pt_Event, pt_SeedId, 0));
+
+    /* Test the Event hasn't changed */
+    checkEventEqual(pt_OriginalEvent, pt_Event);
+
+    /* Add events with a seed ID */
+    TEST_SUCCESS(ITC_Event_fillAndGrow(&pt_Event, pt_SeedId, 5));
+
+    /* Test the event has changed */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, pt_OriginalEvent->t_Count + 5);
+    checkEventLessThan(pt_OriginalEvent, pt_Event);
+
+    /* Destroy the IDs */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_SeedId));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_NullId));
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OriginalEvent));
+}
+
+/* Test filling and growing a (1, 0, 3) Event with a (1, 0) ID fills the Event
+ * once and grows it with the remaining events */
+void ITC_Event_Test_fillAndGrow103EventWith10IdSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OriginalEvent;
+    ITC_Id_t *pt_Id;
+
+    /* Create the ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+
+    /* Create the Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 3));
+
+    /* Retain a copy for comparison */
+    TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_OriginalEvent));
+
+    /* Add the events. Filling results in a 4 leaf, which is then grown by the
+     * remaining 2 events */
+    TEST_SUCCESS(ITC_Event_fillAndGrow(&pt_Event, pt_Id, 3));
+
+    /* Test the Event has changed */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 4);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+    checkEventLessThan(pt_OriginalEvent, pt_Event);
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OriginalEvent));
+}
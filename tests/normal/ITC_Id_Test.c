@@ -14,11 +14,14 @@
 #include "ITC_Test_package.h"
 #include "ITC_TestUtil.h"
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
 #include "ITC_Port.h"
 
 #include <string.h>
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 
 
 /******************************************************************************
@@ -100,15 +103,21 @@ static ITC_Status_t sumId(
 /* Init test */
 void setUp(void)
 {
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
     static bool b_MemoryInit = false;
 
     if (!b_MemoryInit)
     {
         TEST_SUCCESS(ITC_Port_init());
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        ITC_TestUtil_initTestContext();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
         b_MemoryInit = true;
     }
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 }
 
 /* Fini test */
@@ -146,7 +155,17 @@ void tearDown(void)
                (const void *)&((uint8_t *)gpt_ItcStampNodeAllocationArray)[1],
                (gu32_ItcStampNodeAllocationArrayLength * sizeof(ITC_Stamp_t)) -
                    1));
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* Test all memory is freed at the end of each test */
+    ITC_TestUtil_testAllStaticNodesAreFree();
 #endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /* Test the scratch arena is released at the end of each test */
+    ITC_TestUtil_testScratchArenaIsEmpty();
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
 }
 
 /* Test destroying an ID fails with invalid param */
@@ -219,6 +238,22 @@ void ITC_Id_Test_cloneIdFailInvalidParam(void)
   TEST_FAILURE(ITC_Id_clone(pt_DummyId, NULL), ITC_STATUS_INVALID_PARAM);
 }
 
+/* Test cloning an already validated ID fails with invalid param */
+void ITC_Id_Test_cloneValidatedIdFailInvalidParam(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_DummyId = NULL;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    TEST_FAILURE(
+        ITC_Id_cloneValidated(NULL, &pt_DummyId), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_cloneValidated(pt_Id, NULL), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
 /* Test cloning an ID fails with corrupt ID */
 void ITC_Id_Test_cloneIdFailWithCorruptId(void)
 {
@@ -288,6 +323,136 @@ void ITC_Id_Test_cloneIdSuccessful(void)
     TEST_SUCCESS(ITC_Id_destroy(&pt_ClonedId));
 }
 
+/* Test interning and sharing an ID fails with invalid param */
+void ITC_Id_Test_internAndShareIdFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_DummyId = NULL;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    TEST_FAILURE(ITC_Id_intern(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Id_intern(&pt_DummyId), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Id_share(NULL, &pt_DummyId), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Id_share(pt_Id, NULL), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("ID interning is disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+}
+
+/* Test interning and sharing an ID succeeds */
+void ITC_Id_Test_internAndShareIdSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    ITC_Id_t *rpt_Ids[10];
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_SharedId;
+    uint32_t u32_IdCount = 0;
+    uint32_t u32_InternedIdCount = 0;
+
+    /* Create distinct IDs: 1, 0, and both halves of splitting the first half
+     * of the previous split, starting from a seed. I.e. (1, 0), (0, 1),
+     * ((1, 0), 0), ((0, 1), 0), etc. */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&rpt_Ids[u32_IdCount++], NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&rpt_Ids[u32_IdCount++], NULL));
+    pt_Id = rpt_Ids[0];
+
+    while (u32_IdCount < ARRAY_COUNT(rpt_Ids))
+    {
+        TEST_SUCCESS(
+            ITC_Id_splitConstValidated(
+                pt_Id, &rpt_Ids[u32_IdCount], &rpt_Ids[u32_IdCount + 1]));
+        pt_Id = rpt_Ids[u32_IdCount];
+        u32_IdCount += 2;
+    }
+
+    /* Test sharing an ID that is not interned clones it */
+    TEST_SUCCESS(ITC_Id_share(rpt_Ids[0], &pt_SharedId));
+    TEST_ASSERT_TRUE(pt_SharedId != rpt_Ids[0]);
+    TEST_ITC_ID_IS_SEED_ID(pt_SharedId);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_SharedId));
+
+    /* Test interning the IDs. They only fit if the table is big enough */
+    TEST_ASSERT_EQUAL(0, ITC_Id_getInternedIdCount());
+
+    for (uint32_t u32_I = 0; u32_I < u32_IdCount; u32_I++)
+    {
+        pt_Id = rpt_Ids[u32_I];
+        TEST_SUCCESS(ITC_Id_intern(&rpt_Ids[u32_I]));
+        TEST_ASSERT_TRUE(rpt_Ids[u32_I] == pt_Id);
+
+        if (u32_I < ITC_CONFIG_ID_INTERN_TABLE_LENGTH)
+        {
+            TEST_ASSERT_TRUE(rpt_Ids[u32_I]->b_IsInterned);
+            u32_InternedIdCount++;
+        }
+        else
+        {
+            TEST_ASSERT_FALSE(rpt_Ids[u32_I]->b_IsInterned);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(u32_InternedIdCount, ITC_Id_getInternedIdCount());
+
+    /* Test interning an equal ID returns a reference to the interned one,
+     * while removing every other interned ID */
+    for (uint32_t u32_I = 0; u32_I < u32_IdCount; u32_I++)
+    {
+        if (!rpt_Ids[u32_I]->b_IsInterned)
+        {
+            continue;
+        }
+
+        TEST_SUCCESS(ITC_Id_cloneValidated(rpt_Ids[u32_I], &pt_Id));
+        TEST_SUCCESS(ITC_Id_intern(&pt_Id));
+        TEST_ASSERT_TRUE(pt_Id == rpt_Ids[u32_I]);
+        TEST_ASSERT_EQUAL(1, rpt_Ids[u32_I]->u32_ShareCount);
+
+        /* Test sharing an interned ID only takes another reference */
+        TEST_SUCCESS(ITC_Id_share(rpt_Ids[u32_I], &pt_SharedId));
+        TEST_ASSERT_TRUE(pt_SharedId == rpt_Ids[u32_I]);
+        TEST_ASSERT_EQUAL(2, rpt_Ids[u32_I]->u32_ShareCount);
+
+        /* Test destroying a shared reference keeps the ID */
+        TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+        TEST_ASSERT_NULL(pt_Id);
+        TEST_SUCCESS(ITC_Id_destroy(&pt_SharedId));
+        TEST_ASSERT_EQUAL(0, rpt_Ids[u32_I]->u32_ShareCount);
+        TEST_ASSERT_EQUAL(u32_InternedIdCount, ITC_Id_getInternedIdCount());
+
+        if (u32_I % 2)
+        {
+            /* Test destroying the last reference removes the ID */
+            TEST_SUCCESS(ITC_Id_destroy(&rpt_Ids[u32_I]));
+            u32_InternedIdCount--;
+            TEST_ASSERT_EQUAL(
+                u32_InternedIdCount, ITC_Id_getInternedIdCount());
+        }
+    }
+
+    /* Test the remaining IDs can still be found */
+    for (uint32_t u32_I = 0; u32_I < u32_IdCount; u32_I++)
+    {
+        if (rpt_Ids[u32_I] && rpt_Ids[u32_I]->b_IsInterned)
+        {
+            TEST_SUCCESS(ITC_Id_cloneValidated(rpt_Ids[u32_I], &pt_Id));
+            TEST_SUCCESS(ITC_Id_intern(&pt_Id));
+            TEST_ASSERT_TRUE(pt_Id == rpt_Ids[u32_I]);
+            TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+        }
+
+        TEST_SUCCESS(ITC_Id_destroy(&rpt_Ids[u32_I]));
+    }
+
+    TEST_ASSERT_EQUAL(0, ITC_Id_getInternedIdCount());
+#else
+    TEST_IGNORE_MESSAGE("ID interning is disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+}
+
 /* Test spliting an ID fails with invalid param */
 void ITC_Id_Test_splitIdFailInvalidParam(void)
 {
@@ -332,6 +497,27 @@ void ITC_Id_Test_splitIdConstFailInvalidParam(void)
     ITC_STATUS_INVALID_PARAM);
 }
 
+/* Test splitting an already validated ID fails with invalid param */
+void ITC_Id_Test_splitIdConstValidatedFailInvalidParam(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_DummyId = NULL;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    TEST_FAILURE(
+        ITC_Id_splitConstValidated(pt_Id, &pt_DummyId, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_splitConstValidated(pt_Id, NULL, &pt_DummyId),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_splitConstValidated(NULL, &pt_DummyId, &pt_DummyId),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
 /* Test splitting an ID fails with corrupt ID */
 void ITC_Id_Test_splitIdFailWithCorruptId(void)
 {
@@ -1023,6 +1209,27 @@ void ITC_Id_Test_sumConstIdFailInvalidParam(void)
         ITC_STATUS_INVALID_PARAM);
 }
 
+/* Test summing already validated IDs fails with invalid param */
+void ITC_Id_Test_sumConstValidatedIdFailInvalidParam(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_DummyId = NULL;
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+
+    TEST_FAILURE(
+        ITC_Id_sumConstValidated(pt_Id, pt_Id, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_sumConstValidated(pt_Id, NULL, &pt_DummyId),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_sumConstValidated(NULL, pt_Id, &pt_DummyId),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
 /* Test summing an ID fails with corrupt ID */
 void ITC_Id_Test_sumIdFailWithCorruptId(void)
 {
@@ -1380,3 +1587,95 @@ void ITC_Id_Test_sumIdSplitSeedAndSumItBackToSeedSucceeds(void)
     TEST_ITC_ID_IS_SEED_ID(pt_Id7);
     TEST_SUCCESS(ITC_Id_destroy(&pt_Id7));
 }
+
+/* Test splitting an ID in place moves its subtrees into the halves */
+void ITC_Id_Test_splitIdInPlaceMovesSubtreesSucceeds(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId;
+    ITC_Id_t *pt_Root;
+    ITC_Id_t *pt_Left;
+    ITC_Id_t *pt_Right;
+
+    /* clang-format off */
+    /* Create the ((1, 0), (0, 1)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left->pt_Left, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Right, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+    /* clang-format on */
+
+    pt_Root = pt_Id;
+    pt_Left = pt_Id->pt_Left;
+    pt_Right = pt_Id->pt_Right;
+
+    /* Split the ID into ((1, 0), 0) and (0, (0, 1)) */
+    TEST_SUCCESS(ITC_Id_splitValidated(&pt_Id, &pt_OtherId));
+
+    /* Test the subtrees were moved, not cloned */
+    TEST_ASSERT_TRUE(pt_Id == pt_Root);
+    TEST_ASSERT_TRUE(pt_Id->pt_Left == pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_Id->pt_Right);
+    TEST_ASSERT_TRUE(pt_Id->pt_Right->pt_Parent == pt_Id);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id->pt_Left);
+
+    TEST_ASSERT_NULL(pt_OtherId->pt_Parent);
+    TEST_ITC_ID_IS_NULL_ID(pt_OtherId->pt_Left);
+    TEST_ASSERT_TRUE(pt_OtherId->pt_Left->pt_Parent == pt_OtherId);
+    TEST_ASSERT_TRUE(pt_OtherId->pt_Right == pt_Right);
+    TEST_ASSERT_TRUE(pt_Right->pt_Parent == pt_OtherId);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherId->pt_Right);
+
+    TEST_SUCCESS(ITC_Id_validate(pt_Id));
+    TEST_SUCCESS(ITC_Id_validate(pt_OtherId));
+
+    /* Sum the halves back in place */
+    TEST_SUCCESS(ITC_Id_validateSum(pt_Id, pt_OtherId));
+    TEST_SUCCESS(ITC_Id_sumValidated(&pt_Id, &pt_OtherId));
+
+    /* Test the subtrees were moved back */
+    TEST_ASSERT_NULL(pt_OtherId);
+    TEST_ASSERT_TRUE(pt_Id == pt_Root);
+    TEST_ASSERT_TRUE(pt_Id->pt_Left == pt_Left);
+    TEST_ASSERT_TRUE(pt_Id->pt_Right == pt_Right);
+    TEST_ASSERT_TRUE(pt_Right->pt_Parent == pt_Id);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Id->pt_Right);
+    TEST_SUCCESS(ITC_Id_validate(pt_Id));
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
+/* Test checking whether overlapping IDs can be summed fails */
+void ITC_Id_Test_validateSumFailOverlappingInterval(void)
+{
+    ITC_Id_t *pt_Id1;
+    ITC_Id_t *pt_Id2;
+
+    /* Create the (1, 0) and ((0, 1), 1) IDs */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id1, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id1->pt_Left, pt_Id1));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id1->pt_Right, pt_Id1));
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id2, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id2->pt_Left, pt_Id2));
+    TEST_SUCCESS(
+        ITC_TestUtil_newNullId(&pt_Id2->pt_Left->pt_Left, pt_Id2->pt_Left));
+    TEST_SUCCESS(
+        ITC_TestUtil_newSeedId(&pt_Id2->pt_Left->pt_Right, pt_Id2->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id2->pt_Right, pt_Id2));
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_Id_validateSum(pt_Id1, pt_Id2),
+        ITC_STATUS_OVERLAPPING_ID_INTERVAL);
+    TEST_FAILURE(
+        ITC_Id_validateSum(pt_Id2, pt_Id1),
+        ITC_STATUS_OVERLAPPING_ID_INTERVAL);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id1));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id2));
+}
@@ -0,0 +1,1352 @@
+/**
+ * @file ITC_Packed_Test.c
+ * @brief Unit tests for the Interval Tree Clock's packed ID, Event and Stamp
+ * representations
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_Packed.h"
+#include "ITC_Packed_Test.h"
+
+#include "ITC_Config.h"
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+#include "ITC_Packed_package.h"
+#include "ITC_Event_package.h"
+#include "ITC_Id_package.h"
+#include "ITC_Stamp.h"
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+#include "ITC_Test_package.h"
+#include "ITC_TestUtil.h"
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+#include "ITC_Port.h"
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#include <string.h>
+
+#if ITC_CONFIG_ENABLE_PACKED_API
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/** The capacity of the packed test buffers in nodes */
+#define TEST_PACKED_CAPACITY                                                (64)
+
+/** Shorthand for a packed ID parent node */
+#define P_ID                                                                (2U)
+
+/** Shorthand for a packed Event parent node */
+#define P_EV                                           ITC_PACKED_EVENT_PARENT_NODE
+
+/******************************************************************************
+ *  Types
+ ******************************************************************************/
+
+/* A packed ID test vector */
+typedef struct
+{
+    /** The ID nodes in pre-order. One node per byte */
+    uint8_t ru8_Nodes[16];
+    /** The number of nodes */
+    uint32_t u32_Length;
+} TestPackedIdVector_t;
+
+/* A packed Event test vector */
+typedef struct
+{
+    /** The Event nodes in pre-order */
+    ITC_Event_Counter_t rt_Nodes[16];
+    /** The number of nodes */
+    uint32_t u32_Length;
+} TestPackedEventVector_t;
+
+/******************************************************************************
+ *  Global variables
+ ******************************************************************************/
+
+/* Normalised IDs */
+static const TestPackedIdVector_t gt_IdVectors[] =
+{
+    { { 0 }, 1 },
+    { { 1 }, 1 },
+    { { P_ID, 1, 0 }, 3 },
+    { { P_ID, 0, 1 }, 3 },
+    { { P_ID, 1, P_ID, 0, 1 }, 5 },
+    { { P_ID, P_ID, 0, 1, 0 }, 5 },
+    { { P_ID, P_ID, 1, 0, P_ID, 0, 1 }, 7 },
+    { { P_ID, P_ID, 0, P_ID, 1, 0, P_ID, 0, 1 }, 9 },
+};
+
+/* Normalised Events with absolute leaf counters */
+static const TestPackedEventVector_t gt_EventVectors[] =
+{
+    { { 0 }, 1 },
+    { { 3 }, 1 },
+    { { P_EV, 1, 2 }, 3 },
+    { { P_EV, 2, 1 }, 3 },
+    { { P_EV, 2, P_EV, 1, 4 }, 5 },
+    { { P_EV, P_EV, 0, 3, 5 }, 5 },
+    { { P_EV, P_EV, 1, 2, P_EV, 2, 3 }, 7 },
+    { { P_EV, P_EV, 4, P_EV, 1, 6, P_EV, 7, 2 }, 9 },
+};
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Load a packed ID test vector into a packed ID
+ *
+ * @param pt_Vector The test vector
+ * @param pu8_Buffer The buffer. Must be `TEST_PACKED_CAPACITY / 4` bytes long
+ * @param pt_PackedId (out) The packed ID
+ */
+static void loadPackedId(
+    const TestPackedIdVector_t *const pt_Vector,
+    uint8_t *const pu8_Buffer,
+    ITC_PackedId_t *const pt_PackedId
+)
+{
+    memset(pu8_Buffer, 0, TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE);
+
+    for (uint32_t u32_I = 0; u32_I < pt_Vector->u32_Length; u32_I++)
+    {
+        pu8_Buffer[u32_I / ITC_PACKED_ID_NODES_PER_BYTE] |=
+            (uint8_t)(pt_Vector->ru8_Nodes[u32_I] <<
+                      ((u32_I % ITC_PACKED_ID_NODES_PER_BYTE) * 2U));
+    }
+
+    pt_PackedId->pu8_Nodes = pu8_Buffer;
+    pt_PackedId->u32_Capacity = TEST_PACKED_CAPACITY;
+    pt_PackedId->u32_Length = pt_Vector->u32_Length;
+}
+
+/**
+ * @brief Load a packed Event test vector into a packed Event
+ *
+ * @param pt_Vector The test vector
+ * @param pt_Buffer The buffer. Must be `TEST_PACKED_CAPACITY` nodes long
+ * @param pt_PackedEvent (out) The packed Event
+ */
+static void loadPackedEvent(
+    const TestPackedEventVector_t *const pt_Vector,
+    ITC_Event_Counter_t *const pt_Buffer,
+    ITC_PackedEvent_t *const pt_PackedEvent
+)
+{
+    memcpy(pt_Buffer,
+           &pt_Vector->rt_Nodes[0],
+           pt_Vector->u32_Length * sizeof(ITC_Event_Counter_t));
+
+    pt_PackedEvent->pt_Nodes = pt_Buffer;
+    pt_PackedEvent->u32_Capacity = TEST_PACKED_CAPACITY;
+    pt_PackedEvent->u32_Length = pt_Vector->u32_Length;
+}
+
+/**
+ * @brief Test a packed ID matches an ITC ID
+ *
+ * @param pt_PackedId The packed ID
+ * @param pt_Id The ITC ID
+ */
+static void assertPackedIdEqualsId(
+    const ITC_PackedId_t *const pt_PackedId,
+    const ITC_Id_t *const pt_Id
+)
+{
+    uint8_t ru8_Buffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_PackedId_t t_Expected = { &ru8_Buffer[0], TEST_PACKED_CAPACITY, 0 };
+
+    memset(&ru8_Buffer[0], 0, sizeof(ru8_Buffer));
+
+    TEST_SUCCESS(ITC_PackedId_fromId(pt_Id, &t_Expected));
+    TEST_ASSERT_EQUAL_UINT32(t_Expected.u32_Length, pt_PackedId->u32_Length);
+
+    for (uint32_t u32_I = 0; u32_I < t_Expected.u32_Length; u32_I++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(
+            (t_Expected.pu8_Nodes[u32_I / ITC_PACKED_ID_NODES_PER_BYTE] >>
+             ((u32_I % ITC_PACKED_ID_NODES_PER_BYTE) * 2U)) & 0x03U,
+            (pt_PackedId->pu8_Nodes[u32_I / ITC_PACKED_ID_NODES_PER_BYTE] >>
+             ((u32_I % ITC_PACKED_ID_NODES_PER_BYTE) * 2U)) & 0x03U);
+    }
+}
+
+/**
+ * @brief Test a packed Event matches an ITC Event
+ *
+ * @param pt_PackedEvent The packed Event
+ * @param pt_Event The ITC Event
+ */
+static void assertPackedEventEqualsEvent(
+    const ITC_PackedEvent_t *const pt_PackedEvent,
+    const ITC_Event_t *const pt_Event
+)
+{
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_Expected = { &rt_Buffer[0], TEST_PACKED_CAPACITY, 0 };
+
+    TEST_SUCCESS(ITC_PackedEvent_fromEvent(pt_Event, &t_Expected));
+    TEST_ASSERT_EQUAL_UINT32(
+        t_Expected.u32_Length, pt_PackedEvent->u32_Length);
+    TEST_ASSERT_EQUAL_MEMORY(
+        t_Expected.pt_Nodes,
+        pt_PackedEvent->pt_Nodes,
+        t_Expected.u32_Length * sizeof(ITC_Event_Counter_t));
+}
+
+/**
+ * @brief Load a balanced packed Event
+ *
+ * @param u32_Depth The depth of the leaves. Must not exceed 5
+ * @param pt_Leaves The leaf counters from left to right. Must be
+ * `2^u32_Depth` counters long
+ * @param pt_Buffer The buffer. Must be `TEST_PACKED_CAPACITY` nodes long
+ * @param pt_PackedEvent (out) The packed Event
+ */
+static void loadBalancedPackedEvent(
+    const uint32_t u32_Depth,
+    const ITC_Event_Counter_t *const pt_Leaves,
+    ITC_Event_Counter_t *const pt_Buffer,
+    ITC_PackedEvent_t *const pt_PackedEvent
+)
+{
+    /* The depths of the subtrees still to be loaded */
+    uint32_t ru32_Pending[8] = { 0 };
+    uint32_t u32_PendingLength = 1;
+    uint32_t u32_NodeDepth;
+    uint32_t u32_Leaf = 0;
+
+    pt_PackedEvent->pt_Nodes = pt_Buffer;
+    pt_PackedEvent->u32_Capacity = TEST_PACKED_CAPACITY;
+    pt_PackedEvent->u32_Length = 0;
+
+    while (u32_PendingLength)
+    {
+        u32_NodeDepth = ru32_Pending[--u32_PendingLength];
+
+        if (u32_NodeDepth == u32_Depth)
+        {
+            pt_Buffer[pt_PackedEvent->u32_Length++] = pt_Leaves[u32_Leaf++];
+        }
+        else
+        {
+            pt_Buffer[pt_PackedEvent->u32_Length++] = P_EV;
+            ru32_Pending[u32_PendingLength++] = u32_NodeDepth + 1;
+            ru32_Pending[u32_PendingLength++] = u32_NodeDepth + 1;
+        }
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/* Init test */
+void setUp(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    static bool b_MemoryInit = false;
+
+    if (!b_MemoryInit)
+    {
+        TEST_SUCCESS(ITC_Port_init());
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        ITC_TestUtil_initTestContext();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+        b_MemoryInit = true;
+    }
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/* Fini test */
+void tearDown(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+/* Test all memory is freed at the end of each test */
+
+    TEST_ASSERT_EQUAL_UINT(
+        ITC_PORT_FREE_SLOT_PATTERN,
+        ((uint8_t *)gpt_ItcIdNodeAllocationArray)[0]);
+    TEST_ASSERT_EQUAL_UINT(
+        0,
+        memcmp((const void *)&((uint8_t *)gpt_ItcIdNodeAllocationArray)[0],
+               (const void *)&((uint8_t *)gpt_ItcIdNodeAllocationArray)[1],
+               (gu32_ItcIdNodeAllocationArrayLength * sizeof(ITC_Id_t)) -
+                   1));
+
+    TEST_ASSERT_EQUAL_UINT(
+        ITC_PORT_FREE_SLOT_PATTERN,
+        ((uint8_t *)gpt_ItcEventNodeAllocationArray)[0]);
+    TEST_ASSERT_EQUAL_UINT(
+        0,
+        memcmp((const void *)&((uint8_t *)gpt_ItcEventNodeAllocationArray)[0],
+               (const void *)&((uint8_t *)gpt_ItcEventNodeAllocationArray)[1],
+               (gu32_ItcEventNodeAllocationArrayLength * sizeof(ITC_Event_t)) -
+                   1));
+
+    TEST_ASSERT_EQUAL_UINT(
+        ITC_PORT_FREE_SLOT_PATTERN,
+        ((uint8_t *)gpt_ItcStampNodeAllocationArray)[0]);
+    TEST_ASSERT_EQUAL_UINT(
+        0,
+        memcmp((const void *)&((uint8_t *)gpt_ItcStampNodeAllocationArray)[0],
+               (const void *)&((uint8_t *)gpt_ItcStampNodeAllocationArray)[1],
+               (gu32_ItcStampNodeAllocationArrayLength * sizeof(ITC_Stamp_t)) -
+                   1));
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* Test all memory is freed at the end of each test */
+    ITC_TestUtil_testAllStaticNodesAreFree();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /* Test the scratch arena is released at the end of each test */
+    ITC_TestUtil_testScratchArenaIsEmpty();
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+}
+
+/* Test packing and unpacking an ID fails with invalid param */
+void ITC_Packed_Test_packIdFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_Buffer[1] = { 0 };
+    ITC_PackedId_t t_PackedId = { NULL, 4, 1 };
+    ITC_Id_t *pt_Id;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    TEST_FAILURE(ITC_PackedId_fromId(pt_Id, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedId_fromId(pt_Id, &t_PackedId), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_PackedId_toId(&t_PackedId, &pt_Id), ITC_STATUS_INVALID_PARAM);
+
+    t_PackedId.pu8_Nodes = &ru8_Buffer[0];
+
+    TEST_FAILURE(
+        ITC_PackedId_fromId(NULL, &t_PackedId), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_PackedId_toId(NULL, &pt_Id), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_PackedId_toId(&t_PackedId, NULL), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing an ID fails with corrupt ID */
+void ITC_Packed_Test_packIdFailWithCorruptId(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_Buffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_PackedId_t t_PackedId = { &ru8_Buffer[0], TEST_PACKED_CAPACITY, 0 };
+    ITC_Id_t *pt_Id;
+
+    /* Test different invalid IDs are handled properly */
+    for (uint32_t u32_I = 0; u32_I < gu32_InvalidIdTablesSize; u32_I++)
+    {
+        /* Construct an invalid ID */
+        gpv_InvalidIdConstructorTable[u32_I](&pt_Id);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_PackedId_fromId(pt_Id, &t_PackedId), ITC_STATUS_CORRUPT_ID);
+
+        /* Destroy the ID */
+        gpv_InvalidIdDestructorTable[u32_I](&pt_Id);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing an ID fails with insufficient resources */
+void ITC_Packed_Test_packIdFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_Buffer[1];
+    ITC_PackedId_t t_PackedId = { &ru8_Buffer[0], 2, 0 };
+    ITC_Id_t *pt_Id;
+
+    /* Create the (1, 0) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+
+    TEST_FAILURE(
+        ITC_PackedId_fromId(pt_Id, &t_PackedId),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing and unpacking an ID succeeds */
+void ITC_Packed_Test_packAndUnpackIdSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_Buffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_PackedId_t t_PackedId = { &ru8_Buffer[0], TEST_PACKED_CAPACITY, 0 };
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_UnpackedId = NULL;
+
+    /* Create the (1, (0, 1)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(
+        ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(
+        ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+
+    TEST_SUCCESS(ITC_PackedId_fromId(pt_Id, &t_PackedId));
+
+    /* P 1 P 0 1 */
+    TEST_ASSERT_EQUAL_UINT32(5, t_PackedId.u32_Length);
+    TEST_ASSERT_EQUAL_UINT8(0x26, ru8_Buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x01, ru8_Buffer[1] & 0x03U);
+    TEST_SUCCESS(ITC_PackedId_validate(&t_PackedId));
+
+    TEST_SUCCESS(ITC_PackedId_toId(&t_PackedId, &pt_UnpackedId));
+
+    TEST_ITC_ID_IS_NOT_LEAF_ID(pt_UnpackedId);
+    TEST_ITC_ID_IS_SEED_ID(pt_UnpackedId->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_UnpackedId->pt_Right);
+    TEST_ASSERT_TRUE(pt_UnpackedId->pt_Right->pt_Parent == pt_UnpackedId);
+    TEST_SUCCESS(ITC_Id_validate(pt_UnpackedId));
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_UnpackedId));
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test validating a packed ID fails with corrupt ID */
+void ITC_Packed_Test_validatePackedIdFailWithCorruptId(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    const TestPackedIdVector_t rt_Corrupt[] =
+    {
+        /* Empty */
+        { { 0 }, 0 },
+        /* Unknown node type */
+        { { 3 }, 1 },
+        /* Incomplete subtree */
+        { { P_ID, 1 }, 2 },
+        /* Trailing nodes */
+        { { 1, 0 }, 2 },
+        /* Not normalised */
+        { { P_ID, 1, 1 }, 3 },
+        { { P_ID, 1, P_ID, 0, 0 }, 5 },
+    };
+    uint8_t ru8_Buffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_PackedId_t t_PackedId;
+
+    TEST_FAILURE(ITC_PackedId_validate(NULL), ITC_STATUS_INVALID_PARAM);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rt_Corrupt); u32_I++)
+    {
+        loadPackedId(&rt_Corrupt[u32_I], &ru8_Buffer[0], &t_PackedId);
+
+        TEST_FAILURE(ITC_PackedId_validate(&t_PackedId), ITC_STATUS_CORRUPT_ID);
+    }
+
+    /* Length exceeds the capacity */
+    loadPackedId(&gt_IdVectors[2], &ru8_Buffer[0], &t_PackedId);
+    t_PackedId.u32_Capacity = 2;
+
+    TEST_FAILURE(ITC_PackedId_validate(&t_PackedId), ITC_STATUS_CORRUPT_ID);
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test every packed ID test vector survives a round trip */
+void ITC_Packed_Test_packedIdRoundTripSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_Buffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_PackedId_t t_PackedId;
+    ITC_Id_t *pt_Id;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(gt_IdVectors); u32_I++)
+    {
+        loadPackedId(&gt_IdVectors[u32_I], &ru8_Buffer[0], &t_PackedId);
+
+        TEST_SUCCESS(ITC_PackedId_toId(&t_PackedId, &pt_Id));
+        assertPackedIdEqualsId(&t_PackedId, pt_Id);
+        TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test splitting a packed ID matches splitting an ITC ID */
+void ITC_Packed_Test_splitPackedIdMatchesSplitId(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_Buffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    uint8_t ru8_Buffer1[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    uint8_t ru8_Buffer2[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_PackedId_t t_PackedId;
+    ITC_PackedId_t t_PackedId1 = { &ru8_Buffer1[0], TEST_PACKED_CAPACITY, 0 };
+    ITC_PackedId_t t_PackedId2 = { &ru8_Buffer2[0], TEST_PACKED_CAPACITY, 0 };
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_Id1;
+    ITC_Id_t *pt_Id2;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(gt_IdVectors); u32_I++)
+    {
+        loadPackedId(&gt_IdVectors[u32_I], &ru8_Buffer[0], &t_PackedId);
+
+        TEST_SUCCESS(ITC_PackedId_toId(&t_PackedId, &pt_Id));
+        TEST_SUCCESS(ITC_Id_splitConst(pt_Id, &pt_Id1, &pt_Id2));
+
+        TEST_SUCCESS(
+            ITC_PackedId_split(&t_PackedId, &t_PackedId1, &t_PackedId2));
+        TEST_SUCCESS(ITC_PackedId_validate(&t_PackedId1));
+        TEST_SUCCESS(ITC_PackedId_validate(&t_PackedId2));
+
+        assertPackedIdEqualsId(&t_PackedId1, pt_Id1);
+        assertPackedIdEqualsId(&t_PackedId2, pt_Id2);
+
+        TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+        TEST_SUCCESS(ITC_Id_destroy(&pt_Id1));
+        TEST_SUCCESS(ITC_Id_destroy(&pt_Id2));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test splitting a packed ID fails with insufficient resources */
+void ITC_Packed_Test_splitPackedIdFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_Buffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    uint8_t ru8_Buffer1[1];
+    uint8_t ru8_Buffer2[1];
+    ITC_PackedId_t t_PackedId;
+    ITC_PackedId_t t_PackedId1 = { &ru8_Buffer1[0], 2, 0 };
+    ITC_PackedId_t t_PackedId2 = { &ru8_Buffer2[0], 2, 0 };
+
+    /* Splitting a seed results in (1, 0) and (0, 1) */
+    loadPackedId(&gt_IdVectors[1], &ru8_Buffer[0], &t_PackedId);
+
+    TEST_FAILURE(
+        ITC_PackedId_split(&t_PackedId, &t_PackedId1, &t_PackedId2),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test summing packed IDs matches summing ITC IDs */
+void ITC_Packed_Test_sumPackedIdMatchesSumId(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_Buffer1[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    uint8_t ru8_Buffer2[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    uint8_t ru8_Buffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_PackedId_t t_PackedId1;
+    ITC_PackedId_t t_PackedId2;
+    ITC_PackedId_t t_PackedId = { &ru8_Buffer[0], TEST_PACKED_CAPACITY, 0 };
+    ITC_Id_t *pt_Id1;
+    ITC_Id_t *pt_Id2;
+    ITC_Id_t *pt_Id;
+    ITC_Status_t t_Status;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(gt_IdVectors); u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(gt_IdVectors); u32_J++)
+        {
+            loadPackedId(&gt_IdVectors[u32_I], &ru8_Buffer1[0], &t_PackedId1);
+            loadPackedId(&gt_IdVectors[u32_J], &ru8_Buffer2[0], &t_PackedId2);
+
+            TEST_SUCCESS(ITC_PackedId_toId(&t_PackedId1, &pt_Id1));
+            TEST_SUCCESS(ITC_PackedId_toId(&t_PackedId2, &pt_Id2));
+
+            t_Status = ITC_Id_sumConst(pt_Id1, pt_Id2, &pt_Id);
+
+            /* Overlapping intervals must be rejected by both */
+            TEST_FAILURE(
+                ITC_PackedId_sum(&t_PackedId1, &t_PackedId2, &t_PackedId),
+                t_Status);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                TEST_SUCCESS(ITC_PackedId_validate(&t_PackedId));
+                assertPackedIdEqualsId(&t_PackedId, pt_Id);
+                TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+            }
+
+            TEST_SUCCESS(ITC_Id_destroy(&pt_Id1));
+            TEST_SUCCESS(ITC_Id_destroy(&pt_Id2));
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing and unpacking an Event fails with invalid param */
+void ITC_Packed_Test_packEventFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Buffer[1] = { 0 };
+    ITC_PackedEvent_t t_PackedEvent = { NULL, 1, 1 };
+    ITC_Event_t *pt_Event;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_PackedEvent_fromEvent(pt_Event, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedEvent_fromEvent(pt_Event, &t_PackedEvent),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedEvent_toEvent(&t_PackedEvent, &pt_Event),
+        ITC_STATUS_INVALID_PARAM);
+
+    t_PackedEvent.pt_Nodes = &rt_Buffer[0];
+
+    TEST_FAILURE(
+        ITC_PackedEvent_fromEvent(NULL, &t_PackedEvent),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedEvent_toEvent(NULL, &pt_Event), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedEvent_toEvent(&t_PackedEvent, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing an Event fails with corrupt Event */
+void ITC_Packed_Test_packEventFailWithCorruptEvent(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent =
+    {
+        &rt_Buffer[0], TEST_PACKED_CAPACITY, 0
+    };
+    ITC_Event_t *pt_Event;
+
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0; u32_I < gu32_InvalidEventTablesSize; u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Event);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_PackedEvent_fromEvent(pt_Event, &t_PackedEvent),
+            ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Event);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing an Event fails with event counter overflow */
+void ITC_Packed_Test_packEventFailWithEventCounterOverflow(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent =
+    {
+        &rt_Buffer[0], TEST_PACKED_CAPACITY, 0
+    };
+    ITC_Event_t *pt_Event;
+
+    /* Create the (1, 0, max - 1) Event. The absolute count of the right
+     * leaf overflows */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right, pt_Event, ITC_PACKED_EVENT_PARENT_NODE - 1));
+
+    TEST_FAILURE(
+        ITC_PackedEvent_fromEvent(pt_Event, &t_PackedEvent),
+        ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* A leaf can never hold the parent node marker */
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_Event, NULL, ITC_PACKED_EVENT_PARENT_NODE));
+
+    TEST_FAILURE(
+        ITC_PackedEvent_fromEvent(pt_Event, &t_PackedEvent),
+        ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing and unpacking an Event succeeds */
+void ITC_Packed_Test_packAndUnpackEventSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent =
+    {
+        &rt_Buffer[0], TEST_PACKED_CAPACITY, 0
+    };
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_UnpackedEvent = NULL;
+
+    /* Create the (1, 2, (0, 3, 0)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 3));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 0));
+
+    TEST_SUCCESS(ITC_PackedEvent_fromEvent(pt_Event, &t_PackedEvent));
+
+    TEST_ASSERT_EQUAL_UINT32(5, t_PackedEvent.u32_Length);
+    TEST_ASSERT_TRUE(rt_Buffer[0] == ITC_PACKED_EVENT_PARENT_NODE);
+    TEST_ASSERT_TRUE(rt_Buffer[1] == 3);
+    TEST_ASSERT_TRUE(rt_Buffer[2] == ITC_PACKED_EVENT_PARENT_NODE);
+    TEST_ASSERT_TRUE(rt_Buffer[3] == 4);
+    TEST_ASSERT_TRUE(rt_Buffer[4] == 1);
+    TEST_SUCCESS(ITC_PackedEvent_validate(&t_PackedEvent));
+
+    TEST_SUCCESS(ITC_PackedEvent_toEvent(&t_PackedEvent, &pt_UnpackedEvent));
+
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_UnpackedEvent, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_UnpackedEvent->pt_Left, 2);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_UnpackedEvent->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_UnpackedEvent->pt_Right->pt_Left, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_UnpackedEvent->pt_Right->pt_Right, 0);
+    TEST_SUCCESS(ITC_Event_validate(pt_UnpackedEvent));
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_UnpackedEvent));
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test validating a packed Event fails with corrupt Event */
+void ITC_Packed_Test_validatePackedEventFailWithCorruptEvent(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    const TestPackedEventVector_t rt_Corrupt[] =
+    {
+        /* Empty */
+        { { 0 }, 0 },
+        /* Incomplete subtree */
+        { { P_EV, 1 }, 2 },
+        /* Trailing nodes */
+        { { 1, 0 }, 2 },
+        /* Not normalised */
+        { { P_EV, 1, 1 }, 3 },
+        { { P_EV, 1, P_EV, 0, 0 }, 5 },
+    };
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent;
+
+    TEST_FAILURE(ITC_PackedEvent_validate(NULL), ITC_STATUS_INVALID_PARAM);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rt_Corrupt); u32_I++)
+    {
+        loadPackedEvent(&rt_Corrupt[u32_I], &rt_Buffer[0], &t_PackedEvent);
+
+        TEST_FAILURE(
+            ITC_PackedEvent_validate(&t_PackedEvent),
+            ITC_STATUS_CORRUPT_EVENT);
+    }
+
+    /* Length exceeds the capacity */
+    loadPackedEvent(&gt_EventVectors[2], &rt_Buffer[0], &t_PackedEvent);
+    t_PackedEvent.u32_Capacity = 2;
+
+    TEST_FAILURE(
+        ITC_PackedEvent_validate(&t_PackedEvent), ITC_STATUS_CORRUPT_EVENT);
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test every packed Event test vector survives a round trip */
+void ITC_Packed_Test_packedEventRoundTripSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent;
+    ITC_Event_t *pt_Event;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(gt_EventVectors); u32_I++)
+    {
+        loadPackedEvent(&gt_EventVectors[u32_I], &rt_Buffer[0], &t_PackedEvent);
+
+        TEST_SUCCESS(ITC_PackedEvent_toEvent(&t_PackedEvent, &pt_Event));
+        assertPackedEventEqualsEvent(&t_PackedEvent, pt_Event);
+        TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test comparing packed Events matches comparing ITC Events */
+void ITC_Packed_Test_leqPackedEventMatchesLeqEvent(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Buffer1[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer2[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent1 = { 0 };
+    ITC_PackedEvent_t t_PackedEvent2 = { 0 };
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    bool b_IsLeq;
+    bool b_IsPackedLeq;
+
+    TEST_FAILURE(
+        ITC_PackedEvent_leq(&t_PackedEvent1, &t_PackedEvent2, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(gt_EventVectors); u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(gt_EventVectors); u32_J++)
+        {
+            loadPackedEvent(
+                &gt_EventVectors[u32_I], &rt_Buffer1[0], &t_PackedEvent1);
+            loadPackedEvent(
+                &gt_EventVectors[u32_J], &rt_Buffer2[0], &t_PackedEvent2);
+
+            TEST_SUCCESS(ITC_PackedEvent_toEvent(&t_PackedEvent1, &pt_Event1));
+            TEST_SUCCESS(ITC_PackedEvent_toEvent(&t_PackedEvent2, &pt_Event2));
+
+            TEST_SUCCESS(ITC_Event_leq(pt_Event1, pt_Event2, &b_IsLeq));
+            TEST_SUCCESS(
+                ITC_PackedEvent_leq(
+                    &t_PackedEvent1, &t_PackedEvent2, &b_IsPackedLeq));
+            TEST_ASSERT_EQUAL(b_IsLeq, b_IsPackedLeq);
+
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test joining packed Events fails with invalid param */
+void ITC_Packed_Test_joinPackedEventFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Buffer1[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer2[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent1;
+    ITC_PackedEvent_t t_PackedEvent2;
+
+    loadPackedEvent(&gt_EventVectors[2], &rt_Buffer1[0], &t_PackedEvent1);
+    loadPackedEvent(&gt_EventVectors[3], &rt_Buffer2[0], &t_PackedEvent2);
+
+    TEST_FAILURE(
+        ITC_PackedEvent_join(&t_PackedEvent1, &t_PackedEvent2, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* The output must not share a buffer with the inputs */
+    TEST_FAILURE(
+        ITC_PackedEvent_join(
+            &t_PackedEvent1, &t_PackedEvent2, &t_PackedEvent1),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedEvent_join(
+            &t_PackedEvent1, &t_PackedEvent2, &t_PackedEvent2),
+        ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test joining packed Events matches joining ITC Events */
+void ITC_Packed_Test_joinPackedEventMatchesJoinEvent(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Buffer1[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer2[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent1;
+    ITC_PackedEvent_t t_PackedEvent2;
+    ITC_PackedEvent_t t_PackedEvent =
+    {
+        &rt_Buffer[0], TEST_PACKED_CAPACITY, 0
+    };
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    ITC_Event_t *pt_Event;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(gt_EventVectors); u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(gt_EventVectors); u32_J++)
+        {
+            loadPackedEvent(
+                &gt_EventVectors[u32_I], &rt_Buffer1[0], &t_PackedEvent1);
+            loadPackedEvent(
+                &gt_EventVectors[u32_J], &rt_Buffer2[0], &t_PackedEvent2);
+
+            TEST_SUCCESS(ITC_PackedEvent_toEvent(&t_PackedEvent1, &pt_Event1));
+            TEST_SUCCESS(ITC_PackedEvent_toEvent(&t_PackedEvent2, &pt_Event2));
+
+            TEST_SUCCESS(ITC_Event_joinConst(pt_Event1, pt_Event2, &pt_Event));
+            TEST_SUCCESS(
+                ITC_PackedEvent_join(
+                    &t_PackedEvent1, &t_PackedEvent2, &t_PackedEvent));
+            TEST_SUCCESS(ITC_PackedEvent_validate(&t_PackedEvent));
+            assertPackedEventEqualsEvent(&t_PackedEvent, pt_Event);
+
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test comparing packed Events with the same shape */
+void ITC_Packed_Test_leqSameShapePackedEventSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Leaves[TEST_PACKED_CAPACITY / 2];
+    ITC_Event_Counter_t rt_Buffer1[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer2[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer3[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent1;
+    ITC_PackedEvent_t t_PackedEvent2;
+    ITC_PackedEvent_t t_PackedEvent3;
+    uint32_t u32_LeafCount;
+    bool b_IsLeq;
+
+    /* Cover Events shorter, as long as and longer than the SIMD vectors */
+    for (uint32_t u32_Depth = 1; u32_Depth <= 5; u32_Depth++)
+    {
+        u32_LeafCount = 1U << u32_Depth;
+
+        for (uint32_t u32_I = 0; u32_I < u32_LeafCount; u32_I++)
+        {
+            for (uint32_t u32_J = 0; u32_J < u32_LeafCount; u32_J++)
+            {
+                rt_Leaves[u32_J] = 2 * u32_J;
+            }
+            loadBalancedPackedEvent(
+                u32_Depth, &rt_Leaves[0], &rt_Buffer1[0], &t_PackedEvent1);
+
+            /* Witness an event in a different leaf each time */
+            rt_Leaves[u32_I]++;
+            loadBalancedPackedEvent(
+                u32_Depth, &rt_Leaves[0], &rt_Buffer2[0], &t_PackedEvent2);
+
+            /* Witness a concurrent event in its neighbour */
+            rt_Leaves[u32_I]--;
+            rt_Leaves[(u32_I + 1) % u32_LeafCount]++;
+            loadBalancedPackedEvent(
+                u32_Depth, &rt_Leaves[0], &rt_Buffer3[0], &t_PackedEvent3);
+
+            TEST_SUCCESS(
+                ITC_PackedEvent_leq(
+                    &t_PackedEvent1, &t_PackedEvent1, &b_IsLeq));
+            TEST_ASSERT_TRUE(b_IsLeq);
+            TEST_SUCCESS(
+                ITC_PackedEvent_leq(
+                    &t_PackedEvent1, &t_PackedEvent2, &b_IsLeq));
+            TEST_ASSERT_TRUE(b_IsLeq);
+            TEST_SUCCESS(
+                ITC_PackedEvent_leq(
+                    &t_PackedEvent2, &t_PackedEvent1, &b_IsLeq));
+            TEST_ASSERT_FALSE(b_IsLeq);
+            TEST_SUCCESS(
+                ITC_PackedEvent_leq(
+                    &t_PackedEvent2, &t_PackedEvent3, &b_IsLeq));
+            TEST_ASSERT_FALSE(b_IsLeq);
+            TEST_SUCCESS(
+                ITC_PackedEvent_leq(
+                    &t_PackedEvent3, &t_PackedEvent2, &b_IsLeq));
+            TEST_ASSERT_FALSE(b_IsLeq);
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test joining packed Events with the same shape */
+void ITC_Packed_Test_joinSameShapePackedEventSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_Event_Counter_t rt_Leaves[TEST_PACKED_CAPACITY / 2];
+    ITC_Event_Counter_t rt_Buffer1[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer2[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_ExpectedBuffer[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent1;
+    ITC_PackedEvent_t t_PackedEvent2;
+    ITC_PackedEvent_t t_Expected;
+    ITC_PackedEvent_t t_PackedEvent =
+    {
+        &rt_Buffer[0], TEST_PACKED_CAPACITY, 0
+    };
+    uint32_t u32_LeafCount;
+
+    for (uint32_t u32_Depth = 1; u32_Depth <= 5; u32_Depth++)
+    {
+        u32_LeafCount = 1U << u32_Depth;
+
+        /* The joined leaves are never equal to their siblings */
+        for (uint32_t u32_I = 0; u32_I < u32_LeafCount; u32_I++)
+        {
+            rt_Leaves[u32_I] = 2 * u32_I;
+        }
+        loadBalancedPackedEvent(
+            u32_Depth, &rt_Leaves[0], &rt_Buffer1[0], &t_PackedEvent1);
+        for (uint32_t u32_I = 0; u32_I < u32_LeafCount; u32_I += 2)
+        {
+            rt_Leaves[u32_I]++;
+        }
+        loadBalancedPackedEvent(
+            u32_Depth, &rt_Leaves[0], &rt_Buffer2[0], &t_PackedEvent2);
+        loadBalancedPackedEvent(
+            u32_Depth, &rt_Leaves[0], &rt_ExpectedBuffer[0], &t_Expected);
+
+        TEST_SUCCESS(
+            ITC_PackedEvent_join(
+                &t_PackedEvent1, &t_PackedEvent2, &t_PackedEvent));
+        TEST_SUCCESS(ITC_PackedEvent_validate(&t_PackedEvent));
+        TEST_ASSERT_EQUAL_UINT32(
+            t_Expected.u32_Length, t_PackedEvent.u32_Length);
+        TEST_ASSERT_EQUAL_MEMORY(
+            t_Expected.pt_Nodes,
+            t_PackedEvent.pt_Nodes,
+            t_Expected.u32_Length * sizeof(ITC_Event_Counter_t));
+
+        /* All joined sibling leaves are equal and must be normalised */
+        for (uint32_t u32_I = 0; u32_I < u32_LeafCount; u32_I += 2)
+        {
+            rt_Leaves[u32_I] = 4 * u32_I + 2;
+            rt_Leaves[u32_I + 1] = 4 * u32_I;
+        }
+        loadBalancedPackedEvent(
+            u32_Depth, &rt_Leaves[0], &rt_Buffer1[0], &t_PackedEvent1);
+        for (uint32_t u32_I = 0; u32_I < u32_LeafCount; u32_I += 2)
+        {
+            rt_Leaves[u32_I] = 4 * u32_I;
+            rt_Leaves[u32_I + 1] = 4 * u32_I + 2;
+        }
+        loadBalancedPackedEvent(
+            u32_Depth, &rt_Leaves[0], &rt_Buffer2[0], &t_PackedEvent2);
+        for (uint32_t u32_I = 0; u32_I < u32_LeafCount / 2; u32_I++)
+        {
+            rt_Leaves[u32_I] = 8 * u32_I + 2;
+        }
+        loadBalancedPackedEvent(
+            u32_Depth - 1,
+            &rt_Leaves[0],
+            &rt_ExpectedBuffer[0],
+            &t_Expected);
+
+        TEST_SUCCESS(
+            ITC_PackedEvent_join(
+                &t_PackedEvent1, &t_PackedEvent2, &t_PackedEvent));
+        TEST_SUCCESS(ITC_PackedEvent_validate(&t_PackedEvent));
+        TEST_ASSERT_EQUAL_UINT32(
+            t_Expected.u32_Length, t_PackedEvent.u32_Length);
+        TEST_ASSERT_EQUAL_MEMORY(
+            t_Expected.pt_Nodes,
+            t_PackedEvent.pt_Nodes,
+            t_Expected.u32_Length * sizeof(ITC_Event_Counter_t));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packed Events of the same length but different shapes are compared
+ * and joined correctly */
+void ITC_Packed_Test_leqAndJoinSameLengthPackedEventSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    const TestPackedEventVector_t t_Vector1 = { { P_EV, P_EV, 1, 2, 3 }, 5 };
+    const TestPackedEventVector_t t_Vector2 = { { P_EV, 3, P_EV, 1, 2 }, 5 };
+    ITC_Event_Counter_t rt_Buffer1[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer2[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedEvent_t t_PackedEvent1;
+    ITC_PackedEvent_t t_PackedEvent2;
+    ITC_PackedEvent_t t_PackedEvent =
+    {
+        &rt_Buffer[0], TEST_PACKED_CAPACITY, 0
+    };
+    bool b_IsLeq;
+
+    loadPackedEvent(&t_Vector1, &rt_Buffer1[0], &t_PackedEvent1);
+    loadPackedEvent(&t_Vector2, &rt_Buffer2[0], &t_PackedEvent2);
+
+    TEST_SUCCESS(
+        ITC_PackedEvent_leq(&t_PackedEvent1, &t_PackedEvent2, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+    TEST_SUCCESS(
+        ITC_PackedEvent_leq(&t_PackedEvent2, &t_PackedEvent1, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+
+    /* join(((1, 2), 3), (3, (1, 2))) = 3 */
+    TEST_SUCCESS(
+        ITC_PackedEvent_join(
+            &t_PackedEvent1, &t_PackedEvent2, &t_PackedEvent));
+    TEST_ASSERT_EQUAL_UINT32(1, t_PackedEvent.u32_Length);
+    TEST_ASSERT_EQUAL(3, t_PackedEvent.pt_Nodes[0]);
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test joining packed Events with the same shape fails with insufficient
+ * resources if the joined Event does not fit */
+void ITC_Packed_Test_joinSameShapePackedEventFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    const TestPackedEventVector_t t_Vector1 = { { P_EV, 1, 0 }, 3 };
+    const TestPackedEventVector_t t_Vector2 = { { P_EV, 0, 2 }, 3 };
+    ITC_Event_Counter_t rt_Buffer1[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer2[TEST_PACKED_CAPACITY];
+    ITC_Event_Counter_t rt_Buffer[2];
+    ITC_PackedEvent_t t_PackedEvent1;
+    ITC_PackedEvent_t t_PackedEvent2;
+    ITC_PackedEvent_t t_PackedEvent = { &rt_Buffer[0], 2, 0 };
+
+    loadPackedEvent(&t_Vector1, &rt_Buffer1[0], &t_PackedEvent1);
+    loadPackedEvent(&t_Vector2, &rt_Buffer2[0], &t_PackedEvent2);
+
+    TEST_FAILURE(
+        ITC_PackedEvent_join(
+            &t_PackedEvent1, &t_PackedEvent2, &t_PackedEvent),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_ASSERT_EQUAL_UINT32(0, t_PackedEvent.u32_Length);
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test filling a packed Event matches filling an ITC Event */
+void ITC_Packed_Test_fillPackedEventMatchesFillEvent(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_IdBuffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedId_t t_PackedId = { 0 };
+    ITC_PackedEvent_t t_PackedEvent;
+    ITC_Id_t *pt_Id;
+    ITC_Event_t *pt_Event;
+    bool b_WasFilled;
+    bool b_WasPackedFilled;
+
+    TEST_FAILURE(
+        ITC_PackedEvent_fill(&t_PackedEvent, &t_PackedId, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(gt_EventVectors); u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(gt_IdVectors); u32_J++)
+        {
+            loadPackedEvent(
+                &gt_EventVectors[u32_I], &rt_Buffer[0], &t_PackedEvent);
+            loadPackedId(&gt_IdVectors[u32_J], &ru8_IdBuffer[0], &t_PackedId);
+
+            TEST_SUCCESS(ITC_PackedEvent_toEvent(&t_PackedEvent, &pt_Event));
+            TEST_SUCCESS(ITC_PackedId_toId(&t_PackedId, &pt_Id));
+
+            TEST_SUCCESS(ITC_Event_fill(&pt_Event, pt_Id, &b_WasFilled));
+            TEST_SUCCESS(
+                ITC_PackedEvent_fill(
+                    &t_PackedEvent, &t_PackedId, &b_WasPackedFilled));
+            TEST_ASSERT_EQUAL(b_WasFilled, b_WasPackedFilled);
+            TEST_SUCCESS(ITC_PackedEvent_validate(&t_PackedEvent));
+            assertPackedEventEqualsEvent(&t_PackedEvent, pt_Event);
+
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+            TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test growing a packed Event matches growing an ITC Event */
+void ITC_Packed_Test_growPackedEventMatchesGrowEvent(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_IdBuffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedId_t t_PackedId;
+    ITC_PackedEvent_t t_PackedEvent;
+    ITC_Id_t *pt_Id;
+    ITC_Event_t *pt_Event;
+    ITC_Status_t t_Status;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(gt_EventVectors); u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(gt_IdVectors); u32_J++)
+        {
+            loadPackedEvent(
+                &gt_EventVectors[u32_I], &rt_Buffer[0], &t_PackedEvent);
+            loadPackedId(&gt_IdVectors[u32_J], &ru8_IdBuffer[0], &t_PackedId);
+
+            TEST_SUCCESS(ITC_PackedEvent_toEvent(&t_PackedEvent, &pt_Event));
+            TEST_SUCCESS(ITC_PackedId_toId(&t_PackedId, &pt_Id));
+
+            t_Status = ITC_Event_grow(&pt_Event, pt_Id);
+
+            TEST_FAILURE(
+                ITC_PackedEvent_grow(&t_PackedEvent, &t_PackedId), t_Status);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* The packed Event is always kept normalised */
+                TEST_SUCCESS(ITC_Event_normalise(pt_Event));
+                TEST_SUCCESS(ITC_PackedEvent_validate(&t_PackedEvent));
+                assertPackedEventEqualsEvent(&t_PackedEvent, pt_Event);
+            }
+
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+            TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test growing a packed Event fails with insufficient resources */
+void ITC_Packed_Test_growPackedEventFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_IdBuffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_Event_Counter_t rt_Buffer[TEST_PACKED_CAPACITY];
+    ITC_PackedId_t t_PackedId;
+    ITC_PackedEvent_t t_PackedEvent;
+
+    /* Growing a leaf Event with a (1, 0) ID needs to expand the Event */
+    loadPackedEvent(&gt_EventVectors[1], &rt_Buffer[0], &t_PackedEvent);
+    loadPackedId(&gt_IdVectors[2], &ru8_IdBuffer[0], &t_PackedId);
+    t_PackedEvent.u32_Capacity = 2;
+
+    TEST_FAILURE(
+        ITC_PackedEvent_grow(&t_PackedEvent, &t_PackedId),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing and unpacking a Stamp fails with invalid param */
+void ITC_Packed_Test_packStampFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    ITC_PackedStamp_t t_PackedStamp = { { NULL, 0, 0 }, { NULL, 0, 0 } };
+    ITC_Stamp_t *pt_Stamp;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_PackedStamp_fromStamp(pt_Stamp, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedStamp_fromStamp(NULL, &t_PackedStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedStamp_fromStamp(pt_Stamp, &t_PackedStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedStamp_toStamp(NULL, &pt_Stamp), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_PackedStamp_toStamp(&t_PackedStamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
+
+/* Test packing and unpacking a Stamp succeeds */
+void ITC_Packed_Test_packAndUnpackStampSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_PACKED_API
+    uint8_t ru8_IdBuffer[TEST_PACKED_CAPACITY / ITC_PACKED_ID_NODES_PER_BYTE];
+    ITC_Event_Counter_t rt_EventBuffer[TEST_PACKED_CAPACITY];
+    ITC_PackedStamp_t t_PackedStamp =
+    {
+        { &ru8_IdBuffer[0], TEST_PACKED_CAPACITY, 0 },
+        { &rt_EventBuffer[0], TEST_PACKED_CAPACITY, 0 },
+    };
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_UnpackedStamp;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Create a Stamp with a non-trivial ID and Event */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_OtherStamp, &pt_UnpackedStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_UnpackedStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    TEST_SUCCESS(ITC_PackedStamp_fromStamp(pt_Stamp, &t_PackedStamp));
+    TEST_SUCCESS(ITC_PackedId_validate(&t_PackedStamp.t_Id));
+    TEST_SUCCESS(ITC_PackedEvent_validate(&t_PackedStamp.t_Event));
+
+    TEST_SUCCESS(ITC_PackedStamp_toStamp(&t_PackedStamp, &pt_UnpackedStamp));
+    TEST_SUCCESS(ITC_Stamp_validate(pt_UnpackedStamp));
+
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_UnpackedStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    assertPackedIdEqualsId(&t_PackedStamp.t_Id, pt_UnpackedStamp->pt_Id);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_UnpackedStamp));
+#else
+    TEST_IGNORE_MESSAGE("Packed API is disabled");
+#endif /* ITC_CONFIG_ENABLE_PACKED_API */
+}
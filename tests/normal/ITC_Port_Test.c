@@ -0,0 +1,1708 @@
+/**
+ * @file ITC_Port_Test.c
+ * @brief Unit tests for the Interval Tree Clock's port implementation
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_Port.h"
+#include "ITC_Port_Test.h"
+
+#include "ITC_Event_package.h"
+#include "ITC_Test_package.h"
+#include "ITC_TestUtil.h"
+#include "ITC_Config.h"
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+#include <string.h>
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#include <stddef.h>
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+#include <pthread.h>
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+#include <stdlib.h>
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+#include "ITC_SerDes.h"
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST && \
+    !ITC_CONFIG_ENABLE_SCRATCH_ARENA && !ITC_CONFIG_ENABLE_STATS
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/* The number of threads to run concurrently */
+#define CONCURRENT_WORKER_COUNT                                              (2)
+
+/* The number of fork-event-join rounds each thread runs */
+#define CONCURRENT_WORKER_ROUNDS                                          (1000)
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Repeatedly fork, event and join a Stamp
+ *
+ * Returns the cached free slots after each round, so that the other threads
+ * are not starved by the small static arrays used in the tests
+ *
+ * @param pv_Status (out) The status of the worker. Points to `ITC_Status_t`
+ * @return `void *` Always `NULL`
+ */
+static void *concurrentStampWorker(
+    void *pv_Status
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_Stamp_t *pt_OtherStamp = NULL;
+
+    for (uint32_t u32_I = 0;
+         u32_I < CONCURRENT_WORKER_ROUNDS && t_Status == ITC_STATUS_SUCCESS;
+         u32_I++)
+    {
+        t_Status = ITC_Stamp_newSeed(&pt_Stamp);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Stamp_event(pt_Stamp);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Stamp_event(pt_OtherStamp);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp);
+        }
+
+        if (pt_Stamp)
+        {
+            (void)ITC_Stamp_destroy(&pt_Stamp);
+        }
+
+        if (pt_OtherStamp)
+        {
+            (void)ITC_Stamp_destroy(&pt_OtherStamp);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Port_flushThreadCache();
+        }
+    }
+
+    *(ITC_Status_t *)pv_Status = t_Status;
+
+    return NULL;
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST && !ITC_CONFIG_ENABLE_SCRATCH_ARENA && !ITC_CONFIG_ENABLE_STATS */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+
+/**
+ * @brief Custom port context allocation callback
+ *
+ * Allocates the node with `malloc` and counts the live nodes in the
+ * `pv_UserData` of the context
+ *
+ * @param pt_Context The context
+ * @param ppv_Ptr (out) Pointer to the allocated memory
+ * @param t_AllocType The type of data being allocated
+ * @return `ITC_Status_t` The status of the operation
+ */
+static ITC_Status_t contextCustomMalloc(
+    ITC_Port_Context_t *pt_Context,
+    void **ppv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+
+    switch (t_AllocType)
+    {
+        case ITC_PORT_ALLOCTYPE_ITC_ID_T:
+        {
+            *ppv_Ptr = malloc(sizeof(ITC_Id_t));
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_EVENT_T:
+        {
+            *ppv_Ptr = malloc(sizeof(ITC_Event_t));
+            break;
+        }
+        case ITC_PORT_ALLOCTYPE_ITC_STAMP_T:
+        {
+            *ppv_Ptr = malloc(sizeof(ITC_Stamp_t));
+            break;
+        }
+        default:
+        {
+            *ppv_Ptr = NULL;
+            t_Status = ITC_STATUS_INVALID_PARAM;
+            break;
+        }
+    }
+
+    if (*ppv_Ptr)
+    {
+        (*(uint32_t *)pt_Context->pv_UserData)++;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Custom port context deallocation callback
+ *
+ * See ::contextCustomMalloc()
+ *
+ * @param pt_Context The context
+ * @param pv_Ptr The memory to deallocate
+ * @param t_AllocType The type of data being deallocated
+ * @return `ITC_Status_t` The status of the operation
+ */
+static ITC_Status_t contextCustomFree(
+    ITC_Port_Context_t *pt_Context,
+    void *pv_Ptr,
+    ITC_Port_AllocType_t t_AllocType
+)
+{
+    (void)t_AllocType;
+
+    if (pv_Ptr)
+    {
+        free(pv_Ptr);
+        (*(uint32_t *)pt_Context->pv_UserData)--;
+    }
+
+    return ITC_STATUS_SUCCESS;
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/* The number of Stamps used by the compaction and snapshot tests */
+#define STATIC_POOL_STAMP_COUNT                                              (4)
+
+/* The number of distinct pairs of Stamps used by the compaction and snapshot
+ * tests */
+#define STATIC_POOL_STAMP_PAIR_COUNT                                         (6)
+
+/* The size of the snapshot buffer. Leaves room for the snapshot header */
+#define STATIC_POOL_SNAPSHOT_BUFFER_SIZE                                       \
+    (MAX_ITC_ID_NODES * sizeof(ITC_Id_t) +                                     \
+     MAX_ITC_EVENT_NODES * sizeof(ITC_Event_t) +                               \
+     MAX_ITC_STAMP_NODES * sizeof(ITC_Stamp_t) + 256)
+
+/******************************************************************************
+ *  Global variables
+ ******************************************************************************/
+
+/* The buffer holding the snapshots of the node allocation arrays */
+static uint8_t gru8_SnapshotBuffer[STATIC_POOL_SNAPSHOT_BUFFER_SIZE];
+
+/* A second Event node allocation array, used to test the restored nodes are
+ * rebased onto a different array */
+static ITC_Event_t grt_RestoredEventNodeAllocationArray[MAX_ITC_EVENT_NODES];
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Create Stamps with their nodes scattered over the static arrays
+ *
+ * @param rpt_Stamps (out) The Stamps
+ */
+static void newFragmentedStamps(
+    ITC_Stamp_t *rpt_Stamps[STATIC_POOL_STAMP_COUNT]
+)
+{
+    ITC_Stamp_t *pt_DiscardedStamp = NULL;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &pt_DiscardedStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_DiscardedStamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[1], &rpt_Stamps[3]));
+
+    for (uint32_t u32_I = 0; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J <= u32_I; u32_J++)
+        {
+            TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[u32_I]));
+        }
+    }
+
+    /* Leave holes in the static arrays */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_DiscardedStamp));
+}
+
+/**
+ * @brief Compare every distinct pair of Stamps
+ *
+ * @param rpt_Stamps The Stamps
+ * @param rt_Results (out) The comparison results
+ */
+static void compareFragmentedStamps(
+    ITC_Stamp_t *rpt_Stamps[STATIC_POOL_STAMP_COUNT],
+    ITC_Stamp_Comparison_t rt_Results[STATIC_POOL_STAMP_PAIR_COUNT]
+)
+{
+    uint32_t u32_Pair = 0;
+
+    for (uint32_t u32_I = 0; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        for (uint32_t u32_J = u32_I + 1; u32_J < STATIC_POOL_STAMP_COUNT; u32_J++)
+        {
+            TEST_SUCCESS(
+                ITC_Stamp_compare(
+                    rpt_Stamps[u32_I], rpt_Stamps[u32_J], &rt_Results[u32_Pair]));
+            u32_Pair++;
+        }
+    }
+}
+
+/**
+ * @brief Check whether all free slots of a static array are at its end
+ *
+ * @param pv_Array The static array
+ * @param u32_ArrayLength The length of the array
+ * @param u32_AllocSize The size of one element
+ * @return `true` if no slot in use follows a free slot, `false` otherwise
+ */
+static bool isStaticArrayCompact(
+    const void *pv_Array,
+    uint32_t u32_ArrayLength,
+    uint32_t u32_AllocSize
+)
+{
+    const uint8_t *pu8_Slot = (const uint8_t *)pv_Array;
+    bool b_FoundFreeSlot = false;
+    bool b_IsCompact = true;
+    bool b_IsFree;
+
+    for (uint32_t u32_I = 0; u32_I < u32_ArrayLength; u32_I++)
+    {
+        b_IsFree = pu8_Slot[0] == ITC_PORT_FREE_SLOT_PATTERN &&
+                   memcmp((const void *)&pu8_Slot[0],
+                          (const void *)&pu8_Slot[1],
+                          u32_AllocSize - 1) == 0;
+        b_IsCompact = b_IsCompact && (b_IsFree || !b_FoundFreeSlot);
+        b_FoundFreeSlot = b_FoundFreeSlot || b_IsFree;
+        pu8_Slot = &pu8_Slot[u32_AllocSize];
+    }
+
+    return b_IsCompact;
+}
+
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+
+/******************************************************************************
+ *  Defines
+ ******************************************************************************/
+
+/* The capacity of the ID and Event reservation pools */
+#define RESERVATION_POOL_CAPACITY                                           (48)
+
+/* The capacity of the Stamp reservation pool */
+#define RESERVATION_STAMP_POOL_CAPACITY                                      (2)
+
+/******************************************************************************
+ *  Global variables
+ ******************************************************************************/
+
+/* The buffers holding the reserved nodes */
+static void *grpv_ReservedIds[RESERVATION_POOL_CAPACITY];
+static void *grpv_ReservedEvents[RESERVATION_POOL_CAPACITY];
+static void *grpv_ReservedStamps[RESERVATION_STAMP_POOL_CAPACITY];
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Init an empty reservation backed by the global pool buffers
+ *
+ * @param pt_Reservation (out) The reservation
+ */
+static void initTestReservation(ITC_Port_Reservation_t *pt_Reservation)
+{
+    pt_Reservation->t_IdPool.ppv_Nodes = &grpv_ReservedIds[0];
+    pt_Reservation->t_IdPool.u32_Capacity = RESERVATION_POOL_CAPACITY;
+    pt_Reservation->t_EventPool.ppv_Nodes = &grpv_ReservedEvents[0];
+    pt_Reservation->t_EventPool.u32_Capacity = RESERVATION_POOL_CAPACITY;
+    pt_Reservation->t_StampPool.ppv_Nodes = &grpv_ReservedStamps[0];
+    pt_Reservation->t_StampPool.u32_Capacity =
+        RESERVATION_STAMP_POOL_CAPACITY;
+
+    TEST_SUCCESS(ITC_Port_initReservation(pt_Reservation));
+}
+
+/**
+ * @brief Reserve exactly the given nodes and bind the reservation to the
+ * calling thread
+ *
+ * Any previously reserved nodes are released first, so that the operation
+ * that follows can only use the newly reserved nodes
+ *
+ * @param pt_Reservation The reservation
+ * @param pt_NodeCount The number of nodes to reserve
+ */
+static void bindExactReservation(
+    ITC_Port_Reservation_t *pt_Reservation,
+    const ITC_Stamp_NodeCount_t *pt_NodeCount
+)
+{
+    TEST_SUCCESS(ITC_Port_setReservation(NULL));
+    TEST_SUCCESS(ITC_Port_releaseReservation(pt_Reservation));
+    TEST_SUCCESS(ITC_Port_reserve(pt_Reservation, pt_NodeCount));
+    TEST_SUCCESS(ITC_Port_setReservation(pt_Reservation));
+}
+
+/**
+ * @brief Serialise a Stamp and deserialise it again using only reserved
+ * nodes
+ *
+ * @param pt_Reservation The reservation
+ * @param pt_Stamp The Stamp
+ * @param b_Compact Whether to use the compact serialisation format
+ */
+static void deserialiseReserved(
+    ITC_Port_Reservation_t *pt_Reservation,
+    const ITC_Stamp_t *pt_Stamp,
+    bool b_Compact
+)
+{
+    ITC_Stamp_t *pt_DeserialisedStamp = NULL;
+    ITC_Stamp_NodeCount_t t_NodeCount;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[64];
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    if (b_Compact)
+    {
+        TEST_SUCCESS(ITC_SerDes_serialiseStampCompact(
+            pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    }
+    else
+#else
+    (void)b_Compact;
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+    {
+        TEST_SUCCESS(ITC_SerDes_serialiseStamp(
+            pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    }
+
+    TEST_SUCCESS(ITC_SerDes_getDeserialisedStampNodeCount(
+        &ru8_Buffer[0], u32_BufferSize, &t_NodeCount));
+    bindExactReservation(pt_Reservation, &t_NodeCount);
+    TEST_SUCCESS(ITC_SerDes_deserialiseStamp(
+        &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp));
+    TEST_SUCCESS(ITC_Port_setReservation(NULL));
+
+    TEST_SUCCESS(
+        ITC_Stamp_compare(pt_DeserialisedStamp, pt_Stamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_DeserialisedStamp));
+}
+
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/* Init test */
+void setUp(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    static bool b_MemoryInit = false;
+
+    if (!b_MemoryInit)
+    {
+        TEST_SUCCESS(ITC_Port_init());
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        ITC_TestUtil_initTestContext();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+        b_MemoryInit = true;
+    }
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/* Fini test */
+void tearDown(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+/* Test all memory is freed at the end of each test */
+
+    TEST_ASSERT_EQUAL_UINT(
+        ITC_PORT_FREE_SLOT_PATTERN,
+        ((uint8_t *)gpt_ItcEventNodeAllocationArray)[0]);
+    TEST_ASSERT_EQUAL_UINT(
+        0,
+        memcmp((const void *)&((uint8_t *)gpt_ItcEventNodeAllocationArray)[0],
+               (const void *)&((uint8_t *)gpt_ItcEventNodeAllocationArray)[1],
+               (gu32_ItcEventNodeAllocationArrayLength * sizeof(ITC_Event_t)) -
+                   1));
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* Test all memory is freed at the end of each test */
+    ITC_TestUtil_testAllStaticNodesAreFree();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /* Test the scratch arena is released at the end of each test */
+    ITC_TestUtil_testScratchArenaIsEmpty();
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+}
+
+/* Test allocating memory fails with invalid param */
+void ITC_Port_Test_mallocFailInvalidParam(void)
+{
+    TEST_FAILURE(
+        ITC_Port_malloc(NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test allocating and deallocating memory succeeds */
+void ITC_Port_Test_mallocAndFreeSuccessful(void)
+{
+    void *pv_Id = NULL;
+    void *pv_Event = NULL;
+    void *pv_Stamp = NULL;
+
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Id, ITC_PORT_ALLOCTYPE_ITC_ID_T));
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Stamp, ITC_PORT_ALLOCTYPE_ITC_STAMP_T));
+
+    TEST_ASSERT_NOT_EQUAL(NULL, pv_Id);
+    TEST_ASSERT_NOT_EQUAL(NULL, pv_Event);
+    TEST_ASSERT_NOT_EQUAL(NULL, pv_Stamp);
+
+    TEST_SUCCESS(ITC_Port_free(pv_Id, ITC_PORT_ALLOCTYPE_ITC_ID_T));
+    TEST_SUCCESS(ITC_Port_free(pv_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    TEST_SUCCESS(ITC_Port_free(pv_Stamp, ITC_PORT_ALLOCTYPE_ITC_STAMP_T));
+}
+
+/* Test allocating memory fails once the static array is exhausted */
+void ITC_Port_Test_mallocFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    void *rpv_Nodes[MAX_ITC_STAMP_NODES];
+    void *pv_Node;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Nodes); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Port_malloc(&rpv_Nodes[u32_I], ITC_PORT_ALLOCTYPE_ITC_STAMP_T));
+        /* Mark the slot as used */
+        memset(rpv_Nodes[u32_I], 0, sizeof(ITC_Stamp_t));
+    }
+
+    TEST_FAILURE(
+        ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_ITC_STAMP_T),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Free a single slot and test it gets reused */
+    TEST_SUCCESS(ITC_Port_free(rpv_Nodes[3], ITC_PORT_ALLOCTYPE_ITC_STAMP_T));
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_ITC_STAMP_T));
+    TEST_ASSERT_TRUE(pv_Node == rpv_Nodes[3]);
+    memset(pv_Node, 0, sizeof(ITC_Stamp_t));
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Nodes); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Port_free(rpv_Nodes[u32_I], ITC_PORT_ALLOCTYPE_ITC_STAMP_T));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/* Test deallocating memory not owned by the free list fails */
+void ITC_Port_Test_freeListFreeFailInvalidParam(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    ITC_Event_t t_Event;
+    void *pv_Event;
+
+    TEST_FAILURE(
+        ITC_Port_free(NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T),
+        ITC_STATUS_INVALID_PARAM);
+    /* Not part of the static array */
+    TEST_FAILURE(
+        ITC_Port_free(&t_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+
+    /* Not aligned to a slot */
+    TEST_FAILURE(
+        ITC_Port_free(
+            (void *)&((uint8_t *)pv_Event)[1], ITC_PORT_ALLOCTYPE_ITC_EVENT_T),
+        ITC_STATUS_INVALID_PARAM);
+    /* Part of a different static array */
+    TEST_FAILURE(
+        ITC_Port_free(pv_Event, ITC_PORT_ALLOCTYPE_ITC_STAMP_T),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Port_free(pv_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+#else
+    TEST_IGNORE_MESSAGE("Static free list memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/* Test the free list slot validation catches double frees and
+ * use-after-free */
+void ITC_Port_Test_freeListSlotValidation(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST && \
+    ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS
+    ITC_Event_t *pt_Event;
+    void *pv_Dummy;
+
+    TEST_SUCCESS(
+        ITC_Port_malloc((void **)&pt_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    TEST_SUCCESS(ITC_Port_free(pt_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+
+    /* Double free */
+    TEST_FAILURE(
+        ITC_Port_free(pt_Event, ITC_PORT_ALLOCTYPE_ITC_EVENT_T),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Modify the freed slot */
+    pt_Event->t_Count = 0;
+
+    TEST_FAILURE(
+        ITC_Port_malloc(&pv_Dummy, ITC_PORT_ALLOCTYPE_ITC_EVENT_T),
+        ITC_STATUS_FAILURE);
+
+    /* Restore the slot so the rest of the tests can continue */
+    memset(
+        (void *)&pt_Event->t_Count,
+        ITC_PORT_FREE_SLOT_PATTERN,
+        sizeof(pt_Event->t_Count));
+#else
+    TEST_IGNORE_MESSAGE("Static free list slot validation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST && ITC_CONFIG_STATIC_FREE_LIST_VALIDATE_SLOTS */
+}
+
+/* Test the thread cache of the concurrent free list overflows into the global
+ * free list and can be flushed */
+void ITC_Port_Test_concurrentFreeListFlushThreadCacheSuccessful(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST
+    void *rpv_Nodes[MAX_ITC_EVENT_NODES];
+    void *pv_Node;
+
+    /* Free more slots than fit in the thread cache */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Nodes); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Port_malloc(&rpv_Nodes[u32_I], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    }
+
+    TEST_FAILURE(
+        ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_ITC_EVENT_T),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Nodes); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Port_free(rpv_Nodes[u32_I], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    }
+
+    /* Test the most recently freed slot gets reused first */
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    TEST_ASSERT_TRUE(pv_Node == rpv_Nodes[ARRAY_COUNT(rpv_Nodes) - 1]);
+    TEST_SUCCESS(ITC_Port_free(pv_Node, ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+
+    TEST_SUCCESS(ITC_Port_flushThreadCache());
+    /* Flushing an empty thread cache is a no-op */
+    TEST_SUCCESS(ITC_Port_flushThreadCache());
+#else
+    TEST_IGNORE_MESSAGE("Concurrent free list memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST */
+}
+
+/* Test Stamps can be forked, evented and joined from multiple threads at the
+ * same time */
+void ITC_Port_Test_concurrentFreeListMultipleThreadsSuccessful(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST && \
+    !ITC_CONFIG_ENABLE_SCRATCH_ARENA && !ITC_CONFIG_ENABLE_STATS
+    pthread_t rt_Threads[CONCURRENT_WORKER_COUNT];
+    ITC_Status_t rt_Statuses[CONCURRENT_WORKER_COUNT];
+
+    /* Make all free slots available to the other threads */
+    TEST_SUCCESS(ITC_Port_flushThreadCache());
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rt_Threads); u32_I++)
+    {
+        rt_Statuses[u32_I] = ITC_STATUS_FAILURE;
+        TEST_ASSERT_EQUAL_INT(
+            0,
+            pthread_create(
+                &rt_Threads[u32_I],
+                NULL,
+                concurrentStampWorker,
+                (void *)&rt_Statuses[u32_I]));
+    }
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rt_Threads); u32_I++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, pthread_join(rt_Threads[u32_I], NULL));
+        TEST_SUCCESS(rt_Statuses[u32_I]);
+    }
+#else
+    TEST_IGNORE_MESSAGE(
+        "Concurrent free list memory allocation is disabled or the scratch "
+        "arena or statistics are enabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST && !ITC_CONFIG_ENABLE_SCRATCH_ARENA && !ITC_CONFIG_ENABLE_STATS */
+}
+
+/* Test initialising a port context fails with invalid param */
+void ITC_Port_Test_contextInitFailInvalidParam(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    ITC_Port_Context_t t_Context = gt_ItcTestContext;
+
+    TEST_FAILURE(ITC_Port_initContext(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Port_resetContext(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Port_getContext(NULL), ITC_STATUS_INVALID_PARAM);
+
+    /* Missing pool memory */
+    t_Context.t_EventPool.pv_Nodes = NULL;
+    TEST_FAILURE(ITC_Port_initContext(&t_Context), ITC_STATUS_INVALID_PARAM);
+
+    /* Empty pool */
+    t_Context = gt_ItcTestContext;
+    t_Context.t_StampPool.u32_Length = 0;
+    TEST_FAILURE(
+        ITC_Port_initContext(&t_Context), ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Only one of the custom callbacks is set */
+    t_Context = gt_ItcTestContext;
+    t_Context.pf_Malloc = contextCustomMalloc;
+    TEST_FAILURE(ITC_Port_initContext(&t_Context), ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Context memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/* Test allocating memory fails when no port context is bound */
+void ITC_Port_Test_contextMallocFailWithNoContext(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    ITC_Port_Context_t *pt_Context;
+    void *pv_Node = NULL;
+
+    TEST_SUCCESS(ITC_Port_getContext(&pt_Context));
+    TEST_ASSERT_TRUE(pt_Context == &gt_ItcTestContext);
+
+    TEST_SUCCESS(ITC_Port_setContext(NULL));
+    TEST_SUCCESS(ITC_Port_getContext(&pt_Context));
+    TEST_ASSERT_NULL(pt_Context);
+
+    TEST_FAILURE(
+        ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_ITC_ID_T),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_ASSERT_NULL(pv_Node);
+    TEST_FAILURE(
+        ITC_Port_free(
+            gt_ItcTestContext.t_IdPool.pv_Nodes, ITC_PORT_ALLOCTYPE_ITC_ID_T),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Port_setContext(&gt_ItcTestContext));
+#else
+    TEST_IGNORE_MESSAGE("Context memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/* Test resetting a port context releases all of its nodes at once */
+void ITC_Port_Test_contextResetReleasesAllNodes(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT && \
+    !ITC_CONFIG_ENABLE_STATS
+    ITC_Id_t rt_IdNodes[16];
+    ITC_Event_t rt_EventNodes[16];
+    ITC_Stamp_t rt_StampNodes[2];
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    ITC_Event_t rt_ScratchNodes[8];
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+    ITC_Port_Context_t t_Context = { 0 };
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_Stamp_t *pt_OtherStamp = NULL;
+    ITC_Stamp_t *pt_ClonedStamp = NULL;
+
+    t_Context.t_IdPool.pv_Nodes = &rt_IdNodes[0];
+    t_Context.t_IdPool.u32_Length = ARRAY_COUNT(rt_IdNodes);
+    t_Context.t_EventPool.pv_Nodes = &rt_EventNodes[0];
+    t_Context.t_EventPool.u32_Length = ARRAY_COUNT(rt_EventNodes);
+    t_Context.t_StampPool.pv_Nodes = &rt_StampNodes[0];
+    t_Context.t_StampPool.u32_Length = ARRAY_COUNT(rt_StampNodes);
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    t_Context.t_ScratchPool.pv_Nodes = &rt_ScratchNodes[0];
+    t_Context.t_ScratchPool.u32_Length = ARRAY_COUNT(rt_ScratchNodes);
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+
+    TEST_SUCCESS(ITC_Port_initContext(&t_Context));
+    TEST_SUCCESS(ITC_Port_setContext(&t_Context));
+
+    /* Use up all Stamp nodes of the context */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_FAILURE(
+        ITC_Stamp_clone(pt_Stamp, &pt_ClonedStamp),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Drop the Stamps without destroying them */
+    TEST_SUCCESS(ITC_Port_resetContext(&t_Context));
+    pt_Stamp = NULL;
+    pt_OtherStamp = NULL;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_TRUE((void *)pt_Stamp == (void *)&rt_StampNodes[0] ||
+                     (void *)pt_OtherStamp == (void *)&rt_StampNodes[0]);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+
+    /* The nodes of the test context are not affected */
+    TEST_SUCCESS(ITC_Port_setContext(&gt_ItcTestContext));
+    ITC_TestUtil_testAllStaticNodesAreFree();
+#else
+    TEST_IGNORE_MESSAGE(
+        "Context memory allocation is disabled or statistics are enabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT && !ITC_CONFIG_ENABLE_STATS */
+}
+
+/* Test a port context with custom allocation callbacks */
+void ITC_Port_Test_contextCustomCallbacksSuccessful(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    ITC_Port_Context_t t_Context = gt_ItcTestContext;
+    uint32_t u32_LiveNodes = 0;
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_Stamp_t *pt_OtherStamp = NULL;
+
+    t_Context.pf_Malloc = contextCustomMalloc;
+    t_Context.pf_Free = contextCustomFree;
+    t_Context.pv_UserData = (void *)&u32_LiveNodes;
+    /* The node pools are not used */
+    t_Context.t_IdPool.pv_Nodes = NULL;
+    t_Context.t_EventPool.u32_Length = 0;
+
+    TEST_SUCCESS(ITC_Port_initContext(&t_Context));
+    TEST_SUCCESS(ITC_Port_setContext(&t_Context));
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_TRUE(u32_LiveNodes > 0);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_ASSERT_EQUAL_UINT32(0, u32_LiveNodes);
+
+    TEST_SUCCESS(ITC_Port_setContext(&gt_ItcTestContext));
+#else
+    TEST_IGNORE_MESSAGE("Context memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
+}
+
+/* Test beginning to use the scratch arena fails with invalid param */
+void ITC_Port_Test_arenaBeginFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    TEST_FAILURE(ITC_Port_arenaBegin(NULL), ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Scratch arena is disabled");
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+}
+
+/* Test resetting the scratch arena past its top fails with invalid param */
+void ITC_Port_Test_arenaResetFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    uint32_t u32_Marker;
+
+    TEST_SUCCESS(ITC_Port_arenaBegin(&u32_Marker));
+    TEST_FAILURE(
+        ITC_Port_arenaReset(u32_Marker + 1), ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Scratch arena is disabled");
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+}
+
+/* Test allocating from the scratch arena and resetting it succeeds */
+void ITC_Port_Test_arenaMallocAndResetSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC
+    /* Make sure the arena has to grow more than once */
+    void *rpv_Nodes[(2 * ITC_CONFIG_SCRATCH_ARENA_CHUNK_LENGTH) + 1];
+#else
+    void *rpv_Nodes[MAX_ITC_SCRATCH_NODES];
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_MALLOC */
+    const uint32_t u32_Half = ARRAY_COUNT(rpv_Nodes) / 2;
+    uint32_t u32_OuterMarker;
+    uint32_t u32_InnerMarker;
+    void *pv_Node;
+
+    TEST_SUCCESS(ITC_Port_arenaBegin(&u32_OuterMarker));
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Nodes); u32_I++)
+    {
+        /* Test nested use of the arena */
+        if (u32_I == u32_Half)
+        {
+            TEST_SUCCESS(ITC_Port_arenaBegin(&u32_InnerMarker));
+            TEST_ASSERT_EQUAL_UINT32(u32_OuterMarker + u32_Half, u32_InnerMarker);
+        }
+
+        TEST_SUCCESS(
+            ITC_Port_malloc(&rpv_Nodes[u32_I], ITC_PORT_ALLOCTYPE_SCRATCH));
+        TEST_ASSERT_NOT_EQUAL(NULL, rpv_Nodes[u32_I]);
+        ((ITC_Event_t *)rpv_Nodes[u32_I])->t_Count = u32_I;
+    }
+
+    /* Test the allocated nodes do not overlap */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Nodes); u32_I++)
+    {
+        TEST_ASSERT_EQUAL(u32_I, ((ITC_Event_t *)rpv_Nodes[u32_I])->t_Count);
+    }
+
+    /* Deallocating scratch nodes is a no-op */
+    TEST_SUCCESS(ITC_Port_free(rpv_Nodes[0], ITC_PORT_ALLOCTYPE_SCRATCH));
+    TEST_FAILURE(
+        ITC_Port_free(NULL, ITC_PORT_ALLOCTYPE_SCRATCH),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test the nodes after the inner marker get reused */
+    TEST_SUCCESS(ITC_Port_arenaReset(u32_InnerMarker));
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_SCRATCH));
+    TEST_ASSERT_TRUE(pv_Node == rpv_Nodes[u32_Half]);
+
+    /* Test the nodes after the outer marker get reused */
+    TEST_SUCCESS(ITC_Port_arenaReset(u32_OuterMarker));
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_SCRATCH));
+    TEST_ASSERT_TRUE(pv_Node == rpv_Nodes[0]);
+
+    TEST_SUCCESS(ITC_Port_arenaReset(u32_OuterMarker));
+#else
+    TEST_IGNORE_MESSAGE("Scratch arena is disabled");
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+}
+
+/* Test allocating from the scratch arena fails once the static array is
+ * exhausted */
+void ITC_Port_Test_arenaMallocFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA && \
+    (ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+     ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+     ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+     ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT)
+    uint32_t u32_Marker;
+    void *pv_Node;
+
+    TEST_SUCCESS(ITC_Port_arenaBegin(&u32_Marker));
+
+    for (uint32_t u32_I = 0; u32_I < MAX_ITC_SCRATCH_NODES; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_SCRATCH));
+    }
+
+    TEST_FAILURE(
+        ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_SCRATCH),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    TEST_SUCCESS(ITC_Port_arenaReset(u32_Marker));
+#else
+    TEST_IGNORE_MESSAGE("Static scratch arena is disabled");
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA && (ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT) */
+}
+
+/* Test getting the statistics fails with invalid param */
+void ITC_Port_Test_getStatsFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_STATS
+    TEST_FAILURE(ITC_Port_getStats(NULL), ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Statistics are disabled");
+#endif /* ITC_CONFIG_ENABLE_STATS */
+}
+
+/* Test the statistics track allocating and deallocating memory */
+void ITC_Port_Test_statsTrackMallocAndFree(void)
+{
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_Stats_t t_Before;
+    ITC_Port_Stats_t t_After;
+    void *pv_Id = NULL;
+    void *rpv_Events[2] = {NULL};
+
+    TEST_SUCCESS(ITC_Port_resetStats());
+    TEST_SUCCESS(ITC_Port_getStats(&t_Before));
+
+    TEST_SUCCESS(ITC_Port_malloc(&pv_Id, ITC_PORT_ALLOCTYPE_ITC_ID_T));
+    TEST_SUCCESS(
+        ITC_Port_malloc(&rpv_Events[0], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    TEST_SUCCESS(
+        ITC_Port_malloc(&rpv_Events[1], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    /* Invalid params are not tracked */
+    TEST_FAILURE(
+        ITC_Port_malloc(NULL, ITC_PORT_ALLOCTYPE_ITC_EVENT_T),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Port_getStats(&t_After));
+
+    TEST_ASSERT_EQUAL_UINT32(t_Before.t_Id.u32_Live + 1, t_After.t_Id.u32_Live);
+    TEST_ASSERT_EQUAL_UINT32(1, t_After.t_Id.u32_Allocations);
+    TEST_ASSERT_EQUAL_UINT32(
+        t_Before.t_Event.u32_Live + 2, t_After.t_Event.u32_Live);
+    TEST_ASSERT_EQUAL_UINT32(t_After.t_Event.u32_Live, t_After.t_Event.u32_Peak);
+    TEST_ASSERT_EQUAL_UINT32(2, t_After.t_Event.u32_Allocations);
+    TEST_ASSERT_EQUAL_UINT32(0, t_After.t_Event.u32_FailedAllocations);
+    TEST_ASSERT_EQUAL_UINT32(0, t_After.t_Stamp.u32_Allocations);
+
+    TEST_SUCCESS(ITC_Port_free(pv_Id, ITC_PORT_ALLOCTYPE_ITC_ID_T));
+    TEST_SUCCESS(ITC_Port_free(rpv_Events[0], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+
+    TEST_SUCCESS(ITC_Port_getStats(&t_After));
+
+    TEST_ASSERT_EQUAL_UINT32(t_Before.t_Id.u32_Live, t_After.t_Id.u32_Live);
+    TEST_ASSERT_EQUAL_UINT32(1, t_After.t_Id.u32_Frees);
+    TEST_ASSERT_EQUAL_UINT32(
+        t_Before.t_Event.u32_Live + 1, t_After.t_Event.u32_Live);
+    /* The peak is kept */
+    TEST_ASSERT_EQUAL_UINT32(
+        t_Before.t_Event.u32_Live + 2, t_After.t_Event.u32_Peak);
+    TEST_ASSERT_EQUAL_UINT32(1, t_After.t_Event.u32_Frees);
+
+    /* Test resetting keeps the live nodes */
+    TEST_SUCCESS(ITC_Port_resetStats());
+    TEST_SUCCESS(ITC_Port_getStats(&t_After));
+
+    TEST_ASSERT_EQUAL_UINT32(
+        t_Before.t_Event.u32_Live + 1, t_After.t_Event.u32_Live);
+    TEST_ASSERT_EQUAL_UINT32(t_After.t_Event.u32_Live, t_After.t_Event.u32_Peak);
+    TEST_ASSERT_EQUAL_UINT32(0, t_After.t_Event.u32_Allocations);
+    TEST_ASSERT_EQUAL_UINT32(0, t_After.t_Event.u32_Frees);
+    TEST_ASSERT_EQUAL_UINT32(0, t_After.t_Id.u32_Frees);
+
+    TEST_SUCCESS(ITC_Port_free(rpv_Events[1], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+#else
+    TEST_IGNORE_MESSAGE("Statistics are disabled");
+#endif /* ITC_CONFIG_ENABLE_STATS */
+}
+
+/* Test the statistics track failed allocations once the static array is
+ * exhausted */
+void ITC_Port_Test_statsTrackFailedMalloc(void)
+{
+#if ITC_CONFIG_ENABLE_STATS && \
+    (ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+     ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+     ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+     ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT)
+    ITC_Port_Stats_t t_Stats;
+    void *rpv_Nodes[MAX_ITC_STAMP_NODES];
+    void *pv_Node;
+
+    TEST_SUCCESS(ITC_Port_resetStats());
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Nodes); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Port_malloc(&rpv_Nodes[u32_I], ITC_PORT_ALLOCTYPE_ITC_STAMP_T));
+        /* Mark the slot as used */
+        memset(rpv_Nodes[u32_I], 0, sizeof(ITC_Stamp_t));
+    }
+
+    TEST_FAILURE(
+        ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_ITC_STAMP_T),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    TEST_SUCCESS(ITC_Port_getStats(&t_Stats));
+
+    /* The peak is the high-water mark of the static array */
+    TEST_ASSERT_EQUAL_UINT32(MAX_ITC_STAMP_NODES, t_Stats.t_Stamp.u32_Peak);
+    TEST_ASSERT_EQUAL_UINT32(
+        MAX_ITC_STAMP_NODES, t_Stats.t_Stamp.u32_Allocations);
+    TEST_ASSERT_EQUAL_UINT32(1, t_Stats.t_Stamp.u32_FailedAllocations);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Nodes); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Port_free(rpv_Nodes[u32_I], ITC_PORT_ALLOCTYPE_ITC_STAMP_T));
+    }
+#else
+    TEST_IGNORE_MESSAGE(
+        "Statistics or static memory allocation are disabled");
+#endif /* ITC_CONFIG_ENABLE_STATS && (ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT) */
+}
+
+/* Test the statistics track the scratch arena */
+void ITC_Port_Test_statsTrackArena(void)
+{
+#if ITC_CONFIG_ENABLE_STATS && ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    ITC_Port_Stats_t t_Stats;
+    uint32_t u32_Marker;
+    void *pv_Node;
+
+    TEST_SUCCESS(ITC_Port_resetStats());
+    TEST_SUCCESS(ITC_Port_arenaBegin(&u32_Marker));
+
+    for (uint32_t u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Port_malloc(&pv_Node, ITC_PORT_ALLOCTYPE_SCRATCH));
+    }
+
+    /* Deallocating scratch nodes does not release them */
+    TEST_SUCCESS(ITC_Port_free(pv_Node, ITC_PORT_ALLOCTYPE_SCRATCH));
+
+    TEST_SUCCESS(ITC_Port_getStats(&t_Stats));
+
+    TEST_ASSERT_EQUAL_UINT32(u32_Marker + 3, t_Stats.t_Scratch.u32_Live);
+    TEST_ASSERT_EQUAL_UINT32(3, t_Stats.t_Scratch.u32_Allocations);
+    TEST_ASSERT_EQUAL_UINT32(0, t_Stats.t_Scratch.u32_Frees);
+
+    TEST_SUCCESS(ITC_Port_arenaReset(u32_Marker));
+    TEST_SUCCESS(ITC_Port_getStats(&t_Stats));
+
+    TEST_ASSERT_EQUAL_UINT32(u32_Marker, t_Stats.t_Scratch.u32_Live);
+    TEST_ASSERT_EQUAL_UINT32(u32_Marker + 3, t_Stats.t_Scratch.u32_Peak);
+    TEST_ASSERT_EQUAL_UINT32(3, t_Stats.t_Scratch.u32_Frees);
+#else
+    TEST_IGNORE_MESSAGE("Statistics or scratch arena are disabled");
+#endif /* ITC_CONFIG_ENABLE_STATS && ITC_CONFIG_ENABLE_SCRATCH_ARENA */
+}
+
+/* Test compacting the static node allocation arrays succeeds */
+void ITC_Port_Test_compactSucceeds(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+    ITC_Stamp_t *rpt_Stamps[STATIC_POOL_STAMP_COUNT] = { NULL };
+    ITC_Stamp_t *rpt_StampsBefore[STATIC_POOL_STAMP_COUNT];
+    ITC_Stamp_Comparison_t rt_ComparisonsBefore[STATIC_POOL_STAMP_PAIR_COUNT];
+    ITC_Stamp_Comparison_t rt_ComparisonsAfter[STATIC_POOL_STAMP_PAIR_COUNT];
+
+    newFragmentedStamps(rpt_Stamps);
+    compareFragmentedStamps(rpt_Stamps, rt_ComparisonsBefore);
+    memcpy(&rpt_StampsBefore[0], &rpt_Stamps[0], sizeof(rpt_Stamps));
+
+    TEST_ASSERT_FALSE(
+        isStaticArrayCompact(
+            gpt_ItcEventNodeAllocationArray,
+            gu32_ItcEventNodeAllocationArrayLength,
+            sizeof(ITC_Event_t)));
+
+    TEST_SUCCESS(ITC_Port_compact());
+
+    TEST_ASSERT_TRUE(
+        isStaticArrayCompact(
+            gpt_ItcIdNodeAllocationArray,
+            gu32_ItcIdNodeAllocationArrayLength,
+            sizeof(ITC_Id_t)));
+    TEST_ASSERT_TRUE(
+        isStaticArrayCompact(
+            gpt_ItcEventNodeAllocationArray,
+            gu32_ItcEventNodeAllocationArrayLength,
+            sizeof(ITC_Event_t)));
+
+    /* The Stamps did not move and still hold the same history */
+    TEST_ASSERT_EQUAL_MEMORY(
+        &rpt_StampsBefore[0], &rpt_Stamps[0], sizeof(rpt_Stamps));
+
+    for (uint32_t u32_I = 0; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_validate(rpt_Stamps[u32_I]));
+    }
+
+    compareFragmentedStamps(rpt_Stamps, rt_ComparisonsAfter);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &rt_ComparisonsBefore[0],
+        &rt_ComparisonsAfter[0],
+        sizeof(rt_ComparisonsBefore));
+
+    /* The compacted Stamps can still be used */
+    for (uint32_t u32_I = 1; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[0], &rpt_Stamps[u32_I]));
+    }
+
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_validate(rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[0]));
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+}
+
+/* Test compacting the static node allocation arrays does not move roots
+ * which are not owned by a Stamp */
+void ITC_Port_Test_compactKeepsUnownedRootsInPlace(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+    ITC_Stamp_t *rpt_Stamps[STATIC_POOL_STAMP_COUNT] = { NULL };
+    ITC_Event_t *pt_Event = NULL;
+
+    newFragmentedStamps(rpt_Stamps);
+
+    TEST_SUCCESS(ITC_Event_clone(rpt_Stamps[3]->pt_Event, &pt_Event));
+
+    /* Free the slots in front of the copy */
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[1]));
+
+    TEST_SUCCESS(ITC_Port_compact());
+
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+    TEST_SUCCESS(ITC_Stamp_validate(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_validate(rpt_Stamps[3]));
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[3]));
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+}
+
+/* Test taking a snapshot fails with invalid param */
+void ITC_Port_Test_snapshotFailInvalidParam(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+    uint32_t u32_BufferSize = sizeof(gru8_SnapshotBuffer);
+
+    TEST_FAILURE(ITC_Port_getSnapshotSize(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Port_snapshot(NULL, &u32_BufferSize), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Port_snapshot(&gru8_SnapshotBuffer[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+}
+
+/* Test taking a snapshot fails with insufficient resources */
+void ITC_Port_Test_snapshotFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+    uint32_t u32_Size;
+    uint32_t u32_BufferSize;
+
+    TEST_SUCCESS(ITC_Port_getSnapshotSize(&u32_Size));
+    TEST_ASSERT_TRUE(u32_Size <= sizeof(gru8_SnapshotBuffer));
+
+    u32_BufferSize = u32_Size - 1;
+
+    TEST_FAILURE(
+        ITC_Port_snapshot(&gru8_SnapshotBuffer[0], &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+}
+
+/* Test taking and restoring a snapshot succeeds */
+void ITC_Port_Test_snapshotAndRestoreSucceeds(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+    ITC_Stamp_t *rpt_Stamps[STATIC_POOL_STAMP_COUNT] = { NULL };
+    uint32_t ru32_StampSlots[STATIC_POOL_STAMP_COUNT];
+    ITC_Stamp_Comparison_t rt_ComparisonsBefore[STATIC_POOL_STAMP_PAIR_COUNT];
+    ITC_Stamp_Comparison_t rt_ComparisonsAfter[STATIC_POOL_STAMP_PAIR_COUNT];
+    ITC_Event_t *pt_EventNodeAllocationArray = gpt_ItcEventNodeAllocationArray;
+    uint32_t u32_BufferSize = sizeof(gru8_SnapshotBuffer);
+    uint32_t u32_Size;
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_Stats_t t_Stats;
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    newFragmentedStamps(rpt_Stamps);
+    compareFragmentedStamps(rpt_Stamps, rt_ComparisonsBefore);
+
+    for (uint32_t u32_I = 0; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        ru32_StampSlots[u32_I] =
+            (uint32_t)(rpt_Stamps[u32_I] - gpt_ItcStampNodeAllocationArray);
+    }
+
+    TEST_SUCCESS(ITC_Port_getSnapshotSize(&u32_Size));
+    TEST_SUCCESS(ITC_Port_snapshot(&gru8_SnapshotBuffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL_UINT32(u32_Size, u32_BufferSize);
+
+    for (uint32_t u32_I = 0; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+
+    /* Restore the Event nodes into a different array */
+    gpt_ItcEventNodeAllocationArray = &grt_RestoredEventNodeAllocationArray[0];
+
+    TEST_SUCCESS(ITC_Port_restore(&gru8_SnapshotBuffer[0], u32_BufferSize));
+
+    for (uint32_t u32_I = 0; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        rpt_Stamps[u32_I] =
+            &gpt_ItcStampNodeAllocationArray[ru32_StampSlots[u32_I]];
+
+        TEST_SUCCESS(ITC_Stamp_validate(rpt_Stamps[u32_I]));
+        TEST_ASSERT_TRUE(
+            rpt_Stamps[u32_I]->pt_Event >=
+                &grt_RestoredEventNodeAllocationArray[0] &&
+            rpt_Stamps[u32_I]->pt_Event <
+                &grt_RestoredEventNodeAllocationArray[MAX_ITC_EVENT_NODES]);
+    }
+
+    compareFragmentedStamps(rpt_Stamps, rt_ComparisonsAfter);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &rt_ComparisonsBefore[0],
+        &rt_ComparisonsAfter[0],
+        sizeof(rt_ComparisonsBefore));
+
+#if ITC_CONFIG_ENABLE_STATS
+    TEST_SUCCESS(ITC_Port_getStats(&t_Stats));
+
+    /* The statistics start over with the restored nodes */
+    TEST_ASSERT_EQUAL_UINT32(STATIC_POOL_STAMP_COUNT, t_Stats.t_Stamp.u32_Live);
+    TEST_ASSERT_EQUAL_UINT32(STATIC_POOL_STAMP_COUNT, t_Stats.t_Stamp.u32_Peak);
+    TEST_ASSERT_EQUAL_UINT32(0, t_Stats.t_Stamp.u32_Allocations);
+#endif /* ITC_CONFIG_ENABLE_STATS */
+
+    /* The restored Stamps can still be used */
+    for (uint32_t u32_I = 0; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[u32_I]));
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+
+    gpt_ItcEventNodeAllocationArray = pt_EventNodeAllocationArray;
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+}
+
+/* Test restoring a snapshot fails with invalid param */
+void ITC_Port_Test_restoreFailInvalidParam(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+    uint32_t u32_BufferSize = sizeof(gru8_SnapshotBuffer);
+
+    TEST_SUCCESS(ITC_Port_snapshot(&gru8_SnapshotBuffer[0], &u32_BufferSize));
+
+    TEST_FAILURE(
+        ITC_Port_restore(NULL, u32_BufferSize), ITC_STATUS_INVALID_PARAM);
+
+    /* Truncated snapshot */
+    TEST_FAILURE(
+        ITC_Port_restore(&gru8_SnapshotBuffer[0], u32_BufferSize - 1),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Not a snapshot */
+    gru8_SnapshotBuffer[0] ^= 0xFF;
+    TEST_FAILURE(
+        ITC_Port_restore(&gru8_SnapshotBuffer[0], u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+}
+
+/* Test restoring a snapshot with corrupt node pointers fails */
+void ITC_Port_Test_restoreFailWithCorruptPointer(void)
+{
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+    ITC_Stamp_t *rpt_Stamps[STATIC_POOL_STAMP_COUNT] = { NULL };
+    uint32_t u32_BufferSize = sizeof(gru8_SnapshotBuffer);
+    uint32_t u32_IdArraySize;
+    uint32_t u32_EventArraySize;
+    uint32_t u32_HeaderSize;
+    uint8_t *pu8_Field;
+    const void *pv_Saved;
+    const void *pv_Corrupt;
+
+    newFragmentedStamps(rpt_Stamps);
+
+    TEST_SUCCESS(ITC_Port_snapshot(&gru8_SnapshotBuffer[0], &u32_BufferSize));
+
+    u32_IdArraySize = gu32_ItcIdNodeAllocationArrayLength * sizeof(ITC_Id_t);
+    u32_EventArraySize =
+        gu32_ItcEventNodeAllocationArrayLength * sizeof(ITC_Event_t);
+    u32_HeaderSize = u32_BufferSize - u32_IdArraySize - u32_EventArraySize -
+                     gu32_ItcStampNodeAllocationArrayLength *
+                         (uint32_t)sizeof(ITC_Stamp_t);
+
+    /* A Stamp pointing into the middle of an Event node */
+    pu8_Field = &gru8_SnapshotBuffer[
+        u32_HeaderSize + u32_IdArraySize + u32_EventArraySize +
+        (uint32_t)(rpt_Stamps[0] - gpt_ItcStampNodeAllocationArray) *
+            sizeof(ITC_Stamp_t) +
+        offsetof(ITC_Stamp_t, pt_Event)];
+    memcpy((void *)&pv_Saved, (const void *)pu8_Field, sizeof(pv_Saved));
+    pv_Corrupt = (const void *)&((const uint8_t *)pv_Saved)[1];
+    memcpy((void *)pu8_Field, (const void *)&pv_Corrupt, sizeof(pv_Corrupt));
+
+    TEST_FAILURE(
+        ITC_Port_restore(&gru8_SnapshotBuffer[0], u32_BufferSize),
+        ITC_STATUS_CORRUPT_STAMP);
+
+    memcpy((void *)pu8_Field, (const void *)&pv_Saved, sizeof(pv_Saved));
+
+    /* An Event node pointing outside of the Event node allocation array */
+    pu8_Field = &gru8_SnapshotBuffer[
+        u32_HeaderSize + u32_IdArraySize +
+        (uint32_t)(rpt_Stamps[0]->pt_Event - gpt_ItcEventNodeAllocationArray) *
+            sizeof(ITC_Event_t) +
+        offsetof(ITC_Event_t, pt_Parent)];
+    pv_Corrupt = (const void *)gpt_ItcIdNodeAllocationArray;
+    memcpy((void *)pu8_Field, (const void *)&pv_Corrupt, sizeof(pv_Corrupt));
+
+    TEST_FAILURE(
+        ITC_Port_restore(&gru8_SnapshotBuffer[0], u32_BufferSize),
+        ITC_STATUS_CORRUPT_EVENT);
+
+    /* The failed restores did not modify the allocated nodes */
+    for (uint32_t u32_I = 0; u32_I < STATIC_POOL_STAMP_COUNT; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_validate(rpt_Stamps[u32_I]));
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Static memory allocation is disabled");
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+}
+
+/* Test the node reservation functions fail with invalid param */
+void ITC_Port_Test_reservationFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+    ITC_Port_Reservation_t t_Reservation;
+    ITC_Stamp_NodeCount_t t_NodeCount = { 1, 1, 1 };
+    ITC_Stamp_t *pt_Stamp = NULL;
+    uint8_t ru8_Buffer[] = { 0 };
+
+    TEST_FAILURE(ITC_Port_initReservation(NULL), ITC_STATUS_INVALID_PARAM);
+
+    /* A pool without a buffer */
+    initTestReservation(&t_Reservation);
+    t_Reservation.t_EventPool.ppv_Nodes = NULL;
+    TEST_FAILURE(
+        ITC_Port_initReservation(&t_Reservation), ITC_STATUS_INVALID_PARAM);
+
+    initTestReservation(&t_Reservation);
+    TEST_FAILURE(
+        ITC_Port_reserve(NULL, &t_NodeCount), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Port_reserve(&t_Reservation, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Port_releaseReservation(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Port_getReservation(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Port_mallocBatch(NULL, 1, ITC_PORT_ALLOCTYPE_ITC_ID_T),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Port_freeBatch(NULL, 1, ITC_PORT_ALLOCTYPE_ITC_ID_T),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_Stamp_getForkNodeCount(NULL, &t_NodeCount),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_getForkNodeCount(pt_Stamp, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_getEventNodeCount(NULL, &t_NodeCount),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_getEventNodeCount(pt_Stamp, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_getJoinNodeCount(NULL, pt_Stamp, &t_NodeCount),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_getJoinNodeCount(pt_Stamp, NULL, &t_NodeCount),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_getJoinNodeCount(pt_Stamp, pt_Stamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getDeserialisedStampNodeCount(NULL, 1, &t_NodeCount),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getDeserialisedStampNodeCount(&ru8_Buffer[0], 1, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    /* Too short to be a serialised Stamp */
+    TEST_FAILURE(
+        ITC_SerDes_getDeserialisedStampNodeCount(
+            &ru8_Buffer[0], sizeof(ru8_Buffer), &t_NodeCount),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Node reservation is disabled");
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+}
+
+/* Test reserving more nodes than a pool can hold fails and leaves the
+ * reservation unmodified */
+void ITC_Port_Test_reserveFailWithInsufficientResources(void)
+{
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+    ITC_Port_Reservation_t t_Reservation;
+    ITC_Stamp_NodeCount_t t_NodeCount = { 2, 3, 1 };
+
+    initTestReservation(&t_Reservation);
+    TEST_SUCCESS(ITC_Port_reserve(&t_Reservation, &t_NodeCount));
+
+    /* The ID and Event nodes fit, but the Stamp nodes do not */
+    t_NodeCount.u32_IdNodes = RESERVATION_POOL_CAPACITY;
+    t_NodeCount.u32_EventNodes = RESERVATION_POOL_CAPACITY;
+    t_NodeCount.u32_StampNodes = RESERVATION_STAMP_POOL_CAPACITY + 1;
+    TEST_FAILURE(
+        ITC_Port_reserve(&t_Reservation, &t_NodeCount),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    TEST_ASSERT_EQUAL_UINT32(2, t_Reservation.t_IdPool.u32_Count);
+    TEST_ASSERT_EQUAL_UINT32(3, t_Reservation.t_EventPool.u32_Count);
+    TEST_ASSERT_EQUAL_UINT32(1, t_Reservation.t_StampPool.u32_Count);
+
+    TEST_SUCCESS(ITC_Port_releaseReservation(&t_Reservation));
+#else
+    TEST_IGNORE_MESSAGE("Node reservation is disabled");
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+}
+
+/* Test allocations are served from the bound reservation, and deallocated
+ * nodes are returned to it */
+void ITC_Port_Test_reservationServesAllocations(void)
+{
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+    ITC_Port_Reservation_t t_Reservation;
+    ITC_Port_Reservation_t *pt_BoundReservation = NULL;
+    ITC_Stamp_NodeCount_t t_NodeCount = { 1, 1, 1 };
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_Stamp_t *pt_OtherStamp = NULL;
+
+    initTestReservation(&t_Reservation);
+    TEST_SUCCESS(ITC_Port_reserve(&t_Reservation, &t_NodeCount));
+
+    /* Reserving fewer nodes than are already held is a no-op */
+    t_NodeCount.u32_StampNodes = 0;
+    TEST_SUCCESS(ITC_Port_reserve(&t_Reservation, &t_NodeCount));
+    TEST_ASSERT_EQUAL_UINT32(1, t_Reservation.t_StampPool.u32_Count);
+
+    TEST_SUCCESS(ITC_Port_setReservation(&t_Reservation));
+    TEST_SUCCESS(ITC_Port_getReservation(&pt_BoundReservation));
+    TEST_ASSERT_EQUAL_PTR(&t_Reservation, pt_BoundReservation);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_ASSERT_EQUAL_UINT32(0, t_Reservation.t_StampPool.u32_Count);
+    TEST_ASSERT_EQUAL_UINT32(0, t_Reservation.t_EventPool.u32_Count);
+
+    /* The pools are exhausted. The allocation does not fall back to the
+     * allocator */
+    TEST_FAILURE(
+        ITC_Stamp_newSeed(&pt_OtherStamp), ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_FAILURE(
+        ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_SUCCESS(ITC_Stamp_validate(pt_Stamp));
+
+    /* The nodes go back to the pools */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_ASSERT_EQUAL_UINT32(1, t_Reservation.t_StampPool.u32_Count);
+    TEST_ASSERT_EQUAL_UINT32(1, t_Reservation.t_EventPool.u32_Count);
+
+    TEST_SUCCESS(ITC_Port_setReservation(NULL));
+    TEST_SUCCESS(ITC_Port_getReservation(&pt_BoundReservation));
+    TEST_ASSERT_EQUAL_PTR(NULL, pt_BoundReservation);
+
+    TEST_SUCCESS(ITC_Port_releaseReservation(&t_Reservation));
+    TEST_ASSERT_EQUAL_UINT32(0, t_Reservation.t_IdPool.u32_Count);
+    TEST_ASSERT_EQUAL_UINT32(0, t_Reservation.t_EventPool.u32_Count);
+    TEST_ASSERT_EQUAL_UINT32(0, t_Reservation.t_StampPool.u32_Count);
+#else
+    TEST_IGNORE_MESSAGE("Node reservation is disabled");
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+}
+
+/* Test reserved static nodes are neither handed out again by the allocator
+ * nor reused by the compaction */
+void ITC_Port_Test_reservedStaticNodesStayReserved(void)
+{
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION && \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+    ITC_Port_Reservation_t t_Reservation;
+    ITC_Stamp_NodeCount_t t_NodeCount = { 0, 2, 0 };
+    void *rpv_Events[3] = { NULL };
+    void **ppv_ReservedEvents;
+    ITC_Stamp_t *pt_Stamp = NULL;
+
+    initTestReservation(&t_Reservation);
+    ppv_ReservedEvents = t_Reservation.t_EventPool.ppv_Nodes;
+
+    /* Reserve the nodes after an allocated node */
+    TEST_SUCCESS(
+        ITC_Port_malloc(&rpv_Events[0], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    TEST_SUCCESS(ITC_Port_reserve(&t_Reservation, &t_NodeCount));
+
+    /* Free the slot in front of the reserved nodes */
+    TEST_SUCCESS(ITC_Port_free(rpv_Events[0], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+
+    /* Test the reserved nodes are not handed out again */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpv_Events); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Port_malloc(&rpv_Events[u32_I], ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+        TEST_ASSERT_NOT_EQUAL(ppv_ReservedEvents[0], rpv_Events[u32_I]);
+        TEST_ASSERT_NOT_EQUAL(ppv_ReservedEvents[1], rpv_Events[u32_I]);
+    }
+
+    TEST_SUCCESS(
+        ITC_Port_freeBatch(
+            &rpv_Events[0],
+            ARRAY_COUNT(rpv_Events),
+            ITC_PORT_ALLOCTYPE_ITC_EVENT_T));
+    TEST_SUCCESS(ITC_Port_releaseReservation(&t_Reservation));
+
+    /* Reserve the first nodes of the array, in front of a Stamp */
+    TEST_SUCCESS(ITC_Port_reserve(&t_Reservation, &t_NodeCount));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Test the compaction does not move the Stamp into the reserved nodes */
+    TEST_SUCCESS(ITC_Port_compact());
+    TEST_ASSERT_NOT_EQUAL(ppv_ReservedEvents[0], (void *)pt_Stamp->pt_Event);
+    TEST_ASSERT_NOT_EQUAL(ppv_ReservedEvents[1], (void *)pt_Stamp->pt_Event);
+    TEST_SUCCESS(ITC_Stamp_validate(pt_Stamp));
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Port_releaseReservation(&t_Reservation));
+#else
+    TEST_IGNORE_MESSAGE(
+        "Node reservation or static memory allocation is disabled");
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION && ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+}
+
+/* Test the Stamp operations succeed using only the nodes reserved for them */
+void ITC_Port_Test_reservedStampOperationsSucceed(void)
+{
+#if ITC_CONFIG_ENABLE_NODE_RESERVATION
+    ITC_Port_Reservation_t t_Reservation;
+    ITC_Stamp_NodeCount_t t_NodeCount;
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_Stamp_t *pt_OtherStamp = NULL;
+    ITC_Stamp_t *pt_ThirdStamp = NULL;
+
+    initTestReservation(&t_Reservation);
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    for (uint32_t u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_getForkNodeCount(pt_Stamp, &t_NodeCount));
+        bindExactReservation(&t_Reservation, &t_NodeCount);
+        TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+
+        TEST_SUCCESS(ITC_Stamp_getEventNodeCount(pt_OtherStamp, &t_NodeCount));
+        bindExactReservation(&t_Reservation, &t_NodeCount);
+        TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+
+        TEST_SUCCESS(ITC_Stamp_getForkNodeCount(pt_OtherStamp, &t_NodeCount));
+        bindExactReservation(&t_Reservation, &t_NodeCount);
+        TEST_SUCCESS(ITC_Stamp_fork(&pt_OtherStamp, &pt_ThirdStamp));
+
+        TEST_SUCCESS(ITC_Stamp_getEventNodeCount(pt_ThirdStamp, &t_NodeCount));
+        bindExactReservation(&t_Reservation, &t_NodeCount);
+        TEST_SUCCESS(ITC_Stamp_event(pt_ThirdStamp));
+
+        TEST_SUCCESS(ITC_Stamp_getEventNodeCount(pt_Stamp, &t_NodeCount));
+        bindExactReservation(&t_Reservation, &t_NodeCount);
+        TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+        TEST_SUCCESS(ITC_Port_setReservation(NULL));
+        deserialiseReserved(&t_Reservation, pt_ThirdStamp, false);
+        deserialiseReserved(&t_Reservation, pt_ThirdStamp, true);
+
+        TEST_SUCCESS(
+            ITC_Stamp_getJoinNodeCount(pt_Stamp, pt_ThirdStamp, &t_NodeCount));
+        bindExactReservation(&t_Reservation, &t_NodeCount);
+        TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_ThirdStamp));
+
+        TEST_SUCCESS(ITC_Stamp_getEventNodeCount(pt_Stamp, &t_NodeCount));
+        bindExactReservation(&t_Reservation, &t_NodeCount);
+        TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+        TEST_SUCCESS(ITC_Port_setReservation(NULL));
+
+        if (u32_I < 2)
+        {
+            /* Keep one Stamp forked off, so the next round works on a
+             * deeper ID */
+            TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+        }
+    }
+
+    TEST_SUCCESS(
+        ITC_Stamp_getJoinNodeCount(pt_Stamp, pt_OtherStamp, &t_NodeCount));
+    bindExactReservation(&t_Reservation, &t_NodeCount);
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Port_setReservation(NULL));
+
+    deserialiseReserved(&t_Reservation, pt_Stamp, false);
+    deserialiseReserved(&t_Reservation, pt_Stamp, true);
+
+    TEST_SUCCESS(ITC_Stamp_validate(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Port_releaseReservation(&t_Reservation));
+#else
+    TEST_IGNORE_MESSAGE("Node reservation is disabled");
+#endif /* ITC_CONFIG_ENABLE_NODE_RESERVATION */
+}
@@ -32,16 +32,126 @@
 #include <string.h>
 #endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
 #include "ITC_Port.h"
 
 #include <string.h>
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 
 /******************************************************************************
  *  Private functions
  ******************************************************************************/
 
+/* Create Stamps with different ID and Event trees for the Stamp view tests */
+static void newStampViewTestStamps(
+    ITC_Stamp_t *rpt_Stamps[6]
+)
+{
+    ITC_Stamp_t *pt_Stamp;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[1], &rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[2], &rpt_Stamps[3]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[3]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[3], &rpt_Stamps[4]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[4]));
+    TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[0], &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[4], &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[4]));
+    TEST_SUCCESS(ITC_Stamp_newPeek(rpt_Stamps[1], &rpt_Stamps[5]));
+}
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/* Collects the chunks emitted by the streaming string serialisers */
+typedef struct
+{
+    /* The collected string */
+    char rc_Buffer[256];
+    /* The length of the collected string */
+    uint32_t u32_Length;
+    /* The number of times the writer was called */
+    uint32_t u32_Calls;
+    /* The writer call to fail. `0` to never fail */
+    uint32_t u32_FailAtCall;
+} ITC_SerDes_Test_StringWriterContext_t;
+
+/* Append a chunk emitted by the streaming string serialisers to the
+ * writer context */
+static ITC_Status_t collectStringChunk(
+    void *pv_Context,
+    const char *pc_Chunk,
+    uint32_t u32_ChunkLength
+)
+{
+    ITC_SerDes_Test_StringWriterContext_t *pt_Context =
+        (ITC_SerDes_Test_StringWriterContext_t *)pv_Context;
+
+    pt_Context->u32_Calls++;
+
+    if (pt_Context->u32_Calls == pt_Context->u32_FailAtCall)
+    {
+        return ITC_STATUS_FAILURE;
+    }
+
+    TEST_ASSERT_GREATER_OR_EQUAL(1, u32_ChunkLength);
+    TEST_ASSERT_LESS_OR_EQUAL(
+        sizeof(pt_Context->rc_Buffer) - pt_Context->u32_Length,
+        u32_ChunkLength);
+
+    memcpy(
+        &pt_Context->rc_Buffer[pt_Context->u32_Length],
+        pc_Chunk,
+        u32_ChunkLength);
+    pt_Context->u32_Length += u32_ChunkLength;
+
+    return ITC_STATUS_SUCCESS;
+}
+
+/* Create a Stamp whose string spans multiple writer chunks and contains event
+ * counters of every length */
+static void newStringTestStamp(
+    ITC_Stamp_t **ppt_Stamp
+)
+{
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Event_t *pt_Event;
+    ITC_Event_Counter_t t_Count = 1;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(ppt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(ppt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_fork(ppt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+
+    /* Build a right-leaning Event tree with counters 1, 12, ..., 123456789 */
+    pt_Event = (*ppt_Stamp)->pt_Event;
+    for (uint32_t u32_I = 2; u32_I <= 10; u32_I++)
+    {
+        pt_Event->t_Count = t_Count;
+        TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+        TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+        pt_Event = pt_Event->pt_Right;
+        t_Count = t_Count * 10 + (u32_I % 10);
+    }
+
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    pt_Event->t_Count = 10000000000000000000ULL;
+#else
+    pt_Event->t_Count = 4000000000U;
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
 /******************************************************************************
  *  Global variables
  ******************************************************************************/
@@ -53,15 +163,21 @@
 /* Init test */
 void setUp(void)
 {
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
     static bool b_MemoryInit = false;
 
     if (!b_MemoryInit)
     {
         TEST_SUCCESS(ITC_Port_init());
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        ITC_TestUtil_initTestContext();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
         b_MemoryInit = true;
     }
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 }
 
 /* Fini test */
@@ -99,7 +215,17 @@ void tearDown(void)
                (const void *)&((uint8_t *)gpt_ItcStampNodeAllocationArray)[1],
                (gu32_ItcStampNodeAllocationArrayLength * sizeof(ITC_Stamp_t)) -
                    1));
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* Test all memory is freed at the end of each test */
+    ITC_TestUtil_testAllStaticNodesAreFree();
 #endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /* Test the scratch arena is released at the end of each test */
+    ITC_TestUtil_testScratchArenaIsEmpty();
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
 }
 
 /* Test serialising a Id fails with invalid param */
@@ -318,6 +444,100 @@ void ITC_SerDes_Test_serialiseIdParentSuccessful(void)
     TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
 }
 
+/* Test getting the serialised size of an ID fails with invalid param */
+void ITC_SerDes_Test_getSerialisedIdSizeFailInvalidParam(void)
+{
+    ITC_Id_t *pt_Id = NULL;
+    uint32_t u32_Size;
+
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedIdSize(NULL, &u32_Size, true),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedIdSize(pt_Id, NULL, true),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
+/* Test getting the serialised size of an ID fails with corrupt ID */
+void ITC_SerDes_Test_getSerialisedIdSizeFailWithCorruptId(void)
+{
+    ITC_Id_t *pt_Id;
+    uint32_t u32_Size;
+
+    /* Test different invalid IDs are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidIdTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid ID */
+        gpv_InvalidIdConstructorTable[u32_I](&pt_Id);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_SerDes_Util_getSerialisedIdSize(pt_Id, &u32_Size, true),
+            ITC_STATUS_CORRUPT_ID);
+
+        /* Destroy the ID */
+        gpv_InvalidIdDestructorTable[u32_I](&pt_Id);
+    }
+}
+
+/* Test getting the serialised size of an ID succeeds */
+void ITC_SerDes_Test_getSerialisedIdSizeSuccessful(void)
+{
+    ITC_Id_t *pt_Id = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize;
+    uint32_t u32_Size;
+
+    /* clang-format off */
+    /* Create a new (0, ((1, 0), 1)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Left->pt_Left, pt_Id->pt_Right->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left->pt_Right, pt_Id->pt_Right->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+    /* clang-format on */
+
+    TEST_SUCCESS(ITC_SerDes_Util_getSerialisedIdSize(pt_Id, &u32_Size, true));
+    TEST_ASSERT_EQUAL(8, u32_Size);
+    TEST_SUCCESS(ITC_SerDes_Util_getSerialisedIdSize(pt_Id, &u32_Size, false));
+    TEST_ASSERT_EQUAL(7, u32_Size);
+
+    /* Test the size is exactly what serialising needs */
+    TEST_SUCCESS(ITC_SerDes_Util_getSerialisedIdSize(pt_Id, &u32_Size, true));
+    u32_BufferSize = u32_Size - 1;
+    TEST_FAILURE(
+        ITC_SerDes_Util_serialiseId(
+            pt_Id,
+            &ru8_Buffer[0],
+            &u32_BufferSize,
+            true),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    u32_BufferSize = u32_Size;
+    TEST_SUCCESS(
+        ITC_SerDes_Util_serialiseId(
+            pt_Id,
+            &ru8_Buffer[0],
+            &u32_BufferSize,
+            true));
+    TEST_ASSERT_EQUAL(u32_Size, u32_BufferSize);
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    /* Test the public API includes the version */
+    TEST_SUCCESS(ITC_SerDes_getSerialisedIdSize(pt_Id, &u32_Size));
+    TEST_ASSERT_EQUAL(8, u32_Size);
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
 /* Test serialising a Id to string fails with invalid param */
 void ITC_SerDes_Test_serialiseIdToStringFailInvalidParam(void)
 {
@@ -1019,6 +1239,102 @@ void ITC_SerDes_Test_serialiseEventParentSuccessful(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
 }
 
+/* Test getting the serialised size of an Event fails with invalid param */
+void ITC_SerDes_Test_getSerialisedEventSizeFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Event = NULL;
+    uint32_t u32_Size;
+
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedEventSize(NULL, &u32_Size, true),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedEventSize(pt_Event, NULL, true),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test getting the serialised size of an Event fails with corrupt Event */
+void ITC_SerDes_Test_getSerialisedEventSizeFailWithCorruptEvent(void)
+{
+    ITC_Event_t *pt_Event;
+    uint32_t u32_Size;
+
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidEventTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Event);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_SerDes_Util_getSerialisedEventSize(pt_Event, &u32_Size, true),
+            ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Event);
+    }
+}
+
+/* Test getting the serialised size of an Event succeeds */
+void ITC_SerDes_Test_getSerialisedEventSizeSuccessful(void)
+{
+    ITC_Event_t *pt_Event = NULL;
+    uint8_t ru8_Buffer[20] = { 0 };
+    uint32_t u32_BufferSize;
+    uint32_t u32_Size;
+
+    /* clang-format off */
+    /* Create a new (0, (256, 0, 1), 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 256));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Left, pt_Event->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Right, pt_Event->pt_Left, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    /* clang-format on */
+
+    /* 5 headers, a 2 byte and a 1 byte counter */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_getSerialisedEventSize(pt_Event, &u32_Size, true));
+    TEST_ASSERT_EQUAL(9, u32_Size);
+    TEST_SUCCESS(
+        ITC_SerDes_Util_getSerialisedEventSize(pt_Event, &u32_Size, false));
+    TEST_ASSERT_EQUAL(8, u32_Size);
+
+    /* Test the size is exactly what serialising needs */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_getSerialisedEventSize(pt_Event, &u32_Size, true));
+    u32_BufferSize = u32_Size - 1;
+    TEST_FAILURE(
+        ITC_SerDes_Util_serialiseEvent(
+            pt_Event,
+            &ru8_Buffer[0],
+            &u32_BufferSize,
+            true),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    u32_BufferSize = u32_Size;
+    TEST_SUCCESS(
+        ITC_SerDes_Util_serialiseEvent(
+            pt_Event,
+            &ru8_Buffer[0],
+            &u32_BufferSize,
+            true));
+    TEST_ASSERT_EQUAL(u32_Size, u32_BufferSize);
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    /* Test the public API includes the version */
+    TEST_SUCCESS(ITC_SerDes_getSerialisedEventSize(pt_Event, &u32_Size));
+    TEST_ASSERT_EQUAL(9, u32_Size);
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
 /* Test serialising a Event to string fails with invalid param */
 void ITC_SerDes_Test_serialiseEventToStringFailInvalidParam(void)
 {
@@ -1568,286 +1884,3861 @@ void ITC_SerDes_Test_deserialiseParentEventSuccessful(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
 }
 
-/* Test serialising a Stamp fails with invalid param */
-void ITC_SerDes_Test_serialiseStampFailInvalidParam(void)
+/* Test serialising a lazily joined Event serialises the normalised Event */
+void ITC_SerDes_Test_serialiseLazilyJoinedEventSuccessful(void)
 {
-    ITC_Stamp_t *pt_Dummy = NULL;
-    uint8_t ru8_Buffer[10];
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION && \
+    ITC_CONFIG_ENABLE_EXTENDED_API && \
+    !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Event_t *pt_Event;
+    uint8_t ru8_Buffer[10] = { 0 };
     uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    uint32_t u32_Size;
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    char rc_Buffer[10] = { 0 };
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+    uint8_t ru8_ExpectedEventSerialisedData[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1
+    };
+    uint8_t ru8_ExpectedUnchangedDelta[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+    };
+
+    /* Join the Stamps into the (0, 1, 1) Event */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event->b_IsDirty);
+
+    /* Test the Event is serialised as the normalised (1) Event */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEvent(
+            pt_Stamp->pt_Event, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedEventSerialisedData), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedEventSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedEventSerialisedData));
+
+    TEST_SUCCESS(
+        ITC_SerDes_getSerialisedEventSize(pt_Stamp->pt_Event, &u32_Size));
+    TEST_ASSERT_EQUAL(u32_BufferSize, u32_Size);
+
+    /* Test the serialised Event can be deserialised again */
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseEvent(&ru8_Buffer[0], u32_BufferSize, &pt_Event));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 1);
+
+    /* Test the delta to the equal normalised Event is empty */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Stamp->pt_Event, pt_Event, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedUnchangedDelta), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedUnchangedDelta[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedUnchangedDelta));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Test applying the delta rebuilds the normalised Event */
+    TEST_SUCCESS(
+        ITC_SerDes_applyEventDelta(
+            pt_Stamp->pt_Event, &ru8_Buffer[0], u32_BufferSize, &pt_Event));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 1);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    u32_BufferSize = sizeof(rc_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEventToString(
+            pt_Stamp->pt_Event, &rc_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL_STRING("1", &rc_Buffer[0]);
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+    /* Test the joined Event itself was not modified */
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event->b_IsDirty);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE(
+        "Lazy Event normalisation or extended API support is disabled, or "
+        "joined Stamps are compacted");
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION && ITC_CONFIG_ENABLE_EXTENDED_API && !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
+}
+
+/* Test checking serialised Events fails with invalid param */
+void ITC_SerDes_Test_leqSerialisedEventsFailInvalidParam(void)
+{
+    bool b_IsLeq;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
 
     TEST_FAILURE(
-        ITC_SerDes_serialiseStamp(
-            pt_Dummy,
+        ITC_SerDes_Util_leqSerialisedEvents(
             &ru8_Buffer[0],
-            NULL),
+            sizeof(ru8_Buffer),
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            true,
+            NULL,
+            &b_IsLeq),
         ITC_STATUS_INVALID_PARAM);
     TEST_FAILURE(
-        ITC_SerDes_serialiseStamp(
+        ITC_SerDes_Util_leqSerialisedEvents(
             NULL,
+            sizeof(ru8_Buffer),
             &ru8_Buffer[0],
-            &u32_BufferSize),
+            sizeof(ru8_Buffer),
+            true,
+            &b_IsLeq,
+            NULL),
         ITC_STATUS_INVALID_PARAM);
     TEST_FAILURE(
-        ITC_SerDes_serialiseStamp(
-            pt_Dummy,
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
             NULL,
-            &u32_BufferSize),
+            sizeof(ru8_Buffer),
+            true,
+            &b_IsLeq,
+            NULL),
         ITC_STATUS_INVALID_PARAM);
-
-    u32_BufferSize = 0;
     TEST_FAILURE(
-        ITC_SerDes_serialiseStamp(
-            pt_Dummy,
-            NULL,
-            &u32_BufferSize),
-        ITC_STATUS_INVALID_PARAM);
-}
-
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Buffer[0],
+            0,
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            true,
+            &b_IsLeq,
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            &ru8_Buffer[0],
+            0,
+            true,
+            &b_IsLeq,
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* The version byte alone is not a valid serialised Event */
+    TEST_FAILURE(
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Buffer[0],
+            ITC_VERSION_MAJOR_LEN,
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            true,
+            &b_IsLeq,
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test checking serialised Events fails with corrupt Event */
+void ITC_SerDes_Test_leqSerialisedEventsFailWithCorruptEvent(void)
+{
+    bool b_IsLeq;
+    const uint8_t *pu8_Buffer = NULL;
+    uint32_t u32_BufferSize = 0;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    /* Test different invalid serialised Events are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidSerialisedEventTableSize;
+         u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidSerialisedEventConstructorTable[u32_I](
+            &pu8_Buffer, &u32_BufferSize);
+
+        /* Test for the failure on both sides of the check */
+        TEST_FAILURE(
+            ITC_SerDes_Util_leqSerialisedEvents(
+                pu8_Buffer,
+                u32_BufferSize,
+                &ru8_Buffer[0],
+                sizeof(ru8_Buffer),
+                true,
+                &b_IsLeq,
+                NULL),
+            ITC_STATUS_CORRUPT_EVENT);
+        TEST_FAILURE(
+            ITC_SerDes_Util_leqSerialisedEvents(
+                &ru8_Buffer[0],
+                sizeof(ru8_Buffer),
+                pu8_Buffer,
+                u32_BufferSize,
+                true,
+                &b_IsLeq,
+                NULL),
+            ITC_STATUS_CORRUPT_EVENT);
+    }
+}
+
+/* Test checking serialised Events fails with unsupported counter size */
+void ITC_SerDes_Test_leqSerialisedEventsFailWithUnsupportedCounterSize(void)
+{
+    bool b_IsLeq;
+    uint8_t ru8_Buffer1[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(
+            false,
+            (sizeof(ITC_Event_Counter_t) + 1)),
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+    };
+    uint8_t ru8_Buffer2[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Buffer1[0],
+            sizeof(ru8_Buffer1),
+            &ru8_Buffer2[0],
+            sizeof(ru8_Buffer2),
+            true,
+            &b_IsLeq,
+            NULL),
+        ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE);
+}
+
+/* Test checking serialised Events with incompatible lib version */
+void ITC_SerDes_Test_leqSerialisedEventsFailWithIncompatibleLibVersion(void)
+{
+    bool b_IsLeq;
+    uint8_t ru8_Buffer1[] = {
+        ITC_VERSION_MAJOR + 1, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    uint8_t ru8_Buffer2[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    /* Test for the failure on both sides of the check */
+    TEST_FAILURE(
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Buffer1[0],
+            sizeof(ru8_Buffer1),
+            &ru8_Buffer2[0],
+            sizeof(ru8_Buffer2),
+            true,
+            &b_IsLeq,
+            NULL),
+        ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION);
+    TEST_FAILURE(
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Buffer2[0],
+            sizeof(ru8_Buffer2),
+            &ru8_Buffer1[0],
+            sizeof(ru8_Buffer1),
+            true,
+            &b_IsLeq,
+            NULL),
+        ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION);
+}
+
+/* Test checking serialised Events matches checking the deserialised Events */
+void ITC_SerDes_Test_leqSerialisedEventsSuccessful(void)
+{
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    bool b_IsLeq12;
+    bool b_IsLeq21;
+    bool b_ExpectedIsLeq12;
+    bool b_ExpectedIsLeq21;
+
+    /* 0 */
+    const uint8_t ru8_Event0[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    /* 3 */
+    const uint8_t ru8_Event1[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        3,
+    };
+    /* (1, 0, 2) */
+    const uint8_t ru8_Event2[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        2,
+    };
+    /* (0, (0, 0, 3), 1) */
+    const uint8_t ru8_Event3[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        3,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+    };
+    /* (2, 0, (0, 4, 0)) */
+    const uint8_t ru8_Event4[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 1),
+        2,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        4,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    /* (0, (1, 0, (0, 2, 0)), (0, 0, 5)) */
+    const uint8_t ru8_Event5[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        2,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        5,
+    };
+    /* (0, 1, (0, (0, 0, 7), 0)) */
+    const uint8_t ru8_Event6[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        7,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    /* (0, (0, 1, 0), (0, 0, 2)) */
+    const uint8_t ru8_Event7[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        2,
+    };
+    /* 10 */
+    const uint8_t ru8_Event8[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        10,
+    };
+
+    const uint8_t *rpu8_Events[] = {
+        &ru8_Event0[0],
+        &ru8_Event1[0],
+        &ru8_Event2[0],
+        &ru8_Event3[0],
+        &ru8_Event4[0],
+        &ru8_Event5[0],
+        &ru8_Event6[0],
+        &ru8_Event7[0],
+        &ru8_Event8[0],
+    };
+    const uint32_t ru32_EventSizes[] = {
+        sizeof(ru8_Event0),
+        sizeof(ru8_Event1),
+        sizeof(ru8_Event2),
+        sizeof(ru8_Event3),
+        sizeof(ru8_Event4),
+        sizeof(ru8_Event5),
+        sizeof(ru8_Event6),
+        sizeof(ru8_Event7),
+        sizeof(ru8_Event8),
+    };
+
+    /* Test every pair of Events, in both directions */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpu8_Events); u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(rpu8_Events); u32_J++)
+        {
+            /* Get the expected results from the deserialised Events */
+            TEST_SUCCESS(
+                ITC_SerDes_Util_deserialiseEvent(
+                    rpu8_Events[u32_I],
+                    ru32_EventSizes[u32_I],
+                    true,
+                    &pt_Event1));
+            TEST_SUCCESS(
+                ITC_SerDes_Util_deserialiseEvent(
+                    rpu8_Events[u32_J],
+                    ru32_EventSizes[u32_J],
+                    true,
+                    &pt_Event2));
+            TEST_SUCCESS(ITC_Event_leq(pt_Event1, pt_Event2, &b_ExpectedIsLeq12));
+            TEST_SUCCESS(ITC_Event_leq(pt_Event2, pt_Event1, &b_ExpectedIsLeq21));
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+
+            /* Test the serialised Events */
+            TEST_SUCCESS(
+                ITC_SerDes_Util_leqSerialisedEvents(
+                    rpu8_Events[u32_I],
+                    ru32_EventSizes[u32_I],
+                    rpu8_Events[u32_J],
+                    ru32_EventSizes[u32_J],
+                    true,
+                    &b_IsLeq12,
+                    &b_IsLeq21));
+            TEST_ASSERT_EQUAL(b_ExpectedIsLeq12, b_IsLeq12);
+            TEST_ASSERT_EQUAL(b_ExpectedIsLeq21, b_IsLeq21);
+
+            /* Test skipping the reverse check. Also skip the version byte */
+            b_IsLeq21 = !b_ExpectedIsLeq21;
+            TEST_SUCCESS(
+                ITC_SerDes_Util_leqSerialisedEvents(
+                    &rpu8_Events[u32_I][ITC_VERSION_MAJOR_LEN],
+                    ru32_EventSizes[u32_I] - (uint32_t)ITC_VERSION_MAJOR_LEN,
+                    &rpu8_Events[u32_J][ITC_VERSION_MAJOR_LEN],
+                    ru32_EventSizes[u32_J] - (uint32_t)ITC_VERSION_MAJOR_LEN,
+                    false,
+                    &b_IsLeq12,
+                    NULL));
+            TEST_ASSERT_EQUAL(b_ExpectedIsLeq12, b_IsLeq12);
+            TEST_ASSERT_EQUAL(!b_ExpectedIsLeq21, b_IsLeq21);
+        }
+    }
+
+    /* Sanity check a few of the results */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Event2[0],
+            sizeof(ru8_Event2),
+            &ru8_Event1[0],
+            sizeof(ru8_Event1),
+            true,
+            &b_IsLeq12,
+            &b_IsLeq21));
+    TEST_ASSERT_TRUE(b_IsLeq12);
+    TEST_ASSERT_FALSE(b_IsLeq21);
+    TEST_SUCCESS(
+        ITC_SerDes_Util_leqSerialisedEvents(
+            &ru8_Event5[0],
+            sizeof(ru8_Event5),
+            &ru8_Event6[0],
+            sizeof(ru8_Event6),
+            true,
+            &b_IsLeq12,
+            &b_IsLeq21));
+    TEST_ASSERT_FALSE(b_IsLeq12);
+    TEST_ASSERT_FALSE(b_IsLeq21);
+}
+
+/* Test checking serialised Events via the public API */
+void ITC_SerDes_Test_leqSerialisedEventsPublicApiSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    bool b_IsLeq;
+    /* (1, 0, 2) */
+    uint8_t ru8_Buffer1[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        2,
+    };
+    /* 3 */
+    uint8_t ru8_Buffer2[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        3,
+    };
+
+    TEST_SUCCESS(
+        ITC_SerDes_leqSerialisedEvents(
+            &ru8_Buffer1[0],
+            sizeof(ru8_Buffer1),
+            &ru8_Buffer2[0],
+            sizeof(ru8_Buffer2),
+            &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    TEST_SUCCESS(
+        ITC_SerDes_leqSerialisedEvents(
+            &ru8_Buffer2[0],
+            sizeof(ru8_Buffer2),
+            &ru8_Buffer1[0],
+            sizeof(ru8_Buffer1),
+            &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test serialising an Event delta fails with invalid param */
+void ITC_SerDes_Test_serialiseEventDeltaFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Event_t *pt_Event = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_SerDes_serialiseEventDelta(
+            NULL, pt_Event, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Event, NULL, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Event, pt_Event, NULL, &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Event, pt_Event, &ru8_Buffer[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+    u32_BufferSize = 0;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Event, pt_Event, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test serialising an Event delta fails with corrupt Event */
+void ITC_SerDes_Test_serialiseEventDeltaFailWithCorruptEvent(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_ValidEvent = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_ValidEvent, NULL, 0));
+
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0; u32_I < gu32_InvalidEventTablesSize; u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Event);
+
+        /* Test for the failure, both as the base and as the Event */
+        u32_BufferSize = sizeof(ru8_Buffer);
+        TEST_FAILURE(
+            ITC_SerDes_serialiseEventDelta(
+                pt_Event, pt_ValidEvent, &ru8_Buffer[0], &u32_BufferSize),
+            ITC_STATUS_CORRUPT_EVENT);
+        TEST_FAILURE(
+            ITC_SerDes_serialiseEventDelta(
+                pt_ValidEvent, pt_Event, &ru8_Buffer[0], &u32_BufferSize),
+            ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Event);
+    }
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_ValidEvent));
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test serialising an Event delta succeeds */
+void ITC_SerDes_Test_serialiseEventDeltaSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Event_t *pt_Base = NULL;
+    ITC_Event_t *pt_Event = NULL;
+    uint8_t ru8_Buffer[20] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    uint8_t ru8_ExpectedUnchangedDelta[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+    };
+    /* Only the path to the changed leaf is serialised */
+    uint8_t ru8_ExpectedChangedLeafDelta[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        3,
+        ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+    };
+    /* Nodes below a base leaf are always serialised */
+    uint8_t ru8_ExpectedGrownLeafDelta[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 1),
+        2,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+        ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+    };
+
+    /* Create the (0, 1, (0, 2, 0)) base Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base->pt_Left, pt_Base, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base->pt_Right, pt_Base, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Base->pt_Right->pt_Left, pt_Base->pt_Right, 2));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Base->pt_Right->pt_Right, pt_Base->pt_Right, 0));
+
+    /* Test an unchanged Event is serialised as a single copied node */
+    TEST_SUCCESS(ITC_Event_clone(pt_Base, &pt_Event));
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Base, pt_Event, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedUnchangedDelta), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedUnchangedDelta[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedUnchangedDelta));
+
+    /* Make it (0, 1, (0, 3, 0)) */
+    pt_Event->pt_Right->pt_Left->t_Count = 3;
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Base, pt_Event, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedChangedLeafDelta), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedChangedLeafDelta[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedChangedLeafDelta));
+
+    /* Test serialising fails if the buffer is not big enough */
+    u32_BufferSize = sizeof(ru8_ExpectedChangedLeafDelta) - 1;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Base, pt_Event, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Make it (0, 1, (0, (2, 0, 1), 0)) */
+    pt_Event->pt_Right->pt_Left->t_Count = 2;
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Left->pt_Left,
+            pt_Event->pt_Right->pt_Left,
+            0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Left->pt_Right,
+            pt_Event->pt_Right->pt_Left,
+            1));
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEventDelta(
+            pt_Base, pt_Event, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedGrownLeafDelta), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedGrownLeafDelta[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedGrownLeafDelta));
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Base));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test applying an Event delta fails with invalid param */
+void ITC_SerDes_Test_applyEventDeltaFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Event_t *pt_Base = NULL;
+    ITC_Event_t *pt_Event;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+    };
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_SerDes_applyEventDelta(
+            NULL, &ru8_Buffer[0], sizeof(ru8_Buffer), &pt_Event),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_applyEventDelta(
+            pt_Base, NULL, sizeof(ru8_Buffer), &pt_Event),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_applyEventDelta(pt_Base, &ru8_Buffer[0], 1, &pt_Event),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_applyEventDelta(
+            pt_Base, &ru8_Buffer[0], sizeof(ru8_Buffer), NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Base));
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test applying an Event delta fails with corrupt Event */
+void ITC_SerDes_Test_applyEventDeltaFailWithCorruptEvent(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Event_t *pt_Base = NULL;
+    ITC_Event_t *pt_Event;
+    /* Serialised deltas against a leaf base Event */
+    uint8_t rru8_Buffers[][4] = {
+        /* Copied node below a base leaf */
+        {
+            ITC_VERSION_MAJOR,
+            ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+            ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+            ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+        },
+        /* Trailing data after the copied root */
+        {
+            ITC_VERSION_MAJOR,
+            ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+            ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+        },
+        /* Unknown node header */
+        { ITC_VERSION_MAJOR, 0x40U },
+        /* Missing right child */
+        {
+            ITC_VERSION_MAJOR,
+            ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+            ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        },
+        /* Not normalised */
+        {
+            ITC_VERSION_MAJOR,
+            ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+            ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+            1,
+        },
+    };
+    uint32_t ru32_BufferSizes[] = { 4, 3, 2, 3, 4 };
+
+    /* Create the (0, 1, 0) base Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base, NULL, 0));
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rru8_Buffers); u32_I++)
+    {
+        TEST_FAILURE(
+            ITC_SerDes_applyEventDelta(
+                pt_Base,
+                &rru8_Buffers[u32_I][0],
+                ru32_BufferSizes[u32_I],
+                &pt_Event),
+            ITC_STATUS_CORRUPT_EVENT);
+    }
+
+    /* Test different invalid base Events are handled properly */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Base));
+    for (uint32_t u32_I = 0; u32_I < gu32_InvalidEventTablesSize; u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Base);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_SerDes_applyEventDelta(
+                pt_Base, &rru8_Buffers[1][0], 2, &pt_Event),
+            ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Base);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test applying an Event delta fails with incompatible lib version */
+void ITC_SerDes_Test_applyEventDeltaFailWithIncompatibleLibVersion(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Event_t *pt_Base = NULL;
+    ITC_Event_t *pt_Event;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR + 1,
+        ITC_SERDES_EVENT_DELTA_COPY_HEADER,
+    };
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base, NULL, 0));
+    TEST_FAILURE(
+        ITC_SerDes_applyEventDelta(
+            pt_Base, &ru8_Buffer[0], sizeof(ru8_Buffer), &pt_Event),
+        ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Base));
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test applying an Event delta succeeds */
+void ITC_SerDes_Test_applyEventDeltaSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Event_t *pt_Base = NULL;
+    ITC_Event_t *pt_Event = NULL;
+    ITC_Event_t *pt_OtherEvent = NULL;
+    ITC_Event_t *pt_RebuiltEvent = NULL;
+    uint8_t ru8_Buffer[30] = { 0 };
+    uint32_t u32_BufferSize;
+    uint8_t ru8_ExpectedBuffer[30] = { 0 };
+    uint32_t u32_ExpectedBufferSize;
+    uint8_t ru8_RebuiltBuffer[30] = { 0 };
+    uint32_t u32_RebuiltBufferSize;
+
+    /* Create the (0, 1, (0, 2, 0)) base Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base->pt_Left, pt_Base, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base->pt_Right, pt_Base, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Base->pt_Right->pt_Left, pt_Base->pt_Right, 2));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Base->pt_Right->pt_Right, pt_Base->pt_Right, 0));
+
+    /* Create the (0, (0, 0, 2), 1) Event to join with it */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 1));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, 2));
+
+    /* Test rebuilding the base, a grown and a shrunk version of it, and its
+     * join with another Event */
+    for (uint32_t u32_I = 0; u32_I < 4; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Event_clone(pt_Base, &pt_Event));
+
+        if (u32_I == 1)
+        {
+            /* Make it (0, 1, (0, (2, 0, 1), 0)) */
+            TEST_SUCCESS(
+                ITC_TestUtil_newEvent(
+                    &pt_Event->pt_Right->pt_Left->pt_Left,
+                    pt_Event->pt_Right->pt_Left,
+                    0));
+            TEST_SUCCESS(
+                ITC_TestUtil_newEvent(
+                    &pt_Event->pt_Right->pt_Left->pt_Right,
+                    pt_Event->pt_Right->pt_Left,
+                    1));
+        }
+        else if (u32_I == 2)
+        {
+            /* Make it a leaf 5 Event */
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+            TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 5));
+        }
+        else if (u32_I == 3)
+        {
+            /* Make it the join of the base and the other Event */
+            TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+            TEST_SUCCESS(
+                ITC_Event_joinConst(pt_Base, pt_OtherEvent, &pt_Event));
+        }
+        else
+        {
+            /* Keep it unchanged */
+        }
+
+        /* Serialise the delta */
+        u32_BufferSize = sizeof(ru8_Buffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseEventDelta(
+                pt_Base, pt_Event, &ru8_Buffer[0], &u32_BufferSize));
+
+        /* Rebuild the Event */
+        TEST_SUCCESS(
+            ITC_SerDes_applyEventDelta(
+                pt_Base, &ru8_Buffer[0], u32_BufferSize, &pt_RebuiltEvent));
+
+        /* Test the rebuilt Event is identical to the original one */
+        u32_ExpectedBufferSize = sizeof(ru8_ExpectedBuffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseEvent(
+                pt_Event, &ru8_ExpectedBuffer[0], &u32_ExpectedBufferSize));
+        u32_RebuiltBufferSize = sizeof(ru8_RebuiltBuffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseEvent(
+                pt_RebuiltEvent,
+                &ru8_RebuiltBuffer[0],
+                &u32_RebuiltBufferSize));
+        TEST_ASSERT_EQUAL(u32_ExpectedBufferSize, u32_RebuiltBufferSize);
+        TEST_ASSERT_EQUAL_MEMORY(
+            &ru8_ExpectedBuffer[0],
+            &ru8_RebuiltBuffer[0],
+            u32_ExpectedBufferSize);
+
+        /* Test the delta is never bigger than the full Event */
+        TEST_ASSERT_TRUE(u32_BufferSize <= u32_ExpectedBufferSize);
+
+        /* Test the base Event has not been modified */
+        TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Base, 0);
+        TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Base->pt_Left, 1);
+        TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Base->pt_Right->pt_Left, 2);
+
+        TEST_SUCCESS(ITC_Event_destroy(&pt_RebuiltEvent));
+        TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    }
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Base));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test serialising a Stamp fails with invalid param */
+void ITC_SerDes_Test_serialiseStampFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Dummy = NULL;
+    uint8_t ru8_Buffer[10];
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStamp(
+            pt_Dummy,
+            &ru8_Buffer[0],
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStamp(
+            NULL,
+            &ru8_Buffer[0],
+            &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStamp(
+            pt_Dummy,
+            NULL,
+            &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+
+    u32_BufferSize = 0;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStamp(
+            pt_Dummy,
+            NULL,
+            &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+}
+
 /* Test serialising a Stamp fails with corrupt stamp */
 void ITC_SerDes_Test_serialiseStampFailWithCorruptStamp(void)
 {
-    ITC_Stamp_t *pt_Stamp;
-    uint8_t ru8_Buffer[10] = { 0 };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_serialiseStamp(
+                pt_Stamp,
+                &ru8_Buffer[0],
+                &u32_BufferSize),
+            /* Different exceptions might be returned depending on the
+             * failure */
+            ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+}
+
+/* Test serialising a Stamp with leaf ID and Event nodes succeeds */
+void ITC_SerDes_Test_serialiseStampWithLeafComponentsSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    uint8_t ru8_ExpectedStampSerialisedData[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Serialise the Stamp */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedStampSerialisedData), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedStampSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedStampSerialisedData));
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising a leaf Stamp fails with insufficent resources */
+void ITC_SerDes_Test_serialiseStampFailWithInsufficentResources(void)
+{
+    ITC_Stamp_t *pt_Stamp = NULL;
+    uint8_t ru8_Buffer[7] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Make the event a parent */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
+
+    /* Test the Event does not fit */
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStamp(
+            pt_Stamp,
+            &ru8_Buffer[0],
+            &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Test the ID and Event do not fit */
+    u32_BufferSize = 4;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStamp(
+            pt_Stamp,
+            &ru8_Buffer[0],
+            &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Serialise the Stamp */
+    u32_BufferSize = ITC_SERDES_STAMP_MIN_BUFFER_LEN - 1;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStamp(
+            pt_Stamp,
+            &ru8_Buffer[0],
+            &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising a Stamp with parent ID and Event nodes succeeds */
+void ITC_SerDes_Test_serialiseStampWithParentComponentsSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp = NULL;
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    uint8_t ru8_Buffer[18] = { 0 };
+#else
+    uint8_t ru8_Buffer[14] = { 0 };
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    uint8_t ru8_ExpectedStampSerialisedData[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        3,
+        ITC_SERDES_PARENT_ID_HEADER,
+        ITC_SERDES_SEED_ID_HEADER,
+        ITC_SERDES_NULL_ID_HEADER,
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+        11,
+#else
+        7,
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 8),
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+#else
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 4),
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* clang-format off */
+    /* Add nodes to the ID component */
+    pt_Stamp->pt_Id->b_IsOwner = false;
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+
+    /* Add nodes to the Event component */
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT64_MAX));
+#else
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT32_MAX));
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
+    /* clang-format on */
+
+    /* Serialise the Stamp */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedStampSerialisedData), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedStampSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedStampSerialisedData));
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test getting the serialised size of a Stamp fails with invalid param */
+void ITC_SerDes_Test_getSerialisedStampSizeFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Stamp = NULL;
+    uint32_t u32_Size;
+
+    TEST_FAILURE(
+        ITC_SerDes_getSerialisedStampSize(NULL, &u32_Size),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_FAILURE(
+        ITC_SerDes_getSerialisedStampSize(pt_Stamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test getting the serialised size of a Stamp fails with corrupt stamp */
+void ITC_SerDes_Test_getSerialisedStampSizeFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    uint32_t u32_Size;
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_getSerialisedStampSize(pt_Stamp, &u32_Size),
+            /* Different exceptions might be returned depending on the
+             * failure */
+            ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+}
+
+/* Test getting the serialised size of a Stamp succeeds */
+void ITC_SerDes_Test_getSerialisedStampSizeSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp = NULL;
+    uint8_t ru8_Buffer[300] = { 0 };
+    uint32_t u32_BufferSize;
+    uint32_t u32_Size;
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* version + header + (1 + 1) ID + (1 + 1) Event */
+    TEST_SUCCESS(ITC_SerDes_getSerialisedStampSize(pt_Stamp, &u32_Size));
+    TEST_ASSERT_EQUAL(6, u32_Size);
+
+    /* Grow the Event until its component length needs 2 bytes.
+     * Each level adds a `0` leaf and a node with a 4 byte counter */
+    for (uint32_t u32_I = 0; u32_I < 43; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(
+                &pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 0));
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(
+                &pt_Stamp->pt_Event->pt_Right,
+                pt_Stamp->pt_Event,
+                0x01000000U));
+        pt_Stamp->pt_Event = pt_Stamp->pt_Event->pt_Right;
+    }
+
+    /* Walk back up to the root */
+    while (pt_Stamp->pt_Event->pt_Parent)
+    {
+        pt_Stamp->pt_Event = pt_Stamp->pt_Event->pt_Parent;
+    }
+
+    /* version + header + (1 + 1) ID + (2 + 1 + 43 * (1 + 5)) Event */
+    TEST_SUCCESS(ITC_SerDes_getSerialisedStampSize(pt_Stamp, &u32_Size));
+    TEST_ASSERT_EQUAL(1 + 1 + 2 + 2 + 1 + (43 * 6), u32_Size);
+    TEST_ASSERT_TRUE(u32_Size <= sizeof(ru8_Buffer));
+
+    /* Test the size is exactly what serialising needs */
+    u32_BufferSize = u32_Size - 1;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStamp(
+            pt_Stamp,
+            &ru8_Buffer[0],
+            &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    u32_BufferSize = u32_Size;
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(u32_Size, u32_BufferSize);
+    TEST_ASSERT_EQUAL(ITC_SERDES_CREATE_STAMP_HEADER(1, 2), ru8_Buffer[1]);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising a Stamp to string fails with invalid param */
+void ITC_SerDes_Test_serialiseStampToStringFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Dummy = NULL;
+    char rc_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampToString(
+            pt_Dummy,
+            &rc_Buffer[0],
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampToString(
+            NULL,
+            &rc_Buffer[0],
+            &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampToString(
+            pt_Dummy,
+            NULL,
+            &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+
+    u32_BufferSize = 0;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampToString(
+            pt_Dummy,
+            rc_Buffer,
+            &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test serialising a Stamp to string fails with corrupt Stamp */
+void ITC_SerDes_Test_serialiseStampToStringFailWithCorruptStamp(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp;
+    char rc_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_serialiseStampToString(
+                pt_Stamp,
+                &rc_Buffer[0],
+                &u32_BufferSize),
+            /* Different exceptions might be returned depending on the
+             * failure */
+            ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test serialising a Stamp with leaf ID and Event to string succeeds */
+void ITC_SerDes_Test_serialiseStampToStringWithLeafIdAndEventSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+    char rc_Buffer[8];
+    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+
+    const char *z_ExpectedNewStampSerialisedData = "{1; 0}";
+    const char *z_ExpectedBiggerStampSerialisedData = "{1; 12}";
+
+    /* Init to a random value */
+    memset(&rc_Buffer[0], 0x55, sizeof(rc_Buffer));
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Serialise the Stamp to string */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampToString(
+            pt_Stamp,
+            &rc_Buffer[0],
+            &u32_BufferSize));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(
+        strlen(z_ExpectedNewStampSerialisedData) + 1, u32_BufferSize);
+    TEST_ASSERT_EQUAL_STRING_LEN(
+        z_ExpectedNewStampSerialisedData,
+        &rc_Buffer[0],
+        strlen(z_ExpectedNewStampSerialisedData) + 1);
+
+    /* Test the buffer len hasn't been exceeded */
+    TEST_ASSERT_EQUAL_CHAR(0x55, rc_Buffer[7]);
+
+    /* Make the Event component bigger */
+    pt_Stamp->pt_Event->t_Count = 12;
+
+    /* Reset the buffer size */
+    u32_BufferSize = sizeof(rc_Buffer);
+
+    /* Serialise the Stamp to string */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampToString(
+            pt_Stamp,
+            &rc_Buffer[0],
+            &u32_BufferSize));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(
+        strlen(z_ExpectedBiggerStampSerialisedData) + 1, u32_BufferSize);
+    TEST_ASSERT_EQUAL_STRING_LEN(
+        z_ExpectedBiggerStampSerialisedData,
+        &rc_Buffer[0],
+        strlen(z_ExpectedBiggerStampSerialisedData) + 1);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test serialising a Stamp to string fails with insufficent resources */
+void ITC_SerDes_Test_serialiseStampToStringFailWithInsufficentResources(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+    char rc_Buffer[ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN];
+    uint32_t u32_BufferSize;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Set the last byte to a random value */
+    rc_Buffer[ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN - 1] = 0x55;
+
+    /* The min len requires just a NULL termination byte, but the overall
+     * status is still insufficent resources, as there was no space to serialise
+     * the Stamp */
+    u32_BufferSize = sizeof(rc_Buffer);
+    /* Serialise the Stamp to string */
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampToString(
+            pt_Stamp,
+            &rc_Buffer[0],
+            &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Test the buffer was NULL terminated */
+    TEST_ASSERT_EQUAL_CHAR(
+        '\0',
+        rc_Buffer[ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN - 1]);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test serialising a Stamp with parent components to string succeeds */
+void ITC_SerDes_Test_serialiseStampToStringWithParentComponentsSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    char rc_Buffer[39];
+#else
+    char rc_Buffer[29];
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    const char *z_ExpectedStampSerialisedData = "{(1, 0); (0, 18446744073709551615, 0)}";
+#else
+    const char *z_ExpectedStampSerialisedData = "{(1, 0); (0, 4294967295, 0)}";
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+
+    /* Init to a random value */
+    memset(&rc_Buffer[0], 0x55, sizeof(rc_Buffer));
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* clang-format off */
+    /* Add nodes to the ID component */
+    pt_Stamp->pt_Id->b_IsOwner = false;
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+
+    /* Add nodes to the Event component */
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT64_MAX));
+#else
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT32_MAX));
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
+    /* clang-format on */
+
+    /* Serialise the Stamp to string */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampToString(
+            pt_Stamp,
+            &rc_Buffer[0],
+            &u32_BufferSize));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(strlen(z_ExpectedStampSerialisedData) + 1, u32_BufferSize);
+    TEST_ASSERT_EQUAL_STRING_LEN(
+        &z_ExpectedStampSerialisedData[0],
+        &rc_Buffer[0],
+        strlen(z_ExpectedStampSerialisedData) + 1);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test serialising a Stamp with parent components to string fails with
+ * insufficent resources */
+void ITC_SerDes_Test_serialiseStampToStringWithParentComponentsFailWithInsufficentResources(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    char rc_Buffer[38];
+#else
+    char rc_Buffer[28];
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    const char *z_ExpectedStampSerialisedData = "{(1, 0); (0, 18446744073709551615, 0)}";
+#else
+    const char *z_ExpectedStampSerialisedData = "{(1, 0); (0, 4294967295, 0)}";
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* clang-format off */
+    /* Add nodes to the ID component */
+    pt_Stamp->pt_Id->b_IsOwner = false;
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+
+    /* Add nodes to the Event component */
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT64_MAX));
+#else
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT32_MAX));
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
+    /* clang-format on */
+
+    for (uint32_t u32_I = ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN;
+         u32_I <= strlen(z_ExpectedStampSerialisedData);
+         u32_I++)
+    {
+        /* Init to a random value */
+        memset(&rc_Buffer[0], 0x55, sizeof(rc_Buffer));
+
+        u32_BufferSize = u32_I;
+        /* Serialise the Stamp to string */
+        TEST_FAILURE(
+            ITC_SerDes_serialiseStampToString(
+                pt_Stamp,
+                &rc_Buffer[0],
+                &u32_BufferSize),
+            ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+        /* Test the string is NULL terminated and the length was not exceeded */
+        TEST_ASSERT_LESS_OR_EQUAL(u32_I - 1, strnlen(&rc_Buffer[0], u32_I));
+        for (uint32_t u32_J = u32_I; u32_J < sizeof(rc_Buffer); u32_J++)
+        {
+            TEST_ASSERT_EQUAL_CHAR(0x55, rc_Buffer[u32_J]);
+        }
+
+        /* Test the partial output is what is expected */
+        TEST_ASSERT_EQUAL_STRING_LEN(
+            z_ExpectedStampSerialisedData,
+            &rc_Buffer[0],
+            strnlen(&rc_Buffer[0], u32_I));
+    }
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test serialising Event counters of every length to string succeeds */
+void ITC_SerDes_Test_serialiseEventToStringCounterDigitsSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Event_t *pt_Event = NULL;
+    char rc_Buffer[ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN + 1];
+    uint32_t u32_BufferSize;
+    ITC_Event_Counter_t t_Count = 1;
+    char rc_Expected[ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN + 1] = { '0' };
+
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    const char *z_ExpectedMaxSerialisedData = "18446744073709551615";
+#else
+    const char *z_ExpectedMaxSerialisedData = "4294967295";
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    /* Test all powers of 10 and the numbers right before them */
+    for (uint32_t u32_I = 1;
+         u32_I < ITC_SER_TO_STR_EVENT_COUNTER_MAX_LEN;
+         u32_I++)
+    {
+        t_Count *= 10;
+
+        for (uint32_t u32_J = 0; u32_J < u32_I; u32_J++)
+        {
+            rc_Expected[u32_J] = '9';
+        }
+        rc_Expected[u32_I] = '\0';
+
+        pt_Event->t_Count = t_Count - 1;
+        u32_BufferSize = sizeof(rc_Buffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseEventToString(
+                pt_Event,
+                &rc_Buffer[0],
+                &u32_BufferSize));
+        TEST_ASSERT_EQUAL(u32_I + 1, u32_BufferSize);
+        TEST_ASSERT_EQUAL_STRING(&rc_Expected[0], &rc_Buffer[0]);
+
+        rc_Expected[0] = '1';
+        for (uint32_t u32_J = 1; u32_J <= u32_I; u32_J++)
+        {
+            rc_Expected[u32_J] = '0';
+        }
+        rc_Expected[u32_I + 1] = '\0';
+
+        pt_Event->t_Count = t_Count;
+        u32_BufferSize = sizeof(rc_Buffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseEventToString(
+                pt_Event,
+                &rc_Buffer[0],
+                &u32_BufferSize));
+        TEST_ASSERT_EQUAL(u32_I + 2, u32_BufferSize);
+        TEST_ASSERT_EQUAL_STRING(&rc_Expected[0], &rc_Buffer[0]);
+    }
+
+    /* Test the biggest counter */
+    pt_Event->t_Count = 0;
+    pt_Event->t_Count--;
+    u32_BufferSize = sizeof(rc_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEventToString(
+            pt_Event,
+            &rc_Buffer[0],
+            &u32_BufferSize));
+    TEST_ASSERT_EQUAL(strlen(z_ExpectedMaxSerialisedData) + 1, u32_BufferSize);
+    TEST_ASSERT_EQUAL_STRING(z_ExpectedMaxSerialisedData, &rc_Buffer[0]);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test getting the string length of a Stamp fails with invalid param */
+void ITC_SerDes_Test_getStampStringLengthFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+    uint32_t u32_Length;
+
+    TEST_FAILURE(
+        ITC_SerDes_getStampStringLength(NULL, &u32_Length),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_FAILURE(
+        ITC_SerDes_getStampStringLength(pt_Stamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test getting the string length of a Stamp succeeds */
+void ITC_SerDes_Test_getStampStringLengthSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+    char rc_Buffer[256];
+    uint32_t u32_BufferSize;
+    uint32_t u32_Length;
+
+    /* Test a leaf Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_SerDes_getStampStringLength(pt_Stamp, &u32_Length));
+    TEST_ASSERT_EQUAL(strlen("{1; 0}") + 1, u32_Length);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    newStringTestStamp(&pt_Stamp);
+
+    TEST_SUCCESS(ITC_SerDes_getStampStringLength(pt_Stamp, &u32_Length));
+
+    /* Test the string fits a buffer of exactly that length */
+    u32_BufferSize = u32_Length;
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampToString(
+            pt_Stamp,
+            &rc_Buffer[0],
+            &u32_BufferSize));
+    TEST_ASSERT_EQUAL(u32_Length, u32_BufferSize);
+    TEST_ASSERT_EQUAL(strlen(&rc_Buffer[0]) + 1, u32_Length);
+
+    /* Test the string does not fit any shorter buffer */
+    u32_BufferSize = u32_Length - 1;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampToString(
+            pt_Stamp,
+            &rc_Buffer[0],
+            &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test writing a Stamp string fails with invalid param */
+void ITC_SerDes_Test_writeStampStringFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_SerDes_Test_StringWriterContext_t t_Context = { 0 };
+
+    TEST_FAILURE(
+        ITC_SerDes_writeStampString(NULL, &collectStringChunk, &t_Context),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_FAILURE(
+        ITC_SerDes_writeStampString(pt_Stamp, NULL, &t_Context),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    /* Test the writer was never called */
+    TEST_ASSERT_EQUAL(0, t_Context.u32_Calls);
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test writing a Stamp string succeeds */
+void ITC_SerDes_Test_writeStampStringSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_SerDes_Test_StringWriterContext_t t_Context = { 0 };
+    char rc_Buffer[256];
+    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+
+    newStringTestStamp(&pt_Stamp);
+
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampToString(
+            pt_Stamp,
+            &rc_Buffer[0],
+            &u32_BufferSize));
+
+    TEST_SUCCESS(
+        ITC_SerDes_writeStampString(
+            pt_Stamp, &collectStringChunk, &t_Context));
+
+    /* Test the written string is the same, minus the NULL termination byte */
+    TEST_ASSERT_EQUAL(u32_BufferSize - 1, t_Context.u32_Length);
+    TEST_ASSERT_EQUAL_STRING_LEN(
+        &rc_Buffer[0], &t_Context.rc_Buffer[0], t_Context.u32_Length);
+
+    /* Test the string was written in more than one chunk */
+    TEST_ASSERT_GREATER_OR_EQUAL(2, t_Context.u32_Calls);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test writing a Stamp string fails if the writer fails */
+void ITC_SerDes_Test_writeStampStringFailWithWriterFailure(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_SerDes_Test_StringWriterContext_t t_Context = { 0 };
+    uint32_t u32_Calls;
+
+    newStringTestStamp(&pt_Stamp);
+
+    /* Count the writer calls */
+    TEST_SUCCESS(
+        ITC_SerDes_writeStampString(
+            pt_Stamp, &collectStringChunk, &t_Context));
+    u32_Calls = t_Context.u32_Calls;
+
+    for (uint32_t u32_I = 1; u32_I <= u32_Calls; u32_I++)
+    {
+        memset(&t_Context, 0, sizeof(t_Context));
+        t_Context.u32_FailAtCall = u32_I;
+
+        TEST_FAILURE(
+            ITC_SerDes_writeStampString(
+                pt_Stamp, &collectStringChunk, &t_Context),
+            ITC_STATUS_FAILURE);
+
+        /* Test the writer is not called again after failing */
+        TEST_ASSERT_EQUAL(u32_I, t_Context.u32_Calls);
+    }
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test getting the string length of and writing the string of an Id and an
+ * Event succeeds */
+void ITC_SerDes_Test_writeIdAndEventStringSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API && ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_SerDes_Test_StringWriterContext_t t_Context = { 0 };
+    char rc_Buffer[256];
+    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+    uint32_t u32_Length;
+
+    newStringTestStamp(&pt_Stamp);
+
+    /* Test the Id */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseIdToString(
+            pt_Stamp->pt_Id,
+            &rc_Buffer[0],
+            &u32_BufferSize));
+    TEST_SUCCESS(ITC_SerDes_getIdStringLength(pt_Stamp->pt_Id, &u32_Length));
+    TEST_ASSERT_EQUAL(u32_BufferSize, u32_Length);
+    TEST_SUCCESS(
+        ITC_SerDes_writeIdString(
+            pt_Stamp->pt_Id, &collectStringChunk, &t_Context));
+    TEST_ASSERT_EQUAL(u32_BufferSize - 1, t_Context.u32_Length);
+    TEST_ASSERT_EQUAL_STRING_LEN(
+        &rc_Buffer[0], &t_Context.rc_Buffer[0], t_Context.u32_Length);
+
+    /* Test the Event */
+    memset(&t_Context, 0, sizeof(t_Context));
+    u32_BufferSize = sizeof(rc_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEventToString(
+            pt_Stamp->pt_Event,
+            &rc_Buffer[0],
+            &u32_BufferSize));
+    TEST_SUCCESS(
+        ITC_SerDes_getEventStringLength(pt_Stamp->pt_Event, &u32_Length));
+    TEST_ASSERT_EQUAL(u32_BufferSize, u32_Length);
+    TEST_SUCCESS(
+        ITC_SerDes_writeEventString(
+            pt_Stamp->pt_Event, &collectStringChunk, &t_Context));
+    TEST_ASSERT_EQUAL(u32_BufferSize - 1, t_Context.u32_Length);
+    TEST_ASSERT_EQUAL_STRING_LEN(
+        &rc_Buffer[0], &t_Context.rc_Buffer[0], t_Context.u32_Length);
+
+    /* Test invalid params */
+    TEST_FAILURE(
+        ITC_SerDes_getIdStringLength(NULL, &u32_Length),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getEventStringLength(pt_Stamp->pt_Event, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_writeIdString(pt_Stamp->pt_Id, NULL, &t_Context),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_writeEventString(NULL, &collectStringChunk, &t_Context),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE(
+        "Serialise to string API or Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API && ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test deserialising a Stamp fails with invalid param */
+void ITC_SerDes_Test_deserialiseStampFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Dummy = NULL;
+    uint8_t ru8_Buffer[ITC_SERDES_STAMP_MIN_BUFFER_LEN] = { 0 };
+
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            NULL,
+            sizeof(ru8_Buffer),
+            &pt_Dummy),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0],
+            0,
+            &pt_Dummy),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0],
+            ITC_SERDES_STAMP_MIN_BUFFER_LEN - 1,
+            &pt_Dummy),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test deserialising a Stamp fails with corrupt Stamp */
+void ITC_SerDes_Test_deserialiseStampFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    const uint8_t *pu8_Buffer = NULL;
+    uint32_t u32_BufferSize = 0;
+
+    /* Test different invalid serialised Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidSerialisedStampTableSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidSerialisedStampConstructorTable[u32_I](
+            &pu8_Buffer, &u32_BufferSize);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_deserialiseStamp(
+                pu8_Buffer,
+                u32_BufferSize,
+                &pt_Stamp),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+    }
+}
+
+/* Test deserialising a Stamp fails with unsupported ID component length length
+ * size */
+void ITC_SerDes_Test_deserialiseStampFailWithUnsupportedIdLengthLengthSize(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(sizeof(uint32_t) + 1, 1),
+        1,
+        1,
+        1,
+        1,
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0],
+            u32_BufferSize,
+            &pt_Stamp),
+        /* There is no special exception as a length length size of more than
+         * the size of sizeof(uint32_t) is most likely user error */
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test deserialising a Stamp fails with unsupported Event component length length
+ * size */
+void ITC_SerDes_Test_deserialiseStampFailWithUnsupportedEventLengthLengthSize(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, sizeof(uint32_t) + 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        1,
+        1,
+        1,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0],
+            u32_BufferSize,
+            &pt_Stamp),
+        /* There is no special exception as a length length size of more than
+         * the size of sizeof(uint32_t) is most likely user error */
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test deserialising a Stamp with incompatible lib version */
+void ITC_SerDes_Test_deserialiseStampFailWithIncompatibleLibVersion(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR + 1, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0],
+            u32_BufferSize,
+            &pt_Stamp),
+        ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION);
+}
+
+/* Test deserialising a Stamp from 0.x.x lib versions succeeds */
+void ITC_SerDes_Test_deserialiseStampFrom0XXLibVersionsSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[] = {
+        0, /* Lib version 0.X.X */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Test deserialising a leaf Stamp */
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseStamp(&ru8_Buffer[0], u32_BufferSize, &pt_Stamp));
+
+    /* Test this is a Stamp with a leaf seed ID and leaf 0 Event counter */
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test deserialising a stamp with leaf ID and Event components suceeds */
+void ITC_SerDes_Test_deserialiseLeafComponentsStampSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Test deserialising a leaf Stamp */
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseStamp(&ru8_Buffer[0], u32_BufferSize, &pt_Stamp));
+
+    /* Test this is a Stamp with a leaf seed ID and leaf 0 Event counter */
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test deserialising a parent Stamp suceeds */
+void ITC_SerDes_Test_deserialiseParentStampSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    /* Serialised stamp with:
+     * - (0, ((1, 0), 1)) ID
+     * - (0, 1, (0, (4242, 0, UINT32_MAX/UINT64_MAX), 0)) Event */
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        7,
+        ITC_SERDES_PARENT_ID_HEADER,
+        ITC_SERDES_NULL_ID_HEADER,
+        ITC_SERDES_PARENT_ID_HEADER,
+        ITC_SERDES_PARENT_ID_HEADER,
+        ITC_SERDES_SEED_ID_HEADER,
+        ITC_SERDES_NULL_ID_HEADER,
+        ITC_SERDES_SEED_ID_HEADER,
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+        18,
+#else
+        14,
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 2),
+        (4242U >> 8U) & 0xFFU,
+        4242U & 0xFFU,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 8),
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+#else
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 4),
+        0xFFU,
+        0xFFU,
+        0xFFU,
+        0xFFU,
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Test deserialising the Stamp */
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseStamp(&ru8_Buffer[0], u32_BufferSize, &pt_Stamp));
+
+    /* clang-format off */
+    /* Test this is a (0, ((1, 0), 1)) ID */
+    TEST_ITC_ID_IS_NULL_ID(pt_Stamp->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id->pt_Right->pt_Right);
+    /* Test this is a (0, 1, (0, (4242, 0, UINT32_MAX/UINT64_MAX), 0)) Event */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left, 4242);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Left, 0);
+#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right, UINT64_MAX);
+#else
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right, UINT32_MAX);
+#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Right, 0);
+    /* clang-format on */
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test comparing serialised Stamps fails with invalid param */
+void ITC_SerDes_Test_compareSerialisedStampsFailInvalidParam(void)
+{
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+
+    TEST_FAILURE(
+        ITC_SerDes_compareSerialisedStamps(
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_compareSerialisedStamps(
+            NULL,
+            sizeof(ru8_Buffer),
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_compareSerialisedStamps(
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            NULL,
+            sizeof(ru8_Buffer),
+            &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_compareSerialisedStamps(
+            &ru8_Buffer[0],
+            0,
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_compareSerialisedStamps(
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            &ru8_Buffer[0],
+            ITC_SERDES_STAMP_MIN_BUFFER_LEN - 1,
+            &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test comparing serialised Stamps fails with corrupt Stamp */
+void ITC_SerDes_Test_compareSerialisedStampsFailWithCorruptStamp(void)
+{
+    ITC_Stamp_Comparison_t t_Result;
+    const uint8_t *pu8_Buffer = NULL;
+    uint32_t u32_BufferSize = 0;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+
+    /* Test different invalid serialised Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidSerialisedStampTableSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidSerialisedStampConstructorTable[u32_I](
+            &pu8_Buffer, &u32_BufferSize);
+
+        /* Test for the failure on both sides of the comparison */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_compareSerialisedStamps(
+                pu8_Buffer,
+                u32_BufferSize,
+                &ru8_Buffer[0],
+                sizeof(ru8_Buffer),
+                &t_Result),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_compareSerialisedStamps(
+                &ru8_Buffer[0],
+                sizeof(ru8_Buffer),
+                pu8_Buffer,
+                u32_BufferSize,
+                &t_Result),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+    }
+}
+
+/* Test comparing serialised Stamps fails with a corrupt component */
+void ITC_SerDes_Test_compareSerialisedStampsFailWithCorruptComponent(void)
+{
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer1[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+    /* Not normalised (1, 1) ID */
+    uint8_t ru8_Buffer2[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        3,
+        ITC_SERDES_PARENT_ID_HEADER,
+        ITC_SERDES_SEED_ID_HEADER,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+    /* Not normalised (0, 1, 1) Event */
+    uint8_t ru8_Buffer3[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        5,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+    };
+
+    TEST_FAILURE(
+        ITC_SerDes_compareSerialisedStamps(
+            &ru8_Buffer1[0],
+            sizeof(ru8_Buffer1),
+            &ru8_Buffer2[0],
+            sizeof(ru8_Buffer2),
+            &t_Result),
+        ITC_STATUS_CORRUPT_ID);
+    TEST_FAILURE(
+        ITC_SerDes_compareSerialisedStamps(
+            &ru8_Buffer3[0],
+            sizeof(ru8_Buffer3),
+            &ru8_Buffer1[0],
+            sizeof(ru8_Buffer1),
+            &t_Result),
+        ITC_STATUS_CORRUPT_EVENT);
+}
+
+/* Test comparing serialised Stamps matches comparing the deserialised Stamps */
+void ITC_SerDes_Test_compareSerialisedStampsSuccessful(void)
+{
+    ITC_Stamp_t *rpt_Stamps[6] = { NULL };
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_Comparison_t t_Result;
+    ITC_Stamp_Comparison_t t_ExpectedResult;
+    uint8_t rru8_Buffers[ARRAY_COUNT(rpt_Stamps)][64];
+    uint32_t ru32_BufferSizes[ARRAY_COUNT(rpt_Stamps)];
+
+    /* Create Stamps with different ID and Event trees */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[1], &rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[3]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[3]));
+    TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[2], &rpt_Stamps[4]));
+    TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[3], &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[4], &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[4]));
+    TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[0], &rpt_Stamps[5]));
+    TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[1], &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[5], &pt_Stamp));
+
+    /* Serialise the Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        ru32_BufferSizes[u32_I] = sizeof(rru8_Buffers[u32_I]);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStamp(
+                rpt_Stamps[u32_I],
+                &rru8_Buffers[u32_I][0],
+                &ru32_BufferSizes[u32_I]));
+    }
+
+    /* Test every pair of Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(rpt_Stamps); u32_J++)
+        {
+            TEST_SUCCESS(
+                ITC_Stamp_compare(
+                    rpt_Stamps[u32_I], rpt_Stamps[u32_J], &t_ExpectedResult));
+            TEST_SUCCESS(
+                ITC_SerDes_compareSerialisedStamps(
+                    &rru8_Buffers[u32_I][0],
+                    ru32_BufferSizes[u32_I],
+                    &rru8_Buffers[u32_J][0],
+                    ru32_BufferSizes[u32_J],
+                    &t_Result));
+            TEST_ASSERT_EQUAL(t_ExpectedResult, t_Result);
+        }
+    }
+
+    /* Sanity check a few of the results */
+    TEST_SUCCESS(
+        ITC_SerDes_compareSerialisedStamps(
+            &rru8_Buffers[0][0],
+            ru32_BufferSizes[0],
+            &rru8_Buffers[0][0],
+            ru32_BufferSizes[0],
+            &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(
+        ITC_SerDes_compareSerialisedStamps(
+            &rru8_Buffers[0][0],
+            ru32_BufferSizes[0],
+            &rru8_Buffers[2][0],
+            ru32_BufferSizes[2],
+            &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+    TEST_SUCCESS(
+        ITC_SerDes_compareSerialisedStamps(
+            &rru8_Buffers[2][0],
+            ru32_BufferSizes[2],
+            &rru8_Buffers[4][0],
+            ru32_BufferSizes[4],
+            &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Result);
+    TEST_SUCCESS(
+        ITC_SerDes_compareSerialisedStamps(
+            &rru8_Buffers[5][0],
+            ru32_BufferSizes[5],
+            &rru8_Buffers[1][0],
+            ru32_BufferSizes[1],
+            &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+
+    /* Destroy the Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+}
+
+/* Test serialising a batch of Stamps fails with invalid param */
+void ITC_SerDes_Test_serialiseStampBatchFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    const ITC_Stamp_t *rpt_Stamps[2];
+    uint8_t ru8_Buffer[32];
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    rpt_Stamps[0] = pt_Stamp;
+    rpt_Stamps[1] = NULL;
+
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampBatch(
+            NULL, 1, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampBatch(
+            &rpt_Stamps[0], 1, NULL, &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampBatch(
+            &rpt_Stamps[0], 1, &ru8_Buffer[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampBatch(
+            &rpt_Stamps[0], 2, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getSerialisedStampBatchSize(NULL, 1, &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getSerialisedStampBatchSize(&rpt_Stamps[0], 1, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getSerialisedStampBatchSize(
+            &rpt_Stamps[0], 2, &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising a batch of Stamps fails with corrupt Stamp */
+void ITC_SerDes_Test_serialiseStampBatchFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_CorruptStamp;
+    const ITC_Stamp_t *rpt_Stamps[2];
+    uint8_t ru8_Buffer[32];
+    uint32_t u32_BufferSize;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    rpt_Stamps[0] = pt_Stamp;
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_CorruptStamp);
+        rpt_Stamps[1] = pt_CorruptStamp;
+
+        /* Test for the failure */
+        u32_BufferSize = sizeof(ru8_Buffer);
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_serialiseStampBatch(
+                &rpt_Stamps[0], 2, &ru8_Buffer[0], &u32_BufferSize),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_getSerialisedStampBatchSize(
+                &rpt_Stamps[0], 2, &u32_BufferSize),
+            ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_CorruptStamp);
+    }
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising a batch of Stamps fails with insufficient resources */
+void ITC_SerDes_Test_serialiseStampBatchFailWithInsufficentResources(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    const ITC_Stamp_t *rpt_Stamps[2];
+    uint8_t ru8_Buffer[32];
+    uint32_t u32_BufferSize;
+    uint32_t u32_Size;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    rpt_Stamps[0] = pt_Stamp;
+    rpt_Stamps[1] = pt_Stamp;
+
+    TEST_SUCCESS(
+        ITC_SerDes_getSerialisedStampBatchSize(&rpt_Stamps[0], 2, &u32_Size));
+
+    /* Test the buffer must fit the whole batch */
+    u32_BufferSize = u32_Size - 1;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampBatch(
+            &rpt_Stamps[0], 2, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_ASSERT_EQUAL(u32_Size - 1, u32_BufferSize);
+
+    /* Test the buffer must fit at least an empty batch */
+    u32_BufferSize = ITC_SERDES_STAMP_BATCH_MIN_BUFFER_LEN - 1;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampBatch(
+            &rpt_Stamps[0], 0, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising a batch of Stamps succeeds */
+void ITC_SerDes_Test_serialiseStampBatchSuccessful(void)
+{
+    ITC_Stamp_t *rpt_Stamps[3] = { NULL };
+    uint8_t ru8_Buffer[64];
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    uint32_t u32_Size;
+    uint8_t ru8_StampBuffer[32];
+    uint32_t u32_StampBufferSize;
+    uint32_t u32_Offset;
+    /* An empty batch */
+    uint8_t ru8_ExpectedEmptyBuffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        1,
+        0,
+    };
+
+    /* Create Stamps with different ID and Event trees */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_newPeek(rpt_Stamps[1], &rpt_Stamps[2]));
+
+    /* Serialise the batch */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampBatch(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0],
+            ARRAY_COUNT(rpt_Stamps),
+            &ru8_Buffer[0],
+            &u32_BufferSize));
+
+    /* Test the size is exact */
+    TEST_SUCCESS(
+        ITC_SerDes_getSerialisedStampBatchSize(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0],
+            ARRAY_COUNT(rpt_Stamps),
+            &u32_Size));
+    TEST_ASSERT_EQUAL(u32_Size, u32_BufferSize);
+
+    /* Test the batch header */
+    TEST_ASSERT_EQUAL(ITC_VERSION_MAJOR, ru8_Buffer[0]);
+    TEST_ASSERT_EQUAL(1, ru8_Buffer[1]);
+    TEST_ASSERT_EQUAL(ARRAY_COUNT(rpt_Stamps), ru8_Buffer[2]);
+
+    /* Test each Stamp is serialised as on its own, minus the version */
+    u32_Offset = ITC_SERDES_STAMP_BATCH_MIN_BUFFER_LEN;
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        u32_StampBufferSize = sizeof(ru8_StampBuffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStamp(
+                rpt_Stamps[u32_I], &ru8_StampBuffer[0], &u32_StampBufferSize));
+
+        TEST_ASSERT_EQUAL_MEMORY(
+            &ru8_StampBuffer[ITC_VERSION_MAJOR_LEN],
+            &ru8_Buffer[u32_Offset],
+            u32_StampBufferSize - ITC_VERSION_MAJOR_LEN);
+
+        u32_Offset += u32_StampBufferSize - (uint32_t)ITC_VERSION_MAJOR_LEN;
+    }
+    TEST_ASSERT_EQUAL(u32_BufferSize, u32_Offset);
+
+    /* Test serialising an empty batch */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampBatch(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0],
+            0,
+            &ru8_Buffer[0],
+            &u32_BufferSize));
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedEmptyBuffer), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedEmptyBuffer[0], &ru8_Buffer[0], u32_BufferSize);
+
+    /* Destroy the Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+}
+
+/* Test deserialising a batch of Stamps fails with invalid param */
+void ITC_SerDes_Test_deserialiseStampBatchFailInvalidParam(void)
+{
+    ITC_Stamp_t *rpt_Stamps[1];
+    uint32_t u32_StampCount = ARRAY_COUNT(rpt_Stamps);
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        1,
+        0,
+    };
+
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStampBatch(
+            NULL, sizeof(ru8_Buffer), &rpt_Stamps[0], &u32_StampCount),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStampBatch(
+            &ru8_Buffer[0], sizeof(ru8_Buffer), NULL, &u32_StampCount),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStampBatch(
+            &ru8_Buffer[0], sizeof(ru8_Buffer), &rpt_Stamps[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStampBatch(
+            &ru8_Buffer[0],
+            ITC_SERDES_STAMP_BATCH_MIN_BUFFER_LEN - 1,
+            &rpt_Stamps[0],
+            &u32_StampCount),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test deserialising a batch of Stamps fails with corrupt Stamp */
+void ITC_SerDes_Test_deserialiseStampBatchFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *rpt_Stamps[2];
+    uint32_t u32_StampCount;
+    /* Reserved bits set in the batch header */
+    uint8_t ru8_Buffer1[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        0x09,
+        0,
+    };
+    /* The Stamp count does not fit in an `uint32_t` */
+    uint8_t ru8_Buffer2[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        5,
+        0,
+        0,
+        0,
+        0,
+        1,
+    };
+    /* The Stamp count is truncated */
+    uint8_t ru8_Buffer3[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        2,
+        0,
+    };
+    /* A truncated second Stamp */
+    uint8_t ru8_Buffer4[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        1,
+        2,
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+    };
+    /* Trailing data after the last Stamp */
+    uint8_t ru8_Buffer5[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        1,
+        1,
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    /* Serialised Stamps with the version field still in place */
+    uint8_t ru8_Buffer6[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        1,
+        1,
+        ITC_VERSION_MAJOR,
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    /* Not normalised (0, 1, 1) Event in the second Stamp */
+    uint8_t ru8_Buffer7[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        1,
+        2,
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        5,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+    };
+    const uint8_t *rpu8_Buffers[] = {
+        &ru8_Buffer1[0],
+        &ru8_Buffer2[0],
+        &ru8_Buffer3[0],
+        &ru8_Buffer4[0],
+        &ru8_Buffer5[0],
+        &ru8_Buffer6[0],
+        &ru8_Buffer7[0],
+    };
+    const uint32_t ru32_BufferSizes[] = {
+        sizeof(ru8_Buffer1),
+        sizeof(ru8_Buffer2),
+        sizeof(ru8_Buffer3),
+        sizeof(ru8_Buffer4),
+        sizeof(ru8_Buffer5),
+        sizeof(ru8_Buffer6),
+        sizeof(ru8_Buffer7),
+    };
+    const ITC_Status_t rt_ExpectedStatuses[] = {
+        ITC_STATUS_CORRUPT_STAMP,
+        ITC_STATUS_CORRUPT_STAMP,
+        ITC_STATUS_CORRUPT_STAMP,
+        ITC_STATUS_CORRUPT_STAMP,
+        ITC_STATUS_CORRUPT_STAMP,
+        ITC_STATUS_CORRUPT_STAMP,
+        ITC_STATUS_CORRUPT_EVENT,
+    };
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpu8_Buffers); u32_I++)
+    {
+        /* Any Stamps deserialised before the failure must be released */
+        u32_StampCount = ARRAY_COUNT(rpt_Stamps);
+        TEST_FAILURE(
+            ITC_SerDes_deserialiseStampBatch(
+                rpu8_Buffers[u32_I],
+                ru32_BufferSizes[u32_I],
+                &rpt_Stamps[0],
+                &u32_StampCount),
+            rt_ExpectedStatuses[u32_I]);
+    }
+}
+
+/* Test deserialising a batch of Stamps fails with incompatible lib version */
+void ITC_SerDes_Test_deserialiseStampBatchFailWithIncompatibleLibVersion(void)
+{
+    ITC_Stamp_t *rpt_Stamps[1];
+    uint32_t u32_StampCount = ARRAY_COUNT(rpt_Stamps);
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR + 1,
+        1,
+        1,
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStampBatch(
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            &rpt_Stamps[0],
+            &u32_StampCount),
+        ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION);
+}
+
+/* Test deserialising a batch of Stamps fails with insufficient resources */
+void ITC_SerDes_Test_deserialiseStampBatchFailWithInsufficentResources(void)
+{
+    ITC_Stamp_t *rpt_Stamps[1];
+    uint32_t u32_StampCount = ARRAY_COUNT(rpt_Stamps);
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        1,
+        2,
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_NULL_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStampBatch(
+            &ru8_Buffer[0],
+            sizeof(ru8_Buffer),
+            &rpt_Stamps[0],
+            &u32_StampCount),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Test the required array size is returned */
+    TEST_ASSERT_EQUAL(2, u32_StampCount);
+}
+
+/* Test deserialising a batch of Stamps succeeds */
+void ITC_SerDes_Test_deserialiseStampBatchSuccessful(void)
+{
+    ITC_Stamp_t *rpt_Stamps[4] = { NULL };
+    ITC_Stamp_t *rpt_DeserialisedStamps[ARRAY_COUNT(rpt_Stamps) + 1];
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[64];
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    uint32_t u32_StampCount = ARRAY_COUNT(rpt_DeserialisedStamps);
+    uint8_t ru8_SecondBuffer[64];
+    uint32_t u32_SecondBufferSize = sizeof(ru8_SecondBuffer);
+    uint8_t ru8_EmptyBuffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        1,
+        0,
+    };
+
+    /* Create Stamps with different ID and Event trees */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[1], &rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_newPeek(rpt_Stamps[2], &rpt_Stamps[3]));
+
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampBatch(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0],
+            ARRAY_COUNT(rpt_Stamps),
+            &ru8_Buffer[0],
+            &u32_BufferSize));
+
+    /* Deserialise the batch into a bigger array */
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseStampBatch(
+            &ru8_Buffer[0],
+            u32_BufferSize,
+            &rpt_DeserialisedStamps[0],
+            &u32_StampCount));
+    TEST_ASSERT_EQUAL(ARRAY_COUNT(rpt_Stamps), u32_StampCount);
+
+    /* Test the Stamps survived the round trip */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Stamp_compare(
+                rpt_Stamps[u32_I], rpt_DeserialisedStamps[u32_I], &t_Result));
+        TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    }
+
+    /* Test the IDs survived as well, by serialising the batch again */
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampBatch(
+            (const ITC_Stamp_t *const *)&rpt_DeserialisedStamps[0],
+            u32_StampCount,
+            &ru8_SecondBuffer[0],
+            &u32_SecondBufferSize));
+    TEST_ASSERT_EQUAL(u32_BufferSize, u32_SecondBufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_Buffer[0], &ru8_SecondBuffer[0], u32_BufferSize);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_DeserialisedStamps[u32_I]));
+    }
+
+    /* Test deserialising an empty batch */
+    u32_StampCount = 0;
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseStampBatch(
+            &ru8_EmptyBuffer[0],
+            sizeof(ru8_EmptyBuffer),
+            &rpt_DeserialisedStamps[0],
+            &u32_StampCount));
+    TEST_ASSERT_EQUAL(0, u32_StampCount);
+
+    /* Destroy the Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+}
+
+/* Test initialising a Stamp view fails with invalid param */
+void ITC_SerDes_Test_initStampViewFailInvalidParam(void)
+{
+    ITC_SerDes_StampView_t t_View;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+
+    TEST_FAILURE(
+        ITC_SerDes_initStampView(&ru8_Buffer[0], sizeof(ru8_Buffer), NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_initStampView(NULL, sizeof(ru8_Buffer), &t_View),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_initStampView(&ru8_Buffer[0], 0, &t_View),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_initStampView(
+            &ru8_Buffer[0], ITC_SERDES_STAMP_MIN_BUFFER_LEN - 1, &t_View),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test initialising a Stamp view fails with corrupt Stamp */
+void ITC_SerDes_Test_initStampViewFailWithCorruptStamp(void)
+{
+    ITC_SerDes_StampView_t t_View;
+    const uint8_t *pu8_Buffer = NULL;
+    uint32_t u32_BufferSize = 0;
+    /* Not normalised (1, 1) ID */
+    uint8_t ru8_Buffer1[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        3,
+        ITC_SERDES_PARENT_ID_HEADER,
+        ITC_SERDES_SEED_ID_HEADER,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+    /* Not normalised (0, 1, 1) Event */
+    uint8_t ru8_Buffer2[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        5,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+    };
+
+    /* Test different invalid serialised Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidSerialisedStampTableSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidSerialisedStampConstructorTable[u32_I](
+            &pu8_Buffer, &u32_BufferSize);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_SerDes_initStampView(pu8_Buffer, u32_BufferSize, &t_View),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+    }
+
+    /* Test the components are validated up front */
+    TEST_FAILURE(
+        ITC_SerDes_initStampView(
+            &ru8_Buffer1[0], sizeof(ru8_Buffer1), &t_View),
+        ITC_STATUS_CORRUPT_ID);
+    TEST_FAILURE(
+        ITC_SerDes_initStampView(
+            &ru8_Buffer2[0], sizeof(ru8_Buffer2), &t_View),
+        ITC_STATUS_CORRUPT_EVENT);
+}
+
+/* Test comparing Stamp views fails with invalid param */
+void ITC_SerDes_Test_compareStampViewsFailInvalidParam(void)
+{
+    ITC_SerDes_StampView_t t_View;
+    ITC_SerDes_StampView_t t_EmptyView = { 0 };
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+
+    TEST_SUCCESS(
+        ITC_SerDes_initStampView(&ru8_Buffer[0], sizeof(ru8_Buffer), &t_View));
+
+    TEST_FAILURE(
+        ITC_SerDes_compareStampViews(NULL, &t_View, &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_compareStampViews(&t_View, NULL, &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_compareStampViews(&t_View, &t_View, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_compareStampViews(&t_EmptyView, &t_View, &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test comparing Stamp views matches comparing the deserialised Stamps */
+void ITC_SerDes_Test_compareStampViewsSuccessful(void)
+{
+    ITC_Stamp_t *rpt_Stamps[6] = { NULL };
+    ITC_SerDes_StampView_t rt_Views[ARRAY_COUNT(rpt_Stamps)];
+    ITC_Stamp_Comparison_t t_Result;
+    ITC_Stamp_Comparison_t t_ExpectedResult;
+    uint8_t rru8_Buffers[ARRAY_COUNT(rpt_Stamps)][64];
+    uint32_t u32_BufferSize;
+
+    newStampViewTestStamps(&rpt_Stamps[0]);
+
+    /* Serialise the Stamps and create their views */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        u32_BufferSize = sizeof(rru8_Buffers[u32_I]);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStamp(
+                rpt_Stamps[u32_I], &rru8_Buffers[u32_I][0], &u32_BufferSize));
+        TEST_SUCCESS(
+            ITC_SerDes_initStampView(
+                &rru8_Buffers[u32_I][0], u32_BufferSize, &rt_Views[u32_I]));
+    }
+
+    /* Test every pair of Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(rpt_Stamps); u32_J++)
+        {
+            TEST_SUCCESS(
+                ITC_Stamp_compare(
+                    rpt_Stamps[u32_I], rpt_Stamps[u32_J], &t_ExpectedResult));
+            TEST_SUCCESS(
+                ITC_SerDes_compareStampViews(
+                    &rt_Views[u32_I], &rt_Views[u32_J], &t_Result));
+            TEST_ASSERT_EQUAL(t_ExpectedResult, t_Result);
+        }
+    }
+
+    /* Destroy the Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+}
+
+/* Test getting a Stamp from a Stamp view fails with invalid param */
+void ITC_SerDes_Test_getStampFromViewFailInvalidParam(void)
+{
+    ITC_SerDes_StampView_t t_View;
+    ITC_SerDes_StampView_t t_EmptyView = { 0 };
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+
+    TEST_SUCCESS(
+        ITC_SerDes_initStampView(&ru8_Buffer[0], sizeof(ru8_Buffer), &t_View));
+
+    TEST_FAILURE(
+        ITC_SerDes_getStampFromView(NULL, &pt_Stamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getStampFromView(&t_EmptyView, &pt_Stamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getStampFromView(&t_View, NULL),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test getting a Stamp from a Stamp view succeeds */
+void ITC_SerDes_Test_getStampFromViewSuccessful(void)
+{
+    ITC_Stamp_t *rpt_Stamps[6] = { NULL };
+    ITC_Stamp_t *pt_Stamp;
+    ITC_SerDes_StampView_t t_View;
+    uint8_t ru8_Buffer[64];
+    uint32_t u32_BufferSize;
+    uint8_t ru8_SecondBuffer[64];
+    uint32_t u32_SecondBufferSize;
+
+    newStampViewTestStamps(&rpt_Stamps[0]);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        u32_BufferSize = sizeof(ru8_Buffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStamp(
+                rpt_Stamps[u32_I], &ru8_Buffer[0], &u32_BufferSize));
+        TEST_SUCCESS(
+            ITC_SerDes_initStampView(&ru8_Buffer[0], u32_BufferSize, &t_View));
+
+        /* Promote the view to a Stamp */
+        TEST_SUCCESS(ITC_SerDes_getStampFromView(&t_View, &pt_Stamp));
+
+        /* Test the Stamp serialises back to the same data */
+        u32_SecondBufferSize = sizeof(ru8_SecondBuffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStamp(
+                pt_Stamp, &ru8_SecondBuffer[0], &u32_SecondBufferSize));
+        TEST_ASSERT_EQUAL(u32_BufferSize, u32_SecondBufferSize);
+        TEST_ASSERT_EQUAL_MEMORY(
+            &ru8_Buffer[0], &ru8_SecondBuffer[0], u32_BufferSize);
+
+        /* Test the Stamp is mutable */
+        TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+        /* Destroy the Stamp */
+        TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    }
+
+    /* Destroy the Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+}
+
+/* Test serialising a Stamp view to string fails with invalid param */
+void ITC_SerDes_Test_serialiseStampViewToStringFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_SerDes_StampView_t t_View;
+    ITC_SerDes_StampView_t t_EmptyView = { 0 };
+    char rc_String[16];
+    uint32_t u32_StringSize = sizeof(rc_String);
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        1,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+    };
+
+    TEST_SUCCESS(
+        ITC_SerDes_initStampView(&ru8_Buffer[0], sizeof(ru8_Buffer), &t_View));
+
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampViewToString(
+            NULL, &rc_String[0], &u32_StringSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampViewToString(
+            &t_EmptyView, &rc_String[0], &u32_StringSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampViewToString(
+            &t_View, NULL, &u32_StringSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampViewToString(&t_View, &rc_String[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test serialising a Stamp view to string matches serialising the Stamp */
+void ITC_SerDes_Test_serialiseStampViewToStringSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+    ITC_Stamp_t *rpt_Stamps[6] = { NULL };
+    ITC_SerDes_StampView_t t_View;
+    uint8_t ru8_Buffer[64];
+    uint32_t u32_BufferSize;
+    char rc_ExpectedString[128];
+    uint32_t u32_ExpectedStringSize;
+    char rc_String[128];
+    uint32_t u32_StringSize;
+
+    newStampViewTestStamps(&rpt_Stamps[0]);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        u32_BufferSize = sizeof(ru8_Buffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStamp(
+                rpt_Stamps[u32_I], &ru8_Buffer[0], &u32_BufferSize));
+        TEST_SUCCESS(
+            ITC_SerDes_initStampView(&ru8_Buffer[0], u32_BufferSize, &t_View));
+
+        u32_ExpectedStringSize = sizeof(rc_ExpectedString);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStampToString(
+                rpt_Stamps[u32_I],
+                &rc_ExpectedString[0],
+                &u32_ExpectedStringSize));
+
+        u32_StringSize = sizeof(rc_String);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStampViewToString(
+                &t_View, &rc_String[0], &u32_StringSize));
+
+        TEST_ASSERT_EQUAL(u32_ExpectedStringSize, u32_StringSize);
+        TEST_ASSERT_EQUAL_STRING(&rc_ExpectedString[0], &rc_String[0]);
+
+        /* Test every smaller buffer fails with the same truncated, but
+         * still NULL terminated, string */
+        for (uint32_t u32_J = 1; u32_J < u32_ExpectedStringSize; u32_J++)
+        {
+            u32_StringSize = u32_J;
+            TEST_FAILURE(
+                ITC_SerDes_serialiseStampToString(
+                    rpt_Stamps[u32_I], &rc_ExpectedString[0], &u32_StringSize),
+                ITC_STATUS_INSUFFICIENT_RESOURCES);
+            TEST_FAILURE(
+                ITC_SerDes_serialiseStampViewToString(
+                    &t_View, &rc_String[0], &u32_StringSize),
+                ITC_STATUS_INSUFFICIENT_RESOURCES);
+            TEST_ASSERT_EQUAL_STRING(&rc_ExpectedString[0], &rc_String[0]);
+        }
+    }
+
+    /* Destroy the Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+}
+
+/* Test writing and reading a bit stream succeeds */
+void ITC_SerDes_Test_bitWriterAndReaderSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    uint8_t ru8_Buffer[3] = { 0xFFU, 0xFFU, 0xFFU };
+    ITC_SerDes_Util_BitWriter_t t_Writer = {
+        .pu8_Buffer = &ru8_Buffer[0],
+        .u32_BufferSize = 2,
+        .u32_BitOffset = 0,
+    };
+    ITC_SerDes_Util_BitReader_t t_Reader = {
+        .pu8_Buffer = &ru8_Buffer[0],
+        .u32_BufferSize = 2,
+        .u32_BitOffset = 0,
+    };
+    uint32_t u32_Bits;
+
+    /* Write across the byte boundary */
+    TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0x1U, 2));
+    TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0x1FFU, 9));
+
+    /* Test nothing is written if the buffer is not big enough */
+    TEST_FAILURE(
+        ITC_SerDes_Util_writeBits(&t_Writer, 0x3FU, 6),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_ASSERT_EQUAL(11, t_Writer.u32_BitOffset);
+
+    /* Test the bits are packed MSB first and the buffer beyond the bit
+     * stream is left untouched */
+    TEST_ASSERT_EQUAL(0x7FU, ru8_Buffer[0]);
+    TEST_ASSERT_EQUAL(0xE0U, ru8_Buffer[1]);
+    TEST_ASSERT_EQUAL(0xFFU, ru8_Buffer[2]);
+
+    /* Read the bits back */
+    TEST_SUCCESS(ITC_SerDes_Util_readBits(&t_Reader, &u32_Bits, 2));
+    TEST_ASSERT_EQUAL(0x1U, u32_Bits);
+    TEST_ASSERT_FALSE(ITC_SerDes_Util_isBitReaderAtEnd(&t_Reader));
+    TEST_SUCCESS(ITC_SerDes_Util_readBits(&t_Reader, &u32_Bits, 9));
+    TEST_ASSERT_EQUAL(0x1FFU, u32_Bits);
+
+    /* Only `0` padding is left */
+    TEST_ASSERT_TRUE(ITC_SerDes_Util_isBitReaderAtEnd(&t_Reader));
+
+    /* Test nothing is read past the end of the buffer */
+    TEST_FAILURE(
+        ITC_SerDes_Util_readBits(&t_Reader, &u32_Bits, 6),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_ASSERT_EQUAL(11, t_Reader.u32_BitOffset);
+
+    /* Test non-zero padding is not considered the end of the stream */
+    ru8_Buffer[1] = 0xE1U;
+    TEST_ASSERT_FALSE(ITC_SerDes_Util_isBitReaderAtEnd(&t_Reader));
+
+    /* Test trailing bytes are not considered the end of the stream */
+    ru8_Buffer[1] = 0xE0U;
+    t_Reader.u32_BufferSize = 3;
+    TEST_ASSERT_FALSE(ITC_SerDes_Util_isBitReaderAtEnd(&t_Reader));
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+}
+
+/* Test serialising an ID in the compact format fails with invalid param */
+void ITC_SerDes_Test_serialiseIdCompactFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Id_t *pt_Id = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    ITC_SerDes_Util_BitWriter_t t_Writer = {
+        .pu8_Buffer = &ru8_Buffer[0],
+        .u32_BufferSize = sizeof(ru8_Buffer),
+        .u32_BitOffset = 0,
+    };
+    uint32_t u32_BitCount;
+
+    TEST_FAILURE(
+        ITC_SerDes_Util_serialiseIdCompact(NULL, &t_Writer),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedIdCompactBitCount(NULL, &u32_BitCount),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+    TEST_FAILURE(
+        ITC_SerDes_Util_serialiseIdCompact(pt_Id, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedIdCompactBitCount(pt_Id, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Nothing has been written */
+    TEST_ASSERT_EQUAL(0, t_Writer.u32_BitOffset);
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+}
+
+/* Test serialising an ID in the compact format fails with corrupt ID */
+void ITC_SerDes_Test_serialiseIdCompactFailWithCorruptId(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Id_t *pt_Id;
+    uint8_t ru8_Buffer[10] = { 0 };
+    ITC_SerDes_Util_BitWriter_t t_Writer = {
+        .pu8_Buffer = &ru8_Buffer[0],
+        .u32_BufferSize = sizeof(ru8_Buffer),
+        .u32_BitOffset = 0,
+    };
+
+    /* Test different invalid IDs are handled properly */
+    for (uint32_t u32_I = 0; u32_I < gu32_InvalidIdTablesSize; u32_I++)
+    {
+        /* Construct an invalid ID */
+        gpv_InvalidIdConstructorTable[u32_I](&pt_Id);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_SerDes_Util_serialiseIdCompact(pt_Id, &t_Writer),
+            ITC_STATUS_CORRUPT_ID);
+
+        /* Destroy the ID */
+        gpv_InvalidIdDestructorTable[u32_I](&pt_Id);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+}
+
+/* Test serialising an ID in the compact format succeeds */
+void ITC_SerDes_Test_serialiseIdCompactSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Id_t *pt_Id = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    ITC_SerDes_Util_BitWriter_t t_Writer = {
+        .pu8_Buffer = &ru8_Buffer[0],
+        .u32_BufferSize = 1,
+        .u32_BitOffset = 0,
+    };
+    uint32_t u32_BitCount;
+
+    /* (0, ((1, 0), 1)) ID:
+     * - `1` (0, (...))
+     * - `00` 0
+     * - `1` ((1, 0), 1)
+     * - `1` (1, 0)
+     * - `01` 1
+     * - `00` 0
+     * - `01` 1 */
+    uint8_t ru8_ExpectedIdSerialisedData[] = { 0x9AU, 0x20U };
+
+    /* Create the (0, ((1, 0), 1)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(
+        ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(
+        ITC_TestUtil_newSeedId(
+            &pt_Id->pt_Right->pt_Left->pt_Left, pt_Id->pt_Right->pt_Left));
+    TEST_SUCCESS(
+        ITC_TestUtil_newNullId(
+            &pt_Id->pt_Right->pt_Left->pt_Right, pt_Id->pt_Right->pt_Left));
+    TEST_SUCCESS(
+        ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+
+    /* Test the bit count */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_getSerialisedIdCompactBitCount(pt_Id, &u32_BitCount));
+    TEST_ASSERT_EQUAL(11, u32_BitCount);
+
+    /* Test serialising fails if the buffer is not big enough */
+    TEST_FAILURE(
+        ITC_SerDes_Util_serialiseIdCompact(pt_Id, &t_Writer),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Serialise the ID */
+    t_Writer.u32_BufferSize = sizeof(ru8_Buffer);
+    t_Writer.u32_BitOffset = 0;
+    TEST_SUCCESS(ITC_SerDes_Util_serialiseIdCompact(pt_Id, &t_Writer));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(u32_BitCount, t_Writer.u32_BitOffset);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedIdSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedIdSerialisedData));
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+}
+
+/* Test deserialising an ID in the compact format fails with corrupt ID */
+void ITC_SerDes_Test_deserialiseIdCompactFailWithCorruptId(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Id_t *pt_Id;
+    /* Versioned, compact serialised IDs */
+    uint8_t rru8_Buffers[][3] = {
+        /* Truncated tree - only parent nodes */
+        { ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0xFFU, 0xFFU },
+        /* (0, 0) - not normalised */
+        { ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x80U, 0x00U },
+        /* Seed ID followed by a trailing byte */
+        { ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x40U, 0x00U },
+        /* Seed ID followed by non-zero padding */
+        { ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x41U },
+    };
+    uint32_t ru32_BufferSizes[] = { 3, 2, 3, 2 };
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rru8_Buffers); u32_I++)
+    {
+        TEST_FAILURE(
+            ITC_SerDes_Util_deserialiseId(
+                &rru8_Buffers[u32_I][0],
+                ru32_BufferSizes[u32_I],
+                true,
+                &pt_Id),
+            ITC_STATUS_CORRUPT_ID);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+}
+
+/* Test deserialising an ID in the compact format succeeds */
+void ITC_SerDes_Test_deserialiseIdCompactSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Id_t *pt_Id;
+    /* Versioned, compact serialised (0, ((1, 0), 1)) ID */
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG,
+        0x9AU,
+        0x20U,
+    };
+    ITC_SerDes_Util_BitReader_t t_Reader = {
+        .pu8_Buffer = &ru8_Buffer[1],
+        .u32_BufferSize = sizeof(ru8_Buffer) - 1,
+        .u32_BitOffset = 0,
+    };
 
-    /* Test different invalid Stamps are handled properly */
-    for (uint32_t u32_I = 0;
-         u32_I < gu32_InvalidStampTablesSize;
-         u32_I++)
-    {
-        /* Construct an invalid Stamp */
-        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+    /* Test deserialising the bit stream stops at the last leaf */
+    TEST_SUCCESS(ITC_SerDes_Util_deserialiseIdCompact(&t_Reader, &pt_Id));
+    TEST_ASSERT_EQUAL(11, t_Reader.u32_BitOffset);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
 
-        /* Test for the failure */
-        TEST_ASSERT_NOT_EQUAL(
-            ITC_SerDes_serialiseStamp(
-                pt_Stamp,
-                &ru8_Buffer[0],
-                &u32_BufferSize),
-            /* Different exceptions might be returned depending on the
-             * failure */
-            ITC_STATUS_SUCCESS);
+    /* Test deserialising through the versioned API */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_deserialiseId(
+            &ru8_Buffer[0], sizeof(ru8_Buffer), true, &pt_Id));
 
-        /* Destroy the Stamp */
-        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
-    }
+    /* Test this is a (0, ((1, 0), 1)) ID */
+    TEST_ITC_ID_IS_NULL_ID(pt_Id->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_SEED_ID(pt_Id->pt_Right->pt_Right);
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a Stamp with leaf ID and Event nodes succeeds */
-void ITC_SerDes_Test_serialiseStampWithLeafComponentsSuccessful(void)
+/* Test serialising an Event in the compact format fails with corrupt Event */
+void ITC_SerDes_Test_serialiseEventCompactFailWithCorruptEvent(void)
 {
-    ITC_Stamp_t *pt_Stamp = NULL;
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Event_t *pt_Event;
     uint8_t ru8_Buffer[10] = { 0 };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
-
-    uint8_t ru8_ExpectedStampSerialisedData[] = {
-        ITC_VERSION_MAJOR, /* Provided by build system c args */
-        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
-        1,
-        ITC_SERDES_SEED_ID_HEADER,
-        1,
-        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    ITC_SerDes_Util_BitWriter_t t_Writer = {
+        .pu8_Buffer = &ru8_Buffer[0],
+        .u32_BufferSize = sizeof(ru8_Buffer),
+        .u32_BitOffset = 0,
     };
 
-    /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
-
-    /* Serialise the Stamp */
-    TEST_SUCCESS(
-        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0; u32_I < gu32_InvalidEventTablesSize; u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Event);
 
-    /* Test the serialised data is what is expected */
-    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedStampSerialisedData), u32_BufferSize);
-    TEST_ASSERT_EQUAL_MEMORY(
-        &ru8_ExpectedStampSerialisedData[0],
-        &ru8_Buffer[0],
-        sizeof(ru8_ExpectedStampSerialisedData));
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_SerDes_Util_serialiseEventCompact(pt_Event, &t_Writer),
+            ITC_STATUS_CORRUPT_EVENT);
 
-    /* Destroy the Stamp */
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Event);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a leaf Stamp fails with insufficent resources */
-void ITC_SerDes_Test_serialiseStampFailWithInsufficentResources(void)
+/* Test serialising an Event in the compact format succeeds */
+void ITC_SerDes_Test_serialiseEventCompactSuccessful(void)
 {
-    ITC_Stamp_t *pt_Stamp = NULL;
-    uint8_t ru8_Buffer[7] = { 0 };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Event_t *pt_Event = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    ITC_SerDes_Util_BitWriter_t t_Writer = {
+        .pu8_Buffer = &ru8_Buffer[0],
+        .u32_BufferSize = 3,
+        .u32_BitOffset = 0,
+    };
+    uint32_t u32_BitCount;
 
-    /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    /* (1, 0, 130) Event:
+     * - `11` + LEB128(0) (1, ...)
+     * - `00` 0
+     * - `01` + LEB128(129) 130 */
+    uint8_t ru8_ExpectedEventSerialisedData[] = {
+        0xC0U, 0x06U, 0x04U, 0x04U
+    };
 
-    /* Make the event a parent */
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 1));
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
+    /* Create the (1, 0, 130) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 130));
 
-    /* Test the Event does not fit */
-    TEST_FAILURE(
-        ITC_SerDes_serialiseStamp(
-            pt_Stamp,
-            &ru8_Buffer[0],
-            &u32_BufferSize),
-        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    /* Test the bit count */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_getSerialisedEventCompactBitCount(
+            pt_Event, &u32_BitCount));
+    TEST_ASSERT_EQUAL(30, u32_BitCount);
 
-    /* Test the ID and Event do not fit */
-    u32_BufferSize = 4;
+    /* Test serialising fails if the buffer is not big enough */
     TEST_FAILURE(
-        ITC_SerDes_serialiseStamp(
-            pt_Stamp,
-            &ru8_Buffer[0],
-            &u32_BufferSize),
+        ITC_SerDes_Util_serialiseEventCompact(pt_Event, &t_Writer),
         ITC_STATUS_INSUFFICIENT_RESOURCES);
 
-    /* Serialise the Stamp */
-    u32_BufferSize = ITC_SERDES_STAMP_MIN_BUFFER_LEN - 1;
-    TEST_FAILURE(
-        ITC_SerDes_serialiseStamp(
-            pt_Stamp,
-            &ru8_Buffer[0],
-            &u32_BufferSize),
-        ITC_STATUS_INSUFFICIENT_RESOURCES);
-    /* Destroy the Stamp */
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    /* Serialise the Event */
+    t_Writer.u32_BufferSize = sizeof(ru8_Buffer);
+    t_Writer.u32_BitOffset = 0;
+    TEST_SUCCESS(ITC_SerDes_Util_serialiseEventCompact(pt_Event, &t_Writer));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(u32_BitCount, t_Writer.u32_BitOffset);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedEventSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedEventSerialisedData));
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a Stamp with parent ID and Event nodes succeeds */
-void ITC_SerDes_Test_serialiseStampWithParentComponentsSuccessful(void)
+/* Test the event counter boundaries of the compact format round-trip */
+void ITC_SerDes_Test_serialiseEventCompactCounterBoundariesSuccessful(void)
 {
-    ITC_Stamp_t *pt_Stamp = NULL;
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Event_t *pt_Event = NULL;
+    uint8_t ru8_Buffer[20] = { 0 };
+    ITC_SerDes_Util_BitWriter_t t_Writer;
+    ITC_SerDes_Util_BitReader_t t_Reader;
+    ITC_Event_Counter_t rt_Counters[] = {
+        0, 1, 128, 129, 16384, 16385, ((ITC_Event_Counter_t)~0)
+    };
+    /* 2 flag bits, followed by 8 bits per LEB128 group */
+    uint32_t ru32_ExpectedBitCounts[] = {
+        2,
+        2 + 8,
+        2 + 8,
+        2 + 16,
+        2 + 16,
+        2 + 24,
 #if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    uint8_t ru8_Buffer[18] = { 0 };
+        2 + 80,
 #else
-    uint8_t ru8_Buffer[14] = { 0 };
+        2 + 40,
 #endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    };
 
-    uint8_t ru8_ExpectedStampSerialisedData[] = {
-        ITC_VERSION_MAJOR, /* Provided by build system c args */
-        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
-        3,
-        ITC_SERDES_PARENT_ID_HEADER,
-        ITC_SERDES_SEED_ID_HEADER,
-        ITC_SERDES_NULL_ID_HEADER,
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-        11,
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rt_Counters); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(&pt_Event, NULL, rt_Counters[u32_I]));
+
+        t_Writer = (ITC_SerDes_Util_BitWriter_t){
+            .pu8_Buffer = &ru8_Buffer[0],
+            .u32_BufferSize = sizeof(ru8_Buffer),
+            .u32_BitOffset = 0,
+        };
+        TEST_SUCCESS(
+            ITC_SerDes_Util_serialiseEventCompact(pt_Event, &t_Writer));
+        TEST_ASSERT_EQUAL(
+            ru32_ExpectedBitCounts[u32_I], t_Writer.u32_BitOffset);
+        TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+        t_Reader = (ITC_SerDes_Util_BitReader_t){
+            .pu8_Buffer = &ru8_Buffer[0],
+            .u32_BufferSize = (t_Writer.u32_BitOffset + 7U) / 8U,
+            .u32_BitOffset = 0,
+        };
+        TEST_SUCCESS(
+            ITC_SerDes_Util_deserialiseEventCompact(&t_Reader, &pt_Event));
+        TEST_ASSERT_TRUE(ITC_SerDes_Util_isBitReaderAtEnd(&t_Reader));
+        TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, rt_Counters[u32_I]);
+        TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    }
 #else
-        7,
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-        ITC_SERDES_CREATE_EVENT_HEADER(false, 8),
-        0xFFU,
-        0xFFU,
-        0xFFU,
-        0xFFU,
-        0xFFU,
-        0xFFU,
-        0xFFU,
-        0xFFU,
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+}
+
+/* Test deserialising an Event in the compact format fails with corrupt Event */
+void ITC_SerDes_Test_deserialiseEventCompactFailWithCorruptEvent(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Event_t *pt_Event;
+    /* Versioned, compact serialised Events */
+    uint8_t rru8_Buffers[][4] = {
+        /* Truncated tree - only parent nodes */
+        {
+            ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG,
+            0x88U,
+            0x88U,
+            0x88U
+        },
+        /* Truncated event counter */
+        { ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x60U, 0x00U },
+        /* Overlong event counter - LEB128(0) as 2 groups */
+        {
+            ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG,
+            0x60U,
+            0x00U,
+            0x00U
+        },
+        /* (0, 1, 1) - not normalised */
+        {
+            ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG,
+            0x90U,
+            0x04U,
+            0x00U
+        },
+        /* 0 Event followed by a trailing byte */
+        { ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x00U, 0x00U },
+        /* 0 Event followed by non-zero padding */
+        { ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x01U },
+    };
+    uint32_t ru32_BufferSizes[] = { 4, 2, 4, 4, 3, 2 };
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rru8_Buffers); u32_I++)
+    {
+        TEST_FAILURE(
+            ITC_SerDes_Util_deserialiseEvent(
+                &rru8_Buffers[u32_I][0],
+                ru32_BufferSizes[u32_I],
+                true,
+                &pt_Event),
+            ITC_STATUS_CORRUPT_EVENT);
+    }
 #else
-        ITC_SERDES_CREATE_EVENT_HEADER(false, 4),
-        0xFFU,
-        0xFFU,
-        0xFFU,
-        0xFFU,
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+}
+
+/* Test deserialising an Event in the compact format fails with unsupported
+ * counter size */
+void ITC_SerDes_Test_deserialiseEventCompactFailWithUnsupportedCounterSize(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Event_t *pt_Event;
+    uint8_t ru8_Buffer[12];
+    ITC_SerDes_Util_BitWriter_t t_Writer = {
+        .pu8_Buffer = &ru8_Buffer[1],
+        .u32_BufferSize = sizeof(ru8_Buffer) - 1,
+        .u32_BitOffset = 0,
     };
 
-    /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    ru8_Buffer[0] = ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG;
 
-    /* clang-format off */
-    /* Add nodes to the ID component */
-    pt_Stamp->pt_Id->b_IsOwner = false;
-    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
-    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+    /* A leaf with `counter - 1` too big for any supported counter */
+    TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0x1U, 2));
+    for (uint32_t u32_I = 0; u32_I < 9; u32_I++)
+    {
+        TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0xFFU, 8));
+    }
+    TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0x02U, 8));
 
-    /* Add nodes to the Event component */
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseEvent(
+            &ru8_Buffer[0],
+            1 + ((t_Writer.u32_BitOffset + 7U) / 8U),
+            true,
+            &pt_Event),
+        ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE);
+
+    /* A leaf with `counter - 1` equal to the maximum counter value */
+    t_Writer.u32_BitOffset = 0;
+    TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0x1U, 2));
 #if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT64_MAX));
+    for (uint32_t u32_I = 0; u32_I < 9; u32_I++)
+    {
+        TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0xFFU, 8));
+    }
+    TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0x01U, 8));
 #else
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT32_MAX));
+    for (uint32_t u32_I = 0; u32_I < 4; u32_I++)
+    {
+        TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0xFFU, 8));
+    }
+    TEST_SUCCESS(ITC_SerDes_Util_writeBits(&t_Writer, 0x0FU, 8));
 #endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
-    /* clang-format on */
-
-    /* Serialise the Stamp */
-    TEST_SUCCESS(
-        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
 
-    /* Test the serialised data is what is expected */
-    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedStampSerialisedData), u32_BufferSize);
-    TEST_ASSERT_EQUAL_MEMORY(
-        &ru8_ExpectedStampSerialisedData[0],
-        &ru8_Buffer[0],
-        sizeof(ru8_ExpectedStampSerialisedData));
-
-    /* Destroy the Stamp */
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseEvent(
+            &ru8_Buffer[0],
+            1 + ((t_Writer.u32_BitOffset + 7U) / 8U),
+            true,
+            &pt_Event),
+        ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE);
+#else
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a Stamp to string fails with invalid param */
-void ITC_SerDes_Test_serialiseStampToStringFailInvalidParam(void)
+/* Test serialising a Stamp in the compact format fails with invalid param */
+void ITC_SerDes_Test_serialiseStampCompactFailInvalidParam(void)
 {
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-    ITC_Stamp_t *pt_Dummy = NULL;
-    char rc_Buffer[10] = { 0 };
-    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Stamp_t *pt_Stamp = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    uint32_t u32_Size;
 
     TEST_FAILURE(
-        ITC_SerDes_serialiseStampToString(
-            pt_Dummy,
-            &rc_Buffer[0],
-            NULL),
+        ITC_SerDes_serialiseStampCompact(
+            NULL, &ru8_Buffer[0], &u32_BufferSize),
         ITC_STATUS_INVALID_PARAM);
     TEST_FAILURE(
-        ITC_SerDes_serialiseStampToString(
-            NULL,
-            &rc_Buffer[0],
-            &u32_BufferSize),
+        ITC_SerDes_getSerialisedStampCompactSize(NULL, &u32_Size),
         ITC_STATUS_INVALID_PARAM);
-    TEST_FAILURE(
-        ITC_SerDes_serialiseStampToString(
-            pt_Dummy,
-            NULL,
-            &u32_BufferSize),
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampCompact(pt_Stamp, NULL, &u32_BufferSize),
         ITC_STATUS_INVALID_PARAM);
-
-    u32_BufferSize = 0;
     TEST_FAILURE(
-        ITC_SerDes_serialiseStampToString(
-            pt_Dummy,
-            rc_Buffer,
-            &u32_BufferSize),
+        ITC_SerDes_serialiseStampCompact(pt_Stamp, &ru8_Buffer[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_getSerialisedStampCompactSize(pt_Stamp, NULL),
         ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
 #else
-    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a Stamp to string fails with corrupt Stamp */
-void ITC_SerDes_Test_serialiseStampToStringFailWithCorruptStamp(void)
+/* Test serialising a Stamp in the compact format fails with corrupt Stamp */
+void ITC_SerDes_Test_serialiseStampCompactFailWithCorruptStamp(void)
 {
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
     ITC_Stamp_t *pt_Stamp;
-    char rc_Buffer[10] = { 0 };
-    uint32_t u32_BufferSize = sizeof(rc_Buffer);
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize;
 
     /* Test different invalid Stamps are handled properly */
-    for (uint32_t u32_I = 0;
-         u32_I < gu32_InvalidStampTablesSize;
-         u32_I++)
+    for (uint32_t u32_I = 0; u32_I < gu32_InvalidStampTablesSize; u32_I++)
     {
         /* Construct an invalid Stamp */
         gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
 
         /* Test for the failure */
+        u32_BufferSize = sizeof(ru8_Buffer);
         TEST_ASSERT_NOT_EQUAL(
-            ITC_SerDes_serialiseStampToString(
-                pt_Stamp,
-                &rc_Buffer[0],
-                &u32_BufferSize),
+            ITC_SerDes_serialiseStampCompact(
+                pt_Stamp, &ru8_Buffer[0], &u32_BufferSize),
             /* Different exceptions might be returned depending on the
              * failure */
             ITC_STATUS_SUCCESS);
@@ -1856,281 +5747,298 @@ void ITC_SerDes_Test_serialiseStampToStringFailWithCorruptStamp(void)
         gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
     }
 #else
-    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a Stamp with leaf ID and Event to string succeeds */
-void ITC_SerDes_Test_serialiseStampToStringWithLeafIdAndEventSuccessful(void)
+/* Test serialising a Stamp in the compact format succeeds */
+void ITC_SerDes_Test_serialiseStampCompactSuccessful(void)
 {
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
     ITC_Stamp_t *pt_Stamp = NULL;
-    char rc_Buffer[8];
-    uint32_t u32_BufferSize = sizeof(rc_Buffer);
-
-    const char *z_ExpectedNewStampSerialisedData = "{1; 0}";
-    const char *z_ExpectedBiggerStampSerialisedData = "{1; 12}";
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    uint32_t u32_Size;
 
-    /* Init to a random value */
-    memset(&rc_Buffer[0], 0x55, sizeof(rc_Buffer));
+    uint8_t ru8_ExpectedSeedStampSerialisedData[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG,
+        0x40U, /* `01` seed ID, `00` 0 Event */
+    };
+    /* ((1, 0), (1, 2, 0)) Stamp:
+     * - `1` `01` `00` (1, 0) ID
+     * - `11` + LEB128(0) (1, ...)
+     * - `01` + LEB128(1) 2
+     * - `00` 0 */
+    uint8_t ru8_ExpectedStampSerialisedData[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG,
+        0xA6U,
+        0x00U,
+        0x80U,
+        0x80U,
+    };
 
-    /* Create a new Stamp */
+    /* Create a new seed Stamp */
     TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
 
-    /* Serialise the Stamp to string */
+    /* Serialise the Stamp */
     TEST_SUCCESS(
-        ITC_SerDes_serialiseStampToString(
-            pt_Stamp,
-            &rc_Buffer[0],
-            &u32_BufferSize));
+        ITC_SerDes_getSerialisedStampCompactSize(pt_Stamp, &u32_Size));
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampCompact(
+            pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
 
     /* Test the serialised data is what is expected */
-    TEST_ASSERT_EQUAL(
-        strlen(z_ExpectedNewStampSerialisedData) + 1, u32_BufferSize);
-    TEST_ASSERT_EQUAL_STRING_LEN(
-        z_ExpectedNewStampSerialisedData,
-        &rc_Buffer[0],
-        strlen(z_ExpectedNewStampSerialisedData) + 1);
-
-    /* Test the buffer len hasn't been exceeded */
-    TEST_ASSERT_EQUAL_CHAR(0x55, rc_Buffer[7]);
-
-    /* Make the Event component bigger */
-    pt_Stamp->pt_Event->t_Count = 12;
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedSeedStampSerialisedData), u32_Size);
+    TEST_ASSERT_EQUAL(u32_Size, u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedSeedStampSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedSeedStampSerialisedData));
 
-    /* Reset the buffer size */
-    u32_BufferSize = sizeof(rc_Buffer);
+    /* Make the Stamp ((1, 0), (1, 2, 0)) */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
+    TEST_SUCCESS(
+        ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+    pt_Stamp->pt_Id->b_IsOwner = false;
+    pt_Stamp->pt_Event->t_Count = 1;
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 2));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
 
-    /* Serialise the Stamp to string */
+    /* Test the size is exactly what serialising needs */
     TEST_SUCCESS(
-        ITC_SerDes_serialiseStampToString(
-            pt_Stamp,
-            &rc_Buffer[0],
-            &u32_BufferSize));
+        ITC_SerDes_getSerialisedStampCompactSize(pt_Stamp, &u32_Size));
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedStampSerialisedData), u32_Size);
+    u32_BufferSize = u32_Size - 1;
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampCompact(
+            pt_Stamp, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    u32_BufferSize = u32_Size;
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStampCompact(
+            pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
 
     /* Test the serialised data is what is expected */
-    TEST_ASSERT_EQUAL(
-        strlen(z_ExpectedBiggerStampSerialisedData) + 1, u32_BufferSize);
-    TEST_ASSERT_EQUAL_STRING_LEN(
-        z_ExpectedBiggerStampSerialisedData,
-        &rc_Buffer[0],
-        strlen(z_ExpectedBiggerStampSerialisedData) + 1);
+    TEST_ASSERT_EQUAL(u32_Size, u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedStampSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedStampSerialisedData));
+
+    /* Test the compact format is smaller than the default one */
+    TEST_SUCCESS(ITC_SerDes_getSerialisedStampSize(pt_Stamp, &u32_Size));
+    TEST_ASSERT_TRUE(u32_BufferSize < u32_Size);
 
     /* Destroy the Stamp */
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
 #else
-    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a Stamp to string fails with insufficent resources */
-void ITC_SerDes_Test_serialiseStampToStringFailWithInsufficentResources(void)
+/* Test deserialising a Stamp in the compact format fails with corrupt Stamp */
+void ITC_SerDes_Test_deserialiseStampCompactFailWithCorruptStamp(void)
 {
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-    ITC_Stamp_t *pt_Stamp = NULL;
-    char rc_Buffer[ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN];
-    uint32_t u32_BufferSize;
-
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
-
-    /* Set the last byte to a random value */
-    rc_Buffer[ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN - 1] = 0x55;
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Stamp_t *pt_Stamp;
+    /* Seed Stamp followed by a trailing byte */
+    uint8_t ru8_TrailingBuffer[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x40U, 0x00U
+    };
+    /* Seed Stamp followed by non-zero padding */
+    uint8_t ru8_PaddingBuffer[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x41U
+    };
+    /* Seed ID followed by a truncated Event */
+    uint8_t ru8_TruncatedBuffer[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x6AU
+    };
+    /* (0, 0) ID - not normalised */
+    uint8_t ru8_CorruptIdBuffer[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, 0x80U
+    };
 
-    /* The min len requires just a NULL termination byte, but the overall
-     * status is still insufficent resources, as there was no space to serialise
-     * the Stamp */
-    u32_BufferSize = sizeof(rc_Buffer);
-    /* Serialise the Stamp to string */
     TEST_FAILURE(
-        ITC_SerDes_serialiseStampToString(
-            pt_Stamp,
-            &rc_Buffer[0],
-            &u32_BufferSize),
-        ITC_STATUS_INSUFFICIENT_RESOURCES);
-
-    /* Test the buffer was NULL terminated */
-    TEST_ASSERT_EQUAL_CHAR(
-        '\0',
-        rc_Buffer[ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN - 1]);
-
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+        ITC_SerDes_deserialiseStamp(
+            &ru8_TrailingBuffer[0], sizeof(ru8_TrailingBuffer), &pt_Stamp),
+        ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_PaddingBuffer[0], sizeof(ru8_PaddingBuffer), &pt_Stamp),
+        ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_TruncatedBuffer[0], sizeof(ru8_TruncatedBuffer), &pt_Stamp),
+        ITC_STATUS_CORRUPT_EVENT);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_CorruptIdBuffer[0], sizeof(ru8_CorruptIdBuffer), &pt_Stamp),
+        ITC_STATUS_CORRUPT_ID);
 #else
-    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a Stamp with parent components to string succeeds */
-void ITC_SerDes_Test_serialiseStampToStringWithParentComponentsSuccessful(void)
+/* Test deserialising a Stamp in the compact format succeeds */
+void ITC_SerDes_Test_deserialiseStampCompactSuccessful(void)
 {
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-    ITC_Stamp_t *pt_Stamp = NULL;
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    char rc_Buffer[39];
-#else
-    char rc_Buffer[29];
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-    uint32_t u32_BufferSize = sizeof(rc_Buffer);
-
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    const char *z_ExpectedStampSerialisedData = "{(1, 0); (0, 18446744073709551615, 0)}";
-#else
-    const char *z_ExpectedStampSerialisedData = "{(1, 0); (0, 4294967295, 0)}";
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-
-    /* Init to a random value */
-    memset(&rc_Buffer[0], 0x55, sizeof(rc_Buffer));
-
-    /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
-
-    /* clang-format off */
-    /* Add nodes to the ID component */
-    pt_Stamp->pt_Id->b_IsOwner = false;
-    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
-    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
-
-    /* Add nodes to the Event component */
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT64_MAX));
-#else
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT32_MAX));
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
-    /* clang-format on */
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    ITC_Stamp_t *pt_Stamp;
+    /* ((1, 0), (1, 2, 0)) Stamp */
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG,
+        0xA6U,
+        0x00U,
+        0x80U,
+        0x80U,
+    };
 
-    /* Serialise the Stamp to string */
+    /* Test deserialising the Stamp */
     TEST_SUCCESS(
-        ITC_SerDes_serialiseStampToString(
-            pt_Stamp,
-            &rc_Buffer[0],
-            &u32_BufferSize));
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0], sizeof(ru8_Buffer), &pt_Stamp));
 
-    /* Test the serialised data is what is expected */
-    TEST_ASSERT_EQUAL(strlen(z_ExpectedStampSerialisedData) + 1, u32_BufferSize);
-    TEST_ASSERT_EQUAL_STRING_LEN(
-        &z_ExpectedStampSerialisedData[0],
-        &rc_Buffer[0],
-        strlen(z_ExpectedStampSerialisedData) + 1);
+    /* Test this is a ((1, 0), (1, 2, 0)) Stamp */
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
 
     /* Destroy the Stamp */
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
 #else
-    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+    TEST_IGNORE_MESSAGE("Compact serialisation format is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
 }
 
-/* Test serialising a Stamp with parent components to string fails with
- * insufficent resources */
-void ITC_SerDes_Test_serialiseStampToStringWithParentComponentsFailWithInsufficentResources(void)
+/* Test deserialising compact data fails if the compact format is disabled */
+void ITC_SerDes_Test_deserialiseCompactStampFailWithIncompatibleLibVersion(void)
 {
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-    ITC_Stamp_t *pt_Stamp = NULL;
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    char rc_Buffer[38];
-#else
-    char rc_Buffer[28];
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-    uint32_t u32_BufferSize = sizeof(rc_Buffer);
-
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    const char *z_ExpectedStampSerialisedData = "{(1, 0); (0, 18446744073709551615, 0)}";
-#else
-    const char *z_ExpectedStampSerialisedData = "{(1, 0); (0, 4294967295, 0)}";
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-
-    /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
-
-    /* clang-format off */
-    /* Add nodes to the ID component */
-    pt_Stamp->pt_Id->b_IsOwner = false;
-    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
-    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
-
-    /* Add nodes to the Event component */
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT64_MAX));
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT
+    TEST_IGNORE_MESSAGE("Compact serialisation format is enabled");
 #else
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, UINT32_MAX));
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
-    /* clang-format on */
+    ITC_Stamp_t *pt_Stamp;
+    /* Compact seed Stamp */
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG,
+        0x40U,
+        0x00U,
+        0x00U,
+        0x00U,
+        0x00U,
+    };
 
-    for (uint32_t u32_I = ITC_SER_TO_STR_STAMP_MIN_BUFFER_LEN;
-         u32_I <= strlen(z_ExpectedStampSerialisedData);
-         u32_I++)
-    {
-        /* Init to a random value */
-        memset(&rc_Buffer[0], 0x55, sizeof(rc_Buffer));
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0], sizeof(ru8_Buffer), &pt_Stamp),
+        ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION);
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT */
+}
 
-        u32_BufferSize = u32_I;
-        /* Serialise the Stamp to string */
-        TEST_FAILURE(
-            ITC_SerDes_serialiseStampToString(
-                pt_Stamp,
-                &rc_Buffer[0],
-                &u32_BufferSize),
-            ITC_STATUS_INSUFFICIENT_RESOURCES);
+/* Test serialising IDs and Events in the compact format via the public API
+ * succeeds */
+void ITC_SerDes_Test_serialiseIdAndEventCompactPublicApiSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT && ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Id_t *pt_Id = NULL;
+    ITC_Event_t *pt_Event = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
 
-        /* Test the string is NULL terminated and the length was not exceeded */
-        TEST_ASSERT_LESS_OR_EQUAL(u32_I - 1, strnlen(&rc_Buffer[0], u32_I));
-        for (uint32_t u32_J = u32_I; u32_J < sizeof(rc_Buffer); u32_J++)
-        {
-            TEST_ASSERT_EQUAL_CHAR(0x55, rc_Buffer[u32_J]);
-        }
+    /* Test the minimum buffer size is enforced */
+    u32_BufferSize = 1;
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+    TEST_FAILURE(
+        ITC_SerDes_serialiseIdCompact(pt_Id, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
 
-        /* Test the partial output is what is expected */
-        TEST_ASSERT_EQUAL_STRING_LEN(
-            z_ExpectedStampSerialisedData,
-            &rc_Buffer[0],
-            strnlen(&rc_Buffer[0], u32_I));
-    }
+    /* Serialise and deserialise a seed ID */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseIdCompact(pt_Id, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(2, u32_BufferSize);
+    TEST_ASSERT_EQUAL(
+        ITC_VERSION_MAJOR | ITC_SERDES_COMPACT_FORMAT_FLAG, ru8_Buffer[0]);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseId(&ru8_Buffer[0], u32_BufferSize, &pt_Id));
+    TEST_ITC_ID_IS_SEED_ID(pt_Id);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
 
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    /* Serialise and deserialise a leaf Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 42));
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseEventCompact(
+            pt_Event, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(3, u32_BufferSize);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseEvent(&ru8_Buffer[0], u32_BufferSize, &pt_Event));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 42);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
 #else
-    TEST_IGNORE_MESSAGE("Serialise to string API support is disabled");
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+    TEST_IGNORE_MESSAGE(
+        "Compact serialisation format or extended API is disabled");
+#endif /* ITC_CONFIG_ENABLE_COMPACT_SERDES_FORMAT && ITC_CONFIG_ENABLE_EXTENDED_API */
 }
 
-/* Test deserialising a Stamp fails with invalid param */
-void ITC_SerDes_Test_deserialiseStampFailInvalidParam(void)
+/* Test the Stamp decoder fails with invalid param */
+void ITC_SerDes_Test_stampDecoderFailInvalidParam(void)
 {
-    ITC_Stamp_t *pt_Dummy = NULL;
-    uint8_t ru8_Buffer[ITC_SERDES_STAMP_MIN_BUFFER_LEN] = { 0 };
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+    ITC_SerDes_StampDecoder_t t_Decoder;
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[] = { ITC_VERSION_MAJOR };
 
+    TEST_FAILURE(ITC_SerDes_initStampDecoder(NULL), ITC_STATUS_INVALID_PARAM);
     TEST_FAILURE(
-        ITC_SerDes_deserialiseStamp(
-            &ru8_Buffer[0],
-            sizeof(ru8_Buffer),
-            NULL),
+        ITC_SerDes_resetStampDecoder(NULL), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_SerDes_initStampDecoder(&t_Decoder));
+
+    TEST_FAILURE(
+        ITC_SerDes_feedStampDecoder(
+            NULL, &ru8_Buffer[0], sizeof(ru8_Buffer)),
         ITC_STATUS_INVALID_PARAM);
     TEST_FAILURE(
-        ITC_SerDes_deserialiseStamp(
-            NULL,
-            sizeof(ru8_Buffer),
-            &pt_Dummy),
+        ITC_SerDes_feedStampDecoder(&t_Decoder, NULL, sizeof(ru8_Buffer)),
         ITC_STATUS_INVALID_PARAM);
     TEST_FAILURE(
-        ITC_SerDes_deserialiseStamp(
-            &ru8_Buffer[0],
-            0,
-            &pt_Dummy),
+        ITC_SerDes_feedStampDecoder(&t_Decoder, &ru8_Buffer[0], 0),
         ITC_STATUS_INVALID_PARAM);
-
     TEST_FAILURE(
-        ITC_SerDes_deserialiseStamp(
-            &ru8_Buffer[0],
-            ITC_SERDES_STAMP_MIN_BUFFER_LEN - 1,
-            &pt_Dummy),
+        ITC_SerDes_finishStampDecoder(NULL, &pt_Stamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_finishStampDecoder(&t_Decoder, NULL),
         ITC_STATUS_INVALID_PARAM);
+
+    /* Test the invalid params did not affect the decoder */
+    TEST_SUCCESS(
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_Buffer[0], sizeof(ru8_Buffer)));
+    TEST_SUCCESS(ITC_SerDes_resetStampDecoder(&t_Decoder));
+#else
+    TEST_IGNORE_MESSAGE("Streaming deserialiser is disabled");
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
 }
 
-/* Test deserialising a Stamp fails with corrupt Stamp */
-void ITC_SerDes_Test_deserialiseStampFailWithCorruptStamp(void)
+/* Test the Stamp decoder fails with corrupt Stamp */
+void ITC_SerDes_Test_stampDecoderFailWithCorruptStamp(void)
 {
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+    ITC_SerDes_StampDecoder_t t_Decoder;
     ITC_Stamp_t *pt_Stamp;
     const uint8_t *pu8_Buffer = NULL;
     uint32_t u32_BufferSize = 0;
+    ITC_Status_t t_Status;
+
+    TEST_SUCCESS(ITC_SerDes_initStampDecoder(&t_Decoder));
 
     /* Test different invalid serialised Stamps are handled properly */
     for (uint32_t u32_I = 0;
@@ -2141,82 +6049,119 @@ void ITC_SerDes_Test_deserialiseStampFailWithCorruptStamp(void)
         gpv_InvalidSerialisedStampConstructorTable[u32_I](
             &pu8_Buffer, &u32_BufferSize);
 
-        /* Test for the failure */
-        TEST_ASSERT_NOT_EQUAL(
-            ITC_SerDes_deserialiseStamp(
-                pu8_Buffer,
-                u32_BufferSize,
-                &pt_Stamp),
-            /* Depending on the failure, different exceptions might be
-             * returned */
-            ITC_STATUS_SUCCESS);
+        /* Test for the failure. Depending on the failure, different
+         * exceptions might be returned by either call */
+        t_Status = ITC_SerDes_feedStampDecoder(
+            &t_Decoder, pu8_Buffer, u32_BufferSize);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_SerDes_finishStampDecoder(&t_Decoder, &pt_Stamp);
+        }
+        else
+        {
+            /* Test the failure is remembered */
+            TEST_FAILURE(
+                ITC_SerDes_feedStampDecoder(
+                    &t_Decoder, pu8_Buffer, u32_BufferSize),
+                t_Status);
+            TEST_FAILURE(
+                ITC_SerDes_finishStampDecoder(&t_Decoder, &pt_Stamp),
+                t_Status);
+        }
+
+        TEST_ASSERT_NOT_EQUAL(ITC_STATUS_SUCCESS, t_Status);
     }
+#else
+    TEST_IGNORE_MESSAGE("Streaming deserialiser is disabled");
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
 }
 
-/* Test deserialising a Stamp fails with unsupported ID component length length
- * size */
-void ITC_SerDes_Test_deserialiseStampFailWithUnsupportedIdLengthLengthSize(void)
+/* Test the Stamp decoder fails with truncated or trailing data */
+void ITC_SerDes_Test_stampDecoderFailWithTruncatedOrTrailingData(void)
 {
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+    ITC_SerDes_StampDecoder_t t_Decoder;
     ITC_Stamp_t *pt_Stamp;
+    /* Serialised Stamp with a (1, 0) ID and a (0, 1, 0) Event, with an extra
+     * trailing byte */
     uint8_t ru8_Buffer[] = {
         ITC_VERSION_MAJOR, /* Provided by build system c args */
-        ITC_SERDES_CREATE_STAMP_HEADER(sizeof(uint32_t) + 1, 1),
-        1,
-        1,
-        1,
-        1,
-        1,
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        3,
+        ITC_SERDES_PARENT_ID_HEADER,
         ITC_SERDES_SEED_ID_HEADER,
+        ITC_SERDES_NULL_ID_HEADER,
+        4,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
         1,
-        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
     };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
-
-    /* Test for the failure */
-    TEST_FAILURE(
-        ITC_SerDes_deserialiseStamp(
-            &ru8_Buffer[0],
-            u32_BufferSize,
-            &pt_Stamp),
-        /* There is no special exception as a length length size of more than
-         * the size of sizeof(uint32_t) is most likely user error */
-        ITC_STATUS_INVALID_PARAM);
-}
-
-/* Test deserialising a Stamp fails with unsupported Event component length length
- * size */
-void ITC_SerDes_Test_deserialiseStampFailWithUnsupportedEventLengthLengthSize(void)
-{
-    ITC_Stamp_t *pt_Stamp;
-    uint8_t ru8_Buffer[] = {
+    /* Serialised Stamp where the last ID node is outside the ID component */
+    uint8_t ru8_ShortIdBuffer[] = {
         ITC_VERSION_MAJOR, /* Provided by build system c args */
-        ITC_SERDES_CREATE_STAMP_HEADER(1, sizeof(uint32_t) + 1),
-        1,
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        2,
+        ITC_SERDES_PARENT_ID_HEADER,
         ITC_SERDES_SEED_ID_HEADER,
-        1,
-        1,
-        1,
-        1,
-        1,
-        ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
+        ITC_SERDES_NULL_ID_HEADER,
+    };
+    /* Serialised Stamp where the ID component contains an extra node */
+    uint8_t ru8_LongIdBuffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        2,
+        ITC_SERDES_SEED_ID_HEADER,
+        ITC_SERDES_NULL_ID_HEADER,
     };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
 
-    /* Test for the failure */
+    TEST_SUCCESS(ITC_SerDes_initStampDecoder(&t_Decoder));
+
+    /* Test every truncated Stamp is rejected */
+    for (uint32_t u32_I = 1; u32_I < sizeof(ru8_Buffer) - 1; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_SerDes_feedStampDecoder(&t_Decoder, &ru8_Buffer[0], u32_I));
+        TEST_FAILURE(
+            ITC_SerDes_finishStampDecoder(&t_Decoder, &pt_Stamp),
+            ITC_STATUS_CORRUPT_STAMP);
+    }
+
+    /* Test the trailing byte is rejected */
+    TEST_SUCCESS(
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_Buffer[0], sizeof(ru8_Buffer) - 1));
     TEST_FAILURE(
-        ITC_SerDes_deserialiseStamp(
-            &ru8_Buffer[0],
-            u32_BufferSize,
-            &pt_Stamp),
-        /* There is no special exception as a length length size of more than
-         * the size of sizeof(uint32_t) is most likely user error */
-        ITC_STATUS_INVALID_PARAM);
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_Buffer[sizeof(ru8_Buffer) - 1], 1),
+        ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(
+        ITC_SerDes_finishStampDecoder(&t_Decoder, &pt_Stamp),
+        ITC_STATUS_CORRUPT_STAMP);
+
+    /* Test the ID must fill its whole component */
+    TEST_FAILURE(
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_ShortIdBuffer[0], sizeof(ru8_ShortIdBuffer)),
+        ITC_STATUS_CORRUPT_ID);
+    TEST_SUCCESS(ITC_SerDes_resetStampDecoder(&t_Decoder));
+    TEST_FAILURE(
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_LongIdBuffer[0], sizeof(ru8_LongIdBuffer)),
+        ITC_STATUS_CORRUPT_ID);
+    TEST_SUCCESS(ITC_SerDes_resetStampDecoder(&t_Decoder));
+#else
+    TEST_IGNORE_MESSAGE("Streaming deserialiser is disabled");
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
 }
 
-/* Test deserialising a Stamp with incompatible lib version */
-void ITC_SerDes_Test_deserialiseStampFailWithIncompatibleLibVersion(void)
+/* Test the Stamp decoder fails with incompatible lib version */
+void ITC_SerDes_Test_stampDecoderFailWithIncompatibleLibVersion(void)
 {
-    ITC_Stamp_t *pt_Stamp;
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+    ITC_SerDes_StampDecoder_t t_Decoder;
     uint8_t ru8_Buffer[] = {
         ITC_VERSION_MAJOR + 1, /* Provided by build system c args */
         ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
@@ -2225,73 +6170,66 @@ void ITC_SerDes_Test_deserialiseStampFailWithIncompatibleLibVersion(void)
         1,
         ITC_SERDES_CREATE_EVENT_HEADER(false, 0)
     };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    /* A compact seed Stamp */
+    uint8_t ru8_CompactBuffer[] = {
+        ITC_VERSION_MAJOR | 0x80U, /* Provided by build system c args */
+        0x40U,
+    };
 
-    /* Test for the failure */
+    TEST_SUCCESS(ITC_SerDes_initStampDecoder(&t_Decoder));
     TEST_FAILURE(
-        ITC_SerDes_deserialiseStamp(
-            &ru8_Buffer[0],
-            u32_BufferSize,
-            &pt_Stamp),
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_Buffer[0], sizeof(ru8_Buffer)),
         ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION);
-}
-
-/* Test deserialising a Stamp from 0.x.x lib versions succeeds */
-void ITC_SerDes_Test_deserialiseStampFrom0XXLibVersionsSuccessful(void)
-{
-    ITC_Stamp_t *pt_Stamp;
-    uint8_t ru8_Buffer[] = {
-        0, /* Lib version 0.X.X */
-        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
-        1,
-        ITC_SERDES_SEED_ID_HEADER,
-        1,
-        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
-    };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
-
-    /* Test deserialising a leaf Stamp */
-    TEST_SUCCESS(
-        ITC_SerDes_deserialiseStamp(&ru8_Buffer[0], u32_BufferSize, &pt_Stamp));
-
-    /* Test this is a Stamp with a leaf seed ID and leaf 0 Event counter */
-    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
-    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_SUCCESS(ITC_SerDes_resetStampDecoder(&t_Decoder));
 
-    /* Destroy the Stamp */
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    /* The compact format is not supported */
+    TEST_FAILURE(
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_CompactBuffer[0], sizeof(ru8_CompactBuffer)),
+        ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION);
+    TEST_SUCCESS(ITC_SerDes_resetStampDecoder(&t_Decoder));
+#else
+    TEST_IGNORE_MESSAGE("Streaming deserialiser is disabled");
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
 }
 
-/* Test deserialising a stamp with leaf ID and Event components suceeds */
-void ITC_SerDes_Test_deserialiseLeafComponentsStampSuccessful(void)
+/* Test the Stamp decoder fails with unsupported counter size */
+void ITC_SerDes_Test_stampDecoderFailWithUnsupportedCounterSize(void)
 {
-    ITC_Stamp_t *pt_Stamp;
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+    ITC_SerDes_StampDecoder_t t_Decoder;
     uint8_t ru8_Buffer[] = {
         ITC_VERSION_MAJOR, /* Provided by build system c args */
         ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
         1,
         ITC_SERDES_SEED_ID_HEADER,
+        2 + sizeof(ITC_Event_Counter_t),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, sizeof(ITC_Event_Counter_t) + 1),
         1,
-        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
     };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
-
-    /* Test deserialising a leaf Stamp */
-    TEST_SUCCESS(
-        ITC_SerDes_deserialiseStamp(&ru8_Buffer[0], u32_BufferSize, &pt_Stamp));
-
-    /* Test this is a Stamp with a leaf seed ID and leaf 0 Event counter */
-    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
-    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
 
-    /* Destroy the Stamp */
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_SerDes_initStampDecoder(&t_Decoder));
+    TEST_FAILURE(
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_Buffer[0], sizeof(ru8_Buffer)),
+        ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE);
+    TEST_SUCCESS(ITC_SerDes_resetStampDecoder(&t_Decoder));
+#else
+    TEST_IGNORE_MESSAGE("Streaming deserialiser is disabled");
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
 }
 
-/* Test deserialising a parent Stamp suceeds */
-void ITC_SerDes_Test_deserialiseParentStampSuccessful(void)
+/* Test the Stamp decoder succeeds */
+void ITC_SerDes_Test_stampDecoderSuccessful(void)
 {
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+    ITC_SerDes_StampDecoder_t t_Decoder;
     ITC_Stamp_t *pt_Stamp;
+    uint32_t u32_Offset;
+    uint32_t u32_ChunkSize;
+    uint8_t ru8_SerialisedBuffer[40] = { 0 };
+    uint32_t u32_SerialisedBufferSize;
     /* Serialised stamp with:
      * - (0, ((1, 0), 1)) ID
      * - (0, 1, (0, (4242, 0, UINT32_MAX/UINT64_MAX), 0)) Event */
@@ -2338,31 +6276,94 @@ void ITC_SerDes_Test_deserialiseParentStampSuccessful(void)
 #endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
         ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
     };
-    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
 
-    /* Test deserialising the Stamp */
+    TEST_SUCCESS(ITC_SerDes_initStampDecoder(&t_Decoder));
+
+    /* Test feeding the Stamp in chunks of every possible size. The decoder is
+     * reused for every Stamp */
+    for (u32_ChunkSize = 1;
+         u32_ChunkSize <= sizeof(ru8_Buffer);
+         u32_ChunkSize++)
+    {
+        for (u32_Offset = 0;
+             u32_Offset < sizeof(ru8_Buffer);
+             u32_Offset += u32_ChunkSize)
+        {
+            TEST_SUCCESS(
+                ITC_SerDes_feedStampDecoder(
+                    &t_Decoder,
+                    &ru8_Buffer[u32_Offset],
+                    (u32_ChunkSize < sizeof(ru8_Buffer) - u32_Offset)
+                        ? u32_ChunkSize
+                        : (uint32_t)sizeof(ru8_Buffer) - u32_Offset));
+        }
+
+        TEST_SUCCESS(ITC_SerDes_finishStampDecoder(&t_Decoder, &pt_Stamp));
+
+        /* Test the Stamp is the same as the serialised one */
+        u32_SerialisedBufferSize = sizeof(ru8_SerialisedBuffer);
+        TEST_SUCCESS(
+            ITC_SerDes_serialiseStamp(
+                pt_Stamp,
+                &ru8_SerialisedBuffer[0],
+                &u32_SerialisedBufferSize));
+        TEST_ASSERT_EQUAL(sizeof(ru8_Buffer), u32_SerialisedBufferSize);
+        TEST_ASSERT_EQUAL_MEMORY(
+            &ru8_Buffer[0], &ru8_SerialisedBuffer[0], sizeof(ru8_Buffer));
+
+        /* Destroy the Stamp */
+        TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Streaming deserialiser is disabled");
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
+}
+
+/* Test resetting the Stamp decoder halfway through a Stamp succeeds */
+void ITC_SerDes_Test_resetStampDecoderSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_STREAMING_DESERIALISER
+    ITC_SerDes_StampDecoder_t t_Decoder;
+    ITC_Stamp_t *pt_Stamp;
+    /* Serialised Stamp with a (1, 0) ID and a (0, 1, 0) Event */
+    uint8_t ru8_Buffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1),
+        3,
+        ITC_SERDES_PARENT_ID_HEADER,
+        ITC_SERDES_SEED_ID_HEADER,
+        ITC_SERDES_NULL_ID_HEADER,
+        4,
+        ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    TEST_SUCCESS(ITC_SerDes_initStampDecoder(&t_Decoder));
+
+    /* Abandon the Stamp halfway through its Event component. The partially
+     * deserialised trees must be released */
     TEST_SUCCESS(
-        ITC_SerDes_deserialiseStamp(&ru8_Buffer[0], u32_BufferSize, &pt_Stamp));
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_Buffer[0], sizeof(ru8_Buffer) - 2));
+    TEST_SUCCESS(ITC_SerDes_resetStampDecoder(&t_Decoder));
 
-    /* clang-format off */
-    /* Test this is a (0, ((1, 0), 1)) ID */
-    TEST_ITC_ID_IS_NULL_ID(pt_Stamp->pt_Id->pt_Left);
-    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id->pt_Right->pt_Left);
-    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id->pt_Right->pt_Right);
-    /* Test this is a (0, 1, (0, (4242, 0, UINT32_MAX/UINT64_MAX), 0)) Event */
+    /* Test the decoder can deserialise a whole Stamp afterwards */
+    TEST_SUCCESS(
+        ITC_SerDes_feedStampDecoder(
+            &t_Decoder, &ru8_Buffer[0], sizeof(ru8_Buffer)));
+    TEST_SUCCESS(ITC_SerDes_finishStampDecoder(&t_Decoder, &pt_Stamp));
+
+    /* Test this is a Stamp with a (1, 0) ID and a (0, 1, 0) Event */
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id);
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
-    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
-    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left, 4242);
-    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Left, 0);
-#if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
-    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right, UINT64_MAX);
-#else
-    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right, UINT32_MAX);
-#endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
-    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Right, 0);
-    /* clang-format on */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
 
     /* Destroy the Stamp */
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Streaming deserialiser is disabled");
+#endif /* ITC_CONFIG_ENABLE_STREAMING_DESERIALISER */
 }
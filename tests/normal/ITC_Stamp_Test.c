@@ -13,16 +13,119 @@
 #include "ITC_Event_package.h"
 #include "ITC_Id_package.h"
 #include "ITC_Port.h"
+#include "ITC_SerDes.h"
 
 #include "ITC_Test_package.h"
 #include "ITC_TestUtil.h"
 #include "ITC_Config.h"
 
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#include <string.h>
+
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
 #include "ITC_Port.h"
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 
-#include <string.h>
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#if ITC_CONFIG_ENABLE_TRACING
+
+/******************************************************************************
+ *  Types
+ ******************************************************************************/
+
+/**
+ * @brief The calls made to the tracing hooks
+ */
+typedef struct
+{
+    /** The number of begin hook calls for each phase */
+    uint32_t ru32_Begins[ITC_PORT_TRACE_PHASE_COUNT];
+    /** The number of end hook calls for each phase */
+    uint32_t ru32_Ends[ITC_PORT_TRACE_PHASE_COUNT];
+    /** The tree size passed to the last end hook call of each phase */
+    uint32_t ru32_TreeSizes[ITC_PORT_TRACE_PHASE_COUNT];
+    /** The number of phases that have begun but not ended yet */
+    uint32_t u32_OpenPhases;
+} TraceCalls_t;
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+#if ITC_CONFIG_ENABLE_TRACING
+
+/**
+ * @brief Tracing begin hook recording the calls
+ *
+ * @param pv_UserData The recorded calls. Points to `TraceCalls_t`
+ * @param t_Phase The phase
+ */
+static void traceBegin(
+    void *pv_UserData,
+    ITC_Port_TracePhase_t t_Phase
+)
+{
+    TraceCalls_t *pt_Calls = (TraceCalls_t *)pv_UserData;
+
+    pt_Calls->ru32_Begins[t_Phase]++;
+    pt_Calls->u32_OpenPhases++;
+}
+
+/**
+ * @brief Tracing end hook recording the calls
+ *
+ * @param pv_UserData The recorded calls. Points to `TraceCalls_t`
+ * @param t_Phase The phase
+ * @param u32_TreeSize The size of the resulting tree
+ */
+static void traceEnd(
+    void *pv_UserData,
+    ITC_Port_TracePhase_t t_Phase,
+    uint32_t u32_TreeSize
+)
+{
+    TraceCalls_t *pt_Calls = (TraceCalls_t *)pv_UserData;
+
+    pt_Calls->ru32_Ends[t_Phase]++;
+    pt_Calls->ru32_TreeSizes[t_Phase] = u32_TreeSize;
+    pt_Calls->u32_OpenPhases--;
+}
+
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+
+/**
+ * @brief Test executor running the jobs in reverse order
+ *
+ * Stops at the first failed job
+ *
+ * @param pv_UserData The number of jobs run so far. Points to `uint32_t`
+ * @param pf_Job The job to run
+ * @param pv_JobContext The context of the job
+ * @param u32_JobCount The number of jobs
+ * @return `ITC_Status_t` The status of the first failed job
+ */
+static ITC_Status_t runJobsInReverse(
+    void *pv_UserData,
+    ITC_Status_t (*pf_Job)(void *pv_JobContext, uint32_t u32_Job),
+    void *pv_JobContext,
+    uint32_t u32_JobCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+
+    for (uint32_t u32_I = u32_JobCount;
+         u32_I > 0 && t_Status == ITC_STATUS_SUCCESS;
+         u32_I--)
+    {
+        t_Status = pf_Job(pv_JobContext, u32_I - 1);
+        (*(uint32_t *)pv_UserData)++;
+    }
+
+    return t_Status;
+}
 
 /******************************************************************************
  *  Public functions
@@ -31,15 +134,21 @@
 /* Init test */
 void setUp(void)
 {
-#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
     static bool b_MemoryInit = false;
 
     if (!b_MemoryInit)
     {
         TEST_SUCCESS(ITC_Port_init());
+#if ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+        ITC_TestUtil_initTestContext();
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
         b_MemoryInit = true;
     }
-#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+#endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT */
 }
 
 /* Fini test */
@@ -77,7 +186,17 @@ void tearDown(void)
                (const void *)&((uint8_t *)gpt_ItcStampNodeAllocationArray)[1],
                (gu32_ItcStampNodeAllocationArrayLength * sizeof(ITC_Stamp_t)) -
                    1));
+#elif ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONCURRENT_FREE_LIST || \
+    ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_CONTEXT
+    /* Test all memory is freed at the end of each test */
+    ITC_TestUtil_testAllStaticNodesAreFree();
 #endif /* ITC_CONFIG_MEMORY_ALLOCATION_TYPE == ITC_MEMORY_ALLOCATION_TYPE_STATIC */
+
+#if ITC_CONFIG_ENABLE_SCRATCH_ARENA
+    /* Test the scratch arena is released at the end of each test */
+    ITC_TestUtil_testScratchArenaIsEmpty();
+#endif /* ITC_CONFIG_ENABLE_SCRATCH_ARENA */
 }
 
 /* Test destroying a Stamp fails with invalid param */
@@ -336,8 +455,18 @@ void ITC_Stamp_Test_cloneStampSuccessful(void)
     TEST_SUCCESS(ITC_Stamp_newSeed(&pt_OriginalStamp));
     TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_ClonedStamp));
     TEST_ASSERT_TRUE(pt_OriginalStamp != pt_ClonedStamp);
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    /* The interned ID is shared instead */
+    TEST_ASSERT_TRUE(pt_OriginalStamp->pt_Id == pt_ClonedStamp->pt_Id);
+#else
     TEST_ASSERT_TRUE(pt_OriginalStamp->pt_Id != pt_ClonedStamp->pt_Id);
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    /* The Event history is shared instead */
+    TEST_ASSERT_TRUE(pt_OriginalStamp->pt_Event == pt_ClonedStamp->pt_Event);
+#else
     TEST_ASSERT_TRUE(pt_OriginalStamp->pt_Event != pt_ClonedStamp->pt_Event);
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
 
     /* Test the cloned Stamp has a Seed ID node with leaf Event with 0 events */
@@ -550,7 +679,12 @@ void ITC_Stamp_Test_forkStampSuccessful(void)
     /* Test the ID was cloned and split and the Event history was cloned */
     TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id);
     TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherStamp->pt_Id);
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    /* The Event history is shared instead */
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event == pt_OtherStamp->pt_Event);
+#else
     TEST_ASSERT_TRUE(pt_Stamp->pt_Event != pt_OtherStamp->pt_Event);
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherStamp->pt_Event, 0);
 
@@ -674,6 +808,37 @@ void ITC_Stamp_Test_joinStampFailWithCorruptIdOrEvent(void)
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
 }
 
+/* Test joining two Stamps fails with overlapping ID intervals */
+void ITC_Stamp_Test_joinStampsFailWithOverlappingIdInterval(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+
+    /* Create the Stamps. Both own the (0, 1) interval */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_OtherStamp, &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_OVERLAPPING_ID_INTERVAL);
+
+    /* Test the Stamps haven't changed */
+    TEST_SUCCESS(ITC_Stamp_validate(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_validate(pt_OtherStamp));
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Stamp->pt_Id);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherStamp->pt_Id);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherStamp->pt_Event, 0);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+}
+
 /* Test joining two Stamps succeeds */
 void ITC_Stamp_Test_joinStampsSuccessful(void)
 {
@@ -697,6 +862,257 @@ void ITC_Stamp_Test_joinStampsSuccessful(void)
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
 }
 
+/* Test joining an array of Stamps fails with invalid param */
+void ITC_Stamp_Test_joinManyStampsFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_JoinedStamp = NULL;
+    ITC_Stamp_t *rpt_Stamps[2];
+
+    TEST_FAILURE(
+        ITC_Stamp_joinMany(NULL, 1, &pt_JoinedStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_joinManyConst(NULL, 1, &pt_JoinedStamp),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    rpt_Stamps[0] = pt_Stamp;
+    rpt_Stamps[1] = NULL;
+
+    TEST_FAILURE(
+        ITC_Stamp_joinMany(&rpt_Stamps[0], 0, &pt_JoinedStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_joinManyConst(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0], 0, &pt_JoinedStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_joinMany(&rpt_Stamps[0], 1, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_joinManyConst(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0], 1, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test `NULL` Stamps are rejected */
+    TEST_FAILURE(
+        ITC_Stamp_joinMany(&rpt_Stamps[0], 2, &pt_JoinedStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_joinManyConst(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0], 2, &pt_JoinedStamp),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test duplicate Stamps are rejected */
+    rpt_Stamps[1] = pt_Stamp;
+
+    TEST_FAILURE(
+        ITC_Stamp_joinMany(&rpt_Stamps[0], 2, &pt_JoinedStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_joinManyConst(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0], 2, &pt_JoinedStamp),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test the Stamp hasn't changed */
+    TEST_ASSERT_EQUAL_PTR(pt_Stamp, rpt_Stamps[0]);
+    TEST_ASSERT_NULL(pt_JoinedStamp);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test joining an array of Stamps fails with corrupt stamp */
+void ITC_Stamp_Test_joinManyStampsFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_JoinedStamp = NULL;
+    ITC_Stamp_t *rpt_Stamps[2];
+
+    /* Construct the other Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_OtherStamp));
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure in both positions of the array */
+        for (uint32_t u32_J = 0; u32_J < ARRAY_COUNT(rpt_Stamps); u32_J++)
+        {
+            rpt_Stamps[u32_J] = pt_Stamp;
+            rpt_Stamps[1 - u32_J] = pt_OtherStamp;
+
+            TEST_ASSERT_NOT_EQUAL(
+                ITC_Stamp_joinMany(
+                    &rpt_Stamps[0], ARRAY_COUNT(rpt_Stamps), &pt_JoinedStamp),
+                /* Depending on the failure, different exceptions might be
+                 * returned */
+                ITC_STATUS_SUCCESS);
+            TEST_ASSERT_NOT_EQUAL(
+                ITC_Stamp_joinManyConst(
+                    (const ITC_Stamp_t *const *)&rpt_Stamps[0],
+                    ARRAY_COUNT(rpt_Stamps),
+                    &pt_JoinedStamp),
+                /* Depending on the failure, different exceptions might be
+                 * returned */
+                ITC_STATUS_SUCCESS);
+
+            /* Test the Stamps are still there */
+            TEST_ASSERT_EQUAL_PTR(pt_Stamp, rpt_Stamps[u32_J]);
+            TEST_ASSERT_EQUAL_PTR(pt_OtherStamp, rpt_Stamps[1 - u32_J]);
+            TEST_ASSERT_NULL(pt_JoinedStamp);
+        }
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+
+    /* Destroy the other Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+}
+
+/* Test joining an array of Stamps fails with overlapping ID intervals */
+void ITC_Stamp_Test_joinManyStampsFailWithOverlappingIdInterval(void)
+{
+    ITC_Stamp_t *pt_JoinedStamp = NULL;
+    ITC_Stamp_t *rpt_Stamps[3];
+
+    /* Create the Stamps. The last 2 both own the (0, 1) interval */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[1], &rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_Stamp_joinManyConst(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0],
+            ARRAY_COUNT(rpt_Stamps),
+            &pt_JoinedStamp),
+        ITC_STATUS_OVERLAPPING_ID_INTERVAL);
+    TEST_FAILURE(
+        ITC_Stamp_joinMany(
+            &rpt_Stamps[0], ARRAY_COUNT(rpt_Stamps), &pt_JoinedStamp),
+        ITC_STATUS_OVERLAPPING_ID_INTERVAL);
+
+    /* Test the Stamps haven't changed */
+    TEST_ASSERT_NULL(pt_JoinedStamp);
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_validate(rpt_Stamps[u32_I]));
+    }
+
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(rpt_Stamps[0]->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(rpt_Stamps[1]->pt_Event, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(rpt_Stamps[2]->pt_Event, 0);
+
+    /* Destroy the Stamps */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+}
+
+/* Test joining an array of Stamps succeeds */
+void ITC_Stamp_Test_joinManyStampsSuccessful(void)
+{
+    ITC_Stamp_t *rpt_Stamps[5];
+    ITC_Stamp_t *pt_ExpectedStamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_JoinedStamp;
+    ITC_Stamp_t *pt_ConstJoinedStamp;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Test joining a single Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[0]));
+    pt_OtherStamp = rpt_Stamps[0];
+
+    TEST_SUCCESS(
+        ITC_Stamp_joinManyConst(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0], 1, &pt_ConstJoinedStamp));
+    TEST_SUCCESS(ITC_Stamp_joinMany(&rpt_Stamps[0], 1, &pt_JoinedStamp));
+
+    TEST_ASSERT_NULL(rpt_Stamps[0]);
+    TEST_ASSERT_EQUAL_PTR(pt_OtherStamp, pt_JoinedStamp);
+    TEST_ITC_ID_IS_SEED_ID(pt_JoinedStamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_JoinedStamp->pt_Event, 1);
+    TEST_ITC_ID_IS_SEED_ID(pt_ConstJoinedStamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_ConstJoinedStamp->pt_Event, 1);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_JoinedStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_ConstJoinedStamp));
+
+    /* Create Stamps with distinct IDs and diverging event histories */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+
+    for (uint32_t u32_I = 1; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[u32_I / 2], &rpt_Stamps[u32_I]));
+
+        for (uint32_t u32_J = 0; u32_J < u32_I; u32_J++)
+        {
+            TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[u32_I]));
+        }
+    }
+
+    /* Join copies of the Stamps one pair at a time for comparison */
+    TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[0], &pt_ExpectedStamp));
+
+    for (uint32_t u32_I = 1; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[u32_I], &pt_OtherStamp));
+        TEST_SUCCESS(ITC_Stamp_join(&pt_ExpectedStamp, &pt_OtherStamp));
+    }
+
+    /* Join the Stamps without modifying them */
+    TEST_SUCCESS(
+        ITC_Stamp_joinManyConst(
+            (const ITC_Stamp_t *const *)&rpt_Stamps[0],
+            ARRAY_COUNT(rpt_Stamps),
+            &pt_ConstJoinedStamp));
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_validate(rpt_Stamps[u32_I]));
+    }
+
+    /* Join the Stamps in place */
+    TEST_SUCCESS(
+        ITC_Stamp_joinMany(
+            &rpt_Stamps[0], ARRAY_COUNT(rpt_Stamps), &pt_JoinedStamp));
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_ASSERT_NULL(rpt_Stamps[u32_I]);
+    }
+
+    /* Test the joined Stamps match joining them one pair at a time */
+    TEST_ITC_ID_IS_SEED_ID(pt_JoinedStamp->pt_Id);
+    TEST_ITC_ID_IS_SEED_ID(pt_ConstJoinedStamp->pt_Id);
+    TEST_SUCCESS(ITC_Stamp_validate(pt_JoinedStamp));
+    TEST_SUCCESS(ITC_Stamp_validate(pt_ConstJoinedStamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compare(pt_JoinedStamp, pt_ExpectedStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(
+        ITC_Stamp_compare(pt_ConstJoinedStamp, pt_ExpectedStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_JoinedStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_ConstJoinedStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_ExpectedStamp));
+}
+
 /* Test inflating the Event of as Stamp fails with invalid param */
 void ITC_Stamp_Test_eventStampFailInvalidParam(void)
 {
@@ -848,186 +1264,1423 @@ void ITC_Stamp_Test_eventStampSuccessful(void)
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
 }
 
-/* Test comparing Stamps fails with invalid param */
-void ITC_Stamp_Test_compareStampsFailInvalidParam(void)
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+
+/* Add an event to a Stamp and check the result matches running fill and grow
+ * directly on a copy of its Event */
+static void eventStampAndCheckAgainstFillAndGrow(ITC_Stamp_t *const pt_Stamp)
 {
-    ITC_Stamp_t *pt_DummyStamp = NULL;
-    ITC_Stamp_Comparison_t t_DummyResult;
+    ITC_Event_t *pt_ExpectedEvent;
+    bool b_WasFilled;
+    bool b_IsLeq12;
+    bool b_IsLeq21;
 
-    TEST_FAILURE(
-        ITC_Stamp_compare(
-            pt_DummyStamp,
-            pt_DummyStamp,
-            NULL),
-        ITC_STATUS_INVALID_PARAM);
-    TEST_FAILURE(
-        ITC_Stamp_compare(
-            pt_DummyStamp,
-            NULL,
-            &t_DummyResult),
-        ITC_STATUS_INVALID_PARAM);
-    TEST_FAILURE(
-        ITC_Stamp_compare(
-            NULL,
-            pt_DummyStamp,
-            &t_DummyResult),
-        ITC_STATUS_INVALID_PARAM);
-    TEST_FAILURE(
-        ITC_Stamp_compare(
-            pt_DummyStamp,
-            pt_DummyStamp,
-            &t_DummyResult),
-        ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Event_clone(pt_Stamp->pt_Event, &pt_ExpectedEvent));
+    TEST_SUCCESS(
+        ITC_Event_fill(&pt_ExpectedEvent, pt_Stamp->pt_Id, &b_WasFilled));
+
+    if (!b_WasFilled)
+    {
+        TEST_SUCCESS(ITC_Event_grow(&pt_ExpectedEvent, pt_Stamp->pt_Id));
+    }
+
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    /* Normalised Events are only equal if they have the same shape */
+    TEST_SUCCESS(ITC_Event_validate(pt_Stamp->pt_Event));
+    TEST_SUCCESS(
+        ITC_Event_leqBidirectional(
+            pt_Stamp->pt_Event, pt_ExpectedEvent, &b_IsLeq12, &b_IsLeq21));
+    TEST_ASSERT_TRUE(b_IsLeq12);
+    TEST_ASSERT_TRUE(b_IsLeq21);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_ExpectedEvent));
 }
 
-/* Test comparing an Stamp fails with corrupt Stamp */
-void ITC_Stamp_Test_compareStampFailWithCorruptStamp(void)
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+
+/* Test adding events using the inflation cache gives the same result as
+ * filling and growing the Event */
+void ITC_Stamp_Test_eventStampWithInflationCacheSuccessful(void)
 {
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+    ITC_Stamp_t *pt_Stamp0;
     ITC_Stamp_t *pt_Stamp1;
     ITC_Stamp_t *pt_Stamp2;
-    ITC_Stamp_Comparison_t t_Result;
+    ITC_Stamp_t *pt_PeekStamp;
+    ITC_Stamp_t *rpt_Stamps[3];
+    ITC_Event_t *pt_CachedLeaf;
 
-    /* Test different invalid Stamps are handled properly */
-    for (uint32_t u32_I = 0;
-         u32_I < gu32_InvalidStampTablesSize;
-         u32_I++)
+    /* Create the Stamps with IDs (1, 0), (0, (1, 0)) and (0, (0, 1)) */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp0));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp0, &pt_Stamp1));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp1, &pt_Stamp2));
+
+    rpt_Stamps[0] = pt_Stamp0;
+    rpt_Stamps[1] = pt_Stamp1;
+    rpt_Stamps[2] = pt_Stamp2;
+
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
     {
-        /* Construct an invalid Stamp */
-        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp1);
+        /* Nothing is cached before the first event */
+        TEST_ASSERT_NULL(rpt_Stamps[u32_I]->pt_InflationLeaf);
 
-        /* Construct the other Stamp */
-        TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp2));
+        for (uint32_t u32_J = 0; u32_J < 4; u32_J++)
+        {
+            eventStampAndCheckAgainstFillAndGrow(rpt_Stamps[u32_I]);
+        }
 
-        /* Test for the failure */
-        TEST_ASSERT_NOT_EQUAL(
-            ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result),
-            /* Depending on the failure, different exceptions might be
-             * returned */
-            ITC_STATUS_SUCCESS);
-        /* And the other way around */
-        TEST_ASSERT_NOT_EQUAL(
-            ITC_Stamp_compare(pt_Stamp2, pt_Stamp1, &t_Result),
-            /* Depending on the failure, different exceptions might be
-             * returned */
+        /* Each of these IDs owns a single interval */
+        TEST_ASSERT_NOT_NULL(rpt_Stamps[u32_I]->pt_InflationLeaf);
+    }
+
+    /* Test repeated events only increment the cached leaf */
+    pt_CachedLeaf = pt_Stamp2->pt_InflationLeaf;
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp2));
+    TEST_ASSERT_EQUAL_PTR(pt_CachedLeaf, pt_Stamp2->pt_InflationLeaf);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_CachedLeaf, 5);
+
+    /* Test joining invalidates the cache. Joining a peek Stamp raises the
+     * counters around the cached leaf */
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp2, &pt_PeekStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp0, &pt_PeekStamp));
+    TEST_ASSERT_NULL(pt_Stamp0->pt_InflationLeaf);
+
+    for (uint32_t u32_J = 0; u32_J < 4; u32_J++)
+    {
+        eventStampAndCheckAgainstFillAndGrow(pt_Stamp0);
+    }
+
+    /* Test forking invalidates the cache */
+    TEST_ASSERT_NOT_NULL(pt_Stamp1->pt_InflationLeaf);
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp1, &pt_PeekStamp));
+    TEST_ASSERT_NULL(pt_Stamp1->pt_InflationLeaf);
+    TEST_ASSERT_NULL(pt_PeekStamp->pt_InflationLeaf);
+
+    for (uint32_t u32_J = 0; u32_J < 4; u32_J++)
+    {
+        eventStampAndCheckAgainstFillAndGrow(pt_Stamp1);
+        eventStampAndCheckAgainstFillAndGrow(pt_PeekStamp);
+    }
+
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp1, &pt_PeekStamp));
+
+    /* Test the cache is never used for IDs owning more than one interval.
+     * The ID is now (1, (0, 1)) */
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp0, &pt_Stamp2));
+
+    for (uint32_t u32_J = 0; u32_J < 4; u32_J++)
+    {
+        eventStampAndCheckAgainstFillAndGrow(pt_Stamp0);
+        TEST_ASSERT_NULL(pt_Stamp0->pt_InflationLeaf);
+    }
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp0));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp1));
+#else
+    TEST_IGNORE_MESSAGE("Stamp inflation cache is disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+}
+
+/* Test adding an event using the inflation cache fails with event counter
+ * overflow */
+void ITC_Stamp_Test_eventStampWithInflationCacheFailWithEventCounterOverflow(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE
+    ITC_Stamp_t *pt_Stamp;
+
+    /* Create a new Stamp and cache the inflation leaf */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_ASSERT_EQUAL_PTR(pt_Stamp->pt_Event, pt_Stamp->pt_InflationLeaf);
+
+    /* Max out the counter */
+    pt_Stamp->pt_Event->t_Count = ((ITC_Event_Counter_t)~0);
+
+    /* Test for the failure */
+    TEST_FAILURE(ITC_Stamp_event(pt_Stamp), ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    /* Test the Event hasn't changed */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, ((ITC_Event_Counter_t)~0));
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Stamp inflation cache is disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_INFLATION_CACHE */
+}
+
+/* Test adding multiple events to a Stamp fails with invalid param */
+void ITC_Stamp_Test_eventNStampFailInvalidParam(void)
+{
+    TEST_FAILURE(ITC_Stamp_eventN(NULL, 2), ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test adding multiple events to a Stamp fails with corrupt stamp */
+void ITC_Stamp_Test_eventNStampFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_eventN(pt_Stamp, 2),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+}
+
+/* Test adding multiple events to a Stamp fails with event counter overflow */
+void ITC_Stamp_Test_eventNStampFailWithEventCounterOverflow(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+
+    /* Create a new Stamp. With the inflation cache enabled, this also caches
+     * the inflation leaf, so both code paths get tested */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    /* Leave room for 2 more events */
+    pt_Stamp->pt_Event->t_Count = ((ITC_Event_Counter_t)~0) - 2;
+
+    /* Test for the failure */
+    TEST_FAILURE(
+        ITC_Stamp_eventN(pt_Stamp, 3), ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    /* Test the Event hasn't changed */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(
+        pt_Stamp->pt_Event, ((ITC_Event_Counter_t)~0) - 2);
+
+    /* Test adding the events that fit succeeds */
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_Stamp, 2));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, ((ITC_Event_Counter_t)~0));
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test adding multiple events to a Stamp succeeds */
+void ITC_Stamp_Test_eventNStampSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_PeekStamp;
+    ITC_Stamp_t *pt_OriginalStamp;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Retain a copy for comparison */
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_OriginalStamp));
+
+    /* Test adding no events does nothing */
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_Stamp, 0));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
+
+    /* Inflate the Stamp Event tree by growing it */
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_Stamp, 5));
+
+    /* Test the Event counter has grown by all events */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 5);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OriginalStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+
+    /* Test adding events again also works */
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_Stamp, 2));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 7);
+
+    /* Create a new peek Stamp */
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_PeekStamp));
+
+    /* Attempt to inflate the peek Stamp */
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_PeekStamp, 3));
+
+    /* Test the Event counter has not changed */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_PeekStamp->pt_Event, 7);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_PeekStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Add children to the Event tree */
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 3));
+
+    /* Inflate the Stamp Event tree. Filling it only counts as 1 event */
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_Stamp, 4));
+
+    /* Test the Event counter has been filled and grown */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 6);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    /* Test adding multiple events matches adding the same number of events
+     * one at a time */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_OtherStamp, &pt_PeekStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_PeekStamp));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_OriginalStamp));
+
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_Stamp, 3));
+
+    for (uint32_t u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_event(pt_OriginalStamp));
+    }
+
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OriginalStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
+}
+
+/* Create a Stamp with the ID `(1, 0)` and the Event
+ * `(0, (1, 0, (0, 0, 2)), (0, 3, 0))` */
+static void newFragmentedStamp(ITC_Stamp_t **const ppt_Stamp)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Event_t *pt_Event;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(ppt_Stamp));
+
+    /* Replace the seed ID with `(1, 0)` */
+    TEST_SUCCESS(ITC_Id_destroy(&(*ppt_Stamp)->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&(*ppt_Stamp)->pt_Id, NULL));
+    pt_Id = (*ppt_Stamp)->pt_Id;
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+
+    /* Build the Event tree */
+    pt_Event = (*ppt_Stamp)->pt_Event;
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    pt_Event = (*ppt_Stamp)->pt_Event->pt_Left;
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    pt_Event = pt_Event->pt_Right;
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 2));
+    pt_Event = (*ppt_Stamp)->pt_Event->pt_Right;
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+}
+
+/* Test compacting the Event of a Stamp fails with invalid param */
+void ITC_Stamp_Test_compactStampFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    uint32_t u32_ReclaimedNodes;
+
+    TEST_FAILURE(
+        ITC_Stamp_compact(NULL, 0, &u32_ReclaimedNodes),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_FAILURE(
+        ITC_Stamp_compact(pt_Stamp, 0, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test compacting the Event of a Stamp fails with corrupt stamp */
+void ITC_Stamp_Test_compactStampFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    uint32_t u32_ReclaimedNodes;
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_compact(pt_Stamp, 0, &u32_ReclaimedNodes),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+}
+
+/* Test compacting the Event of a Stamp succeeds */
+void ITC_Stamp_Test_compactStampSucceeds(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OriginalStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint32_t u32_ReclaimedNodes;
+
+    /* Test compacting an already compact Stamp does nothing */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_compact(pt_Stamp, 0, &u32_ReclaimedNodes));
+    TEST_ASSERT_EQUAL_UINT32(0, u32_ReclaimedNodes);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 1);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    /* Test only the owned subtrees below the given depth are collapsed */
+    newFragmentedStamp(&pt_Stamp);
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_OriginalStamp));
+
+    TEST_SUCCESS(ITC_Stamp_compact(pt_Stamp, 2, &u32_ReclaimedNodes));
+    TEST_ASSERT_EQUAL_UINT32(2, u32_ReclaimedNodes);
+
+    /* The Event is now `(0, (1, 0, 2), (0, 3, 0))` */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left->pt_Right, 2);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Right, 0);
+    TEST_SUCCESS(ITC_Stamp_validate(pt_Stamp));
+
+    /* Test the compacted Stamp is an inflation of the original one */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OriginalStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+
+    /* Test compacting from the root collapses the whole owned interval but
+     * leaves the rest of the Event as it is */
+    TEST_SUCCESS(ITC_Stamp_compact(pt_Stamp, 0, &u32_ReclaimedNodes));
+    TEST_ASSERT_EQUAL_UINT32(2, u32_ReclaimedNodes);
+
+    /* The Event is now `(0, 3, (0, 3, 0))` */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 3);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Right, 0);
+    TEST_SUCCESS(ITC_Stamp_validate(pt_Stamp));
+
+    /* Test the compacted Stamp can still be used */
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 4);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
+
+    /* Test the Stamp is left unmodified if nothing the ID owns is deep
+     * enough */
+    newFragmentedStamp(&pt_Stamp);
+    TEST_SUCCESS(ITC_Stamp_compact(pt_Stamp, 3, &u32_ReclaimedNodes));
+    TEST_ASSERT_EQUAL_UINT32(0, u32_ReclaimedNodes);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(
+        pt_Stamp->pt_Event->pt_Left->pt_Right, 0);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test joined Stamps are compacted automatically */
+void ITC_Stamp_Test_joinStampsWithCompactionSucceeds(void)
+{
+#if ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_PeekStamp;
+    uint32_t u32_ReclaimedNodes;
+
+    newFragmentedStamp(&pt_Stamp);
+
+    /* Joining a peek Stamp of the fragmented Stamp compacts it */
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_PeekStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_PeekStamp));
+
+    /* Test there is nothing left to compact */
+    TEST_SUCCESS(
+        ITC_Stamp_compact(
+            pt_Stamp,
+            ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH,
+            &u32_ReclaimedNodes));
+    TEST_ASSERT_EQUAL_UINT32(0, u32_ReclaimedNodes);
+
+    /* Test the same goes for Stamps joined through the other join
+     * operations */
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compact(
+            pt_Stamp,
+            ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH,
+            &u32_ReclaimedNodes));
+    TEST_ASSERT_EQUAL_UINT32(0, u32_ReclaimedNodes);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Automatic join compaction is disabled");
+#endif /* ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
+}
+
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+
+/* Create a Stamp with a seed ID and the Event `(0, 1, (0, 2, 0))`. It is
+ * `<=` the Event of the Stamp created by `newFragmentedStamp` */
+static void newBaseStamp(ITC_Stamp_t **const ppt_Stamp)
+{
+    ITC_Event_t *pt_Event;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(ppt_Stamp));
+
+    /* Build the Event tree */
+    pt_Event = (*ppt_Stamp)->pt_Event;
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    pt_Event = pt_Event->pt_Right;
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+
+/* Test rebasing a Stamp fails with invalid param */
+void ITC_Stamp_Test_rebaseStampFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_Comparison_t t_Result;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(ITC_Stamp_rebase(NULL, pt_Stamp), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Stamp_rebase(pt_Stamp, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_unrebase(NULL, pt_Stamp), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_unrebase(pt_Stamp, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compareRebased(pt_Stamp, NULL, pt_Stamp, NULL, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compareRebased(NULL, NULL, pt_Stamp, NULL, &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compareRebased(NULL, pt_Stamp, pt_Stamp, NULL, &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Event rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+}
+
+/* Test rebasing a Stamp fails with corrupt stamp */
+void ITC_Stamp_Test_rebaseStampFailWithCorruptStamp(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_OtherStamp));
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp);
+
+        /* Test for the failure. Depending on the failure, different
+         * exceptions might be returned */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_rebase(pt_Stamp, pt_OtherStamp), ITC_STATUS_SUCCESS);
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_rebase(pt_OtherStamp, pt_Stamp), ITC_STATUS_SUCCESS);
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_unrebase(pt_OtherStamp, pt_Stamp), ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp);
+    }
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+#else
+    TEST_IGNORE_MESSAGE("Event rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+}
+
+/* Test rebasing a Stamp onto a base it does not dominate fails and leaves
+ * the Stamp unmodified */
+void ITC_Stamp_Test_rebaseStampFailWithEventCounterUnderflow(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_Base;
+
+    newBaseStamp(&pt_Stamp);
+    newFragmentedStamp(&pt_Base);
+
+    TEST_FAILURE(
+        ITC_Stamp_rebase(pt_Stamp, pt_Base),
+        ITC_STATUS_EVENT_COUNTER_UNDERFLOW);
+
+    /* The Event is still `(0, 1, (0, 2, 0))` */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Right, 0);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+#else
+    TEST_IGNORE_MESSAGE("Event rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+}
+
+/* Test rebasing a Stamp and adding the base back succeeds */
+void ITC_Stamp_Test_rebaseStampSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OriginalStamp;
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_Comparison_t t_Result;
+
+    newFragmentedStamp(&pt_Stamp);
+    newBaseStamp(&pt_Base);
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_OriginalStamp));
+
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_Stamp, pt_Base));
+
+    /* `(0, (1, 0, (0, 0, 2)), (0, 3, 0)) - (0, 1, (0, 2, 0))` is
+     * `(0, (0, 0, (0, 0, 2)), (0, 1, 0))` */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left->pt_Left, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(
+        pt_Stamp->pt_Event->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(
+        pt_Stamp->pt_Event->pt_Left->pt_Right->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(
+        pt_Stamp->pt_Event->pt_Left->pt_Right->pt_Right, 2);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Right, 0);
+    TEST_SUCCESS(ITC_Stamp_validate(pt_Stamp));
+
+    /* Test adding the base back restores the original Stamp */
+    TEST_SUCCESS(ITC_Stamp_unrebase(pt_Stamp, pt_Base));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left->pt_Left, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(
+        pt_Stamp->pt_Event->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right->pt_Left, 3);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OriginalStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Test rebasing a Stamp onto itself leaves no events */
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_Stamp, pt_OriginalStamp));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
+
+    /* Test the base can be added back to a Stamp it does not dominate */
+    TEST_SUCCESS(ITC_Stamp_unrebase(pt_Base, pt_OriginalStamp));
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_Base, pt_OriginalStamp));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Base->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Base->pt_Event->pt_Left, 1);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+#else
+    TEST_IGNORE_MESSAGE("Event rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+}
+
+/* Test rebasing a Stamp shrinks its serialised size, and the rebased Stamps
+ * can still be used as usual */
+void ITC_Stamp_Test_rebasedStampsCanBeUsed(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_REBASING
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[32];
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    uint32_t u32_OriginalSize;
+
+    /* A Stamp that has been around for a while */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_Stamp, 100000));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_Base));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    u32_OriginalSize = u32_BufferSize;
+
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_Stamp, pt_Base));
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_OtherStamp, pt_Base));
+
+    /* The rebased counters fit in a single byte */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_TRUE(u32_BufferSize < u32_OriginalSize);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+
+    /* Test Stamps rebased onto the same base compare as the originals */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+    TEST_SUCCESS(ITC_Stamp_compareRebased(
+        pt_Stamp, pt_Base, pt_OtherStamp, pt_Base, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+
+    /* Test the rebased Stamps can be joined */
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+
+    /* Test comparing against a Stamp that was not rebased */
+    TEST_SUCCESS(ITC_Stamp_compareRebased(
+        pt_Stamp, pt_Base, pt_Base, NULL, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+    TEST_SUCCESS(ITC_Stamp_compareRebased(
+        pt_Base, NULL, pt_Stamp, pt_Base, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Result);
+
+    /* Test adding the base back restores the joined Stamp */
+    TEST_SUCCESS(ITC_Stamp_unrebase(pt_Stamp, pt_Base));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 100001);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right, 1);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+#else
+    TEST_IGNORE_MESSAGE("Event rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_REBASING */
+}
+
+/* Test comparing Stamps fails with invalid param */
+void ITC_Stamp_Test_compareStampsFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_DummyStamp = NULL;
+    ITC_Stamp_Comparison_t t_DummyResult;
+
+    TEST_FAILURE(
+        ITC_Stamp_compare(
+            pt_DummyStamp,
+            pt_DummyStamp,
+            NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compare(
+            pt_DummyStamp,
+            NULL,
+            &t_DummyResult),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compare(
+            NULL,
+            pt_DummyStamp,
+            &t_DummyResult),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compare(
+            pt_DummyStamp,
+            pt_DummyStamp,
+            &t_DummyResult),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test comparing an Stamp fails with corrupt Stamp */
+void ITC_Stamp_Test_compareStampFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *pt_Stamp1;
+    ITC_Stamp_t *pt_Stamp2;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_Stamp1);
+
+        /* Construct the other Stamp */
+        TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp2));
+
+        /* Test for the failure */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+        /* And the other way around */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_compare(pt_Stamp2, pt_Stamp1, &t_Result),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+
+        /* Destroy the Stamps */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp1);
+        TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp2));
+    }
+}
+
+/* Test comparing a Stamp fails with corrupt Id or Event */
+void ITC_Stamp_Test_compareStampFailWithCorruptIdOrEvent(void)
+{
+    ITC_Stamp_t *pt_Stamp1;
+    ITC_Stamp_t *pt_Stamp2;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Create a new stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp1));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp2));
+
+    /* Deallocate the valid ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Stamp1->pt_Id));
+
+    /* Test different invalid IDs are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidIdTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid ID */
+        gpv_InvalidIdConstructorTable[u32_I](&pt_Stamp1->pt_Id);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result),
+            ITC_STATUS_CORRUPT_ID);
+
+        /* Destroy the ID */
+        gpv_InvalidIdDestructorTable[u32_I](&pt_Stamp1->pt_Id);
+    }
+
+    /* Allocate a valid ID */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp1->pt_Id, NULL));
+
+    /* Deallocate the valid Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Stamp1->pt_Event));
+
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidEventTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Stamp1->pt_Event);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result),
+            ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Stamp1->pt_Event);
+    }
+
+    /* Deallocate the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp1));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp2));
+}
+
+/* Test comparing two Stamps succeeds */
+void ITC_Stamp_Test_compareStampsSucceeds(void)
+{
+    ITC_Stamp_t *pt_Stamp1;
+    ITC_Stamp_t *pt_Stamp2;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Create the Stamps. Do not create one from the other, as their Event
+     * trees are modified directly below and might be shared */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp1));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp2));
+
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Stamp1->pt_Event->pt_Left, pt_Stamp1->pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Stamp1->pt_Event->pt_Right, pt_Stamp1->pt_Event, 3));
+
+    pt_Stamp2->pt_Event->t_Count = 1;
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Stamp2->pt_Event->pt_Left, pt_Stamp2->pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Stamp2->pt_Event->pt_Right, pt_Stamp2->pt_Event, 2));
+
+    /* Compare Stamps */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Result);
+    /* Compare the other way around */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp2, pt_Stamp1, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+
+    /* Make the 2 Stamps concurrent */
+    pt_Stamp2->pt_Event->pt_Right->t_Count -= 1;
+
+    /* Compare Stamps */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+    /* Compare the other way around */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp2, pt_Stamp1, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+
+    /* Check stamps are equal to themselves */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp1, pt_Stamp1, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp2, pt_Stamp2, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp1));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp2));
+}
+
+/* Test comparing a Stamp against an array of Stamps fails with invalid param */
+void ITC_Stamp_Test_compareManyStampsFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    const ITC_Stamp_t *rpt_OtherStamps[1];
+    ITC_Stamp_Comparison_t rt_Results[1];
+    ITC_Stamp_Executor_t t_Executor = { 0 };
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    rpt_OtherStamps[0] = pt_Stamp;
+
+    TEST_FAILURE(
+        ITC_Stamp_compareMany(NULL, rpt_OtherStamps, 1, rt_Results, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compareMany(pt_Stamp, NULL, 1, rt_Results, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compareMany(pt_Stamp, rpt_OtherStamps, 0, rt_Results, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compareMany(pt_Stamp, rpt_OtherStamps, 1, NULL, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    /* Executor without a run callback */
+    TEST_FAILURE(
+        ITC_Stamp_compareMany(
+            pt_Stamp, rpt_OtherStamps, 1, rt_Results, &t_Executor),
+        ITC_STATUS_INVALID_PARAM);
+
+    rpt_OtherStamps[0] = NULL;
+    TEST_FAILURE(
+        ITC_Stamp_compareMany(pt_Stamp, rpt_OtherStamps, 1, rt_Results, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test comparing a Stamp against an array of Stamps fails with corrupt
+ * Stamp */
+void ITC_Stamp_Test_compareManyStampsFailWithCorruptStamp(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_InvalidStamp;
+    const ITC_Stamp_t *rpt_OtherStamps[3];
+    ITC_Stamp_Comparison_t rt_Results[3];
+    uint32_t u32_JobsRun;
+    ITC_Stamp_Executor_t t_Executor =
+    {
+        .pf_Run = runJobsInReverse,
+        .pv_UserData = (void *)&u32_JobsRun,
+        .u32_MaxJobs = 3,
+    };
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Test different invalid Stamps are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidStampTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Stamp */
+        gpv_InvalidStampConstructorTable[u32_I](&pt_InvalidStamp);
+
+        rpt_OtherStamps[0] = pt_Stamp;
+        rpt_OtherStamps[1] = pt_InvalidStamp;
+        rpt_OtherStamps[2] = pt_Stamp;
+
+        /* Test for the failure on the calling thread and through the
+         * executor */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_compareMany(
+                pt_Stamp, rpt_OtherStamps, 3, rt_Results, NULL),
+            /* Depending on the failure, different exceptions might be
+             * returned */
+            ITC_STATUS_SUCCESS);
+        u32_JobsRun = 0;
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_compareMany(
+                pt_Stamp, rpt_OtherStamps, 3, rt_Results, &t_Executor),
+            ITC_STATUS_SUCCESS);
+        TEST_ASSERT_EQUAL_UINT32(2, u32_JobsRun);
+        /* And with the invalid Stamp as the shared Stamp */
+        TEST_ASSERT_NOT_EQUAL(
+            ITC_Stamp_compareMany(
+                pt_InvalidStamp, rpt_OtherStamps, 1, rt_Results, NULL),
             ITC_STATUS_SUCCESS);
 
-        /* Destroy the Stamps */
-        gpv_InvalidStampDestructorTable[u32_I](&pt_Stamp1);
-        TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp2));
+        /* Destroy the Stamp */
+        gpv_InvalidStampDestructorTable[u32_I](&pt_InvalidStamp);
     }
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
 }
 
-/* Test comparing a Stamp fails with corrupt Id or Event */
-void ITC_Stamp_Test_compareStampFailWithCorruptIdOrEvent(void)
+/* Test comparing a Stamp against an array of Stamps succeeds */
+void ITC_Stamp_Test_compareManyStampsSucceeds(void)
 {
-    ITC_Stamp_t *pt_Stamp1;
-    ITC_Stamp_t *pt_Stamp2;
-    ITC_Stamp_Comparison_t t_Result;
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_ConcurrentStamp;
+    ITC_Stamp_t *pt_OlderStamp;
+    ITC_Stamp_t *pt_NewerStamp;
+    const ITC_Stamp_t *rpt_OtherStamps[4];
+    const ITC_Stamp_Comparison_t rt_ExpectedResults[] =
+    {
+        ITC_STAMP_COMPARISON_GREATER_THAN,
+        ITC_STAMP_COMPARISON_LESS_THAN,
+        ITC_STAMP_COMPARISON_CONCURRENT,
+        ITC_STAMP_COMPARISON_EQUAL,
+    };
+    ITC_Stamp_Comparison_t rt_Results[4];
+    const uint32_t ru32_MaxJobs[] = {0, 1, 2, 3, 100};
+    const uint32_t ru32_ExpectedJobsRun[] = {0, 0, 2, 3, 4};
+    uint32_t u32_JobsRun;
+    ITC_Stamp_Executor_t t_Executor =
+    {
+        .pf_Run = runJobsInReverse,
+        .pv_UserData = (void *)&u32_JobsRun,
+    };
 
-    /* Create a new stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp1));
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp2));
+    /* Create the Stamps */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_ConcurrentStamp));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_ConcurrentStamp, &pt_OlderStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_ConcurrentStamp));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_NewerStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_NewerStamp));
 
-    /* Deallocate the valid ID */
-    TEST_SUCCESS(ITC_Id_destroy(&pt_Stamp1->pt_Id));
+    rpt_OtherStamps[0] = pt_OlderStamp;
+    rpt_OtherStamps[1] = pt_NewerStamp;
+    rpt_OtherStamps[2] = pt_ConcurrentStamp;
+    rpt_OtherStamps[3] = pt_Stamp;
 
-    /* Test different invalid IDs are handled properly */
-    for (uint32_t u32_I = 0;
-         u32_I < gu32_InvalidIdTablesSize;
-         u32_I++)
+    /* Compare on the calling thread */
+    memset(&rt_Results[0], 0, sizeof(rt_Results));
+    TEST_SUCCESS(
+        ITC_Stamp_compareMany(
+            pt_Stamp,
+            rpt_OtherStamps,
+            ARRAY_COUNT(rpt_OtherStamps),
+            rt_Results,
+            NULL));
+    TEST_ASSERT_EQUAL_MEMORY(
+        rt_ExpectedResults, rt_Results, sizeof(rt_Results));
+
+    /* Compare through the executor. The number of jobs is capped by the
+     * number of Stamps, and a single job is run on the calling thread */
+    for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(ru32_MaxJobs); u32_I++)
     {
-        /* Construct an invalid ID */
-        gpv_InvalidIdConstructorTable[u32_I](&pt_Stamp1->pt_Id);
-
-        /* Test for the failure */
-        TEST_FAILURE(
-            ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result),
-            ITC_STATUS_CORRUPT_ID);
+        t_Executor.u32_MaxJobs = ru32_MaxJobs[u32_I];
+        u32_JobsRun = 0;
+        memset(&rt_Results[0], 0, sizeof(rt_Results));
 
-        /* Destroy the ID */
-        gpv_InvalidIdDestructorTable[u32_I](&pt_Stamp1->pt_Id);
+        TEST_SUCCESS(
+            ITC_Stamp_compareMany(
+                pt_Stamp,
+                rpt_OtherStamps,
+                ARRAY_COUNT(rpt_OtherStamps),
+                rt_Results,
+                &t_Executor));
+        TEST_ASSERT_EQUAL_MEMORY(
+            rt_ExpectedResults, rt_Results, sizeof(rt_Results));
+        TEST_ASSERT_EQUAL_UINT32(ru32_ExpectedJobsRun[u32_I], u32_JobsRun);
     }
 
-    /* Allocate a valid ID */
-    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp1->pt_Id, NULL));
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_ConcurrentStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OlderStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_NewerStamp));
+}
 
-    /* Deallocate the valid Event */
-    TEST_SUCCESS(ITC_Event_destroy(&pt_Stamp1->pt_Event));
+/* Test the unchecked Stamp operations fail with invalid param or a Stamp
+ * missing one of its components */
+void ITC_Stamp_Test_uncheckedStampOperationsFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_UNCHECKED_API
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_DummyStamp = NULL;
+    ITC_Stamp_Comparison_t t_Result;
+    ITC_Id_t *pt_Id;
 
-    /* Test different invalid Events are handled properly */
-    for (uint32_t u32_I = 0;
-         u32_I < gu32_InvalidEventTablesSize;
-         u32_I++)
-    {
-        /* Construct an invalid Event */
-        gpv_InvalidEventConstructorTable[u32_I](&pt_Stamp1->pt_Event);
+    TEST_FAILURE(
+        ITC_Stamp_forkUnchecked(&pt_DummyStamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_forkUnchecked(NULL, &pt_DummyStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_forkUnchecked(&pt_DummyStamp, &pt_DummyStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Stamp_eventUnchecked(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Stamp_eventNUnchecked(NULL, 1), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_joinUnchecked(&pt_DummyStamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_joinUnchecked(NULL, &pt_DummyStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compareUnchecked(pt_DummyStamp, pt_DummyStamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compareUnchecked(pt_DummyStamp, pt_DummyStamp, &t_Result),
+        ITC_STATUS_INVALID_PARAM);
 
-        /* Test for the failure */
-        TEST_FAILURE(
-            ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result),
-            ITC_STATUS_CORRUPT_EVENT);
+    /* The Stamp components are still checked to be present */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_OtherStamp));
+    pt_Id = pt_Stamp->pt_Id;
+    pt_Stamp->pt_Id = NULL;
 
-        /* Destroy the Event */
-        gpv_InvalidEventDestructorTable[u32_I](&pt_Stamp1->pt_Event);
-    }
+    TEST_FAILURE(
+        ITC_Stamp_forkUnchecked(&pt_Stamp, &pt_DummyStamp),
+        ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(ITC_Stamp_eventUnchecked(pt_Stamp), ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(
+        ITC_Stamp_eventNUnchecked(pt_Stamp, 2), ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(
+        ITC_Stamp_joinUnchecked(&pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(
+        ITC_Stamp_joinUnchecked(&pt_OtherStamp, &pt_Stamp),
+        ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(
+        ITC_Stamp_compareUnchecked(pt_Stamp, pt_OtherStamp, &t_Result),
+        ITC_STATUS_CORRUPT_STAMP);
+    TEST_FAILURE(
+        ITC_Stamp_compareUnchecked(pt_OtherStamp, pt_Stamp, &t_Result),
+        ITC_STATUS_CORRUPT_STAMP);
 
-    /* Deallocate the Stamp */
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp1));
-    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp2));
+    /* Restore the ID and destroy the Stamps */
+    pt_Stamp->pt_Id = pt_Id;
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+#else
+    TEST_IGNORE_MESSAGE("Unchecked API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_UNCHECKED_API */
 }
 
-/* Test comparing two Stamps succeeds */
-void ITC_Stamp_Test_compareStampsSucceeds(void)
+/* Test the unchecked Stamp operations give the same results as the regular
+ * Stamp operations */
+void ITC_Stamp_Test_uncheckedStampOperationsSucceed(void)
 {
-    ITC_Stamp_t *pt_Stamp1;
-    ITC_Stamp_t *pt_Stamp2;
+#if ITC_CONFIG_ENABLE_UNCHECKED_API
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_CheckedStamp;
+    ITC_Stamp_t *pt_CheckedOtherStamp;
     ITC_Stamp_Comparison_t t_Result;
+    ITC_Stamp_Comparison_t t_CheckedResult;
 
-    /* Create the Stamps */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp1));
-    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp1, &pt_Stamp2));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_CheckedStamp));
+
+    /* Fork the Stamps */
+    TEST_SUCCESS(ITC_Stamp_forkUnchecked(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_CheckedStamp, &pt_CheckedOtherStamp));
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherStamp->pt_Id);
 
+    /* Add events to both halves */
+    TEST_SUCCESS(ITC_Stamp_eventUnchecked(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_CheckedStamp));
+    TEST_SUCCESS(ITC_Stamp_eventNUnchecked(pt_OtherStamp, 3));
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_CheckedOtherStamp, 3));
+
+    /* Compare the Stamps */
     TEST_SUCCESS(
-        ITC_TestUtil_newEvent(
-            &pt_Stamp1->pt_Event->pt_Left, pt_Stamp1->pt_Event, 0));
+        ITC_Stamp_compareUnchecked(pt_Stamp, pt_OtherStamp, &t_Result));
     TEST_SUCCESS(
-        ITC_TestUtil_newEvent(
-            &pt_Stamp1->pt_Event->pt_Right, pt_Stamp1->pt_Event, 3));
+        ITC_Stamp_compare(
+            pt_CheckedStamp, pt_CheckedOtherStamp, &t_CheckedResult));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+    TEST_ASSERT_EQUAL(t_CheckedResult, t_Result);
 
-    pt_Stamp2->pt_Event->t_Count = 1;
     TEST_SUCCESS(
-        ITC_TestUtil_newEvent(
-            &pt_Stamp2->pt_Event->pt_Left, pt_Stamp2->pt_Event, 0));
+        ITC_Stamp_compareUnchecked(pt_Stamp, pt_CheckedStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
     TEST_SUCCESS(
-        ITC_TestUtil_newEvent(
-            &pt_Stamp2->pt_Event->pt_Right, pt_Stamp2->pt_Event, 2));
+        ITC_Stamp_compareUnchecked(
+            pt_OtherStamp, pt_CheckedOtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
 
-    /* Compare Stamps */
-    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result));
+    /* Join the Stamps */
+    TEST_SUCCESS(ITC_Stamp_joinUnchecked(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_CheckedStamp, &pt_CheckedOtherStamp));
+    TEST_ASSERT_NULL(pt_OtherStamp);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_SUCCESS(ITC_Stamp_validate(pt_Stamp));
+
+    TEST_SUCCESS(
+        ITC_Stamp_compareUnchecked(pt_Stamp, pt_CheckedStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_CheckedStamp));
+#else
+    TEST_IGNORE_MESSAGE("Unchecked API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_UNCHECKED_API */
+}
+
+/* Test forked, cloned and peeked Stamps share the Event tree until modified */
+void ITC_Stamp_Test_copyOnWriteEventsSucceed(void)
+{
+#if ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_ForkedStamp;
+    ITC_Stamp_t *pt_ClonedStamp;
+    ITC_Stamp_t *pt_PeekStamp;
+    ITC_Stamp_t *apt_Stamps[3];
+    ITC_Event_t *pt_SharedEvent;
+    ITC_Stamp_Comparison_t t_Result;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_Stamp, 5));
+
+    /* Test fork, clone and peek share the Event tree */
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_ForkedStamp));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_ClonedStamp));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_PeekStamp));
+    pt_SharedEvent = pt_Stamp->pt_Event;
+    TEST_ASSERT_TRUE(pt_ForkedStamp->pt_Event == pt_SharedEvent);
+    TEST_ASSERT_TRUE(pt_ClonedStamp->pt_Event == pt_SharedEvent);
+    TEST_ASSERT_TRUE(pt_PeekStamp->pt_Event == pt_SharedEvent);
+    TEST_ASSERT_EQUAL(3, pt_SharedEvent->u32_ShareCount);
+
+    /* Test comparing does not copy the Event tree */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_PeekStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_ASSERT_TRUE(pt_PeekStamp->pt_Event == pt_SharedEvent);
+
+    /* Test adding an event copies the Event tree of that Stamp only */
+    TEST_SUCCESS(ITC_Stamp_event(pt_ForkedStamp));
+    TEST_ASSERT_TRUE(pt_ForkedStamp->pt_Event != pt_SharedEvent);
+    TEST_ASSERT_EQUAL(2, pt_SharedEvent->u32_ShareCount);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_SharedEvent, 5);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_ForkedStamp, &t_Result));
     TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Result);
-    /* Compare the other way around */
-    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp2, pt_Stamp1, &t_Result));
-    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
 
-    /* Make the 2 Stamps concurrent */
-    pt_Stamp2->pt_Event->pt_Right->t_Count -= 1;
+    /* Test destroying a Stamp only releases its reference */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_ClonedStamp));
+    TEST_ASSERT_EQUAL(1, pt_SharedEvent->u32_ShareCount);
+
+    /* Test joining Stamps sharing the same Event tree */
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_ClonedStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_ClonedStamp));
+    TEST_ASSERT_NULL(pt_ClonedStamp);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_PeekStamp->pt_Event, 5);
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_ClonedStamp));
+
+    apt_Stamps[0] = pt_Stamp;
+    apt_Stamps[1] = pt_ClonedStamp;
+    apt_Stamps[2] = pt_ForkedStamp;
+    TEST_SUCCESS(ITC_Stamp_joinMany(&apt_Stamps[0], 3, &pt_Stamp));
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_PeekStamp, pt_Stamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Result);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_PeekStamp->pt_Event, 5);
 
-    /* Compare Stamps */
-    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result));
-    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
-    /* Compare the other way around */
-    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp2, pt_Stamp1, &t_Result));
-    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_PeekStamp));
+#else
+    TEST_IGNORE_MESSAGE("Copy-on-write Events are disabled");
+#endif /* ITC_CONFIG_ENABLE_COPY_ON_WRITE_EVENTS */
+}
 
-    /* Check stamps are equal to themselves */
-    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp1, pt_Stamp1, &t_Result));
+/* Test joined Stamps get normalised by the next non-join operation */
+void ITC_Stamp_Test_lazyEventNormalisationSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION && \
+    !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_PeekStamp;
+    ITC_Stamp_t *apt_Stamps[3];
+    ITC_Stamp_Comparison_t t_Result;
+    uint32_t u32_ReclaimedNodes;
+
+    TEST_FAILURE(ITC_Stamp_normalise(NULL), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+
+    /* Test the join leaves the (0, 1, 1) Event behind */
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right, 1);
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event->b_IsDirty);
+
+    /* Test normalising the Stamp explicitly */
+    TEST_SUCCESS(ITC_Stamp_normalise(pt_Stamp));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 1);
+    TEST_ASSERT_FALSE(pt_Stamp->pt_Event->b_IsDirty);
+
+    /* Test joining many Stamps defers the normalisation too */
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_OtherStamp, &apt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(apt_Stamps[2]));
+    apt_Stamps[0] = pt_Stamp;
+    apt_Stamps[1] = pt_OtherStamp;
+    TEST_SUCCESS(ITC_Stamp_joinMany(&apt_Stamps[0], 3, &pt_Stamp));
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event->b_IsDirty);
+
+    /* Test read-only operations do not modify the Stamp */
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_PeekStamp));
+    TEST_SUCCESS(ITC_Stamp_compare(pt_PeekStamp, pt_Stamp, &t_Result));
     TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
-    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp2, pt_Stamp2, &t_Result));
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event->b_IsDirty);
+    TEST_ASSERT_TRUE(pt_PeekStamp->pt_Event->b_IsDirty);
+
+    /* Test normalising a copy leaves the original Stamp untouched */
+    TEST_SUCCESS(ITC_Stamp_normalise(pt_PeekStamp));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_PeekStamp->pt_Event, 2);
+    TEST_ASSERT_FALSE(pt_PeekStamp->pt_Event->b_IsDirty);
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event->b_IsDirty);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_PeekStamp, pt_Stamp, &t_Result));
     TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
 
-    /* Destroy the Stamps */
+    /* Test adding an event to a joined Stamp */
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 3);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_PeekStamp, pt_Stamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Result);
+
+    /* Test compacting a joined Stamp counts the nodes released by the
+     * deferred normalisation of its (3, 1, 1) Event */
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event->b_IsDirty);
+    TEST_SUCCESS(ITC_Stamp_compact(pt_Stamp, 0, &u32_ReclaimedNodes));
+    TEST_ASSERT_EQUAL_UINT32(2, u32_ReclaimedNodes);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 4);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_PeekStamp));
+#else
+    TEST_IGNORE_MESSAGE(
+        "Lazy Event normalisation is disabled or joined Stamps are compacted");
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION && !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
+}
+
+/* Test Stamps with equal IDs share a single interned ID */
+void ITC_Stamp_Test_internedStampIdsSucceed(void)
+{
+#if ITC_CONFIG_ENABLE_ID_INTERNING
+    ITC_Stamp_t *pt_Stamp1;
+    ITC_Stamp_t *pt_Stamp2;
+    ITC_Stamp_t *pt_OtherStamp1;
+    ITC_Stamp_t *pt_OtherStamp2;
+    ITC_Stamp_t *pt_PeekStamp1;
+    ITC_Stamp_t *pt_PeekStamp2;
+
+    TEST_ASSERT_EQUAL(0, ITC_Id_getInternedIdCount());
+
+    /* Test new Stamps share the same seed ID */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp1));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp2));
+    TEST_ASSERT_TRUE(pt_Stamp1->pt_Id == pt_Stamp2->pt_Id);
+    TEST_ASSERT_EQUAL(1, ITC_Id_getInternedIdCount());
+
+    /* Test peek Stamps share the same null ID */
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp1, &pt_PeekStamp1));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp2, &pt_PeekStamp2));
+    TEST_ASSERT_TRUE(pt_PeekStamp1->pt_Id == pt_PeekStamp2->pt_Id);
+    TEST_ITC_ID_IS_NULL_ID(pt_PeekStamp1->pt_Id);
+    TEST_ASSERT_EQUAL(2, ITC_Id_getInternedIdCount());
+
+    /* Test forking equal Stamps produces the same interned halves */
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp1, &pt_OtherStamp1));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp2, &pt_OtherStamp2));
+    TEST_ASSERT_TRUE(pt_Stamp1->pt_Id == pt_Stamp2->pt_Id);
+    TEST_ASSERT_TRUE(pt_OtherStamp1->pt_Id == pt_OtherStamp2->pt_Id);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp1->pt_Id);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherStamp1->pt_Id);
+    /* The seed ID is no longer used */
+    TEST_ASSERT_EQUAL(3, ITC_Id_getInternedIdCount());
+
+    /* Test joining the forked Stamps interns the summed ID */
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp1));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp1, &pt_OtherStamp1));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp2, &pt_OtherStamp2));
+    TEST_ASSERT_TRUE(pt_Stamp1->pt_Id == pt_Stamp2->pt_Id);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp1->pt_Id);
+    TEST_ASSERT_EQUAL(2, ITC_Id_getInternedIdCount());
+
+    /* Test destroying the Stamps removes the interned IDs */
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp1));
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp2));
+    TEST_ASSERT_EQUAL(1, ITC_Id_getInternedIdCount());
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_PeekStamp1));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_PeekStamp2));
+    TEST_ASSERT_EQUAL(0, ITC_Id_getInternedIdCount());
+#else
+    TEST_IGNORE_MESSAGE("ID interning is disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_INTERNING */
 }
 
 /* Test full Stamp lifecycle */
@@ -1162,6 +2815,12 @@ void ITC_Stamp_Test_fullStampLifecycle(void)
         }
     }
 
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    /* Finish the normalisation deferred by the joins */
+    TEST_SUCCESS(ITC_Stamp_normalise(pt_Stamp0));
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
+#if !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
     /* clang-format off */
     /* Test the summed up Stamp has a seed ID with a
      * (1, 3, (0, (0, 0, 1), 3)) Event tree */
@@ -1174,6 +2833,7 @@ void ITC_Stamp_Test_fullStampLifecycle(void)
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp0->pt_Event->pt_Right->pt_Left->pt_Right, 1);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp0->pt_Event->pt_Right->pt_Right, 3);
     /* clang-format on */
+#endif /* !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
 
     /* Add an event */
     TEST_SUCCESS(ITC_Stamp_event(pt_Stamp0));
@@ -1181,7 +2841,9 @@ void ITC_Stamp_Test_fullStampLifecycle(void)
     /* Test the summed up Stamp has a seed ID with a
      * (4) Event tree */
     TEST_ITC_ID_IS_SEED_ID(pt_Stamp0->pt_Id);
+#if !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp0->pt_Event, 4);
+#endif /* !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
 
     /* Split into Stamps with (1, 0) and (0, 1) IDs again */
     TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp0, &pt_Stamp1));
@@ -1193,24 +2855,38 @@ void ITC_Stamp_Test_fullStampLifecycle(void)
     TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp1, &pt_TmpStamp1));
     TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp0, &pt_TmpStamp1));
 
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    /* Finish the normalisation deferred by the joins */
+    TEST_SUCCESS(ITC_Stamp_normalise(pt_Stamp0));
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
     /* Test the Stamp IDs haven't changed but the Event history has been shared */
     TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp0->pt_Id);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Stamp1->pt_Id);
+#if !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp0->pt_Event, 4);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp0->pt_Event->pt_Left, 0);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp0->pt_Event->pt_Right, 1);
-    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Stamp1->pt_Id);
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp1->pt_Event, 4);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp1->pt_Event->pt_Left, 0);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp1->pt_Event->pt_Right, 1);
+#endif /* !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
 
     /* Join Stamps back into a Stamp with a seed ID */
     TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp0, &pt_Stamp1));
 
+#if ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION
+    /* Finish the normalisation deferred by the joins */
+    TEST_SUCCESS(ITC_Stamp_normalise(pt_Stamp0));
+#endif /* ITC_CONFIG_ENABLE_LAZY_EVENT_NORMALISATION */
+
     /* Test the Stamp has a seed ID but the same Event history */
     TEST_ITC_ID_IS_SEED_ID(pt_Stamp0->pt_Id);
+#if !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp0->pt_Event, 4);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp0->pt_Event->pt_Left, 0);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp0->pt_Event->pt_Right, 1);
+#endif /* !ITC_CONFIG_STAMP_JOIN_COMPACTION_DEPTH */
 
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp0));
 }
@@ -2131,3 +3807,141 @@ void ITC_Stamp_Test_setEventOfStampSuccessful(void)
     TEST_IGNORE_MESSAGE("Extended API support is disabled");
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 }
+
+/* Test the statistics track the Stamp operations */
+void ITC_Stamp_Test_statsTrackOperations(void)
+{
+#if ITC_CONFIG_ENABLE_STATS
+    ITC_Port_Stats_t t_Stats;
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_DeserialisedStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[32];
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Port_resetStats());
+
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_eventN(pt_OtherStamp, 2));
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_FAILURE(
+        ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp));
+
+    TEST_SUCCESS(ITC_Port_getStats(&t_Stats));
+
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Stats.rt_Operations[ITC_PORT_OPERATION_FORK].u32_Calls);
+    TEST_ASSERT_EQUAL_UINT32(
+        0, t_Stats.rt_Operations[ITC_PORT_OPERATION_FORK].u32_FailedCalls);
+    TEST_ASSERT_NOT_EQUAL(
+        0, t_Stats.rt_Operations[ITC_PORT_OPERATION_FORK].u32_NodesAllocated);
+    TEST_ASSERT_EQUAL_UINT32(
+        2, t_Stats.rt_Operations[ITC_PORT_OPERATION_EVENT].u32_Calls);
+    TEST_ASSERT_EQUAL_UINT32(
+        2, t_Stats.rt_Operations[ITC_PORT_OPERATION_COMPARE].u32_Calls);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Stats.rt_Operations[ITC_PORT_OPERATION_COMPARE].u32_FailedCalls);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Stats.rt_Operations[ITC_PORT_OPERATION_JOIN].u32_Calls);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Stats.rt_Operations[ITC_PORT_OPERATION_SERIALISE].u32_Calls);
+    /* Serialising does not allocate */
+    TEST_ASSERT_EQUAL_UINT32(
+        0,
+        t_Stats.rt_Operations[ITC_PORT_OPERATION_SERIALISE].u32_NodesAllocated);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Stats.rt_Operations[ITC_PORT_OPERATION_DESERIALISE].u32_Calls);
+    TEST_ASSERT_NOT_EQUAL(
+        0,
+        t_Stats.rt_Operations[ITC_PORT_OPERATION_DESERIALISE]
+            .u32_NodesAllocated);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_DeserialisedStamp));
+#else
+    TEST_IGNORE_MESSAGE("Statistics are disabled");
+#endif /* ITC_CONFIG_ENABLE_STATS */
+}
+
+/* Test the tracing hooks are called at the phase boundaries of the Stamp
+ * operations */
+void ITC_Stamp_Test_tracingHooksTrackPhases(void)
+{
+#if ITC_CONFIG_ENABLE_TRACING
+    static TraceCalls_t t_Calls;
+    const ITC_Port_TraceHooks_t t_Hooks = {traceBegin, traceEnd, &t_Calls};
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint32_t u32_I;
+
+    memset(&t_Calls, 0, sizeof(t_Calls));
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Port_setTraceHooks(&t_Hooks));
+
+    /* Split the seed ID into (1, 0) and (0, 1) */
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Calls.ru32_Ends[ITC_PORT_TRACE_PHASE_ID_SPLIT]);
+    TEST_ASSERT_EQUAL_UINT32(
+        6, t_Calls.ru32_TreeSizes[ITC_PORT_TRACE_PHASE_ID_SPLIT]);
+
+    /* Grow the Event into (0, 1, 0) */
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Calls.ru32_Ends[ITC_PORT_TRACE_PHASE_EVENT_FILL]);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Calls.ru32_TreeSizes[ITC_PORT_TRACE_PHASE_EVENT_FILL]);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Calls.ru32_Ends[ITC_PORT_TRACE_PHASE_EVENT_GROW]);
+    TEST_ASSERT_EQUAL_UINT32(
+        3, t_Calls.ru32_TreeSizes[ITC_PORT_TRACE_PHASE_EVENT_GROW]);
+
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Calls.ru32_Ends[ITC_PORT_TRACE_PHASE_EVENT_COMPARE]);
+    TEST_ASSERT_EQUAL_UINT32(
+        4, t_Calls.ru32_TreeSizes[ITC_PORT_TRACE_PHASE_EVENT_COMPARE]);
+
+    /* Join back into a seed ID with a (1) Event */
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_NOT_EQUAL(
+        0, t_Calls.ru32_Ends[ITC_PORT_TRACE_PHASE_EVENT_JOIN_MERGE]);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Calls.ru32_Ends[ITC_PORT_TRACE_PHASE_ID_SUM]);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Calls.ru32_TreeSizes[ITC_PORT_TRACE_PHASE_ID_SUM]);
+    TEST_ASSERT_NOT_EQUAL(
+        0, t_Calls.ru32_Ends[ITC_PORT_TRACE_PHASE_STAMP_VALIDATE]);
+
+    /* Every phase that has begun has also ended */
+    TEST_ASSERT_EQUAL_UINT32(0, t_Calls.u32_OpenPhases);
+    for (u32_I = 0; u32_I < ITC_PORT_TRACE_PHASE_COUNT; u32_I++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(
+            t_Calls.ru32_Begins[u32_I], t_Calls.ru32_Ends[u32_I]);
+    }
+
+    /* Unregistered hooks are not called anymore */
+    TEST_SUCCESS(ITC_Port_setTraceHooks(NULL));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_EQUAL_UINT32(
+        1, t_Calls.ru32_Ends[ITC_PORT_TRACE_PHASE_ID_SPLIT]);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+#else
+    TEST_IGNORE_MESSAGE("Tracing is disabled");
+#endif /* ITC_CONFIG_ENABLE_TRACING */
+}